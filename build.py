@@ -1,5 +1,11 @@
+import argparse
+
 from tools.DatasetBaker import DatasetBaker
 
 if __name__ == '__main__':
-    db = DatasetBaker()
+    parser = argparse.ArgumentParser(description="Bake the datasets into C++ headers.")
+    parser.add_argument("--emit-binary", action="store_true",
+                        help="also write each table as a memory-mappable .rstree file next to its header")
+    args = parser.parse_args()
 
+    db = DatasetBaker(emit_binary=args.emit_binary)
@@ -1,5 +1,6 @@
 #include <pybind11/pybind11.h>
 #include <logngine/core/hello.h>
+#include <logngine/core/ThreadPool.h>
 
 namespace py = pybind11;
 
@@ -10,4 +11,7 @@ PYBIND11_MODULE(_core_core, m) {
         &logngine::core::hello,
         "Return a greeting from the C++ core package!"
     );
+
+    // The process's one thread pool, which the other extensions adopt as they load (see `ThreadPool::adopt_shared`)
+    m.attr("_thread_pool") = py::capsule(&logngine::core::ThreadPool::shared(), "logngine.core.ThreadPool");
 }
\ No newline at end of file
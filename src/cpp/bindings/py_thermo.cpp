@@ -1,7 +1,61 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include <logngine/core/ThreadPool.h>
 #include <logngine/thermo/hello.h>
+#include <logngine/thermo/ThermoState.h>
+#include <logngine/thermo/RectilinearTable.h>
+#include <logngine/thermo/UniformGrid.h>
+#include <logngine/thermo/SaturationCurve.h>
+#include <logngine/thermo/StateEngine.h>
+#include <logngine/thermo/Water.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace py = pybind11;
+using namespace logngine::thermo;
+
+namespace
+{
+    // Row of the structured array returned by `get_state_batch`.
+    struct StateRecord
+    {
+        double pressure;
+        double temperature;
+        double specific_volume;
+        double specific_internal_energy;
+        double specific_enthalpy;
+        double specific_entropy;
+        double quality;
+        std::uint8_t phase;
+    };
+
+    Property parse_property(const std::string& name)
+    {
+        if (name == "pressure") return Property::Pressure;
+        if (name == "temperature") return Property::Temperature;
+        if (name == "specific_volume") return Property::SpecificVolume;
+        if (name == "specific_internal_energy") return Property::SpecificInternalEnergy;
+        if (name == "specific_enthalpy") return Property::SpecificEnthalpy;
+        if (name == "specific_entropy") return Property::SpecificEntropy;
+        throw py::value_error("Unknown thermodynamic property '" + name + "'...");
+    }
+
+    // `None` is the backend the library was built to default to.
+    water::Backend parse_backend(const std::optional<std::string>& name)
+    {
+        if (!name) return water::BACKEND;
+        if (*name == "tables") return water::Backend::Tables;
+        if (*name == "if97") return water::Backend::IF97;
+        throw py::value_error("Unknown water backend '" + *name + "'...");
+    }
+}
+
+PYBIND11_NUMPY_DTYPE(StateRecord, pressure, temperature, specific_volume, specific_internal_energy, specific_enthalpy, specific_entropy, quality, phase);
 
 PYBIND11_MODULE(_thermo_core, m) {
     m.doc() = "Bindings for logngine.thermo's C++ source.";
@@ -10,4 +64,148 @@ PYBIND11_MODULE(_thermo_core, m) {
         &logngine::thermo::hello,
         "Return a greeting from the C++ thermo package!"
     );
-}
\ No newline at end of file
+
+    // Batched calls share `_core_core`'s pool, so one nested in another extension's parallel work runs inline on
+    // its thread instead of fanning out on a second pool
+    auto pool = py::module_::import("logngine.core._core._core_core").attr("_thread_pool").cast<py::capsule>();
+    logngine::core::ThreadPool::adopt_shared(*pool.get_pointer<logngine::core::ThreadPool>());
+
+    py::class_<ThermoState>(m, "ThermoState", "Intensive state in SI units (Pa, K, m^3/kg, J/kg, J/kg, J/(kg*K)).")
+        .def_readonly("pressure", &ThermoState::pressure)
+        .def_readonly("temperature", &ThermoState::temperature)
+        .def_readonly("specific_volume", &ThermoState::specific_volume)
+        .def_readonly("specific_internal_energy", &ThermoState::specific_internal_energy)
+        .def_readonly("specific_enthalpy", &ThermoState::specific_enthalpy)
+        .def_readonly("specific_entropy", &ThermoState::specific_entropy)
+        .def("__repr__", [](const ThermoState& s) {
+            return "ThermoState(pressure=" + std::to_string(s.pressure) + ", temperature=" + std::to_string(s.temperature)
+                + ", specific_volume=" + std::to_string(s.specific_volume) + ", specific_internal_energy=" + std::to_string(s.specific_internal_energy)
+                + ", specific_enthalpy=" + std::to_string(s.specific_enthalpy) + ", specific_entropy=" + std::to_string(s.specific_entropy) + ")";
+        });
+
+    py::class_<ThermoGradient>(m, "ThermoGradient", "State with its partial derivatives in pressure and temperature.")
+        .def_readonly("value", &ThermoGradient::value)
+        .def_readonly("d_dpressure", &ThermoGradient::d_dpressure)
+        .def_readonly("d_dtemperature", &ThermoGradient::d_dtemperature);
+
+    py::class_<UncertainState>(m, "UncertainState", "State with the 1-sigma uncertainty of every property.")
+        .def_readonly("value", &UncertainState::value)
+        .def_readonly("sigma", &UncertainState::sigma);
+
+    py::class_<LookupStats>(m, "LookupStats", "Searches answered from the warm-start cache (`hits`) and by binary search (`misses`).")
+        .def_readonly("hits", &LookupStats::hits)
+        .def_readonly("misses", &LookupStats::misses);
+
+    py::class_<RectilinearTable>(m, "RectilinearTable", "Single-phase table of constant-pressure blocks with O(log n) bilinear or cubic lookup.")
+        .def("interpolate", &RectilinearTable::interpolate<false>, py::arg("pressure"), py::arg("temperature"),
+             "State at (pressure [Pa], temperature [K]), or None outside the table.")
+        .def("interpolate_with_uncertainty", &RectilinearTable::interpolate<true>, py::arg("pressure"), py::arg("temperature"),
+             "`interpolate` with the 1-sigma uncertainty of each property, propagated from the rows' own; None outside the table.")
+        .def("differentiate", &RectilinearTable::differentiate, py::arg("pressure"), py::arg("temperature"),
+             "`interpolate` with its partial derivatives, or None outside the table.")
+        .def_property_readonly("cubic", &RectilinearTable::cubic, "Whether the table is a cubic spline rather than bilinear.")
+        .def_property_readonly("uncertain", &RectilinearTable::uncertain, "Whether the rows carry uncertainties to propagate.")
+        .def_property_readonly("pressures", [](const RectilinearTable& t) {
+            return std::vector<double>(t.pressures().begin(), t.pressures().end());
+        }, "Pressure of every constant-pressure block, ascending.")
+        .def("__len__", &RectilinearTable::size)
+        .def_static("lookup_stats", &RectilinearTable::lookup_stats,
+                    "Warm-start cache hits and misses of the calling thread's lookups, over all tables.")
+        .def_static("reset_lookup_stats", &RectilinearTable::reset_lookup_stats);
+
+    py::class_<UniformGridReport>(m, "UniformGridReport", "Memory and measured interpolation error of a UniformGrid.")
+        .def_readonly("bytes", &UniformGridReport::bytes)
+        .def_readonly("nodes", &UniformGridReport::nodes)
+        .def_readonly("missing_nodes", &UniformGridReport::missing_nodes)
+        .def_readonly("max_error", &UniformGridReport::max_error)
+        .def_readonly("max_relative_error", &UniformGridReport::max_relative_error);
+
+    py::class_<UniformGrid>(m, "UniformGrid", "A (pressure, temperature) box of a table resampled onto evenly spaced nodes for O(1) bilinear lookup.")
+        .def(py::init<const RectilinearTable&, std::pair<double, double>, std::pair<double, double>, std::pair<size_t, size_t>>(),
+             py::arg("table"), py::arg("pressure_range"), py::arg("temperature_range"), py::arg("shape"),
+             "Resamples `table` over the ranges [Pa], [K] onto `shape` = (pressure nodes, temperature nodes).")
+        .def("interpolate", &UniformGrid::interpolate, py::arg("pressure"), py::arg("temperature"),
+             "State at (pressure [Pa], temperature [K]), or None outside the grid or the table it was built from.")
+        .def_property_readonly("report", &UniformGrid::report)
+        .def_property_readonly("pressure_range", &UniformGrid::pressure_range)
+        .def_property_readonly("temperature_range", &UniformGrid::temperature_range)
+        .def_property_readonly("shape", &UniformGrid::shape);
+
+    py::class_<SaturationState>(m, "SaturationState", "Saturated liquid and vapor at one point of the saturation curve.")
+        .def_readonly("liquid", &SaturationState::liquid)
+        .def_readonly("vapor", &SaturationState::vapor)
+        .def("mixture", &SaturationState::mixture, py::arg("quality"), "Two-phase mixture of vapor mass fraction `quality`.");
+
+    py::class_<SaturationCurve>(m, "SaturationCurve", "Saturated properties as O(log n) monotone-spline lookups in temperature or pressure.")
+        .def("at_temperature", &SaturationCurve::at_temperature, py::arg("temperature"),
+             "Saturation state at `temperature` [K], or None outside the curve.")
+        .def("at_pressure", &SaturationCurve::at_pressure, py::arg("pressure"),
+             "Saturation state at `pressure` [Pa], or None outside the curve.")
+        .def_property_readonly("temperature_range", &SaturationCurve::temperature_range)
+        .def_property_readonly("pressure_range", &SaturationCurve::pressure_range)
+        .def("__len__", &SaturationCurve::size);
+
+    py::enum_<Phase>(m, "Phase", "Phase region of a state; stored as its integer value in `get_state_batch` output.")
+        .value("OUT_OF_RANGE", Phase::OutOfRange)
+        .value("COMPRESSED", Phase::Compressed)
+        .value("SATURATED", Phase::Saturated)
+        .value("SUPERHEATED", Phase::Superheated);
+
+    py::class_<PhaseState>(m, "PhaseState", "State with its phase region, and its quality inside the dome (NaN elsewhere).")
+        .def_readonly("state", &PhaseState::state)
+        .def_readonly("phase", &PhaseState::phase)
+        .def_readonly("quality", &PhaseState::quality);
+
+    m.attr("WATER_BACKEND") = water::BACKEND == water::Backend::IF97 ? "if97" : "tables";
+
+    m.def("get_state", [](const double prop_a, const double prop_b, const std::pair<std::string, std::string>& which, const std::optional<std::string>& backend) {
+            const Property a = parse_property(which.first);
+            const Property b = parse_property(which.second);
+            if (parse_backend(backend) == water::Backend::IF97) return water::get_state<water::Backend::IF97>(a, prop_a, b, prop_b);
+            return water::get_state<water::Backend::Tables>(a, prop_a, b, prop_b);
+        },
+        py::arg("prop_a"), py::arg("prop_b"), py::arg("which") = std::make_pair(std::string("pressure"), std::string("temperature")),
+        py::arg("backend") = py::none(),
+        "Water state from any two of its ThermoState properties, named by `which`. SI units. `backend` is \"tables\" or "
+        "\"if97\" (IAPWS-IF97), or None for the build's default, `WATER_BACKEND`.");
+
+    using Doubles = py::array_t<double, py::array::c_style | py::array::forcecast>;
+    m.def("get_state_batch", [](const Doubles& prop_a, const Doubles& prop_b, const std::pair<std::string, std::string>& which, const std::optional<std::string>& backend) {
+            const Property a = parse_property(which.first);
+            const Property b = parse_property(which.second);
+            const water::Backend source = parse_backend(backend);
+            if (prop_a.ndim() != prop_b.ndim() || !std::equal(prop_a.shape(), prop_a.shape() + prop_a.ndim(), prop_b.shape()))
+                throw py::value_error("`prop_a` and `prop_b` must have the same shape...");
+
+            const auto n = static_cast<size_t>(prop_a.size());
+            py::array_t<StateRecord> out(std::vector<py::ssize_t>(prop_a.shape(), prop_a.shape() + prop_a.ndim()));
+            StateRecord* records = out.mutable_data();
+            {
+                py::gil_scoped_release release;
+                std::vector<PhaseState> states(n);
+                if (source == water::Backend::IF97) water::get_state_batch<water::Backend::IF97>(a, {prop_a.data(), n}, b, {prop_b.data(), n}, states);
+                else water::get_state_batch<water::Backend::Tables>(a, {prop_a.data(), n}, b, {prop_b.data(), n}, states);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const auto& [state, phase, quality] = states[i];
+                    records[i] = {
+                        state.pressure, state.temperature, state.specific_volume, state.specific_internal_energy,
+                        state.specific_enthalpy, state.specific_entropy, quality, static_cast<std::uint8_t>(phase),
+                    };
+                }
+            }
+            return out;
+        },
+        py::arg("prop_a"), py::arg("prop_b"), py::arg("which") = std::make_pair(std::string("pressure"), std::string("temperature")),
+        py::arg("backend") = py::none(),
+        "Water states for every pair (prop_a[i], prop_b[i]) of the properties named by `which`, as a structured array "
+        "of ThermoState fields plus `quality` (NaN outside the dome) and `phase` (a `Phase` value). SI units. `backend` as "
+        "in `get_state`.");
+
+    m.def("water_superheated_table", &water::superheated_table, py::return_value_policy::reference,
+          "Superheated water table engine (built on first use).");
+    m.def("water_compressed_table", &water::compressed_table, py::return_value_policy::reference,
+          "Compressed water table engine (built on first use).");
+    m.def("water_saturation_curve", &water::saturation_curve, py::return_value_policy::reference,
+          "Water saturation curve engine (built on first use).");
+}
@@ -1,7 +1,68 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include <logngine/core/ThreadPool.h>
 #include <logngine/uncertainty/hello.h>
+#include <logngine/uncertainty/Distribution.h>
+#include <logngine/uncertainty/MonteCarlo.h>
+#include <logngine/uncertainty/Sampler.h>
+#include <logngine/uncertainty/SensitivityAnalysis.h>
+#include <logngine/uncertainty/Statistics.h>
+#include <logngine/uncertainty/TableSampler.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
 
 namespace py = pybind11;
+using namespace logngine::uncertainty;
+
+namespace
+{
+    using Doubles = py::array_t<double, py::array::c_style | py::array::forcecast>;
+
+    // Pickles an accumulator as its `save` state, so partial summaries can be sent between processes and merged.
+    template <typename Accumulator>
+    auto pickle()
+    {
+        return py::pickle(
+            [](const Accumulator& a) { return py::make_tuple(a.save()); },
+            [](const py::tuple& t) { return Accumulator::load(t[0].cast<std::vector<double>>()); });
+    }
+
+    // `add` for every value of an array, without the GIL.
+    template <typename Accumulator>
+    void add_batch(Accumulator& a, const Doubles& values)
+    {
+        const double* x = values.data();
+        const auto n = static_cast<size_t>(values.size());
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < n; ++i) a.add(x[i]);
+    }
+
+    // Runs a vectorized Python model, `model(first_sample, inputs) -> outputs`, on each block. Blocks come from pool
+    // threads, which take turns holding the GIL for the call; batched lookups the model makes (e.g.
+    // `thermo.get_state_batch`) release it and, as every extension shares `_core_core`'s pool, run on the calling
+    // thread alone.
+    MonteCarlo::Model python_model(const py::function& model, const size_t dimension, const size_t outputs)
+    {
+        return [&model, dimension, outputs](const std::uint64_t first_sample, const std::span<const double> inputs, const std::span<double> out)
+        {
+            py::gil_scoped_acquire gil;
+            const size_t count = out.size() / outputs;
+            Doubles x({count, dimension});
+            std::copy(inputs.begin(), inputs.end(), x.mutable_data());
+
+            const auto y = Doubles::ensure(model(first_sample, x));
+            if (!y || static_cast<size_t>(y.size()) != out.size())
+                throw py::value_error("Monte Carlo model must return (count, outputs) values...");
+            std::copy(y.data(), y.data() + y.size(), out.begin());
+        };
+    }
+}
 
 PYBIND11_MODULE(_uncertainty_core, m) {
     m.doc() = "Bindings for logngine.uncertainty's C++ source.";
@@ -10,4 +71,203 @@ PYBIND11_MODULE(_uncertainty_core, m) {
         &logngine::uncertainty::hello,
         "Return a greeting from the C++ uncertainty package!"
     );
-}
\ No newline at end of file
+
+    // Batched calls share `_core_core`'s pool, so one nested in another extension's parallel work runs inline on
+    // its thread instead of fanning out on a second pool
+    auto pool = py::module_::import("logngine.core._core._core_core").attr("_thread_pool").cast<py::capsule>();
+    logngine::core::ThreadPool::adopt_shared(*pool.get_pointer<logngine::core::ThreadPool>());
+
+    m.def("standard_normal_quantile", &standard_normal_quantile, py::arg("p"), "Inverse of the standard normal CDF.");
+
+    py::class_<Distribution>(m, "Distribution", "Input distribution, sampled by inverse CDF.")
+        .def_static("normal", &Distribution::normal, py::arg("mean"), py::arg("standard_deviation"))
+        .def_static("uniform", &Distribution::uniform, py::arg("low"), py::arg("high"))
+        .def_static("log_normal", &Distribution::log_normal, py::arg("log_mean"), py::arg("log_standard_deviation"))
+        .def_static("triangular", &Distribution::triangular, py::arg("low"), py::arg("mode"), py::arg("high"))
+        .def("quantile", &Distribution::quantile, py::arg("p"), "Value below which a fraction `p` of the distribution lies.")
+        .def_property_readonly("mean", &Distribution::mean)
+        .def_property_readonly("variance", &Distribution::variance);
+
+    py::class_<Sampler>(m, "Sampler", "Points of the unit hypercube: pseudo-random, Latin hypercube, Sobol or Halton.")
+        .def_static("random", &Sampler::random, py::arg("dimension"), py::arg("seed") = 0)
+        .def_static("latin_hypercube", &Sampler::latin_hypercube, py::arg("dimension"), py::arg("samples"), py::arg("seed") = 0)
+        .def_static("sobol", &Sampler::sobol, py::arg("dimension"), py::arg("seed") = 0, py::arg("scramble") = true)
+        .def_static("halton", &Sampler::halton, py::arg("dimension"), py::arg("seed") = 0, py::arg("scramble") = true)
+        .def("points", [](const Sampler& self, const std::uint64_t first, const size_t count) {
+                Doubles out({count, self.dimension()});
+                self.points(first, count, std::span(out.mutable_data(), count * self.dimension()));
+                return out;
+            },
+            py::arg("first"), py::arg("count"), "Points [first, first + count) in (0, 1)^dimension, (count, dimension).")
+        .def("sample", [](const Sampler& self, const std::vector<Distribution>& inputs, const std::uint64_t first, const size_t count) {
+                Doubles out({count, self.dimension()});
+                self.sample(inputs, first, count, std::span(out.mutable_data(), count * self.dimension()));
+                return out;
+            },
+            py::arg("inputs"), py::arg("first"), py::arg("count"), "`points` through the quantile functions of `inputs`, (count, dimension).")
+        .def_property_readonly("dimension", &Sampler::dimension)
+        .def_property_readonly("seed", &Sampler::seed)
+        .def_property_readonly("size", &Sampler::size);
+
+    py::class_<Moments>(m, "Moments", "Streaming count, mean and variance (Welford); mergeable.")
+        .def(py::init<>())
+        .def("add", &Moments::add, py::arg("x"))
+        .def("add_batch", &add_batch<Moments>, py::arg("values"), "`add` for every value of an array.")
+        .def("merge", &Moments::merge, py::arg("other"))
+        .def("save", &Moments::save, "Flat state that `load` restores.")
+        .def_static("load", [](const std::vector<double>& state) { return Moments::load(state); }, py::arg("state"))
+        .def(pickle<Moments>())
+        .def_property_readonly("count", &Moments::count)
+        .def_property_readonly("mean", &Moments::mean)
+        .def_property_readonly("variance", &Moments::variance)
+        .def_property_readonly("standard_deviation", &Moments::standard_deviation)
+        .def_property_readonly("standard_error", &Moments::standard_error)
+        .def_property_readonly("min", &Moments::min)
+        .def_property_readonly("max", &Moments::max);
+
+    py::class_<TDigest>(m, "TDigest", "Streaming quantile estimates in bounded memory (merging t-digest); mergeable.")
+        .def(py::init<double>(), py::arg("compression") = 200.0)
+        .def("add", &TDigest::add, py::arg("x"), py::arg("weight") = 1.0)
+        .def("add_batch", &add_batch<TDigest>, py::arg("values"), "`add` for every value of an array.")
+        .def("merge", &TDigest::merge, py::arg("other"))
+        .def("save", &TDigest::save, "Flat state that `load` restores.")
+        .def_static("load", [](const std::vector<double>& state) { return TDigest::load(state); }, py::arg("state"))
+        .def(pickle<TDigest>())
+        .def("quantile", &TDigest::quantile, py::arg("q"))
+        .def_property_readonly("count", &TDigest::count);
+
+    py::class_<Covariance>(m, "Covariance", "Streaming means and covariance matrix of vectors; mergeable.")
+        .def(py::init<size_t>(), py::arg("dimension"))
+        .def("add", [](Covariance& self, const Doubles& x) { self.add(std::span(x.data(), static_cast<size_t>(x.size()))); }, py::arg("x"))
+        .def("add_batch", [](Covariance& self, const Doubles& rows) {
+                if (rows.ndim() != 2 || static_cast<size_t>(rows.shape(1)) != self.dimension())
+                    throw py::value_error("Covariance batch must be (n, dimension)...");
+                const size_t d = self.dimension();
+                const auto n = static_cast<size_t>(rows.shape(0));
+                const double* x = rows.data();
+                py::gil_scoped_release release;
+                for (size_t i = 0; i < n; ++i) self.add(std::span(x + i * d, d));
+            },
+            py::arg("rows"), "`add` for every row of an (n, dimension) array.")
+        .def("merge", &Covariance::merge, py::arg("other"))
+        .def("save", &Covariance::save, "Flat state that `load` restores.")
+        .def_static("load", [](const std::vector<double>& state) { return Covariance::load(state); }, py::arg("state"))
+        .def(pickle<Covariance>())
+        .def_property_readonly("dimension", &Covariance::dimension)
+        .def_property_readonly("count", &Covariance::count)
+        .def_property_readonly("mean", [](const Covariance& self) {
+            Doubles out(static_cast<py::ssize_t>(self.dimension()));
+            for (size_t i = 0; i < self.dimension(); ++i) out.mutable_data()[i] = self.mean(i);
+            return out;
+        })
+        .def_property_readonly("matrix", [](const Covariance& self) {
+            const size_t d = self.dimension();
+            Doubles out({d, d});
+            const auto matrix = self.matrix();
+            std::copy(matrix.begin(), matrix.end(), out.mutable_data());
+            return out;
+        }, "Unbiased covariance matrix, (dimension, dimension).")
+        .def("correlation", &Covariance::correlation, py::arg("i"), py::arg("j"));
+
+    py::class_<Histogram>(m, "Histogram", "Streaming counts in equal-width bins over [low, high); mergeable.")
+        .def(py::init<double, double, size_t>(), py::arg("low"), py::arg("high"), py::arg("bins"))
+        .def("add", &Histogram::add, py::arg("x"))
+        .def("add_batch", &add_batch<Histogram>, py::arg("values"), "`add` for every value of an array.")
+        .def("merge", &Histogram::merge, py::arg("other"))
+        .def("save", &Histogram::save, "Flat state that `load` restores.")
+        .def_static("load", [](const std::vector<double>& state) { return Histogram::load(state); }, py::arg("state"))
+        .def(pickle<Histogram>())
+        .def("quantile", &Histogram::quantile, py::arg("q"))
+        .def_property_readonly("counts", [](const Histogram& self) {
+            return std::vector<std::uint64_t>(self.counts().begin(), self.counts().end());
+        })
+        .def_property_readonly("count", &Histogram::count)
+        .def_property_readonly("underflow", &Histogram::underflow)
+        .def_property_readonly("overflow", &Histogram::overflow)
+        .def_property_readonly("low", &Histogram::low)
+        .def_property_readonly("high", &Histogram::high);
+
+    py::class_<MonteCarloResult>(m, "MonteCarloResult", "Streaming summary of every output of a Monte Carlo run.")
+        .def_readonly("samples", &MonteCarloResult::samples)
+        .def_readonly("moments", &MonteCarloResult::moments)
+        .def_readonly("quantiles", &MonteCarloResult::quantiles)
+        .def("quantile", &MonteCarloResult::quantile, py::arg("output"), py::arg("q"));
+
+    py::class_<MonteCarlo>(m, "MonteCarlo", "Parallel, reproducible Monte Carlo propagation of independent inputs through a model.")
+        .def(py::init<std::vector<Distribution>, std::uint64_t>(), py::arg("inputs"), py::arg("seed") = 0)
+        .def(py::init<std::vector<Distribution>, Sampler>(), py::arg("inputs"), py::arg("sampler"))
+        .def("run", [](const MonteCarlo& self, const py::function& model, const size_t outputs, const std::uint64_t samples, const size_t block) {
+                const MonteCarlo::Model wrapped = python_model(model, self.dimension(), outputs);
+                py::gil_scoped_release release;
+                return self.run(wrapped, outputs, samples, block);
+            },
+            py::arg("model"), py::arg("outputs"), py::arg("samples"), py::arg("block") = 4096,
+            "Evaluates `model(first_sample, inputs)` on blocks of samples; `inputs` is (count, dimension) and the model "
+            "returns (count, outputs) values. Non-finite outputs are left out of the summary.")
+        .def("sample", [](const MonteCarlo& self, const std::uint64_t first_sample, const size_t count) {
+                Doubles out({count, self.dimension()});
+                self.sample(first_sample, count, std::span(out.mutable_data(), count * self.dimension()));
+                return out;
+            },
+            py::arg("first_sample"), py::arg("count"), "Inputs of samples [first_sample, first_sample + count), (count, dimension).")
+        .def_property_readonly("dimension", &MonteCarlo::dimension)
+        .def_property_readonly("seed", &MonteCarlo::seed);
+
+    py::class_<SobolIndex>(m, "SobolIndex", "A Sobol index with its bootstrap confidence interval.")
+        .def_readonly("estimate", &SobolIndex::estimate)
+        .def_readonly("low", &SobolIndex::low)
+        .def_readonly("high", &SobolIndex::high)
+        .def("__repr__", [](const SobolIndex& self) {
+            return "SobolIndex(" + std::to_string(self.estimate) + ", [" + std::to_string(self.low) + ", " + std::to_string(self.high) + "])";
+        });
+
+    py::class_<SensitivityResult>(m, "SensitivityResult", "Sobol indices of every output with respect to every input.")
+        .def_readonly("samples", &SensitivityResult::samples)
+        .def_readonly("evaluations", &SensitivityResult::evaluations)
+        .def_readonly("inputs", &SensitivityResult::inputs)
+        .def_readonly("outputs", &SensitivityResult::outputs)
+        .def_readonly("confidence", &SensitivityResult::confidence)
+        .def_readonly("moments", &SensitivityResult::moments)
+        .def("first_order", &SensitivityResult::first_order, py::arg("output"), py::arg("input"),
+             "Fraction of the variance of `output` due to `input` alone.")
+        .def("total", &SensitivityResult::total, py::arg("output"), py::arg("input"),
+             "Fraction of the variance of `output` due to `input`, alone or with others.");
+
+    py::class_<SensitivityAnalysis>(m, "SensitivityAnalysis", "First-order and total Sobol indices (Saltelli/Jansen) with bootstrap intervals.")
+        .def(py::init<std::vector<Distribution>, std::uint64_t>(), py::arg("inputs"), py::arg("seed") = 0)
+        .def(py::init<std::vector<Distribution>, Sampler>(), py::arg("inputs"), py::arg("sampler"))
+        .def("run", [](const SensitivityAnalysis& self, const py::function& model, const size_t outputs, const std::uint64_t samples,
+                       const size_t resamples, const double confidence, const size_t block) {
+                const MonteCarlo::Model wrapped = python_model(model, self.dimension(), outputs);
+                py::gil_scoped_release release;
+                return self.run(wrapped, outputs, samples, resamples, confidence, block);
+            },
+            py::arg("model"), py::arg("outputs"), py::arg("samples"), py::arg("resamples") = 200, py::arg("confidence") = 0.95,
+            py::arg("block") = 1024,
+            "Evaluates `model(first_evaluation, inputs)` on the A, B and A_B rows of `samples` base samples, "
+            "samples * (dimension + 2) rows in all; `inputs` is (count, dimension) and the model returns (count, outputs) values.")
+        .def_property_readonly("dimension", &SensitivityAnalysis::dimension);
+
+    py::class_<TableSampler>(m, "TableSampler", "Random realisations of a table within its rows' uncertainties, one per sample.")
+        .def(py::init<const logngine::thermo::RectilinearTable&, std::uint64_t>(), py::arg("table"), py::arg("seed"), py::keep_alive<1, 2>())
+        .def("interpolate", &TableSampler::interpolate, py::arg("sample"), py::arg("pressure"), py::arg("temperature"),
+             "State at (pressure [Pa], temperature [K]) in the realisation of the table for `sample`, or None outside it.")
+        .def("interpolate_batch", [](const TableSampler& self, const py::array_t<std::uint64_t, py::array::c_style | py::array::forcecast>& samples,
+                                     const Doubles& pressures, const Doubles& temperatures) {
+                if (samples.size() != pressures.size() || samples.size() != temperatures.size())
+                    throw py::value_error("samples, pressures and temperatures must have the same length...");
+                const size_t n = static_cast<size_t>(samples.size());
+                Doubles out({n, size_t{6}});
+                double* row = out.mutable_data();
+                for (size_t i = 0; i < n; ++i, row += 6)
+                {
+                    const auto state = self.interpolate(samples.data()[i], pressures.data()[i], temperatures.data()[i]);
+                    if (!state) std::fill(row, row + 6, std::numeric_limits<double>::quiet_NaN());
+                    else std::copy_n(std::array{state->pressure, state->temperature, state->specific_volume, state->specific_internal_energy,
+                                                state->specific_enthalpy, state->specific_entropy}.begin(), 6, row);
+                }
+                return out;
+            },
+            py::arg("samples"), py::arg("pressures"), py::arg("temperatures"),
+            "`interpolate` elementwise, as (n, 6) rows of ThermoState fields; NaN rows outside the table.");
+}
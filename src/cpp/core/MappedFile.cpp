@@ -0,0 +1,98 @@
+#include <logngine/core/MappedFile.h>
+
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace logngine::core
+{
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::filesystem::path& path)
+    {
+        const auto fail = [&path](const char* what)
+        {
+            throw std::runtime_error(std::string(what) + " '" + path.string() + "' (error " + std::to_string(GetLastError()) + ")...");
+        };
+
+        this->file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (this->file == INVALID_HANDLE_VALUE)
+        {
+            this->file = nullptr;
+            fail("Could not open");
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(this->file, &size))
+        {
+            CloseHandle(this->file);
+            fail("Could not stat");
+        }
+        this->size = static_cast<size_t>(size.QuadPart);
+        if (this->size == 0) return;  // empty files cannot be mapped
+
+        this->mapping = CreateFileMappingW(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = this->mapping ? MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            if (this->mapping) CloseHandle(this->mapping);
+            CloseHandle(this->file);
+            fail("Could not map");
+        }
+        this->data = static_cast<const std::byte*>(view);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (this->data) UnmapViewOfFile(this->data);
+        if (this->mapping) CloseHandle(this->mapping);
+        if (this->file) CloseHandle(this->file);
+    }
+#else
+    MappedFile::MappedFile(const std::filesystem::path& path)
+    {
+        const auto fail = [&path](const char* what)
+        {
+            throw std::runtime_error(std::string(what) + " '" + path.string() + "' (errno " + std::to_string(errno) + ")...");
+        };
+
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) fail("Could not open");
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            fail("Could not stat");
+        }
+        this->size = static_cast<size_t>(info.st_size);
+        if (this->size == 0)  // empty files cannot be mapped
+        {
+            ::close(fd);
+            return;
+        }
+
+        void* view = ::mmap(nullptr, this->size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // the mapping keeps its own reference to the file
+        if (view == MAP_FAILED) fail("Could not map");
+        this->data = static_cast<const std::byte*>(view);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (this->data) ::munmap(const_cast<std::byte*>(this->data), this->size);
+    }
+#endif
+} // namespace logngine::core
@@ -0,0 +1,46 @@
+#include <logngine/core/SIMD.h>
+
+#if LOGNGINE_X86 && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace logngine::core
+{
+    static SIMDLevel detect_simd_level()
+    {
+#if LOGNGINE_X86 && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SIMDLevel::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SIMDLevel::AVX2;
+#elif LOGNGINE_X86 && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+        if (max_leaf < 7) return SIMDLevel::Scalar;
+
+        __cpuid(info, 1);
+        const bool fma = info[2] & (1 << 12);
+        const bool osxsave = info[2] & (1 << 27);
+        if (!osxsave) return SIMDLevel::Scalar;
+
+        // The OS must also save the wider registers on context switches
+        const unsigned long long xcr0 = _xgetbv(0);
+        const bool ymm_enabled = (xcr0 & 0x06) == 0x06;
+        const bool zmm_enabled = (xcr0 & 0xE6) == 0xE6;
+
+        __cpuidex(info, 7, 0);
+        const bool avx2 = info[1] & (1 << 5);
+        const bool avx512f = info[1] & (1 << 16);
+
+        if (avx512f && zmm_enabled) return SIMDLevel::AVX512;
+        if (avx2 && fma && ymm_enabled) return SIMDLevel::AVX2;
+#endif
+        return SIMDLevel::Scalar;
+    }
+
+    SIMDLevel simd_level()
+    {
+        static const SIMDLevel level = detect_simd_level();
+        return level;
+    }
+}
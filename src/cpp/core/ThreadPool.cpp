@@ -0,0 +1,142 @@
+#include <logngine/core/ThreadPool.h>
+#include <algorithm>
+#include <utility>
+
+namespace logngine::core
+{
+    // Set on threads running a pool's chunks (workers, and callers while they take part), so nested `parallel_for`
+    // calls run inline instead of deadlocking on `job_mutex`.
+    static thread_local bool inside_worker = false;
+
+    namespace
+    {
+        std::atomic<ThreadPool*> adopted = nullptr;
+
+        // Marks this thread as running chunks for as long as it lives, then puts the previous mark back.
+        struct WorkerScope
+        {
+            const bool outer = std::exchange(inside_worker, true);
+            ~WorkerScope() { inside_worker = this->outer; }
+        };
+    }
+
+    ThreadPool::ThreadPool(const size_t n_workers)
+    {
+        // The caller always participates, so one fewer background thread saturates the hardware
+        const size_t n_background = n_workers > 1 ? n_workers - 1 : 0;
+        this->workers.reserve(n_background);
+        for (size_t i = 0; i < n_background; ++i)
+            this->workers.emplace_back(&ThreadPool::work_loop, this, i + 1);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(this->state_mutex);
+            this->stopping = true;
+        }
+        this->wake.notify_all();
+        for (auto& worker : this->workers) worker.join();
+    }
+
+    ThreadPool& ThreadPool::shared()
+    {
+        if (ThreadPool* pool = adopted.load(std::memory_order_acquire)) return *pool;
+        static ThreadPool pool;
+        return pool;
+    }
+
+    void ThreadPool::adopt_shared(ThreadPool& pool)
+    {
+        adopted.store(&pool, std::memory_order_release);
+    }
+
+    bool ThreadPool::runs_chunks_here() const
+    {
+        const auto self = std::this_thread::get_id();
+        if (this->caller.load() == self) return true;
+        return std::any_of(this->workers.begin(), this->workers.end(), [&](const std::thread& worker) { return worker.get_id() == self; });
+    }
+
+    void ThreadPool::parallel_for(const size_t count, size_t grain, const Task& task)
+    {
+        if (count == 0) return;
+        grain = std::max<size_t>(grain, 1);
+
+        // Case 1: Not worth (or not safe) to fan out
+        if (this->workers.empty() || inside_worker || count <= grain || this->runs_chunks_here())
+        {
+            for (size_t begin = 0; begin < count; begin += grain)
+                task(begin, std::min(begin + grain, count), 0);
+            return;
+        }
+
+        // Case 2: Publish the job, work on it from this thread too, then wait for every worker to check back in
+        std::lock_guard job(this->job_mutex);
+        {
+            std::lock_guard lock(this->state_mutex);
+            this->task = &task;
+            this->count = count;
+            this->grain = grain;
+            this->next = 0;
+            this->active = this->workers.size();
+            this->error = nullptr;
+            ++this->generation;
+        }
+        this->wake.notify_all();
+
+        // This thread is worker 0 while it runs chunks, so a `parallel_for` nested in one runs inline as well
+        this->caller = std::this_thread::get_id();
+        {
+            WorkerScope scope;
+            run_chunks(0);
+        }
+        this->caller = std::thread::id{};
+
+        std::unique_lock lock(this->state_mutex);
+        this->done.wait(lock, [this] { return this->active == 0; });
+        this->task = nullptr;
+        if (this->error) std::rethrow_exception(this->error);
+    }
+
+    void ThreadPool::work_loop(const size_t worker)
+    {
+        inside_worker = true;
+
+        size_t seen = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(this->state_mutex);
+                this->wake.wait(lock, [&] { return this->stopping || this->generation != seen; });
+                if (this->stopping) return;
+                seen = this->generation;
+            }
+
+            run_chunks(worker);
+
+            std::lock_guard lock(this->state_mutex);
+            if (--this->active == 0) this->done.notify_all();
+        }
+    }
+
+    void ThreadPool::run_chunks(const size_t worker)
+    {
+        while (true)
+        {
+            const size_t begin = this->next.fetch_add(this->grain);
+            if (begin >= this->count) return;
+
+            try
+            {
+                (*this->task)(begin, std::min(begin + this->grain, this->count), worker);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(this->state_mutex);
+                if (!this->error) this->error = std::current_exception();
+                this->next = this->count;  // abandon remaining chunks
+            }
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace logngine::core
+{
+    // ==========================================================
+    //  Mapped File
+    // ==========================================================
+#pragma region MappedFile
+
+    // Read-only memory mapping of a whole file. Pages are loaded on first touch and shared with every other process
+    // mapping the same file.
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::filesystem::path& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        [[nodiscard]] std::span<const std::byte> bytes() const { return {this->data, this->size}; }
+
+    private:
+        const std::byte* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        void* file = nullptr;
+        void* mapping = nullptr;
+#endif
+    };
+
+#pragma endregion
+} // namespace logngine::core
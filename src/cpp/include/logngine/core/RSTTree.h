@@ -11,6 +11,11 @@
 #include <functional>
 #include <stdexcept>
 #include <algorithm>
+#include <span>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+#include <filesystem>
 
 namespace logngine::core
 {
@@ -53,9 +58,6 @@ namespace logngine::core
     template <size_t D>
     using MBR = MinimumBoundingRegion<D>;
 
-    template <typename T>
-    using MaxHeap = std::priority_queue<std::pair<double, T>>;
-
 #pragma endregion
 
 
@@ -73,6 +75,8 @@ namespace logngine::core
 
     template <typename STORED_DATA_TYPE, size_t D_REGION, size_t N_CHILD, size_t N_KEYS = N_CHILD>
     class RSTTree;
+    template <typename STORED_DATA_TYPE, size_t D_REGION, size_t N_CHILD, size_t N_KEYS = N_CHILD>
+    class RSTFrozenTree;
 
 #pragma endregion
 
@@ -81,37 +85,26 @@ namespace logngine::core
     // ==========================================================
 #pragma region Node Utilities
 
-    template <size_t D, typename S>
-    struct SplitEntry
+    // Predicate for unfiltered queries; searches recognise it and skip the per-entry check (and value access) entirely.
+    struct RSTAcceptAll
     {
-        MBR<D> region;
-        S value;
+        template <typename S>
+        constexpr bool operator()(const S&) const { return true; }
     };
 
-    struct SplitTracker
+    // Best-first search item: either a subtree still to be expanded (`node`) or a candidate entry (`value`).
+    template <size_t D, size_t N, size_t L, typename S>
+    struct RSTQueueEntry
     {
-        size_t axis = 0;
-        size_t location = 0;
-        double overlap = inf;
-        double margin = inf;
-        double area = inf;
-
-        void update(size_t axis, size_t location, double overlap, double margin, double area);
-    };
+        double distance = inf;
+        const RSTNode<D, N, L, S>* node = nullptr;
+        const S* value = nullptr;
 
-    struct InsertionAreaTracker
-    {
-        size_t location = 0;
-        double best_enlargement = inf;
-        double best_area = inf;
+        bool operator>(const RSTQueueEntry& other) const { return this->distance > other.distance; }
     };
 
     template <size_t D, size_t N, size_t L, typename S>
-    struct SplitResult
-    {
-        MBR<D> new_region;
-        std::unique_ptr<RSTNode<D, N, L, S>> sibling;
-    };
+    using RSTQueue = std::priority_queue<RSTQueueEntry<D, N, L, S>, std::vector<RSTQueueEntry<D, N, L, S>>, std::greater<>>;
 
 #pragma endregion
 
@@ -132,8 +125,7 @@ namespace logngine::core
         [[nodiscard]] bool is_full(const RSTNode<D, N, L, S>& node);
 
         template <size_t D, size_t N, size_t L, typename S>
-        [[nodiscard]] std::optional<SplitResult<D, N, L, S>>
-        insert(RSTNode<D, N, L, S>& node, const std::array<double, D>& key, const S& value);
+        [[nodiscard]] const MBR<D>& get_region(const RSTNode<D, N, L, S>& node);
     }
 
 #pragma endregion
@@ -146,7 +138,7 @@ namespace logngine::core
     template <size_t D, size_t N, size_t L, typename S>
     struct RSTLeafNode
     {
-        static constexpr size_t MIN_SPLIT_COUNT = ceval_max(static_cast<size_t>(RSTTree<S, D, N, L>::MIN_SPLIT * N),
+        static constexpr size_t MIN_SPLIT_COUNT = ceval_max(static_cast<size_t>(RSTTree<S, D, N, L>::MIN_SPLIT * L),
                                                             static_cast<size_t>(1));
 
         size_t size = 0;
@@ -154,39 +146,10 @@ namespace logngine::core
         std::array<std::optional<MBR<D>>, L> subregions{};
         std::array<std::optional<S>, L> children{};
 
-        RSTLeafNode(const size_t size,
-                    const MBR<D>& region,
-                    std::array<std::optional<MBR<D>>, L + 1> subregions,
-                    std::array<std::optional<S>, L + 1> children)
-            : size(size), region(region), subregions(std::move(subregions)), children(std::move(children))
-        {
-        }
-
         // Querying
-        void query(const std::array<double, D>& key, size_t k, MaxHeap<S>& result, const std::function<bool(const S&)>& filter, const std::array<double, D>& scale) const;
-        std::optional<SplitResult<D, N, L, S>> insert(const std::array<double, D>& key, const S& value);
+        template <typename Predicate>
+        void enqueue(const std::array<double, D>& key, RSTQueue<D, N, L, S>& queue, const Predicate& accept, const std::array<double, D>& scale) const;
         [[nodiscard]] bool is_full() const { return this->size == L; }
-
-    private:
-
-        // Helper functions
-        static std::array<SplitEntry<D, S>, N + 1> pack_entries(
-            const std::array<std::optional<MBR<D>>, N>& subregions,
-            const std::array<std::optional<S>, N>& children,
-            const std::array<double, D>& key,
-            const S& value);
-
-        static SplitTracker find_best_split(std::array<SplitEntry<D, S>, N + 1>& entries);
-
-        static void partition_entries(
-            const std::array<SplitEntry<D, S>, L + 1>& sorted_entries,
-            size_t split_index,
-            MBR<D>& lower,
-            MBR<D>& upper,
-            std::array<std::optional<MBR<D>>, L + 1>& lower_subregions,
-            std::array<std::optional<S>, L + 1>& lower_children,
-            std::array<std::optional<MBR<D>>, L + 1>& upper_subregions,
-            std::array<std::optional<S>, L + 1>& upper_children);
     };
 
 #pragma endregion
@@ -208,28 +171,9 @@ namespace logngine::core
         std::array<std::unique_ptr<RSTNode<D, N, L, S>>, N> children{};
 
         // Querying
-        void query(const std::array<double, D>& key, size_t k, MaxHeap<S>& result, const std::function<bool(const S&)>& filter, const std::array<double, D>& scale) const;
-        std::optional<SplitResult<D, N, L, S>> insert(const std::array<double, D>& key, const S& value);
+        template <typename Predicate>
+        void enqueue(const std::array<double, D>& key, RSTQueue<D, N, L, S>& queue, const Predicate& accept, const std::array<double, D>& scale) const;
         [[nodiscard]] bool is_full() const { return this->size == N; }
-
-    private:
-        // Helper function
-        static std::array<SplitEntry<D, std::shared_ptr<RSTNode<D, N, L, S>>>, N + 1>
-        pack_entries(const std::array<std::optional<MBR<D>>, N>& subregions,
-                     const std::array<std::shared_ptr<RSTNode<D, N, L, S>>, N>& children,
-                     const MBR<D>& new_mbr,
-                     std::shared_ptr<RSTNode<D, N, L, S>> new_child);
-
-        void partition_entries(
-            const std::array<SplitEntry<D, std::shared_ptr<RSTNode<D, N, L, S>>>, L + 1>& sorted_entries,
-            size_t split_index,
-            MBR<D>& lower, MBR<D>& upper,
-            std::array<std::optional<MBR<D>>, L + 1>& lower_subregions,
-            std::array<std::shared_ptr<RSTNode<D, N, L, S>>, L + 1>& lower_children,
-            std::array<std::optional<MBR<D>>, L + 1>& upper_subregions,
-            std::array<std::shared_ptr<RSTNode<D, N, L, S>>, L + 1>& upper_children);
-
-        size_t find_best_child_insertion(const MBR<D>& key_mbr);
     };
 
 #pragma endregion
@@ -239,19 +183,244 @@ namespace logngine::core
     // ==========================================================
 #pragma region RSTTree
 
+    // What `RSTTree::shape` found on a walk over the whole tree. Fills count the entries of nodes other than the root;
+    // depths count levels below the root.
+    struct RSTTreeShape
+    {
+        size_t entries = 0;
+        size_t min_leaf_depth = std::numeric_limits<size_t>::max();
+        size_t max_leaf_depth = 0;
+        size_t min_leaf_fill = std::numeric_limits<size_t>::max();
+        size_t max_leaf_fill = 0;
+        size_t min_internal_fill = std::numeric_limits<size_t>::max();
+        size_t max_internal_fill = 0;
+        bool tight = true;  // every node's region, and the copy its parent keeps, bounds its entries exactly
+    };
+
     template <typename STORED_DATA_TYPE, size_t D_REGION, size_t N_CHILD, size_t N_KEYS>
     class RSTTree
     {
     public:
-        static constexpr double MIN_SPLIT = 0.25;
-
+        // Least fill of a node other than the root, as a share of its capacity (40%, as Beckmann et al. recommend)
+        static constexpr double MIN_SPLIT = 0.4;
+        // Share of an overflowing node's entries that the first overflow on a level during an insertion reinserts
+        static constexpr double REINSERT_FRACTION = 0.3;
+
+        // Packs every entry at once with Sort-Tile-Recursive ordering; far cheaper than repeated `insert`.
+        static RSTTree bulk_load(std::span<const std::pair<std::array<double, D_REGION>, STORED_DATA_TYPE>> entries);
+
+        // R*-tree insertion (Beckmann et al., 1990): the subtree is chosen by least overlap enlargement just above
+        // the leaves and least area enlargement above that, and the first overflow on each level reinserts the
+        // entries farthest from the node's center before any split, so the tree keeps its shape under incremental
+        // edits in any order.
         void insert(const std::array<double, D_REGION>& key, const STORED_DATA_TYPE& value);
+        // Removes every entry stored at exactly `key` whose value `accept(const STORED_DATA_TYPE&) -> bool` takes
+        // (all of them by default), and returns how many. Nodes left below the minimum fill are dissolved and their
+        // entries reinserted.
+        template <typename Predicate = RSTAcceptAll>
+        size_t erase(const std::array<double, D_REGION>& key, Predicate&& accept = {});
+        // Moves the first entry at exactly `key` that `accept` takes to `new_key`, with `value`, and returns whether
+        // there was one. An entry that stays within its leaf's region is changed in place; otherwise it is erased and
+        // inserted again.
+        template <typename Predicate>
+        bool update(const std::array<double, D_REGION>& key, Predicate&& accept, const std::array<double, D_REGION>& new_key, const STORED_DATA_TYPE& value);
+
+        [[nodiscard]] RSTFrozenTree<STORED_DATA_TYPE, D_REGION, N_CHILD, N_KEYS> freeze() const;
+        // Maps a file written by `RSTFrozenTree::save` (or `DatasetBaker --emit-binary`) read-only and queries it in
+        // place; the mapping stays open as long as the returned tree or any copy of it.
+        static RSTFrozenTree<STORED_DATA_TYPE, D_REGION, N_CHILD, N_KEYS> open_mmap(const std::filesystem::path& path);
+        std::vector<STORED_DATA_TYPE> query(const std::array<double, D_REGION>& key, size_t max, const std::array<double, D_REGION>& scale) const;
+        std::vector<STORED_DATA_TYPE> query_with_filter(const std::array<double, D_REGION>& key, size_t max, const std::function<bool(const STORED_DATA_TYPE&)>& filter, const std::array<double, D_REGION>& scale) const;
+
+        // Like `query_with_filter`, but `accept(const STORED_DATA_TYPE&) -> bool` is called directly and can be inlined.
+        template <typename Predicate>
+        std::vector<STORED_DATA_TYPE> query_if(const std::array<double, D_REGION>& key, size_t max, Predicate&& accept, const std::array<double, D_REGION>& scale) const;
+
+        [[nodiscard]] size_t size() const { return this->count; }
+        [[nodiscard]] bool empty() const { return this->count == 0; }
+        // Levels above the leaves; 0 for a lone leaf (or an empty tree).
+        [[nodiscard]] size_t height() const { return this->levels; }
+        // Walks every node to report the invariants the edits above maintain; for tests and debugging.
+        [[nodiscard]] RSTTreeShape shape() const;
+
+    private:
+        using Node = RSTNode<D_REGION, N_CHILD, N_KEYS, STORED_DATA_TYPE>;
+        using Leaf = RSTLeafNode<D_REGION, N_CHILD, N_KEYS, STORED_DATA_TYPE>;
+        using Internal = RSTInternalNode<D_REGION, N_CHILD, N_KEYS, STORED_DATA_TYPE>;
+
+        // An entry on its way into the node of level `level` (0 for a leaf) that will hold it.
+        struct Pending
+        {
+            MBR<D_REGION> region;
+            std::optional<STORED_DATA_TYPE> value;  // level 0
+            std::unique_ptr<Node> subtree;          // above
+            size_t level = 0;
+        };
+
+        // Nodes from the root down, and the slot each one has in its parent (`slots[0]` is unused).
+        struct Path
+        {
+            std::vector<Node*> nodes;
+            std::vector<size_t> slots;
+        };
+
+        // R* insertion of `entry`; `reinserted` marks the levels whose first overflow has already reinserted.
+        void place(Pending entry, std::vector<bool>& reinserted);
+        // `entry` goes into the full node `path.nodes[depth]`: reinserts part of it, or splits it.
+        void overflow(Path& path, size_t depth, Pending entry, std::vector<bool>& reinserted);
+        // Recomputes the region of `path.nodes[depth]` and of every node above it.
+        void refresh(const Path& path, size_t depth);
+        // Path to the leaf holding the first entry at exactly `key` that `accept` takes, and that entry's slot.
+        template <typename Predicate>
+        std::optional<std::pair<Path, size_t>> find(const std::array<double, D_REGION>& key, const Predicate& accept) const;
+        // Removes slot `slot` of the leaf at the end of `path`, dissolves the nodes that leaves under the minimum fill
+        // and reinserts their entries at their own level, and shrinks the root while it has one child.
+        void remove(Path& path, size_t slot);
+
+        std::unique_ptr<Node> root = nullptr;
+        size_t count = 0;
+        size_t levels = 0;
+    };
+
+#pragma endregion
+
+    // ==========================================================
+    //  Frozen R*-Tree
+    // ==========================================================
+#pragma region Frozen RSTTree
+
+    // Read-only node of a frozen tree; bounds are stored structure-of-arrays (`min[d][i]`) so one dimension of every
+    // child is contiguous. Unused slots hold +inf bounds. `children` index `nodes` (internal) or `values` (leaf).
+    template <size_t D, size_t W>
+    struct alignas(64) RSTFlatNode
+    {
+        std::array<std::array<double, W>, D> min;
+        std::array<std::array<double, W>, D> max;
+        std::array<std::uint32_t, W> children;
+        std::uint32_t size = 0;
+        bool is_leaf = false;
+    };
+
+    // Leads the binary frozen-tree format (little-endian, see `RSTFrozenTree::save`). The node and value records are
+    // raw `RSTFlatNode`/value bytes at 64-byte aligned offsets, so files only move between builds that agree on those
+    // layouts; `node_size`/`value_size` catch the mismatches that matter.
+    struct RSTBinaryHeader
+    {
+        static constexpr std::array<char, 8> MAGIC{'L', 'G', 'N', 'R', 'S', 'T', '\0', '\0'};
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr size_t ALIGNMENT = 64;
+
+        std::array<char, 8> magic = MAGIC;
+        std::uint32_t version = VERSION;
+        std::uint32_t dimensions = 0;
+        std::uint32_t width = 0;
+        std::uint32_t node_size = 0;
+        std::uint32_t value_size = 0;
+        std::uint32_t reserved = 0;
+        std::uint64_t node_count = 0;
+        std::uint64_t value_count = 0;
+        std::uint64_t node_offset = 0;
+        std::uint64_t value_offset = 0;
+    };
+    static_assert(sizeof(RSTBinaryHeader) == 64);
+
+    struct RSTFlatQueueEntry
+    {
+        double distance = inf;
+        std::uint32_t index = 0;  // node index, or value index if `is_value`
+        std::uint32_t leaf = 0;   // leaf a value was found in
+        bool is_value = false;
+
+        bool operator>(const RSTFlatQueueEntry& other) const { return this->distance > other.distance; }
+    };
+
+    // Immutable, query-only counterpart of `RSTTree` (see `RSTTree::freeze`): every node lives in one contiguous
+    // buffer in breadth-first order with the root at index 0, and every stored value in a second one. The buffers are
+    // either owned (shared between copies), mapped from a file (`RSTTree::open_mmap`), or viewed, e.g. static arrays
+    // emitted by DatasetBaker, in which case the tree is constant-initialized and costs nothing at startup.
+    template <typename STORED_DATA_TYPE, size_t D_REGION, size_t N_CHILD, size_t N_KEYS>
+    class RSTFrozenTree
+    {
+    public:
+        static constexpr size_t WIDTH = ceval_max(N_CHILD, N_KEYS);
+        using Node = RSTFlatNode<D_REGION, WIDTH>;
+
+        constexpr RSTFrozenTree() = default;
+        // Views `nodes` and `values`, which must outlive the tree and already be laid out as described above.
+        constexpr RSTFrozenTree(std::span<const Node> nodes, std::span<const STORED_DATA_TYPE> values)
+            : nodes(nodes), values(values) {}
+
+        // Reusable search buffers. Once they have grown to fit a query, the span overloads below allocate nothing.
+        // Consecutive queries through the same scratch also start from the leaves that answered the previous one,
+        // which pays off when they are close together (e.g. successive solver iterations). Not thread-safe; use one
+        // per thread.
+        class QueryScratch
+        {
+            friend class RSTFrozenTree;
+
+            // The tree the seeds came from. Its address alone could be reused by another tree, so its node buffer
+            // is checked too
+            const RSTFrozenTree* owner = nullptr;
+            const Node* owner_nodes = nullptr;
+            size_t owner_node_count = 0;
+            std::vector<RSTFlatQueueEntry> queue;  // binary min-heap
+            std::vector<double> nearest;           // binary max-heap of the best accepted distances
+            std::vector<std::uint32_t> seeds;      // leaves expanded before the root
+            std::vector<std::uint32_t> indices;    // result value indices
+            std::vector<std::uint32_t> leaves;     // leaf of each result
+        };
+
         std::vector<STORED_DATA_TYPE> query(const std::array<double, D_REGION>& key, size_t max, const std::array<double, D_REGION>& scale) const;
         std::vector<STORED_DATA_TYPE> query_with_filter(const std::array<double, D_REGION>& key, size_t max, const std::function<bool(const STORED_DATA_TYPE&)>& filter, const std::array<double, D_REGION>& scale) const;
 
+        // Answers every key at once: row `q` of the returned (keys.size() x max) buffer holds the nearest values of
+        // `keys[q]` in order, padded with nullptr. Queries are visited in Hilbert order and split over the shared
+        // thread pool; each one seeds its pruning bound with the leaves that answered its predecessor.
+        std::vector<const STORED_DATA_TYPE*> query_batch(std::span<const std::array<double, D_REGION>> keys, size_t max, const std::array<double, D_REGION>& scale) const;
+
+        // Allocation-free variants: write the `out.size()` nearest values (as indices for `value()`, or as pointers
+        // into this tree) nearest-first, and return how many were found.
+        size_t query(const std::array<double, D_REGION>& key, std::span<std::uint32_t> out, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+        size_t query(const std::array<double, D_REGION>& key, std::span<const STORED_DATA_TYPE*> out, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+        size_t query_with_filter(const std::array<double, D_REGION>& key, std::span<std::uint32_t> out, const std::function<bool(const STORED_DATA_TYPE&)>& filter, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+        size_t query_with_filter(const std::array<double, D_REGION>& key, std::span<const STORED_DATA_TYPE*> out, const std::function<bool(const STORED_DATA_TYPE&)>& filter, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+
+        // Compile-time predicate variants of the above; `accept(const STORED_DATA_TYPE&) -> bool` can be inlined.
+        template <typename Predicate>
+        std::vector<STORED_DATA_TYPE> query_if(const std::array<double, D_REGION>& key, size_t max, Predicate&& accept, const std::array<double, D_REGION>& scale) const;
+        template <typename Predicate>
+        size_t query_if(const std::array<double, D_REGION>& key, std::span<std::uint32_t> out, Predicate&& accept, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+        template <typename Predicate>
+        size_t query_if(const std::array<double, D_REGION>& key, std::span<const STORED_DATA_TYPE*> out, Predicate&& accept, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+
+        // Writes the tree in the format `RSTTree::open_mmap` reads.
+        void save(const std::filesystem::path& path) const;
+
+        [[nodiscard]] const STORED_DATA_TYPE& value(const std::uint32_t index) const { return this->values[index]; }
+        [[nodiscard]] std::span<const STORED_DATA_TYPE> entries() const { return this->values; }  // in leaf order
+        [[nodiscard]] size_t size() const { return this->values.size(); }
+        [[nodiscard]] bool empty() const { return this->values.empty(); }
+
     private:
-        std::unique_ptr<RSTNode<D_REGION, N_CHILD, N_KEYS, STORED_DATA_TYPE>> root = nullptr;
+        friend class RSTTree<STORED_DATA_TYPE, D_REGION, N_CHILD, N_KEYS>;
+
+        // Best-first k-NN core; fills `scratch.indices`/`scratch.leaves`, remembers the leaves as seeds for the next
+        // search, and returns how many results were found.
+        template <typename Predicate>
+        size_t search(const std::array<double, D_REGION>& key, size_t max, const Predicate& accept, const std::array<double, D_REGION>& scale, QueryScratch& scratch) const;
+
+        struct Storage
+        {
+            std::vector<Node> nodes;
+            std::vector<STORED_DATA_TYPE> values;
+        };
+
+        std::shared_ptr<const void> storage;  // owned buffers or file mapping; null when viewing external memory
+        std::span<const Node> nodes;
+        std::span<const STORED_DATA_TYPE> values;
     };
 
 #pragma endregion
 } // namespace logngine::core
+
+#include <logngine/core/RSTTree.tpp>
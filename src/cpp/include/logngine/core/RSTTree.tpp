@@ -0,0 +1,1373 @@
+#pragma once
+
+// Definitions of the templates declared in RSTTree.h, which includes this file last; kept apart so the header stays a
+// readable interface. Not meant to be included on its own.
+
+#include <logngine/core/RSTTree.h>
+#include <logngine/core/SIMD.h>
+#include <logngine/core/ThreadPool.h>
+#include <logngine/core/MappedFile.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace logngine::core
+{
+    // ==========================================================
+    //  R*-Tree (w/ traversal) implementation
+    // ==========================================================
+
+    // ----------------------------------------------------------
+    //  R*-Tree Bounding Regions
+    // ----------------------------------------------------------
+#pragma region MBR
+
+    template <size_t D>
+    MinimumBoundingRegion<D>::MinimumBoundingRegion()
+    {
+        this->max.fill(-inf);
+        this->min.fill(inf);
+    }
+
+    template <size_t D>
+    double MinimumBoundingRegion<D>::area() const
+    {
+        double result = 1.0;
+        for (size_t i = 0; i < D; ++i) result *= (this->max[i] - this->min[i]);
+        return result;
+    }
+
+    template <size_t D>
+    bool MinimumBoundingRegion<D>::contains(const std::array<double, D>& point) const
+    {
+        for (size_t i = 0; i < D; ++i)
+            if (point[i] < this->min[i] || point[i] > this->max[i]) return false;
+        return true;
+    }
+
+    template <size_t D>
+    bool MinimumBoundingRegion<D>::overlaps(const MinimumBoundingRegion& other) const
+    {
+        // Separating axis theorem
+        for (size_t i = 0; i < D; ++i)
+            if (this->max[i] < other.min[i] || this->min[i] > other.max[i]) return false;
+        return true;
+    }
+
+    template <size_t D>
+    void MinimumBoundingRegion<D>::expand(const MinimumBoundingRegion& region)
+    {
+        for (size_t i = 0; i < D; ++i)
+        {
+            if (region.min[i] < this->min[i]) this->min[i] = region.min[i];
+            if (region.max[i] > this->max[i]) this->max[i] = region.max[i];
+        }
+    }
+
+    template <size_t D>
+    void MinimumBoundingRegion<D>::expand(const std::array<double, D>& point)
+    {
+        for (size_t i = 0; i < D; ++i)
+        {
+            if (point[i] < this->min[i]) this->min[i] = point[i];
+            if (point[i] > this->max[i]) this->max[i] = point[i];
+        }
+    }
+
+#pragma endregion
+
+#pragma region MBR Helper Functions
+
+
+    template <size_t D>
+    double point_to_box_distance_scaled(const std::array<double, D>& point,
+                                        const MBR<D>& box,
+                                        const std::array<double, D>& scale)
+    {
+        double dist_sq = 0.0;
+        for (size_t i = 0; i < D; ++i)
+        {
+            if (point[i] == inf || point[i] == -inf || std::isnan(point[i])) continue;
+
+            const double delta = std::max(box.min[i] - point[i], 0.0) + std::max(point[i] - box.max[i], 0.0);
+            dist_sq += scale[i] * delta * delta;
+        }
+        return dist_sq;
+    }
+
+    // Scaled distance from `point` to every slot of a frozen node at once; lanes past `node.size` are meaningless.
+    // Non-finite query coordinates are treated as wildcards and contribute nothing, as in the single-box version.
+    template <size_t D, size_t W>
+    void point_to_boxes_distance_scaled_scalar(const std::array<double, D>& point,
+                                               const RSTFlatNode<D, W>& node,
+                                               const std::array<double, D>& scale,
+                                               std::array<double, W>& distances,
+                                               const size_t first_lane = 0)
+    {
+        for (size_t i = first_lane; i < W; ++i) distances[i] = 0.0;
+        for (size_t d = 0; d < D; ++d)
+        {
+            if (!std::isfinite(point[d])) continue;
+
+            for (size_t i = first_lane; i < W; ++i)
+            {
+                const double delta = std::max(node.min[d][i] - point[d], 0.0) + std::max(point[d] - node.max[d][i], 0.0);
+                distances[i] += scale[d] * delta * delta;
+            }
+        }
+    }
+
+#if LOGNGINE_X86
+    template <size_t D, size_t W>
+    LOGNGINE_TARGET("avx2,fma")
+    void point_to_boxes_distance_scaled_avx2(const std::array<double, D>& point,
+                                             const RSTFlatNode<D, W>& node,
+                                             const std::array<double, D>& scale,
+                                             std::array<double, W>& distances)
+    {
+        constexpr size_t LANES = 4;
+        const __m256d zero = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + LANES <= W; i += LANES)
+        {
+            __m256d acc = zero;
+            for (size_t d = 0; d < D; ++d)
+            {
+                if (!std::isfinite(point[d])) continue;
+
+                const __m256d p = _mm256_set1_pd(point[d]);
+                const __m256d below = _mm256_max_pd(_mm256_sub_pd(_mm256_loadu_pd(&node.min[d][i]), p), zero);
+                const __m256d above = _mm256_max_pd(_mm256_sub_pd(p, _mm256_loadu_pd(&node.max[d][i])), zero);
+                const __m256d delta = _mm256_add_pd(below, above);
+                acc = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_set1_pd(scale[d]), delta), delta, acc);
+            }
+            _mm256_storeu_pd(&distances[i], acc);
+        }
+        if (i < W) point_to_boxes_distance_scaled_scalar(point, node, scale, distances, i);
+    }
+
+    template <size_t D, size_t W>
+    LOGNGINE_TARGET("avx512f")
+    void point_to_boxes_distance_scaled_avx512(const std::array<double, D>& point,
+                                               const RSTFlatNode<D, W>& node,
+                                               const std::array<double, D>& scale,
+                                               std::array<double, W>& distances)
+    {
+        constexpr size_t LANES = 8;
+        const __m512d zero = _mm512_set1_pd(0.0);
+
+        size_t i = 0;
+        for (; i + LANES <= W; i += LANES)
+        {
+            __m512d acc = zero;
+            for (size_t d = 0; d < D; ++d)
+            {
+                if (!std::isfinite(point[d])) continue;
+
+                const __m512d p = _mm512_set1_pd(point[d]);
+                const __m512d below = _mm512_max_pd(_mm512_sub_pd(_mm512_loadu_pd(&node.min[d][i]), p), zero);
+                const __m512d above = _mm512_max_pd(_mm512_sub_pd(p, _mm512_loadu_pd(&node.max[d][i])), zero);
+                const __m512d delta = _mm512_add_pd(below, above);
+                acc = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_set1_pd(scale[d]), delta), delta, acc);
+            }
+            _mm512_storeu_pd(&distances[i], acc);
+        }
+        if (i < W) point_to_boxes_distance_scaled_scalar(point, node, scale, distances, i);
+    }
+#endif
+
+    template <size_t D, size_t W>
+    void point_to_boxes_distance_scaled(const std::array<double, D>& point,
+                                        const RSTFlatNode<D, W>& node,
+                                        const std::array<double, D>& scale,
+                                        std::array<double, W>& distances)
+    {
+#if LOGNGINE_X86
+        switch (simd_level())
+        {
+        case SIMDLevel::AVX512:
+            return point_to_boxes_distance_scaled_avx512(point, node, scale, distances);
+        case SIMDLevel::AVX2:
+            return point_to_boxes_distance_scaled_avx2(point, node, scale, distances);
+        default:
+            break;
+        }
+#endif
+        point_to_boxes_distance_scaled_scalar(point, node, scale, distances);
+    }
+
+    template <size_t D>
+    double compute_overlap(const MBR<D>& A, const MBR<D>& B)
+    {
+        double volume = 1.0;
+        for (size_t i = 0; i < D; ++i)
+        {
+            const double overlap = std::min(A.max[i], B.max[i]) - std::max(A.min[i], B.min[i]);
+            if (overlap <= 0.0) return 0.0;
+            volume *= overlap;
+        }
+        return volume;
+    }
+
+    // Half the perimeter; R* prefers squarish regions, which have the least of it for their area.
+    template <size_t D>
+    double compute_margin(const MBR<D>& A)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < D; ++i) sum += A.max[i] - A.min[i];
+        return sum;
+    }
+
+    template <size_t D>
+    double center_distance(const MBR<D>& A, const MBR<D>& B)
+    {
+        double dist_sq = 0.0;
+        for (size_t i = 0; i < D; ++i)
+        {
+            const double delta = 0.5 * (A.min[i] + A.max[i] - B.min[i] - B.max[i]);
+            dist_sq += delta * delta;
+        }
+        return dist_sq;
+    }
+
+#pragma endregion
+
+#pragma region Bulk Loading Helper Functions
+
+    // Orders `[begin, end)` so that consecutive runs of `capacity` indices form STR tiles; `coordinate(i, axis)` gives
+    // the sort key of index `i` along `axis`. Slabs are always a multiple of `capacity`, so only the last tile is partial.
+    template <size_t D, typename Coordinate>
+    void sort_tile_recursive(const std::vector<size_t>::iterator begin,
+                             const std::vector<size_t>::iterator end,
+                             const size_t axis,
+                             const size_t capacity,
+                             const Coordinate& coordinate)
+    {
+        const auto count = static_cast<size_t>(end - begin);
+        if (count <= capacity) return;
+
+        std::sort(begin, end, [&](const size_t a, const size_t b)
+        {
+            return coordinate(a, axis) < coordinate(b, axis);
+        });
+        if (axis + 1 == D) return;
+
+        const size_t n_nodes = (count + capacity - 1) / capacity;
+        const auto n_slabs = static_cast<size_t>(std::ceil(std::pow(static_cast<double>(n_nodes),
+                                                                    1.0 / static_cast<double>(D - axis))));
+        const size_t slab_size = capacity * ((n_nodes + n_slabs - 1) / n_slabs);
+
+        for (auto slab = begin; slab != end;)
+        {
+            const auto slab_end = slab + static_cast<std::ptrdiff_t>(std::min(slab_size, static_cast<size_t>(end - slab)));
+            sort_tile_recursive<D>(slab, slab_end, axis + 1, capacity, coordinate);
+            slab = slab_end;
+        }
+    }
+
+    // Position of `point` along a Hilbert curve through `bounds` (Skilling, "Programming the Hilbert curve", 2004).
+    // Non-finite coordinates map to the middle of their axis.
+    template <size_t D>
+    std::uint64_t hilbert_index(const std::array<double, D>& point, const MBR<D>& bounds)
+    {
+        static_assert(D <= 64, "Hilbert keys are limited to 64 bits.");
+        constexpr size_t BITS = ceval_min(64 / D, 21);
+        constexpr std::uint32_t CELLS = (std::uint32_t{1} << BITS) - 1;
+
+        std::array<std::uint32_t, D> axes{};
+        for (size_t d = 0; d < D; ++d)
+        {
+            const double extent = bounds.max[d] - bounds.min[d];
+            double t = 0.5;
+            if (std::isfinite(point[d]) && extent > 0.0) t = std::clamp((point[d] - bounds.min[d]) / extent, 0.0, 1.0);
+            axes[d] = static_cast<std::uint32_t>(t * CELLS);
+        }
+
+        // Inverse undo
+        for (std::uint32_t q = std::uint32_t{1} << (BITS - 1); q > 1; q >>= 1)
+        {
+            const std::uint32_t p = q - 1;
+            for (size_t d = 0; d < D; ++d)
+            {
+                if (axes[d] & q)
+                {
+                    axes[0] ^= p;
+                    continue;
+                }
+                const std::uint32_t t = (axes[0] ^ axes[d]) & p;
+                axes[0] ^= t;
+                axes[d] ^= t;
+            }
+        }
+
+        // Gray encode
+        for (size_t d = 1; d < D; ++d) axes[d] ^= axes[d - 1];
+        std::uint32_t t = 0;
+        for (std::uint32_t q = std::uint32_t{1} << (BITS - 1); q > 1; q >>= 1)
+            if (axes[D - 1] & q) t ^= q - 1;
+        for (size_t d = 0; d < D; ++d) axes[d] ^= t;
+
+        // Interleave the transposed bits, most significant first
+        std::uint64_t index = 0;
+        for (size_t bit = BITS; bit-- > 0;)
+            for (size_t d = 0; d < D; ++d)
+                index = (index << 1) | ((axes[d] >> bit) & 1u);
+        return index;
+    }
+
+#pragma endregion
+
+#pragma region Node
+
+    namespace RSTNodeFN
+    {
+        template <size_t D, size_t N, size_t L, typename S>
+        bool is_leaf(const RSTNode<D, N, L, S>& node)
+        {
+            return std::holds_alternative<RSTLeafNode<D, N, L, S>>(node);
+        }
+
+        template <size_t D, size_t N, size_t L, typename S>
+        size_t get_size(const RSTNode<D, N, L, S>& node)
+        {
+            if (auto* internal = std::get_if<RSTInternalNode<D, N, L, S>>(&node)) return internal->size;
+            if (auto* leaf = std::get_if<RSTLeafNode<D, N, L, S>>(&node)) return leaf->size;
+            throw std::runtime_error("Did not receive an RSTNode in get_size...");
+        }
+
+        template <size_t D, size_t N, size_t L, typename S>
+        bool is_full(const RSTNode<D, N, L, S>& node)
+        {
+            if (auto* internal = std::get_if<RSTInternalNode<D, N, L, S>>(&node)) return internal->is_full();
+            if (auto* leaf = std::get_if<RSTLeafNode<D, N, L, S>>(&node)) return leaf->is_full();
+            throw std::runtime_error("Did not receive an RSTNode in get_size...");
+        }
+
+        template <size_t D, size_t N, size_t L, typename S>
+        const MBR<D>& get_region(const RSTNode<D, N, L, S>& node)
+        {
+            return std::visit([](const auto& n) -> const MBR<D>& { return n.region; }, node);
+        }
+    }
+
+#pragma endregion
+
+    // ----------------------------------------------------------
+    //  R*-Tree Node Entry Helper Functions
+    // ----------------------------------------------------------
+
+#pragma region Insertion Helper Functions
+
+    // Appends `entry` to `node`, which must have room: its value if `node` is a leaf, its subtree otherwise.
+    template <size_t D, size_t N, size_t L, typename S, typename Entry>
+    void push_entry(RSTNode<D, N, L, S>& node, Entry&& entry)
+    {
+        if (auto* leaf = std::get_if<RSTLeafNode<D, N, L, S>>(&node))
+        {
+            leaf->subregions[leaf->size] = entry.region;
+            leaf->children[leaf->size].emplace(std::move(*entry.value));
+            leaf->region.expand(entry.region);
+            ++leaf->size;
+            return;
+        }
+
+        auto& internal = std::get<RSTInternalNode<D, N, L, S>>(node);
+        internal.subregions[internal.size] = entry.region;
+        internal.children[internal.size] = std::move(entry.subtree);
+        internal.region.expand(entry.region);
+        ++internal.size;
+    }
+
+    // Takes the entry in `slot` out of `node` (of level `level`), moving the last entry into its place. The node's
+    // region is left as it was.
+    template <typename Entry, size_t D, size_t N, size_t L, typename S>
+    Entry pop_entry(RSTNode<D, N, L, S>& node, const size_t slot, const size_t level)
+    {
+        return std::visit([&](auto& n)
+        {
+            const size_t last = --n.size;
+            Entry entry{*n.subregions[slot], {}, nullptr, level};
+            if constexpr (std::is_same_v<std::decay_t<decltype(n)>, RSTLeafNode<D, N, L, S>>)
+            {
+                entry.value.emplace(std::move(*n.children[slot]));
+                // Values may have const members, so they are re-emplaced rather than assigned
+                n.children[slot].reset();
+                if (slot != last) n.children[slot].emplace(std::move(*n.children[last]));
+                n.children[last].reset();
+            }
+            else
+            {
+                entry.subtree = std::move(n.children[slot]);
+                n.children[slot] = std::move(n.children[last]);
+            }
+            n.subregions[slot] = n.subregions[last];
+            n.subregions[last].reset();
+            return entry;
+        }, node);
+    }
+
+    // Shrinks the region of `node` to fit its entries exactly, and returns it.
+    template <size_t D, size_t N, size_t L, typename S>
+    const MBR<D>& tighten(RSTNode<D, N, L, S>& node)
+    {
+        return std::visit([](auto& n) -> const MBR<D>&
+        {
+            n.region = MBR<D>();
+            for (size_t i = 0; i < n.size; ++i) n.region.expand(*n.subregions[i]);
+            return n.region;
+        }, node);
+    }
+
+    // R* ChooseSubtree: the child of `node` whose region needs the least overlap enlargement to take `region` when the
+    // children are leaves, and otherwise the least area enlargement; ties go to the least margin enlargement, then the
+    // smallest area.
+    template <size_t D, size_t N, size_t L, typename S>
+    size_t choose_subtree(const RSTInternalNode<D, N, L, S>& node, const MBR<D>& region, const bool above_leaves)
+    {
+        size_t best_index = 0;
+        std::array<double, 4> best_cost{inf, inf, inf, inf};
+        for (size_t i = 0; i < node.size; ++i)
+        {
+            const MBR<D>& current = *node.subregions[i];
+            MBR<D> enlarged = current;
+            enlarged.expand(region);
+
+            std::array<double, 4> cost{0.0, enlarged.area() - current.area(), compute_margin(enlarged) - compute_margin(current), current.area()};
+            if (above_leaves)
+            {
+                for (size_t j = 0; j < node.size; ++j)
+                    if (j != i) cost[0] += compute_overlap(enlarged, *node.subregions[j]) - compute_overlap(current, *node.subregions[j]);
+            }
+
+            if (cost < best_cost)
+            {
+                best_index = i;
+                best_cost = cost;
+            }
+        }
+        return best_index;
+    }
+
+    // R* split of an overflowing node's `regions` into two groups of at least `minimum` each: the axis is the one
+    // whose candidate distributions (sorted by lower, then by upper bound) have the least total margin, and the
+    // distribution on it the one with the least overlap, then the least area. Returns the entries in their new order
+    // and the size of the first group.
+    template <size_t D>
+    std::pair<std::vector<size_t>, size_t> choose_split(const std::vector<MBR<D>>& regions, const size_t minimum)
+    {
+        const size_t count = regions.size();
+        std::vector<size_t> order(count);
+        std::vector<MBR<D>> lower(count), upper(count);  // bounds of the first i + 1, and of the last count - i
+
+        const auto sweep = [&](const size_t axis, const bool by_max, const auto& visit)
+        {
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b)
+            {
+                const MBR<D>& x = regions[a];
+                const MBR<D>& y = regions[b];
+                return by_max ? std::pair(x.max[axis], x.min[axis]) < std::pair(y.max[axis], y.min[axis])
+                              : std::pair(x.min[axis], x.max[axis]) < std::pair(y.min[axis], y.max[axis]);
+            });
+
+            MBR<D> bounds;
+            for (size_t i = 0; i < count; ++i)
+            {
+                bounds.expand(regions[order[i]]);
+                lower[i] = bounds;
+            }
+            bounds = MBR<D>();
+            for (size_t i = count; i-- > 0;)
+            {
+                bounds.expand(regions[order[i]]);
+                upper[i] = bounds;
+            }
+
+            for (size_t k = minimum; k + minimum <= count; ++k) visit(lower[k - 1], upper[k], k);
+        };
+
+        size_t best_axis = 0;
+        double best_margin = inf;
+        for (size_t axis = 0; axis < D; ++axis)
+        {
+            double margin = 0.0;
+            for (const bool by_max : {false, true})
+                sweep(axis, by_max, [&margin](const MBR<D>& a, const MBR<D>& b, size_t) { margin += compute_margin(a) + compute_margin(b); });
+            if (margin < best_margin)
+            {
+                best_axis = axis;
+                best_margin = margin;
+            }
+        }
+
+        bool best_by_max = false;
+        size_t best_split = minimum;
+        std::array<double, 2> best_cost{inf, inf};
+        for (const bool by_max : {false, true})
+        {
+            sweep(best_axis, by_max, [&](const MBR<D>& a, const MBR<D>& b, const size_t k)
+            {
+                const std::array<double, 2> cost{compute_overlap(a, b), a.area() + b.area()};
+                if (cost < best_cost)
+                {
+                    best_by_max = by_max;
+                    best_split = k;
+                    best_cost = cost;
+                }
+            });
+        }
+
+        sweep(best_axis, best_by_max, [](const MBR<D>&, const MBR<D>&, size_t) {});
+        return {std::move(order), best_split};
+    }
+
+#pragma endregion
+
+    // ----------------------------------------------------------
+    //  R*-Tree Leaf Nodes Member Functions
+    // ----------------------------------------------------------
+#pragma region Leaf Node Member Functions
+    template <size_t D, size_t N, size_t L, typename S>
+    template <typename Predicate>
+    void RSTLeafNode<D, N, L, S>::enqueue(const std::array<double, D>& key,
+                                          RSTQueue<D, N, L, S>& queue,
+                                          const Predicate& accept,
+                                          const std::array<double, D>& scale) const
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (!children[i]) continue;
+            if constexpr (!std::is_same_v<Predicate, RSTAcceptAll>)
+                if (!accept(*children[i])) continue;
+
+            queue.push({point_to_box_distance_scaled(key, *subregions[i], scale), nullptr, &*children[i]});
+        }
+    }
+#pragma endregion
+
+    // ----------------------------------------------------------
+    //  R*-Tree Internal Nodes
+    // ----------------------------------------------------------
+#pragma region Internal Node Member Functions
+    template <size_t D, size_t N, size_t L, typename S>
+    template <typename Predicate>
+    void RSTInternalNode<D, N, L, S>::enqueue(const std::array<double, D>& key,
+                                              RSTQueue<D, N, L, S>& queue,
+                                              const Predicate&,
+                                              const std::array<double, D>& scale) const
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (!subregions[i] || !children[i]) continue;
+
+            queue.push({point_to_box_distance_scaled(key, *subregions[i], scale), children[i].get(), nullptr});
+        }
+    }
+#pragma endregion
+    // ----------------------------------------------------------
+    //  R*-Tree Implementation
+    // ----------------------------------------------------------
+#pragma region RSTTree Implementation
+
+    template <typename S, size_t D, size_t N, size_t L>
+    void RSTTree<S, D, N, L>::insert(const std::array<double, D>& key, const S& value)
+    {
+        std::vector<bool> reinserted(this->levels + 1, false);
+        this->place(Pending{MBR<D>(key), value, nullptr, 0}, reinserted);
+        ++this->count;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    size_t RSTTree<S, D, N, L>::erase(const std::array<double, D>& key, Predicate&& accept)
+    {
+        size_t erased = 0;
+        while (auto found = this->find(key, accept))
+        {
+            this->remove(found->first, found->second);
+            ++erased;
+        }
+        return erased;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    bool RSTTree<S, D, N, L>::update(const std::array<double, D>& key, Predicate&& accept, const std::array<double, D>& new_key, const S& value)
+    {
+        auto found = this->find(key, accept);
+        if (!found) return false;
+
+        // `value` may be the very entry being replaced
+        S replacement(value);
+        auto& [path, slot] = *found;
+        auto& leaf = std::get<Leaf>(*path.nodes.back());
+        if (!leaf.region.contains(new_key))
+        {
+            this->remove(path, slot);
+            this->insert(new_key, replacement);
+            return true;
+        }
+
+        leaf.subregions[slot] = MBR<D>(new_key);
+        leaf.children[slot].reset();
+        leaf.children[slot].emplace(std::move(replacement));
+        this->refresh(path, path.nodes.size() - 1);
+        return true;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    void RSTTree<S, D, N, L>::place(Pending entry, std::vector<bool>& reinserted)
+    {
+        if (!this->root)
+        {
+            this->root = std::make_unique<Node>(std::in_place_type<Leaf>);
+            this->levels = 0;
+            push_entry(*this->root, std::move(entry));
+            return;
+        }
+
+        // Descend to the level the entry belongs on
+        const size_t target = this->levels - entry.level;
+        Path path{{this->root.get()}, {0}};
+        for (size_t depth = 0; depth < target; ++depth)
+        {
+            const auto& internal = std::get<Internal>(*path.nodes[depth]);
+            const size_t slot = choose_subtree(internal, entry.region, depth + 1 == this->levels);
+            path.nodes.push_back(internal.children[slot].get());
+            path.slots.push_back(slot);
+        }
+
+        if (RSTNodeFN::is_full(*path.nodes[target]))
+        {
+            this->overflow(path, target, std::move(entry), reinserted);
+            return;
+        }
+        push_entry(*path.nodes[target], std::move(entry));
+        this->refresh(path, target);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    void RSTTree<S, D, N, L>::overflow(Path& path, const size_t depth, Pending entry, std::vector<bool>& reinserted)
+    {
+        Node& node = *path.nodes[depth];
+        const size_t level = this->levels - depth;
+
+        std::vector<Pending> entries;
+        while (RSTNodeFN::get_size(node) > 0)
+            entries.push_back(pop_entry<Pending>(node, RSTNodeFN::get_size(node) - 1, level));
+        entries.push_back(std::move(entry));
+
+        // Entries are moved, not sorted in place, as values may not be assignable
+        const auto refill = [&](const std::vector<size_t>& order, const size_t first, const size_t last, Node& target)
+        {
+            for (size_t i = first; i < last; ++i) push_entry(target, std::move(entries[order[i]]));
+        };
+
+        // Forced reinsertion, once per level and insertion (never at the root): the entries farthest from the center
+        // of the node go back through the tree, closest first, and often land somewhere that fits them better
+        if (depth > 0 && !reinserted[level])
+        {
+            reinserted[level] = true;
+
+            MBR<D> bounds;
+            for (const auto& e : entries) bounds.expand(e.region);
+            std::vector<double> distances(entries.size());
+            for (size_t i = 0; i < entries.size(); ++i) distances[i] = center_distance(entries[i].region, bounds);
+
+            std::vector<size_t> order(entries.size());
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::stable_sort(order.begin(), order.end(), [&distances](const size_t a, const size_t b) { return distances[a] < distances[b]; });
+
+            const auto capacity = static_cast<double>(entries.size() - 1);
+            const size_t kept = entries.size() - std::max(static_cast<size_t>(std::lround(REINSERT_FRACTION * capacity)), size_t{1});
+            refill(order, 0, kept, node);
+            this->refresh(path, depth);
+            for (size_t i = kept; i < entries.size(); ++i) this->place(std::move(entries[order[i]]), reinserted);
+            return;
+        }
+
+        std::vector<MBR<D>> regions(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) regions[i] = entries[i].region;
+        const size_t minimum = level == 0 ? Leaf::MIN_SPLIT_COUNT : Internal::MIN_SPLIT_COUNT;
+        const auto [order, split] = choose_split(regions, minimum);
+
+        auto sibling = level == 0 ? std::make_unique<Node>(std::in_place_type<Leaf>) : std::make_unique<Node>(std::in_place_type<Internal>);
+        refill(order, 0, split, node);
+        refill(order, split, entries.size(), *sibling);
+        this->refresh(path, depth);
+
+        const MBR<D> sibling_region = RSTNodeFN::get_region(*sibling);
+        if (depth == 0)
+        {
+            // The root split: the tree grows a level
+            const MBR<D> root_region = RSTNodeFN::get_region(*this->root);
+            auto root = std::make_unique<Node>(std::in_place_type<Internal>);
+            push_entry(*root, Pending{root_region, {}, std::move(this->root), level + 1});
+            push_entry(*root, Pending{sibling_region, {}, std::move(sibling), level + 1});
+            this->root = std::move(root);
+            ++this->levels;
+            reinserted.push_back(false);
+            return;
+        }
+
+        Pending split_off{sibling_region, {}, std::move(sibling), level + 1};
+        if (RSTNodeFN::is_full(*path.nodes[depth - 1]))
+        {
+            this->overflow(path, depth - 1, std::move(split_off), reinserted);
+            return;
+        }
+        push_entry(*path.nodes[depth - 1], std::move(split_off));
+        this->refresh(path, depth - 1);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    void RSTTree<S, D, N, L>::refresh(const Path& path, const size_t depth)
+    {
+        for (size_t d = depth + 1; d-- > 0;)
+        {
+            const MBR<D>& region = tighten(*path.nodes[d]);
+            if (d > 0) std::get<Internal>(*path.nodes[d - 1]).subregions[path.slots[d]] = region;
+        }
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    std::optional<std::pair<typename RSTTree<S, D, N, L>::Path, size_t>>
+    RSTTree<S, D, N, L>::find(const std::array<double, D>& key, const Predicate& accept) const
+    {
+        if (!this->root) return std::nullopt;
+
+        // Depth-first through every subtree whose region contains the key, as regions may overlap
+        Path path;
+        const auto search = [&](const auto& self, Node* node, const size_t slot) -> std::optional<size_t>
+        {
+            path.nodes.push_back(node);
+            path.slots.push_back(slot);
+            if (const auto* leaf = std::get_if<Leaf>(node))
+            {
+                for (size_t i = 0; i < leaf->size; ++i)
+                {
+                    const MBR<D>& region = *leaf->subregions[i];
+                    if (region.min == key && region.max == key && accept(*leaf->children[i])) return i;
+                }
+            }
+            else
+            {
+                const auto& internal = std::get<Internal>(*node);
+                for (size_t i = 0; i < internal.size; ++i)
+                {
+                    if (!internal.subregions[i]->contains(key)) continue;
+                    if (auto found = self(self, internal.children[i].get(), i)) return found;
+                }
+            }
+            path.nodes.pop_back();
+            path.slots.pop_back();
+            return std::nullopt;
+        };
+
+        const auto slot = search(search, this->root.get(), 0);
+        if (!slot) return std::nullopt;
+        return std::pair{std::move(path), *slot};
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    void RSTTree<S, D, N, L>::remove(Path& path, const size_t slot)
+    {
+        const size_t leaf_depth = path.nodes.size() - 1;
+        pop_entry<Pending>(*path.nodes[leaf_depth], slot, 0);
+        --this->count;
+
+        // Guttman's CondenseTree: every node on the path left under its minimum fill leaves its parent, and its
+        // entries are reinserted at their own level once the path above is consistent again
+        std::vector<Pending> orphans;
+        size_t kept = leaf_depth;
+        for (size_t depth = leaf_depth; depth > 0; --depth)
+        {
+            const bool underfull = std::visit([](const auto& node) { return node.size < node.MIN_SPLIT_COUNT; }, *path.nodes[depth]);
+            if (!underfull)
+            {
+                // Tightened on the way up, so an orphaned subtree above carries its true region
+                std::get<Internal>(*path.nodes[depth - 1]).subregions[path.slots[depth]] = tighten(*path.nodes[depth]);
+                continue;
+            }
+
+            const size_t level = this->levels - depth;
+            Pending detached = pop_entry<Pending>(*path.nodes[depth - 1], path.slots[depth], level + 1);
+            while (RSTNodeFN::get_size(*detached.subtree) > 0)
+                orphans.push_back(pop_entry<Pending>(*detached.subtree, RSTNodeFN::get_size(*detached.subtree) - 1, level));
+            kept = depth - 1;
+        }
+        this->refresh(path, kept);
+
+        // The root keeps at least one child through the above, so every orphan has a level to go back to
+        for (auto& orphan : orphans)
+        {
+            std::vector<bool> reinserted(this->levels + 1, false);
+            this->place(std::move(orphan), reinserted);
+        }
+
+        while (this->root)
+        {
+            if (auto* internal = std::get_if<Internal>(this->root.get()); internal && internal->size == 1)
+            {
+                auto child = std::move(internal->children[0]);
+                this->root = std::move(child);
+                --this->levels;
+                continue;
+            }
+            if (RSTNodeFN::get_size(*this->root) == 0) this->root.reset();
+            break;
+        }
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    RSTTreeShape RSTTree<S, D, N, L>::shape() const
+    {
+        RSTTreeShape shape;
+        const auto walk = [&shape](const auto& self, const Node& node, const size_t depth) -> void
+        {
+            std::visit([&](const auto& n)
+            {
+                MBR<D> region;
+                for (size_t i = 0; i < n.size; ++i) region.expand(*n.subregions[i]);
+                if (region.min != n.region.min || region.max != n.region.max) shape.tight = false;
+
+                if constexpr (std::is_same_v<std::decay_t<decltype(n)>, Leaf>)
+                {
+                    shape.entries += n.size;
+                    shape.min_leaf_depth = std::min(shape.min_leaf_depth, depth);
+                    shape.max_leaf_depth = std::max(shape.max_leaf_depth, depth);
+                    if (depth == 0) return;
+                    shape.min_leaf_fill = std::min(shape.min_leaf_fill, n.size);
+                    shape.max_leaf_fill = std::max(shape.max_leaf_fill, n.size);
+                }
+                else
+                {
+                    if (depth > 0)
+                    {
+                        shape.min_internal_fill = std::min(shape.min_internal_fill, n.size);
+                        shape.max_internal_fill = std::max(shape.max_internal_fill, n.size);
+                    }
+                    for (size_t i = 0; i < n.size; ++i)
+                    {
+                        const MBR<D>& child = RSTNodeFN::get_region(*n.children[i]);
+                        if (child.min != n.subregions[i]->min || child.max != n.subregions[i]->max) shape.tight = false;
+                        self(self, *n.children[i], depth + 1);
+                    }
+                }
+            }, node);
+        };
+        if (this->root) walk(walk, *this->root, 0);
+        return shape;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    RSTTree<S, D, N, L> RSTTree<S, D, N, L>::bulk_load(std::span<const std::pair<std::array<double, D>, S>> entries)
+    {
+        using LeafT = RSTLeafNode<D, N, L, S>;
+        using InternalT = RSTInternalNode<D, N, L, S>;
+        using NodeT = RSTNode<D, N, L, S>;
+
+        RSTTree tree;
+        if (entries.empty()) return tree;
+
+        // Leaf level: tile the points themselves, then pack each run of `L` into a leaf
+        std::vector<size_t> order(entries.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        sort_tile_recursive<D>(order.begin(), order.end(), 0, L, [&entries](const size_t i, const size_t axis)
+        {
+            return entries[i].first[axis];
+        });
+
+        std::vector<MBR<D>> regions;
+        std::vector<std::unique_ptr<NodeT>> level;
+        for (size_t start = 0; start < order.size(); start += L)
+        {
+            LeafT leaf;
+            for (size_t j = start; j < std::min(start + L, order.size()); ++j)
+            {
+                const auto& [key, value] = entries[order[j]];
+                leaf.subregions[leaf.size] = MBR<D>(key);
+                leaf.children[leaf.size].emplace(value);
+                leaf.region.expand(key);
+                ++leaf.size;
+            }
+            regions.push_back(leaf.region);
+            level.push_back(std::make_unique<NodeT>(std::move(leaf)));
+        }
+
+        // Internal levels: tile the child regions by their centers until a single root remains
+        while (level.size() > 1)
+        {
+            ++tree.levels;
+            order.resize(level.size());
+            std::iota(order.begin(), order.end(), size_t{0});
+            sort_tile_recursive<D>(order.begin(), order.end(), 0, N, [&regions](const size_t i, const size_t axis)
+            {
+                return 0.5 * (regions[i].min[axis] + regions[i].max[axis]);
+            });
+
+            std::vector<MBR<D>> parent_regions;
+            std::vector<std::unique_ptr<NodeT>> parents;
+            for (size_t start = 0; start < order.size(); start += N)
+            {
+                InternalT internal;
+                for (size_t j = start; j < std::min(start + N, order.size()); ++j)
+                {
+                    internal.subregions[internal.size] = regions[order[j]];
+                    internal.children[internal.size] = std::move(level[order[j]]);
+                    internal.region.expand(regions[order[j]]);
+                    ++internal.size;
+                }
+                parent_regions.push_back(internal.region);
+                parents.push_back(std::make_unique<NodeT>(std::move(internal)));
+            }
+
+            regions = std::move(parent_regions);
+            level = std::move(parents);
+        }
+
+        tree.root = std::move(level.front());
+        tree.count = entries.size();
+        return tree;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    RSTFrozenTree<S, D, N, L> RSTTree<S, D, N, L>::freeze() const
+    {
+        using FrozenT = RSTFrozenTree<S, D, N, L>;
+        using LeafT = RSTLeafNode<D, N, L, S>;
+        using InternalT = RSTInternalNode<D, N, L, S>;
+
+        FrozenT frozen;
+        if (!root) return frozen;
+
+        auto storage = std::make_shared<typename FrozenT::Storage>();
+        auto& nodes = storage->nodes;
+        auto& values = storage->values;
+
+        // Breadth-first, so siblings (which are always expanded together) end up adjacent in the buffer
+        std::vector<const RSTNode<D, N, L, S>*> pending{root.get()};
+        for (size_t head = 0; head < pending.size(); ++head)
+        {
+            typename FrozenT::Node flat{};
+            for (auto& bounds : flat.min) bounds.fill(inf);
+            for (auto& bounds : flat.max) bounds.fill(inf);
+            flat.children.fill(0);
+
+            const auto append = [&flat](const MBR<D>& region, const size_t child)
+            {
+                if (child > std::numeric_limits<std::uint32_t>::max())
+                    throw std::runtime_error("Tree is too large to freeze with 32-bit indices...");
+                for (size_t d = 0; d < D; ++d)
+                {
+                    flat.min[d][flat.size] = region.min[d];
+                    flat.max[d][flat.size] = region.max[d];
+                }
+                flat.children[flat.size++] = static_cast<std::uint32_t>(child);
+            };
+
+            if (const auto* leaf = std::get_if<LeafT>(pending[head]))
+            {
+                flat.is_leaf = true;
+                for (size_t i = 0; i < leaf->size; ++i)
+                {
+                    if (!leaf->subregions[i] || !leaf->children[i]) continue;
+                    append(*leaf->subregions[i], values.size());
+                    values.push_back(*leaf->children[i]);
+                }
+            }
+            else if (const auto* internal = std::get_if<InternalT>(pending[head]))
+            {
+                for (size_t i = 0; i < internal->size; ++i)
+                {
+                    if (!internal->subregions[i] || !internal->children[i]) continue;
+                    append(*internal->subregions[i], pending.size());
+                    pending.push_back(internal->children[i].get());
+                }
+            }
+
+            nodes.push_back(flat);
+        }
+
+        frozen.nodes = nodes;
+        frozen.values = values;
+        frozen.storage = std::move(storage);
+        return frozen;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    RSTFrozenTree<S, D, N, L> RSTTree<S, D, N, L>::open_mmap(const std::filesystem::path& path)
+    {
+        using FrozenT = RSTFrozenTree<S, D, N, L>;
+        using NodeT = typename FrozenT::Node;
+        static_assert(std::is_trivially_copyable_v<S>, "Only trivially copyable values can be read in place...");
+        static_assert(std::endian::native == std::endian::little, "The binary format is little-endian...");
+
+        const auto fail = [&path](const std::string& what)
+        {
+            throw std::runtime_error("Could not open '" + path.string() + "' as an RSTTree: " + what + "...");
+        };
+
+        auto file = std::make_shared<const MappedFile>(path);
+        const auto bytes = file->bytes();
+
+        RSTBinaryHeader header;
+        if (bytes.size() < sizeof header) fail("file is too small");
+        std::memcpy(&header, bytes.data(), sizeof header);
+        if (header.magic != RSTBinaryHeader::MAGIC) fail("bad magic number");
+        if (header.version != RSTBinaryHeader::VERSION) fail("unsupported version " + std::to_string(header.version));
+        if (header.dimensions != D || header.width != FrozenT::WIDTH || header.node_size != sizeof(NodeT) || header.value_size != sizeof(S))
+            fail("stored layout does not match this tree type");
+
+        const auto fits = [&bytes](const std::uint64_t offset, const std::uint64_t count, const size_t size)
+        {
+            return offset % RSTBinaryHeader::ALIGNMENT == 0 && offset <= bytes.size() && count <= (bytes.size() - offset) / size;
+        };
+        if (!fits(header.node_offset, header.node_count, sizeof(NodeT)) || !fits(header.value_offset, header.value_count, sizeof(S)))
+            fail("file is truncated or misaligned");
+        if ((header.node_count == 0) != (header.value_count == 0)) fail("nodes and values disagree");
+
+        FrozenT frozen;
+        frozen.nodes = {reinterpret_cast<const NodeT*>(bytes.data() + header.node_offset), static_cast<size_t>(header.node_count)};
+        frozen.values = {reinterpret_cast<const S*>(bytes.data() + header.value_offset), static_cast<size_t>(header.value_count)};
+
+        // Every later access trusts the child indices, so check them once up front (this only touches node pages)
+        for (const auto& node : frozen.nodes)
+        {
+            if (node.size > FrozenT::WIDTH) fail("corrupt node");
+            const size_t limit = node.is_leaf ? frozen.values.size() : frozen.nodes.size();
+            for (size_t i = 0; i < node.size; ++i)
+                if (node.children[i] >= limit) fail("corrupt node");
+        }
+
+        frozen.storage = std::move(file);
+        return frozen;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    void RSTFrozenTree<S, D, N, L>::save(const std::filesystem::path& path) const
+    {
+        static_assert(std::is_trivially_copyable_v<S>, "Only trivially copyable values can be written raw...");
+        static_assert(std::endian::native == std::endian::little, "The binary format is little-endian...");
+
+        const auto align = [](const size_t offset) { return (offset + RSTBinaryHeader::ALIGNMENT - 1) / RSTBinaryHeader::ALIGNMENT * RSTBinaryHeader::ALIGNMENT; };
+
+        RSTBinaryHeader header;
+        header.dimensions = static_cast<std::uint32_t>(D);
+        header.width = static_cast<std::uint32_t>(WIDTH);
+        header.node_size = static_cast<std::uint32_t>(sizeof(Node));
+        header.value_size = static_cast<std::uint32_t>(sizeof(S));
+        header.node_count = nodes.size();
+        header.value_count = values.size();
+        header.node_offset = align(sizeof header);
+        header.value_offset = align(header.node_offset + nodes.size_bytes());
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Could not open '" + path.string() + "' for writing...");
+
+        const auto write_at = [&out](const std::uint64_t offset, const void* data, const size_t size)
+        {
+            for (auto at = static_cast<std::uint64_t>(out.tellp()); at < offset; ++at) out.put('\0');
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        };
+        write_at(0, &header, sizeof header);
+        write_at(header.node_offset, nodes.data(), nodes.size_bytes());
+        write_at(header.value_offset, values.data(), values.size_bytes());
+
+        if (!out.flush()) throw std::runtime_error("Could not write '" + path.string() + "'...");
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    std::vector<S> RSTTree<S, D, N, L>::query(const std::array<double, D>& key, const size_t k, const std::array<double, D>& scale) const
+    {
+        return query_if(key, k, RSTAcceptAll{}, scale);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    std::vector<S> RSTTree<S, D, N, L>::query_with_filter(const std::array<double, D>& key,
+                                                          const size_t k,
+                                                          const std::function<bool(const S&)>& filter,
+                                                          const std::array<double, D>& scale) const
+    {
+        return query_if(key, k, filter, scale);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    std::vector<S> RSTTree<S, D, N, L>::query_if(const std::array<double, D>& key,
+                                                 const size_t k,
+                                                 Predicate&& accept,
+                                                 const std::array<double, D>& scale) const
+    {
+        if (!root || k == 0) return {};
+
+        // Global best-first (Hjaltason-Samet) search: subtrees and entries share one queue ordered by their
+        // lower-bound distance, so an entry that reaches the top is nearer than anything still unexpanded.
+        RSTQueue<D, N, L, S> queue;
+        queue.push({0.0, root.get(), nullptr});
+
+        std::vector<S> output;
+        output.reserve(k);
+        while (!queue.empty() && output.size() < k)
+        {
+            const RSTQueueEntry<D, N, L, S> top = queue.top();
+            queue.pop();
+
+            if (top.value)
+            {
+                output.push_back(*top.value);
+                continue;
+            }
+
+            std::visit([&](const auto& node)
+            {
+                node.enqueue(key, queue, accept, scale);
+            }, *top.node);
+        }
+
+        return output;
+    }
+
+#pragma endregion
+
+    // ----------------------------------------------------------
+    //  Frozen R*-Tree Implementation
+    // ----------------------------------------------------------
+#pragma region RSTFrozenTree Implementation
+
+    template <typename S, size_t D, size_t N, size_t L>
+    std::vector<S> RSTFrozenTree<S, D, N, L>::query(const std::array<double, D>& key, const size_t k, const std::array<double, D>& scale) const
+    {
+        return query_if(key, k, RSTAcceptAll{}, scale);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    std::vector<S> RSTFrozenTree<S, D, N, L>::query_with_filter(const std::array<double, D>& key,
+                                                                const size_t k,
+                                                                const std::function<bool(const S&)>& filter,
+                                                                const std::array<double, D>& scale) const
+    {
+        return query_if(key, k, filter, scale);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    size_t RSTFrozenTree<S, D, N, L>::query(const std::array<double, D>& key,
+                                            const std::span<std::uint32_t> out,
+                                            const std::array<double, D>& scale,
+                                            QueryScratch& scratch) const
+    {
+        return query_if(key, out, RSTAcceptAll{}, scale, scratch);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    size_t RSTFrozenTree<S, D, N, L>::query(const std::array<double, D>& key,
+                                            const std::span<const S*> out,
+                                            const std::array<double, D>& scale,
+                                            QueryScratch& scratch) const
+    {
+        return query_if(key, out, RSTAcceptAll{}, scale, scratch);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    size_t RSTFrozenTree<S, D, N, L>::query_with_filter(const std::array<double, D>& key,
+                                                        const std::span<std::uint32_t> out,
+                                                        const std::function<bool(const S&)>& filter,
+                                                        const std::array<double, D>& scale,
+                                                        QueryScratch& scratch) const
+    {
+        return query_if(key, out, filter, scale, scratch);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    size_t RSTFrozenTree<S, D, N, L>::query_with_filter(const std::array<double, D>& key,
+                                                        const std::span<const S*> out,
+                                                        const std::function<bool(const S&)>& filter,
+                                                        const std::array<double, D>& scale,
+                                                        QueryScratch& scratch) const
+    {
+        return query_if(key, out, filter, scale, scratch);
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    std::vector<S> RSTFrozenTree<S, D, N, L>::query_if(const std::array<double, D>& key,
+                                                       const size_t k,
+                                                       Predicate&& accept,
+                                                       const std::array<double, D>& scale) const
+    {
+        QueryScratch scratch;
+        const size_t found = search(key, k, accept, scale, scratch);
+
+        std::vector<S> output;
+        output.reserve(found);
+        for (size_t i = 0; i < found; ++i) output.push_back(values[scratch.indices[i]]);
+        return output;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    size_t RSTFrozenTree<S, D, N, L>::query_if(const std::array<double, D>& key,
+                                               const std::span<std::uint32_t> out,
+                                               Predicate&& accept,
+                                               const std::array<double, D>& scale,
+                                               QueryScratch& scratch) const
+    {
+        const size_t found = search(key, out.size(), accept, scale, scratch);
+        std::copy_n(scratch.indices.begin(), found, out.begin());
+        return found;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    size_t RSTFrozenTree<S, D, N, L>::query_if(const std::array<double, D>& key,
+                                               const std::span<const S*> out,
+                                               Predicate&& accept,
+                                               const std::array<double, D>& scale,
+                                               QueryScratch& scratch) const
+    {
+        const size_t found = search(key, out.size(), accept, scale, scratch);
+        for (size_t i = 0; i < found; ++i) out[i] = &values[scratch.indices[i]];
+        return found;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    std::vector<const S*> RSTFrozenTree<S, D, N, L>::query_batch(std::span<const std::array<double, D>> keys,
+                                                                 const size_t k,
+                                                                 const std::array<double, D>& scale) const
+    {
+        constexpr size_t GRAIN = 64;
+
+        std::vector<const S*> output(keys.size() * k, nullptr);
+        if (nodes.empty() || k == 0 || keys.empty()) return output;
+
+        MBR<D> bounds;
+        for (std::uint32_t i = 0; i < nodes[0].size; ++i)
+        {
+            for (size_t d = 0; d < D; ++d)
+            {
+                bounds.min[d] = std::min(bounds.min[d], nodes[0].min[d][i]);
+                bounds.max[d] = std::max(bounds.max[d], nodes[0].max[d][i]);
+            }
+        }
+
+        std::vector<std::pair<std::uint64_t, size_t>> order(keys.size());
+        for (size_t q = 0; q < keys.size(); ++q) order[q] = {hilbert_index(keys[q], bounds), q};
+        std::sort(order.begin(), order.end());
+
+        ThreadPool& pool = ThreadPool::shared();
+        std::vector<QueryScratch> scratches(pool.concurrency());
+
+        pool.parallel_for(order.size(), GRAIN, [&](const size_t begin, const size_t end, const size_t worker)
+        {
+            QueryScratch& scratch = scratches[worker];
+            scratch.seeds.clear();  // a chunk's first query is not near the previous chunk's last
+
+            for (size_t j = begin; j < end; ++j)
+            {
+                const size_t q = order[j].second;
+                const size_t found = search(keys[q], k, RSTAcceptAll{}, scale, scratch);
+                for (size_t i = 0; i < found; ++i) output[q * k + i] = &values[scratch.indices[i]];
+            }
+        });
+
+        return output;
+    }
+
+    template <typename S, size_t D, size_t N, size_t L>
+    template <typename Predicate>
+    size_t RSTFrozenTree<S, D, N, L>::search(const std::array<double, D>& key,
+                                             const size_t k,
+                                             const Predicate& accept,
+                                             const std::array<double, D>& scale,
+                                             QueryScratch& scratch) const
+    {
+        auto& queue = scratch.queue;
+        auto& nearest = scratch.nearest;
+        auto& seeds = scratch.seeds;
+        if (scratch.owner != this || scratch.owner_nodes != nodes.data() || scratch.owner_node_count != nodes.size())
+            seeds.clear();
+        scratch.owner = this;
+        scratch.owner_nodes = nodes.data();
+        scratch.owner_node_count = nodes.size();
+        queue.clear();
+        nearest.clear();
+        scratch.indices.resize(k);
+        scratch.leaves.resize(k);
+        if (nodes.empty() || k == 0) return 0;
+
+        const auto is_seed = [&seeds](const std::uint32_t leaf, const size_t before)
+        {
+            return std::find(seeds.begin(), seeds.begin() + static_cast<std::ptrdiff_t>(before), leaf) !=
+                   seeds.begin() + static_cast<std::ptrdiff_t>(before);
+        };
+
+        // Pushes the children of `index` that can still make the result. `nearest` holds the `k` best accepted
+        // distances enqueued so far, so anything farther than its top is dropped before it reaches the queue.
+        std::array<double, WIDTH> distances{};
+        const auto expand = [&](const std::uint32_t index)
+        {
+            const Node& node = nodes[index];
+            point_to_boxes_distance_scaled(key, node, scale, distances);
+            for (std::uint32_t i = 0; i < node.size; ++i)
+            {
+                if (nearest.size() == k && distances[i] > nearest.front()) continue;
+
+                if (node.is_leaf)
+                {
+                    if constexpr (!std::is_same_v<Predicate, RSTAcceptAll>)
+                        if (!accept(values[node.children[i]])) continue;
+                    if (nearest.size() == k)
+                    {
+                        std::pop_heap(nearest.begin(), nearest.end());
+                        nearest.pop_back();
+                    }
+                    nearest.push_back(distances[i]);
+                    std::push_heap(nearest.begin(), nearest.end());
+                }
+                queue.push_back({distances[i], node.children[i], index, node.is_leaf});
+                std::push_heap(queue.begin(), queue.end(), std::greater<>{});
+            }
+        };
+
+        // Leaves that answered a nearby query usually bound the answer tightly before the descent even starts; any
+        // leaf will do for correctness, so a seed that is not one here is only skipped
+        for (size_t i = 0; i < seeds.size(); ++i)
+            if (nodes[seeds[i]].is_leaf && !is_seed(seeds[i], i)) expand(seeds[i]);
+
+        queue.push_back({0.0, 0, 0, false});
+        std::push_heap(queue.begin(), queue.end(), std::greater<>{});
+
+        size_t found = 0;
+        while (!queue.empty() && found < k)
+        {
+            std::pop_heap(queue.begin(), queue.end(), std::greater<>{});
+            const RSTFlatQueueEntry top = queue.back();
+            queue.pop_back();
+
+            if (top.is_value)
+            {
+                scratch.indices[found] = top.index;
+                scratch.leaves[found] = top.leaf;
+                ++found;
+                continue;
+            }
+
+            if (nearest.size() == k && top.distance > nearest.front()) continue;
+            if (nodes[top.index].is_leaf && is_seed(top.index, seeds.size())) continue;
+            expand(top.index);
+        }
+
+        seeds.assign(scratch.leaves.begin(), scratch.leaves.begin() + static_cast<std::ptrdiff_t>(found));
+        return found;
+    }
+
+#pragma endregion
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+// ==========================================================
+//  Target Detection
+// ==========================================================
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LOGNGINE_X86 1
+#include <immintrin.h>
+#else
+#define LOGNGINE_X86 0
+#endif
+
+// Per-function instruction set selection; MSVC exposes every intrinsic without it.
+#if defined(__GNUC__) || defined(__clang__)
+#define LOGNGINE_TARGET(features) __attribute__((target(features)))
+#else
+#define LOGNGINE_TARGET(features)
+#endif
+
+namespace logngine::core
+{
+    enum class SIMDLevel
+    {
+        Scalar,
+        AVX2,   // AVX2 + FMA, 4 doubles per register
+        AVX512  // AVX-512F, 8 doubles per register
+    };
+
+    SIMDLevel simd_level();  // Widest extension usable on this CPU/OS; detected once, then cached.
+}
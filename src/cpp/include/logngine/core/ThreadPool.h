@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+namespace logngine::core
+{
+    // ==========================================================
+    //  Thread Pool
+    // ==========================================================
+#pragma region ThreadPool
+
+    // Fixed set of background workers that cooperate with the calling thread on one `parallel_for` at a time.
+    // Chunks are handed out dynamically, so uneven chunks (e.g. queries in dense vs. sparse regions) still balance.
+    class ThreadPool
+    {
+    public:
+        // `task(begin, end, worker)` handles items [begin, end); `worker` is in [0, concurrency()) and is unique
+        // among concurrently running calls, so it can index per-worker scratch space.
+        using Task = std::function<void(size_t begin, size_t end, size_t worker)>;
+
+        explicit ThreadPool(size_t n_workers = std::thread::hardware_concurrency());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Number of threads that take part in a `parallel_for`, including the caller.
+        [[nodiscard]] size_t concurrency() const { return this->workers.size() + 1; }
+
+        // Runs `task` over [0, count) in chunks of at most `grain` items and blocks until all are done. The first
+        // exception thrown by `task` is rethrown here. Calls from inside a task run serially on the calling worker.
+        void parallel_for(size_t count, size_t grain, const Task& task);
+
+        // Process-wide pool sized to the hardware.
+        static ThreadPool& shared();
+        // Makes `shared()` return `pool` from now on. Each Python extension links its own copy of this library, so
+        // `_core_core` hands its pool to the others as they load, and the whole process shares one.
+        static void adopt_shared(ThreadPool& pool);
+
+    private:
+        void work_loop(size_t worker);
+        void run_chunks(size_t worker);
+        // Whether this thread is one of this pool's workers, or the caller taking part in its current job. Unlike
+        // the thread-local mark, this holds for code from any copy of the library.
+        [[nodiscard]] bool runs_chunks_here() const;
+
+        std::vector<std::thread> workers;
+
+        std::mutex job_mutex;  // serializes callers
+        std::mutex state_mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+
+        std::atomic<std::thread::id> caller{};  // thread that published the current job
+        const Task* task = nullptr;
+        size_t count = 0;
+        size_t grain = 1;
+        std::atomic<size_t> next{0};
+        size_t active = 0;
+        size_t generation = 0;
+        bool stopping = false;
+        std::exception_ptr error = nullptr;
+    };
+
+#pragma endregion
+}
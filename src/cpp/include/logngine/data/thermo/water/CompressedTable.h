@@ -13,12 +13,13 @@ namespace logngine::data::thermo::water {
 #pragma region Declarations
 struct CompressedTableData;
 struct CompressedTableEntry;
+struct CompressedTableKnot;
 #pragma endregion  // Declarations
 
 #pragma region Definitions
 struct CompressedTableData {
-    CompressedTableData() = default;
-    CompressedTableData(const double& temperature, const double& pressure, const double& specific_volume, const double& specific_internal_energy, const double& specific_enthalpy, const double& specific_entropy): temperature(temperature), pressure(pressure), specific_volume(specific_volume), specific_internal_energy(specific_internal_energy), specific_enthalpy(specific_enthalpy), specific_entropy(specific_entropy) {}
+    constexpr CompressedTableData() = default;
+    constexpr CompressedTableData(const double& temperature, const double& pressure, const double& specific_volume, const double& specific_internal_energy, const double& specific_enthalpy, const double& specific_entropy): temperature(temperature), pressure(pressure), specific_volume(specific_volume), specific_internal_energy(specific_internal_energy), specific_enthalpy(specific_enthalpy), specific_entropy(specific_entropy) {}
     const double temperature{};
     const double pressure{};
     const double specific_volume{};
@@ -27,201 +28,407 @@ struct CompressedTableData {
     const double specific_entropy{};
 };
 struct CompressedTableEntry {
-    CompressedTableEntry() = default;
-    CompressedTableEntry(const CompressedTableData& data, const CompressedTableData& uncertainty, const unsigned int& citation): data(data), uncertainty(uncertainty), citation(citation) {}
+    constexpr CompressedTableEntry() = default;
+    constexpr CompressedTableEntry(const CompressedTableData& data, const CompressedTableData& uncertainty, const unsigned int& citation): data(data), uncertainty(uncertainty), citation(citation) {}
     const CompressedTableData data{};
     const CompressedTableData uncertainty{};
     const unsigned int citation{};
 };
-inline logngine::core::RSTTree<CompressedTableEntry, 6, 16, 16> _make_baked_compressedtable_dataset () {
-    logngine::core::RSTTree<CompressedTableEntry, 6, 16, 16> CompressedTable{};
-    CompressedTable.insert(std::array<double, 6>{513.15, 50000000.0, 0.0011708, 990550.0, 1049100.0, 2615.6000000000004}, CompressedTableEntry{CompressedTableData{513.15, 50000000.0, 0.0011708, 990550.0, 1049100.0, 2615.6000000000004}, CompressedTableData{0.0, 0.0, 1.4800000000000034e-05, 43080.0, 43825.0, 85.39999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{610.9277777777778, 34473786.465841815, 0.0014581923031375856, 1476893.9063062281, 1527158.7733276905, 3500.290892953071}, CompressedTableEntry{CompressedTableData{610.9277777777778, 34473786.465841815, 0.0014581923031375856, 1476893.9063062281, 1527158.7733276905, 3500.290892953071}, CompressedTableData{0.0, 0.0, 4.4167782107622277e-05, 58766.398209035164, 60289.928421855904, 100.48321403642672}, 1});
-    CompressedTable.insert(std::array<double, 6>{633.15, 20000000.0, 0.0018248, 1703600.0, 1740100.0, 3878.7}, CompressedTableEntry{CompressedTableData{633.15, 20000000.0, 0.0018248, 1703600.0, 1740100.0, 3878.7}, CompressedTableData{0.0, 0.0, 0.00012774999999999993, 81700.0, 84250.0, 135.04999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{449.8166666666667, 3447378.6465841816, 0.0011208316041841002, 745808.7441814772, 749669.9047208399, 2103.448613829196}, CompressedTableEntry{CompressedTableData{449.8166666666667, 3447378.6465841816, 0.0011208316041841002, 745808.7441814772, 749669.9047208399, 2103.448613829196}, CompressedTableData{0.0, 0.0, 1.6761907414694827e-05, 60150.36840236088, 60208.51841048384, 133.03558858364386}, 1});
-    CompressedTable.insert(std::array<double, 6>{453.15, 20000000.0, 0.0011122, 750780.0, 773020.0, 2114.3}, CompressedTableEntry{CompressedTableData{453.15, 20000000.0, 0.0011122, 750780.0, 773020.0, 2114.3}, CompressedTableData{0.0, 0.0, 1.180000000000007e-05, 42750.0, 42985.0, 94.20000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{422.0388888888889, 6894757.293168363, 0.0010849979548133932, 623926.3271558117, 631416.0482020453, 1823.3935227085055}, CompressedTableEntry{CompressedTableData{422.0388888888889, 6894757.293168363, 0.0010849979548133932, 623926.3271558117, 631416.0482020453, 1823.3935227085055}, CompressedTableData{0.0, 0.0, 1.370293734646367e-05, 58998.99824152686, 59092.038254523504, 137.76667324452558}, 1});
-    CompressedTable.insert(std::array<double, 6>{313.15, 5000000.0, 0.0010057, 166920.0, 171950.0, 570.5}, CompressedTableEntry{CompressedTableData{313.15, 5000000.0, 0.0010057, 166920.0, 171950.0, 570.5}, CompressedTableData{0.0, 0.0, 3.049999999999993e-06, 41655.0, 41670.0, 129.10000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{553.15, 30000000.0, 0.001277, 1191500.0, 1229800.0, 3000.1000000000004}, CompressedTableEntry{CompressedTableData{553.15, 30000000.0, 0.001277, 1191500.0, 1229800.0, 3000.1000000000004}, CompressedTableData{0.0, 0.0, 2.2800000000000012e-05, 46850.0, 47550.0, 87.55000000000018}, 0});
-    CompressedTable.insert(std::array<double, 6>{593.15, 15000000.0, 0.0014733, 1431900.0, 1454000.0, 3426.2999999999997}, CompressedTableEntry{CompressedTableData{593.15, 15000000.0, 0.0014733, 1431900.0, 1454000.0, 3426.2999999999997}, CompressedTableData{0.0, 0.0, 4.7500000000000016e-05, 57150.0, 57850.0, 99.19999999999982}, 0});
-    CompressedTable.insert(std::array<double, 6>{477.59444444444443, 20684271.87950509, 0.0011448039410453398, 856479.8396410416, 880181.7829519487, 2342.891739276831}, CompressedTableEntry{CompressedTableData{477.59444444444443, 20684271.87950509, 0.0011448039410453398, 856479.8396410416, 880181.7829519487, 2342.891739276831}, CompressedTableData{0.0, 0.0, 2.2598921728564326e-05, 61801.82863305218, 62255.39869641099, 126.67165169467012}, 1});
-    CompressedTable.insert(std::array<double, 6>{310.9277777777778, 13789514.586336726, 0.0010010323478384787, 156679.3818864281, 170495.82381643675, 537.5014590831851}, CompressedTableEntry{CompressedTableData{310.9277777777778, 13789514.586336726, 0.0010010323478384787, 156679.3818864281, 170495.82381643675, 537.5014590831851}, CompressedTableData{0.0, 0.0, 3.5583937528401973e-06, 57510.35803357979, 57568.50804170272, 193.93260309030325}, 1});
-    CompressedTable.insert(std::array<double, 6>{613.15, 30000000.0, 0.0014932, 1502400.0, 1547100.0, 3543.8}, CompressedTableEntry{CompressedTableData{613.15, 30000000.0, 0.0014932, 1502400.0, 1547100.0, 3543.8}, CompressedTableData{0.0, 0.0, 4.5900000000000086e-05, 55350.0, 56700.0, 94.00000000000023}, 0});
-    CompressedTable.insert(std::array<double, 6>{473.15, 20000000.0, 0.001139, 837490.0, 860270.0, 2302.7000000000003}, CompressedTableEntry{CompressedTableData{473.15, 20000000.0, 0.001139, 837490.0, 860270.0, 2302.7000000000003}, CompressedTableData{0.0, 0.0, 1.34e-05, 43355.0, 43625.0, 91.99999999999977}, 0});
-    CompressedTable.insert(std::array<double, 6>{573.15, 10000000.0, 0.001398, 1329400.0, 1343300.0, 3248.8}, CompressedTableEntry{CompressedTableData{573.15, 10000000.0, 0.001398, 1329400.0, 1343300.0, 3248.8}, CompressedTableData{0.0, 0.0, 3.7699999999999995e-05, 53800.0, 54150.0, 96.15000000000009}, 0});
-    CompressedTable.insert(std::array<double, 6>{293.15, 50000000.0, 0.0009805, 80930.0, 129949.99999999999, 284.5}, CompressedTableEntry{CompressedTableData{293.15, 50000000.0, 0.0009805, 80930.0, 129949.99999999999, 284.5}, CompressedTableData{0.0, 0.0, 1.899999999999992e-06, 40320.0, 40409.99999999999, 134.14999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{338.7055555555556, 10342135.939752545, 0.0010155156346921441, 272467.6780608104, 282981.19952943653, 894.6774169768329}, CompressedTableEntry{CompressedTableData{338.7055555555556, 10342135.939752545, 0.0010155156346921441, 272467.6780608104, 282981.19952943653, 894.6774169768329}, CompressedTableData{0.0, 0.0, 6.492507899918932e-06, 57696.43805957316, 57777.848070945285, 164.54126298464854}, 1});
-    CompressedTable.insert(std::array<double, 6>{283.15000000000003, 3447378.6465841816, 0.0009987225132971611, 41937.7858582586, 45380.26633913617, 150.76668906048835}, CompressedTableEntry{CompressedTableData{283.15000000000003, 3447378.6465841816, 0.0009987225132971611, 41937.7858582586, 45380.26633913617, 150.76668906048835}, CompressedTableData{0.0, 0.0, 1.248559211520974e-07, 20957.26292750471, 20957.26292750471, 75.36241052731992}, 1});
-    CompressedTable.insert(std::array<double, 6>{505.37222222222226, 20684271.87950509, 0.0011900017845024684, 980083.496907146, 1004692.5803447707, 2596.235042666171}, CompressedTableEntry{CompressedTableData{505.37222222222226, 20684271.87950509, 0.0011900017845024684, 980083.496907146, 1004692.5803447707, 2596.235042666171}, CompressedTableData{0.0, 0.0, 2.2598921728564326e-05, 61801.82863305218, 62255.39869641099, 124.51544939347195}, 1});
-    CompressedTable.insert(std::array<double, 6>{449.8166666666667, 6894757.293168363, 0.0011180847739187497, 743785.1238987992, 751484.1849742754, 2098.9268691975567}, CompressedTableEntry{CompressedTableData{449.8166666666667, 6894757.293168363, 0.0011180847739187497, 743785.1238987992, 751484.1849742754, 2098.9268691975567}, CompressedTableData{0.0, 0.0, 1.6543409552678278e-05, 59929.398371493735, 60034.068386115076, 132.53317251346175}, 1});
-    CompressedTable.insert(std::array<double, 6>{633.15, 30000000.0, 0.0016276, 1626800.0, 1675600.0, 3749.8999999999996}, CompressedTableEntry{CompressedTableData{633.15, 30000000.0, 0.0016276, 1626800.0, 1675600.0, 3749.8999999999996}, CompressedTableData{0.0, 0.0, 6.720000000000001e-05, 62200.0, 64250.0, 103.04999999999973}, 0});
-    CompressedTable.insert(std::array<double, 6>{333.15, 10000000.0, 0.0010127, 249430.0, 259550.0, 826.0}, CompressedTableEntry{CompressedTableData{333.15, 10000000.0, 0.0010127, 249430.0, 259550.0, 826.0}, CompressedTableData{0.0, 0.0, 4.600000000000003e-06, 41550.0, 41590.0, 121.54999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 10342135.939752545, 0.0012646656253515374, 1121155.416613379, 1134227.5384394142, 2870.0518009154334}, CompressedTableEntry{CompressedTableData{533.15, 10342135.939752545, 0.0012646656253515374, 1121155.416613379, 1134227.5384394142, 2870.0518009154334}, CompressedTableData{0.0, 0.0, 3.080819854432736e-05, 65756.02918541152, 66070.03922927543, 127.2368697736249}, 1});
-    CompressedTable.insert(std::array<double, 6>{413.15, 10000000.0, 0.0010738, 584720.0, 595450.0, 1729.3}, CompressedTableEntry{CompressedTableData{413.15, 10000000.0, 0.0010738, 584720.0, 595450.0, 1729.3}, CompressedTableData{0.0, 0.0, 9.45000000000004e-06, 42270.0, 42360.0, 101.14999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15, 20000000.0, 0.0009904, 230.0, 20030.0, 0.5}, CompressedTableEntry{CompressedTableData{273.15, 20000000.0, 0.0009904, 230.0, 20030.0, 0.5}, CompressedTableData{0.0, 0.0, 1.249999999999949e-06, 41240.0, 41270.0, 145.8}, 0});
-    CompressedTable.insert(std::array<double, 6>{473.15, 15000000.0, 0.0011435, 840840.0, 858000.0, 2310.0}, CompressedTableEntry{CompressedTableData{473.15, 15000000.0, 0.0011435, 840840.0, 858000.0, 2310.0}, CompressedTableData{0.0, 0.0, 1.3749999999999982e-05, 43630.0, 43840.0, 92.54999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{513.15, 5000000.0, 0.0012268, 1031599.9999999999, 1037700.0, 2698.3}, CompressedTableEntry{CompressedTableData{513.15, 5000000.0, 0.0012268, 1031599.9999999999, 1037700.0, 2698.3}, CompressedTableData{0.0, 0.0, 1.9999999999999944e-05, 46604.99999999994, 46690.0, 92.79999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{373.15, 10000000.0, 0.0010385, 416230.0, 426620.0, 1299.6000000000001}, CompressedTableEntry{CompressedTableData{373.15, 10000000.0, 0.0010385, 416230.0, 426620.0, 1299.6000000000001}, CompressedTableData{0.0, 0.0, 7.049999999999982e-06, 41770.0, 41840.0, 109.74999999999989}, 0});
-    CompressedTable.insert(std::array<double, 6>{566.4833333333333, 20684271.87950509, 0.0013362704961323753, 1271368.5175965372, 1299001.4014565544, 3145.3758073752424}, CompressedTableEntry{CompressedTableData{566.4833333333333, 20684271.87950509, 0.0013362704961323753, 1271368.5175965372, 1299001.4014565544, 3145.3758073752424}, CompressedTableData{0.0, 0.0, 4.226372931004992e-05, 59115.29825777258, 59999.178381241276, 103.83265450430736}, 1});
-    CompressedTable.insert(std::array<double, 6>{533.15, 5000000.0, 0.0012755, 1128500.0, 1134900.0, 2884.1}, CompressedTableEntry{CompressedTableData{533.15, 5000000.0, 0.0012755, 1128500.0, 1134900.0, 2884.1}, CompressedTableData{0.0, 0.0, 2.4350000000000023e-05, 48450.00000000006, 48600.0, 92.89999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{608.6222222222223, 13789514.586336726, 0.0016002783414088909, 1540579.7952024634, 1562653.5382859285, 3610.026936282018}, CompressedTableEntry{CompressedTableData{608.6222222222223, 13789514.586336726, 0.0016002783414088909, 1540579.7952024634, 1562653.5382859285, 3610.026936282018}, CompressedTableData{0.0, 0.0, 0.00012607326638352406, 139362.30946741893, 143421.18003439973, 240.59449560846883}, 1});
-    CompressedTable.insert(std::array<double, 6>{333.15, 50000000.0, 0.0009962, 243080.0, 292880.0, 805.5}, CompressedTableEntry{CompressedTableData{333.15, 50000000.0, 0.0009962, 243080.0, 292880.0, 805.5}, CompressedTableData{0.0, 0.0, 4.500000000000055e-06, 40590.0, 40815.0, 119.35000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{513.15, 20000000.0, 0.0012053, 1016100.0, 1040200.0, 2667.6000000000004}, CompressedTableEntry{CompressedTableData{513.15, 20000000.0, 0.0012053, 1016100.0, 1040200.0, 2667.6000000000004}, CompressedTableData{0.0, 0.0, 1.78e-05, 45165.0, 45520.0, 89.64999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 6894757.293168363, 0.0012715327010149133, 1125853.9372697119, 1134622.9584946502, 2879.011554167015}, CompressedTableEntry{CompressedTableData{533.15, 6894757.293168363, 0.0012715327010149133, 1125853.9372697119, 1134622.9584946502, 2879.011554167015}, CompressedTableData{0.0, 0.0, 3.1869473874121925e-05, 66407.30927638838, 66628.27930725558, 128.30450392276248}, 1});
-    CompressedTable.insert(std::array<double, 6>{366.48333333333335, 3447378.6465841816, 0.0010367411412880335, 390070.2544886281, 393652.29498900083, 1228.7841036479513}, CompressedTableEntry{CompressedTableData{366.48333333333335, 3447378.6465841816, 0.0010367411412880335, 390070.2544886281, 393652.29498900083, 1228.7841036479513}, CompressedTableData{0.0, 0.0, 9.05205428354094e-06, 58150.00812293202, 58184.89812780585, 154.05332751959645}, 1});
-    CompressedTable.insert(std::array<double, 6>{366.48333333333335, 34473786.465841815, 0.0010222578544343678, 382301.41340340447, 417540.31832590123, 1206.803400577483}, CompressedTableEntry{CompressedTableData{366.48333333333335, 34473786.465841815, 0.0010222578544343678, 382301.41340340447, 417540.31832590123, 1206.803400577483}, CompressedTableData{0.0, 0.0, 1.4920282577698517e-05, 113915.8659128239, 114427.58598430565, 294.12274108579027}, 1});
-    CompressedTable.insert(std::array<double, 6>{593.15, 50000000.0, 0.0013409, 1354300.0, 1421400.0, 3288.8}, CompressedTableEntry{CompressedTableData{593.15, 50000000.0, 0.0013409, 1354300.0, 1421400.0, 3288.8}, CompressedTableData{0.0, 0.0, 2.649999999999994e-05, 47350.0, 48700.0, 83.50000000000023}, 0});
-    CompressedTable.insert(std::array<double, 6>{353.15, 20000000.0, 0.0010199, 330500.0, 350900.0, 1062.7}, CompressedTableEntry{CompressedTableData{353.15, 20000000.0, 0.0010199, 330500.0, 350900.0, 1062.7}, CompressedTableData{0.0, 0.0, 5.750000000000004e-06, 41375.0, 41490.0, 114.64999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 15000000.0, 0.001256, 1115100.0, 1134000.0, 2858.6}, CompressedTableEntry{CompressedTableData{533.15, 15000000.0, 0.001256, 1115100.0, 1134000.0, 2858.6}, CompressedTableData{0.0, 0.0, 2.1949999999999964e-05, 47050.0, 47400.0, 90.59999999999991}, 0});
-    CompressedTable.insert(std::array<double, 6>{588.7055555555556, 20684271.87950509, 0.0014207979547524751, 1389599.1141120824, 1418999.758219037, 3353.041116383857}, CompressedTableEntry{CompressedTableData{588.7055555555556, 20684271.87950509, 0.0014207979547524751, 1389599.1141120824, 1418999.758219037, 3353.041116383857}, CompressedTableData{0.0, 0.0, 4.226372931004992e-05, 59115.29825777258, 59999.178381241276, 103.83265450430736}, 1});
-    CompressedTable.insert(std::array<double, 6>{473.15, 10000000.0, 0.0011482, 844320.0, 855800.0, 2317.4}, CompressedTableEntry{CompressedTableData{473.15, 10000000.0, 0.0011482, 844320.0, 855800.0, 2317.4}, CompressedTableData{0.0, 0.0, 1.4100000000000072e-05, 43920.0, 44060.0, 93.14999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{553.15, 15000000.0, 0.0013096, 1213400.0, 1233000.0, 3041.0}, CompressedTableEntry{CompressedTableData{553.15, 15000000.0, 0.0013096, 1213400.0, 1233000.0, 3041.0}, CompressedTableData{0.0, 0.0, 2.68e-05, 49150.0, 49500.0, 91.20000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15000000000003, 13789514.586336726, 0.000993353708687613, 162.82002274420975, 13862.961936507, 0.4186800584851107}, CompressedTableEntry{CompressedTableData{273.15000000000003, 13789514.586336726, 0.000993353708687613, 162.82002274420975, 13862.961936507, 0.4186800584851107}, CompressedTableData{0.0, 0.0, 2.8092582259270707e-07, 20747.922898262157, 20747.922898262157, 74.60878642204672}, 1});
-    CompressedTable.insert(std::array<double, 6>{633.15, 20684271.87950509, 0.0017992362517650635, 1694793.6167444792, 1732032.8819464047, 3863.9145237473895}, CompressedTableEntry{CompressedTableData{633.15, 20684271.87950509, 0.0017992362517650635, 1694793.6167444792, 1732032.8819464047, 3863.9145237473895}, CompressedTableData{0.0, 0.0, 0.00012660390404842128, 86189.94203980989, 88818.32240696636, 142.60242792002896}, 1});
-    CompressedTable.insert(std::array<double, 6>{566.4833333333333, 34473786.465841815, 0.0013023721135395287, 1249248.2545065738, 1294140.0607774772, 3104.6801056904897}, CompressedTableEntry{CompressedTableData{566.4833333333333, 34473786.465841815, 0.0013023721135395287, 1249248.2545065738, 1294140.0607774772, 3104.6801056904897}, CompressedTableData{0.0, 0.0, 3.3742312691406205e-05, 55056.427690792014, 56219.42785325076, 97.32217959486388}, 1});
-    CompressedTable.insert(std::array<double, 6>{433.15, 10000000.0, 0.0010954, 670060.0, 681010.0, 1931.6}, CompressedTableEntry{CompressedTableData{433.15, 10000000.0, 0.0010954, 670060.0, 681010.0, 1931.6}, CompressedTableData{0.0, 0.0, 1.0800000000000046e-05, 42670.0, 42780.0, 97.75}, 0});
-    CompressedTable.insert(std::array<double, 6>{473.15, 5000000.0, 0.0011531, 847920.0, 853680.0, 2325.1}, CompressedTableEntry{CompressedTableData{473.15, 5000000.0, 0.0011531, 847920.0, 853680.0, 2325.1}, CompressedTableData{0.0, 0.0, 1.4550000000000001e-05, 44225.0, 44295.0, 93.80000000000018}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15000000000003, 20684271.87950509, 0.0009900450267770772, 232.6000324917282, 20701.40289176381, 0.4605480643336217}, CompressedTableEntry{CompressedTableData{273.15000000000003, 20684271.87950509, 0.0009900450267770772, 232.6000324917282, 20701.40289176381, 0.4605480643336217}, CompressedTableData{0.0, 0.0, 3.433537831687558e-07, 20619.992880391703, 20631.622882016287, 74.16917236063736}, 1});
-    CompressedTable.insert(std::array<double, 6>{310.9277777777778, 3447378.6465841816, 0.0010055271609999612, 157842.38204888673, 161308.1225330135, 541.353315621248}, CompressedTableEntry{CompressedTableData{310.9277777777778, 3447378.6465841816, 0.0010055271609999612, 157842.38204888673, 161308.1225330135, 541.353315621248}, CompressedTableData{0.0, 0.0, 3.4023238514000213e-06, 57952.298095314065, 57963.92809693866, 178.60891294974823}, 1});
-    CompressedTable.insert(std::array<double, 6>{477.59444444444443, 6894757.293168363, 0.0011581635246086346, 866388.6010251892, 874366.7821396554, 2363.99321422448}, CompressedTableEntry{CompressedTableData{477.59444444444443, 6894757.293168363, 0.0011581635246086346, 866388.6010251892, 874366.7821396554, 2363.99321422448}, CompressedTableData{0.0, 0.0, 2.0039375344942426e-05, 61301.73856319499, 61441.29858269001, 129.20466604850503}, 1});
-    CompressedTable.insert(std::array<double, 6>{353.15, 30000000.0, 0.0010155, 328400.0, 358860.0, 1056.4}, CompressedTableEntry{CompressedTableData{353.15, 30000000.0, 0.0010155, 328400.0, 358860.0, 1056.4}, CompressedTableData{0.0, 0.0, 5.649999999999948e-06, 41130.0, 41300.0, 114.14999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{493.15, 50000000.0, 0.0011412, 904390.0, 961450.0, 2441.3999999999996}, CompressedTableEntry{CompressedTableData{493.15, 50000000.0, 0.0011412, 904390.0, 961450.0, 2441.3999999999996}, CompressedTableData{0.0, 0.0, 1.3149999999999967e-05, 42470.0, 43130.0, 87.10000000000036}, 0});
-    CompressedTable.insert(std::array<double, 6>{553.15, 50000000.0, 0.001243, 1167700.0, 1229900.0, 2954.7}, CompressedTableEntry{CompressedTableData{553.15, 50000000.0, 0.001243, 1167700.0, 1229900.0, 2954.7}, CompressedTableData{0.0, 0.0, 1.929999999999998e-05, 44750.0, 45750.0, 83.54999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{293.15, 15000000.0, 0.0009951, 83010.0, 97930.0, 293.2}, CompressedTableEntry{CompressedTableData{293.15, 15000000.0, 0.0009951, 83010.0, 97930.0, 293.2}, CompressedTableData{0.0, 0.0, 1.1500000000000008e-06, 41370.0, 41420.0, 136.70000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{644.2611111111112, 34473786.465841815, 0.001671633500347424, 1678860.5145187958, 1736498.802570246, 3833.602087513067}, CompressedTableEntry{CompressedTableData{644.2611111111112, 34473786.465841815, 0.001671633500347424, 1678860.5145187958, 1736498.802570246, 3833.602087513067}, CompressedTableData{0.0, 0.0, 4.404292618646996e-05, 36180.93505408836, 37704.4652669091, 59.012954243476315}, 1});
-    CompressedTable.insert(std::array<double, 6>{573.15, 15000000.0, 0.0013783, 1317600.0, 1338300.0, 3227.9}, CompressedTableEntry{CompressedTableData{573.15, 15000000.0, 0.0013783, 1317600.0, 1338300.0, 3227.9}, CompressedTableData{0.0, 0.0, 3.435000000000005e-05, 52100.0, 52650.0, 93.45000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{283.15000000000003, 10342135.939752545, 0.0009954762593472016, 41751.70583226521, 52055.88727164877, 150.05493296106366}, CompressedTableEntry{CompressedTableData{283.15000000000003, 10342135.939752545, 0.0009954762593472016, 41751.70583226521, 52055.88727164877, 150.05493296106366}, CompressedTableData{0.0, 0.0, 2.1849786201644152e-07, 20817.702908009673, 20817.702908009673, 74.85999445713779}, 1});
-    CompressedTable.insert(std::array<double, 6>{393.15, 10000000.0, 0.0010549, 500180.0, 510730.0, 1519.1}, CompressedTableEntry{CompressedTableData{393.15, 10000000.0, 0.0010549, 500180.0, 510730.0, 1519.1}, CompressedTableData{0.0, 0.0, 8.199999999999982e-06, 41975.0, 42055.0, 105.10000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 20000000.0, 0.0012472, 1109000.0, 1134000.0, 2846.9}, CompressedTableEntry{CompressedTableData{533.15, 20000000.0, 0.0012472, 1109000.0, 1134000.0, 2846.9}, CompressedTableData{0.0, 0.0, 2.094999999999994e-05, 46450.0, 46900.0, 89.64999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{313.15, 30000000.0, 0.0009951, 164050.0, 193900.0, 560.6999999999999}, CompressedTableEntry{CompressedTableData{313.15, 30000000.0, 0.0009951, 164050.0, 193900.0, 560.6999999999999}, CompressedTableData{0.0, 0.0, 3.2499999999999977e-06, 40970.0, 41065.0, 127.45000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{413.15, 50000000.0, 0.0010517, 569770.0, 622360.0, 1691.6}, CompressedTableEntry{CompressedTableData{413.15, 50000000.0, 0.0010517, 569770.0, 622360.0, 1691.6}, CompressedTableData{0.0, 0.0, 8.399999999999987e-06, 41040.0, 41465.0, 98.65000000000009}, 0});
-    CompressedTable.insert(std::array<double, 6>{553.15, 20000000.0, 0.0012978, 1205600.0, 1231500.0, 3026.5}, CompressedTableEntry{CompressedTableData{553.15, 20000000.0, 0.0012978, 1205600.0, 1231500.0, 3026.5}, CompressedTableData{0.0, 0.0, 2.530000000000002e-05, 48300.0, 48750.0, 89.79999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{433.15, 15000000.0, 0.001092, 667630.0, 684010.0, 1925.8999999999999}, CompressedTableEntry{CompressedTableData{433.15, 15000000.0, 0.001092, 667630.0, 684010.0, 1925.8999999999999}, CompressedTableData{0.0, 0.0, 1.060000000000004e-05, 42470.0, 42630.0, 97.35000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{313.15, 20000000.0, 0.0009992, 165170.0, 185160.0, 564.6}, CompressedTableEntry{CompressedTableData{313.15, 20000000.0, 0.0009992, 165170.0, 185160.0, 564.6}, CompressedTableData{0.0, 0.0, 3.1500000000000495e-06, 41230.0, 41295.0, 128.09999999999997}, 0});
-    CompressedTable.insert(std::array<double, 6>{283.15000000000003, 13789514.586336726, 0.0009939155603327983, 41658.66581926852, 55358.80773303131, 149.63625290257855}, CompressedTableEntry{CompressedTableData{283.15000000000003, 13789514.586336726, 0.0009939155603327983, 41658.66581926852, 55358.80773303131, 149.63625290257855}, CompressedTableData{0.0, 0.0, 2.8092582259270707e-07, 20747.922898262157, 20747.922898262157, 74.60878642204672}, 1});
-    CompressedTable.insert(std::array<double, 6>{413.15, 20000000.0, 0.0010679, 580710.0, 602070.0, 1719.4}, CompressedTableEntry{CompressedTableData{413.15, 20000000.0, 0.0010679, 580710.0, 602070.0, 1719.4}, CompressedTableData{0.0, 0.0, 9.150000000000087e-06, 41930.0, 42114.99999999997, 100.44999999999993}, 0});
-    CompressedTable.insert(std::array<double, 6>{393.15, 30000000.0, 0.0010445, 493660.0, 525000.0, 1502.0}, CompressedTableEntry{CompressedTableData{393.15, 30000000.0, 0.0010445, 493660.0, 525000.0, 1502.0}, CompressedTableData{0.0, 0.0, 7.750000000000053e-06, 41395.0, 41630.0, 103.89999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{477.59444444444443, 34473786.465841815, 0.0011327553446541438, 847478.2183836118, 886531.7638389728, 2323.3393805455758}, CompressedTableEntry{CompressedTableData{477.59444444444443, 34473786.465841815, 0.0011327553446541438, 847478.2183836118, 886531.7638389728, 2323.3393805455758}, CompressedTableData{0.0, 0.0, 2.0819724852144173e-05, 60534.15845597221, 61243.588555072085, 124.62011940809339}, 1});
-    CompressedTable.insert(std::array<double, 6>{393.15, 5000000.0, 0.0010576, 501910.0, 507190.0, 1523.6000000000001}, CompressedTableEntry{CompressedTableData{393.15, 5000000.0, 0.0010576, 501910.0, 507190.0, 1523.6000000000001}, CompressedTableData{0.0, 0.0, 8.29999999999993e-06, 42130.0, 42170.0, 105.39999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15, 50000000.0, 0.0009767, 290.0, 49130.0, 20001.0}, CompressedTableEntry{CompressedTableData{273.15, 50000000.0, 0.0009767, 290.0, 49130.0, 20001.0}, CompressedTableData{0.0, 0.0, 1.899999999999992e-06, 40320.0, 40409.99999999999, 7999.2}, 0});
-    CompressedTable.insert(std::array<double, 6>{333.15, 15000000.0, 0.0010105, 248580.0, 263740.0, 823.4}, CompressedTableEntry{CompressedTableData{333.15, 15000000.0, 0.0010105, 248580.0, 263740.0, 823.4}, CompressedTableData{0.0, 0.0, 4.599999999999895e-06, 41415.0, 41485.0, 121.25000000000006}, 0});
-    CompressedTable.insert(std::array<double, 6>{453.15, 5000000.0, 0.001124, 759470.0, 765090.0, 2133.7999999999997}, CompressedTableEntry{CompressedTableData{453.15, 5000000.0, 0.001124, 759470.0, 765090.0, 2133.7999999999997}, CompressedTableData{0.0, 0.0, 1.2599999999999981e-05, 43460.0, 43525.0, 95.65000000000009}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15000000000003, 3447378.6465841816, 0.000998472801454857, 23.26000324917282, 3465.74048412675, 0.04186800584851107}, CompressedTableEntry{CompressedTableData{273.15000000000003, 3447378.6465841816, 0.000998472801454857, 23.26000324917282, 3465.74048412675, 0.04186800584851107}, CompressedTableData{0.0, 0.0, 1.248559211520974e-07, 20957.26292750471, 20957.26292750471, 75.36241052731992}, 1});
-    CompressedTable.insert(std::array<double, 6>{313.15, 50000000.0, 0.0009872, 161900.0, 211250.0, 552.8}, CompressedTableEntry{CompressedTableData{313.15, 50000000.0, 0.0009872, 161900.0, 211250.0, 552.8}, CompressedTableData{0.0, 0.0, 3.349999999999946e-06, 40485.0, 40650.00000000001, 126.35000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 10000000.0, 0.0012653, 1121600.0, 1134300.0, 2871.0}, CompressedTableEntry{CompressedTableData{533.15, 10000000.0, 0.0012653, 1121600.0, 1134300.0, 2871.0}, CompressedTableData{0.0, 0.0, 2.3050000000000045e-05, 47700.0, 48000.0, 91.69999999999982}, 0});
-    CompressedTable.insert(std::array<double, 6>{422.0388888888889, 20684271.87950509, 0.0010763828962538852, 617901.9863142759, 640161.8094237344, 1808.865324679072}, CompressedTableEntry{CompressedTableData{422.0388888888889, 20684271.87950509, 0.0010763828962538852, 617901.9863142759, 640161.8094237344, 1808.865324679072}, CompressedTableData{0.0, 0.0, 2.3941122880951488e-05, 116137.19622311986, 116625.65629135258, 267.01320729887937}, 1});
-    CompressedTable.insert(std::array<double, 6>{313.15, 15000000.0, 0.0010013, 165750.0, 180770.0, 566.6}, CompressedTableEntry{CompressedTableData{313.15, 15000000.0, 0.0010013, 165750.0, 180770.0, 566.6}, CompressedTableData{0.0, 0.0, 3.100000000000021e-06, 41370.0, 41420.0, 128.39999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{453.15, 15000000.0, 0.001116, 753580.0, 770320.0, 2120.6}, CompressedTableEntry{CompressedTableData{453.15, 15000000.0, 0.001116, 753580.0, 770320.0, 2120.6}, CompressedTableData{0.0, 0.0, 1.1999999999999966e-05, 42975.0, 43155.0, 94.70000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{338.7055555555556, 3447378.6465841816, 0.0010186370327209516, 273770.2382427641, 277282.49873338913, 898.5711415207445}, CompressedTableEntry{CompressedTableData{338.7055555555556, 3447378.6465841816, 0.0010186370327209516, 273770.2382427641, 277282.49873338913, 898.5711415207445}, CompressedTableData{0.0, 0.0, 6.554935860495197e-06, 57963.928096938675, 57987.18810018782, 165.10648106360338}, 1});
-    CompressedTable.insert(std::array<double, 6>{393.15, 15000000.0, 0.0010522, 498500.0, 514280.0, 1514.8}, CompressedTableEntry{CompressedTableData{393.15, 15000000.0, 0.0010522, 498500.0, 514280.0, 1514.8}, CompressedTableData{0.0, 0.0, 8.050000000000006e-06, 41825.0, 41945.0, 104.75}, 0});
-    CompressedTable.insert(std::array<double, 6>{493.15, 5000000.0, 0.0011868, 938390.0, 944320.0, 2512.7000000000003}, CompressedTableEntry{CompressedTableData{493.15, 5000000.0, 0.0011868, 938390.0, 944320.0, 2512.7000000000003}, CompressedTableData{0.0, 0.0, 1.6850000000000003e-05, 45235.0, 45320.0, 92.79999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{293.15, 10000000.0, 0.0009973, 83310.0, 93280.0, 294.3}, CompressedTableEntry{CompressedTableData{293.15, 10000000.0, 0.0009973, 83310.0, 93280.0, 294.3}, CompressedTableData{0.0, 0.0, 1.0500000000000526e-06, 41510.0, 41545.0, 137.1}, 0});
-    CompressedTable.insert(std::array<double, 6>{283.15000000000003, 20684271.87950509, 0.0009907317343434148, 41472.58579327513, 61964.64865579639, 148.79889278560833}, CompressedTableEntry{CompressedTableData{283.15000000000003, 20684271.87950509, 0.0009907317343434148, 41472.58579327513, 61964.64865579639, 148.79889278560833}, CompressedTableData{0.0, 0.0, 3.433537831687558e-07, 20619.992880391703, 20631.622882016287, 74.16917236063736}, 1});
-    CompressedTable.insert(std::array<double, 6>{633.15, 50000000.0, 0.0014848, 1556500.0, 1630700.0, 3630.1}, CompressedTableEntry{CompressedTableData{633.15, 50000000.0, 0.0014848, 1556500.0, 1630700.0, 3630.1}, CompressedTableData{0.0, 0.0, 3.9950000000000077e-05, 51800.0, 53800.0, 86.29999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{293.15, 5000000.0, 0.0009996, 83610.0, 88610.0, 295.4}, CompressedTableEntry{CompressedTableData{293.15, 5000000.0, 0.0009996, 83610.0, 88610.0, 295.4}, CompressedTableData{0.0, 0.0, 9.49999999999996e-07, 41655.0, 41670.0, 137.55}, 0});
-    CompressedTable.insert(std::array<double, 6>{615.31, 15000000.0, 0.0016572, 1585500.0, 1610300.0, 3684.8}, CompressedTableEntry{CompressedTableData{615.31, 15000000.0, 0.0016572, 1585500.0, 1610300.0, 3684.8}, CompressedTableData{0.0, 0.0, 0.0001296, 128050.0, 133500.0, 218.0}, 0});
-    CompressedTable.insert(std::array<double, 6>{477.59444444444443, 10342135.939752545, 0.0011546675588163704, 863806.740664531, 875762.3823346058, 2358.550373464174}, CompressedTableEntry{CompressedTableData{477.59444444444443, 10342135.939752545, 0.0011546675588163704, 863806.740664531, 875762.3823346058, 2358.550373464174}, CompressedTableData{0.0, 0.0, 1.9664807581485483e-05, 61010.9885225803, 61220.328551822866, 128.5138439520049}, 1});
-    CompressedTable.insert(std::array<double, 6>{393.15, 20000000.0, 0.0010496, 496850.0, 517840.00000000006, 1510.5}, CompressedTableEntry{CompressedTableData{393.15, 20000000.0, 0.0010496, 496850.0, 517840.00000000006, 1510.5}, CompressedTableData{0.0, 0.0, 7.94999999999995e-06, 41675.0, 41835.00000000003, 104.45000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{505.37222222222226, 10342135.939752545, 0.0012030492282628826, 989643.358242556, 1002087.4599808634, 2615.5780613681836}, CompressedTableEntry{CompressedTableData{505.37222222222226, 10342135.939752545, 0.0012030492282628826, 989643.358242556, 1002087.4599808634, 2615.5780613681836}, CompressedTableData{0.0, 0.0, 2.4190834723256116e-05, 62918.30878901249, 63162.538823128794, 127.2368697736249}, 1});
-    CompressedTable.insert(std::array<double, 6>{505.37222222222226, 3447378.6465841816, 0.0012126631341916089, 996551.5792075603, 1000738.3797924113, 2629.394503298192}, CompressedTableEntry{CompressedTableData{505.37222222222226, 3447378.6465841816, 0.0012126631341916089, 996551.5792075603, 1000738.3797924113, 2629.394503298192}, CompressedTableData{0.0, 0.0, 2.5470607915067012e-05, 63767.29890760727, 63860.33892060397, 129.93735615085416}, 1});
-    CompressedTable.insert(std::array<double, 6>{505.37222222222226, 34473786.465841815, 0.0011743947943584322, 968546.5352955562, 1009018.940949117, 2572.5796193617625}, CompressedTableEntry{CompressedTableData{505.37222222222226, 34473786.465841815, 0.0011743947943584322, 968546.5352955562, 1009018.940949117, 2572.5796193617625}, CompressedTableData{0.0, 0.0, 2.0819724852144173e-05, 60534.15845597221, 61243.588555072085, 121.60562298700052}, 1});
-    CompressedTable.insert(std::array<double, 6>{333.15, 30000000.0, 0.0010042, 246140.0, 276260.0, 815.6}, CompressedTableEntry{CompressedTableData{333.15, 30000000.0, 0.0010042, 246140.0, 276260.0, 815.6}, CompressedTableData{0.0, 0.0, 4.549999999999975e-06, 41045.0, 41180.0, 120.40000000000003}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15, 30000000.0, 0.0009857, 290.0, 29860.0, 0.3}, CompressedTableEntry{CompressedTableData{273.15, 30000000.0, 0.0009857, 290.0, 29860.0, 0.3}, CompressedTableData{0.0, 0.0, 1.4500000000000624e-06, 40910.0, 40955.0, 144.7}, 0});
-    CompressedTable.insert(std::array<double, 6>{433.15, 5000000.0, 0.0010988, 672550.0, 678040.0, 1937.4}, CompressedTableEntry{CompressedTableData{433.15, 5000000.0, 0.0010988, 672550.0, 678040.0, 1937.4}, CompressedTableData{0.0, 0.0, 1.0950000000000022e-05, 42875.0, 42930.0, 98.19999999999982}, 0});
-    CompressedTable.insert(std::array<double, 6>{588.7055555555556, 13789514.586336726, 0.0014556327567539636, 1409021.2168251418, 1429094.599629178, 3387.037937132848}, CompressedTableEntry{CompressedTableData{588.7055555555556, 13789514.586336726, 0.0014556327567539636, 1409021.2168251418, 1429094.599629178, 3387.037937132848}, CompressedTableData{0.0, 0.0, 4.9255660894578e-05, 62290.28870128479, 62964.82879551081, 108.98241922367424}, 1});
-    CompressedTable.insert(std::array<double, 6>{613.15, 15000000.0, 0.0016311, 1567900.0, 1592400.0, 3655.5}, CompressedTableEntry{CompressedTableData{613.15, 15000000.0, 0.0016311, 1567900.0, 1592400.0, 3655.5}, CompressedTableData{0.0, 0.0, 7.889999999999991e-05, 68000.0, 69200.0, 114.60000000000014}, 0});
-    CompressedTable.insert(std::array<double, 6>{310.9277777777778, 20684271.87950509, 0.0009980982336913998, 155935.0617824546, 176566.68466447087, 534.9056427205775}, CompressedTableEntry{CompressedTableData{310.9277777777778, 20684271.87950509, 0.0009980982336913998, 155935.0617824546, 176566.68466447087, 534.9056427205775}, CompressedTableData{0.0, 0.0, 3.6832496739925115e-06, 57231.23799458974, 57301.01800433724, 193.05337496748456}, 1});
-    CompressedTable.insert(std::array<double, 6>{273.15, 15000000.0, 0.0009928, 180.0, 15070.0, 0.4}, CompressedTableEntry{CompressedTableData{273.15, 15000000.0, 0.0009928, 180.0, 15070.0, 0.4}, CompressedTableData{0.0, 0.0, 1.1500000000000008e-06, 41415.0, 41430.0, 146.4}, 0});
-    CompressedTable.insert(std::array<double, 6>{653.15, 30000000.0, 0.0018729, 1782000.0, 1838200.0, 4002.6000000000004}, CompressedTableEntry{CompressedTableData{653.15, 30000000.0, 0.0018729, 1782000.0, 1838200.0, 4002.6000000000004}, CompressedTableData{0.0, 0.0, 0.00012264999999999997, 77600.0, 81300.0, 126.35000000000036}, 0});
-    CompressedTable.insert(std::array<double, 6>{310.9277777777778, 34473786.465841815, 0.0009924172892789708, 154469.68157775668, 188685.14635728992, 529.714009995362}, CompressedTableEntry{CompressedTableData{310.9277777777778, 34473786.465841815, 0.0009924172892789708, 154469.68157775668, 188685.14635728992, 529.714009995362}, CompressedTableData{0.0, 0.0, 3.870533555720983e-06, 56707.88792148333, 56835.817939353794, 191.48332474816533}, 1});
-    CompressedTable.insert(std::array<double, 6>{293.15, 20000000.0, 0.0009929, 82710.0, 102570.0, 292.1}, CompressedTableEntry{CompressedTableData{293.15, 20000000.0, 0.0009929, 82710.0, 102570.0, 292.1}, CompressedTableData{0.0, 0.0, 1.249999999999949e-06, 41230.0, 41270.0, 136.25}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 50000000.0, 0.0012044, 1078200.0, 1138400.0, 2786.4}, CompressedTableEntry{CompressedTableData{533.15, 50000000.0, 0.0012044, 1078200.0, 1138400.0, 2786.4}, CompressedTableData{0.0, 0.0, 1.6799999999999975e-05, 43825.0, 44650.0, 84.14999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 13789514.586336726, 0.0012581731174516181, 1116666.2359862886, 1134018.1984101715, 2861.510727722337}, CompressedTableEntry{CompressedTableData{533.15, 13789514.586336726, 0.0012581731174516181, 1116666.2359862886, 1134018.1984101715, 2861.510727722337}, CompressedTableData{0.0, 0.0, 2.9809351175108956e-05, 65151.269100933045, 65569.94915941812, 126.27390563910922}, 1});
-    CompressedTable.insert(std::array<double, 6>{394.2611111111111, 3447378.6465841816, 0.0010595273468983262, 507161.1108449641, 510812.9313550843, 1536.8907586871442}, CompressedTableEntry{CompressedTableData{394.2611111111111, 3447378.6465841816, 0.0010595273468983262, 507161.1108449641, 510812.9313550843, 1536.8907586871442}, CompressedTableData{0.0, 0.0, 1.1393102805146399e-05, 58545.42817816799, 58580.31818304173, 145.13544227386365}, 1});
-    CompressedTable.insert(std::array<double, 6>{413.15, 15000000.0, 0.0010708, 582690.0, 598750.0, 1724.3}, CompressedTableEntry{CompressedTableData{413.15, 15000000.0, 0.0010708, 582690.0, 598750.0, 1724.3}, CompressedTableData{0.0, 0.0, 9.299999999999955e-06, 42095.0, 42235.0, 100.79999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 20684271.87950509, 0.0012460620930998462, 1108222.854806839, 1133994.9384069224, 2845.265941453115}, CompressedTableEntry{CompressedTableData{533.15, 20684271.87950509, 0.0012460620930998462, 1108222.854806839, 1133994.9384069224, 2845.265941453115}, CompressedTableData{0.0, 0.0, 2.8030154298688912e-05, 64069.67894984654, 64651.17903107585, 124.51544939347195}, 1});
-    CompressedTable.insert(std::array<double, 6>{366.48333333333335, 20684271.87950509, 0.0010285006504919822, 385627.5938680362, 406910.49684102926, 1216.391173916792}, CompressedTableEntry{CompressedTableData{366.48333333333335, 20684271.87950509, 0.0010285006504919822, 385627.5938680362, 406910.49684102926, 1216.391173916792}, CompressedTableData{0.0, 0.0, 1.5201208400291225e-05, 114846.26604279078, 115171.9060882792, 296.23707538114}, 1});
-    CompressedTable.insert(std::array<double, 6>{477.59444444444443, 13789514.586336726, 0.0011512964489452588, 861317.9203168695, 877181.2425328053, 2353.1912687155645}, CompressedTableEntry{CompressedTableData{477.59444444444443, 13789514.586336726, 0.0011512964489452588, 861317.9203168695, 877181.2425328053, 2353.1912687155645}, CompressedTableData{0.0, 0.0, 2.3628983078070702e-05, 62522.88873377652, 62848.528779265005, 127.88582386427697}, 1});
-    CompressedTable.insert(std::array<double, 6>{473.15, 50000000.0, 0.0011149, 819450.0, 875190.0, 2262.7999999999997}, CompressedTableEntry{CompressedTableData{473.15, 50000000.0, 0.0011149, 819450.0, 875190.0, 2262.7999999999997}, CompressedTableData{0.0, 0.0, 1.1750000000000042e-05, 41980.0, 42565.0, 89.29999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{573.15, 20000000.0, 0.0013611, 1307200.0, 1334400.0, 3209.1}, CompressedTableEntry{CompressedTableData{573.15, 20000000.0, 0.0013611, 1307200.0, 1334400.0, 3209.1}, CompressedTableData{0.0, 0.0, 3.165000000000004e-05, 50800.0, 51450.0, 91.29999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{353.15, 10000000.0, 0.0010244, 332690.0, 342940.0, 1069.1}, CompressedTableEntry{CompressedTableData{353.15, 10000000.0, 0.0010244, 332690.0, 342940.0, 1069.1}, CompressedTableData{0.0, 0.0, 5.8499999999999525e-06, 41630.0, 41695.0, 115.25000000000011}, 0});
-    CompressedTable.insert(std::array<double, 6>{449.8166666666667, 10342135.939752545, 0.0011153379436533994, 741784.7636193704, 753321.7252309601, 2094.446992571766}, CompressedTableEntry{CompressedTableData{449.8166666666667, 10342135.939752545, 0.0011153379436533994, 741784.7636193704, 753321.7252309601, 2094.446992571766}, CompressedTableData{0.0, 0.0, 1.626248373008568e-05, 59708.42834062665, 59871.24836337083, 132.05169044620402}, 1});
-    CompressedTable.insert(std::array<double, 6>{273.15000000000003, 6894757.293168363, 0.0009967248185587248, 69.78000974751845, 6954.740971502673, 0.20934002924255535}, CompressedTableEntry{CompressedTableData{273.15000000000003, 6894757.293168363, 0.0009967248185587248, 69.78000974751845, 6954.740971502673, 0.20934002924255535}, CompressedTableData{0.0, 0.0, 1.8728388172836296e-07, 20887.48291775719, 20887.482917757192, 75.11120249222884}, 1});
-    CompressedTable.insert(std::array<double, 6>{493.15, 10000000.0, 0.0011809, 934010.0, 945820.0, 2503.7}, CompressedTableEntry{CompressedTableData{493.15, 10000000.0, 0.0011809, 934010.0, 945820.0, 2503.7}, CompressedTableData{0.0, 0.0, 1.6349999999999937e-05, 44845.0, 45010.0, 91.95000000000027}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15000000000003, 10342135.939752545, 0.0009950392636231687, 116.3000162458641, 10420.481455629424, 0.33494404678808853}, CompressedTableEntry{CompressedTableData{273.15000000000003, 10342135.939752545, 0.0009950392636231687, 116.3000162458641, 10420.481455629424, 0.33494404678808853}, CompressedTableData{0.0, 0.0, 2.1849786201644152e-07, 20817.702908009673, 20817.702908009673, 74.85999445713779}, 1});
-    CompressedTable.insert(std::array<double, 6>{422.0388888888889, 3447378.6465841816, 0.0010873077893547105, 625508.0073767555, 629252.8678998722, 1827.1616432348715}, CompressedTableEntry{CompressedTableData{422.0388888888889, 3447378.6465841816, 0.0010873077893547105, 625508.0073767555, 629252.8678998722, 1827.1616432348715}, CompressedTableData{0.0, 0.0, 1.3890221228192142e-05, 59173.448265895684, 59219.96827239398, 138.14348529716221}, 1});
-    CompressedTable.insert(std::array<double, 6>{566.4833333333333, 13789514.586336726, 0.0013571214349648076, 1284440.6394225722, 1303164.9420381563, 3169.0730986854996}, CompressedTableEntry{CompressedTableData{566.4833333333333, 13789514.586336726, 0.0013571214349648076, 1284440.6394225722, 1303164.9420381563, 3169.0730986854996}, CompressedTableData{0.0, 0.0, 4.9255660894578e-05, 62290.28870128479, 62964.82879551081, 108.98241922367424}, 1});
-    CompressedTable.insert(std::array<double, 6>{283.15000000000003, 6894757.293168363, 0.0009970993863221815, 41844.745845261896, 48729.70680701706, 150.43174501370024}, CompressedTableEntry{CompressedTableData{283.15000000000003, 6894757.293168363, 0.0009970993863221815, 41844.745845261896, 48729.70680701706, 150.43174501370024}, CompressedTableData{0.0, 0.0, 1.8728388172836296e-07, 20887.48291775719, 20887.482917757192, 75.11120249222884}, 1});
-    CompressedTable.insert(std::array<double, 6>{493.15, 15000000.0, 0.0011752, 929810.0, 947430.0, 2495.1}, CompressedTableEntry{CompressedTableData{493.15, 15000000.0, 0.0011752, 929810.0, 947430.0, 2495.1}, CompressedTableData{0.0, 0.0, 1.584999999999998e-05, 44485.0, 44715.0, 91.15000000000009}, 0});
-    CompressedTable.insert(std::array<double, 6>{560.9277777777778, 10342135.939752545, 0.0013481318086418427, 1261855.1762676255, 1275811.178217129, 3128.8379450650805}, CompressedTableEntry{CompressedTableData{560.9277777777778, 10342135.939752545, 0.0013481318086418427, 1261855.1762676255, 1275811.178217129, 3128.8379450650805}, CompressedTableData{0.0, 0.0, 4.173309164515269e-05, 70349.87982712325, 70791.81988885743, 129.39307207482352}, 1});
-    CompressedTable.insert(std::array<double, 6>{310.9277777777778, 10342135.939752545, 0.0010025306188923063, 157074.80194166405, 167425.50338754596, 538.7993672644889}, CompressedTableEntry{CompressedTableData{310.9277777777778, 10342135.939752545, 0.0010025306188923063, 157074.80194166405, 167425.50338754596, 538.7993672644889}, CompressedTableData{0.0, 0.0, 3.5271797725523356e-06, 57661.54805469942, 57684.8080579486, 177.939024856172}, 1});
-    CompressedTable.insert(std::array<double, 6>{422.0388888888889, 13789514.586336726, 0.001080627997573063, 620856.006726921, 635765.6688096406, 1816.066621685016}, CompressedTableEntry{CompressedTableData{422.0388888888889, 13789514.586336726, 0.001080627997573063, 620856.006726921, 635765.6688096406, 1816.066621685016}, CompressedTableData{0.0, 0.0, 2.4440546565560636e-05, 116741.95630759842, 117079.22635471134, 268.56232351527433}, 1});
-    CompressedTable.insert(std::array<double, 6>{453.15, 30000000.0, 0.0011049, 745400.0, 778550.0, 2102.0}, CompressedTableEntry{CompressedTableData{453.15, 30000000.0, 0.0011049, 745400.0, 778550.0, 2102.0}, CompressedTableData{0.0, 0.0, 1.1300000000000004e-05, 42330.0, 42670.0, 93.40000000000009}, 0});
-    CompressedTable.insert(std::array<double, 6>{588.7055555555556, 34473786.465841815, 0.001369856738922341, 1359361.1098881578, 1406578.9164839787, 3299.3244648802174}, CompressedTableEntry{CompressedTableData{588.7055555555556, 34473786.465841815, 0.001369856738922341, 1359361.1098881578, 1406578.9164839787, 3299.3244648802174}, CompressedTableData{0.0, 0.0, 3.3742312691406205e-05, 55056.427690792014, 56219.42785325076, 97.32217959486388}, 1});
-    CompressedTable.insert(std::array<double, 6>{641.7111111111111, 20684271.87950509, 0.0021434640263819247, 1822165.3945369495, 1866498.960729873, 4074.6361971829456}, CompressedTableEntry{CompressedTableData{641.7111111111111, 20684271.87950509, 0.0021434640263819247, 1822165.3945369495, 1866498.960729873, 4074.6361971829456}, CompressedTableData{0.0, 0.0, 0.00034391563481398055, 206572.08885590383, 218702.18055034755, 343.7991300250487}, 1});
-    CompressedTable.insert(std::array<double, 6>{493.15, 20000000.0, 0.0011697, 925770.0, 949160.0, 2486.7}, CompressedTableEntry{CompressedTableData{493.15, 20000000.0, 0.0011697, 925770.0, 949160.0, 2486.7}, CompressedTableData{0.0, 0.0, 1.535000000000002e-05, 44140.0, 44445.0, 90.45000000000027}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 34473786.465841815, 0.001224836586503957, 1093080.5926916273, 1135320.7585921253, 2815.7908653357636}, CompressedTableEntry{CompressedTableData{533.15, 34473786.465841815, 0.001224836586503957, 1093080.5926916273, 1135320.7585921253, 2815.7908653357636}, CompressedTableData{0.0, 0.0, 2.5220896072762383e-05, 62267.028698035574, 63150.908821504156, 121.60562298700052}, 1});
-    CompressedTable.insert(std::array<double, 6>{493.15, 30000000.0, 0.0011595, 918150.0, 952930.0, 2470.7}, CompressedTableEntry{CompressedTableData{493.15, 30000000.0, 0.0011595, 918150.0, 952930.0, 2470.7}, CompressedTableData{0.0, 0.0, 1.4550000000000001e-05, 43520.0, 43955.0, 89.20000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 1041303.8254589688, 1045560.4060535673, 2717.2335795683684}, CompressedTableEntry{CompressedTableData{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 1041303.8254589688, 1045560.4060535673, 2717.2335795683684}, CompressedTableData{0.0, 0.0, 0.00011723970996199945, 520640.2827278598, 521047.3327847203, 1358.59585578126}, 1});
-    CompressedTable.insert(std::array<double, 6>{373.15, 15000000.0, 0.0010361, 414850.0, 430390.0, 1295.8}, CompressedTableEntry{CompressedTableData{373.15, 15000000.0, 0.0010361, 414850.0, 430390.0, 1295.8}, CompressedTableData{0.0, 0.0, 7.000000000000062e-06, 41630.0, 41735.0, 109.5}, 0});
-    CompressedTable.insert(std::array<double, 6>{413.15, 30000000.0, 0.0010623, 576900.0, 608760.0, 1709.8}, CompressedTableEntry{CompressedTableData{413.15, 30000000.0, 0.0010623, 576900.0, 608760.0, 1709.8}, CompressedTableData{0.0, 0.0, 8.899999999999945e-06, 41620.0, 41880.0, 99.80000000000007}, 0});
-    CompressedTable.insert(std::array<double, 6>{333.15, 5000000.0, 0.0010149, 250290.0, 255360.0, 828.7}, CompressedTableEntry{CompressedTableData{333.15, 5000000.0, 0.0010149, 250290.0, 255360.0, 828.7}, CompressedTableData{0.0, 0.0, 4.600000000000003e-06, 41685.0, 41705.0, 121.79999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{537.0899999999999, 5000000.0, 0.0012862, 1148100.0, 1154500.0, 2920.7000000000003}, CompressedTableEntry{CompressedTableData{537.0899999999999, 5000000.0, 0.0012862, 1148100.0, 1154500.0, 2920.7000000000003}, CompressedTableData{0.0, 0.0, 0.00014424999999999996, 574030.0, 574735.0, 1460.3000000000002}, 0});
-    CompressedTable.insert(std::array<double, 6>{505.37222222222226, 13789514.586336726, 0.0011985544151014002, 986363.6977844225, 1002878.3000913353, 2608.9629164441185}, CompressedTableEntry{CompressedTableData{505.37222222222226, 13789514.586336726, 0.0011985544151014002, 986363.6977844225, 1002878.3000913353, 2608.9629164441185}, CompressedTableData{0.0, 0.0, 2.3628983078070702e-05, 62522.88873377652, 62848.528779265005, 126.27390563910922}, 1});
-    CompressedTable.insert(std::array<double, 6>{293.15, 30000000.0, 0.0009886, 82110.0, 111770.0, 289.7}, CompressedTableEntry{CompressedTableData{293.15, 30000000.0, 0.0009886, 82110.0, 111770.0, 289.7}, CompressedTableData{0.0, 0.0, 1.4500000000000624e-06, 40910.0, 40955.0, 135.49999999999997}, 0});
-    CompressedTable.insert(std::array<double, 6>{422.0388888888889, 10342135.939752545, 0.001082812976193228, 622367.9069381171, 633579.2285042184, 1819.7091381938365}, CompressedTableEntry{CompressedTableData{422.0388888888889, 10342135.939752545, 0.001082812976193228, 622367.9069381171, 633579.2285042184, 1819.7091381938365}, CompressedTableData{0.0, 0.0, 1.3546867445023386e-05, 58812.918215533486, 58964.10823665309, 137.36892718896468}, 1});
-    CompressedTable.insert(std::array<double, 6>{273.15000000000003, 34473786.465841815, 0.0009836149468377344, 302.3800422392467, 34215.46477953322, 0.08373601169702213}, CompressedTableEntry{CompressedTableData{273.15000000000003, 34473786.465841815, 0.0009836149468377344, 302.3800422392467, 34215.46477953322, 0.08373601169702213}, CompressedTableData{0.0, 0.0, 5.306376648972272e-07, 20375.76284627539, 20399.022849524557, 73.33181224366713}, 1});
-    CompressedTable.insert(std::array<double, 6>{613.15, 50000000.0, 0.0014049, 1452900.0, 1523100.0, 3457.5}, CompressedTableEntry{CompressedTableData{613.15, 50000000.0, 0.0014049, 1452900.0, 1523100.0, 3457.5}, CompressedTableData{0.0, 0.0, 3.200000000000002e-05, 49300.0, 50850.0, 84.34999999999991}, 0});
-    CompressedTable.insert(std::array<double, 6>{338.7055555555556, 6894757.293168363, 0.0010170763337065479, 273118.9581517872, 280120.2191297883, 896.6452132517129}, CompressedTableEntry{CompressedTableData{338.7055555555556, 6894757.293168363, 0.0010170763337065479, 273118.9581517872, 280120.2191297883, 896.6452132517129}, CompressedTableData{0.0, 0.0, 6.523721880207119e-06, 57835.99807906822, 57870.88808394199, 164.8134050226638}, 1});
-    CompressedTable.insert(std::array<double, 6>{310.9277777777778, 6894757.293168363, 0.0010040288899461336, 157446.9619936508, 164378.4429619043, 540.0554074399442}, CompressedTableEntry{CompressedTableData{310.9277777777778, 6894757.293168363, 0.0010040288899461336, 157446.9619936508, 164378.4429619043, 540.0554074399442}, CompressedTableData{0.0, 0.0, 3.46475181197607e-06, 57801.108074194446, 57824.36807744362, 178.29490290588433}, 1});
-    CompressedTable.insert(std::array<double, 6>{366.48333333333335, 10342135.939752545, 0.0010333700314169214, 388255.97423519264, 398955.5757298122, 1223.75994294613}, CompressedTableEntry{CompressedTableData{366.48333333333335, 10342135.939752545, 0.0010333700314169214, 388255.97423519264, 398955.5757298122, 1223.75994294613}, CompressedTableData{0.0, 0.0, 8.927198362388626e-06, 57894.14808719113, 57987.188100187836, 153.4671754377173}, 1});
-    CompressedTable.insert(std::array<double, 6>{353.15, 15000000.0, 0.0010221, 331590.0, 346920.0, 1065.9}, CompressedTableEntry{CompressedTableData{353.15, 15000000.0, 0.0010221, 331590.0, 346920.0, 1065.9}, CompressedTableData{0.0, 0.0, 5.8000000000000326e-06, 41505.0, 41590.0, 114.94999999999993}, 0});
-    CompressedTable.insert(std::array<double, 6>{653.15, 50000000.0, 0.0015884, 1667100.0, 1746500.0, 3810.2}, CompressedTableEntry{CompressedTableData{653.15, 50000000.0, 0.0015884, 1667100.0, 1746500.0, 3810.2}, CompressedTableData{0.0, 0.0, 5.179999999999996e-05, 55300.0, 57900.0, 90.04999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15, 10000000.0, 0.0009952, 120.0, 10070.0, 0.3}, CompressedTableEntry{CompressedTableData{273.15, 10000000.0, 0.0009952, 120.0, 10070.0, 0.3}, CompressedTableData{0.0, 0.0, 1.0500000000000526e-06, 41595.0, 41605.0, 147.0}, 0});
-    CompressedTable.insert(std::array<double, 6>{394.2611111111111, 10342135.939752545, 0.0010557192413031813, 504742.07050705014, 515651.0120309122, 1530.6942938215645}, CompressedTableEntry{CompressedTableData{394.2611111111111, 10342135.939752545, 0.0010557192413031813, 504742.07050705014, 515651.0120309122, 1530.6942938215645}, CompressedTableData{0.0, 0.0, 1.1174604943129957e-05, 58243.04813592875, 58347.718150550005, 144.50742218613595}, 1});
-    CompressedTable.insert(std::array<double, 6>{353.15, 50000000.0, 0.0010072, 324420.0, 374780.0, 1044.2}, CompressedTableEntry{CompressedTableData{353.15, 50000000.0, 0.0010072, 324420.0, 374780.0, 1044.2}, CompressedTableData{0.0, 0.0, 5.499999999999971e-06, 40670.0, 40950.0, 113.14999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{473.15, 30000000.0, 0.0011304, 831110.0, 865020.0, 2288.8}, CompressedTableEntry{CompressedTableData{473.15, 30000000.0, 0.0011304, 831110.0, 865020.0, 2288.8}, CompressedTableData{0.0, 0.0, 1.2749999999999958e-05, 42855.0, 43235.0, 90.94999999999982}, 0});
-    CompressedTable.insert(std::array<double, 6>{584.15, 10000000.0, 0.0014522, 1393300.0, 1407900.0, 3360.3}, CompressedTableEntry{CompressedTableData{584.15, 10000000.0, 0.0014522, 1393300.0, 1407900.0, 3360.3}, CompressedTableData{0.0, 0.0, 8.835000000000006e-05, 132400.0, 136500.0, 238.10000000000014}, 0});
-    CompressedTable.insert(std::array<double, 6>{273.15, 5000000.0, 0.0009977, 40.0, 5030.0, 0.1}, CompressedTableEntry{CompressedTableData{273.15, 5000000.0, 0.0009977, 40.0, 5030.0, 0.1}, CompressedTableData{0.0, 0.0, 9.49999999999996e-07, 41785.0, 41790.0, 147.64999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{513.15, 10000000.0, 0.0012192, 1026200.0, 1038300.0, 2687.6000000000004}, CompressedTableEntry{CompressedTableData{513.15, 10000000.0, 0.0012192, 1026200.0, 1038300.0, 2687.6000000000004}, CompressedTableData{0.0, 0.0, 1.9150000000000005e-05, 46095.0, 46240.0, 91.69999999999982}, 0});
-    CompressedTable.insert(std::array<double, 6>{422.0388888888889, 34473786.465841815, 0.0010682672613789863, 612296.3255312253, 649116.9106746658, 1795.0488827490635}, CompressedTableEntry{CompressedTableData{422.0388888888889, 34473786.465841815, 0.0010682672613789863, 612296.3255312253, 649116.9106746658, 1795.0488827490635}, CompressedTableData{0.0, 0.0, 2.300470347230924e-05, 114997.45606391042, 115788.2961743823, 264.1452488982561}, 1});
-    CompressedTable.insert(std::array<double, 6>{453.15, 50000000.0, 0.0010914, 735490.0, 790060.0, 2079.0}, CompressedTableEntry{CompressedTableData{453.15, 50000000.0, 0.0010914, 735490.0, 790060.0, 2079.0}, CompressedTableData{0.0, 0.0, 1.0499999999999984e-05, 41580.0, 42105.0, 91.89999999999986}, 0});
-    CompressedTable.insert(std::array<double, 6>{433.15, 50000000.0, 0.0010704, 652330.0, 705850.0, 1888.9}, CompressedTableEntry{CompressedTableData{433.15, 50000000.0, 0.0010704, 652330.0, 705850.0, 1888.9}, CompressedTableData{0.0, 0.0, 9.349999999999983e-06, 41280.0, 41745.0, 95.04999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{366.48333333333335, 6894757.293168363, 0.0010350555863524776, 389163.11436191044, 396303.93535940646, 1226.2720232970405}, CompressedTableEntry{CompressedTableData{366.48333333333335, 6894757.293168363, 0.0010350555863524776, 389163.11436191044, 396303.93535940646, 1226.2720232970405}, CompressedTableData{0.0, 0.0, 8.989626322964892e-06, 58022.078105061606, 58091.85811480909, 153.76025147865698}, 1});
-    CompressedTable.insert(std::array<double, 6>{573.15, 50000000.0, 0.0012879, 1259600.0, 1324000.0, 3121.7999999999997}, CompressedTableEntry{CompressedTableData{573.15, 50000000.0, 0.0012879, 1259600.0, 1324000.0, 3121.7999999999997}, CompressedTableData{0.0, 0.0, 2.245000000000003e-05, 45950.0, 47050.0, 83.50000000000023}, 0});
-    CompressedTable.insert(std::array<double, 6>{353.15, 5000000.0, 0.0010267, 333820.0, 338960.0, 1072.3}, CompressedTableEntry{CompressedTableData{353.15, 5000000.0, 0.0010267, 333820.0, 338960.0, 1072.3}, CompressedTableData{0.0, 0.0, 5.899999999999981e-06, 41765.0, 41800.0, 115.54999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{477.59444444444443, 3447378.6465841816, 0.0011617219183614749, 869016.9813923457, 873017.7019512034, 2369.5197909964836}, CompressedTableEntry{CompressedTableData{477.59444444444443, 3447378.6465841816, 0.0011617219183614749, 869016.9813923457, 873017.7019512034, 2369.5197909964836}, CompressedTableData{0.0, 0.0, 2.044515708868734e-05, 61604.118605434254, 61673.89861518174, 129.93735615085416}, 1});
-    CompressedTable.insert(std::array<double, 6>{638.9, 20000000.0, 0.0020378, 1785800.0, 1826600.0, 4014.6}, CompressedTableEntry{CompressedTableData{638.9, 20000000.0, 0.0020378, 1785800.0, 1826600.0, 4014.6}, CompressedTableData{0.0, 0.0, 0.00020335000000000015, 108950.0, 117100.0, 179.54999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{433.15, 20000000.0, 0.0010886, 665280.0, 687050.0, 1920.3}, CompressedTableEntry{CompressedTableData{433.15, 20000000.0, 0.0010886, 665280.0, 687050.0, 1920.3}, CompressedTableData{0.0, 0.0, 1.03499999999999e-05, 42285.0, 42490.0, 97.00000000000011}, 0});
-    CompressedTable.insert(std::array<double, 6>{593.15, 20000000.0, 0.001445, 1416600.0, 1445500.0, 3399.6}, CompressedTableEntry{CompressedTableData{593.15, 20000000.0, 0.001445, 1416600.0, 1445500.0, 3399.6}, CompressedTableData{0.0, 0.0, 4.195000000000002e-05, 54700.0, 55550.0, 95.25}, 0});
-    CompressedTable.insert(std::array<double, 6>{593.15, 30000000.0, 0.0014014, 1391700.0, 1433700.0, 3355.7999999999997}, CompressedTableEntry{CompressedTableData{593.15, 30000000.0, 0.0014014, 1391700.0, 1433700.0, 3355.7999999999997}, CompressedTableData{0.0, 0.0, 3.4599999999999974e-05, 51400.0, 52400.0, 89.84999999999991}, 0});
-    CompressedTable.insert(std::array<double, 6>{393.15, 50000000.0, 0.0010349, 487690.0, 539430.0, 1485.9}, CompressedTableEntry{CompressedTableData{393.15, 50000000.0, 0.0010349, 487690.0, 539430.0, 1485.9}, CompressedTableData{0.0, 0.0, 7.4000000000000715e-06, 40875.0, 41245.0, 102.84999999999991}, 0});
-    CompressedTable.insert(std::array<double, 6>{633.15, 34473786.465841815, 0.001583547647974484, 1606498.644410619, 1661089.8720364277, 3715.5761790261145}, CompressedTableEntry{CompressedTableData{633.15, 34473786.465841815, 0.001583547647974484, 1606498.644410619, 1661089.8720364277, 3715.5761790261145}, CompressedTableData{0.0, 0.0, 4.404292618646996e-05, 36180.93505408836, 37704.4652669091, 59.012954243476315}, 1});
-    CompressedTable.insert(std::array<double, 6>{513.15, 30000000.0, 0.0011927, 1006900.0, 1042700.0, 2649.1}, CompressedTableEntry{CompressedTableData{513.15, 30000000.0, 0.0011927, 1006900.0, 1042700.0, 2649.1}, CompressedTableData{0.0, 0.0, 1.6600000000000078e-05, 44375.0, 44885.0, 87.95000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{373.15, 30000000.0, 0.001029, 410870.0, 441740.0, 1284.7}, CompressedTableEntry{CompressedTableData{373.15, 30000000.0, 0.001029, 410870.0, 441740.0, 1284.7}, CompressedTableData{0.0, 0.0, 6.7500000000000285e-06, 41235.0, 41440.0, 108.64999999999998}, 0});
-    CompressedTable.insert(std::array<double, 6>{394.2611111111111, 6894757.293168363, 0.0010575920801204658, 505928.330672758, 513231.97169299825, 1533.7925262543545}, CompressedTableEntry{CompressedTableData{394.2611111111111, 6894757.293168363, 0.0010575920801204658, 505928.330672758, 513231.97169299825, 1533.7925262543545}, CompressedTableData{0.0, 0.0, 1.1268246883994085e-05, 58382.608155423775, 58464.0181667959, 144.80049822707554}, 1});
-    CompressedTable.insert(std::array<double, 6>{373.15, 20000000.0, 0.0010337, 413500.0, 434170.0, 1292.0}, CompressedTableEntry{CompressedTableData{373.15, 20000000.0, 0.0010337, 413500.0, 434170.0, 1292.0}, CompressedTableData{0.0, 0.0, 6.900000000000005e-06, 41500.0, 41635.0, 109.25}, 0});
-    CompressedTable.insert(std::array<double, 6>{533.15, 30000000.0, 0.0012314, 1097800.0, 1134700.0, 2825.0}, CompressedTableEntry{CompressedTableData{533.15, 30000000.0, 0.0012314, 1097800.0, 1134700.0, 2825.0}, CompressedTableData{0.0, 0.0, 1.93499999999999e-05, 45450.0, 46000.0, 87.55000000000018}, 0});
-    CompressedTable.insert(std::array<double, 6>{283.15000000000003, 34473786.465841815, 0.0009846762221675288, 41053.90573479002, 75013.51047858234, 146.7473604990313}, CompressedTableEntry{CompressedTableData{283.15000000000003, 34473786.465841815, 0.0009846762221675288, 41053.90573479002, 75013.51047858234, 146.7473604990313}, CompressedTableData{0.0, 0.0, 5.306376648972272e-07, 20375.76284627539, 20399.022849524557, 73.33181224366713}, 1});
-    CompressedTable.insert(std::array<double, 6>{373.15, 5000000.0, 0.001041, 417650.0, 422850.0, 1303.3999999999999}, CompressedTableEntry{CompressedTableData{373.15, 5000000.0, 0.001041, 417650.0, 422850.0, 1303.3999999999999}, CompressedTableData{0.0, 0.0, 7.150000000000038e-06, 41915.0, 41945.0, 110.10000000000014}, 0});
-    CompressedTable.insert(std::array<double, 6>{553.15, 10000000.0, 0.0013226, 1221800.0, 1235000.0, 3056.5}, CompressedTableEntry{CompressedTableData{553.15, 10000000.0, 0.0013226, 1221800.0, 1235000.0, 3056.5}, CompressedTableData{0.0, 0.0, 2.8649999999999965e-05, 50100.0, 50350.0, 92.75}, 0});
-    CompressedTable.insert(std::array<double, 6>{453.15, 10000000.0, 0.00112, 756480.0, 767680.0, 2127.1}, CompressedTableEntry{CompressedTableData{453.15, 10000000.0, 0.00112, 756480.0, 767680.0, 2127.1}, CompressedTableData{0.0, 0.0, 1.229999999999992e-05, 43210.0, 43335.0, 95.15000000000009}, 0});
-    CompressedTable.insert(std::array<double, 6>{433.15, 30000000.0, 0.0010823, 660740.0, 693210.0, 1909.4}, CompressedTableEntry{CompressedTableData{433.15, 30000000.0, 0.0010823, 660740.0, 693210.0, 1909.4}, CompressedTableData{0.0, 0.0, 1.0000000000000026e-05, 41920.0, 42225.0, 96.29999999999995}, 0});
-    CompressedTable.insert(std::array<double, 6>{586.6277777777779, 10342135.939752545, 0.001464310243274048, 1407393.0165976998, 1422535.2787129113, 3384.4421207702403}, CompressedTableEntry{CompressedTableData{586.6277777777779, 10342135.939752545, 0.001464310243274048, 1407393.0165976998, 1422535.2787129113, 3384.4421207702403}, CompressedTableData{0.0, 0.0, 9.63887711295673e-05, 140769.539663994, 143956.16010913055, 252.71528330161254}, 1});
-    CompressedTable.insert(std::array<double, 6>{613.15, 20000000.0, 0.0015693, 1540200.0, 1571600.0, 3608.6}, CompressedTableEntry{CompressedTableData{613.15, 20000000.0, 0.0015693, 1540200.0, 1571600.0, 3608.6}, CompressedTableData{0.0, 0.0, 6.214999999999997e-05, 61800.0, 63050.0, 104.5}, 0});
-    CompressedTable.insert(std::array<double, 6>{557.9555555555555, 6894757.293168363, 0.0013481318086418427, 1252737.2549939498, 1262017.9962903697, 3112.5094227841614}, CompressedTableEntry{CompressedTableData{557.9555555555555, 6894757.293168363, 0.0013481318086418427, 1252737.2549939498, 1262017.9962903697, 3112.5094227841614}, CompressedTableData{0.0, 0.0, 6.773433722511693e-05, 128092.83789319475, 130639.80824897916, 241.55745974298475}, 1});
-    CompressedTable.insert(std::array<double, 6>{413.15, 5000000.0, 0.0010769, 586800.0, 592180.0, 1734.3999999999999}, CompressedTableEntry{CompressedTableData{413.15, 5000000.0, 0.0010769, 586800.0, 592180.0, 1734.3999999999999}, CompressedTableData{0.0, 0.0, 9.650000000000045e-06, 42445.0, 42495.0, 101.50000000000011}, 0});
-    CompressedTable.insert(std::array<double, 6>{373.15, 50000000.0, 0.0010201, 405940.0, 456940.0, 1270.5}, CompressedTableEntry{CompressedTableData{373.15, 50000000.0, 0.0010201, 405940.0, 456940.0, 1270.5}, CompressedTableData{0.0, 0.0, 6.449999999999967e-06, 40760.0, 41080.0, 107.70000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{610.9277777777778, 20684271.87950509, 0.001546028443668221, 1522413.7326648594, 1554396.237132472, 3578.7096679073315}, CompressedTableEntry{CompressedTableData{610.9277777777778, 20684271.87950509, 0.001546028443668221, 1522413.7326648594, 1554396.237132472, 3578.7096679073315}, CompressedTableData{0.0, 0.0, 6.261524445787291e-05, 66407.30927638849, 67698.2394567175, 112.83427576173722}, 1});
-    CompressedTable.insert(std::array<double, 6>{505.37222222222226, 6894757.293168363, 0.0012077937532666695, 993039.3187169351, 1001366.399880139, 2622.4025463214903}, CompressedTableEntry{CompressedTableData{505.37222222222226, 6894757.293168363, 0.0012077937532666695, 993039.3187169351, 1001366.399880139, 2622.4025463214903}, CompressedTableData{0.0, 0.0, 2.481511432901747e-05, 63325.35884587298, 63499.8088702418, 128.30450392276248}, 1});
-    CompressedTable.insert(std::array<double, 6>{313.15, 10000000.0, 0.0010035, 166330.0, 176370.0, 568.5}, CompressedTableEntry{CompressedTableData{313.15, 10000000.0, 0.0010035, 166330.0, 176370.0, 568.5}, CompressedTableData{0.0, 0.0, 3.100000000000021e-06, 41510.0, 41545.0, 128.75}, 0});
-    CompressedTable.insert(std::array<double, 6>{573.15, 30000000.0, 0.0013322, 1288900.0, 1328900.0, 3176.1}, CompressedTableEntry{CompressedTableData{573.15, 30000000.0, 0.0013322, 1288900.0, 1328900.0, 3176.1}, CompressedTableData{0.0, 0.0, 2.760000000000002e-05, 48700.0, 49550.0, 87.99999999999977}, 0});
-    CompressedTable.insert(std::array<double, 6>{333.15, 20000000.0, 0.0010084, 247750.0, 267920.0, 820.8}, CompressedTableEntry{CompressedTableData{333.15, 20000000.0, 0.0010084, 247750.0, 267920.0, 820.8}, CompressedTableData{0.0, 0.0, 4.600000000000003e-06, 41290.0, 41380.0, 120.95000000000005}, 0});
-    CompressedTable.insert(std::array<double, 6>{366.48333333333335, 13789514.586336726, 0.0010317469044419417, 387372.0941117241, 401607.2161002179, 1221.289730601068}, CompressedTableEntry{CompressedTableData{366.48333333333335, 13789514.586336726, 0.0010317469044419417, 387372.0941117241, 401607.2161002179, 1221.289730601068}, CompressedTableData{0.0, 0.0, 1.535727830173151e-05, 115346.356112648, 115555.69614189057, 297.38844554197397}, 1});
-    CompressedTable.insert(std::array<double, 6>{513.15, 15000000.0, 0.0012121, 1021000.0, 1039200.0, 2677.4}, CompressedTableEntry{CompressedTableData{513.15, 15000000.0, 0.0012121, 1021000.0, 1039200.0, 2677.4}, CompressedTableData{0.0, 0.0, 1.8450000000000042e-05, 45595.0, 45885.0, 90.59999999999991}, 0});
-    return CompressedTable;
+inline constexpr logngine::core::RSTFlatNode<6, 16> _baked_compressedtable_nodes[] = {
+    {.min = {{{273.15, 313.15, 393.15, 273.15, 313.15, 373.15, 453.15, 505.37222222222226, 553.15, 453.15, 553.15, 633.15, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3447378.6465841816, 3447378.6465841816, 3447378.6465841816, 15000000.0, 15000000.0, 15000000.0, 3447378.6465841816, 3447378.6465841816, 6894757.293168363, 20684271.87950509, 20684271.87950509, 20000000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.000993353708687613, 0.0010035, 0.0010557192413031813, 0.0009767, 0.0009962, 0.0010361, 0.00112, 0.0012053, 0.0013226, 0.0010914, 0.001243, 0.0015884, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {23.26000324917282, 166330.0, 501910.0, 180.0, 165170.0, 414850.0, 756480.0, 996551.5792075603, 1221800.0, 735490.0, 1167700.0, 1626800.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3465.74048412675, 171950.0, 507190.0, 15070.0, 180770.0, 430390.0, 767680.0, 1000738.3797924113, 1235000.0, 778550.0, 1229800.0, 1675600.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.04186800584851107, 568.5, 1523.6000000000001, 0.08373601169702213, 564.6, 1295.8, 2127.1, 2629.394503298192, 3056.5, 2079.0, 2954.7, 3749.8999999999996, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .max = {{{310.9277777777778, 393.15, 453.15, 313.15, 393.15, 453.15, 505.37222222222226, 553.15, 615.31, 533.15, 633.15, 653.15, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {13789514.586336726, 13789514.586336726, 13789514.586336726, 50000000.0, 50000000.0, 50000000.0, 20000000.0, 20000000.0, 20000000.0, 50000000.0, 50000000.0, 50000000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0010055271609999612, 0.0010549, 0.001124, 0.0009980982336913998, 0.0010349, 0.001116, 0.0012077937532666695, 0.0013096, 0.0016572, 0.0012460620930998462, 0.001583547647974484, 0.0021434640263819247, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {157842.38204888673, 500180.0, 759470.0, 164050.0, 487690.0, 753580.0, 993039.3187169351, 1213400.0, 1585500.0, 1108222.854806839, 1606498.644410619, 1822165.3945369495, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {170495.82381643675, 510730.0, 765090.0, 211250.0, 539430.0, 773020.0, 1002878.3000913353, 1233000.0, 1610300.0, 1138400.0, 1661089.8720364277, 1866498.960729873, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {541.353315621248, 1519.1, 2133.7999999999997, 20001.0, 1485.9, 2120.6, 2622.4025463214903, 3041.0, 3684.8, 2845.265941453115, 3715.5761790261145, 4074.6361971829456, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .children = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0}, .size = 12, .is_leaf = false},
+    {.min = {{{273.15000000000003, 273.15, 273.15000000000003, 273.15000000000003, 273.15, 273.15000000000003, 283.15000000000003, 283.15000000000003, 283.15000000000003, 283.15000000000003, 293.15, 293.15, 310.9277777777778, 310.9277777777778, 310.9277777777778, 310.9277777777778}, {3447378.6465841816, 5000000.0, 6894757.293168363, 10342135.939752545, 10000000.0, 13789514.586336726, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816}, {0.000998472801454857, 0.0009977, 0.0009967248185587248, 0.0009950392636231687, 0.0009952, 0.000993353708687613, 0.0009939155603327983, 0.0009954762593472016, 0.0009970993863221815, 0.0009987225132971611, 0.0009973, 0.0009996, 0.0010010323478384787, 0.0010025306188923063, 0.0010040288899461336, 0.0010055271609999612}, {23.26000324917282, 40.0, 69.78000974751845, 116.3000162458641, 120.0, 162.82002274420975, 41658.66581926852, 41751.70583226521, 41844.745845261896, 41937.7858582586, 83310.0, 83610.0, 156679.3818864281, 157074.80194166405, 157446.9619936508, 157842.38204888673}, {3465.74048412675, 5030.0, 6954.740971502673, 10420.481455629424, 10070.0, 13862.961936507, 55358.80773303131, 52055.88727164877, 48729.70680701706, 45380.26633913617, 93280.0, 88610.0, 170495.82381643675, 167425.50338754596, 164378.4429619043, 161308.1225330135}, {0.04186800584851107, 0.1, 0.20934002924255535, 0.33494404678808853, 0.3, 0.4186800584851107, 149.63625290257855, 150.05493296106366, 150.43174501370024, 150.76668906048835, 294.3, 295.4, 537.5014590831851, 538.7993672644889, 540.0554074399442, 541.353315621248}}}, .max = {{{273.15000000000003, 273.15, 273.15000000000003, 273.15000000000003, 273.15, 273.15000000000003, 283.15000000000003, 283.15000000000003, 283.15000000000003, 283.15000000000003, 293.15, 293.15, 310.9277777777778, 310.9277777777778, 310.9277777777778, 310.9277777777778}, {3447378.6465841816, 5000000.0, 6894757.293168363, 10342135.939752545, 10000000.0, 13789514.586336726, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816}, {0.000998472801454857, 0.0009977, 0.0009967248185587248, 0.0009950392636231687, 0.0009952, 0.000993353708687613, 0.0009939155603327983, 0.0009954762593472016, 0.0009970993863221815, 0.0009987225132971611, 0.0009973, 0.0009996, 0.0010010323478384787, 0.0010025306188923063, 0.0010040288899461336, 0.0010055271609999612}, {23.26000324917282, 40.0, 69.78000974751845, 116.3000162458641, 120.0, 162.82002274420975, 41658.66581926852, 41751.70583226521, 41844.745845261896, 41937.7858582586, 83310.0, 83610.0, 156679.3818864281, 157074.80194166405, 157446.9619936508, 157842.38204888673}, {3465.74048412675, 5030.0, 6954.740971502673, 10420.481455629424, 10070.0, 13862.961936507, 55358.80773303131, 52055.88727164877, 48729.70680701706, 45380.26633913617, 93280.0, 88610.0, 170495.82381643675, 167425.50338754596, 164378.4429619043, 161308.1225330135}, {0.04186800584851107, 0.1, 0.20934002924255535, 0.33494404678808853, 0.3, 0.4186800584851107, 149.63625290257855, 150.05493296106366, 150.43174501370024, 150.76668906048835, 294.3, 295.4, 537.5014590831851, 538.7993672644889, 540.0554074399442, 541.353315621248}}}, .children = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, .size = 16, .is_leaf = true},
+    {.min = {{{313.15, 313.15, 333.15, 333.15, 338.7055555555556, 338.7055555555556, 338.7055555555556, 353.15, 353.15, 366.48333333333335, 366.48333333333335, 366.48333333333335, 366.48333333333335, 373.15, 373.15, 393.15}, {10000000.0, 5000000.0, 10000000.0, 5000000.0, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 10000000.0}, {0.0010035, 0.0010057, 0.0010127, 0.0010149, 0.0010155156346921441, 0.0010170763337065479, 0.0010186370327209516, 0.0010244, 0.0010267, 0.0010317469044419417, 0.0010333700314169214, 0.0010350555863524776, 0.0010367411412880335, 0.0010385, 0.001041, 0.0010549}, {166330.0, 166920.0, 249430.0, 250290.0, 272467.6780608104, 273118.9581517872, 273770.2382427641, 332690.0, 333820.0, 387372.0941117241, 388255.97423519264, 389163.11436191044, 390070.2544886281, 416230.0, 417650.0, 500180.0}, {176370.0, 171950.0, 259550.0, 255360.0, 282981.19952943653, 280120.2191297883, 277282.49873338913, 342940.0, 338960.0, 401607.2161002179, 398955.5757298122, 396303.93535940646, 393652.29498900083, 426620.0, 422850.0, 510730.0}, {568.5, 570.5, 826.0, 828.7, 894.6774169768329, 896.6452132517129, 898.5711415207445, 1069.1, 1072.3, 1221.289730601068, 1223.75994294613, 1226.2720232970405, 1228.7841036479513, 1299.6000000000001, 1303.3999999999999, 1519.1}}}, .max = {{{313.15, 313.15, 333.15, 333.15, 338.7055555555556, 338.7055555555556, 338.7055555555556, 353.15, 353.15, 366.48333333333335, 366.48333333333335, 366.48333333333335, 366.48333333333335, 373.15, 373.15, 393.15}, {10000000.0, 5000000.0, 10000000.0, 5000000.0, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 10000000.0}, {0.0010035, 0.0010057, 0.0010127, 0.0010149, 0.0010155156346921441, 0.0010170763337065479, 0.0010186370327209516, 0.0010244, 0.0010267, 0.0010317469044419417, 0.0010333700314169214, 0.0010350555863524776, 0.0010367411412880335, 0.0010385, 0.001041, 0.0010549}, {166330.0, 166920.0, 249430.0, 250290.0, 272467.6780608104, 273118.9581517872, 273770.2382427641, 332690.0, 333820.0, 387372.0941117241, 388255.97423519264, 389163.11436191044, 390070.2544886281, 416230.0, 417650.0, 500180.0}, {176370.0, 171950.0, 259550.0, 255360.0, 282981.19952943653, 280120.2191297883, 277282.49873338913, 342940.0, 338960.0, 401607.2161002179, 398955.5757298122, 396303.93535940646, 393652.29498900083, 426620.0, 422850.0, 510730.0}, {568.5, 570.5, 826.0, 828.7, 894.6774169768329, 896.6452132517129, 898.5711415207445, 1069.1, 1072.3, 1221.289730601068, 1223.75994294613, 1226.2720232970405, 1228.7841036479513, 1299.6000000000001, 1303.3999999999999, 1519.1}}}, .children = {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31}, .size = 16, .is_leaf = true},
+    {.min = {{{394.2611111111111, 394.2611111111111, 393.15, 394.2611111111111, 413.15, 413.15, 422.0388888888889, 422.0388888888889, 422.0388888888889, 422.0388888888889, 433.15, 433.15, 449.8166666666667, 449.8166666666667, 449.8166666666667, 453.15}, {10342135.939752545, 6894757.293168363, 5000000.0, 3447378.6465841816, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 5000000.0}, {0.0010557192413031813, 0.0010575920801204658, 0.0010576, 0.0010595273468983262, 0.0010738, 0.0010769, 0.001080627997573063, 0.001082812976193228, 0.0010849979548133932, 0.0010873077893547105, 0.0010954, 0.0010988, 0.0011153379436533994, 0.0011180847739187497, 0.0011208316041841002, 0.001124}, {504742.07050705014, 505928.330672758, 501910.0, 507161.1108449641, 584720.0, 586800.0, 620856.006726921, 622367.9069381171, 623926.3271558117, 625508.0073767555, 670060.0, 672550.0, 741784.7636193704, 743785.1238987992, 745808.7441814772, 759470.0}, {515651.0120309122, 513231.97169299825, 507190.0, 510812.9313550843, 595450.0, 592180.0, 635765.6688096406, 633579.2285042184, 631416.0482020453, 629252.8678998722, 681010.0, 678040.0, 753321.7252309601, 751484.1849742754, 749669.9047208399, 765090.0}, {1530.6942938215645, 1533.7925262543545, 1523.6000000000001, 1536.8907586871442, 1729.3, 1734.3999999999999, 1816.066621685016, 1819.7091381938365, 1823.3935227085055, 1827.1616432348715, 1931.6, 1937.4, 2094.446992571766, 2098.9268691975567, 2103.448613829196, 2133.7999999999997}}}, .max = {{{394.2611111111111, 394.2611111111111, 393.15, 394.2611111111111, 413.15, 413.15, 422.0388888888889, 422.0388888888889, 422.0388888888889, 422.0388888888889, 433.15, 433.15, 449.8166666666667, 449.8166666666667, 449.8166666666667, 453.15}, {10342135.939752545, 6894757.293168363, 5000000.0, 3447378.6465841816, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 10000000.0, 5000000.0, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 5000000.0}, {0.0010557192413031813, 0.0010575920801204658, 0.0010576, 0.0010595273468983262, 0.0010738, 0.0010769, 0.001080627997573063, 0.001082812976193228, 0.0010849979548133932, 0.0010873077893547105, 0.0010954, 0.0010988, 0.0011153379436533994, 0.0011180847739187497, 0.0011208316041841002, 0.001124}, {504742.07050705014, 505928.330672758, 501910.0, 507161.1108449641, 584720.0, 586800.0, 620856.006726921, 622367.9069381171, 623926.3271558117, 625508.0073767555, 670060.0, 672550.0, 741784.7636193704, 743785.1238987992, 745808.7441814772, 759470.0}, {515651.0120309122, 513231.97169299825, 507190.0, 510812.9313550843, 595450.0, 592180.0, 635765.6688096406, 633579.2285042184, 631416.0482020453, 629252.8678998722, 681010.0, 678040.0, 753321.7252309601, 751484.1849742754, 749669.9047208399, 765090.0}, {1530.6942938215645, 1533.7925262543545, 1523.6000000000001, 1536.8907586871442, 1729.3, 1734.3999999999999, 1816.066621685016, 1819.7091381938365, 1823.3935227085055, 1827.1616432348715, 1931.6, 1937.4, 2094.446992571766, 2098.9268691975567, 2103.448613829196, 2133.7999999999997}}}, .children = {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47}, .size = 16, .is_leaf = true},
+    {.min = {{{273.15, 273.15, 273.15000000000003, 273.15, 273.15, 273.15000000000003, 283.15000000000003, 283.15000000000003, 293.15, 293.15, 293.15, 293.15, 310.9277777777778, 310.9277777777778, 313.15, 313.15}, {15000000.0, 20000000.0, 20684271.87950509, 50000000.0, 30000000.0, 34473786.465841815, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 20000000.0, 15000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0}, {0.0009928, 0.0009904, 0.0009900450267770772, 0.0009767, 0.0009857, 0.0009836149468377344, 0.0009846762221675288, 0.0009907317343434148, 0.0009805, 0.0009886, 0.0009929, 0.0009951, 0.0009924172892789708, 0.0009980982336913998, 0.0009872, 0.0009951}, {180.0, 230.0, 232.6000324917282, 290.0, 290.0, 302.3800422392467, 41053.90573479002, 41472.58579327513, 80930.0, 82110.0, 82710.0, 83010.0, 154469.68157775668, 155935.0617824546, 161900.0, 164050.0}, {15070.0, 20030.0, 20701.40289176381, 49130.0, 29860.0, 34215.46477953322, 75013.51047858234, 61964.64865579639, 129949.99999999999, 111770.0, 102570.0, 97930.0, 188685.14635728992, 176566.68466447087, 211250.0, 193900.0}, {0.4, 0.5, 0.4605480643336217, 20001.0, 0.3, 0.08373601169702213, 146.7473604990313, 148.79889278560833, 284.5, 289.7, 292.1, 293.2, 529.714009995362, 534.9056427205775, 552.8, 560.6999999999999}}}, .max = {{{273.15, 273.15, 273.15000000000003, 273.15, 273.15, 273.15000000000003, 283.15000000000003, 283.15000000000003, 293.15, 293.15, 293.15, 293.15, 310.9277777777778, 310.9277777777778, 313.15, 313.15}, {15000000.0, 20000000.0, 20684271.87950509, 50000000.0, 30000000.0, 34473786.465841815, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 20000000.0, 15000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0}, {0.0009928, 0.0009904, 0.0009900450267770772, 0.0009767, 0.0009857, 0.0009836149468377344, 0.0009846762221675288, 0.0009907317343434148, 0.0009805, 0.0009886, 0.0009929, 0.0009951, 0.0009924172892789708, 0.0009980982336913998, 0.0009872, 0.0009951}, {180.0, 230.0, 232.6000324917282, 290.0, 290.0, 302.3800422392467, 41053.90573479002, 41472.58579327513, 80930.0, 82110.0, 82710.0, 83010.0, 154469.68157775668, 155935.0617824546, 161900.0, 164050.0}, {15070.0, 20030.0, 20701.40289176381, 49130.0, 29860.0, 34215.46477953322, 75013.51047858234, 61964.64865579639, 129949.99999999999, 111770.0, 102570.0, 97930.0, 188685.14635728992, 176566.68466447087, 211250.0, 193900.0}, {0.4, 0.5, 0.4605480643336217, 20001.0, 0.3, 0.08373601169702213, 146.7473604990313, 148.79889278560833, 284.5, 289.7, 292.1, 293.2, 529.714009995362, 534.9056427205775, 552.8, 560.6999999999999}}}, .children = {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63}, .size = 16, .is_leaf = true},
+    {.min = {{{313.15, 313.15, 333.15, 333.15, 333.15, 333.15, 353.15, 353.15, 353.15, 353.15, 366.48333333333335, 366.48333333333335, 373.15, 373.15, 373.15, 393.15}, {20000000.0, 15000000.0, 50000000.0, 30000000.0, 20000000.0, 15000000.0, 50000000.0, 30000000.0, 20000000.0, 15000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 20000000.0, 50000000.0}, {0.0009992, 0.0010013, 0.0009962, 0.0010042, 0.0010084, 0.0010105, 0.0010072, 0.0010155, 0.0010199, 0.0010221, 0.0010222578544343678, 0.0010285006504919822, 0.0010201, 0.001029, 0.0010337, 0.0010349}, {165170.0, 165750.0, 243080.0, 246140.0, 247750.0, 248580.0, 324420.0, 328400.0, 330500.0, 331590.0, 382301.41340340447, 385627.5938680362, 405940.0, 410870.0, 413500.0, 487690.0}, {185160.0, 180770.0, 292880.0, 276260.0, 267920.0, 263740.0, 374780.0, 358860.0, 350900.0, 346920.0, 417540.31832590123, 406910.49684102926, 456940.0, 441740.0, 434170.0, 539430.0}, {564.6, 566.6, 805.5, 815.6, 820.8, 823.4, 1044.2, 1056.4, 1062.7, 1065.9, 1206.803400577483, 1216.391173916792, 1270.5, 1284.7, 1292.0, 1485.9}}}, .max = {{{313.15, 313.15, 333.15, 333.15, 333.15, 333.15, 353.15, 353.15, 353.15, 353.15, 366.48333333333335, 366.48333333333335, 373.15, 373.15, 373.15, 393.15}, {20000000.0, 15000000.0, 50000000.0, 30000000.0, 20000000.0, 15000000.0, 50000000.0, 30000000.0, 20000000.0, 15000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 20000000.0, 50000000.0}, {0.0009992, 0.0010013, 0.0009962, 0.0010042, 0.0010084, 0.0010105, 0.0010072, 0.0010155, 0.0010199, 0.0010221, 0.0010222578544343678, 0.0010285006504919822, 0.0010201, 0.001029, 0.0010337, 0.0010349}, {165170.0, 165750.0, 243080.0, 246140.0, 247750.0, 248580.0, 324420.0, 328400.0, 330500.0, 331590.0, 382301.41340340447, 385627.5938680362, 405940.0, 410870.0, 413500.0, 487690.0}, {185160.0, 180770.0, 292880.0, 276260.0, 267920.0, 263740.0, 374780.0, 358860.0, 350900.0, 346920.0, 417540.31832590123, 406910.49684102926, 456940.0, 441740.0, 434170.0, 539430.0}, {564.6, 566.6, 805.5, 815.6, 820.8, 823.4, 1044.2, 1056.4, 1062.7, 1065.9, 1206.803400577483, 1216.391173916792, 1270.5, 1284.7, 1292.0, 1485.9}}}, .children = {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79}, .size = 16, .is_leaf = true},
+    {.min = {{{373.15, 393.15, 393.15, 413.15, 393.15, 413.15, 413.15, 422.0388888888889, 433.15, 413.15, 422.0388888888889, 433.15, 433.15, 433.15, 453.15, 453.15}, {15000000.0, 30000000.0, 20000000.0, 50000000.0, 15000000.0, 30000000.0, 20000000.0, 34473786.465841815, 50000000.0, 15000000.0, 20684271.87950509, 30000000.0, 20000000.0, 15000000.0, 20000000.0, 15000000.0}, {0.0010361, 0.0010445, 0.0010496, 0.0010517, 0.0010522, 0.0010623, 0.0010679, 0.0010682672613789863, 0.0010704, 0.0010708, 0.0010763828962538852, 0.0010823, 0.0010886, 0.001092, 0.0011122, 0.001116}, {414850.0, 493660.0, 496850.0, 569770.0, 498500.0, 576900.0, 580710.0, 612296.3255312253, 652330.0, 582690.0, 617901.9863142759, 660740.0, 665280.0, 667630.0, 750780.0, 753580.0}, {430390.0, 525000.0, 517840.00000000006, 622360.0, 514280.0, 608760.0, 602070.0, 649116.9106746658, 705850.0, 598750.0, 640161.8094237344, 693210.0, 687050.0, 684010.0, 773020.0, 770320.0}, {1295.8, 1502.0, 1510.5, 1691.6, 1514.8, 1709.8, 1719.4, 1795.0488827490635, 1888.9, 1724.3, 1808.865324679072, 1909.4, 1920.3, 1925.8999999999999, 2114.3, 2120.6}}}, .max = {{{373.15, 393.15, 393.15, 413.15, 393.15, 413.15, 413.15, 422.0388888888889, 433.15, 413.15, 422.0388888888889, 433.15, 433.15, 433.15, 453.15, 453.15}, {15000000.0, 30000000.0, 20000000.0, 50000000.0, 15000000.0, 30000000.0, 20000000.0, 34473786.465841815, 50000000.0, 15000000.0, 20684271.87950509, 30000000.0, 20000000.0, 15000000.0, 20000000.0, 15000000.0}, {0.0010361, 0.0010445, 0.0010496, 0.0010517, 0.0010522, 0.0010623, 0.0010679, 0.0010682672613789863, 0.0010704, 0.0010708, 0.0010763828962538852, 0.0010823, 0.0010886, 0.001092, 0.0011122, 0.001116}, {414850.0, 493660.0, 496850.0, 569770.0, 498500.0, 576900.0, 580710.0, 612296.3255312253, 652330.0, 582690.0, 617901.9863142759, 660740.0, 665280.0, 667630.0, 750780.0, 753580.0}, {430390.0, 525000.0, 517840.00000000006, 622360.0, 514280.0, 608760.0, 602070.0, 649116.9106746658, 705850.0, 598750.0, 640161.8094237344, 693210.0, 687050.0, 684010.0, 773020.0, 770320.0}, {1295.8, 1502.0, 1510.5, 1691.6, 1514.8, 1709.8, 1719.4, 1795.0488827490635, 1888.9, 1724.3, 1808.865324679072, 1909.4, 1920.3, 1925.8999999999999, 2114.3, 2120.6}}}, .children = {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95}, .size = 16, .is_leaf = true},
+    {.min = {{{453.15, 473.15, 473.15, 473.15, 473.15, 477.59444444444443, 477.59444444444443, 477.59444444444443, 477.59444444444443, 493.15, 493.15, 493.15, 493.15, 505.37222222222226, 505.37222222222226, 505.37222222222226}, {10000000.0, 20000000.0, 15000000.0, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 20000000.0, 15000000.0, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363}, {0.00112, 0.001139, 0.0011435, 0.0011482, 0.0011531, 0.0011512964489452588, 0.0011546675588163704, 0.0011581635246086346, 0.0011617219183614749, 0.0011697, 0.0011752, 0.0011809, 0.0011868, 0.0011985544151014002, 0.0012030492282628826, 0.0012077937532666695}, {756480.0, 837490.0, 840840.0, 844320.0, 847920.0, 861317.9203168695, 863806.740664531, 866388.6010251892, 869016.9813923457, 925770.0, 929810.0, 934010.0, 938390.0, 986363.6977844225, 989643.358242556, 993039.3187169351}, {767680.0, 860270.0, 858000.0, 855800.0, 853680.0, 877181.2425328053, 875762.3823346058, 874366.7821396554, 873017.7019512034, 949160.0, 947430.0, 945820.0, 944320.0, 1002878.3000913353, 1002087.4599808634, 1001366.399880139}, {2127.1, 2302.7000000000003, 2310.0, 2317.4, 2325.1, 2353.1912687155645, 2358.550373464174, 2363.99321422448, 2369.5197909964836, 2486.7, 2495.1, 2503.7, 2512.7000000000003, 2608.9629164441185, 2615.5780613681836, 2622.4025463214903}}}, .max = {{{453.15, 473.15, 473.15, 473.15, 473.15, 477.59444444444443, 477.59444444444443, 477.59444444444443, 477.59444444444443, 493.15, 493.15, 493.15, 493.15, 505.37222222222226, 505.37222222222226, 505.37222222222226}, {10000000.0, 20000000.0, 15000000.0, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363, 3447378.6465841816, 20000000.0, 15000000.0, 10000000.0, 5000000.0, 13789514.586336726, 10342135.939752545, 6894757.293168363}, {0.00112, 0.001139, 0.0011435, 0.0011482, 0.0011531, 0.0011512964489452588, 0.0011546675588163704, 0.0011581635246086346, 0.0011617219183614749, 0.0011697, 0.0011752, 0.0011809, 0.0011868, 0.0011985544151014002, 0.0012030492282628826, 0.0012077937532666695}, {756480.0, 837490.0, 840840.0, 844320.0, 847920.0, 861317.9203168695, 863806.740664531, 866388.6010251892, 869016.9813923457, 925770.0, 929810.0, 934010.0, 938390.0, 986363.6977844225, 989643.358242556, 993039.3187169351}, {767680.0, 860270.0, 858000.0, 855800.0, 853680.0, 877181.2425328053, 875762.3823346058, 874366.7821396554, 873017.7019512034, 949160.0, 947430.0, 945820.0, 944320.0, 1002878.3000913353, 1002087.4599808634, 1001366.399880139}, {2127.1, 2302.7000000000003, 2310.0, 2317.4, 2325.1, 2353.1912687155645, 2358.550373464174, 2363.99321422448, 2369.5197909964836, 2486.7, 2495.1, 2503.7, 2512.7000000000003, 2608.9629164441185, 2615.5780613681836, 2622.4025463214903}}}, .children = {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111}, .size = 16, .is_leaf = true},
+    {.min = {{{505.37222222222226, 513.15, 513.15, 513.15, 513.15, 514.838888888889, 533.15, 533.15, 533.15, 533.15, 533.15, 533.15, 533.15, 537.0899999999999, 553.15, 553.15}, {3447378.6465841816, 20000000.0, 15000000.0, 10000000.0, 5000000.0, 3447378.6465841816, 20000000.0, 15000000.0, 13789514.586336726, 10342135.939752545, 10000000.0, 6894757.293168363, 5000000.0, 5000000.0, 20000000.0, 15000000.0}, {0.0012126631341916089, 0.0012053, 0.0012121, 0.0012192, 0.0012268, 0.0012329522213788558, 0.0012472, 0.001256, 0.0012581731174516181, 0.0012646656253515374, 0.0012653, 0.0012715327010149133, 0.0012755, 0.0012862, 0.0012978, 0.0013096}, {996551.5792075603, 1016100.0, 1021000.0, 1026200.0, 1031599.9999999999, 1041303.8254589688, 1109000.0, 1115100.0, 1116666.2359862886, 1121155.416613379, 1121600.0, 1125853.9372697119, 1128500.0, 1148100.0, 1205600.0, 1213400.0}, {1000738.3797924113, 1040200.0, 1039200.0, 1038300.0, 1037700.0, 1045560.4060535673, 1134000.0, 1134000.0, 1134018.1984101715, 1134227.5384394142, 1134300.0, 1134622.9584946502, 1134900.0, 1154500.0, 1231500.0, 1233000.0}, {2629.394503298192, 2667.6000000000004, 2677.4, 2687.6000000000004, 2698.3, 2717.2335795683684, 2846.9, 2858.6, 2861.510727722337, 2870.0518009154334, 2871.0, 2879.011554167015, 2884.1, 2920.7000000000003, 3026.5, 3041.0}}}, .max = {{{505.37222222222226, 513.15, 513.15, 513.15, 513.15, 514.838888888889, 533.15, 533.15, 533.15, 533.15, 533.15, 533.15, 533.15, 537.0899999999999, 553.15, 553.15}, {3447378.6465841816, 20000000.0, 15000000.0, 10000000.0, 5000000.0, 3447378.6465841816, 20000000.0, 15000000.0, 13789514.586336726, 10342135.939752545, 10000000.0, 6894757.293168363, 5000000.0, 5000000.0, 20000000.0, 15000000.0}, {0.0012126631341916089, 0.0012053, 0.0012121, 0.0012192, 0.0012268, 0.0012329522213788558, 0.0012472, 0.001256, 0.0012581731174516181, 0.0012646656253515374, 0.0012653, 0.0012715327010149133, 0.0012755, 0.0012862, 0.0012978, 0.0013096}, {996551.5792075603, 1016100.0, 1021000.0, 1026200.0, 1031599.9999999999, 1041303.8254589688, 1109000.0, 1115100.0, 1116666.2359862886, 1121155.416613379, 1121600.0, 1125853.9372697119, 1128500.0, 1148100.0, 1205600.0, 1213400.0}, {1000738.3797924113, 1040200.0, 1039200.0, 1038300.0, 1037700.0, 1045560.4060535673, 1134000.0, 1134000.0, 1134018.1984101715, 1134227.5384394142, 1134300.0, 1134622.9584946502, 1134900.0, 1154500.0, 1231500.0, 1233000.0}, {2629.394503298192, 2667.6000000000004, 2677.4, 2687.6000000000004, 2698.3, 2717.2335795683684, 2846.9, 2858.6, 2861.510727722337, 2870.0518009154334, 2871.0, 2879.011554167015, 2884.1, 2920.7000000000003, 3026.5, 3041.0}}}, .children = {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127}, .size = 16, .is_leaf = true},
+    {.min = {{{553.15, 557.9555555555555, 560.9277777777778, 566.4833333333333, 573.15, 573.15, 573.15, 593.15, 584.15, 588.7055555555556, 586.6277777777779, 593.15, 613.15, 608.6222222222223, 613.15, 615.31}, {10000000.0, 6894757.293168363, 10342135.939752545, 13789514.586336726, 20000000.0, 15000000.0, 10000000.0, 20000000.0, 10000000.0, 13789514.586336726, 10342135.939752545, 15000000.0, 20000000.0, 13789514.586336726, 15000000.0, 15000000.0}, {0.0013226, 0.0013481318086418427, 0.0013481318086418427, 0.0013571214349648076, 0.0013611, 0.0013783, 0.001398, 0.001445, 0.0014522, 0.0014556327567539636, 0.001464310243274048, 0.0014733, 0.0015693, 0.0016002783414088909, 0.0016311, 0.0016572}, {1221800.0, 1252737.2549939498, 1261855.1762676255, 1284440.6394225722, 1307200.0, 1317600.0, 1329400.0, 1416600.0, 1393300.0, 1409021.2168251418, 1407393.0165976998, 1431900.0, 1540200.0, 1540579.7952024634, 1567900.0, 1585500.0}, {1235000.0, 1262017.9962903697, 1275811.178217129, 1303164.9420381563, 1334400.0, 1338300.0, 1343300.0, 1445500.0, 1407900.0, 1429094.599629178, 1422535.2787129113, 1454000.0, 1571600.0, 1562653.5382859285, 1592400.0, 1610300.0}, {3056.5, 3112.5094227841614, 3128.8379450650805, 3169.0730986854996, 3209.1, 3227.9, 3248.8, 3399.6, 3360.3, 3387.037937132848, 3384.4421207702403, 3426.2999999999997, 3608.6, 3610.026936282018, 3655.5, 3684.8}}}, .max = {{{553.15, 557.9555555555555, 560.9277777777778, 566.4833333333333, 573.15, 573.15, 573.15, 593.15, 584.15, 588.7055555555556, 586.6277777777779, 593.15, 613.15, 608.6222222222223, 613.15, 615.31}, {10000000.0, 6894757.293168363, 10342135.939752545, 13789514.586336726, 20000000.0, 15000000.0, 10000000.0, 20000000.0, 10000000.0, 13789514.586336726, 10342135.939752545, 15000000.0, 20000000.0, 13789514.586336726, 15000000.0, 15000000.0}, {0.0013226, 0.0013481318086418427, 0.0013481318086418427, 0.0013571214349648076, 0.0013611, 0.0013783, 0.001398, 0.001445, 0.0014522, 0.0014556327567539636, 0.001464310243274048, 0.0014733, 0.0015693, 0.0016002783414088909, 0.0016311, 0.0016572}, {1221800.0, 1252737.2549939498, 1261855.1762676255, 1284440.6394225722, 1307200.0, 1317600.0, 1329400.0, 1416600.0, 1393300.0, 1409021.2168251418, 1407393.0165976998, 1431900.0, 1540200.0, 1540579.7952024634, 1567900.0, 1585500.0}, {1235000.0, 1262017.9962903697, 1275811.178217129, 1303164.9420381563, 1334400.0, 1338300.0, 1343300.0, 1445500.0, 1407900.0, 1429094.599629178, 1422535.2787129113, 1454000.0, 1571600.0, 1562653.5382859285, 1592400.0, 1610300.0}, {3056.5, 3112.5094227841614, 3128.8379450650805, 3169.0730986854996, 3209.1, 3227.9, 3248.8, 3399.6, 3360.3, 3387.037937132848, 3384.4421207702403, 3426.2999999999997, 3608.6, 3610.026936282018, 3655.5, 3684.8}}}, .children = {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143}, .size = 16, .is_leaf = true},
+    {.min = {{{453.15, 453.15, 473.15, 473.15, 477.59444444444443, 477.59444444444443, 493.15, 493.15, 505.37222222222226, 505.37222222222226, 513.15, 513.15, 533.15, 533.15, 533.15, 533.15}, {50000000.0, 30000000.0, 50000000.0, 30000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 50000000.0, 34473786.465841815, 30000000.0, 20684271.87950509}, {0.0010914, 0.0011049, 0.0011149, 0.0011304, 0.0011327553446541438, 0.0011448039410453398, 0.0011412, 0.0011595, 0.0011743947943584322, 0.0011900017845024684, 0.0011708, 0.0011927, 0.0012044, 0.001224836586503957, 0.0012314, 0.0012460620930998462}, {735490.0, 745400.0, 819450.0, 831110.0, 847478.2183836118, 856479.8396410416, 904390.0, 918150.0, 968546.5352955562, 980083.496907146, 990550.0, 1006900.0, 1078200.0, 1093080.5926916273, 1097800.0, 1108222.854806839}, {790060.0, 778550.0, 875190.0, 865020.0, 886531.7638389728, 880181.7829519487, 961450.0, 952930.0, 1009018.940949117, 1004692.5803447707, 1049100.0, 1042700.0, 1138400.0, 1135320.7585921253, 1134700.0, 1133994.9384069224}, {2079.0, 2102.0, 2262.7999999999997, 2288.8, 2323.3393805455758, 2342.891739276831, 2441.3999999999996, 2470.7, 2572.5796193617625, 2596.235042666171, 2615.6000000000004, 2649.1, 2786.4, 2815.7908653357636, 2825.0, 2845.265941453115}}}, .max = {{{453.15, 453.15, 473.15, 473.15, 477.59444444444443, 477.59444444444443, 493.15, 493.15, 505.37222222222226, 505.37222222222226, 513.15, 513.15, 533.15, 533.15, 533.15, 533.15}, {50000000.0, 30000000.0, 50000000.0, 30000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 34473786.465841815, 20684271.87950509, 50000000.0, 30000000.0, 50000000.0, 34473786.465841815, 30000000.0, 20684271.87950509}, {0.0010914, 0.0011049, 0.0011149, 0.0011304, 0.0011327553446541438, 0.0011448039410453398, 0.0011412, 0.0011595, 0.0011743947943584322, 0.0011900017845024684, 0.0011708, 0.0011927, 0.0012044, 0.001224836586503957, 0.0012314, 0.0012460620930998462}, {735490.0, 745400.0, 819450.0, 831110.0, 847478.2183836118, 856479.8396410416, 904390.0, 918150.0, 968546.5352955562, 980083.496907146, 990550.0, 1006900.0, 1078200.0, 1093080.5926916273, 1097800.0, 1108222.854806839}, {790060.0, 778550.0, 875190.0, 865020.0, 886531.7638389728, 880181.7829519487, 961450.0, 952930.0, 1009018.940949117, 1004692.5803447707, 1049100.0, 1042700.0, 1138400.0, 1135320.7585921253, 1134700.0, 1133994.9384069224}, {2079.0, 2102.0, 2262.7999999999997, 2288.8, 2323.3393805455758, 2342.891739276831, 2441.3999999999996, 2470.7, 2572.5796193617625, 2596.235042666171, 2615.6000000000004, 2649.1, 2786.4, 2815.7908653357636, 2825.0, 2845.265941453115}}}, .children = {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159}, .size = 16, .is_leaf = true},
+    {.min = {{{553.15, 553.15, 566.4833333333333, 573.15, 566.4833333333333, 573.15, 593.15, 588.7055555555556, 588.7055555555556, 593.15, 613.15, 610.9277777777778, 613.15, 610.9277777777778, 633.15, 633.15}, {50000000.0, 30000000.0, 34473786.465841815, 50000000.0, 20684271.87950509, 30000000.0, 50000000.0, 34473786.465841815, 20684271.87950509, 30000000.0, 50000000.0, 34473786.465841815, 30000000.0, 20684271.87950509, 50000000.0, 34473786.465841815}, {0.001243, 0.001277, 0.0013023721135395287, 0.0012879, 0.0013362704961323753, 0.0013322, 0.0013409, 0.001369856738922341, 0.0014207979547524751, 0.0014014, 0.0014049, 0.0014581923031375856, 0.0014932, 0.001546028443668221, 0.0014848, 0.001583547647974484}, {1167700.0, 1191500.0, 1249248.2545065738, 1259600.0, 1271368.5175965372, 1288900.0, 1354300.0, 1359361.1098881578, 1389599.1141120824, 1391700.0, 1452900.0, 1476893.9063062281, 1502400.0, 1522413.7326648594, 1556500.0, 1606498.644410619}, {1229900.0, 1229800.0, 1294140.0607774772, 1324000.0, 1299001.4014565544, 1328900.0, 1421400.0, 1406578.9164839787, 1418999.758219037, 1433700.0, 1523100.0, 1527158.7733276905, 1547100.0, 1554396.237132472, 1630700.0, 1661089.8720364277}, {2954.7, 3000.1000000000004, 3104.6801056904897, 3121.7999999999997, 3145.3758073752424, 3176.1, 3288.8, 3299.3244648802174, 3353.041116383857, 3355.7999999999997, 3457.5, 3500.290892953071, 3543.8, 3578.7096679073315, 3630.1, 3715.5761790261145}}}, .max = {{{553.15, 553.15, 566.4833333333333, 573.15, 566.4833333333333, 573.15, 593.15, 588.7055555555556, 588.7055555555556, 593.15, 613.15, 610.9277777777778, 613.15, 610.9277777777778, 633.15, 633.15}, {50000000.0, 30000000.0, 34473786.465841815, 50000000.0, 20684271.87950509, 30000000.0, 50000000.0, 34473786.465841815, 20684271.87950509, 30000000.0, 50000000.0, 34473786.465841815, 30000000.0, 20684271.87950509, 50000000.0, 34473786.465841815}, {0.001243, 0.001277, 0.0013023721135395287, 0.0012879, 0.0013362704961323753, 0.0013322, 0.0013409, 0.001369856738922341, 0.0014207979547524751, 0.0014014, 0.0014049, 0.0014581923031375856, 0.0014932, 0.001546028443668221, 0.0014848, 0.001583547647974484}, {1167700.0, 1191500.0, 1249248.2545065738, 1259600.0, 1271368.5175965372, 1288900.0, 1354300.0, 1359361.1098881578, 1389599.1141120824, 1391700.0, 1452900.0, 1476893.9063062281, 1502400.0, 1522413.7326648594, 1556500.0, 1606498.644410619}, {1229900.0, 1229800.0, 1294140.0607774772, 1324000.0, 1299001.4014565544, 1328900.0, 1421400.0, 1406578.9164839787, 1418999.758219037, 1433700.0, 1523100.0, 1527158.7733276905, 1547100.0, 1554396.237132472, 1630700.0, 1661089.8720364277}, {2954.7, 3000.1000000000004, 3104.6801056904897, 3121.7999999999997, 3145.3758073752424, 3176.1, 3288.8, 3299.3244648802174, 3353.041116383857, 3355.7999999999997, 3457.5, 3500.290892953071, 3543.8, 3578.7096679073315, 3630.1, 3715.5761790261145}}}, .children = {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175}, .size = 16, .is_leaf = true},
+    {.min = {{{653.15, 633.15, 644.2611111111112, 633.15, 633.15, 653.15, 638.9, 641.7111111111111, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {50000000.0, 30000000.0, 34473786.465841815, 20684271.87950509, 20000000.0, 30000000.0, 20000000.0, 20684271.87950509, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0015884, 0.0016276, 0.001671633500347424, 0.0017992362517650635, 0.0018248, 0.0018729, 0.0020378, 0.0021434640263819247, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1667100.0, 1626800.0, 1678860.5145187958, 1694793.6167444792, 1703600.0, 1782000.0, 1785800.0, 1822165.3945369495, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1746500.0, 1675600.0, 1736498.802570246, 1732032.8819464047, 1740100.0, 1838200.0, 1826600.0, 1866498.960729873, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3810.2, 3749.8999999999996, 3833.602087513067, 3863.9145237473895, 3878.7, 4002.6000000000004, 4014.6, 4074.6361971829456, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .max = {{{653.15, 633.15, 644.2611111111112, 633.15, 633.15, 653.15, 638.9, 641.7111111111111, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {50000000.0, 30000000.0, 34473786.465841815, 20684271.87950509, 20000000.0, 30000000.0, 20000000.0, 20684271.87950509, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0015884, 0.0016276, 0.001671633500347424, 0.0017992362517650635, 0.0018248, 0.0018729, 0.0020378, 0.0021434640263819247, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1667100.0, 1626800.0, 1678860.5145187958, 1694793.6167444792, 1703600.0, 1782000.0, 1785800.0, 1822165.3945369495, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1746500.0, 1675600.0, 1736498.802570246, 1732032.8819464047, 1740100.0, 1838200.0, 1826600.0, 1866498.960729873, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3810.2, 3749.8999999999996, 3833.602087513067, 3863.9145237473895, 3878.7, 4002.6000000000004, 4014.6, 4074.6361971829456, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .children = {176, 177, 178, 179, 180, 181, 182, 183, 0, 0, 0, 0, 0, 0, 0, 0}, .size = 8, .is_leaf = true},
+};
+inline constexpr CompressedTableEntry _baked_compressedtable_values[] = {
+    CompressedTableEntry{CompressedTableData{273.15000000000003, 3447378.6465841816, 0.000998472801454857, 23.26000324917282, 3465.74048412675, 0.04186800584851107}, CompressedTableData{0.0, 0.0, 1.248559211520974e-07, 20957.26292750471, 20957.26292750471, 75.36241052731992}, 1},
+    CompressedTableEntry{CompressedTableData{273.15, 5000000.0, 0.0009977, 40.0, 5030.0, 0.1}, CompressedTableData{0.0, 0.0, 9.49999999999996e-07, 41785.0, 41790.0, 147.64999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{273.15000000000003, 6894757.293168363, 0.0009967248185587248, 69.78000974751845, 6954.740971502673, 0.20934002924255535}, CompressedTableData{0.0, 0.0, 1.8728388172836296e-07, 20887.48291775719, 20887.482917757192, 75.11120249222884}, 1},
+    CompressedTableEntry{CompressedTableData{273.15000000000003, 10342135.939752545, 0.0009950392636231687, 116.3000162458641, 10420.481455629424, 0.33494404678808853}, CompressedTableData{0.0, 0.0, 2.1849786201644152e-07, 20817.702908009673, 20817.702908009673, 74.85999445713779}, 1},
+    CompressedTableEntry{CompressedTableData{273.15, 10000000.0, 0.0009952, 120.0, 10070.0, 0.3}, CompressedTableData{0.0, 0.0, 1.0500000000000526e-06, 41595.0, 41605.0, 147.0}, 0},
+    CompressedTableEntry{CompressedTableData{273.15000000000003, 13789514.586336726, 0.000993353708687613, 162.82002274420975, 13862.961936507, 0.4186800584851107}, CompressedTableData{0.0, 0.0, 2.8092582259270707e-07, 20747.922898262157, 20747.922898262157, 74.60878642204672}, 1},
+    CompressedTableEntry{CompressedTableData{283.15000000000003, 13789514.586336726, 0.0009939155603327983, 41658.66581926852, 55358.80773303131, 149.63625290257855}, CompressedTableData{0.0, 0.0, 2.8092582259270707e-07, 20747.922898262157, 20747.922898262157, 74.60878642204672}, 1},
+    CompressedTableEntry{CompressedTableData{283.15000000000003, 10342135.939752545, 0.0009954762593472016, 41751.70583226521, 52055.88727164877, 150.05493296106366}, CompressedTableData{0.0, 0.0, 2.1849786201644152e-07, 20817.702908009673, 20817.702908009673, 74.85999445713779}, 1},
+    CompressedTableEntry{CompressedTableData{283.15000000000003, 6894757.293168363, 0.0009970993863221815, 41844.745845261896, 48729.70680701706, 150.43174501370024}, CompressedTableData{0.0, 0.0, 1.8728388172836296e-07, 20887.48291775719, 20887.482917757192, 75.11120249222884}, 1},
+    CompressedTableEntry{CompressedTableData{283.15000000000003, 3447378.6465841816, 0.0009987225132971611, 41937.7858582586, 45380.26633913617, 150.76668906048835}, CompressedTableData{0.0, 0.0, 1.248559211520974e-07, 20957.26292750471, 20957.26292750471, 75.36241052731992}, 1},
+    CompressedTableEntry{CompressedTableData{293.15, 10000000.0, 0.0009973, 83310.0, 93280.0, 294.3}, CompressedTableData{0.0, 0.0, 1.0500000000000526e-06, 41510.0, 41545.0, 137.1}, 0},
+    CompressedTableEntry{CompressedTableData{293.15, 5000000.0, 0.0009996, 83610.0, 88610.0, 295.4}, CompressedTableData{0.0, 0.0, 9.49999999999996e-07, 41655.0, 41670.0, 137.55}, 0},
+    CompressedTableEntry{CompressedTableData{310.9277777777778, 13789514.586336726, 0.0010010323478384787, 156679.3818864281, 170495.82381643675, 537.5014590831851}, CompressedTableData{0.0, 0.0, 3.5583937528401973e-06, 57510.35803357979, 57568.50804170272, 193.93260309030325}, 1},
+    CompressedTableEntry{CompressedTableData{310.9277777777778, 10342135.939752545, 0.0010025306188923063, 157074.80194166405, 167425.50338754596, 538.7993672644889}, CompressedTableData{0.0, 0.0, 3.5271797725523356e-06, 57661.54805469942, 57684.8080579486, 177.939024856172}, 1},
+    CompressedTableEntry{CompressedTableData{310.9277777777778, 6894757.293168363, 0.0010040288899461336, 157446.9619936508, 164378.4429619043, 540.0554074399442}, CompressedTableData{0.0, 0.0, 3.46475181197607e-06, 57801.108074194446, 57824.36807744362, 178.29490290588433}, 1},
+    CompressedTableEntry{CompressedTableData{310.9277777777778, 3447378.6465841816, 0.0010055271609999612, 157842.38204888673, 161308.1225330135, 541.353315621248}, CompressedTableData{0.0, 0.0, 3.4023238514000213e-06, 57952.298095314065, 57963.92809693866, 178.60891294974823}, 1},
+    CompressedTableEntry{CompressedTableData{313.15, 10000000.0, 0.0010035, 166330.0, 176370.0, 568.5}, CompressedTableData{0.0, 0.0, 3.100000000000021e-06, 41510.0, 41545.0, 128.75}, 0},
+    CompressedTableEntry{CompressedTableData{313.15, 5000000.0, 0.0010057, 166920.0, 171950.0, 570.5}, CompressedTableData{0.0, 0.0, 3.049999999999993e-06, 41655.0, 41670.0, 129.10000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{333.15, 10000000.0, 0.0010127, 249430.0, 259550.0, 826.0}, CompressedTableData{0.0, 0.0, 4.600000000000003e-06, 41550.0, 41590.0, 121.54999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{333.15, 5000000.0, 0.0010149, 250290.0, 255360.0, 828.7}, CompressedTableData{0.0, 0.0, 4.600000000000003e-06, 41685.0, 41705.0, 121.79999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{338.7055555555556, 10342135.939752545, 0.0010155156346921441, 272467.6780608104, 282981.19952943653, 894.6774169768329}, CompressedTableData{0.0, 0.0, 6.492507899918932e-06, 57696.43805957316, 57777.848070945285, 164.54126298464854}, 1},
+    CompressedTableEntry{CompressedTableData{338.7055555555556, 6894757.293168363, 0.0010170763337065479, 273118.9581517872, 280120.2191297883, 896.6452132517129}, CompressedTableData{0.0, 0.0, 6.523721880207119e-06, 57835.99807906822, 57870.88808394199, 164.8134050226638}, 1},
+    CompressedTableEntry{CompressedTableData{338.7055555555556, 3447378.6465841816, 0.0010186370327209516, 273770.2382427641, 277282.49873338913, 898.5711415207445}, CompressedTableData{0.0, 0.0, 6.554935860495197e-06, 57963.928096938675, 57987.18810018782, 165.10648106360338}, 1},
+    CompressedTableEntry{CompressedTableData{353.15, 10000000.0, 0.0010244, 332690.0, 342940.0, 1069.1}, CompressedTableData{0.0, 0.0, 5.8499999999999525e-06, 41630.0, 41695.0, 115.25000000000011}, 0},
+    CompressedTableEntry{CompressedTableData{353.15, 5000000.0, 0.0010267, 333820.0, 338960.0, 1072.3}, CompressedTableData{0.0, 0.0, 5.899999999999981e-06, 41765.0, 41800.0, 115.54999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{366.48333333333335, 13789514.586336726, 0.0010317469044419417, 387372.0941117241, 401607.2161002179, 1221.289730601068}, CompressedTableData{0.0, 0.0, 1.535727830173151e-05, 115346.356112648, 115555.69614189057, 297.38844554197397}, 1},
+    CompressedTableEntry{CompressedTableData{366.48333333333335, 10342135.939752545, 0.0010333700314169214, 388255.97423519264, 398955.5757298122, 1223.75994294613}, CompressedTableData{0.0, 0.0, 8.927198362388626e-06, 57894.14808719113, 57987.188100187836, 153.4671754377173}, 1},
+    CompressedTableEntry{CompressedTableData{366.48333333333335, 6894757.293168363, 0.0010350555863524776, 389163.11436191044, 396303.93535940646, 1226.2720232970405}, CompressedTableData{0.0, 0.0, 8.989626322964892e-06, 58022.078105061606, 58091.85811480909, 153.76025147865698}, 1},
+    CompressedTableEntry{CompressedTableData{366.48333333333335, 3447378.6465841816, 0.0010367411412880335, 390070.2544886281, 393652.29498900083, 1228.7841036479513}, CompressedTableData{0.0, 0.0, 9.05205428354094e-06, 58150.00812293202, 58184.89812780585, 154.05332751959645}, 1},
+    CompressedTableEntry{CompressedTableData{373.15, 10000000.0, 0.0010385, 416230.0, 426620.0, 1299.6000000000001}, CompressedTableData{0.0, 0.0, 7.049999999999982e-06, 41770.0, 41840.0, 109.74999999999989}, 0},
+    CompressedTableEntry{CompressedTableData{373.15, 5000000.0, 0.001041, 417650.0, 422850.0, 1303.3999999999999}, CompressedTableData{0.0, 0.0, 7.150000000000038e-06, 41915.0, 41945.0, 110.10000000000014}, 0},
+    CompressedTableEntry{CompressedTableData{393.15, 10000000.0, 0.0010549, 500180.0, 510730.0, 1519.1}, CompressedTableData{0.0, 0.0, 8.199999999999982e-06, 41975.0, 42055.0, 105.10000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{394.2611111111111, 10342135.939752545, 0.0010557192413031813, 504742.07050705014, 515651.0120309122, 1530.6942938215645}, CompressedTableData{0.0, 0.0, 1.1174604943129957e-05, 58243.04813592875, 58347.718150550005, 144.50742218613595}, 1},
+    CompressedTableEntry{CompressedTableData{394.2611111111111, 6894757.293168363, 0.0010575920801204658, 505928.330672758, 513231.97169299825, 1533.7925262543545}, CompressedTableData{0.0, 0.0, 1.1268246883994085e-05, 58382.608155423775, 58464.0181667959, 144.80049822707554}, 1},
+    CompressedTableEntry{CompressedTableData{393.15, 5000000.0, 0.0010576, 501910.0, 507190.0, 1523.6000000000001}, CompressedTableData{0.0, 0.0, 8.29999999999993e-06, 42130.0, 42170.0, 105.39999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{394.2611111111111, 3447378.6465841816, 0.0010595273468983262, 507161.1108449641, 510812.9313550843, 1536.8907586871442}, CompressedTableData{0.0, 0.0, 1.1393102805146399e-05, 58545.42817816799, 58580.31818304173, 145.13544227386365}, 1},
+    CompressedTableEntry{CompressedTableData{413.15, 10000000.0, 0.0010738, 584720.0, 595450.0, 1729.3}, CompressedTableData{0.0, 0.0, 9.45000000000004e-06, 42270.0, 42360.0, 101.14999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{413.15, 5000000.0, 0.0010769, 586800.0, 592180.0, 1734.3999999999999}, CompressedTableData{0.0, 0.0, 9.650000000000045e-06, 42445.0, 42495.0, 101.50000000000011}, 0},
+    CompressedTableEntry{CompressedTableData{422.0388888888889, 13789514.586336726, 0.001080627997573063, 620856.006726921, 635765.6688096406, 1816.066621685016}, CompressedTableData{0.0, 0.0, 2.4440546565560636e-05, 116741.95630759842, 117079.22635471134, 268.56232351527433}, 1},
+    CompressedTableEntry{CompressedTableData{422.0388888888889, 10342135.939752545, 0.001082812976193228, 622367.9069381171, 633579.2285042184, 1819.7091381938365}, CompressedTableData{0.0, 0.0, 1.3546867445023386e-05, 58812.918215533486, 58964.10823665309, 137.36892718896468}, 1},
+    CompressedTableEntry{CompressedTableData{422.0388888888889, 6894757.293168363, 0.0010849979548133932, 623926.3271558117, 631416.0482020453, 1823.3935227085055}, CompressedTableData{0.0, 0.0, 1.370293734646367e-05, 58998.99824152686, 59092.038254523504, 137.76667324452558}, 1},
+    CompressedTableEntry{CompressedTableData{422.0388888888889, 3447378.6465841816, 0.0010873077893547105, 625508.0073767555, 629252.8678998722, 1827.1616432348715}, CompressedTableData{0.0, 0.0, 1.3890221228192142e-05, 59173.448265895684, 59219.96827239398, 138.14348529716221}, 1},
+    CompressedTableEntry{CompressedTableData{433.15, 10000000.0, 0.0010954, 670060.0, 681010.0, 1931.6}, CompressedTableData{0.0, 0.0, 1.0800000000000046e-05, 42670.0, 42780.0, 97.75}, 0},
+    CompressedTableEntry{CompressedTableData{433.15, 5000000.0, 0.0010988, 672550.0, 678040.0, 1937.4}, CompressedTableData{0.0, 0.0, 1.0950000000000022e-05, 42875.0, 42930.0, 98.19999999999982}, 0},
+    CompressedTableEntry{CompressedTableData{449.8166666666667, 10342135.939752545, 0.0011153379436533994, 741784.7636193704, 753321.7252309601, 2094.446992571766}, CompressedTableData{0.0, 0.0, 1.626248373008568e-05, 59708.42834062665, 59871.24836337083, 132.05169044620402}, 1},
+    CompressedTableEntry{CompressedTableData{449.8166666666667, 6894757.293168363, 0.0011180847739187497, 743785.1238987992, 751484.1849742754, 2098.9268691975567}, CompressedTableData{0.0, 0.0, 1.6543409552678278e-05, 59929.398371493735, 60034.068386115076, 132.53317251346175}, 1},
+    CompressedTableEntry{CompressedTableData{449.8166666666667, 3447378.6465841816, 0.0011208316041841002, 745808.7441814772, 749669.9047208399, 2103.448613829196}, CompressedTableData{0.0, 0.0, 1.6761907414694827e-05, 60150.36840236088, 60208.51841048384, 133.03558858364386}, 1},
+    CompressedTableEntry{CompressedTableData{453.15, 5000000.0, 0.001124, 759470.0, 765090.0, 2133.7999999999997}, CompressedTableData{0.0, 0.0, 1.2599999999999981e-05, 43460.0, 43525.0, 95.65000000000009}, 0},
+    CompressedTableEntry{CompressedTableData{273.15, 15000000.0, 0.0009928, 180.0, 15070.0, 0.4}, CompressedTableData{0.0, 0.0, 1.1500000000000008e-06, 41415.0, 41430.0, 146.4}, 0},
+    CompressedTableEntry{CompressedTableData{273.15, 20000000.0, 0.0009904, 230.0, 20030.0, 0.5}, CompressedTableData{0.0, 0.0, 1.249999999999949e-06, 41240.0, 41270.0, 145.8}, 0},
+    CompressedTableEntry{CompressedTableData{273.15000000000003, 20684271.87950509, 0.0009900450267770772, 232.6000324917282, 20701.40289176381, 0.4605480643336217}, CompressedTableData{0.0, 0.0, 3.433537831687558e-07, 20619.992880391703, 20631.622882016287, 74.16917236063736}, 1},
+    CompressedTableEntry{CompressedTableData{273.15, 50000000.0, 0.0009767, 290.0, 49130.0, 20001.0}, CompressedTableData{0.0, 0.0, 1.899999999999992e-06, 40320.0, 40409.99999999999, 7999.2}, 0},
+    CompressedTableEntry{CompressedTableData{273.15, 30000000.0, 0.0009857, 290.0, 29860.0, 0.3}, CompressedTableData{0.0, 0.0, 1.4500000000000624e-06, 40910.0, 40955.0, 144.7}, 0},
+    CompressedTableEntry{CompressedTableData{273.15000000000003, 34473786.465841815, 0.0009836149468377344, 302.3800422392467, 34215.46477953322, 0.08373601169702213}, CompressedTableData{0.0, 0.0, 5.306376648972272e-07, 20375.76284627539, 20399.022849524557, 73.33181224366713}, 1},
+    CompressedTableEntry{CompressedTableData{283.15000000000003, 34473786.465841815, 0.0009846762221675288, 41053.90573479002, 75013.51047858234, 146.7473604990313}, CompressedTableData{0.0, 0.0, 5.306376648972272e-07, 20375.76284627539, 20399.022849524557, 73.33181224366713}, 1},
+    CompressedTableEntry{CompressedTableData{283.15000000000003, 20684271.87950509, 0.0009907317343434148, 41472.58579327513, 61964.64865579639, 148.79889278560833}, CompressedTableData{0.0, 0.0, 3.433537831687558e-07, 20619.992880391703, 20631.622882016287, 74.16917236063736}, 1},
+    CompressedTableEntry{CompressedTableData{293.15, 50000000.0, 0.0009805, 80930.0, 129949.99999999999, 284.5}, CompressedTableData{0.0, 0.0, 1.899999999999992e-06, 40320.0, 40409.99999999999, 134.14999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{293.15, 30000000.0, 0.0009886, 82110.0, 111770.0, 289.7}, CompressedTableData{0.0, 0.0, 1.4500000000000624e-06, 40910.0, 40955.0, 135.49999999999997}, 0},
+    CompressedTableEntry{CompressedTableData{293.15, 20000000.0, 0.0009929, 82710.0, 102570.0, 292.1}, CompressedTableData{0.0, 0.0, 1.249999999999949e-06, 41230.0, 41270.0, 136.25}, 0},
+    CompressedTableEntry{CompressedTableData{293.15, 15000000.0, 0.0009951, 83010.0, 97930.0, 293.2}, CompressedTableData{0.0, 0.0, 1.1500000000000008e-06, 41370.0, 41420.0, 136.70000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{310.9277777777778, 34473786.465841815, 0.0009924172892789708, 154469.68157775668, 188685.14635728992, 529.714009995362}, CompressedTableData{0.0, 0.0, 3.870533555720983e-06, 56707.88792148333, 56835.817939353794, 191.48332474816533}, 1},
+    CompressedTableEntry{CompressedTableData{310.9277777777778, 20684271.87950509, 0.0009980982336913998, 155935.0617824546, 176566.68466447087, 534.9056427205775}, CompressedTableData{0.0, 0.0, 3.6832496739925115e-06, 57231.23799458974, 57301.01800433724, 193.05337496748456}, 1},
+    CompressedTableEntry{CompressedTableData{313.15, 50000000.0, 0.0009872, 161900.0, 211250.0, 552.8}, CompressedTableData{0.0, 0.0, 3.349999999999946e-06, 40485.0, 40650.00000000001, 126.35000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{313.15, 30000000.0, 0.0009951, 164050.0, 193900.0, 560.6999999999999}, CompressedTableData{0.0, 0.0, 3.2499999999999977e-06, 40970.0, 41065.0, 127.45000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{313.15, 20000000.0, 0.0009992, 165170.0, 185160.0, 564.6}, CompressedTableData{0.0, 0.0, 3.1500000000000495e-06, 41230.0, 41295.0, 128.09999999999997}, 0},
+    CompressedTableEntry{CompressedTableData{313.15, 15000000.0, 0.0010013, 165750.0, 180770.0, 566.6}, CompressedTableData{0.0, 0.0, 3.100000000000021e-06, 41370.0, 41420.0, 128.39999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{333.15, 50000000.0, 0.0009962, 243080.0, 292880.0, 805.5}, CompressedTableData{0.0, 0.0, 4.500000000000055e-06, 40590.0, 40815.0, 119.35000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{333.15, 30000000.0, 0.0010042, 246140.0, 276260.0, 815.6}, CompressedTableData{0.0, 0.0, 4.549999999999975e-06, 41045.0, 41180.0, 120.40000000000003}, 0},
+    CompressedTableEntry{CompressedTableData{333.15, 20000000.0, 0.0010084, 247750.0, 267920.0, 820.8}, CompressedTableData{0.0, 0.0, 4.600000000000003e-06, 41290.0, 41380.0, 120.95000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{333.15, 15000000.0, 0.0010105, 248580.0, 263740.0, 823.4}, CompressedTableData{0.0, 0.0, 4.599999999999895e-06, 41415.0, 41485.0, 121.25000000000006}, 0},
+    CompressedTableEntry{CompressedTableData{353.15, 50000000.0, 0.0010072, 324420.0, 374780.0, 1044.2}, CompressedTableData{0.0, 0.0, 5.499999999999971e-06, 40670.0, 40950.0, 113.14999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{353.15, 30000000.0, 0.0010155, 328400.0, 358860.0, 1056.4}, CompressedTableData{0.0, 0.0, 5.649999999999948e-06, 41130.0, 41300.0, 114.14999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{353.15, 20000000.0, 0.0010199, 330500.0, 350900.0, 1062.7}, CompressedTableData{0.0, 0.0, 5.750000000000004e-06, 41375.0, 41490.0, 114.64999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{353.15, 15000000.0, 0.0010221, 331590.0, 346920.0, 1065.9}, CompressedTableData{0.0, 0.0, 5.8000000000000326e-06, 41505.0, 41590.0, 114.94999999999993}, 0},
+    CompressedTableEntry{CompressedTableData{366.48333333333335, 34473786.465841815, 0.0010222578544343678, 382301.41340340447, 417540.31832590123, 1206.803400577483}, CompressedTableData{0.0, 0.0, 1.4920282577698517e-05, 113915.8659128239, 114427.58598430565, 294.12274108579027}, 1},
+    CompressedTableEntry{CompressedTableData{366.48333333333335, 20684271.87950509, 0.0010285006504919822, 385627.5938680362, 406910.49684102926, 1216.391173916792}, CompressedTableData{0.0, 0.0, 1.5201208400291225e-05, 114846.26604279078, 115171.9060882792, 296.23707538114}, 1},
+    CompressedTableEntry{CompressedTableData{373.15, 50000000.0, 0.0010201, 405940.0, 456940.0, 1270.5}, CompressedTableData{0.0, 0.0, 6.449999999999967e-06, 40760.0, 41080.0, 107.70000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{373.15, 30000000.0, 0.001029, 410870.0, 441740.0, 1284.7}, CompressedTableData{0.0, 0.0, 6.7500000000000285e-06, 41235.0, 41440.0, 108.64999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{373.15, 20000000.0, 0.0010337, 413500.0, 434170.0, 1292.0}, CompressedTableData{0.0, 0.0, 6.900000000000005e-06, 41500.0, 41635.0, 109.25}, 0},
+    CompressedTableEntry{CompressedTableData{393.15, 50000000.0, 0.0010349, 487690.0, 539430.0, 1485.9}, CompressedTableData{0.0, 0.0, 7.4000000000000715e-06, 40875.0, 41245.0, 102.84999999999991}, 0},
+    CompressedTableEntry{CompressedTableData{373.15, 15000000.0, 0.0010361, 414850.0, 430390.0, 1295.8}, CompressedTableData{0.0, 0.0, 7.000000000000062e-06, 41630.0, 41735.0, 109.5}, 0},
+    CompressedTableEntry{CompressedTableData{393.15, 30000000.0, 0.0010445, 493660.0, 525000.0, 1502.0}, CompressedTableData{0.0, 0.0, 7.750000000000053e-06, 41395.0, 41630.0, 103.89999999999998}, 0},
+    CompressedTableEntry{CompressedTableData{393.15, 20000000.0, 0.0010496, 496850.0, 517840.00000000006, 1510.5}, CompressedTableData{0.0, 0.0, 7.94999999999995e-06, 41675.0, 41835.00000000003, 104.45000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{413.15, 50000000.0, 0.0010517, 569770.0, 622360.0, 1691.6}, CompressedTableData{0.0, 0.0, 8.399999999999987e-06, 41040.0, 41465.0, 98.65000000000009}, 0},
+    CompressedTableEntry{CompressedTableData{393.15, 15000000.0, 0.0010522, 498500.0, 514280.0, 1514.8}, CompressedTableData{0.0, 0.0, 8.050000000000006e-06, 41825.0, 41945.0, 104.75}, 0},
+    CompressedTableEntry{CompressedTableData{413.15, 30000000.0, 0.0010623, 576900.0, 608760.0, 1709.8}, CompressedTableData{0.0, 0.0, 8.899999999999945e-06, 41620.0, 41880.0, 99.80000000000007}, 0},
+    CompressedTableEntry{CompressedTableData{413.15, 20000000.0, 0.0010679, 580710.0, 602070.0, 1719.4}, CompressedTableData{0.0, 0.0, 9.150000000000087e-06, 41930.0, 42114.99999999997, 100.44999999999993}, 0},
+    CompressedTableEntry{CompressedTableData{422.0388888888889, 34473786.465841815, 0.0010682672613789863, 612296.3255312253, 649116.9106746658, 1795.0488827490635}, CompressedTableData{0.0, 0.0, 2.300470347230924e-05, 114997.45606391042, 115788.2961743823, 264.1452488982561}, 1},
+    CompressedTableEntry{CompressedTableData{433.15, 50000000.0, 0.0010704, 652330.0, 705850.0, 1888.9}, CompressedTableData{0.0, 0.0, 9.349999999999983e-06, 41280.0, 41745.0, 95.04999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{413.15, 15000000.0, 0.0010708, 582690.0, 598750.0, 1724.3}, CompressedTableData{0.0, 0.0, 9.299999999999955e-06, 42095.0, 42235.0, 100.79999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{422.0388888888889, 20684271.87950509, 0.0010763828962538852, 617901.9863142759, 640161.8094237344, 1808.865324679072}, CompressedTableData{0.0, 0.0, 2.3941122880951488e-05, 116137.19622311986, 116625.65629135258, 267.01320729887937}, 1},
+    CompressedTableEntry{CompressedTableData{433.15, 30000000.0, 0.0010823, 660740.0, 693210.0, 1909.4}, CompressedTableData{0.0, 0.0, 1.0000000000000026e-05, 41920.0, 42225.0, 96.29999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{433.15, 20000000.0, 0.0010886, 665280.0, 687050.0, 1920.3}, CompressedTableData{0.0, 0.0, 1.03499999999999e-05, 42285.0, 42490.0, 97.00000000000011}, 0},
+    CompressedTableEntry{CompressedTableData{433.15, 15000000.0, 0.001092, 667630.0, 684010.0, 1925.8999999999999}, CompressedTableData{0.0, 0.0, 1.060000000000004e-05, 42470.0, 42630.0, 97.35000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{453.15, 20000000.0, 0.0011122, 750780.0, 773020.0, 2114.3}, CompressedTableData{0.0, 0.0, 1.180000000000007e-05, 42750.0, 42985.0, 94.20000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{453.15, 15000000.0, 0.001116, 753580.0, 770320.0, 2120.6}, CompressedTableData{0.0, 0.0, 1.1999999999999966e-05, 42975.0, 43155.0, 94.70000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{453.15, 10000000.0, 0.00112, 756480.0, 767680.0, 2127.1}, CompressedTableData{0.0, 0.0, 1.229999999999992e-05, 43210.0, 43335.0, 95.15000000000009}, 0},
+    CompressedTableEntry{CompressedTableData{473.15, 20000000.0, 0.001139, 837490.0, 860270.0, 2302.7000000000003}, CompressedTableData{0.0, 0.0, 1.34e-05, 43355.0, 43625.0, 91.99999999999977}, 0},
+    CompressedTableEntry{CompressedTableData{473.15, 15000000.0, 0.0011435, 840840.0, 858000.0, 2310.0}, CompressedTableData{0.0, 0.0, 1.3749999999999982e-05, 43630.0, 43840.0, 92.54999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{473.15, 10000000.0, 0.0011482, 844320.0, 855800.0, 2317.4}, CompressedTableData{0.0, 0.0, 1.4100000000000072e-05, 43920.0, 44060.0, 93.14999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{473.15, 5000000.0, 0.0011531, 847920.0, 853680.0, 2325.1}, CompressedTableData{0.0, 0.0, 1.4550000000000001e-05, 44225.0, 44295.0, 93.80000000000018}, 0},
+    CompressedTableEntry{CompressedTableData{477.59444444444443, 13789514.586336726, 0.0011512964489452588, 861317.9203168695, 877181.2425328053, 2353.1912687155645}, CompressedTableData{0.0, 0.0, 2.3628983078070702e-05, 62522.88873377652, 62848.528779265005, 127.88582386427697}, 1},
+    CompressedTableEntry{CompressedTableData{477.59444444444443, 10342135.939752545, 0.0011546675588163704, 863806.740664531, 875762.3823346058, 2358.550373464174}, CompressedTableData{0.0, 0.0, 1.9664807581485483e-05, 61010.9885225803, 61220.328551822866, 128.5138439520049}, 1},
+    CompressedTableEntry{CompressedTableData{477.59444444444443, 6894757.293168363, 0.0011581635246086346, 866388.6010251892, 874366.7821396554, 2363.99321422448}, CompressedTableData{0.0, 0.0, 2.0039375344942426e-05, 61301.73856319499, 61441.29858269001, 129.20466604850503}, 1},
+    CompressedTableEntry{CompressedTableData{477.59444444444443, 3447378.6465841816, 0.0011617219183614749, 869016.9813923457, 873017.7019512034, 2369.5197909964836}, CompressedTableData{0.0, 0.0, 2.044515708868734e-05, 61604.118605434254, 61673.89861518174, 129.93735615085416}, 1},
+    CompressedTableEntry{CompressedTableData{493.15, 20000000.0, 0.0011697, 925770.0, 949160.0, 2486.7}, CompressedTableData{0.0, 0.0, 1.535000000000002e-05, 44140.0, 44445.0, 90.45000000000027}, 0},
+    CompressedTableEntry{CompressedTableData{493.15, 15000000.0, 0.0011752, 929810.0, 947430.0, 2495.1}, CompressedTableData{0.0, 0.0, 1.584999999999998e-05, 44485.0, 44715.0, 91.15000000000009}, 0},
+    CompressedTableEntry{CompressedTableData{493.15, 10000000.0, 0.0011809, 934010.0, 945820.0, 2503.7}, CompressedTableData{0.0, 0.0, 1.6349999999999937e-05, 44845.0, 45010.0, 91.95000000000027}, 0},
+    CompressedTableEntry{CompressedTableData{493.15, 5000000.0, 0.0011868, 938390.0, 944320.0, 2512.7000000000003}, CompressedTableData{0.0, 0.0, 1.6850000000000003e-05, 45235.0, 45320.0, 92.79999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{505.37222222222226, 13789514.586336726, 0.0011985544151014002, 986363.6977844225, 1002878.3000913353, 2608.9629164441185}, CompressedTableData{0.0, 0.0, 2.3628983078070702e-05, 62522.88873377652, 62848.528779265005, 126.27390563910922}, 1},
+    CompressedTableEntry{CompressedTableData{505.37222222222226, 10342135.939752545, 0.0012030492282628826, 989643.358242556, 1002087.4599808634, 2615.5780613681836}, CompressedTableData{0.0, 0.0, 2.4190834723256116e-05, 62918.30878901249, 63162.538823128794, 127.2368697736249}, 1},
+    CompressedTableEntry{CompressedTableData{505.37222222222226, 6894757.293168363, 0.0012077937532666695, 993039.3187169351, 1001366.399880139, 2622.4025463214903}, CompressedTableData{0.0, 0.0, 2.481511432901747e-05, 63325.35884587298, 63499.8088702418, 128.30450392276248}, 1},
+    CompressedTableEntry{CompressedTableData{505.37222222222226, 3447378.6465841816, 0.0012126631341916089, 996551.5792075603, 1000738.3797924113, 2629.394503298192}, CompressedTableData{0.0, 0.0, 2.5470607915067012e-05, 63767.29890760727, 63860.33892060397, 129.93735615085416}, 1},
+    CompressedTableEntry{CompressedTableData{513.15, 20000000.0, 0.0012053, 1016100.0, 1040200.0, 2667.6000000000004}, CompressedTableData{0.0, 0.0, 1.78e-05, 45165.0, 45520.0, 89.64999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{513.15, 15000000.0, 0.0012121, 1021000.0, 1039200.0, 2677.4}, CompressedTableData{0.0, 0.0, 1.8450000000000042e-05, 45595.0, 45885.0, 90.59999999999991}, 0},
+    CompressedTableEntry{CompressedTableData{513.15, 10000000.0, 0.0012192, 1026200.0, 1038300.0, 2687.6000000000004}, CompressedTableData{0.0, 0.0, 1.9150000000000005e-05, 46095.0, 46240.0, 91.69999999999982}, 0},
+    CompressedTableEntry{CompressedTableData{513.15, 5000000.0, 0.0012268, 1031599.9999999999, 1037700.0, 2698.3}, CompressedTableData{0.0, 0.0, 1.9999999999999944e-05, 46604.99999999994, 46690.0, 92.79999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 1041303.8254589688, 1045560.4060535673, 2717.2335795683684}, CompressedTableData{0.0, 0.0, 0.00011723970996199945, 520640.2827278598, 521047.3327847203, 1358.59585578126}, 1},
+    CompressedTableEntry{CompressedTableData{533.15, 20000000.0, 0.0012472, 1109000.0, 1134000.0, 2846.9}, CompressedTableData{0.0, 0.0, 2.094999999999994e-05, 46450.0, 46900.0, 89.64999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{533.15, 15000000.0, 0.001256, 1115100.0, 1134000.0, 2858.6}, CompressedTableData{0.0, 0.0, 2.1949999999999964e-05, 47050.0, 47400.0, 90.59999999999991}, 0},
+    CompressedTableEntry{CompressedTableData{533.15, 13789514.586336726, 0.0012581731174516181, 1116666.2359862886, 1134018.1984101715, 2861.510727722337}, CompressedTableData{0.0, 0.0, 2.9809351175108956e-05, 65151.269100933045, 65569.94915941812, 126.27390563910922}, 1},
+    CompressedTableEntry{CompressedTableData{533.15, 10342135.939752545, 0.0012646656253515374, 1121155.416613379, 1134227.5384394142, 2870.0518009154334}, CompressedTableData{0.0, 0.0, 3.080819854432736e-05, 65756.02918541152, 66070.03922927543, 127.2368697736249}, 1},
+    CompressedTableEntry{CompressedTableData{533.15, 10000000.0, 0.0012653, 1121600.0, 1134300.0, 2871.0}, CompressedTableData{0.0, 0.0, 2.3050000000000045e-05, 47700.0, 48000.0, 91.69999999999982}, 0},
+    CompressedTableEntry{CompressedTableData{533.15, 6894757.293168363, 0.0012715327010149133, 1125853.9372697119, 1134622.9584946502, 2879.011554167015}, CompressedTableData{0.0, 0.0, 3.1869473874121925e-05, 66407.30927638838, 66628.27930725558, 128.30450392276248}, 1},
+    CompressedTableEntry{CompressedTableData{533.15, 5000000.0, 0.0012755, 1128500.0, 1134900.0, 2884.1}, CompressedTableData{0.0, 0.0, 2.4350000000000023e-05, 48450.00000000006, 48600.0, 92.89999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{537.0899999999999, 5000000.0, 0.0012862, 1148100.0, 1154500.0, 2920.7000000000003}, CompressedTableData{0.0, 0.0, 0.00014424999999999996, 574030.0, 574735.0, 1460.3000000000002}, 0},
+    CompressedTableEntry{CompressedTableData{553.15, 20000000.0, 0.0012978, 1205600.0, 1231500.0, 3026.5}, CompressedTableData{0.0, 0.0, 2.530000000000002e-05, 48300.0, 48750.0, 89.79999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{553.15, 15000000.0, 0.0013096, 1213400.0, 1233000.0, 3041.0}, CompressedTableData{0.0, 0.0, 2.68e-05, 49150.0, 49500.0, 91.20000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{553.15, 10000000.0, 0.0013226, 1221800.0, 1235000.0, 3056.5}, CompressedTableData{0.0, 0.0, 2.8649999999999965e-05, 50100.0, 50350.0, 92.75}, 0},
+    CompressedTableEntry{CompressedTableData{557.9555555555555, 6894757.293168363, 0.0013481318086418427, 1252737.2549939498, 1262017.9962903697, 3112.5094227841614}, CompressedTableData{0.0, 0.0, 6.773433722511693e-05, 128092.83789319475, 130639.80824897916, 241.55745974298475}, 1},
+    CompressedTableEntry{CompressedTableData{560.9277777777778, 10342135.939752545, 0.0013481318086418427, 1261855.1762676255, 1275811.178217129, 3128.8379450650805}, CompressedTableData{0.0, 0.0, 4.173309164515269e-05, 70349.87982712325, 70791.81988885743, 129.39307207482352}, 1},
+    CompressedTableEntry{CompressedTableData{566.4833333333333, 13789514.586336726, 0.0013571214349648076, 1284440.6394225722, 1303164.9420381563, 3169.0730986854996}, CompressedTableData{0.0, 0.0, 4.9255660894578e-05, 62290.28870128479, 62964.82879551081, 108.98241922367424}, 1},
+    CompressedTableEntry{CompressedTableData{573.15, 20000000.0, 0.0013611, 1307200.0, 1334400.0, 3209.1}, CompressedTableData{0.0, 0.0, 3.165000000000004e-05, 50800.0, 51450.0, 91.29999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{573.15, 15000000.0, 0.0013783, 1317600.0, 1338300.0, 3227.9}, CompressedTableData{0.0, 0.0, 3.435000000000005e-05, 52100.0, 52650.0, 93.45000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{573.15, 10000000.0, 0.001398, 1329400.0, 1343300.0, 3248.8}, CompressedTableData{0.0, 0.0, 3.7699999999999995e-05, 53800.0, 54150.0, 96.15000000000009}, 0},
+    CompressedTableEntry{CompressedTableData{593.15, 20000000.0, 0.001445, 1416600.0, 1445500.0, 3399.6}, CompressedTableData{0.0, 0.0, 4.195000000000002e-05, 54700.0, 55550.0, 95.25}, 0},
+    CompressedTableEntry{CompressedTableData{584.15, 10000000.0, 0.0014522, 1393300.0, 1407900.0, 3360.3}, CompressedTableData{0.0, 0.0, 8.835000000000006e-05, 132400.0, 136500.0, 238.10000000000014}, 0},
+    CompressedTableEntry{CompressedTableData{588.7055555555556, 13789514.586336726, 0.0014556327567539636, 1409021.2168251418, 1429094.599629178, 3387.037937132848}, CompressedTableData{0.0, 0.0, 4.9255660894578e-05, 62290.28870128479, 62964.82879551081, 108.98241922367424}, 1},
+    CompressedTableEntry{CompressedTableData{586.6277777777779, 10342135.939752545, 0.001464310243274048, 1407393.0165976998, 1422535.2787129113, 3384.4421207702403}, CompressedTableData{0.0, 0.0, 9.63887711295673e-05, 140769.539663994, 143956.16010913055, 252.71528330161254}, 1},
+    CompressedTableEntry{CompressedTableData{593.15, 15000000.0, 0.0014733, 1431900.0, 1454000.0, 3426.2999999999997}, CompressedTableData{0.0, 0.0, 4.7500000000000016e-05, 57150.0, 57850.0, 99.19999999999982}, 0},
+    CompressedTableEntry{CompressedTableData{613.15, 20000000.0, 0.0015693, 1540200.0, 1571600.0, 3608.6}, CompressedTableData{0.0, 0.0, 6.214999999999997e-05, 61800.0, 63050.0, 104.5}, 0},
+    CompressedTableEntry{CompressedTableData{608.6222222222223, 13789514.586336726, 0.0016002783414088909, 1540579.7952024634, 1562653.5382859285, 3610.026936282018}, CompressedTableData{0.0, 0.0, 0.00012607326638352406, 139362.30946741893, 143421.18003439973, 240.59449560846883}, 1},
+    CompressedTableEntry{CompressedTableData{613.15, 15000000.0, 0.0016311, 1567900.0, 1592400.0, 3655.5}, CompressedTableData{0.0, 0.0, 7.889999999999991e-05, 68000.0, 69200.0, 114.60000000000014}, 0},
+    CompressedTableEntry{CompressedTableData{615.31, 15000000.0, 0.0016572, 1585500.0, 1610300.0, 3684.8}, CompressedTableData{0.0, 0.0, 0.0001296, 128050.0, 133500.0, 218.0}, 0},
+    CompressedTableEntry{CompressedTableData{453.15, 50000000.0, 0.0010914, 735490.0, 790060.0, 2079.0}, CompressedTableData{0.0, 0.0, 1.0499999999999984e-05, 41580.0, 42105.0, 91.89999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{453.15, 30000000.0, 0.0011049, 745400.0, 778550.0, 2102.0}, CompressedTableData{0.0, 0.0, 1.1300000000000004e-05, 42330.0, 42670.0, 93.40000000000009}, 0},
+    CompressedTableEntry{CompressedTableData{473.15, 50000000.0, 0.0011149, 819450.0, 875190.0, 2262.7999999999997}, CompressedTableData{0.0, 0.0, 1.1750000000000042e-05, 41980.0, 42565.0, 89.29999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{473.15, 30000000.0, 0.0011304, 831110.0, 865020.0, 2288.8}, CompressedTableData{0.0, 0.0, 1.2749999999999958e-05, 42855.0, 43235.0, 90.94999999999982}, 0},
+    CompressedTableEntry{CompressedTableData{477.59444444444443, 34473786.465841815, 0.0011327553446541438, 847478.2183836118, 886531.7638389728, 2323.3393805455758}, CompressedTableData{0.0, 0.0, 2.0819724852144173e-05, 60534.15845597221, 61243.588555072085, 124.62011940809339}, 1},
+    CompressedTableEntry{CompressedTableData{477.59444444444443, 20684271.87950509, 0.0011448039410453398, 856479.8396410416, 880181.7829519487, 2342.891739276831}, CompressedTableData{0.0, 0.0, 2.2598921728564326e-05, 61801.82863305218, 62255.39869641099, 126.67165169467012}, 1},
+    CompressedTableEntry{CompressedTableData{493.15, 50000000.0, 0.0011412, 904390.0, 961450.0, 2441.3999999999996}, CompressedTableData{0.0, 0.0, 1.3149999999999967e-05, 42470.0, 43130.0, 87.10000000000036}, 0},
+    CompressedTableEntry{CompressedTableData{493.15, 30000000.0, 0.0011595, 918150.0, 952930.0, 2470.7}, CompressedTableData{0.0, 0.0, 1.4550000000000001e-05, 43520.0, 43955.0, 89.20000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{505.37222222222226, 34473786.465841815, 0.0011743947943584322, 968546.5352955562, 1009018.940949117, 2572.5796193617625}, CompressedTableData{0.0, 0.0, 2.0819724852144173e-05, 60534.15845597221, 61243.588555072085, 121.60562298700052}, 1},
+    CompressedTableEntry{CompressedTableData{505.37222222222226, 20684271.87950509, 0.0011900017845024684, 980083.496907146, 1004692.5803447707, 2596.235042666171}, CompressedTableData{0.0, 0.0, 2.2598921728564326e-05, 61801.82863305218, 62255.39869641099, 124.51544939347195}, 1},
+    CompressedTableEntry{CompressedTableData{513.15, 50000000.0, 0.0011708, 990550.0, 1049100.0, 2615.6000000000004}, CompressedTableData{0.0, 0.0, 1.4800000000000034e-05, 43080.0, 43825.0, 85.39999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{513.15, 30000000.0, 0.0011927, 1006900.0, 1042700.0, 2649.1}, CompressedTableData{0.0, 0.0, 1.6600000000000078e-05, 44375.0, 44885.0, 87.95000000000005}, 0},
+    CompressedTableEntry{CompressedTableData{533.15, 50000000.0, 0.0012044, 1078200.0, 1138400.0, 2786.4}, CompressedTableData{0.0, 0.0, 1.6799999999999975e-05, 43825.0, 44650.0, 84.14999999999986}, 0},
+    CompressedTableEntry{CompressedTableData{533.15, 34473786.465841815, 0.001224836586503957, 1093080.5926916273, 1135320.7585921253, 2815.7908653357636}, CompressedTableData{0.0, 0.0, 2.5220896072762383e-05, 62267.028698035574, 63150.908821504156, 121.60562298700052}, 1},
+    CompressedTableEntry{CompressedTableData{533.15, 30000000.0, 0.0012314, 1097800.0, 1134700.0, 2825.0}, CompressedTableData{0.0, 0.0, 1.93499999999999e-05, 45450.0, 46000.0, 87.55000000000018}, 0},
+    CompressedTableEntry{CompressedTableData{533.15, 20684271.87950509, 0.0012460620930998462, 1108222.854806839, 1133994.9384069224, 2845.265941453115}, CompressedTableData{0.0, 0.0, 2.8030154298688912e-05, 64069.67894984654, 64651.17903107585, 124.51544939347195}, 1},
+    CompressedTableEntry{CompressedTableData{553.15, 50000000.0, 0.001243, 1167700.0, 1229900.0, 2954.7}, CompressedTableData{0.0, 0.0, 1.929999999999998e-05, 44750.0, 45750.0, 83.54999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{553.15, 30000000.0, 0.001277, 1191500.0, 1229800.0, 3000.1000000000004}, CompressedTableData{0.0, 0.0, 2.2800000000000012e-05, 46850.0, 47550.0, 87.55000000000018}, 0},
+    CompressedTableEntry{CompressedTableData{566.4833333333333, 34473786.465841815, 0.0013023721135395287, 1249248.2545065738, 1294140.0607774772, 3104.6801056904897}, CompressedTableData{0.0, 0.0, 3.3742312691406205e-05, 55056.427690792014, 56219.42785325076, 97.32217959486388}, 1},
+    CompressedTableEntry{CompressedTableData{573.15, 50000000.0, 0.0012879, 1259600.0, 1324000.0, 3121.7999999999997}, CompressedTableData{0.0, 0.0, 2.245000000000003e-05, 45950.0, 47050.0, 83.50000000000023}, 0},
+    CompressedTableEntry{CompressedTableData{566.4833333333333, 20684271.87950509, 0.0013362704961323753, 1271368.5175965372, 1299001.4014565544, 3145.3758073752424}, CompressedTableData{0.0, 0.0, 4.226372931004992e-05, 59115.29825777258, 59999.178381241276, 103.83265450430736}, 1},
+    CompressedTableEntry{CompressedTableData{573.15, 30000000.0, 0.0013322, 1288900.0, 1328900.0, 3176.1}, CompressedTableData{0.0, 0.0, 2.760000000000002e-05, 48700.0, 49550.0, 87.99999999999977}, 0},
+    CompressedTableEntry{CompressedTableData{593.15, 50000000.0, 0.0013409, 1354300.0, 1421400.0, 3288.8}, CompressedTableData{0.0, 0.0, 2.649999999999994e-05, 47350.0, 48700.0, 83.50000000000023}, 0},
+    CompressedTableEntry{CompressedTableData{588.7055555555556, 34473786.465841815, 0.001369856738922341, 1359361.1098881578, 1406578.9164839787, 3299.3244648802174}, CompressedTableData{0.0, 0.0, 3.3742312691406205e-05, 55056.427690792014, 56219.42785325076, 97.32217959486388}, 1},
+    CompressedTableEntry{CompressedTableData{588.7055555555556, 20684271.87950509, 0.0014207979547524751, 1389599.1141120824, 1418999.758219037, 3353.041116383857}, CompressedTableData{0.0, 0.0, 4.226372931004992e-05, 59115.29825777258, 59999.178381241276, 103.83265450430736}, 1},
+    CompressedTableEntry{CompressedTableData{593.15, 30000000.0, 0.0014014, 1391700.0, 1433700.0, 3355.7999999999997}, CompressedTableData{0.0, 0.0, 3.4599999999999974e-05, 51400.0, 52400.0, 89.84999999999991}, 0},
+    CompressedTableEntry{CompressedTableData{613.15, 50000000.0, 0.0014049, 1452900.0, 1523100.0, 3457.5}, CompressedTableData{0.0, 0.0, 3.200000000000002e-05, 49300.0, 50850.0, 84.34999999999991}, 0},
+    CompressedTableEntry{CompressedTableData{610.9277777777778, 34473786.465841815, 0.0014581923031375856, 1476893.9063062281, 1527158.7733276905, 3500.290892953071}, CompressedTableData{0.0, 0.0, 4.4167782107622277e-05, 58766.398209035164, 60289.928421855904, 100.48321403642672}, 1},
+    CompressedTableEntry{CompressedTableData{613.15, 30000000.0, 0.0014932, 1502400.0, 1547100.0, 3543.8}, CompressedTableData{0.0, 0.0, 4.5900000000000086e-05, 55350.0, 56700.0, 94.00000000000023}, 0},
+    CompressedTableEntry{CompressedTableData{610.9277777777778, 20684271.87950509, 0.001546028443668221, 1522413.7326648594, 1554396.237132472, 3578.7096679073315}, CompressedTableData{0.0, 0.0, 6.261524445787291e-05, 66407.30927638849, 67698.2394567175, 112.83427576173722}, 1},
+    CompressedTableEntry{CompressedTableData{633.15, 50000000.0, 0.0014848, 1556500.0, 1630700.0, 3630.1}, CompressedTableData{0.0, 0.0, 3.9950000000000077e-05, 51800.0, 53800.0, 86.29999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{633.15, 34473786.465841815, 0.001583547647974484, 1606498.644410619, 1661089.8720364277, 3715.5761790261145}, CompressedTableData{0.0, 0.0, 4.404292618646996e-05, 36180.93505408836, 37704.4652669091, 59.012954243476315}, 1},
+    CompressedTableEntry{CompressedTableData{653.15, 50000000.0, 0.0015884, 1667100.0, 1746500.0, 3810.2}, CompressedTableData{0.0, 0.0, 5.179999999999996e-05, 55300.0, 57900.0, 90.04999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{633.15, 30000000.0, 0.0016276, 1626800.0, 1675600.0, 3749.8999999999996}, CompressedTableData{0.0, 0.0, 6.720000000000001e-05, 62200.0, 64250.0, 103.04999999999973}, 0},
+    CompressedTableEntry{CompressedTableData{644.2611111111112, 34473786.465841815, 0.001671633500347424, 1678860.5145187958, 1736498.802570246, 3833.602087513067}, CompressedTableData{0.0, 0.0, 4.404292618646996e-05, 36180.93505408836, 37704.4652669091, 59.012954243476315}, 1},
+    CompressedTableEntry{CompressedTableData{633.15, 20684271.87950509, 0.0017992362517650635, 1694793.6167444792, 1732032.8819464047, 3863.9145237473895}, CompressedTableData{0.0, 0.0, 0.00012660390404842128, 86189.94203980989, 88818.32240696636, 142.60242792002896}, 1},
+    CompressedTableEntry{CompressedTableData{633.15, 20000000.0, 0.0018248, 1703600.0, 1740100.0, 3878.7}, CompressedTableData{0.0, 0.0, 0.00012774999999999993, 81700.0, 84250.0, 135.04999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{653.15, 30000000.0, 0.0018729, 1782000.0, 1838200.0, 4002.6000000000004}, CompressedTableData{0.0, 0.0, 0.00012264999999999997, 77600.0, 81300.0, 126.35000000000036}, 0},
+    CompressedTableEntry{CompressedTableData{638.9, 20000000.0, 0.0020378, 1785800.0, 1826600.0, 4014.6}, CompressedTableData{0.0, 0.0, 0.00020335000000000015, 108950.0, 117100.0, 179.54999999999995}, 0},
+    CompressedTableEntry{CompressedTableData{641.7111111111111, 20684271.87950509, 0.0021434640263819247, 1822165.3945369495, 1866498.960729873, 4074.6361971829456}, CompressedTableData{0.0, 0.0, 0.00034391563481398055, 206572.08885590383, 218702.18055034755, 343.7991300250487}, 1},
+};
+inline constinit const logngine::core::RSTFrozenTree<CompressedTableEntry, 6, 16, 16> CompressedTable = {_baked_compressedtable_nodes, _baked_compressedtable_values};
+struct CompressedTableKnot {
+    constexpr CompressedTableKnot() = default;
+    constexpr CompressedTableKnot(const CompressedTableData& value, const CompressedTableData& d_dtemperature, const CompressedTableData& d_dpressure): value(value), d_dtemperature(d_dtemperature), d_dpressure(d_dpressure) {}
+    const CompressedTableData value{};
+    const CompressedTableData d_dtemperature{};
+    const CompressedTableData d_dpressure{};
+};
+inline constexpr CompressedTableKnot CompressedTableSpline[] = {
+    CompressedTableKnot{CompressedTableData{273.15000000000003, 3447378.6465841816, 0.000998472801454857, 23.26000324917282, 3465.74048412675, 0.04186800584851107}, CompressedTableData{1.0, 0.0, 2.4971184230419483e-08, 4191.452585500942, 4191.452585500942, 15.072482105463985}, CompressedTableData{0.0, 1.0, -4.977398083291401e-13, 1.0781763830721608e-05, 0.0010074958150176568, 3.744119197152346e-08}},
+    CompressedTableKnot{CompressedTableData{283.15000000000003, 3447378.6465841816, 0.0009987225132971611, 41937.7858582586, 45380.26633913617, 150.76668906048835}, CompressedTableData{1.0, 0.0, 4.018505663430591e-08, 4183.469559599425, 4183.824370660064, 14.628906578272888}, CompressedTableData{0.0, 1.0, -1.2701151940692166e-13, -6.2159740655728e-05, 0.0009369671651632238, -1.1010277579859912e-06}},
+    CompressedTableKnot{CompressedTableData{310.9277777777778, 3447378.6465841816, 0.0010055271609999612, 157842.38204888673, 161308.1225330135, 541.353315621248}, CompressedTableData{1.0, 0.0, 3.22527502402305e-07, 4172.984100914472, 4174.240015120603, 13.433678239895919}, CompressedTableData{0.0, 1.0, -4.17737722655182e-13, -0.00011609857278640571, 0.0008888973673575835, -3.527737585519706e-07}},
+    CompressedTableKnot{CompressedTableData{338.7055555555556, 3447378.6465841816, 0.0010186370327209516, 273770.2382427641, 277282.49873338913, 898.5711415207445}, CompressedTableData{1.0, 0.0, 5.474682430685578e-07, 4180.090968529232, 4182.182991029586, 12.354658839551233}, CompressedTableData{0.0, 1.0, -4.726968330693003e-13, -0.00019155144732002318, 0.0008230447329202695, -5.281935960019577e-07}},
+    CompressedTableKnot{CompressedTableData{366.48333333333335, 3447378.6465841816, 0.0010367411412880335, 390070.2544886281, 393652.29498900083, 1228.7841036479513}, CompressedTableData{1.0, 0.0, 7.263755315158973e-07, 4200.987471425249, 4203.499580602107, 11.475972553927344}, CompressedTableData{0.0, 1.0, -4.939766212480277e-13, -0.0002618083406185548, 0.0007666828538706676, -7.340854085257613e-07}},
+    CompressedTableKnot{CompressedTableData{394.2611111111111, 3447378.6465841816, 0.0010595273468983262, 507161.1108449641, 510812.9313550843, 1536.8907586871442}, CompressedTableData{1.0, 0.0, 9.013210219182474e-07, 4237.758936391495, 4240.685274664724, 10.76122639489534}, CompressedTableData{0.0, 1.0, -5.993763112768597e-13, -0.00035547273049609494, 0.0006964394958562852, -8.632110453443565e-07}},
+    CompressedTableKnot{CompressedTableData{422.0388888888889, 3447378.6465841816, 0.0010873077893547105, 625508.0073767555, 629252.8678998722, 1827.1616432348715}, CompressedTableData{1.0, 0.0, 1.0937912699935258e-06, 4295.369465701222, 4299.130948237454, 10.19182861612418}, CompressedTableData{0.0, 1.0, -6.649526201702535e-13, -0.0004636938573758018, 0.0006197981942678382, -1.0604012217552778e-06}},
+    CompressedTableKnot{CompressedTableData{449.8166666666667, 3447378.6465841816, 0.0011208316041841002, 745808.7441814772, 749669.9047208399, 2103.448613829196}, CompressedTableData{1.0, 0.0, 1.3263281101963217e-06, 4382.536651593471, 4387.132760575822, 9.758983037296519}, CompressedTableData{0.0, 1.0, -8.256739583202459e-13, -0.0005969346376204925, 0.0005214117644492806, -1.2931673815290776e-06}},
+    CompressedTableKnot{CompressedTableData{477.59444444444443, 3447378.6465841816, 0.0011617219183614749, 869016.9813923457, 873017.7019512034, 2369.5197909964836}, CompressedTableData{1.0, 0.0, 1.6331663756282253e-06, 4512.027370422803, 4517.861620401953, 9.465711937650822}, CompressedTableData{0.0, 1.0, -1.0147440596094284e-12, -0.0007610870197296747, 0.00039501982164870055, -1.575412572532116e-06}},
+    CompressedTableKnot{CompressedTableData{505.37222222222226, 3447378.6465841816, 0.0012126631341916089, 996551.5792075603, 1000738.3797924113, 2629.394503298192}, CompressedTableData{1.0, 0.0, 2.0020378820328543e-06, 4669.480714983459, 4676.562670695806, 9.31069305804841}, CompressedTableData{0.0, 1.0, -1.4842646968748124e-12, -0.0010248297433781692, 0.00015898162485511108, -2.0577269099993463e-06}},
+    CompressedTableKnot{CompressedTableData{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 1041303.8254589688, 1045560.4060535673, 2717.2335795683684}, CompressedTableData{1.0, 0.0, 2.143213435272558e-06, 4727.349956134683, 4734.72108392491, 9.27877566234256}, CompressedTableData{0.0, 1.0, -1.5453598020750763e-12, -0.0010720837548134404, 0.00012920823403976377, -2.09376958832285e-06}},
+    CompressedTableKnot{CompressedTableData{273.15, 5000000.0, 0.0009977, 40.0, 5030.0, 0.1}, CompressedTableData{1.0, 0.0, 9.499999999999959e-08, 4178.5, 4179.0, 14.764999999999997}, CompressedTableData{0.0, 1.0, 0.0, 0.0, 0.0, 0.0}},
+    CompressedTableKnot{CompressedTableData{293.15, 5000000.0, 0.0009996, 83610.0, 88610.0, 295.4}, CompressedTableData{1.0, 0.0, 1.4487499999999948e-07, 4171.9898729626075, 4172.991373112868, 14.242116058906031}, CompressedTableData{0.0, 1.0, -4.174774947180179e-13, -6.136436359589039e-05, 0.0009389479947897316, 0.0}},
+    CompressedTableKnot{CompressedTableData{313.15, 5000000.0, 0.0010057, 166920.0, 171950.0, 570.5}, CompressedTableData{1.0, 0.0, 3.667973856209146e-07, 4166.999460043196, 4168.749265367316, 13.319111194449652}, CompressedTableData{0.0, 1.0, -4.1959565303292427e-13, -0.00012148932436115133, 0.0008841696228966232, -3.9231505919667367e-07}},
+    CompressedTableKnot{CompressedTableData{333.15, 5000000.0, 0.0010149, 250290.0, 255360.0, 828.7}, CompressedTableData{1.0, 0.0, 5.169523809523805e-07, 4172.496165368484, 4175.244596131968, 12.534380231167793}, CompressedTableData{0.0, 1.0, -4.480292589131869e-13, -0.00017428517175515322, 0.0008356525660656464, -5.139722466237658e-07}},
+    CompressedTableKnot{CompressedTableData{353.15, 5000000.0, 0.0010267, 333820.0, 338960.0, 1072.3}, CompressedTableData{1.0, 0.0, 6.465134099616862e-07, 4183.986555927342, 4187.237447011762, 11.859271118601217}, CompressedTableData{0.0, 1.0, -4.688700510828385e-13, -0.00022632561942808528, 0.0007955589732408904, -6.487753733430858e-07}},
+    CompressedTableKnot{CompressedTableData{373.15, 5000000.0, 0.001041, 417650.0, 422850.0, 1303.3999999999999}, CompressedTableData{1.0, 0.0, 7.682200647249184e-07, 4202.22249985127, 4205.719907269809, 11.275918457788615}, CompressedTableData{0.0, 1.0, -4.996251700056747e-13, -0.0002841225298655299, 0.0007533541000315765, -7.701464036891648e-07}},
+    CompressedTableKnot{CompressedTableData{393.15, 5000000.0, 0.0010576, 501910.0, 507190.0, 1523.6000000000001}, CompressedTableData{1.0, 0.0, 8.924233983286888e-07, 4228.691339048182, 4233.187621803579, 10.769874709976799}, CompressedTableData{0.0, 1.0, -5.60329567887264e-13, -0.0003532443524100042, 0.0007040269480782317, -8.85069856631622e-07}},
+    CompressedTableKnot{CompressedTableData{413.15, 5000000.0, 0.0010769, 586800.0, 592180.0, 1734.3999999999999}, CompressedTableData{1.0, 0.0, 1.0258980582524308e-06, 4265.891643225504, 4271.1392449517125, 10.341324311261479}, CompressedTableData{0.0, 1.0, -6.285666107082719e-13, -0.0004234556305630853, 0.0006536819349124349, -1.0224525719169714e-06}},
+    CompressedTableKnot{CompressedTableData{433.15, 5000000.0, 0.0010988, 672550.0, 678040.0, 1937.4}, CompressedTableData{1.0, 0.0, 1.1717197452229305e-06, 4316.551804019227, 4322.54525475681, 9.98227341011517}, CompressedTableData{0.0, 1.0, -7.171541474462299e-13, -0.0005067959464059651, 0.0005893519497536491, -1.168734956132578e-06}},
+    CompressedTableKnot{CompressedTableData{453.15, 5000000.0, 0.001124, 759470.0, 765090.0, 2133.7999999999997}, CompressedTableData{1.0, 0.0, 1.3504972375690597e-06, 4383.916291269887, 4390.662434525166, 9.690822801134894}, CompressedTableData{0.0, 1.0, -8.205977049624785e-13, -0.0006066523225247654, 0.0005111376841968984, -1.3423681281933347e-06}},
+    CompressedTableKnot{CompressedTableData{473.15, 5000000.0, 0.0011531, 847920.0, 853680.0, 2325.1}, CompressedTableData{1.0, 0.0, 1.561576433121019e-06, 4472.429856919293, 4480.163811861853, 9.471596727368713}, CompressedTableData{0.0, 1.0, -9.822448640181552e-13, -0.0007276318487124116, 0.00041875336212612255, -1.5388268508174215e-06}},
+    CompressedTableKnot{CompressedTableData{493.15, 5000000.0, 0.0011868, 938390.0, 944320.0, 2512.7000000000003}, CompressedTableData{1.0, 0.0, 1.829036635006782e-06, 4590.978168554005, 4599.4800565155965, 9.329732047159707}, CompressedTableData{0.0, 1.0, -1.3015520879606576e-12, -0.000938128338117146, 0.00023454094107754547, -1.8465016379438627e-06}},
+    CompressedTableKnot{CompressedTableData{513.15, 5000000.0, 0.0012268, 1031599.9999999999, 1037700.0, 2698.3}, CompressedTableData{1.0, 0.0, 2.1961668545659502e-06, 4750.959444532113, 4762.585790744045, 9.284997307485183}, CompressedTableData{0.0, 1.0, -1.5570708331979544e-12, -0.0011002673923131265, 0.00011149481251251217, -2.1227369449036954e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 5000000.0, 0.0012755, 1128500.0, 1134900.0, 2884.1}, CompressedTableData{1.0, 0.0, 2.5993986130583898e-06, 4923.486908987807, 4929.48873280832, 9.289596258164172}, CompressedTableData{0.0, 1.0, -2.093829642134576e-12, -0.001396518034171784, -0.0001462147718595338, -2.685539647389838e-06}},
+    CompressedTableKnot{CompressedTableData{537.0899999999999, 5000000.0, 0.0012862, 1148100.0, 1154500.0, 2920.7000000000003}, CompressedTableData{1.0, 0.0, 2.715736040609175e-06, 4974.619289340176, 4974.619289340176, 9.289340101523074}, CompressedTableData{0.0, 1.0, -1.9786691132915238e-12, -0.0013535770391375239, -6.398793738674448e-05, -2.5558041293802795e-06}},
+    CompressedTableKnot{CompressedTableData{273.15000000000003, 6894757.293168363, 0.0009967248185587248, 69.78000974751845, 6954.740971502673, 0.20934002924255535}, CompressedTableData{1.0, 0.0, 3.7456776345672595e-08, 4177.496583551438, 4177.496583551439, 15.022240498445768}, CompressedTableData{0.0, 1.0, -5.035371109581154e-13, 1.5923239546742566e-05, 0.0010099943705806206, 3.9828786340090673e-08}},
+    CompressedTableKnot{CompressedTableData{283.15000000000003, 6894757.293168363, 0.0009970993863221815, 41844.745845261896, 48729.70680701706, 150.43174501370024}, CompressedTableData{1.0, 0.0, 5.8368439021753654e-08, 4170.814080925319, 4171.523028262141, 14.585709400589634}, CompressedTableData{0.0, 1.0, -4.595857355918179e-13, 0.0, 0.0009768000991943167, 0.0}},
+    CompressedTableKnot{CompressedTableData{310.9277777777778, 6894757.293168363, 0.0010040288899461336, 157446.9619936508, 164378.4429619043, 540.0554074399442}, CompressedTableData{1.0, 0.0, 3.2585990791634816e-07, 4162.935442545262, 4165.028548420163, 13.405519876994394}, CompressedTableData{0.0, 1.0, -4.4317300899335953e-13, -0.00011226129121308965, 0.000889968505291262, -3.8550134837928745e-07}},
+    CompressedTableKnot{CompressedTableData{338.7055555555556, 6894757.293168363, 0.0010170763337065479, 273118.9581517872, 280120.2191297883, 896.6452132517129}, CompressedTableData{1.0, 0.0, 5.443698064707252e-07, 4170.87998353462, 4174.643704845832, 12.332829222894203}, CompressedTableData{0.0, 1.0, -4.4142998280459565e-13, -0.00018685651620536703, 0.0008253088214397905, -5.732808051599423e-07}},
+    CompressedTableKnot{CompressedTableData{366.48333333333335, 6894757.293168363, 0.0010350555863524776, 389163.11436191044, 396303.93535940646, 1226.2720232970405}, CompressedTableData{1.0, 0.0, 7.200566021155702e-07, 4190.528506402932, 4195.968767412986, 11.454845723772582}, CompressedTableData{0.0, 1.0, -4.855210770236152e-13, -0.00026422481713653587, 0.0007690474782858967, -7.193993249896891e-07}},
+    CompressedTableKnot{CompressedTableData{394.2611111111111, 6894757.293168363, 0.0010575920801204658, 505928.330672758, 513231.97169299825, 1533.7925262543545}, CompressedTableData{1.0, 0.0, 8.904168687732111e-07, 4225.621306730897, 4231.897248515091, 10.738507289637731}, CompressedTableData{0.0, 1.0, -5.397357961094211e-13, -0.00035201338866626495, 0.0007054182440071301, -9.121909529090506e-07}},
+    CompressedTableKnot{CompressedTableData{422.0388888888889, 6894757.293168363, 0.0010849979548133932, 623926.3271558117, 631416.0482020453, 1823.3935227085055}, CompressedTableData{1.0, 0.0, 1.0792654058638884e-06, 4281.160244783553, 4288.271659831928, 10.166114931979784}, CompressedTableData{0.0, 1.0, -6.520298517876775e-13, -0.0004516957056933568, 0.0006299314287702458, -1.0883233250578742e-06}},
+    CompressedTableKnot{CompressedTableData{449.8166666666667, 6894757.293168363, 0.0011180847739187497, 743785.1238987992, 751484.1849742754, 2098.9268691975567}, CompressedTableData{1.0, 0.0, 1.3049531794590475e-06, 4363.761672057241, 4372.526337278489, 9.727146561090242}, CompressedTableData{0.0, 1.0, -7.753545790248945e-13, -0.0005796072851350482, 0.00053145653582466, -1.3129839057347127e-06}},
+    CompressedTableKnot{CompressedTableData{477.59444444444443, 6894757.293168363, 0.0011581635246086346, 866388.6010251892, 874366.7821396554, 2363.99321422448}, CompressedTableData{1.0, 0.0, 1.5964562905281902e-06, 4485.392606628399, 4496.658903253672, 9.421038364268123}, CompressedTableData{0.0, 1.0, -1.0270068649287205e-12, -0.0007544543009166902, 0.00039642612779714577, -1.6005419501832737e-06}},
+    CompressedTableKnot{CompressedTableData{505.37222222222226, 6894757.293168363, 0.0012077937532666695, 993039.3187169351, 1001366.399880139, 2622.4025463214903}, CompressedTableData{1.0, 0.0, 2.0090404014919996e-06, 4667.740300979885, 4681.903505455056, 9.270216839478545}, CompressedTableData{0.0, 1.0, -1.3650990477907924e-12, -0.0009971184125925486, 0.00019791967853731584, -1.9965289776531664e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 6894757.293168363, 0.0012715327010149133, 1125853.9372697119, 1134622.9584946502, 2879.011554167015}, CompressedTableData{1.0, 0.0, 2.6401530507566697e-06, 4945.735458537386, 4963.910382251761, 9.326353893863585}, CompressedTableData{0.0, 1.0, -2.0530776998593214e-12, -0.0013841655856038817, -0.00012322672806819806, -2.6359801166719768e-06}},
+    CompressedTableKnot{CompressedTableData{557.9555555555555, 6894757.293168363, 0.0013481318086418427, 1252737.2549939498, 1262017.9962903697, 3112.5094227841614}, CompressedTableData{1.0, 0.0, 3.0879819424070098e-06, 5115.116951928967, 5135.746204530687, 9.413127962169392}, CompressedTableData{0.0, 1.0, -3.0046191842100928e-12, -0.0018723200768390672, -0.0005649057383919003, -3.390661675913028e-06}},
+    CompressedTableKnot{CompressedTableData{273.15, 10000000.0, 0.0009952, 120.0, 10070.0, 0.3}, CompressedTableData{1.0, 0.0, 1.0500000000000527e-07, 4159.5, 4160.5, 14.7}, CompressedTableData{0.0, 1.0, 0.0, 0.0, 0.0, 0.0}},
+    CompressedTableKnot{CompressedTableData{293.15, 10000000.0, 0.0009973, 83310.0, 93280.0, 294.3}, CompressedTableData{1.0, 0.0, 1.568674698795242e-07, 4155.245653089465, 4157.497835237522, 14.187750791974656}, CompressedTableData{0.0, 1.0, -5.476387225522635e-13, -5.2349085099439814e-05, 0.0009432708770288265, -9.978683688789554e-08}},
+    CompressedTableKnot{CompressedTableData{313.15, 10000000.0, 0.0010035, 166330.0, 176370.0, 568.5}, CompressedTableData{1.0, 0.0, 3.70389610389612e-07, 4152.999036840838, 4156.748782101401, 13.279386872296408}, CompressedTableData{0.0, 1.0, -5.126512429312845e-13, -9.057653368463827e-05, 0.0008642600345678829, -2.8750863244201226e-07}},
+    CompressedTableKnot{CompressedTableData{333.15, 10000000.0, 0.0010127, 249430.0, 259550.0, 826.0}, CompressedTableData{1.0, 0.0, 5.150239234449745e-07, 4158.996152921375, 4164.243381161074, 12.504644426687971}, CompressedTableData{0.0, 1.0, -4.698867259000456e-13, -0.00018621165012624015, 0.0008453573999650238, -5.831029012149402e-07}},
+    CompressedTableKnot{CompressedTableData{353.15, 10000000.0, 0.0010244, 332690.0, 342940.0, 1069.1}, CompressedTableData{1.0, 0.0, 6.394186046511592e-07, 4169.98824940048, 4176.7374154546, 11.831619510135138}, CompressedTableData{0.0, 1.0, -5.258350727423629e-13, -0.00023334574304311988, 0.0008037848053915873, -7.269363717950097e-07}},
+    CompressedTableKnot{CompressedTableData{373.15, 10000000.0, 0.0010385, 416230.0, 426620.0, 1299.6000000000001}, CompressedTableData{1.0, 0.0, 7.581639344262275e-07, 4187.224908949788, 4194.7224506824, 11.243277777777775}, CompressedTableData{0.0, 1.0, -5.554545642051981e-13, -0.0002714968042021083, 0.0007667134157095356, -8.134718783013305e-07}},
+    CompressedTableKnot{CompressedTableData{393.15, 10000000.0, 0.0010549, 500180.0, 510730.0, 1519.1}, CompressedTableData{1.0, 0.0, 8.780736543909355e-07, 4212.198350050448, 4220.694900195464, 10.737468000930878}, CompressedTableData{0.0, 1.0, -4.896446113541412e-13, -0.0003444274608934695, 0.0006850160184600545, -9.275959104814222e-07}},
+    CompressedTableKnot{CompressedTableData{413.15, 10000000.0, 0.0010738, 584720.0, 595450.0, 1729.3}, CompressedTableData{1.0, 0.0, 1.0080000000000044e-06, 4246.905815870026, 4256.896405919661, 10.308717575757576}, CompressedTableData{0.0, 1.0, -5.960399110540117e-13, -0.0004500968167797839, 0.0006396475113441578, -1.078378504992921e-06}},
+    CompressedTableKnot{CompressedTableData{433.15, 10000000.0, 0.0010954, 670060.0, 681010.0, 1931.6}, CompressedTableData{1.0, 0.0, 1.1501298701298694e-06, 4293.830228225431, 4305.571154851072, 9.942094017094016}, CompressedTableData{0.0, 1.0, -7.87033683172776e-13, -0.0005133890563427771, 0.0005991696838368602, -1.2779702069812358e-06}},
+    CompressedTableKnot{CompressedTableData{453.15, 10000000.0, 0.00112, 756480.0, 767680.0, 2127.1}, CompressedTableData{1.0, 0.0, 1.3138636363636349e-06, 4356.21071961437, 4369.449281995538, 9.643247796785905}, CompressedTableData{0.0, 1.0, -9.12838671105017e-13, -0.0005877785401974799, 0.0005295894907411507, -1.2868872031076521e-06}},
+    CompressedTableKnot{CompressedTableData{473.15, 10000000.0, 0.0011482, 844320.0, 855800.0, 2317.4}, CompressedTableData{1.0, 0.0, 1.514187192118228e-06, 4437.768039204641, 4452.993375996407, 9.413937865108867}, CompressedTableData{0.0, 1.0, -1.0232506976134542e-12, -0.0007691920059966483, 0.00039192825058757987, -1.6357604923322848e-06}},
+    CompressedTableKnot{CompressedTableData{493.15, 10000000.0, 0.0011809, 934010.0, 945820.0, 2503.7}, CompressedTableData{1.0, 0.0, 1.7639577464788699e-06, 4546.14091708819, 4561.67101369863, 9.2546110210697}, CompressedTableData{0.0, 1.0, -1.3125333186211294e-12, -0.0009186366819111682, 0.00025485508095291913, -1.863589483672824e-06}},
+    CompressedTableKnot{CompressedTableData{513.15, 10000000.0, 0.0012192, 1026200.0, 1038300.0, 2687.6000000000004}, CompressedTableData{1.0, 0.0, 2.091978672985784e-06, 4688.3767791460095, 4710.356536502546, 9.182482983936842}, CompressedTableData{0.0, 1.0, -1.4817501930843675e-12, -0.0011375688239946115, 0.00018233477498737344, -2.0899727974210705e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 10000000.0, 0.0012653, 1121600.0, 1134300.0, 2871.0}, CompressedTableData{1.0, 0.0, 2.554671179883947e-06, 4887.055214723926, 4914.6924250127095, 9.222201138519916}, CompressedTableData{0.0, 1.0, -1.9074339867366253e-12, -0.0013244039550300854, -0.00015350078985258816, -2.6980687960813706e-06}},
+    CompressedTableKnot{CompressedTableData{553.15, 10000000.0, 0.0013226, 1221800.0, 1235000.0, 3056.5}, CompressedTableData{1.0, 0.0, 3.2557799547852272e-06, 5188.411934552455, 5218.090909090909, 9.441940179989418}, CompressedTableData{0.0, 1.0, -3.1151525054704903e-12, -0.0021412642675777234, -0.0007887870888448936, -3.9704906190475265e-06}},
+    CompressedTableKnot{CompressedTableData{573.15, 10000000.0, 0.001398, 1329400.0, 1343300.0, 3248.8}, CompressedTableData{1.0, 0.0, 4.3273652641430855e-06, 5607.126997990172, 5656.781802864363, 9.89407503114762}, CompressedTableData{0.0, 1.0, 6.880726640664232e-12, 0.001816144662927843, 0.0035525091201322077, 1.5130454813449926e-06}},
+    CompressedTableKnot{CompressedTableData{584.15, 10000000.0, 0.0014522, 1393300.0, 1407900.0, 3360.3}, CompressedTableData{1.0, 0.0, 4.927272727272739e-06, 5809.090909090909, 5872.727272727273, 10.136363636363637}, CompressedTableData{0.0, 1.0, 2.0891933953817382e-12, -1.693297212152908e-05, 0.0012288232900959568, -1.66703298088564e-06}},
+    CompressedTableKnot{CompressedTableData{273.15000000000003, 10342135.939752545, 0.0009950392636231687, 116.3000162458641, 10420.481455629424, 0.33494404678808853}, CompressedTableData{1.0, 0.0, 4.3699572403288305e-08, 4163.540581601935, 4163.540581601935, 14.971998891427557}, CompressedTableData{0.0, 1.0, -4.765812855999694e-13, 0.0, 0.0010148582021695658, 4.718126988744957e-08}},
+    CompressedTableKnot{CompressedTableData{283.15000000000003, 10342135.939752545, 0.0009954762593472016, 41751.70583226521, 52055.88727164877, 150.05493296106366}, CompressedTableData{1.0, 0.0, 6.712965649334917e-08, 4158.511749286724, 4159.219935760663, 14.5438794091013}, CompressedTableData{0.0, 1.0, -8.764879470459186e-13, 0.0, 0.0010388266641188036, 0.0}},
+    CompressedTableKnot{CompressedTableData{310.9277777777778, 10342135.939752545, 0.0010025306188923063, 157074.80194166405, 167425.50338754596, 538.7993672644889}, CompressedTableData{1.0, 0.0, 3.2911554064637136e-07, 4152.887120224659, 4156.652921655114, 13.377092706983204}, CompressedTableData{0.0, 1.0, -4.197256841835152e-13, -9.175674183703102e-05, 0.0008647140135459286, -3.067341448618745e-07}},
+    CompressedTableKnot{CompressedTableData{338.7055555555556, 10342135.939752545, 0.0010155156346921441, 272467.6780608104, 282981.19952943653, 894.6774169768329}, CompressedTableData{1.0, 0.0, 5.412701322879808e-07, 4161.24892716772, 4167.527674238456, 12.310422120611847}, CompressedTableData{0.0, 1.0, -4.74725729485039e-13, -0.0002009380410054909, 0.0008380356833073856, -7.400369444319059e-07}},
+    CompressedTableKnot{CompressedTableData{366.48333333333335, 10342135.939752545, 0.0010333700314169214, 388255.97423519264, 398955.5757298122, 1223.75994294613}, CompressedTableData{1.0, 0.0, 7.14619456487362e-07, 4180.901329999407, 4188.016401939869, 11.434420897072345}, CompressedTableData{0.0, 1.0, -4.964304169444215e-13, -0.00025443804649448996, 0.0007843999618082903, -8.040445878124162e-07}},
+    CompressedTableKnot{CompressedTableData{394.2611111111111, 10342135.939752545, 0.0010557192413031813, 504742.07050705014, 515651.0120309122, 1530.6942938215645}, CompressedTableData{1.0, 0.0, 8.817779173306163e-07, 4213.914912763876, 4223.109157068857, 10.717386773549602}, CompressedTableData{0.0, 1.0, -5.078723491810546e-13, -0.0003509087594621963, 0.0006818539099410156, -9.178281684716826e-07}},
+    CompressedTableKnot{CompressedTableData{422.0388888888889, 10342135.939752545, 0.001082812976193228, 622367.9069381171, 633579.2285042184, 1819.7091381938365}, CompressedTableData{1.0, 0.0, 1.064230558319826e-06, 4266.524893049849, 4277.823547184355, 10.141040433085843}, CompressedTableData{0.0, 1.0, -6.675863625751748e-13, -0.00046880397658814385, 0.0006415855458326179, -1.1475790828434724e-06}},
+    CompressedTableKnot{CompressedTableData{449.8166666666667, 10342135.939752545, 0.0011153379436533994, 741784.7636193704, 753321.7252309601, 2094.446992571766}, CompressedTableData{1.0, 0.0, 1.2817832528178717e-06, 4345.393041501883, 4358.755685690446, 9.695364393935558}, CompressedTableData{0.0, 1.0, -8.513611447987229e-13, -0.0005561616366722494, 0.0005512535293690978, -1.3241879619686838e-06}},
+    CompressedTableKnot{CompressedTableData{477.59444444444443, 10342135.939752545, 0.0011546675588163704, 863806.740664531, 875762.3823346058, 2358.550373464174}, CompressedTableData{1.0, 0.0, 1.5619875630560767e-06, 4460.397944691345, 4476.6914472700155, 9.378629965573355}, CompressedTableData{0.0, 1.0, -1.050327467119839e-12, -0.0007657213047690306, 0.0003979268316104194, -1.609519726101004e-06}},
+    CompressedTableKnot{CompressedTableData{505.37222222222226, 10342135.939752545, 0.0012030492282628826, 989643.358242556, 1002087.4599808634, 2615.5780613681836}, CompressedTableData{1.0, 0.0, 1.9513024730686383e-06, 4630.023226374098, 4650.017922948528, 9.206796158615125}, CompressedTableData{0.0, 1.0, -1.3350056923681073e-12, -0.0010110152895392729, 0.00029148526629384734, -1.9101132200730873e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 10342135.939752545, 0.0012646656253515374, 1121155.416613379, 1134227.5384394142, 2870.0518009154334}, CompressedTableData{1.0, 0.0, 2.5522550986842778e-06, 4894.230860303159, 4921.162418895166, 9.238025716468867}, CompressedTableData{0.0, 1.0, -1.8646513335515068e-12, -0.001300438903992857, -0.00011122815310891182, -2.656885319883658e-06}},
+    CompressedTableKnot{CompressedTableData{560.9277777777778, 10342135.939752545, 0.0013481318086418427, 1261855.1762676255, 1275811.178217129, 3128.8379450650805}, CompressedTableData{1.0, 0.0, 3.619457438899507e-06, 5351.279502425369, 5389.678107888911, 9.624784835069198}, CompressedTableData{0.0, 1.0, -3.4099371072853265e-12, -0.002189718381210678, -0.0007431223317659088, -3.921827194122838e-06}},
+    CompressedTableKnot{CompressedTableData{586.6277777777779, 10342135.939752545, 0.001464310243274048, 1407393.0165976998, 1422535.2787129113, 3384.4421207702403}, CompressedTableData{1.0, 0.0, 4.5205616588406616e-06, 5662.950985605994, 5709.108968707469, 9.94568777062877}, CompressedTableData{0.0, 1.0, -5.7745978326205714e-12, -0.003152733654976882, -0.0017680968495694574, -5.500174704556503e-06}},
+    CompressedTableKnot{CompressedTableData{273.15000000000003, 13789514.586336726, 0.000993353708687613, 162.82002274420975, 13862.961936507, 0.4186800584851107}, CompressedTableData{1.0, 0.0, 5.6185164518541417e-08, 4149.584579652432, 4149.584579652432, 14.921757284409344}, CompressedTableData{0.0, 1.0, -4.701519495000968e-13, 1.3890751854936593e-05, 0.0009977509077465825, 0.0}},
+    CompressedTableKnot{CompressedTableData{283.15000000000003, 13789514.586336726, 0.0009939155603327983, 41658.66581926852, 55358.80773303131, 149.63625290257855}, CompressedTableData{1.0, 0.0, 8.374837751846948e-08, 4145.853821737635, 4147.622169568021, 14.502040847704103}, CompressedTableData{0.0, 1.0, -1.2298563447775108e-13, -3.615532737851206e-05, 0.0009497448949047563, -2.562996391056806e-07}},
+    CompressedTableKnot{CompressedTableData{310.9277777777778, 13789514.586336726, 0.0010010323478384787, 156679.3818864281, 170495.82381643675, 537.5014590831851}, CompressedTableData{1.0, 0.0, 3.364391645034114e-07, 4145.947837051316, 4151.617954130021, 13.175764022665822}, CompressedTableData{0.0, 1.0, -4.4974437858733243e-13, -0.00010838615697861224, 0.0008839042249090461, -3.613097949067667e-07}},
+    CompressedTableKnot{CompressedTableData{366.48333333333335, 13789514.586336726, 0.0010317469044419417, 387372.0941117241, 401607.2161002179, 1221.289730601068}, CompressedTableData{1.0, 0.0, 6.790446443438569e-07, 4177.438566417659, 4187.249007666334, 11.451315170167973}, CompressedTableData{0.0, 1.0, -4.638375846075571e-13, -0.0002579012764355358, 0.0007627070399653695, -7.041569757543072e-07}},
+    CompressedTableKnot{CompressedTableData{422.0388888888889, 13789514.586336726, 0.001080627997573063, 620856.006726921, 635765.6688096406, 1816.066621685016}, CompressedTableData{1.0, 0.0, 1.0402100821302635e-06, 4264.587789074038, 4279.169563932289, 10.160685721685779}, CompressedTableData{0.0, 1.0, -6.205054402431144e-13, -0.0004341137790519239, 0.0006333878170675781, -1.042574250072437e-06}},
+    CompressedTableKnot{CompressedTableData{477.59444444444443, 13789514.586336726, 0.0011512964489452588, 861317.9203168695, 877181.2425328053, 2353.1912687155645}, CompressedTableData{1.0, 0.0, 1.4794050641136633e-06, 4422.926906343304, 4443.465707628686, 9.406898146844421}, CompressedTableData{0.0, 1.0, -9.59874132728241e-13, -0.0007176464651184695, 0.0004259328065938425, -1.4731245477020179e-06}},
+    CompressedTableKnot{CompressedTableData{505.37222222222226, 13789514.586336726, 0.0011985544151014002, 986363.6977844225, 1002878.3000913353, 2608.9629164441185}, CompressedTableData{1.0, 0.0, 1.898047752859977e-06, 4594.321740469368, 4620.989019840555, 9.149382233349963}, CompressedTableData{0.0, 1.0, -1.2790264085467251e-12, -0.0009449587293774693, 0.00024302019895005772, -1.8829745383566961e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 13789514.586336726, 0.0012581731174516181, 1116666.2359862886, 1134018.1984101715, 2861.510727722337}, CompressedTableData{1.0, 0.0, 2.479203731176734e-06, 4850.860603353177, 4886.004342894573, 9.156750459582936}, CompressedTableData{0.0, 1.0, -1.831208255070418e-12, -0.00129736790578995, -2.1979096447705956e-05, -2.434705973795644e-06}},
+    CompressedTableKnot{CompressedTableData{566.4833333333333, 13789514.586336726, 0.0013571214349648076, 1284440.6394225722, 1303164.9420381563, 3169.0730986854996}, CompressedTableData{1.0, 0.0, 3.603364231227508e-06, 5323.364525312832, 5374.040993986313, 9.52816734123034}, CompressedTableData{0.0, 1.0, -3.482542640099832e-12, -0.002151467219618032, -0.0008406318266214786, -3.8296651678578e-06}},
+    CompressedTableKnot{CompressedTableData{588.7055555555556, 13789514.586336726, 0.0014556327567539636, 1409021.2168251418, 1429094.599629178, 3387.037937132848}, CompressedTableData{1.0, 0.0, 5.52989691609962e-06, 6073.9644901790925, 6152.154436310931, 10.469033864842654}, CompressedTableData{0.0, 1.0, -5.950184229823315e-12, -0.0033509432928311234, -0.00198624268711509, -5.762467315880391e-06}},
+    CompressedTableKnot{CompressedTableData{608.6222222222223, 13789514.586336726, 0.0016002783414088909, 1540579.7952024634, 1562653.5382859285, 3610.026936282018}, CompressedTableData{1.0, 0.0, 7.262539815310167e-06, 6605.451634007792, 6705.888133393349, 11.196100375690566}, CompressedTableData{0.0, 1.0, -1.0318057752593413e-11, -0.00503620281488819, -0.003524909428930383, -8.640471793452828e-06}},
+    CompressedTableKnot{CompressedTableData{273.15, 15000000.0, 0.0009928, 180.0, 15070.0, 0.4}, CompressedTableData{1.0, 0.0, 1.1500000000000009e-07, 4141.5, 4143.0, 14.64}, CompressedTableData{0.0, 1.0, -4.800000000000117e-13, 1e-05, 0.000992, 1.9999999999999997e-08}},
+    CompressedTableKnot{CompressedTableData{293.15, 15000000.0, 0.0009951, 83010.0, 97930.0, 293.2}, CompressedTableData{1.0, 0.0, 1.6776470588235336e-07, 4139.248776952346, 4142.49993964997, 14.1383821971035}, CompressedTableData{0.0, 1.0, -4.161866339115316e-13, -5.607499964005352e-05, 0.0009294512119678161, -1.0021153628385332e-07}},
+    CompressedTableKnot{CompressedTableData{313.15, 15000000.0, 0.0010013, 165750.0, 180770.0, 566.6}, CompressedTableData{1.0, 0.0, 3.7038961038960846e-07, 4139.248776952346, 4145.24745190278, 13.242006789890608}, CompressedTableData{0.0, 1.0, -4.192657928747174e-13, -0.0001165887056958763, 0.0008712131983924683, -1.2385916028649325e-07}},
+    CompressedTableKnot{CompressedTableData{333.15, 15000000.0, 0.0010105, 248580.0, 263740.0, 823.4}, CompressedTableData{1.0, 0.0, 5.130769230769178e-07, 4145.995115774241, 4153.7433644297325, 12.472261165631888}, CompressedTableData{0.0, 1.0, -3.692188053959932e-13, -0.00016102515142337094, 0.0008360255331858979, 0.0}},
+    CompressedTableKnot{CompressedTableData{353.15, 15000000.0, 0.0010221, 331590.0, 346920.0, 1065.9}, CompressedTableData{1.0, 0.0, 6.343750000000045e-07, 4156.74060263427, 4166.237383738374, 11.801598221845893}, CompressedTableData{0.0, 1.0, -5.428118830094127e-13, -0.0001874741209385339, 0.0008185265593671346, 0.0}},
+    CompressedTableKnot{CompressedTableData{373.15, 15000000.0, 0.0010361, 414850.0, 430390.0, 1295.8}, CompressedTableData{1.0, 0.0, 7.488372093023293e-07, 4172.727218261339, 4183.973649617591, 11.21588327021608}, CompressedTableData{0.0, 1.0, -3.525825360954388e-13, -0.00028864234884616656, 0.0007339228994672752, -8.407640601591829e-07}},
+    CompressedTableKnot{CompressedTableData{393.15, 15000000.0, 0.0010522, 498500.0, 514280.0, 1514.8}, CompressedTableData{1.0, 0.0, 8.629971181556179e-07, 4195.95656577693, 4208.950047517224, 10.707234539089848}, CompressedTableData{0.0, 1.0, -4.4667171643267173e-13, -0.00030429859338337, 0.0007324769481932343, -8.32312409577218e-07}},
+    CompressedTableKnot{CompressedTableData{413.15, 15000000.0, 0.0010708, 582690.0, 598750.0, 1724.3}, CompressedTableData{1.0, 0.0, 9.907537688442203e-07, 4228.166853899367, 4243.158074589053, 10.273704694721477}, CompressedTableData{0.0, 1.0, -6.085245329191915e-13, -0.0003481943885750402, 0.0007033043524158742, -8.303508713979749e-07}},
+    CompressedTableKnot{CompressedTableData{433.15, 15000000.0, 0.001092, 667630.0, 684010.0, 1925.8999999999999}, CompressedTableData{1.0, 0.0, 1.12566371681416e-06, 4272.100766574989, 4289.08935128519, 9.90449659348978}, CompressedTableData{0.0, 1.0, -6.393761147072861e-13, -0.0005284317424931391, 0.0005390542531318551, -1.2148860334822068e-06}},
+    CompressedTableKnot{CompressedTableData{453.15, 15000000.0, 0.001116, 753580.0, 770320.0, 2120.6}, CompressedTableData{1.0, 0.0, 1.2815533980582497e-06, 4330.0023093354885, 4349.48031496063, 9.600671700078108}, CompressedTableData{0.0, 1.0, -8.905740278870583e-13, -0.000627552750019177, 0.0004630153513362671, -1.0985904841280766e-06}},
+    CompressedTableKnot{CompressedTableData{473.15, 15000000.0, 0.0011435, 840840.0, 858000.0, 2310.0}, CompressedTableData{1.0, 0.0, 1.472550675675674e-06, 4405.335186971572, 4427.317712156287, 9.361265687583444}, CompressedTableData{0.0, 1.0, -9.916092246831812e-13, -0.0006957638739431932, 0.00044017323126837866, -1.2403874598637334e-06}},
+    CompressedTableKnot{CompressedTableData{493.15, 15000000.0, 0.0011752, 929810.0, 947430.0, 2495.1}, CompressedTableData{1.0, 0.0, 1.7051457725947529e-06, 4503.316107904085, 4529.244536423841, 9.184466521502452}, CompressedTableData{0.0, 1.0, -9.98189734803392e-13, -0.0007894307204111219, 0.0003710627301906171, -1.7350778288794582e-06}},
+    CompressedTableKnot{CompressedTableData{513.15, 15000000.0, 0.0012121, 1021000.0, 1039200.0, 2677.4}, CompressedTableData{1.0, 0.0, 2.0048391089108923e-06, 4631.107453181499, 4663.019778099372, 9.087416781292985}, CompressedTableData{0.0, 1.0, -1.3492627822817562e-12, -0.0009908221861507688, 0.00021078112430006305, -1.9769399090145714e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 15000000.0, 0.001256, 1115100.0, 1134000.0, 2858.6}, CompressedTableData{1.0, 0.0, 2.413374358974357e-06, 4807.707900207901, 4842.724458204334, 9.089900990099009}, CompressedTableData{0.0, 1.0, -1.7810387746172144e-12, -0.0012634125977814476, 0.0, -2.3784441718178148e-06}},
+    CompressedTableKnot{CompressedTableData{553.15, 15000000.0, 0.0013096, 1213400.0, 1233000.0, 3041.0}, CompressedTableData{1.0, 0.0, 3.0108912510220783e-06, 5058.202469135803, 5102.643171806168, 9.231129163281889}, CompressedTableData{0.0, 1.0, -2.580211820012351e-12, -0.0015924995174613084, -0.000345583555880864, -2.832945669477927e-06}},
+    CompressedTableKnot{CompressedTableData{573.15, 15000000.0, 0.0013783, 1317600.0, 1338300.0, 3227.9}, CompressedTableData{1.0, 0.0, 3.986866218692735e-06, 5450.828375286041, 5512.764705882352, 9.623919024137031}, CompressedTableData{0.0, 1.0, -3.42251646109544e-12, -0.002137743141031163, -0.000810860176549297, -3.843638669090872e-06}},
+    CompressedTableKnot{CompressedTableData{593.15, 15000000.0, 0.0014733, 1431900.0, 1454000.0, 3426.2999999999997}, CompressedTableData{1.0, 0.0, 5.929984177215188e-06, 6210.4674390731125, 6301.802439984259, 10.634536950420951}, CompressedTableData{0.0, 1.0, -6.969932024665026e-12, -0.003645656269475843, -0.0022337446001785602, -6.258111845364916e-06}},
+    CompressedTableKnot{CompressedTableData{613.15, 15000000.0, 0.0016311, 1567900.0, 1592400.0, 3655.5}, CompressedTableData{1.0, 0.0, 1.0116433005066462e-05, 7597.147836800013, 7728.512016841498, 12.710782836015078}, CompressedTableData{0.0, 1.0, -1.2359999999999976e-11, -0.00554, -0.00416, -9.380000000000019e-06}},
+    CompressedTableKnot{CompressedTableData{615.31, 15000000.0, 0.0016572, 1585500.0, 1610300.0, 3684.8}, CompressedTableData{1.0, 0.0, 1.2083333333333528e-05, 8148.148148148268, 8287.037037037158, 13.564814814815099}, CompressedTableData{0.0, 1.0, -1.3915141401576841e-11, -0.006035624503979041, -0.004640738430676423, -1.0189033853404817e-05}},
+    CompressedTableKnot{CompressedTableData{273.15, 20000000.0, 0.0009904, 230.0, 20030.0, 0.5}, CompressedTableData{1.0, 0.0, 1.249999999999949e-07, 4124.0, 4127.0, 14.580000000000002}, CompressedTableData{0.0, 1.0, -4.800000000000117e-13, 1e-05, 0.000992, 1.9999999999999997e-08}},
+    CompressedTableKnot{CompressedTableData{293.15, 20000000.0, 0.0009929, 82710.0, 102570.0, 292.1}, CompressedTableData{1.0, 0.0, 1.7897727272726832e-07, 4123.499939371893, 4128.249621510325, 14.086332210600958}, CompressedTableData{0.0, 1.0, -5.020273411195607e-13, -5.625369657108171e-05, 0.0009252210964529855, -3.468772689595304e-07}},
+    CompressedTableKnot{CompressedTableData{313.15, 20000000.0, 0.0009992, 165170.0, 185160.0, 564.6}, CompressedTableData{1.0, 0.0, 3.7393548387097137e-07, 4125.997818710615, 4133.745630480798, 13.204936637034235}, CompressedTableData{0.0, 1.0, -4.421394314847772e-13, -0.00010183204210888602, 0.0008725171657059563, -6.099879616270377e-07}},
+    CompressedTableKnot{CompressedTableData{333.15, 20000000.0, 0.0010084, 247750.0, 267920.0, 820.8}, CompressedTableData{1.0, 0.0, 5.111111111111115e-07, 4133.245629952217, 4143.492699408713, 12.442236498695042}, CompressedTableData{0.0, 1.0, -5.225756477115866e-13, -0.00017406486789501115, 0.0008194101683042943, -1.0563182626901537e-06}},
+    CompressedTableKnot{CompressedTableData{353.15, 20000000.0, 0.0010199, 330500.0, 350900.0, 1062.7}, CompressedTableData{1.0, 0.0, 6.272727272727277e-07, 4143.740573152338, 4156.237353383459, 11.771576825127335}, CompressedTableData{0.0, 1.0, -2.4303983315382645e-13, -0.000255836783533814, 0.0007537394063568043, -1.0566383517004474e-06}},
+    CompressedTableKnot{CompressedTableData{373.15, 20000000.0, 0.0010337, 413500.0, 434170.0, 1292.0}, CompressedTableData{1.0, 0.0, 7.387878787878769e-07, 4158.73159002104, 4173.476039295557, 11.188488164359086}, CompressedTableData{0.0, 1.0, -6.44461909262996e-13, -0.0002456507653690562, 0.0007873709885493061, -4.884315236710706e-07}},
+    CompressedTableKnot{CompressedTableData{393.15, 20000000.0, 0.0010496, 496850.0, 517840.00000000006, 1510.5}, CompressedTableData{1.0, 0.0, 8.507894736842114e-07, 4180.211111775611, 4197.453305539011, 10.679609265325224}, CompressedTableData{0.0, 1.0, -6.459653171373903e-13, -0.00036908133868818356, 0.0006687210997750037, -9.271904885998609e-07}},
+    CompressedTableKnot{CompressedTableData{413.15, 20000000.0, 0.0010679, 580710.0, 602070.0, 1719.4}, CompressedTableData{1.0, 0.0, 9.713076923076926e-07, 4210.675176631242, 4230.166893209619, 10.241095656417764}, CompressedTableData{0.0, 1.0, -5.477670650463325e-13, -0.00046191246529330256, 0.0005741258739397558, -1.2149176204361425e-06}},
+    CompressedTableKnot{CompressedTableData{433.15, 20000000.0, 0.0010886, 665280.0, 687050.0, 1920.3}, CompressedTableData{1.0, 0.0, 1.1027539503385977e-06, 4251.62286117481, 4273.606668616555, 9.869485945809068}, CompressedTableData{0.0, 1.0, -6.383054077794628e-13, -0.0003671604020523923, 0.0006943065453788752, -9.383235991495009e-07}},
+    CompressedTableKnot{CompressedTableData{453.15, 20000000.0, 0.0011122, 750780.0, 773020.0, 2114.3}, CompressedTableData{1.0, 0.0, 1.254920634920639e-06, 4305.037454270948, 4330.263537697725, 9.557949790794988}, CompressedTableData{0.0, 1.0, -5.01628455582891e-13, -0.0004455125443056223, 0.0006470594715929036, -1.55140616521722e-06}},
+    CompressedTableKnot{CompressedTableData{473.15, 20000000.0, 0.001139, 837490.0, 860270.0, 2302.7000000000003}, CompressedTableData{1.0, 0.0, 1.43088695652174e-06, 4374.397851305789, 4403.118258203702, 9.308700322234147}, CompressedTableData{0.0, 1.0, -7.471629631646515e-13, -0.000647793803726327, 0.0004941127986849497, -1.7186142633506813e-06}},
+    CompressedTableKnot{CompressedTableData{493.15, 20000000.0, 0.0011697, 925770.0, 949160.0, 2486.7}, CompressedTableData{1.0, 0.0, 1.6484464555052802e-06, 4464.661777056156, 4497.607736341911, 9.12184160043848}, CompressedTableData{0.0, 1.0, -1.1985336669562872e-12, -0.0008423809650267665, 0.0003125080125943072, -1.5324253790072705e-06}},
+    CompressedTableKnot{CompressedTableData{513.15, 20000000.0, 0.0012053, 1016100.0, 1040200.0, 2667.6000000000004}, CompressedTableData{1.0, 0.0, 1.9246967741935457e-06, 4579.848823882552, 4619.969703527376, 9.00482232093282}, CompressedTableData{0.0, 1.0, -1.349515298568975e-12, -0.0009885539975615155, 0.0001892925208170067, -1.9725942154945023e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 20000000.0, 0.0012472, 1109000.0, 1134000.0, 2846.9}, CompressedTableData{1.0, 0.0, 2.2920432432432404e-06, 4735.693931398418, 4780.7109252483015, 8.972493730844237}, CompressedTableData{0.0, 1.0, -1.6979128820352846e-12, -0.0011658005932569434, 0.0, -2.369860885041998e-06}},
+    CompressedTableKnot{CompressedTableData{553.15, 20000000.0, 0.0012978, 1205600.0, 1231500.0, 3026.5}, CompressedTableData{1.0, 0.0, 2.8120983318700643e-06, 4951.846619576186, 5006.362275449102, 9.054378796245164}, CompressedTableData{0.0, 1.0, -2.0158837239042993e-12, -0.0015109312640287156, -0.00019039430688858579, -2.995345894700192e-06}},
+    CompressedTableKnot{CompressedTableData{573.15, 20000000.0, 0.0013611, 1307200.0, 1334400.0, 3209.1}, CompressedTableData{1.0, 0.0, 3.6079279891304376e-06, 5267.791469194313, 5342.144859813084, 9.323318145269363}, CompressedTableData{0.0, 1.0, -3.5549083079119758e-12, -0.0021252967706223654, -0.0008144283982767628, -3.6919301635488905e-06}},
+    CompressedTableKnot{CompressedTableData{593.15, 20000000.0, 0.001445, 1416600.0, 1445500.0, 3399.6}, CompressedTableData{1.0, 0.0, 5.009015369836695e-06, 5803.364806866954, 5906.285834738617, 9.966082603254069}, CompressedTableData{0.0, 1.0, -5.4241287973394515e-12, -0.0029502702137903874, -0.001592860915072498, -5.165257434899522e-06}},
+    CompressedTableKnot{CompressedTableData{613.15, 20000000.0, 0.0015693, 1540200.0, 1571600.0, 3608.6}, CompressedTableData{1.0, 0.0, 8.361940494997362e-06, 7037.017421602788, 7212.440597420231, 11.782696723022331}, CompressedTableData{0.0, 1.0, -1.0374746826257705e-11, -0.004696200848118276, -0.003298564936795338, -8.001449072284575e-06}},
+    CompressedTableKnot{CompressedTableData{633.15, 20000000.0, 0.0018248, 1703600.0, 1740100.0, 3878.7}, CompressedTableData{1.0, 0.0, 2.087392920798048e-05, 10948.373048392083, 11393.708892306264, 18.09906680949857}, CompressedTableData{0.0, 1.0, -3.735905127860252e-11, -0.012869713807164165, -0.011789346157889702, -2.1607604660451867e-05}},
+    CompressedTableKnot{CompressedTableData{638.9, 20000000.0, 0.0020378, 1785800.0, 1826600.0, 4014.6}, CompressedTableData{1.0, 0.0, 3.704347826086962e-05, 14295.652173913044, 15043.478260869566, 23.63478260869567}, CompressedTableData{0.0, 1.0, -2.9657638382284374e-11, -0.01176628731344873, -0.010362566779505054, -1.9649459449964972e-05}},
+    CompressedTableKnot{CompressedTableData{273.15000000000003, 20684271.87950509, 0.0009900450267770772, 232.6000324917282, 20701.40289176381, 0.4605480643336217}, CompressedTableData{1.0, 0.0, 6.867075663375116e-08, 4123.99857607834, 4126.324576403257, 14.833834472127473}, CompressedTableData{0.0, 1.0, -4.988240979077091e-13, 4.40045127559544e-06, 0.0009818830446163423, -3.14145810859103e-08}},
+    CompressedTableKnot{CompressedTableData{283.15000000000003, 20684271.87950509, 0.0009907317343434148, 41472.58579327513, 61964.64865579639, 148.79889278560833}, CompressedTableData{1.0, 0.0, 9.987099125430758e-08, 4122.585893390575, 4126.049992080509, 14.425210848456505}, CompressedTableData{0.0, 1.0, -6.876780862198266e-13, 0.0, 0.0009659803080567101, 0.0}},
+    CompressedTableKnot{CompressedTableData{310.9277777777778, 20684271.87950509, 0.0009980982336913998, 155935.0617824546, 176566.68466447087, 534.9056427205775}, CompressedTableData{1.0, 0.0, 3.4399088461671e-07, 4126.778359165002, 4134.766098215749, 13.123334473585784}, CompressedTableData{0.0, 1.0, -3.992602479573393e-13, -0.00010152710270519212, 0.0008694554942052946, -3.737589019387024e-07}},
+    CompressedTableKnot{CompressedTableData{366.48333333333335, 20684271.87950509, 0.0010285006504919822, 385627.5938680362, 406910.49684102926, 1216.391173916792}, CompressedTableData{1.0, 0.0, 6.694350340491889e-07, 4157.572454289222, 4172.192009745374, 11.409664226057409}, CompressedTableData{0.0, 1.0, -4.994136460432323e-13, -0.0002476271728716276, 0.0007795525506806685, -6.705710278645967e-07}},
+    CompressedTableKnot{CompressedTableData{422.0388888888889, 20684271.87950509, 0.0010763828962538852, 617901.9863142759, 640161.8094237344, 1808.865324679072}, CompressedTableData{1.0, 0.0, 1.0140858232859065e-06, 4236.910732577135, 4258.570334863795, 10.111212389319254}, CompressedTableData{0.0, 1.0, -5.801282381621979e-13, -0.0004236363453813559, 0.0006338515111603862, -1.0610430997494338e-06}},
+    CompressedTableKnot{CompressedTableData{477.59444444444443, 20684271.87950509, 0.0011448039410453398, 856479.8396410416, 880181.7829519487, 2342.891739276831}, CompressedTableData{1.0, 0.0, 1.4238764197125812e-06, 4379.330670228384, 4408.899919805076, 9.33271175180602}, CompressedTableData{0.0, 1.0, -9.27835151800341e-13, -0.0006884838362096784, 0.0004542933473184431, -1.4931872920015761e-06}},
+    CompressedTableKnot{CompressedTableData{505.37222222222226, 20684271.87950509, 0.0011900017845024684, 980083.496907146, 1004692.5803447707, 2596.235042666171}, CompressedTableData{1.0, 0.0, 1.8016718659458143e-06, 4529.903302899915, 4567.008580909297, 9.04206931713521}, CompressedTableData{0.0, 1.0, -1.1558927044155264e-12, -0.0008752588027443888, 0.0002920977309716573, -1.81461270907085e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 20684271.87950509, 0.0012460620930998462, 1108222.854806839, 1133994.9384069224, 2845.265941453115}, CompressedTableData{1.0, 0.0, 2.3019448928344987e-06, 4745.274956110712, 4793.533751583028, 8.983585096246513}, CompressedTableData{0.0, 1.0, -1.6301030962676636e-12, -0.0011296556692732898, 0.0, -2.3077170442773833e-06}},
+    CompressedTableKnot{CompressedTableData{566.4833333333333, 20684271.87950509, 0.0013362704961323753, 1271368.5175965372, 1299001.4014565544, 3145.3758073752424}, CompressedTableData{1.0, 0.0, 3.1984315456251596e-06, 5112.705089561646, 5180.295356980464, 9.182335055447435}, CompressedTableData{0.0, 1.0, -2.6874946738427135e-12, -0.0017358017646651595, -0.0004304742215252728, -3.1227493198448366e-06}},
+    CompressedTableKnot{CompressedTableData{588.7055555555556, 20684271.87950509, 0.0014207979547524751, 1389599.1141120824, 1418999.758219037, 3353.041116383857}, CompressedTableData{1.0, 0.0, 4.541841481926428e-06, 5629.454604775201, 5725.495366511564, 9.733182743968982}, CompressedTableData{0.0, 1.0, -4.129215143686456e-12, -0.002357049525269632, -0.0010154363207660873, -4.157715095017445e-06}},
+    CompressedTableKnot{CompressedTableData{610.9277777777778, 20684271.87950509, 0.001546028443668221, 1522413.7326648594, 1554396.237132472, 3578.7096679073315}, CompressedTableData{1.0, 0.0, 7.541098263577035e-06, 6751.468823147387, 6914.999394529013, 11.338540859532223}, CompressedTableData{0.0, 1.0, -7.548095949777742e-12, -0.0035783036170287355, -0.002208810456298638, -6.136178832202626e-06}},
+    CompressedTableKnot{CompressedTableData{633.15, 20684271.87950509, 0.0017992362517650635, 1694793.6167444792, 1732032.8819464047, 3863.9145237473895}, CompressedTableData{1.0, 0.0, 1.935550761977408e-05, 10695.154278568656, 11130.943596975912, 17.69470056826866}, CompressedTableData{0.0, 1.0, -2.7349083924403637e-11, -0.010119044169771036, -0.008818018579974805, -1.6978827610339468e-05}},
+    CompressedTableKnot{CompressedTableData{641.7111111111111, 20684271.87950509, 0.0021434640263819247, 1822165.3945369495, 1866498.960729873, 4074.6361971829456}, CompressedTableData{1.0, 0.0, 4.0208305925395766e-05, 14877.949385233354, 15706.61530241677, 24.613822984036346}, CompressedTableData{0.0, 1.0, -4.5181031103112496e-11, -0.0140971386996909, -0.013306982926014465, -2.3633207711680167e-05}},
+    CompressedTableKnot{CompressedTableData{273.15, 30000000.0, 0.0009857, 290.0, 29860.0, 0.3}, CompressedTableData{1.0, 0.0, 1.4500000000000624e-07, 4091.0, 4095.5, 14.469999999999999}, CompressedTableData{0.0, 1.0, 0.0, 0.0, 0.0, 0.0}},
+    CompressedTableKnot{CompressedTableData{293.15, 30000000.0, 0.0009886, 82110.0, 111770.0, 289.7}, CompressedTableData{1.0, 0.0, 2.0053191489362295e-07, 4093.997801660967, 4100.992623750305, 13.994896502498214}, CompressedTableData{0.0, 1.0, -4.188119924656588e-13, -5.9541374813932676e-05, 0.0009189217512481804, -2.5429151108090976e-07}},
+    CompressedTableKnot{CompressedTableData{313.15, 30000000.0, 0.0009951, 164050.0, 193900.0, 560.6999999999999}, CompressedTableData{1.0, 0.0, 3.7916666666666565e-07, 4100.746570749253, 4112.241959997568, 13.13517779045446}, CompressedTableData{0.0, 1.0, -4.132320797497567e-13, -0.0001110423260222374, 0.0008736696134095717, -4.109723545412005e-07}},
+    CompressedTableKnot{CompressedTableData{333.15, 30000000.0, 0.0010042, 246140.0, 276260.0, 815.6}, CompressedTableData{1.0, 0.0, 5.040686274509768e-07, 4108.745603894128, 4123.991270611057, 12.38247327012306}, CompressedTableData{0.0, 1.0, -4.1838352212458417e-13, -0.0001605116165083913, 0.0008328923962086706, -5.262883036440543e-07}},
+    CompressedTableKnot{CompressedTableData{353.15, 30000000.0, 0.0010155, 328400.0, 358860.0, 1056.4}, CompressedTableData{1.0, 0.0, 6.151209677419336e-07, 4118.243307230013, 4136.988155668359, 11.71917288424643}, CompressedTableData{0.0, 1.0, -4.15299990266666e-13, -0.00020901111458427316, 0.000794277358686652, -6.559998215501946e-07}},
+    CompressedTableKnot{CompressedTableData{373.15, 30000000.0, 0.001029, 410870.0, 441740.0, 1284.7}, CompressedTableData{1.0, 0.0, 7.21551724137935e-07, 4131.484509258139, 4153.478271337426, 11.133211400359064}, CompressedTableData{0.0, 1.0, -4.733649863513961e-13, -0.00025440358520946845, 0.000760201977562386, -7.144159882496836e-07}},
+    CompressedTableKnot{CompressedTableData{393.15, 30000000.0, 0.0010445, 493660.0, 525000.0, 1502.0}, CompressedTableData{1.0, 0.0, 8.285285285285291e-07, 4150.719508522557, 4175.462579331816, 10.622192425311688}, CompressedTableData{0.0, 1.0, -5.103382678154276e-13, -0.0003142412920863514, 0.0007146008302677232, -8.323328989580908e-07}},
+    CompressedTableKnot{CompressedTableData{413.15, 30000000.0, 0.0010623, 576900.0, 608760.0, 1709.8}, CompressedTableData{1.0, 0.0, 9.4179894179894e-07, 4176.946133588701, 4205.17924023542, 10.180873834069713}, CompressedTableData{0.0, 1.0, -5.569931459416604e-13, -0.00037803304895180724, 0.0006679299203580825, -9.593572104671695e-07}},
+    CompressedTableKnot{CompressedTableData{433.15, 30000000.0, 0.0010823, 660740.0, 693210.0, 1909.4}, CompressedTableData{1.0, 0.0, 1.061032863849767e-06, 4212.400237388724, 4244.633370634313, 9.801876593574708}, CompressedTableData{0.0, 1.0, -6.295592578224488e-13, -0.00043624357689006393, 0.0006261894696428529, -1.050706690226599e-06}},
+    CompressedTableKnot{CompressedTableData{453.15, 30000000.0, 0.0011049, 745400.0, 778550.0, 2102.0}, CompressedTableData{1.0, 0.0, 1.1981288981288964e-06, 4259.088219757, 4295.064198824282, 9.482783342119138}, CompressedTableData{0.0, 1.0, -6.996206784050492e-13, -0.0005169176085770227, 0.000565293395318096, -1.2333779261079523e-06}},
+    CompressedTableKnot{CompressedTableData{473.15, 30000000.0, 0.0011304, 831110.0, 865020.0, 2288.8}, CompressedTableData{1.0, 0.0, 1.3590659340659317e-06, 4318.494008683068, 4359.202718201628, 9.215871982641708}, CompressedTableData{0.0, 1.0, -8.191001094484433e-13, -0.0006209658953643221, 0.0004851249131541365, -1.3950708519817517e-06}},
+    CompressedTableKnot{CompressedTableData{493.15, 30000000.0, 0.0011595, 918150.0, 952930.0, 2470.7}, CompressedTableData{1.0, 0.0, 1.550754414125204e-06, 4394.3341487001535, 4441.513226024314, 9.006650013877318}, CompressedTableData{0.0, 1.0, -1.0032951536913042e-12, -0.0007423641931801959, 0.0003875309268483421, -1.5414584073431966e-06}},
+    CompressedTableKnot{CompressedTableData{513.15, 30000000.0, 0.0011927, 1006900.0, 1042700.0, 2649.1}, CompressedTableData{1.0, 0.0, 1.7869819193324064e-06, 4490.606735318675, 4543.566045001926, 8.857058989556878}, CompressedTableData{0.0, 1.0, -1.2037325243756978e-12, -0.00088871233723996, 0.00026696638048770237, -1.8007389337659133e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 30000000.0, 0.0012314, 1097800.0, 1134700.0, 2825.0}, CompressedTableData{1.0, 0.0, 2.093380782918144e-06, 4613.938244853738, 4676.2159273115985, 8.77495441595443}, CompressedTableData{0.0, 1.0, -1.5124002732347793e-12, -0.0010822071068404793, 0.00010143694437444083, -2.10852445498089e-06}},
+    CompressedTableKnot{CompressedTableData{553.15, 30000000.0, 0.001277, 1191500.0, 1229800.0, 3000.1000000000004}, CompressedTableData{1.0, 0.0, 2.4971428571428586e-06, 4775.70905285191, 4852.940267765191, 8.777442324124179}, CompressedTableData{0.0, 1.0, -1.937219593971659e-12, -0.0013329056736059487, -8.908667544906885e-05, -2.531618592233424e-06}},
+    CompressedTableKnot{CompressedTableData{573.15, 30000000.0, 0.0013322, 1288900.0, 1328900.0, 3176.1}, CompressedTableData{1.0, 0.0, 3.0706109324758844e-06, 5001.358641358641, 5093.516429622364, 8.891537812763548}, CompressedTableData{0.0, 1.0, -2.6662013124894664e-12, -0.0017000673095846706, -0.00044043120015766553, -3.1074121871658532e-06}},
+    CompressedTableKnot{CompressedTableData{593.15, 30000000.0, 0.0014014, 1391700.0, 1433700.0, 3355.7999999999997}, CompressedTableData{1.0, 0.0, 3.945689440993791e-06, 5330.192037470726, 5446.526122823098, 9.187816154473762}, CompressedTableData{0.0, 1.0, -3.842705961087057e-12, -0.0022611419970447475, -0.0009528413123980939, -4.004913784722842e-06}},
+    CompressedTableKnot{CompressedTableData{613.15, 30000000.0, 0.0014932, 1502400.0, 1547100.0, 3543.8}, CompressedTableData{1.0, 0.0, 5.454429708222818e-06, 5857.541471714164, 6023.935510541546, 9.831717838112155}, CompressedTableData{0.0, 1.0, -6.200253612652991e-12, -0.0032436062505458553, -0.0018866498924202699, -5.5870394752717e-06}},
+    CompressedTableKnot{CompressedTableData{633.15, 30000000.0, 0.0016276, 1626800.0, 1675600.0, 3749.8999999999996}, CompressedTableData{1.0, 0.0, 8.682728469844614e-06, 6905.178826895564, 7177.636551013398, 11.351671752397557}, CompressedTableData{0.0, 1.0, -1.2394185877272051e-11, -0.0054475947084289805, -0.0040802678073370005, -9.185291971480306e-06}},
+    CompressedTableKnot{CompressedTableData{653.15, 30000000.0, 0.0018729, 1782000.0, 1838200.0, 4002.6000000000004}, CompressedTableData{1.0, 0.0, 1.2264999999999997e-05, 7760.0, 8130.0, 12.635000000000037}, CompressedTableData{0.0, 1.0, 0.0, 0.0, 0.0, 0.0}},
+    CompressedTableKnot{CompressedTableData{273.15000000000003, 34473786.465841815, 0.0009836149468377344, 302.3800422392467, 34215.46477953322, 0.08373601169702213}, CompressedTableData{1.0, 0.0, 1.0612753297944543e-07, 4075.1525692550777, 4079.8045699049117, 14.666362448733427}, CompressedTableData{0.0, 1.0, -4.573938602191552e-13, 0.0, 0.0009682285665881807, 0.0}},
+    CompressedTableKnot{CompressedTableData{283.15000000000003, 34473786.465841815, 0.0009846762221675288, 41053.90573479002, 75013.51047858234, 146.7473604990313}, CompressedTableData{1.0, 0.0, 1.4361451436793416e-07, 4078.4436294631896, 4085.012059600989, 14.282241334460544}, CompressedTableData{0.0, 1.0, -4.640967974229549e-13, -3.0537403601860655e-05, 0.0009383187841548983, 2.1121706499943426e-07}},
+    CompressedTableKnot{CompressedTableData{310.9277777777778, 34473786.465841815, 0.0009924172892789708, 154469.68157775668, 188685.14635728992, 529.714009995362}, CompressedTableData{1.0, 0.0, 3.544868556130212e-07, 4090.949818711822, 4104.229570772057, 13.027091565816498}, CompressedTableData{0.0, 1.0, -4.024450931541258e-13, -0.00010344023949591255, 0.000874106874879976, -4.417183874923374e-07}},
+    CompressedTableKnot{CompressedTableData{366.48333333333335, 34473786.465841815, 0.0010222578544343678, 382301.41340340447, 417540.31832590123, 1206.803400577483}, CompressedTableData{1.0, 0.0, 6.516295265045223e-07, 4120.347808490179, 4143.741112215298, 11.331871277759147}, CompressedTableData{0.0, 1.0, -4.4159905991041877e-13, -0.00023204911648981206, 0.0007733538767454467, -6.827033342266485e-07}},
+    CompressedTableKnot{CompressedTableData{422.0388888888889, 34473786.465841815, 0.0010682672613789863, 612296.3255312253, 649116.9106746658, 1795.0488827490635}, CompressedTableData{1.0, 0.0, 9.66665438111003e-07, 4186.0707052791795, 4220.268908978736, 10.019849024504126}, CompressedTableData{0.0, 1.0, -5.707893041947644e-13, -0.0003903291399349782, 0.0006562454915011355, -9.712980123792125e-07}},
+    CompressedTableKnot{CompressedTableData{477.59444444444443, 34473786.465841815, 0.0011327553446541438, 847478.2183836118, 886531.7638389728, 2323.3393805455758}, CompressedTableData{1.0, 0.0, 1.3271489096683838e-06, 4301.919277011996, 4348.007511901611, 9.203460447784154}, CompressedTableData{0.0, 1.0, -8.21704722909804e-13, -0.0006194881816314349, 0.00048173344973595717, -1.3656890059582036e-06}},
+    CompressedTableKnot{CompressedTableData{505.37222222222226, 34473786.465841815, 0.0011743947943584322, 968546.5352955562, 1009018.940949117, 2572.5796193617625}, CompressedTableData{1.0, 0.0, 1.6423163566079187e-06, 4419.962434866146, 4477.149099007287, 8.862798112939338}, CompressedTableData{0.0, 1.0, -1.0452126514804706e-12, -0.0007827799054470455, 0.00034673240250760785, -1.6266162919936215e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 34473786.465841815, 0.001224836586503957, 1093080.5926916273, 1135320.7585921253, 2815.7908653357636}, CompressedTableData{1.0, 0.0, 2.0319830549518227e-06, 4578.852879724142, 4649.88248329501, 8.712261640368341}, CompressedTableData{0.0, 1.0, -1.4015765739084086e-12, -0.0010132930179497692, 0.0001581284095330024, -1.9875923664889234e-06}},
+    CompressedTableKnot{CompressedTableData{566.4833333333333, 34473786.465841815, 0.0013023721135395287, 1249248.2545065738, 1294140.0607774772, 3104.6801056904897}, CompressedTableData{1.0, 0.0, 2.6578223611058976e-06, 4825.28311960635, 4917.579469408085, 8.715670439469067}, CompressedTableData{0.0, 1.0, -2.122112580834542e-12, -0.0014169149554798053, -0.00017522032824756546, -2.651357344446215e-06}},
+    CompressedTableKnot{CompressedTableData{588.7055555555556, 34473786.465841815, 0.001369856738922341, 1359361.1098881578, 1406578.9164839787, 3299.3244648802174}, CompressedTableData{1.0, 0.0, 3.4431758984379604e-06, 5116.5855974132, 5236.521513118915, 8.89896953857154}, CompressedTableData{0.0, 1.0, -2.991650353101369e-12, -0.001858202162983013, -0.0005812911037051355, -3.3447604029058593e-06}},
+    CompressedTableKnot{CompressedTableData{610.9277777777778, 34473786.465841815, 0.0014581923031375856, 1476893.9063062281, 1527158.7733276905, 3500.290892953071}, CompressedTableData{1.0, 0.0, 4.663746177323703e-06, 5547.326752727908, 5710.737837100029, 9.354580927736391}, CompressedTableData{0.0, 1.0, -4.585044181114176e-12, -0.002562049861228809, -0.001246619302606289, -4.463404387605142e-06}},
+    CompressedTableKnot{CompressedTableData{633.15, 34473786.465841815, 0.001583547647974484, 1606498.644410619, 1661089.8720364277, 3715.5761790261145}, CompressedTableData{1.0, 0.0, 6.717454855942377e-06, 6191.557511121462, 6426.666371215082, 10.185658890355263}, CompressedTableData{0.0, 1.0, -8.047266188825463e-12, -0.003888835888152955, -0.0025578521746143753, -6.6108291759843835e-06}},
+    CompressedTableKnot{CompressedTableData{644.2611111111112, 34473786.465841815, 0.001671633500347424, 1678860.5145187958, 1736498.802570246, 3833.602087513067}, CompressedTableData{1.0, 0.0, 7.92772671356453e-06, 6512.568309735853, 6786.803748043584, 10.622331763825652}, CompressedTableData{0.0, 1.0, -1.2526572672463269e-11, -0.005395519798889871, -0.004033780649138346, -9.078865628615288e-06}},
+    CompressedTableKnot{CompressedTableData{273.15, 50000000.0, 0.0009767, 290.0, 49130.0, 20001.0}, CompressedTableData{1.0, 0.0, 1.8999999999999919e-07, 4032.0, 4040.999999999999, -985.825}, CompressedTableData{0.0, 1.0, 0.0, 0.0, 0.0, 0.0}},
+    CompressedTableKnot{CompressedTableData{293.15, 50000000.0, 0.0009805, 80930.0, 129949.99999999999, 284.5}, CompressedTableData{1.0, 0.0, 2.424761904761884e-07, 4040.233153888992, 4052.9644707623984, 0.0}, CompressedTableData{0.0, 1.0, -4.0158676988151024e-13, -5.903971557706668e-05, 0.0009063266251533272, -2.508693671603964e-07}},
+    CompressedTableKnot{CompressedTableData{313.15, 50000000.0, 0.0009872, 161900.0, 211250.0, 552.8}, CompressedTableData{1.0, 0.0, 3.8407643312101757e-07, 4053.7432007400553, 4073.233290370098, 13.01332245681382}, CompressedTableData{0.0, 1.0, -3.8818786994119457e-13, -0.00010696578666284729, 0.0008658762376500023, -3.729092604052975e-07}},
+    CompressedTableKnot{CompressedTableData{333.15, 50000000.0, 0.0009962, 243080.0, 292880.0, 805.5}, CompressedTableData{1.0, 0.0, 4.950000000000021e-07, 4062.9960620231354, 4088.238855255917, 12.275028490028491}, CompressedTableData{0.0, 1.0, -3.9170565125256795e-13, -0.00015063952411744662, 0.0008311072827689175, -4.0766933793351266e-07}},
+    CompressedTableKnot{CompressedTableData{353.15, 50000000.0, 0.0010072, 324420.0, 374780.0, 1044.2}, CompressedTableData{1.0, 0.0, 5.937238493723818e-07, 4071.4950264030454, 4101.48969889065, 11.616733333333332}, CompressedTableData{0.0, 1.0, -4.2316386708675213e-13, -0.00019503788837120538, 0.0007979609970273606, -5.625254363601417e-07}},
+    CompressedTableKnot{CompressedTableData{373.15, 50000000.0, 0.0010201, 405940.0, 456940.0, 1270.5}, CompressedTableData{1.0, 0.0, 6.892418772563189e-07, 4081.7418999203774, 4116.2334649256, 11.035775413176365}, CompressedTableData{0.0, 1.0, -4.296002922007406e-13, -0.0002465069601188301, 0.0007583443805198716, -7.169378032715036e-07}},
+    CompressedTableKnot{CompressedTableData{393.15, 50000000.0, 0.0010349, 487690.0, 539430.0, 1485.9}, CompressedTableData{1.0, 0.0, 7.868354430379782e-07, 4095.733382164439, 4135.470741143755, 10.521914034671097}, CompressedTableData{0.0, 1.0, -4.667957182618856e-13, -0.00029374000270287776, 0.0007249643942455103, -7.990628548899634e-07}},
+    CompressedTableKnot{CompressedTableData{413.15, 50000000.0, 0.0010517, 569770.0, 622360.0, 1691.6}, CompressedTableData{1.0, 0.0, 8.849577464788718e-07, 4115.96501457726, 4160.452890277611, 10.070622828784119}, CompressedTableData{0.0, 1.0, -5.233859766227275e-13, -0.000348716144242995, 0.0006859517528096696, -8.877793985453672e-07}},
+    CompressedTableKnot{CompressedTableData{433.15, 50000000.0, 0.0010704, 652330.0, 705850.0, 1888.9}, CompressedTableData{1.0, 0.0, 9.891687657430714e-07, 4142.945691527879, 4192.422719141324, 9.68165462054724}, CompressedTableData{0.0, 1.0, -5.853784966872188e-13, -0.0004215451362443278, 0.0006286745043488049, -1.029333182351261e-06}},
+    CompressedTableKnot{CompressedTableData{453.15, 50000000.0, 0.0010914, 735490.0, 790060.0, 2079.0}, CompressedTableData{1.0, 0.0, 1.1089887640449448e-06, 4177.90426041168, 4233.375044289595, 9.344846215565651}, CompressedTableData{0.0, 1.0, -6.785992191624906e-13, -0.0004957844680441376, 0.0005721034275496573, -1.1149554479422161e-06}},
+    CompressedTableKnot{CompressedTableData{473.15, 50000000.0, 0.0011149, 819450.0, 875190.0, 2262.7999999999997}, CompressedTableData{1.0, 0.0, 1.2410642570281131e-06, 4222.357844878627, 4284.563743508957, 9.058134657836636}, CompressedTableData{0.0, 1.0, -7.733358140063821e-13, -0.0005758002864635663, 0.0005119876587122621, -1.2619563276622646e-06}},
+    CompressedTableKnot{CompressedTableData{493.15, 50000000.0, 0.0011412, 904390.0, 961450.0, 2441.3999999999996}, CompressedTableData{1.0, 0.0, 1.3926296958855095e-06, 4277.2825248392755, 4347.472255764475, 8.818628117913848}, CompressedTableData{0.0, 1.0, -8.89244390701248e-13, -0.0006750176286077598, 0.00043602807401040065, -1.4575389965158139e-06}},
+    CompressedTableKnot{CompressedTableData{513.15, 50000000.0, 0.0011708, 990550.0, 1049100.0, 2615.6000000000004}, CompressedTableData{1.0, 0.0, 1.5736708860759502e-06, 4344.930671422818, 4423.365357445606, 8.624162318840591}, CompressedTableData{0.0, 1.0, -1.074297832609656e-12, -0.0008025813591802585, 0.0003322881717622403, -1.6474675911550042e-06}},
+    CompressedTableKnot{CompressedTableData{533.15, 50000000.0, 0.0012044, 1078200.0, 1138400.0, 2786.4}, CompressedTableData{1.0, 0.0, 1.7963434903047068e-06, 4428.267005362687, 4519.33075221239, 8.47703922146858}, CompressedTableData{0.0, 1.0, -1.3162633928095704e-12, -0.0009584173667900118, 0.00019832532903790777, -1.8929834547942154e-06}},
+    CompressedTableKnot{CompressedTableData{553.15, 50000000.0, 0.001243, 1167700.0, 1229900.0, 2954.7}, CompressedTableData{1.0, 0.0, 2.075616766467066e-06, 4534.206174200662, 4639.089439655173, 8.384892665474052}, CompressedTableData{0.0, 1.0, -1.6632778113433964e-12, -0.0011637227421205224, 2.5060269686853057e-05, -2.211428572060702e-06}},
+    CompressedTableKnot{CompressedTableData{573.15, 50000000.0, 0.0012879, 1259600.0, 1324000.0, 3121.7999999999997}, CompressedTableData{1.0, 0.0, 2.4307456588355456e-06, 4663.949624866023, 4786.078328981724, 8.35249925172105}, CompressedTableData{0.0, 1.0, -2.1196775379228447e-12, -0.0014190197054931338, -0.00020351494059789294, -2.6365681454577424e-06}},
+    CompressedTableKnot{CompressedTableData{593.15, 50000000.0, 0.0013409, 1354300.0, 1421400.0, 3288.8}, CompressedTableData{1.0, 0.0, 2.8991452991452967e-06, 4830.532850491464, 4975.178302360622, 8.39228477807567}, CompressedTableData{0.0, 1.0, -2.873921470422805e-12, -0.001796548684618263, -0.0005508907226161287, -3.2258638796492375e-06}},
+    CompressedTableKnot{CompressedTableData{613.15, 50000000.0, 0.0014049, 1452900.0, 1523100.0, 3457.5}, CompressedTableData{1.0, 0.0, 3.5535788742182113e-06, 5051.909000989121, 5228.342092689919, 8.531385877527097}, CompressedTableData{0.0, 1.0, -4.112625708807431e-12, -0.002342471688014735, -0.0010822238717189598, -4.097585977096323e-06}},
+    CompressedTableKnot{CompressedTableData{633.15, 50000000.0, 0.0014848, 1556500.0, 1630700.0, 3630.1}, CompressedTableData{1.0, 0.0, 4.51097547683924e-06, 5349.281045751634, 5577.475380483438, 8.81351290048199}, CompressedTableData{0.0, 1.0, -6.360059892080951e-12, -0.0032202728824140135, -0.0019573266830041334, -5.505281686231103e-06}},
+    CompressedTableKnot{CompressedTableData{653.15, 50000000.0, 0.0015884, 1667100.0, 1746500.0, 3810.2}, CompressedTableData{1.0, 0.0, 5.179999999999996e-06, 5530.0, 5790.0, 9.004999999999995}, CompressedTableData{0.0, 1.0, 0.0, 0.0, 0.0, 0.0}},
 };
-const logngine::core::RSTTree<CompressedTableEntry, 6, 16, 16> CompressedTable = _make_baked_compressedtable_dataset();
 #pragma endregion  // Definitions
 
 #pragma region Baked-In Source File
@@ -17,8 +17,8 @@ struct SaturationTableEntry;
 
 #pragma region Definitions
 struct SaturationTableData {
-    SaturationTableData() = default;
-    SaturationTableData(const double& temperature, const double& pressure, const double& liquid_specific_volume, const double& vapor_specific_volume, const double& liquid_specific_internal_energy, const double& vapor_specific_internal_energy, const double& liquid_specific_enthalpy, const double& vapor_specific_enthalpy, const double& liquid_specific_entropy, const double& vapor_specific_entropy): temperature(temperature), pressure(pressure), liquid_specific_volume(liquid_specific_volume), vapor_specific_volume(vapor_specific_volume), liquid_specific_internal_energy(liquid_specific_internal_energy), vapor_specific_internal_energy(vapor_specific_internal_energy), liquid_specific_enthalpy(liquid_specific_enthalpy), vapor_specific_enthalpy(vapor_specific_enthalpy), liquid_specific_entropy(liquid_specific_entropy), vapor_specific_entropy(vapor_specific_entropy) {}
+    constexpr SaturationTableData() = default;
+    constexpr SaturationTableData(const double& temperature, const double& pressure, const double& liquid_specific_volume, const double& vapor_specific_volume, const double& liquid_specific_internal_energy, const double& vapor_specific_internal_energy, const double& liquid_specific_enthalpy, const double& vapor_specific_enthalpy, const double& liquid_specific_entropy, const double& vapor_specific_entropy): temperature(temperature), pressure(pressure), liquid_specific_volume(liquid_specific_volume), vapor_specific_volume(vapor_specific_volume), liquid_specific_internal_energy(liquid_specific_internal_energy), vapor_specific_internal_energy(vapor_specific_internal_energy), liquid_specific_enthalpy(liquid_specific_enthalpy), vapor_specific_enthalpy(vapor_specific_enthalpy), liquid_specific_entropy(liquid_specific_entropy), vapor_specific_entropy(vapor_specific_entropy) {}
     const double temperature{};
     const double pressure{};
     const double liquid_specific_volume{};
@@ -31,300 +31,321 @@ struct SaturationTableData {
     const double vapor_specific_entropy{};
 };
 struct SaturationTableEntry {
-    SaturationTableEntry() = default;
-    SaturationTableEntry(const SaturationTableData& data, const SaturationTableData& uncertainty, const unsigned int& citation): data(data), uncertainty(uncertainty), citation(citation) {}
+    constexpr SaturationTableEntry() = default;
+    constexpr SaturationTableEntry(const SaturationTableData& data, const SaturationTableData& uncertainty, const unsigned int& citation): data(data), uncertainty(uncertainty), citation(citation) {}
     const SaturationTableData data{};
     const SaturationTableData uncertainty{};
     const unsigned int citation{};
 };
-inline logngine::core::RSTTree<SaturationTableEntry, 10, 16, 16> _make_baked_saturationtable_dataset () {
-    logngine::core::RSTTree<SaturationTableEntry, 10, 16, 16> SaturationTable{};
-    SaturationTable.insert(std::array<double, 10>{333.21, 20000.0, 0.001017, 7.6481, 251400.0, 2456000.0, 251420.0, 2608900.0, 832.0, 7907.3}, SaturationTableEntry{SaturationTableData{333.21, 20000.0, 0.001017, 7.6481, 251400.0, 2456000.0, 251420.0, 2608900.0, 832.0, 7907.3}, SaturationTableData{2.4499999999999886, 0.0, 1.4999999999999823e-06, 0.72235, 10265.0, 3200.0, 10270.0, 4300.0, 30.600000000000023, 38.55000000000018}, 3});
-    SaturationTable.insert(std::array<double, 10>{400.55999999999995, 250000.0, 0.001067, 0.71873, 535080.0, 2536800.0, 535350.0, 2716500.0, 1607.2, 7052.5}, SaturationTableEntry{SaturationTableData{400.55999999999995, 250000.0, 0.001067, 0.71873, 535080.0, 2536800.0, 535350.0, 2716500.0, 1607.2, 7052.5}, SaturationTableData{1.5850000000000364, 0.0, 1.4999999999999823e-06, 0.030704999999999982, 6745.0, 1650.0, 6755.0, 2200.0, 16.799999999999955, 15.900000000000091}, 3});
-    SaturationTable.insert(std::array<double, 10>{297.22999999999996, 3000.0, 0.001003, 45.654, 100980.0, 2407900.0, 100980.0, 2544800.0, 354.3, 8576.5}, SaturationTableEntry{SaturationTableData{297.22999999999996, 3000.0, 0.001003, 45.654, 100980.0, 2407900.0, 100980.0, 2544800.0, 354.3, 8576.5}, SaturationTableData{1.5, 0.0, 5e-07, 4.293999999999997, 6279.0, 2050.0, 6278.0, 2700.0, 21.25, 32.79999999999927}, 3});
-    SaturationTable.insert(std::array<double, 10>{483.15, 1907700.0, 0.001173, 0.10429, 895380.0, 2598300.0, 897610.0, 2797300.0, 2424.5, 6356.3}, SaturationTableEntry{SaturationTableData{483.15, 1907700.0, 0.001173, 0.10429, 895380.0, 2598300.0, 897610.0, 2797300.0, 2424.5, 6356.3}, SaturationTableData{0.0, 91700.0, 3.999999999999989e-06, 0.004804999999999997, 11260.0, 800.0, 11370.0, 1000.0, 23.350000000000136, 18.15000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{448.5, 900000.0, 0.001121, 0.21489, 741550.0, 2579600.0, 742560.0, 2773000.0, 2094.1, 6621.3}, SaturationTableEntry{SaturationTableData{448.5, 900000.0, 0.001121, 0.21489, 741550.0, 2579600.0, 742560.0, 2773000.0, 2094.1, 6621.3}, SaturationTableData{1.1549999999999727, 0.0, 1.4999999999999823e-06, 0.005389999999999992, 5060.0, 850.0, 5090.0, 1100.0, 11.25, 9.300000000000182}, 3});
-    SaturationTable.insert(std::array<double, 10>{615.31, 15000000.0, 0.001657, 0.010341, 1585500.0, 2455700.0, 1610300.0, 2610800.0, 3684.8, 5310.8}, SaturationTableEntry{SaturationTableData{615.31, 15000000.0, 0.001657, 0.010341, 1585500.0, 2455700.0, 1610300.0, 2610800.0, 3684.8, 5310.8}, SaturationTableData{2.6000000000000227, 0.0, 2.3499999999999975e-05, 0.0005144999999999993, 18550.0, 10700.0, 19650.0, 13550.0, 30.65000000000009, 31.0}, 3});
-    SaturationTable.insert(std::array<double, 10>{398.15, 232230.0, 0.001065, 0.77012, 524830.0, 2534300.0, 525070.0, 2713100.0, 1581.6, 7077.099999999999}, SaturationTableEntry{SaturationTableData{398.15, 232230.0, 0.001065, 0.77012, 524830.0, 2534300.0, 525070.0, 2713100.0, 1581.6, 7077.099999999999}, SaturationTableData{0.0, 16780.0, 2.5000000000000066e-06, 0.05102000000000001, 10615.0, 2600.0, 10630.0, 3500.0, 26.500000000000114, 25.299999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 0.057945008727171655, 1041303.8254589688, 2603026.96361493, 1045560.4060535673, 2802830.391525325, 2717.2335795683684, 6130.3134163389905}, SaturationTableEntry{SaturationTableData{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 0.057945008727171655, 1041303.8254589688, 2603026.96361493, 1045560.4060535673, 2802830.391525325, 2717.2335795683684, 6130.3134163389905}, SaturationTableData{2.7583333333333258, 0.0, 6.242796057614412e-06, 0.002681593046548289, 13048.861822785926, 116.30001624603756, 13281.461855277768, 232.60003249160945, 25.26734152957647, 19.259282690315104}, 5});
-    SaturationTable.insert(std::array<double, 10>{626.5777777777778, 17236893.232920907, 0.0017854396724777356, 0.008163080124936667, 1669300.6531833855, 2398571.5350547014, 1700073.6374820413, 2539294.554712197, 3823.009482033394, 5162.325121121415}, SaturationTableEntry{SaturationTableData{626.5777777777778, 17236893.232920907, 0.0017854396724777356, 0.008163080124936667, 1669300.6531833855, 2398571.5350547014, 1700073.6374820413, 2539294.554712197, 3823.009482033394, 5162.325121121415}, SaturationTableData{7.566666666666663, 0.0, 9.270552145557468e-05, 0.0014408373300974168, 64360.42899046105, 41402.80578352744, 68710.04959805636, 51986.107261901256, 106.49127287568786, 111.57823558628206}, 5});
-    SaturationTable.insert(std::array<double, 10>{505.37222222222226, 2912828.113644839, 0.001213599553600251, 0.06866451383770146, 997063.299279042, 2603026.96361493, 1000598.8197729164, 2803062.991557816, 2630.3993354385566, 6196.883545638123}, SaturationTableEntry{SaturationTableData{505.37222222222226, 2912828.113644839, 0.001213599553600251, 0.06866451383770146, 997063.299279042, 2603026.96361493, 1000598.8197729164, 2803062.991557816, 2630.3993354385566, 6196.883545638123}, SaturationTableData{0.0, 141273.57693701982, 5.618516451852949e-06, 0.0032712251341899846, 12851.151795167942, 116.30001624603756, 13037.231821161346, 5e-10, 25.497615561743032, 19.468622719557516}, 4});
-    SaturationTable.insert(std::array<double, 10>{600.4111111111112, 12410563.127703054, 0.0015419706262307716, 0.013628648073378128, 1488709.987956808, 2507195.7502283384, 1507852.9706308772, 2676295.973849824, 3522.941484117115, 5469.217603991001}, SaturationTableEntry{SaturationTableData{600.4111111111112, 12410563.127703054, 0.0015419706262307716, 0.013628648073378128, 1488709.987956808, 2507195.7502283384, 1507852.9706308772, 2676295.973849824, 3522.941484117115, 5469.217603991001}, SaturationTableData{4.105555555555554, 0.0, 2.621974344198068e-05, 0.0009414136454882604, 25934.903622827725, 11397.401592094684, 27400.28382752568, 14653.802046979079, 43.54272608245151, 41.65866581926821}, 5});
-    SaturationTable.insert(std::array<double, 10>{418.15, 415680.0, 0.001085, 0.446, 610190.0, 2554400.0, 610640.0, 2739800.0, 1790.8, 6882.7}, SaturationTableEntry{SaturationTableData{418.15, 415680.0, 0.001085, 0.446, 610190.0, 2554400.0, 610640.0, 2739800.0, 1790.8, 6882.7}, SaturationTableData{0.0, 27075.0, 2.5000000000000066e-06, 0.026760000000000006, 10710.0, 2350.0, 10740.0, 3050.0, 25.500000000000114, 22.799999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{466.48333333333335, 1349579.7925647756, 0.001146177356178015, 0.14583795870193142, 820775.7346535613, 2590931.7619253607, 822310.8948680066, 2787711.3894133624, 2267.236252708571, 6480.329945232543}, SaturationTableEntry{SaturationTableData{466.48333333333335, 1349579.7925647756, 0.001146177356178015, 0.14583795870193142, 820775.7346535613, 2590931.7619253607, 822310.8948680066, 2787711.3894133624, 2267.236252708571, 6480.329945232543}, SaturationTableData{0.0, 77152.33411055396, 4.057817437449454e-06, 0.007862801634565417, 12304.541718812427, 1395.6001949501224, 12385.95173018449, 1860.800259933807, 26.35590968163774, 20.93400292425531}, 4});
-    SaturationTable.insert(std::array<double, 10>{349.81666666666666, 41368.54375901018, 0.0010269399514775787, 3.8694098524305947, 320988.0448385849, 2477422.9460693966, 321034.5648450833, 2637451.7684237063, 1035.7725966863152, 7657.239589634189}, SaturationTableEntry{SaturationTableData{349.81666666666666, 41368.54375901018, 0.0010269399514775787, 3.8694098524305947, 320988.0448385849, 2477422.9460693966, 321034.5648450833, 2637451.7684237063, 1035.7725966863152, 7657.239589634189}, SaturationTableData{2.172222222222217, 0.0, 1.2485592115229257e-06, 0.36030297446521864, 9106.291272051167, 2791.2003899004776, 9117.921273675747, 3721.6005198678467, 26.18843765824363, 31.191664357141235}, 5});
-    SaturationTable.insert(std::array<double, 10>{373.12, 101325.0, 0.001043, 1.6734, 418950.0, 2506000.0, 419060.0, 2675600.0, 1306.8999999999999, 7354.5}, SaturationTableEntry{SaturationTableData{373.12, 101325.0, 0.001043, 1.6734, 418950.0, 2506000.0, 419060.0, 2675600.0, 1306.8999999999999, 7354.5}, SaturationTableData{0.18000000000000682, 0.0, 5e-07, 0.01034999999999997, 775.0, 500.0, 775.0, 300.0, 2.0499999999999545, 2.200000000000273}, 3});
-    SaturationTable.insert(std::array<double, 10>{478.87, 1750000.0, 0.001166, 0.11344, 876120.0, 2596700.0, 878160.0, 2795200.0, 2384.3999999999996, 6387.7}, SaturationTableEntry{SaturationTableData{478.87, 1750000.0, 0.001166, 0.11344, 876120.0, 2596700.0, 878160.0, 2795200.0, 2384.3999999999996, 6387.7}, SaturationTableData{3.329999999999984, 0.0, 5.5000000000000795e-06, 0.006926500000000002, 15000.0, 1200.0, 15155.0, 1550.0, 31.15000000000009, 24.34999999999991}, 3});
-    SaturationTable.insert(std::array<double, 10>{313.15, 7385.1, 0.001008, 19.515, 167530.0, 2429400.0, 167530.0, 2573500.0, 572.4, 8255.599999999999}, SaturationTableEntry{SaturationTableData{313.15, 7385.1, 0.001008, 19.515, 167530.0, 2429400.0, 167530.0, 2573500.0, 572.4, 8255.599999999999}, SaturationTableData{0.0, 878.0, 1.0000000000000243e-06, 2.1320000000000006, 10450.0, 3350.0, 10445.0, 4450.0, 33.099999999999966, 46.149999999999636}, 2});
-    SaturationTable.insert(std::array<double, 10>{510.9277777777778, 3218127.9665863337, 0.001224836586503957, 0.06212206356932149, 1022951.6828953715, 2603259.563647422, 1026882.6234444816, 2803062.991557816, 2681.3945665620427, 6157.946300199008}, SaturationTableEntry{SaturationTableData{510.9277777777778, 3218127.9665863337, 0.001224836586503957, 0.06212206356932149, 1022951.6828953715, 2603259.563647422, 1026882.6234444816, 2803062.991557816, 2681.3945665620427, 6157.946300199008}, SaturationTableData{0.0, 152649.92647074745, 5.618516451852949e-06, 0.0029191314365405174, 12944.191808164702, 116.30001624603756, 13141.901835782628, 5e-10, 25.45574755589473, 19.468622719557516}, 4});
-    SaturationTable.insert(std::array<double, 10>{433.2944444444445, 620528.1563851527, 0.001101853504168952, 0.30572220853349535, 675423.9743494804, 2567904.358708679, 676098.5144437064, 2757705.9852219294, 1943.9733795522172, 6747.866502604528}, SaturationTableEntry{SaturationTableData{433.2944444444445, 620528.1563851527, 0.001101853504168952, 0.30572220853349535, 675423.9743494804, 2567904.358708679, 676098.5144437064, 2757705.9852219294, 1943.9733795522172, 6747.866502604528}, SaturationTableData{1.069444444444457, 0.0, 1.2485592115228173e-06, 0.007616211190289657, 4628.740646585415, 930.4001299669035, 4652.000649834576, 1163.000162458513, 10.676341491370295, 9.2109612866725}, 5});
-    SaturationTable.insert(std::array<double, 10>{338.7055555555556, 25671.939305383083, 0.0010200728758142028, 6.051079790685121, 274421.51833374094, 2463234.3440874014, 274444.7783369901, 2618378.5657593845, 900.497069789776, 7820.943492501868}, SaturationTableEntry{SaturationTableData{338.7055555555556, 25671.939305383083, 0.0010200728758142028, 6.051079790685121, 274421.51833374094, 2463234.3440874014, 274444.7783369901, 2618378.5657593845, 900.497069789776, 7820.943492501868}, SaturationTableData{0.0, 2862.3584902588445, 1.560699014403603e-06, 0.6162888268076996, 11630.00162458641, 3489.0004873760045, 11630.001624586424, 4768.300666080322, 34.08055676068801, 41.65866581926866}, 4});
-    SaturationTable.insert(std::array<double, 10>{533.15, 4692300.0, 0.001276, 0.042175, 1128800.0, 2598700.0, 1134800.0, 2796600.0, 2884.7, 6001.7}, SaturationTableEntry{SaturationTableData{533.15, 4692300.0, 0.001276, 0.042175, 1128800.0, 2598700.0, 1134800.0, 2796600.0, 2884.7, 6001.7}, SaturationTableData{0.0, 184700.0, 6.499999999999995e-06, 0.0017134999999999997, 12050.0, 900.0, 12350.0, 1250.0, 22.84999999999991, 17.600000000000364}, 2});
-    SaturationTable.insert(std::array<double, 10>{462.6333333333333, 1241056.3127703054, 0.001140558839726162, 0.15808008177091337, 803702.8922686684, 2588838.361632935, 805121.7524668679, 2784920.1890234617, 2230.4761435735786, 6509.6375493265}, SaturationTableEntry{SaturationTableData{462.6333333333333, 1241056.3127703054, 0.001140558839726162, 0.15808008177091337, 803702.8922686684, 2588838.361632935, 805121.7524668679, 2784920.1890234617, 2230.4761435735786, 6509.6375493265}, SaturationTableData{1.2361111111111143, 0.0, 1.8728388172842801e-06, 0.004001632272930877, 5477.730765180197, 697.8000974750612, 5524.250771678577, 930.4001299666706, 11.82771165220447, 9.420301315914912}, 5});
-    SaturationTable.insert(std::array<double, 10>{409.41999999999996, 325000.0, 0.001076, 0.56199, 572840.0, 2545900.0, 573190.0, 2728600.0, 1700.5, 6965.0}, SaturationTableEntry{SaturationTableData{409.41999999999996, 325000.0, 0.001076, 0.56199, 572840.0, 2545900.0, 573190.0, 2728600.0, 1700.5, 6965.0}, SaturationTableData{1.295000000000016, 0.0, 1.4999999999999823e-06, 0.018884999999999985, 5525.0, 1300.0, 5535.0, 1700.0, 13.450000000000045, 12.400000000000091}, 3});
-    SaturationTable.insert(std::array<double, 10>{630.14, 18000000.0, 0.00184, 0.007504, 1699100.0, 2375000.0, 1732200.0, 2510000.0, 3872.0, 5106.4}, SaturationTableEntry{SaturationTableData{630.14, 18000000.0, 0.00184, 0.007504, 1699100.0, 2375000.0, 1732200.0, 2510000.0, 3872.0, 5106.4}, SaturationTableData{2.240000000000009, 0.0, 3.499999999999998e-05, 0.00041350000000000024, 19450.0, 15200.0, 20950.0, 18850.0, 31.90000000000009, 36.350000000000364}, 3});
-    SaturationTable.insert(std::array<double, 10>{333.15000000000003, 19947.222324865394, 0.0010169514777853955, 7.666777838356318, 251161.51508456812, 2456023.7430801583, 251184.77508781725, 2608841.964427223, 831.2892561221872, 7908.02894466677}, SaturationTableEntry{SaturationTableData{333.15000000000003, 19947.222324865394, 0.0010169514777853955, 7.666777838356318, 251161.51508456812, 2456023.7430801583, 251184.77508781725, 2608841.964427223, 831.2892561221872, 7908.02894466677}, SaturationTableData{0.0, 2299.7462951363086, 1.2485592115228173e-06, 0.8078490238355989, 11618.371622961844, 3605.3005036215764, 11630.00162458641, 4768.300666080788, 34.60390683379438, 43.54272608245128}, 4});
-    SaturationTable.insert(std::array<double, 10>{286.16999999999996, 1500.0, 0.001001, 87.964, 54686.0, 2392800.0, 54688.0, 2524700.0, 195.6, 8827.0}, SaturationTableEntry{SaturationTableData{286.16999999999996, 1500.0, 0.001001, 87.964, 54686.0, 2392800.0, 54688.0, 2524700.0, 195.6, 8827.0}, SaturationTableData{2.240000000000009, 0.0, 5e-07, 10.487000000000002, 9372.5, 3050.0, 9372.5, 4100.0, 32.500000000000014, 52.150000000000546}, 3});
-    SaturationTable.insert(std::array<double, 10>{327.59444444444443, 15347.729734592776, 0.00101445435936235, 9.806808326906555, 227924.77183864443, 2448580.5420404226, 227924.77183864443, 2599072.763062571, 760.9091382908401, 7998.88251735804}, SaturationTableEntry{SaturationTableData{327.59444444444443, 15347.729734592776, 0.00101445435936235, 9.806808326906555, 227924.77183864443, 2448580.5420404226, 227924.77183864443, 2599072.763062571, 760.9091382908401, 7998.88251735804}, SaturationTableData{0.0, 1830.2133234715411, 1.2485592115228173e-06, 1.0700152442751185, 11618.371622961815, 3605.300503621809, 11618.371622961815, 4884.600682325894, 35.190058915673546, 45.42678634563481}, 4});
-    SaturationTable.insert(std::array<double, 10>{616.4833333333333, 15222245.151857113, 0.0016686993862003452, 0.010103341139643243, 1593682.3826203248, 2450673.942332848, 1619082.3061684216, 2604422.5638098805, 3698.2846926106795, 5296.721419895134}, SaturationTableEntry{SaturationTableData{616.4833333333333, 15222245.151857113, 0.0016686993862003452, 0.010103341139643243, 1593682.3826203248, 2450673.942332848, 1619082.3061684216, 2604422.5638098805, 3698.2846926106795, 5296.721419895134}, SaturationTableData{0.0, 511935.72901775036, 2.4971184230457755e-05, 0.0005431232570124577, 18956.902648075833, 11164.801559603075, 20166.4228170329, 14188.601981995627, 31.48474039808025, 31.819684444868926}, 4});
-    SaturationTable.insert(std::array<double, 10>{358.15, 57868.0, 0.001032, 2.8261, 355960.0, 2487800.0, 356020.0, 2651400.0, 1134.6000000000001, 7543.5}, SaturationTableEntry{SaturationTableData{358.15, 57868.0, 0.001032, 2.8261, 355960.0, 2487800.0, 356020.0, 2651400.0, 1134.6000000000001, 7543.5}, SaturationTableData{0.0, 5226.0, 1.4999999999999823e-06, 0.23339999999999983, 10495.0, 3100.0, 10500.0, 4100.0, 29.149999999999977, 32.65000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{316.48333333333335, 8802.53663618805, 0.0010094601225162582, 16.540912434255272, 181451.28534679717, 2433926.739993444, 181474.54535004633, 2579534.3603332657, 616.631990136871, 8193.568744553615}, SaturationTableEntry{SaturationTableData{316.48333333333335, 8802.53663618805, 0.0010094601225162582, 16.540912434255272, 181451.28534679717, 2433926.739993444, 181474.54535004633, 2579534.3603332657, 616.631990136871, 8193.568744553615}, SaturationTableData{0.0, 1124.4659669428283, 9.364194086421401e-07, 1.9358910574662431, 11606.741621337234, 3721.600519867381, 11606.741621337234, 4884.60068232636, 36.38329708235614, 49.82292695972774}, 4});
-    SaturationTable.insert(std::array<double, 10>{338.15, 25043.0, 0.00102, 6.1935, 272090.0, 2462400.0, 272120.0, 2617500.0, 893.7, 7829.6}, SaturationTableEntry{SaturationTableData{338.15, 25043.0, 0.00102, 6.1935, 272090.0, 2462400.0, 272120.0, 2617500.0, 893.7, 7829.6}, SaturationTableData{0.0, 2548.0, 5e-06, 0.5769500000000001, 10465.0, 3250.0, 10470.0, 4300.0, 30.699999999999932, 37.80000000000018}, 2});
-    SaturationTable.insert(std::array<double, 10>{534.8888888888889, 4826330.1052178545, 0.0012803974714167257, 0.04094587506228748, 1137321.118871554, 2597909.762900112, 1143508.279735834, 2795619.7905180813, 2900.573577178998, 5989.218236629508}, SaturationTableEntry{SaturationTableData{534.8888888888889, 4826330.1052178545, 0.0012803974714167257, 0.04094587506228748, 1137321.118871554, 2597909.762900112, 1143508.279735834, 2795619.7905180813, 2900.573577178998, 5989.218236629508}, SaturationTableData{4.205555555555577, 0.0, 1.1237032903706006e-05, 0.002705939951172985, 20678.142888514674, 1628.2002274419647, 21178.232958371867, 2326.0003249172587, 38.47669737478145, 29.935624181685853}, 5});
-    SaturationTable.insert(std::array<double, 10>{423.15, 476160.0, 0.001091, 0.39248, 631660.0, 2559100.0, 632180.0, 2745900.0, 1841.8000000000002, 6837.1}, SaturationTableEntry{SaturationTableData{423.15, 476160.0, 0.001091, 0.39248, 631660.0, 2559100.0, 632180.0, 2745900.0, 1841.8000000000002, 6837.1}, SaturationTableData{0.0, 30240.0, 2.5000000000000066e-06, 0.022999999999999993, 10735.0, 2200.0, 10770.0, 2950.0, 25.299999999999955, 22.200000000000273}, 2});
-    SaturationTable.insert(std::array<double, 10>{437.48888888888894, 689475.7293168363, 0.0011074720206208052, 0.2767244208458762, 693590.0368870843, 2571393.359196055, 694334.3569910577, 2762125.3858392723, 1985.6739133773344, 6712.278697633294}, SaturationTableEntry{SaturationTableData{437.48888888888894, 689475.7293168363, 0.0011074720206208052, 0.2767244208458762, 693590.0368870843, 2571393.359196055, 694334.3569910577, 2762125.3858392723, 1985.6739133773344, 6712.278697633294}, SaturationTableData{1.0277777777777715, 0.0, 1.2485592115228173e-06, 0.006882682653519934, 4454.290622216533, 814.1001137210988, 4465.920623841113, 1046.700146212941, 10.1739254211883, 8.582941198944809}, 5});
-    SaturationTable.insert(std::array<double, 10>{638.7055555555556, 19954117.08215856, 0.002032030116753507, 0.005900066554051426, 1783600.3091498208, 2297157.9208883075, 1824142.494813129, 2414853.537329122, 4010.8293562698145, 4935.81920948097}, SaturationTableEntry{SaturationTableData{638.7055555555556, 19954117.08215856, 0.002032030116753507, 0.005900066554051426, 1783600.3091498208, 2297157.9208883075, 1824142.494813129, 2414853.537329122, 4010.8293562698145, 4935.81920948097}, SaturationTableData{0.0, 643970.3311819248, 6.867075663375907e-05, 0.0005253312882482568, 28726.10401272832, 27330.50381777808, 31307.964373386465, 33378.104662563186, 47.2271105971206, 58.824548217157826}, 4});
-    SaturationTable.insert(std::array<double, 10>{431.98, 600000.0, 0.001101, 0.3156, 669720.0, 2566800.0, 670380.0, 2756200.0, 1930.8000000000002, 6759.299999999999}, SaturationTableEntry{SaturationTableData{431.98, 600000.0, 0.001101, 0.3156, 669720.0, 2566800.0, 670380.0, 2756200.0, 1930.8000000000002, 6759.299999999999}, SaturationTableData{1.5749999999999886, 0.0, 1.4999999999999823e-06, 0.011499999999999982, 6825.0, 1300.0, 6850.0, 1700.0, 15.749999999999886, 13.549999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{620.51, 16000000.0, 0.00171, 0.009312, 1622600.0, 2432000.0, 1649900.0, 2581000.0, 3746.1000000000004, 5246.6}, SaturationTableEntry{SaturationTableData{620.51, 16000000.0, 0.00171, 0.009312, 1622600.0, 2432000.0, 1649900.0, 2581000.0, 3746.1000000000004, 5246.6}, SaturationTableData{2.465000000000032, 0.0, 2.649999999999994e-05, 0.00046900000000000067, 18550.0, 11850.0, 19800.0, 14900.0, 30.65000000000009, 32.09999999999991}, 3});
-    SaturationTable.insert(std::array<double, 10>{384.5, 150000.0, 0.001053, 1.1594, 466970.0, 2519200.0, 467130.0, 2693100.0, 1433.7, 7223.099999999999}, SaturationTableEntry{SaturationTableData{384.5, 150000.0, 0.001053, 1.1594, 466970.0, 2519200.0, 467130.0, 2693100.0, 1433.7, 7223.099999999999}, SaturationTableData{2.344999999999999, 0.0, 2.0000000000000486e-06, 0.07784999999999997, 9925.0, 2650.0, 9940.0, 3550.0, 25.649999999999977, 25.75}, 3});
-    SaturationTable.insert(std::array<double, 10>{394.2611111111111, 205767.13665731665, 0.0010612753297944582, 0.8625047033200138, 508324.1110074228, 2529990.553412528, 508533.45103666536, 2707464.378203716, 1539.8633871023885, 7117.142314188396}, SaturationTableEntry{SaturationTableData{394.2611111111111, 205767.13665731665, 0.0010612753297944582, 0.8625047033200138, 508324.1110074228, 2529990.553412528, 508533.45103666536, 2707464.378203716, 1539.8633871023885, 7117.142314188396}, SaturationTableData{0.0, 16750.812843752545, 2.497118423045743e-06, 0.06417594347227668, 11781.191645706043, 3023.80042239232, 11792.821647330624, 3954.200552359456, 29.70535014951861, 28.67958400623047}, 4});
-    SaturationTable.insert(std::array<double, 10>{520.3555555555556, 3792116.5112426, 0.0012454378134940847, 0.05258182263407508, 1067401.5491045406, 2602329.1635174546, 1072123.3297641228, 2801667.391362866, 2767.7682626275214, 6091.79485095836}, SaturationTableEntry{SaturationTableData{520.3555555555556, 3792116.5112426, 0.0012454378134940847, 0.05258182263407508, 1067401.5491045406, 2602329.1635174546, 1072123.3297641228, 2801667.391362866, 2767.7682626275214, 6091.79485095836}, SaturationTableData{2.5749999999999886, 0.0, 5.930656254733843e-06, 0.002249903699164252, 12281.281715563266, 348.900048737647, 12525.511749679456, 581.5000812294893, 23.529819286862903, 18.212582544102588}, 5});
-    SaturationTable.insert(std::array<double, 10>{488.15, 2105900.0, 0.001181, 0.09468, 918020.0, 2599900.0, 920500.0, 2799300.0, 2471.2000000000003, 6320.0}, SaturationTableEntry{SaturationTableData{488.15, 2105900.0, 0.001181, 0.09468, 918020.0, 2599900.0, 920500.0, 2799300.0, 2471.2000000000003, 6320.0}, SaturationTableData{0.0, 99100.0, 3.999999999999989e-06, 0.004292999999999998, 11320.0, 700.0, 11445.0, 850.0, 23.199999999999818, 18.0}, 2});
-    SaturationTable.insert(std::array<double, 10>{533.15, 4692296.023438661, 0.0012760275141763956, 0.04217508160603177, 1128854.4776888553, 2598840.163030079, 1134832.2985238926, 2796550.1906480477, 2884.663734956564, 6001.359958325576}, SaturationTableEntry{SaturationTableData{533.15, 4692296.023438661, 0.0012760275141763956, 0.04217508160603177, 1128854.4776888553, 2598840.163030079, 1134832.2985238926, 2796550.1906480477, 2884.663734956564, 6001.359958325576}, SaturationTableData{0.0, 204498.50131537346, 6.8670756633758745e-06, 0.0018943764636831055, 13432.651876397314, 930.4001299666706, 13723.401917011943, 1395.600194950588, 25.392945547121826, 19.677962748800383}, 4});
-    SaturationTable.insert(std::array<double, 10>{478.15, 1724300.0, 0.001164, 0.11508, 872860.0, 2596400.0, 874870.0, 2794800.0, 2377.6000000000004, 6393.0}, SaturationTableEntry{SaturationTableData{478.15, 1724300.0, 0.001164, 0.11508, 872860.0, 2596400.0, 874870.0, 2794800.0, 2377.6000000000004, 6393.0}, SaturationTableData{0.0, 84700.0, 3.500000000000031e-06, 0.005395000000000004, 11200.0, 950.0, 11305.0, 1250.0, 23.449999999999818, 18.34999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{440.9, 750000.0, 0.001111, 0.25552, 708400.0, 2574000.0, 709240.0, 2765700.0, 2019.4999999999998, 6683.7}, SaturationTableEntry{SaturationTableData{440.9, 750000.0, 0.001111, 0.25552, 708400.0, 2574000.0, 709240.0, 2765700.0, 2019.4999999999998, 6683.7}, SaturationTableData{1.329999999999984, 0.0, 1.4999999999999823e-06, 0.007585000000000008, 5785.0, 1000.0, 5815.0, 1300.0, 13.100000000000136, 11.049999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{333.15, 19947.0, 0.001017, 7.667, 251160.0, 2455900.0, 251180.0, 2608800.0, 831.3000000000001, 7908.2}, SaturationTableEntry{SaturationTableData{333.15, 19947.0, 0.001017, 7.667, 251160.0, 2455900.0, 251180.0, 2608800.0, 831.3000000000001, 7908.2}, SaturationTableData{0.0, 2092.0, 9.999999999999159e-07, 0.7367499999999998, 10460.0, 3250.0, 10460.0, 4350.0, 31.19999999999999, 39.29999999999973}, 2});
-    SaturationTable.insert(std::array<double, 10>{576.5, 9000000.0, 0.001418, 0.020489, 1350900.0, 2558500.0, 1363700.0, 2742900.0, 3286.6, 5679.1}, SaturationTableEntry{SaturationTableData{576.5, 9000000.0, 0.001418, 0.020489, 1350900.0, 2558500.0, 1363700.0, 2742900.0, 3286.6, 5679.1}, SaturationTableData{3.8249999999999886, 0.0, 1.699999999999998e-05, 0.0012305000000000007, 21200.0, 6000.0, 22050.0, 7900.0, 36.850000000000136, 31.600000000000364}, 3});
-    SaturationTable.insert(std::array<double, 10>{508.15, 3062600.0, 0.001219, 0.0653, 1010000.0, 2603200.0, 1013700.0, 2803200.0, 2656.0, 6177.5}, SaturationTableEntry{SaturationTableData{508.15, 3062600.0, 0.001219, 0.0653, 1010000.0, 2603200.0, 1013700.0, 2803200.0, 2656.0, 6177.5}, SaturationTableData{0.0, 132750.0, 5.000000000000013e-06, 0.002796499999999997, 11620.0, 50.0, 11780.0, 100.0, 22.90000000000009, 17.549999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{285.9277777777778, 1476.3743791861416, 0.001000720208035598, 89.29695480811725, 53660.827495841695, 2392523.934209916, 53660.827495841695, 2524408.152632726, 192.00667482127173, 8832.474513801893}, SaturationTableEntry{SaturationTableData{285.9277777777778, 1476.3743791861416, 0.001000720208035598, 89.29695480811725, 53660.827495841695, 2392523.934209916, 53660.827495841695, 2524408.152632726, 192.00667482127173, 8832.474513801893}, SaturationTableData{0.0, 124.14010506349632, 3.121398028806772e-07, 7.001295778614626, 5815.000812293205, 1860.8002599340398, 5815.000812293205, 2442.3003411632963, 20.26411483067936, 32.65704456183812}, 4});
-    SaturationTable.insert(std::array<double, 10>{299.81666666666666, 3498.7445884182857, 0.0010032173264586438, 39.48006654795961, 111787.57561552458, 2411364.5368417464, 111810.83561877374, 2549528.9561418323, 390.54475855491125, 8520.976550288973}, SaturationTableEntry{SaturationTableData{299.81666666666666, 3498.7445884182857, 0.0010032173264586438, 39.48006654795961, 111787.57561552458, 2411364.5368417464, 111810.83561877374, 2549528.9561418323, 390.54475855491125, 8520.976550288973}, SaturationTableData{0.0, 266.44789559449123, 3.121398028806772e-07, 2.7970847736141593, 5803.3708106686245, 1860.8002599335741, 5803.3708106686245, 2558.6003574086353, 19.259282690315075, 28.888924035473792}, 4});
-    SaturationTable.insert(std::array<double, 10>{522.0388888888889, 3902156.8376415675, 0.0012491834911286534, 0.051062326073651715, 1075402.9902222562, 2602096.5634849635, 1080264.3309013331, 2801202.1912978827, 2783.1338207739245, 6079.653129262291}, SaturationTableEntry{SaturationTableData{522.0388888888889, 3902156.8376415675, 0.0012491834911286534, 0.051062326073651715, 1075402.9902222562, 2602096.5634849635, 1080264.3309013331, 2801202.1912978827, 2783.1338207739245, 6079.653129262291}, SaturationTableData{0.0, 177333.1575802907, 6.242796057614412e-06, 0.0023404242419996606, 13176.791840656428, 348.9000487374142, 13409.391873148154, 697.800097475294, 25.372011544197676, 19.46862271955706}, 4});
-    SaturationTable.insert(std::array<double, 10>{399.4, 241316.50526089274, 0.00106626956664055, 0.7429551588166969, 530141.9940551468, 2535572.9541923287, 530397.8540908878, 2714907.5792434514, 1594.877946787332, 7063.969946760787}, SaturationTableEntry{SaturationTableData{399.4, 241316.50526089274, 0.00106626956664055, 0.7429551588166969, 530141.9940551468, 2535572.9541923287, 530397.8540908878, 2714907.5792434514, 1594.877946787332, 7063.969946760787}, SaturationTableData{2.213888888888903, 0.0, 2.1849786201649573e-06, 0.043699572403301246, 9420.301315915014, 2326.0003249172587, 9431.931317539536, 3023.8004223925527, 23.44608327516619, 22.190043099710692}, 5});
-    SaturationTable.insert(std::array<double, 10>{322.0388888888889, 11687.303087649694, 0.0010113329613335425, 12.669130319322786, 204688.0285927208, 2441369.941033179, 204688.0285927208, 2589303.5616979185, 689.3985843015832, 8093.92289063416}, SaturationTableEntry{SaturationTableData{322.0388888888889, 11687.303087649694, 0.0010113329613335425, 12.669130319322786, 204688.0285927208, 2441369.941033179, 204688.0285927208, 2589303.5616979185, 689.3985843015832, 8093.92289063416}, SaturationTableData{0.0, 1442.3832257308222, 9.364194086421401e-07, 1.4311609962081153, 11618.371622961815, 3605.300503621809, 11606.741621337234, 4884.60068232636, 35.755276994628446, 47.52018663805984}, 4});
-    SaturationTable.insert(std::array<double, 10>{568.16, 8000000.0, 0.001384, 0.023525, 1306000.0, 2570500.0, 1317100.0, 2758700.0, 3207.7, 5745.0}, SaturationTableEntry{SaturationTableData{568.16, 8000000.0, 0.001384, 0.023525, 1306000.0, 2570500.0, 1317100.0, 2758700.0, 3207.7, 5745.0}, SaturationTableData{4.170000000000016, 0.0, 1.6000000000000064e-05, 0.0015180000000000003, 22450.0, 5250.0, 23300.0, 6950.0, 39.450000000000045, 32.94999999999982}, 3});
-    SaturationTable.insert(std::array<double, 10>{356.93333333333334, 55158.05834534691, 0.0010313099087179089, 2.9557766493987185, 350830.62900727364, 2486261.747304083, 350900.4090170212, 2649314.370080784, 1120.2622324886104, 7559.687136007158}, SaturationTableEntry{SaturationTableData{356.93333333333334, 55158.05834534691, 0.0010313099087179089, 2.9557766493987185, 350830.62900727364, 2486261.747304083, 350900.4090170212, 2649314.370080784, 1120.2622324886104, 7559.687136007158}, SaturationTableData{2.875, 0.0, 2.1849786201650657e-06, 0.2784911321301813, 12083.571687945281, 3605.3005036215764, 12083.571687945252, 4768.300666080322, 33.599074693430225, 37.890545292902516}, 5});
-    SaturationTable.insert(std::array<double, 10>{548.74, 6000000.0, 0.001319, 0.032449, 1205800.0, 2589900.0, 1213800.0, 2784600.0, 3027.5, 5890.2}, SaturationTableEntry{SaturationTableData{548.74, 6000000.0, 0.001319, 0.032449, 1205800.0, 2589900.0, 1213800.0, 2784600.0, 3027.5, 5890.2}, SaturationTableData{5.1200000000000045, 0.0, 1.6499999999999913e-05, 0.0025354999999999996, 26100.0, 3550.0, 26850.0, 4800.0, 47.25, 37.69999999999982}, 3});
-    SaturationTable.insert(std::array<double, 10>{363.15, 70183.0, 0.001036, 2.3593, 376970.0, 2494000.0, 377040.0, 2659600.0, 1192.9, 7478.2}, SaturationTableEntry{SaturationTableData{363.15, 70183.0, 0.001036, 2.3593, 376970.0, 2494000.0, 377040.0, 2659600.0, 1192.9, 7478.2}, SaturationTableData{0.0, 6157.5, 1.99999999999994e-06, 0.18925000000000014, 10505.0, 3050.0, 10510.0, 4000.0, 28.749999999999886, 31.550000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{498.15, 2549700.0, 0.001199, 0.078405, 963700.0, 2602300.0, 966760.0, 2802200.0, 2563.8999999999996, 6248.3}, SaturationTableEntry{SaturationTableData{498.15, 2549700.0, 0.001199, 0.078405, 963700.0, 2602300.0, 966760.0, 2802200.0, 2563.8999999999996, 6248.3}, SaturationTableData{0.0, 115050.0, 4.499999999999947e-06, 0.0034500000000000017, 11455.0, 300.0, 11605.0, 350.0, 23.050000000000182, 17.750000000000455}, 2});
-    SaturationTable.insert(std::array<double, 10>{373.15, 101420.0, 0.001043, 1.672, 419060.0, 2506000.0, 419170.0, 2675600.0, 1307.1999999999998, 7354.2}, SaturationTableEntry{SaturationTableData{373.15, 101420.0, 0.001043, 1.672, 419060.0, 2506000.0, 419170.0, 2675600.0, 1307.1999999999998, 7354.2}, SaturationTableData{0.0, 8405.5, 1.5000000000000907e-06, 0.12669999999999992, 10530.0, 2950.0, 10540.0, 3900.0, 28.100000000000023, 29.499999999999545}, 2});
-    SaturationTable.insert(std::array<double, 10>{457.33888888888896, 1103161.1669069382, 0.0011330674844570246, 0.1769645398451971, 780349.8490064989, 2585581.9611780504, 781582.629178705, 2780733.3884386104, 2179.6902524793345, 6551.086875116526}, SaturationTableEntry{SaturationTableData{457.33888888888896, 1103161.1669069382, 0.0011330674844570246, 0.1769645398451971, 780349.8490064989, 2585581.9611780504, 781582.629178705, 2780733.3884386104, 2179.6902524793345, 6551.086875116526}, SaturationTableData{1.35277777777776, 0.0, 1.8728388172842801e-06, 0.004987994050033959, 5966.190833412809, 814.1001137210988, 6012.710839911189, 1046.700146212941, 13.00001581596257, 10.67634149136984}, 5});
-    SaturationTable.insert(std::array<double, 10>{525.5055555555556, 4136854.3759010183, 0.0012572991260035523, 0.048082015235746574, 1091964.1125356671, 2601166.163354996, 1097174.3532634818, 2800271.791167916, 2814.827901201247, 6055.369685870155}, SaturationTableEntry{SaturationTableData{525.5055555555556, 4136854.3759010183, 0.0012572991260035523, 0.048082015235746574, 1091964.1125356671, 2601166.163354996, 1097174.3532634818, 2800271.791167916, 2814.827901201247, 6055.369685870155}, SaturationTableData{2.5749999999999886, 0.0, 5.930656254733843e-06, 0.002249903699164252, 12281.281715563266, 581.5000812292565, 12525.511749679456, 697.8000974750612, 23.529819286862903, 18.212582544102588}, 5});
-    SaturationTable.insert(std::array<double, 10>{523.5, 4000000.0, 0.001252, 0.049779, 1082400.0, 2601700.0, 1087400.0, 2800800.0, 2796.6000000000004, 6069.6}, SaturationTableEntry{SaturationTableData{523.5, 4000000.0, 0.001252, 0.049779, 1082400.0, 2601700.0, 1087400.0, 2800800.0, 2796.6000000000004, 6069.6}, SaturationTableData{3.894999999999982, 0.0, 8.500000000000044e-06, 0.003641000000000002, 18499.99999999994, 650.0, 18850.0, 950.0, 35.65000000000032, 27.399999999999636}, 3});
-    SaturationTable.insert(std::array<double, 10>{618.15, 15541000.0, 0.001685, 0.009772, 1605500.0, 2443200.0, 1631700.0, 2595100.0, 3717.9, 5276.5}, SaturationTableEntry{SaturationTableData{618.15, 15541000.0, 0.001685, 0.009772, 1605500.0, 2443200.0, 1631700.0, 2595100.0, 3717.9, 5276.5}, SaturationTableData{0.0, 470000.0, 2.3500000000000083e-05, 0.0004829999999999999, 17400.0, 10650.0, 18550.0, 13450.0, 28.84999999999991, 29.65000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{453.03, 1000000.0, 0.001127, 0.19436, 761390.0, 2582800.0, 762510.0, 2777100.0, 2138.1, 6585.0}, SaturationTableEntry{SaturationTableData{453.03, 1000000.0, 0.001127, 0.19436, 761390.0, 2582800.0, 762510.0, 2777100.0, 2138.1, 6585.0}, SaturationTableData{1.1100000000000136, 0.0, 1.4999999999999823e-06, 0.004875000000000004, 4860.0, 750.0, 4885.0, 950.0, 10.75, 8.849999999999909}, 3});
-    SaturationTable.insert(std::array<double, 10>{280.12, 1000.0, 0.001, 129.19, 29302.0, 2384500.0, 29303.0, 2513700.0, 105.89999999999999, 8974.9}, SaturationTableEntry{SaturationTableData{280.12, 1000.0, 0.001, 129.19, 29302.0, 2384500.0, 29303.0, 2513700.0, 105.89999999999999, 8974.9}, SaturationTableData{3.0249999999999773, 0.0, 0.0005, 20.613, 12692.0, 4150.0, 12692.5, 5500.0, 44.85, 73.94999999999982}, 3});
-    SaturationTable.insert(std::array<double, 10>{328.15, 15763.0, 0.001015, 9.5639, 230240.0, 2449300.0, 230260.0, 2600100.0, 768.0, 7989.8}, SaturationTableEntry{SaturationTableData{328.15, 15763.0, 0.001015, 9.5639, 230240.0, 2449300.0, 230260.0, 2600100.0, 768.0, 7989.8}, SaturationTableData{0.0, 1705.5, 9.999999999999159e-07, 0.9484500000000002, 10455.0, 3300.0, 10460.0, 4350.0, 31.650000000000034, 40.80000000000018}, 2});
-    SaturationTable.insert(std::array<double, 10>{465.10555555555555, 1310003.885701989, 0.0011443045173607305, 0.15007681722505162, 814658.3537990288, 2590233.961827885, 816170.2540102251, 2786780.989283395, 2254.1315668779876, 6490.796946694671}, SaturationTableEntry{SaturationTableData{465.10555555555555, 1310003.885701989, 0.0011443045173607305, 0.15007681722505162, 814658.3537990288, 2590233.961827885, 816170.2540102251, 2786780.989283395, 2254.1315668779876, 6490.796946694671}, SaturationTableData{1.188888888888897, 0.0, 1.8728388172842801e-06, 0.0036145789173587795, 5280.020737562212, 581.5000812292565, 5314.910742435954, 814.1001137210988, 11.304361579097758, 9.001621257429633}, 5});
-    SaturationTable.insert(std::array<double, 10>{583.15, 9865018.735065294, 0.0014477044057607932, 0.018333219182396384, 1387715.0538488997, 2546970.3557844236, 1401996.6958438917, 2727933.181062988, 3350.5290360329464, 5624.129225630491}, SaturationTableEntry{SaturationTableData{583.15, 9865018.735065294, 0.0014477044057607932, 0.018333219182396384, 1387715.0538488997, 2546970.3557844236, 1401996.6958438917, 2727933.181062988, 3350.5290360329464, 5624.129225630491}, SaturationTableData{0.0, 363008.97148531396, 1.2485592115228823e-05, 0.0008209276815763014, 15398.122150952462, 4884.60068232636, 16049.402241929201, 6280.200877276715, 26.753655737198642, 23.02740321668125}, 4});
-    SaturationTable.insert(std::array<double, 10>{383.15, 143380.0, 0.001052, 1.2094, 461270.0, 2517700.0, 461420.0, 2691100.0, 1418.8, 7238.2}, SaturationTableEntry{SaturationTableData{383.15, 143380.0, 0.001052, 1.2094, 461270.0, 2517700.0, 461420.0, 2691100.0, 1418.8, 7238.2}, SaturationTableData{0.0, 11240.0, 2.0000000000000486e-06, 0.0867, 10560.0, 2800.0, 10570.0, 3750.0, 27.450000000000045, 27.65000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{373.15000000000003, 101414.98502521345, 0.0010431712212273763, 1.6719456401503048, 419052.2185370975, 2506032.75006588, 419168.51855334337, 2675598.1737523493, 1307.2028786022124, 7354.1152272909685}, SaturationTableEntry{SaturationTableData{373.15000000000003, 101414.98502521345, 0.0010431712212273763, 1.6719456401503048, 419052.2185370975, 2506032.75006588, 419168.51855334337, 2675598.1737523493, 1307.2028786022124, 7354.1152272909685}, SaturationTableData{0.0, 1975.3479644927356, 3.1213980288078563e-07, 0.03171340397268141, 2337.6303265418683, 697.8000974755269, 2337.6303265418683, 930.4001299669035, 6.280200877276684, 6.698880935761736}, 4});
-    SaturationTable.insert(std::array<double, 10>{414.45, 375000.0, 0.001081, 0.49133, 594320.0, 2550900.0, 594730.0, 2735100.0, 1752.6, 6917.099999999999}, SaturationTableEntry{SaturationTableData{414.45, 375000.0, 0.001081, 0.49133, 594320.0, 2550900.0, 594730.0, 2735100.0, 1752.6, 6917.099999999999}, SaturationTableData{1.1550000000000011, 0.0, 9.999999999999159e-07, 0.014454999999999996, 4950.0, 1100.0, 4965.0, 1500.0, 11.950000000000045, 10.799999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{499.8166666666667, 2630280.959770799, 0.001202362520696545, 0.07602477038962889, 971360.9956887062, 2602561.7635499467, 974524.3561305937, 2802365.191460341, 2579.194764285827, 6236.239471135724}, SaturationTableEntry{SaturationTableData{499.8166666666667, 2630280.959770799, 0.001202362520696545, 0.07602477038962889, 971360.9956887062, 2602561.7635499467, 974524.3561305937, 2802365.191460341, 2579.194764285827, 6236.239471135724}, SaturationTableData{0.0, 130483.28177321143, 4.994236846091594e-06, 0.003680128275963715, 12746.481780546776, 232.60003249160945, 12920.93180491554, 348.9000487374142, 25.602285576364693, 19.677962748800383}, 4});
-    SaturationTable.insert(std::array<double, 10>{588.15, 10556000.0, 0.001472, 0.016849, 1416100.0, 2537200.0, 1431600.0, 2715000.0, 3399.4, 5581.599999999999}, SaturationTableEntry{SaturationTableData{588.15, 10556000.0, 0.001472, 0.016849, 1416100.0, 2537200.0, 1431600.0, 2715000.0, 3399.4, 5581.599999999999}, SaturationTableData{0.0, 345500.0, 1.2500000000000033e-05, 0.0006895, 14200.0, 4950.0, 14800.0, 6450.0, 24.40000000000009, 21.350000000000364}, 2});
-    SaturationTable.insert(std::array<double, 10>{634.62, 19000000.0, 0.001926, 0.006677, 1740300.0, 2339200.0, 1776800.0, 2466000.0, 3939.6, 5025.599999999999}, SaturationTableEntry{SaturationTableData{634.62, 19000000.0, 0.001926, 0.006677, 1740300.0, 2339200.0, 1776800.0, 2466000.0, 3939.6, 5025.599999999999}, SaturationTableData{2.1399999999999864, 0.0, 4.299999999999996e-05, 0.0004074999999999999, 20600.0, 17900.0, 22300.0, 22000.0, 33.799999999999955, 40.40000000000009}, 3});
-    SaturationTable.insert(std::array<double, 10>{558.98, 7000000.0, 0.001352, 0.027378, 1258000.0, 2581000.0, 1267500.0, 2772600.0, 3122.0, 5814.8}, SaturationTableEntry{SaturationTableData{558.98, 7000000.0, 0.001352, 0.027378, 1258000.0, 2581000.0, 1267500.0, 2772600.0, 3122.0, 5814.8}, SaturationTableData{4.589999999999975, 0.0, 1.6000000000000064e-05, 0.0019264999999999994, 24000.0, 4450.0, 24800.0, 6000.0, 42.84999999999991, 34.90000000000009}, 3});
-    SaturationTable.insert(std::array<double, 10>{399.8166666666667, 244398.461770939, 0.00106626956664055, 0.7341528163754605, 531909.754302084, 2536038.1542573124, 532165.6143378249, 2715372.779308435, 1599.2740874014257, 7059.783146175935}, SaturationTableEntry{SaturationTableData{399.8166666666667, 244398.461770939, 0.00106626956664055, 0.7341528163754605, 531909.754302084, 2536038.1542573124, 532165.6143378249, 2715372.779308435, 1599.2740874014257, 7059.783146175935}, SaturationTableData{0.0, 19315.662556811178, 2.4971184230458514e-06, 0.05309498047001099, 11792.821647330595, 2907.500406146515, 11816.081650579756, 3837.9005361134186, 29.370406102730385, 27.632883860017046}, 4});
-    SaturationTable.insert(std::array<double, 10>{294.22999999999996, 2500.0, 0.001002, 54.242, 88422.0, 2403800.0, 88424.0, 2539400.0, 311.8, 8642.099999999999}, SaturationTableEntry{SaturationTableData{294.22999999999996, 2500.0, 0.001002, 54.242, 88422.0, 2403800.0, 88424.0, 2539400.0, 311.8, 8642.099999999999}, SaturationTableData{1.5, 0.0, 5e-07, 4.293999999999997, 6279.0, 2050.0, 6278.0, 2700.0, 21.25, 32.79999999999927}, 3});
-    SaturationTable.insert(std::array<double, 10>{431.06111111111113, 586054.3699193109, 0.0010993563857459065, 0.3226838854220338, 665747.8129978245, 2566043.5584487454, 666399.0930888013, 2755147.3848645203, 1921.6158644291124, 6767.125785294844}, SaturationTableEntry{SaturationTableData{431.06111111111113, 586054.3699193109, 0.0010993563857459065, 0.3226838854220338, 665747.8129978245, 2566043.5584487454, 666399.0930888013, 2755147.3848645203, 1921.6158644291124, 6767.125785294844}, SaturationTableData{1.1166666666666742, 0.0, 1.2485592115228173e-06, 0.008480838444269223, 4838.080675827921, 930.4001299669035, 4849.71067745256, 1279.3001787043177, 11.178757561552402, 9.62964134515778}, 5});
-    SaturationTable.insert(std::array<double, 10>{410.9277777777778, 339373.7434843332, 0.0010775065995442558, 0.5396210484241364, 579267.1209173999, 2547435.5558494073, 579639.2809693866, 2730491.7814203976, 1716.12769172462, 6950.507650911321}, SaturationTableEntry{SaturationTableData{410.9277777777778, 339373.7434843332, 0.0010775065995442558, 0.5396210484241364, 579267.1209173999, 2547435.5558494073, 579639.2809693866, 2730491.7814203976, 1716.12769172462, 6950.507650911321}, SaturationTableData{0.0, 25320.99615916083, 2.80925822592642e-06, 0.03693238147684719, 11850.971655453555, 2674.900373654673, 11885.861660327297, 3605.3005036215764, 28.721452012078544, 26.376843684561663}, 4});
-    SaturationTable.insert(std::array<double, 10>{515.71, 3500000.0, 0.001235, 0.057061, 1045400.0000000001, 2603000.0, 1049700.0, 2802700.0, 2725.2999999999997, 6124.4}, SaturationTableEntry{SaturationTableData{515.71, 3500000.0, 0.001235, 0.057061, 1045400.0000000001, 2603000.0, 1049700.0, 2802700.0, 2725.2999999999997, 6124.4}, SaturationTableData{3.894999999999982, 0.0, 8.500000000000044e-06, 0.003641000000000002, 18499.99999999994, 500.0, 18850.0, 250.0, 35.65000000000032, 27.399999999999636}, 3});
-    SaturationTable.insert(std::array<double, 10>{584.15, 10000000.0, 0.001452, 0.018028, 1393300.0, 2545200.0, 1407800.0, 2725500.0, 3360.3, 5615.9}, SaturationTableEntry{SaturationTableData{584.15, 10000000.0, 0.001452, 0.018028, 1393300.0, 2545200.0, 1407800.0, 2725500.0, 3360.3, 5615.9}, SaturationTableData{3.5400000000000205, 0.0, 1.699999999999998e-05, 0.00102, 20300.0, 6650.0, 21200.0, 8700.0, 34.799999999999955, 30.749999999999545}, 3});
-    SaturationTable.insert(std::array<double, 10>{633.15, 18666176.419794712, 0.0018946886034859887, 0.00695072913054794, 1726148.1011243642, 2351818.9285238637, 1761526.5660663561, 2481609.7466542483, 3916.3751350755733, 5053.468305915286}, SaturationTableEntry{SaturationTableData{633.15, 18666176.419794712, 0.0018946886034859887, 0.00695072913054794, 1726148.1011243642, 2351818.9285238637, 1761526.5660663561, 2481609.7466542483, 3916.3751350755733, 5053.468305915286}, SaturationTableData{0.0, 607083.3796634767, 4.713311023498909e-05, 0.0005119092767243852, 24283.443392136483, 20236.202826780267, 26260.54366831621, 24888.203476614784, 39.879275570706795, 46.68282652108974}, 4});
-    SaturationTable.insert(std::array<double, 10>{297.0388888888889, 2965.8487972293033, 0.0010025930468528824, 46.15111841512642, 100180.83399418733, 2407642.9363218783, 100180.83399418733, 2544411.755427015, 351.60751311579594, 8580.429118593858}, SaturationTableEntry{SaturationTableData{297.0388888888889, 2965.8487972293033, 0.0010025930468528824, 46.15111841512642, 100180.83399418733, 2407642.9363218783, 100180.83399418733, 2544411.755427015, 351.60751311579594, 8580.429118593858}, SaturationTableData{0.0, 230.35384116475507, 3.121398028806772e-07, 3.335525933583405, 5803.370810668617, 1860.800259933807, 5803.370810668617, 2442.3003411632963, 19.468622719557658, 29.72628415244253}, 4});
-    SaturationTable.insert(std::array<double, 10>{372.76, 100000.0, 0.001043, 1.6941, 417400.0, 2505600.0, 417510.0, 2675000.0, 1302.8, 7358.900000000001}, SaturationTableEntry{SaturationTableData{372.76, 100000.0, 0.001043, 1.6941, 417400.0, 2505600.0, 417510.0, 2675000.0, 1302.8, 7358.900000000001}, SaturationTableData{0.18000000000000682, 0.0, 5e-07, 0.01034999999999997, 775.0, 200.0, 775.0, 500.0, 2.0499999999999545, 2.200000000000273}, 3});
-    SaturationTable.insert(std::array<double, 10>{403.8277777777778, 275790.29172673455, 0.0010706395238808798, 0.6555560140100944, 548982.5966869768, 2540224.9548421632, 549261.7167259669, 2720955.1800882365, 1641.7701133376643, 7019.589860561366}, SaturationTableEntry{SaturationTableData{403.8277777777778, 275790.29172673455, 0.0010706395238808798, 0.6555560140100944, 548982.5966869768, 2540224.9548421632, 549261.7167259669, 2720955.1800882365, 1641.7701133376643, 7019.589860561366}, SaturationTableData{1.9972222222222342, 0.0, 1.8728388172843885e-06, 0.034279193152361, 8513.161189197272, 2093.400292425882, 8548.051194071071, 2791.2003899007104, 20.996804933028443, 19.677962748800383}, 5});
-    SaturationTable.insert(std::array<double, 10>{421.04999999999995, 450000.0, 0.001088, 0.41392, 622650.0, 2557100.0, 623140.0, 2743400.0, 1820.5, 6856.099999999999}, SaturationTableEntry{SaturationTableData{421.04999999999995, 450000.0, 0.001088, 0.41392, 622650.0, 2557100.0, 623140.0, 2743400.0, 1820.5, 6856.099999999999}, SaturationTableData{1.9650000000000318, 0.0, 2.0000000000000486e-06, 0.019545000000000007, 8445.0, 1800.0, 8475.0, 2350.0, 19.950000000000045, 17.699999999999363}, 3});
-    SaturationTable.insert(std::array<double, 10>{454.49444444444447, 1034213.5939752546, 0.0011293218068224558, 0.188220301137076, 767835.9672584439, 2583721.1609181166, 768998.9674209026, 2778407.3881136933, 2152.2248406427116, 6573.276918216237}, SaturationTableEntry{SaturationTableData{454.49444444444447, 1034213.5939752546, 0.0011293218068224558, 0.188220301137076, 767835.9672584439, 2583721.1609181166, 768998.9674209026, 2778407.3881136933, 2152.2248406427116, 6573.276918216237}, SaturationTableData{1.4222222222222456, 0.0, 1.8728388172843885e-06, 0.005627880645939443, 6256.940874027496, 930.4001299669035, 6291.830878901237, 1163.000162458513, 13.732705918311467, 11.095021549855574}, 5});
-    SaturationTable.insert(std::array<double, 10>{647.0944444444444, 22063912.81386808, 0.0031057910386631943, 0.0031057910386631943, 2015735.1415765658, 2015711.8815733166, 2084259.1111486289, 2084328.8911583764, 4406.900691596729, 4407.026295614275}, SaturationTableEntry{SaturationTableData{647.0944444444444, 22063912.81386808, 0.0031057910386631943, 0.0031057910386631943, 2015735.1415765658, 2015711.8815733166, 2084259.1111486289, 2084328.8911583764, 4406.900691596729, 4407.026295614275}, SaturationTableData{0.0, 369214.253049165, 0.0004073424427593435, 0.0007825344858219722, 75432.19053706748, 95017.11327287089, 85259.54190984298, 110485.01543357084, 130.50257422980894, 173.33354421283548}, 4});
-    SaturationTable.insert(std::array<double, 10>{427.59444444444443, 535660.5888635434, 0.0010956107081113377, 0.3512571629777352, 650791.6309086063, 2563019.758026353, 651396.3909930849, 2751193.184312161, 1886.781683563151, 6797.270749505771}, SaturationTableEntry{SaturationTableData{427.59444444444443, 535660.5888635434, 0.0010956107081113377, 0.3512571629777352, 650791.6309086063, 2563019.758026353, 651396.3909930849, 2751193.184312161, 1886.781683563151, 6797.270749505771}, SaturationTableData{0.0, 36759.39850852711, 3.121398028807206e-06, 0.022230596761165095, 11955.641670074838, 2442.3003411630634, 12002.161676573218, 3140.1004386383574, 27.863157892184176, 24.07410336289331}, 4});
-    SaturationTable.insert(std::array<double, 10>{460.9277777777778, 1195275.1243436676, 0.001138061721303116, 0.1638858821044948, 796166.6512159364, 2587675.3614704763, 797538.9914076376, 2783524.5888285115, 2214.147621292659, 6523.035311198024}, SaturationTableEntry{SaturationTableData{460.9277777777778, 1195275.1243436676, 0.001138061721303116, 0.1638858821044948, 796166.6512159364, 2587675.3614704763, 797538.9914076376, 2783524.5888285115, 2214.147621292659, 6523.035311198024}, SaturationTableData{0.0, 70085.2078850565, 3.7456776345686687e-06, 0.009023961701281696, 12246.391710689466, 1628.2002274421975, 12327.801722061646, 2093.4002924254164, 26.544315707956002, 21.35268298274059}, 4});
-    SaturationTable.insert(std::array<double, 10>{305.37222222222226, 4819.711138216413, 0.001005090165275928, 29.178828773289986, 135024.3188614482, 2419040.3379139733, 135024.3188614482, 2559530.757538977, 467.28881327523203, 8406.676894322536}, SaturationTableEntry{SaturationTableData{305.37222222222226, 4819.711138216413, 0.001005090165275928, 29.178828773289986, 135024.3188614482, 2419040.3379139733, 135024.3188614482, 2559530.757538977, 467.28881327523203, 8406.676894322536}, SaturationTableData{0.0, 353.18394234254947, 3.121398028806772e-07, 1.9870819851386816, 5803.37081066861, 1860.8002599335741, 5803.37081066861, 2442.3003411632963, 18.924338643526966, 27.6328838600175}, 4});
-    SaturationTable.insert(std::array<double, 10>{291.48333333333335, 2108.2788851050223, 0.0010013444876413593, 63.726462156128406, 76944.09074826368, 2399967.1352496515, 76944.09074826368, 2534409.95402987, 272.60258607965557, 8703.521055788482}, SaturationTableEntry{SaturationTableData{291.48333333333335, 2108.2788851050223, 0.0010013444876413593, 63.726462156128406, 76944.09074826368, 2399967.1352496515, 76944.09074826368, 2534409.95402987, 272.60258607965557, 8703.521055788482}, SaturationTableData{0.0, 170.30050514125867, 5e-20, 4.795091651853667, 5815.000812293205, 1860.800259933807, 5815.000812293205, 2558.600357408868, 19.84543477219424, 31.191664357142145}, 4});
-    SaturationTable.insert(std::array<double, 10>{302.10999999999996, 4000.0, 0.001004, 34.791, 121390.0, 2414500.0, 121390.0, 2553700.0, 422.4, 8473.4}, SaturationTableEntry{SaturationTableData{302.10999999999996, 4000.0, 0.001004, 34.791, 121390.0, 2414500.0, 121390.0, 2553700.0, 422.4, 8473.4}, SaturationTableData{1.9550000000000125, 0.0, 5e-07, 3.302999999999999, 8180.0, 2650.0, 8180.0, 3500.0, 26.900000000000006, 39.79999999999927}, 3});
-    SaturationTable.insert(std::array<double, 10>{455.37222222222226, 1055104.7085735546, 0.0011305703660339787, 0.18466190738423574, 771673.8677945575, 2584186.3609831003, 772883.3879635143, 2779105.188211168, 2160.6821778241106, 6566.159357221991}, SaturationTableEntry{SaturationTableData{455.37222222222226, 1055104.7085735546, 0.0011305703660339787, 0.18466190738423574, 771673.8677945575, 2584186.3609831003, 772883.3879635143, 2779105.188211168, 2160.6821778241106, 6566.159357221991}, SaturationTableData{0.0, 63431.76709714893, 3.7456776345686687e-06, 0.010388012639870464, 12176.611700941983, 1744.5002436880022, 12269.651713938569, 2209.700308671687, 26.732721734274264, 21.562023011983456}, 4});
-    SaturationTable.insert(std::array<double, 10>{628.15, 17570000.0, 0.001808, 0.007872, 1682200.0, 2388600.0, 1714000.0, 2526900.0, 3844.2, 5138.4}, SaturationTableEntry{SaturationTableData{628.15, 17570000.0, 0.001808, 0.007872, 1682200.0, 2388600.0, 1714000.0, 2526900.0, 3844.2, 5138.4}, SaturationTableData{0.0, 520500.0, 3.35e-05, 0.00046100000000000047, 19900.0, 14850.0, 21400.0, 18500.0, 32.700000000000045, 36.500000000000455}, 2});
-    SaturationTable.insert(std::array<double, 10>{591.23, 11000000.0, 0.001488, 0.015988, 1433900.0, 2530400.0, 1450200.0, 2706300.0, 3429.9, 5554.400000000001}, SaturationTableEntry{SaturationTableData{591.23, 11000000.0, 0.001488, 0.015988, 1433900.0, 2530400.0, 1450200.0, 2706300.0, 3429.9, 5554.400000000001}, SaturationTableData{3.2999999999999545, 0.0, 1.8000000000000004e-05, 0.000861999999999999, 19550.0, 7400.0, 20550.0, 9600.0, 33.25, 30.250000000000455}, 3});
-    SaturationTable.insert(std::array<double, 10>{381.99444444444447, 137895.14586336727, 0.0010506625764965137, 1.2543650118564735, 456384.5237520199, 2516267.1514955154, 456524.08377151494, 2689321.5756693613, 1406.0113724046987, 7251.119932903632}, SaturationTableEntry{SaturationTableData{381.99444444444447, 137895.14586336727, 0.0010506625764965137, 1.2543650118564735, 456384.5237520199, 2516267.1514955154, 456524.08377151494, 2689321.5756693613, 1406.0113724046987, 7251.119932903632}, SaturationTableData{3.36388888888888, 0.0, 2.8092582259265286e-06, 0.11817612937064181, 14235.121988493745, 3837.9005361134186, 14246.751990118355, 5117.200714817969, 36.94851516131098, 37.262525205174825}, 5});
-    SaturationTable.insert(std::array<double, 10>{333.93333333333334, 20684.27187950509, 0.001017575757391157, 7.410198920388364, 254441.17554270147, 2456954.1432101247, 254464.43554595066, 2610237.564622174, 841.1282374965873, 7895.468542912216}, SaturationTableEntry{SaturationTableData{333.93333333333334, 20684.27187950509, 0.001017575757391157, 7.410198920388364, 254441.17554270147, 2456954.1432101247, 254464.43554595066, 2610237.564622174, 841.1282374965873, 7895.468542912216}, SaturationTableData{3.194444444444457, 0.0, 1.8728388172843885e-06, 0.8762076406664772, 13374.501868274368, 4186.8005848512985, 13374.501868274354, 5466.100763555616, 39.66993554146421, 49.613586930485326}, 5});
-    SaturationTable.insert(std::array<double, 10>{548.15, 5946400.0, 0.001317, 0.032767, 1202900.0, 2590300.0, 1210700.0, 2785200.0, 3022.1, 5894.4}, SaturationTableEntry{SaturationTableData{548.15, 5946400.0, 0.001317, 0.032767, 1202900.0, 2590300.0, 1210700.0, 2785200.0, 3022.1, 5894.4}, SaturationTableData{0.0, 221700.0, 7.000000000000062e-06, 0.0013069999999999991, 12500.0, 1700.0, 12800.0, 2250.0, 22.950000000000045, 18.050000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{327.12, 15000.0, 0.001014, 10.02, 225930.0, 2448000.0, 225940.0, 2598300.0, 754.9, 8007.099999999999}, SaturationTableEntry{SaturationTableData{327.12, 15000.0, 0.001014, 10.02, 225930.0, 2448000.0, 225940.0, 2598300.0, 754.9, 8007.099999999999}, SaturationTableData{3.0449999999999875, 0.0, 1.4999999999999823e-06, 1.1859499999999996, 12735.0, 4000.0, 12740.0, 5300.0, 38.55000000000001, 49.899999999999636}, 3});
-    SaturationTable.insert(std::array<double, 10>{411.47777777777776, 344737.86465841817, 0.0010781308791500174, 0.5317301542073116, 581616.3812455664, 2547900.755914391, 581988.5412975531, 2731189.5815178724, 1721.8217405200176, 6945.064810151016}, SaturationTableEntry{SaturationTableData{411.47777777777776, 344737.86465841817, 0.0010781308791500174, 0.5317301542073116, 581616.3812455664, 2547900.755914391, 581988.5412975531, 2731189.5815178724, 1721.8217405200176, 6945.064810151016}, SaturationTableData{1.6833333333333371, 0.0, 1.5606990144034945e-06, 0.022764355824091115, 7210.60100724356, 1744.5002436877694, 7222.231008868199, 2209.700308671221, 17.438024435904936, 15.909842222434236}, 5});
-    SaturationTable.insert(std::array<double, 10>{468.15, 1398800.0, 0.001149, 0.14089, 828180.0, 2591700.0, 829780.0, 2788800.0, 2283.1, 6467.8}, SaturationTableEntry{SaturationTableData{468.15, 1398800.0, 0.001149, 0.14089, 828180.0, 2591700.0, 829780.0, 2788800.0, 2283.1, 6467.8}, SaturationTableData{0.0, 71800.0, 3.999999999999989e-06, 0.006839999999999999, 11090.0, 1250.0, 11175.0, 1600.0, 23.700000000000045, 18.800000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{487.23333333333335, 2068427.1879505091, 0.001179888454889133, 0.0963575571492792, 913862.2676567509, 2599770.563160046, 916304.567997914, 2798876.190972965, 2462.592367997724, 6326.674363768508}, SaturationTableEntry{SaturationTableData{487.23333333333335, 2068427.1879505091, 0.001179888454889133, 0.0963575571492792, 913862.2676567509, 2599770.563160046, 916304.567997914, 2798876.190972965, 2462.592367997724, 6326.674363768508}, SaturationTableData{3.9972222222222342, 0.0, 6.867075663375983e-06, 0.006779676518569304, 18212.582544102333, 930.4001299669035, 18433.55257496948, 1279.3001787045505, 37.09505318178071, 28.888924035472883}, 5});
-    SaturationTable.insert(std::array<double, 10>{563.15, 7441800.0, 0.001366, 0.025554, 1279700.0, 2576500.0, 1289800.0, 2766700.0, 3160.8, 5783.400000000001}, SaturationTableEntry{SaturationTableData{563.15, 7441800.0, 0.001366, 0.025554, 1279700.0, 2576500.0, 1289800.0, 2766700.0, 3160.8, 5783.400000000001}, SaturationTableData{0.0, 263600.0, 8.500000000000044e-06, 0.001013, 13000.0, 2650.0, 13350.0, 3500.0, 23.200000000000273, 18.799999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{558.15, 6914600.0, 0.001349, 0.027756, 1253700.0, 2581800.0, 1263100.0, 2773700.0, 3114.3999999999996, 5821.0}, SaturationTableEntry{SaturationTableData{558.15, 6914600.0, 0.001349, 0.027756, 1253700.0, 2581800.0, 1263100.0, 2773700.0, 3114.3999999999996, 5821.0}, SaturationTableData{0.0, 249000.0, 7.999999999999978e-06, 0.0011009999999999995, 12750.0, 2300.0, 13200.0, 3100.0, 23.149999999999864, 18.449999999999818}, 2});
-    SaturationTable.insert(std::array<double, 10>{647.0944444444444, 22063912.81386808, 0.0031057910386631943, 0.0031057910386631943, 2015735.1415765658, 2015711.8815733166, 2084259.1111486289, 2084328.8911583764, 4406.900691596729, 4407.026295614275}, SaturationTableEntry{SaturationTableData{647.0944444444444, 22063912.81386808, 0.0031057910386631943, 0.0031057910386631943, 2015735.1415765658, 2015711.8815733166, 2084259.1111486289, 2084328.8911583764, 4406.900691596729, 4407.026295614275}, SaturationTableData{2.691666666666663, 0.0, 0.00048131957604207517, 0.0010878072130393194, 96784.87351980817, 120021.61676573171, 108880.07520937792, 140374.11960875778, 166.13224720689186, 222.10977102635115}, 5});
-    SaturationTable.insert(std::array<double, 10>{372.0388888888889, 97464.28909622798, 0.0010425469416216148, 1.7353724480956676, 414376.95788401377, 2504637.149870929, 414493.25790025963, 2673737.3734924155, 1294.642476847659, 7367.512989162492}, SaturationTableEntry{SaturationTableData{372.0388888888889, 97464.28909622798, 0.0010425469416216148, 1.7353724480956676, 414376.95788401377, 2504637.149870929, 414493.25790025963, 2673737.3734924155, 1294.642476847659, 7367.512989162492}, SaturationTableData{0.0, 1975.3479644927356, 3.1213980288078563e-07, 0.03171340397268141, 2337.6303265418683, 697.8000974755269, 2337.6303265418683, 930.4001299669035, 6.280200877276684, 6.698880935761736}, 4});
-    SaturationTable.insert(std::array<double, 10>{303.15, 4246.900000000001, 0.001004, 32.879, 125730.0, 2415900.0, 125740.0, 2555600.0, 436.8, 8452.0}, SaturationTableEntry{SaturationTableData{303.15, 4246.900000000001, 0.001004, 32.879, 125730.0, 2415900.0, 125740.0, 2555600.0, 436.8, 8452.0}, SaturationTableData{0.0, 538.5500000000004, 5e-07, 3.8369999999999997, 10450.0, 3400.0, 10450.0, 4500.0, 34.14999999999998, 50.150000000000546}, 2});
-    SaturationTable.insert(std::array<double, 10>{428.61, 550000.0, 0.001097, 0.34261, 655160.0, 2563900.0, 655770.0, 2752400.0, 1897.0, 6788.599999999999}, SaturationTableEntry{SaturationTableData{428.61, 550000.0, 0.001097, 0.34261, 655160.0, 2563900.0, 655770.0, 2752400.0, 1897.0, 6788.599999999999}, SaturationTableData{1.6850000000000023, 0.0, 1.99999999999994e-06, 0.013505000000000017, 7280.0, 1450.0, 7305.0, 1900.0, 16.90000000000009, 14.650000000000091}, 3});
-    SaturationTable.insert(std::array<double, 10>{523.15, 3976200.0, 0.001252, 0.050085, 1080700.0, 2601800.0, 1085700.0, 2801000.0, 2793.2999999999997, 6072.099999999999}, SaturationTableEntry{SaturationTableData{523.15, 3976200.0, 0.001252, 0.050085, 1080700.0, 2601800.0, 1085700.0, 2801000.0, 2793.2999999999997, 6072.099999999999}, SaturationTableData{0.0, 162500.0, 5.499999999999971e-06, 0.0020719999999999975, 11900.0, 450.0, 12100.0, 600.0, 22.84999999999991, 17.550000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{488.7055555555556, 2128825.261838664, 0.0011823855733121788, 0.09367939764056259, 920537.8885892634, 2600003.1631925376, 923049.9689401741, 2799573.99107044, 2476.283205910187, 6315.788682247894}, SaturationTableEntry{SaturationTableData{488.7055555555556, 2128825.261838664, 0.0011823855733121788, 0.09367939764056259, 920537.8885892634, 2600003.1631925376, 923049.9689401741, 2799573.99107044, 2476.283205910187, 6315.788682247894}, SaturationTableData{0.0, 110557.43319595465, 4.994236846091486e-06, 0.004685218441239647, 12583.661757802474, 697.800097475294, 12723.221777297556, 814.1001137213316, 25.790691602682955, 19.88730277804234}, 4});
-    SaturationTable.insert(std::array<double, 10>{516.4833333333333, 3547490.522480986, 0.0012366978990134246, 0.056283800696240456, 1049049.4065409433, 2602794.3635824383, 1053445.5471550368, 2802597.7914928333, 2732.306061673832, 6119.009054759892}, SaturationTableEntry{SaturationTableData{516.4833333333333, 3547490.522480986, 0.0012366978990134246, 0.056283800696240456, 1049049.4065409433, 2602794.3635824383, 1053445.5471550368, 2802597.7914928333, 2732.306061673832, 6119.009054759892}, SaturationTableData{0.0, 164681.2779473262, 5.930656254733843e-06, 0.0026107373112943706, 13048.861822785926, 232.60003249184228, 13281.461855277594, 232.60003249137662, 25.413879550046204, 19.46862271955797}, 4});
-    SaturationTable.insert(std::array<double, 10>{518.15, 3651200.0, 0.00124, 0.054656, 1056900.0, 2602700.0, 1061500.0, 2802200.0, 2747.6, 6107.2}, SaturationTableEntry{SaturationTableData{518.15, 3651200.0, 0.00124, 0.054656, 1056900.0, 2602700.0, 1061500.0, 2802200.0, 2747.6, 6107.2}, SaturationTableData{0.0, 152100.0, 5.499999999999971e-06, 0.002285500000000003, 11749.999999999942, 200.0, 12000.0, 400.0, 22.84999999999991, 17.550000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{594.2611111111112, 11451502.388223335, 0.0015051381294908463, 0.015175612936454991, 1451680.0627841249, 2523245.1524702674, 1468915.7251917617, 2696997.376741588, 3460.181343350197, 5526.995452061946}, SaturationTableEntry{SaturationTableData{594.2611111111112, 11451502.388223335, 0.0015051381294908463, 0.015175612936454991, 1451680.0627841249, 2523245.1524702674, 1468915.7251917617, 2696997.376741588, 3460.181343350197, 5526.995452061946}, SaturationTableData{0.0, 408169.63175556716, 1.529485034115546e-05, 0.0007016902768758656, 16200.59226304898, 6396.50089352252, 16979.802371896105, 8257.301153456327, 27.6747518658658, 24.70212345062191}, 4});
-    SaturationTable.insert(std::array<double, 10>{414.84444444444443, 379211.65112426, 0.0010812522771788244, 0.4862014425591294, 596037.5832600535, 2551389.7564017666, 596433.0033152895, 2735608.982135215, 1756.6977893918274, 6913.2451257061475}, SaturationTableEntry{SaturationTableData{414.84444444444443, 379211.65112426, 0.0010812522771788244, 0.4862014425591294, 596037.5832600535, 2551389.7564017666, 596433.0033152895, 2735608.982135215, 1756.6977893918274, 6913.2451257061475}, SaturationTableData{1.5666666666666629, 0.0, 1.5606990144034945e-06, 0.01909047034418504, 6698.880935761728, 1395.6001949501224, 6722.140939010889, 1977.1002761798445, 16.119182251676648, 14.653802046978853}, 5});
-    SaturationTable.insert(std::array<double, 10>{438.09999999999997, 700000.0, 0.001108, 0.27278, 696230.0, 2571800.0, 697000.0, 2762800.0, 1991.8, 6707.099999999999}, SaturationTableEntry{SaturationTableData{438.09999999999997, 700000.0, 0.001108, 0.27278, 696230.0, 2571800.0, 697000.0, 2762800.0, 1991.8, 6707.099999999999}, SaturationTableData{1.4000000000000057, 0.0, 1.4999999999999823e-06, 0.008629999999999999, 6085.0, 1100.0, 6120.0, 1450.0, 13.849999999999909, 11.699999999999818}, 3});
-    SaturationTable.insert(std::array<double, 10>{599.8166666666667, 12315415.47705733, 0.0015382249485962028, 0.01377223238270326, 1485081.427449937, 2508823.95045578, 1504038.330098013, 2678389.37414225, 3516.8287552632323, 5474.660444751307}, SaturationTableEntry{SaturationTableData{599.8166666666667, 12315415.47705733, 0.0015382249485962028, 0.01377223238270326, 1485081.427449937, 2508823.95045578, 1504038.330098013, 2678389.37414225, 3516.8287552632323, 5474.660444751307}, SaturationTableData{0.0, 431956.5444169976, 1.6543409552678278e-05, 0.0006520600482178302, 16700.682332906057, 7210.601007243618, 17561.302453125594, 9304.001299669035, 28.323705956517642, 26.16750365531925}, 4});
-    SaturationTable.insert(std::array<double, 10>{458.15, 1123500.0, 0.001134, 0.1739, 783910.0, 2586000.0, 785190.0, 2781400.0, 2187.5, 6544.7}, SaturationTableEntry{SaturationTableData{458.15, 1123500.0, 0.001134, 0.1739, 783910.0, 2586000.0, 785190.0, 2781400.0, 2187.5, 6544.7}, SaturationTableData{0.0, 60350.0, 3.500000000000031e-06, 0.00877, 10995.0, 1500.0, 11070.0, 1950.0, 24.0, 19.40000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{283.15000000000003, 1228.094169059149, 0.0010000959284298366, 106.32105965723187, 42030.825871255285, 2388569.733657557, 42030.825871255285, 2519290.9519179077, 151.10163310727643, 8899.463323159513}, SaturationTableEntry{SaturationTableData{283.15000000000003, 1228.094169059149, 0.0010000959284298366, 106.32105965723187, 42030.825871255285, 2388569.733657557, 42030.825871255285, 2519290.9519179077, 151.10163310727643, 8899.463323159513}, SaturationTableData{0.0, 105.35189143961264, 5e-20, 8.51205242455731, 5815.000812293205, 1860.8002599340398, 5815.000812293205, 2558.6003574086353, 20.45252085699765, 33.49440467880959}, 4});
-    SaturationTable.insert(std::array<double, 10>{373.12222222222226, 101325.35318040226, 0.0010431712212273763, 1.673381483243556, 418959.1785241008, 2506032.75006588, 419052.2185370975, 2675598.1737523493, 1306.909802561273, 7354.533907349453}, SaturationTableEntry{SaturationTableData{373.12222222222226, 101325.35318040226, 0.0010431712212273763, 1.673381483243556, 418959.1785241008, 2506032.75006588, 419052.2185370975, 2675598.1737523493, 1306.909802561273, 7354.533907349453}, SaturationTableData{0.2888888888888914, 0.0, 3.121398028806772e-07, 0.015856701986340704, 1209.5201689569803, 348.9000487374142, 1221.15017058159, 465.20006498345174, 3.244770453259548, 3.55878049712328}, 5});
-    SaturationTable.insert(std::array<double, 10>{641.7111111111111, 20684271.87950509, 0.002143151886579044, 0.005281405464741833, 1822165.3945369495, 2255755.11510478, 1866498.960729873, 2365077.130375892, 4074.6361971829456, 4851.245837666977}, SaturationTableEntry{SaturationTableData{641.7111111111111, 20684271.87950509, 0.002143151886579044, 0.005281405464741833, 1822165.3945369495, 2255755.11510478, 1866498.960729873, 2365077.130375892, 4074.6361971829456, 4851.245837666977}, SaturationTableData{2.691666666666663, 0.0, 0.00017885610705065417, 0.0010878072130393194, 76432.37067678198, 71408.20997496066, 83212.66162391589, 87108.71216815244, 125.81335757477586, 155.53964172721862}, 5});
-    SaturationTable.insert(std::array<double, 10>{407.82222222222225, 310264.07819257636, 0.0010743852015154486, 0.5869976277053724, 566008.9190653714, 2544411.755427015, 566357.819114109, 2726537.580868038, 1683.7637232037212, 6980.233935063765}, SaturationTableEntry{SaturationTableData{407.82222222222225, 310264.07819257636, 0.0010743852015154486, 0.5869976277053724, 566008.9190653714, 2544411.755427015, 566357.819114109, 2726537.580868038, 1683.7637232037212, 6980.233935063765}, SaturationTableData{1.8277777777777544, 0.0, 1.8728388172843885e-06, 0.027633736749030413, 7803.7310900975135, 1744.5002436880022, 7815.361091722036, 2326.0003249172587, 19.0290086581482, 17.584562456374442}, 5});
-    SaturationTable.insert(std::array<double, 10>{560.9277777777778, 7203642.419902306, 0.0013584324221369067, 0.026510033458659807, 1268088.8571384037, 2579069.160268282, 1277881.3185063056, 2770033.786943991, 3140.10043863833, 5799.974850194238}, SaturationTableEntry{SaturationTableData{560.9277777777778, 7203642.419902306, 0.0013584324221369067, 0.026510033458659807, 1268088.8571384037, 2579069.160268282, 1277881.3185063056, 2770033.786943991, 3140.10043863833, 5799.974850194238}, SaturationTableData{0.0, 284615.58106199, 9.364194086421834e-06, 0.0011627207657306932, 14304.901998241316, 2674.9003736549057, 14758.472061600187, 3605.3005036215764, 25.748823596834427, 20.724662895012898}, 4});
-    SaturationTable.insert(std::array<double, 10>{441.35555555555555, 758423.30224852, 0.0011118419778611353, 0.25227138868820037, 710383.7592329871, 2574417.1596184475, 711244.3793532064, 2766079.5863916315, 2023.9412707228735, 6679.6216530714555}, SaturationTableEntry{SaturationTableData{441.35555555555555, 758423.30224852, 0.0011118419778611353, 0.25227138868820037, 710383.7592329871, 2574417.1596184475, 711244.3793532064, 2766079.5863916315, 2023.9412707228735, 6679.6216530714555}, SaturationTableData{1.8000000000000114, 0.0, 2.1849786201650657e-06, 0.009741883247907382, 7850.251096595835, 1279.3001787045505, 7873.511099845055, 1860.800259933807, 17.710166473920026, 14.863142076221266}, 5});
-    SaturationTable.insert(std::array<double, 10>{377.59444444444443, 118596.72019978902, 0.001046916898861945, 1.4443332958896815, 437799.7811559308, 2511149.950780697, 437939.34117542586, 2682576.174727101, 1357.1095415736377, 7301.361539921845}, SaturationTableEntry{SaturationTableData{377.59444444444443, 118596.72019978902, 0.001046916898861945, 1.4443332958896815, 437799.7811559308, 2511149.950780697, 437939.34117542586, 2682576.174727101, 1357.1095415736377, 7301.361539921845}, SaturationTableData{0.0, 8590.867587287787, 1.8728388172842801e-06, 0.11380617213031163, 9373.781309416634, 2558.6003574086353, 9385.411311041244, 3489.0004873757716, 24.953331485712624, 26.376843684561663}, 4});
-    SaturationTable.insert(std::array<double, 10>{538.15, 5085300.0, 0.001289, 0.038748, 1153300.0, 2596500.0, 1159800.0, 2793500.0, 2930.4, 5966.2}, SaturationTableEntry{SaturationTableData{538.15, 5085300.0, 0.001289, 0.038748, 1153300.0, 2596500.0, 1159800.0, 2793500.0, 2930.4, 5966.2}, SaturationTableData{0.0, 196500.0, 6.499999999999995e-06, 0.0015629999999999984, 12250.0, 1100.0, 12500.0, 1550.0, 22.850000000000136, 17.75}, 2});
-    SaturationTable.insert(std::array<double, 10>{313.44, 7500.0, 0.001008, 19.233, 168740.0, 2429800.0, 168750.0, 2574000.0, 576.3000000000001, 8250.1}, SaturationTableEntry{SaturationTableData{313.44, 7500.0, 0.001008, 19.233, 168740.0, 2429800.0, 168750.0, 2574000.0, 576.3000000000001, 8250.1}, SaturationTableData{2.759999999999991, 0.0, 1.0000000000000243e-06, 2.2815000000000003, 11525.0, 3700.0, 11530.0, 4950.0, 36.44999999999999, 50.650000000000546}, 3});
-    SaturationTable.insert(std::array<double, 10>{293.15, 2339.2, 0.001002, 57.762, 83913.0, 2402300.0, 83915.0, 2537400.0, 296.5, 8666.1}, SaturationTableEntry{SaturationTableData{293.15, 2339.2, 0.001002, 57.762, 83913.0, 2402300.0, 83915.0, 2537400.0, 296.5, 8666.1}, SaturationTableData{0.0, 316.7499999999999, 5e-07, 7.2109999999999985, 10458.5, 3400.0, 10457.5, 4550.0, 35.35000000000002, 54.70000000000073}, 2});
-    SaturationTable.insert(std::array<double, 10>{473.15, 1554900.0, 0.001157, 0.12721, 850460.0, 2594200.0, 852260.0, 2792000.0, 2330.5, 6430.2}, SaturationTableEntry{SaturationTableData{473.15, 1554900.0, 0.001157, 0.12721, 850460.0, 2594200.0, 852260.0, 2792000.0, 2330.5, 6430.2}, SaturationTableData{0.0, 78050.0, 3.500000000000031e-06, 0.006064999999999994, 11140.0, 1100.0, 11240.0, 1400.0, 23.550000000000182, 18.59999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{416.48333333333335, 396951.8616395822, 0.0010831251159961089, 0.465756285470442, 603038.8442380545, 2552785.3565967167, 603480.7842997888, 2737702.3824276407, 1773.5705957487771, 6897.753963542198}, SaturationTableEntry{SaturationTableData{416.48333333333335, 396951.8616395822, 0.0010831251159961089, 0.465756285470442, 603038.8442380545, 2552785.3565967167, 603480.7842997888, 2737702.3824276407, 1773.5705957487771, 6897.753963542198}, SaturationTableData{0.0, 28789.059077624494, 2.8092582259265286e-06, 0.031039181998459064, 11885.861660327297, 2674.900373654673, 11920.751665201096, 3489.0004873760045, 28.44930997406334, 25.330143538349148}, 4});
-    SaturationTable.insert(std::array<double, 10>{544.2611111111112, 5599301.345354959, 0.0013059929352529451, 0.03496527643909283, 1183468.965317913, 2593025.1622177856, 1190772.6063381534, 2788874.389575821, 2986.319253156749, 5922.229427271891}, SaturationTableEntry{SaturationTableData{544.2611111111112, 5599301.345354959, 0.0013059929352529451, 0.03496527643909283, 1183468.965317913, 2593025.1622177856, 1190772.6063381534, 2788874.389575821, 2986.319253156749, 5922.229427271891}, SaturationTableData{0.0, 234421.74796772422, 7.803495072018123e-06, 0.0015475891426826247, 13735.031918636523, 1628.2002274421975, 14072.30196574959, 2093.4002924256492, 25.43481355297058, 19.88730277804234}, 4});
-    SaturationTable.insert(std::array<double, 10>{311.8666666666667, 6894.7572931683635, 0.001007587283698974, 20.819100572538463, 162168.74265323288, 2427646.539116167, 162168.74265323288, 2571160.7591635636, 555.2534935629537, 8279.816836601549}, SaturationTableEntry{SaturationTableData{311.8666666666667, 6894.7572931683635, 0.001007587283698974, 20.819100572538463, 162168.74265323288, 2427646.539116167, 162168.74265323288, 2571160.7591635636, 555.2534935629537, 8279.816836601549}, SaturationTableData{6.758333333333326, 0.0, 2.8092582259265286e-06, 4.9873697704281925, 28260.90394774497, 9071.401267177425, 28260.90394774497, 12095.201689569745, 88.69737039007072, 121.83589701916753}, 5});
-    SaturationTable.insert(std::array<double, 10>{646.8599999999999, 22000000.0, 0.002703, 0.003644, 1951700.0, 2092400.0, 2011100.0, 2172600.0, 4294.2, 4543.9}, SaturationTableEntry{SaturationTableData{646.8599999999999, 22000000.0, 0.002703, 0.003644, 1951700.0, 2092400.0, 2011100.0, 2172600.0, 4294.2, 4543.9}, SaturationTableData{0.12000000000000455, 0.0, 0.00020149999999999986, 0.00026900000000000014, 32000.0, 38350.0, 36600.00000000012, 44149.99999999988, 56.40000000000009, 68.44999999999982}, 3});
-    SaturationTable.insert(std::array<double, 10>{422.0388888888889, 462141.7918464891, 0.0010893679120537233, 0.4036779214735239, 626880.3475684567, 2558135.1573440265, 627392.0676399384, 2744680.3834023927, 1830.4692156969038, 6847.0936764655}, SaturationTableEntry{SaturationTableData{422.0388888888889, 462141.7918464891, 0.0010893679120537233, 0.4036779214735239, 626880.3475684567, 2558135.1573440265, 627392.0676399384, 2744680.3834023927, 1830.4692156969038, 6847.0936764655}, SaturationTableData{0.0, 32594.96510345346, 3.121398028807206e-06, 0.02621037924789435, 11920.751665201096, 2442.3003411632963, 11955.641670074838, 3256.400454884162, 28.156233933123644, 24.911463479864324}, 4});
-    SaturationTable.insert(std::array<double, 10>{294.2611111111111, 2505.141114899793, 0.0010019687672471207, 54.13627885242107, 88574.0923728501, 2403921.3358020107, 88574.0923728501, 2539527.1547446884, 312.29345562404404, 8641.137727074198}, SaturationTableEntry{SaturationTableData{294.2611111111111, 2505.141114899793, 0.0010019687672471207, 54.13627885242107, 88574.0923728501, 2403921.3358020107, 88574.0923728501, 2539527.1547446884, 312.29345562404404, 8641.137727074198}, SaturationTableData{0.0, 198.43111489738544, 3.121398028806772e-07, 3.9925802186473263, 5803.370810668617, 1860.800259933807, 5803.370810668617, 2442.3003411632963, 19.657028745875948, 30.354304240169768}, 4});
-    SaturationTable.insert(std::array<double, 10>{608.15, 13707000.0, 0.001597, 0.011848, 1537500.0, 2483000.0, 1559400.0, 2645400.0, 3605.0, 5390.7}, SaturationTableEntry{SaturationTableData{608.15, 13707000.0, 0.001597, 0.011848, 1537500.0, 2483000.0, 1559400.0, 2645400.0, 3605.0, 5390.7}, SaturationTableData{0.0, 424500.0, 1.8499999999999962e-05, 0.0005325, 15900.0, 8100.0, 16800.0, 10300.0, 26.700000000000045, 25.75}, 2});
-    SaturationTable.insert(std::array<double, 10>{566.4833333333333, 7809691.585971805, 0.0013777850899155113, 0.02418459192719842, 1297163.8611998695, 2572556.3593585137, 1307933.2427042366, 2761427.585741797, 3191.9330298787863, 5757.688164287241}, SaturationTableEntry{SaturationTableData{566.4833333333333, 7809691.585971805, 0.0013777850899155113, 0.02418459192719842, 1297163.8611998695, 2572556.3593585137, 1307933.2427042366, 2761427.585741797, 3191.9330298787863, 5757.688164287241}, SaturationTableData{0.0, 303024.5830347496, 9.676333889302295e-06, 0.0010615874695973412, 14537.502030732925, 3256.400454884162, 15025.962098965538, 4303.100601097103, 25.916295620228084, 21.143342953498177}, 4});
-    SaturationTable.insert(std::array<double, 10>{610.9277777777778, 14198373.693821613, 0.0016187570177394297, 0.011248894216215496, 1555768.5773241732, 2473003.545452054, 1578749.4605343558, 2632799.767773872, 3635.315211814519, 5360.360788784872}, SaturationTableEntry{SaturationTableData{610.9277777777778, 14198373.693821613, 0.0016187570177394297, 0.011248894216215496, 1555768.5773241732, 2473003.545452054, 1578749.4605343558, 2632799.767773872, 3635.315211814519, 5360.360788784872}, SaturationTableData{0.0, 484011.96198041923, 2.153764639876998e-05, 0.0005727765382861263, 18038.13251973351, 9652.901348406682, 19096.4626675708, 12211.50170581555, 30.12403020800366, 29.51694412320012}, 4});
-    SaturationTable.insert(std::array<double, 10>{433.15, 618232.2022065277, 0.001101853504168952, 0.306795969455405, 674795.9542617527, 2567904.358708679, 675470.4943559786, 2757473.385189438, 1942.5079993475194, 6749.1225427799845}, SaturationTableEntry{SaturationTableData{433.15, 618232.2022065277, 0.001101853504168952, 0.306795969455405, 674795.9542617527, 2567904.358708679, 675470.4943559786, 2757473.385189438, 1942.5079993475194, 6749.1225427799845}, SaturationTableData{0.0, 41285.80667149217, 3.121398028807206e-06, 0.018940643238802263, 12002.16167657316, 2209.700308671454, 12037.051681446843, 3023.80042239232, 27.632883860017273, 23.65542330440894}, 4});
-    SaturationTable.insert(std::array<double, 10>{453.15, 1002800.0, 0.001127, 0.19384, 761920.0, 2582800.0, 763050.0, 2777200.0, 2139.2000000000003, 6584.1}, SaturationTableEntry{SaturationTableData{453.15, 1002800.0, 0.001127, 0.19384, 761920.0, 2582800.0, 763050.0, 2777200.0, 2139.2000000000003, 6584.1}, SaturationTableData{0.0, 55100.0, 2.9999999999999645e-06, 0.009970000000000007, 10950.0, 1600.0, 11015.0, 2100.0, 24.149999999999864, 19.700000000000273}, 2});
-    SaturationTable.insert(std::array<double, 10>{273.16, 611.6339194769655, 0.0010000959284298366, 206.00602710521957, 0.0, 2374846.3317405446, 0.0, 2500915.5493510617, 0.0, 9155.276838893915}, SaturationTableEntry{SaturationTableData{273.16, 611.6339194769655, 0.0010000959284298366, 206.00602710521957, 0.0, 2374846.3317405446, 0.0, 2500915.5493510617, 0.0, 9155.276838893915}, SaturationTableData{0.0, 38.85195734700375, 5e-20, 11.05599181803521, 3493.6524880257575, 1163.0001624587458, 3493.6524880257575, 1511.90021119616, 12.74880778087162, 21.980703070467825}, 4});
-    SaturationTable.insert(std::array<double, 10>{450.80999999999995, 950000.0, 0.001124, 0.20411, 751670.0, 2581300.0, 752740.0, 2775200.0, 2116.6, 6602.7}, SaturationTableEntry{SaturationTableData{450.80999999999995, 950000.0, 0.001124, 0.20411, 751670.0, 2581300.0, 752740.0, 2775200.0, 2116.6, 6602.7}, SaturationTableData{1.1100000000000136, 0.0, 1.4999999999999823e-06, 0.004875000000000004, 4860.0, 750.0, 4885.0, 950.0, 10.75, 8.849999999999909}, 3});
-    SaturationTable.insert(std::array<double, 10>{591.4444444444445, 11031611.669069381, 0.0014895311393468102, 0.015929118420609057, 1435118.9404707137, 2529990.553412528, 1451563.7627678788, 2705603.5779437823, 3432.004175414149, 5552.534935629537}, SaturationTableEntry{SaturationTableData{591.4444444444445, 11031611.669069381, 0.0014895311393468102, 0.015929118420609057, 1435118.9404707137, 2529990.553412528, 1451563.7627678788, 2705603.5779437823, 3432.004175414149, 5552.534935629537}, SaturationTableData{4.4833333333333485, 0.0, 2.4659044427577078e-05, 0.0011502351736154643, 26795.523743047146, 10001.801397144096, 28144.60393149918, 13025.601819536882, 45.46865435148311, 41.65866581926821}, 5});
-    SaturationTable.insert(std::array<double, 10>{581.5611111111111, 9652660.210435709, 0.001440213050491656, 0.01882889718937097, 1378829.7326077155, 2549994.156206816, 1392715.9545474716, 2731654.781582856, 3335.1216098806945, 5637.526987502015}, SaturationTableEntry{SaturationTableData{581.5611111111111, 9652660.210435709, 0.001440213050491656, 0.01882889718937097, 1378829.7326077155, 2549994.156206816, 1392715.9545474716, 2731654.781582856, 3335.1216098806945, 5637.526987502015}, SaturationTableData{4.941666666666663, 0.0, 2.341048521605426e-05, 0.001449889384380957, 28144.603931499063, 8722.501218439778, 29423.904110203614, 11397.401592094684, 48.44128276672723, 42.496025936238766}, 5});
-    SaturationTable.insert(std::array<double, 10>{413.15, 361530.0, 0.00108, 0.5085, 588770.0, 2549600.0, 589160.0, 2733500.0, 1739.2, 6929.400000000001}, SaturationTableEntry{SaturationTableData{413.15, 361530.0, 0.00108, 0.5085, 588770.0, 2549600.0, 589160.0, 2733500.0, 1739.2, 6929.400000000001}, SaturationTableData{0.0, 24155.0, 5e-06, 0.031249999999999972, 10680.0, 2400.0, 10705.0, 3150.0, 25.799999999999955, 23.350000000000364}, 2});
-    SaturationTable.insert(std::array<double, 10>{308.15000000000003, 5629.086696861447, 0.001006338724487451, 25.204664803012623, 146631.06048278545, 2422761.9384338404, 146631.06048278545, 2564647.958253795, 505.13749056228596, 8351.411126602501}, SaturationTableEntry{SaturationTableData{308.15000000000003, 5629.086696861447, 0.001006338724487451, 25.204664803012623, 146631.06048278545, 2422761.9384338404, 146631.06048278545, 2564647.958253795, 505.13749056228596, 8351.411126602501}, SaturationTableData{0.0, 404.68777932251714, 3.121398028806772e-07, 1.6827456773299794, 5803.3708106686245, 1860.8002599335741, 5803.3708106686245, 2442.3003411632963, 18.756866620132996, 26.795523743046942}, 4});
-    SaturationTable.insert(std::array<double, 10>{412.01, 350000.0, 0.001079, 0.52422, 583890.0, 2548500.0, 584260.0, 2732000.0, 1727.4, 6940.2}, SaturationTableEntry{SaturationTableData{412.01, 350000.0, 0.001079, 0.52422, 583890.0, 2548500.0, 584260.0, 2732000.0, 1727.4, 6940.2}, SaturationTableData{1.2199999999999989, 0.0, 9.999999999999159e-07, 0.016445000000000015, 5215.0, 1200.0, 5235.0, 1550.0, 12.599999999999909, 11.550000000000182}, 3});
-    SaturationTable.insert(std::array<double, 10>{290.65, 2000.0, 0.001001, 66.99, 73431.0, 2398900.0, 73433.0, 2532900.0, 260.6, 8722.699999999999}, SaturationTableEntry{SaturationTableData{290.65, 2000.0, 0.001001, 66.99, 73431.0, 2398900.0, 73433.0, 2532900.0, 260.6, 8722.699999999999}, SaturationTableData{1.789999999999992, 0.0, 5e-07, 6.373999999999999, 7495.5, 2450.0, 7495.5, 3250.0, 25.599999999999994, 40.30000000000018}, 3});
-    SaturationTable.insert(std::array<double, 10>{318.96, 10000.0, 0.00101, 14.67, 191790.0, 2437200.0, 191810.0, 2583900.0, 649.2, 8148.799999999999}, SaturationTableEntry{SaturationTableData{318.96, 10000.0, 0.00101, 14.67, 191790.0, 2437200.0, 191810.0, 2583900.0, 649.2, 8148.799999999999}, SaturationTableData{2.759999999999991, 0.0, 5e-06, 2.2815000000000003, 11525.0, 3700.0, 11530.0, 4950.0, 36.44999999999999, 50.650000000000546}, 3});
-    SaturationTable.insert(std::array<double, 10>{538.7055555555556, 5130457.849419511, 0.001290385945108909, 0.03838632867866556, 1155998.90148064, 2596281.56267267, 1162628.0024066542, 2793061.190160672, 2935.4496260508076, 5962.004032827976}, SaturationTableEntry{SaturationTableData{538.7055555555556, 5130457.849419511, 0.001290385945108909, 0.03838632867866556, 1155998.90148064, 2596281.56267267, 1162628.0024066542, 2793061.190160672, 2935.4496260508076, 5962.004032827976}, SaturationTableData{0.0, 219080.91299042478, 7.17921546625666e-06, 0.0017105261197863653, 13572.211895892397, 1279.3001787045505, 13897.851941380766, 1744.5002436877694, 25.392945547121826, 19.677962748800383}, 4});
-    SaturationTable.insert(std::array<double, 10>{383.15000000000003, 143376.47791143614, 0.0010512868561022752, 1.2094793082022255, 461269.12443434616, 2517662.751690466, 461408.68445384124, 2691182.375929295, 1418.7811141884945, 7238.140851090592}, SaturationTableEntry{SaturationTableData{383.15000000000003, 143376.47791143614, 0.0010512868561022752, 1.2094793082022255, 461269.12443434616, 2517662.751690466, 461408.68445384124, 2691182.375929295, 1418.7811141884945, 7238.140851090592}, SaturationTableData{0.0, 12389.878855823561, 2.184978620165174e-06, 0.09545235172092514, 11734.671639207692, 3140.1004386381246, 11734.671639207692, 4070.500568605261, 30.45897425479177, 30.772984298655047}, 4});
-    SaturationTable.insert(std::array<double, 10>{627.5944444444444, 17452009.66046776, 0.0018004223830160105, 0.00797454768399671, 1677581.2143400912, 2392291.334177424, 1709005.4787297237, 2531386.153607478, 3836.6165839341597, 5146.833958957465}, SaturationTableEntry{SaturationTableData{627.5944444444444, 17452009.66046776, 0.0018004223830160105, 0.00797454768399671, 1677581.2143400912, 2392291.334177424, 1709005.4787297237, 2531386.153607478, 3836.6165839341597, 5146.833958957465}, SaturationTableData{0.0, 573299.0689269472, 3.6520356937044655e-05, 0.0005119092767243852, 21806.253046099446, 15933.10222568363, 23434.453273541643, 19887.302778042853, 35.88088101217386, 39.77460555608559}, 4});
-    SaturationTable.insert(std::array<double, 10>{373.70000000000005, 103421.35939752545, 0.0010437955008331377, 1.6416680792708747, 421378.21886201476, 2506730.5501633547, 421494.5188782607, 2676528.5738823162, 1313.399343467792, 7347.416346355207}, SaturationTableEntry{SaturationTableData{373.70000000000005, 103421.35939752545, 0.0010437955008331377, 1.6416680792708747, 421378.21886201476, 2506730.5501633547, 421494.5188782607, 2676528.5738823162, 1313.399343467792, 7347.416346355207}, SaturationTableData{0.2888888888888914, 0.0, 3.121398028806772e-07, 0.015856701986340704, 1209.5201689569803, 348.9000487374142, 1221.15017058159, 465.20006498345174, 3.244770453259548, 3.55878049712328}, 5});
-    SaturationTable.insert(std::array<double, 10>{302.59444444444443, 4113.343253531314, 0.0010044658856701667, 33.88589700073129, 123417.57724011099, 2415086.1373616136, 123417.57724011099, 2554646.1568566505, 429.0633239355414, 8463.198702218026}, SaturationTableEntry{SaturationTableData{302.59444444444443, 4113.343253531314, 0.0010044658856701667, 33.88589700073129, 123417.57724011099, 2415086.1373616136, 123417.57724011099, 2554646.1568566505, 429.0633239355414, 8463.198702218026}, SaturationTableData{0.0, 307.2993325565142, 3.121398028806772e-07, 2.3535341137206522, 5803.37081066861, 1860.8002599335741, 5803.37081066861, 2442.3003411632963, 19.112744669845313, 28.260903947744737}, 4});
-    SaturationTable.insert(std::array<double, 10>{577.5944444444444, 9139000.792094667, 0.0014227332215303356, 0.020117410295662597, 1356918.8095469947, 2556739.5571490764, 1369897.8913600333, 2740493.5828175414, 3297.021724558549, 5670.184032063854}, SaturationTableEntry{SaturationTableData{577.5944444444444, 9139000.792094667, 0.0014227332215303356, 0.020117410295662597, 1356918.8095469947, 2556739.5571490764, 1369897.8913600333, 2740493.5828175414, 3297.021724558549, 5670.184032063854}, SaturationTableData{0.0, 342324.6996058095, 1.1549172706586792e-05, 0.0008920955566331067, 15084.112107088557, 4186.800584851066, 15653.982186693349, 5582.400779801421, 26.41871169041042, 22.190043099710692}, 4});
-    SaturationTable.insert(std::array<double, 10>{485.53, 2000000.0, 0.001177, 0.099587, 906120.0, 2599100.0, 908470.0, 2798300.0, 2446.7, 6339.0}, SaturationTableEntry{SaturationTableData{485.53, 2000000.0, 0.001177, 0.099587, 906120.0, 2599100.0, 908470.0, 2798300.0, 2446.7, 6339.0}, SaturationTableData{3.0149999999999864, 0.0, 4.999999999999905e-06, 0.005434999999999995, 13710.0, 900.0, 13870.0, 1100.0, 28.100000000000136, 21.800000000000182}, 3});
-    SaturationTable.insert(std::array<double, 10>{379.12, 125000.0, 0.001048, 1.375, 444230.0, 2513000.0, 444360.0, 2684900.0, 1374.1000000000001, 7284.099999999999}, SaturationTableEntry{SaturationTableData{379.12, 125000.0, 0.001048, 1.375, 444230.0, 2513000.0, 444360.0, 2684900.0, 1374.1000000000001, 7284.099999999999}, SaturationTableData{2.6899999999999977, 0.0, 2.499999999999898e-06, 0.1078, 11370.0, 3100.0, 11385.0, 4100.0, 29.799999999999955, 30.5}, 3});
-    SaturationTable.insert(std::array<double, 10>{463.15, 1255200.0, 0.001141, 0.15636, 806000.0, 2589000.0, 807430.0, 2785300.0, 2235.5, 6505.9}, SaturationTableEntry{SaturationTableData{463.15, 1255200.0, 0.001141, 0.15636, 806000.0, 2589000.0, 807430.0, 2785300.0, 2235.5, 6505.9}, SaturationTableData{0.0, 65850.0, 3.500000000000031e-06, 0.007735000000000006, 11045.0, 1350.0, 11120.0, 1750.0, 23.799999999999955, 19.049999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{647.0999999999999, 22064000.0, 0.003106, 0.003106, 2015700.0, 2015700.0, 2084300.0000000002, 2084300.0000000002, 4407.0, 4407.0}, SaturationTableEntry{SaturationTableData{647.0999999999999, 22064000.0, 0.003106, 0.003106, 2015700.0, 2015700.0, 2084300.0000000002, 2084300.0000000002, 4407.0, 4407.0}, SaturationTableData{0.12000000000000455, 0.0, 0.00020149999999999986, 0.00026900000000000014, 32000.0, 38350.0, 36600.00000000012, 44149.99999999988, 56.40000000000009, 68.44999999999982}, 3});
-    SaturationTable.insert(std::array<double, 10>{537.0899999999999, 5000000.0, 0.001286, 0.039448, 1148100.0, 2597000.0, 1154500.0, 2794200.0, 2920.7000000000003, 5973.7}, SaturationTableEntry{SaturationTableData{537.0899999999999, 5000000.0, 0.001286, 0.039448, 1148100.0, 2597000.0, 1154500.0, 2794200.0, 2920.7000000000003, 5973.7}, SaturationTableData{5.8250000000000455, 0.0, 1.650000000000002e-05, 0.003499499999999999, 28850.0, 2350.0, 29650.0, 3300.0, 53.399999999999864, 41.75}, 3});
-    SaturationTable.insert(std::array<double, 10>{405.37222222222226, 288731.75116601156, 0.001071888083092403, 0.6279628554354385, 555565.1776064928, 2541853.1550696054, 555867.557648732, 2723048.580380662, 1658.0148996068865, 7004.517378455901}, SaturationTableEntry{SaturationTableData{405.37222222222226, 288731.75116601156, 0.001071888083092403, 0.6279628554354385, 555565.1776064928, 2541853.1550696054, 555867.557648732, 2723048.580380662, 1658.0148996068865, 7004.517378455901}, SaturationTableData{0.0, 22166.644697536278, 2.80925822592642e-06, 0.04417090350565106, 11827.711652204394, 2791.2003899009433, 11850.971655453555, 3721.6005198678467, 29.056396058866767, 27.00486377228981}, 4});
-    SaturationTable.insert(std::array<double, 10>{428.15, 543490.0, 0.001096, 0.34648, 653190.0, 2563500.0, 653790.0, 2751800.0, 1892.4, 6792.7}, SaturationTableEntry{SaturationTableData{428.15, 543490.0, 0.001096, 0.34648, 653190.0, 2563500.0, 653790.0, 2751800.0, 1892.4, 6792.7}, SaturationTableData{0.0, 33665.0, 2.5000000000000066e-06, 0.019839999999999997, 10765.0, 2150.0, 10805.0, 2850.0, 25.100000000000023, 21.75}, 2});
-    SaturationTable.insert(std::array<double, 10>{354.46999999999997, 50000.0, 0.00103, 3.2403, 340490.0, 2483200.0, 340540.0, 2645200.0, 1091.2, 7593.099999999999}, SaturationTableEntry{SaturationTableData{354.46999999999997, 50000.0, 0.00103, 3.2403, 340490.0, 2483200.0, 340540.0, 2645200.0, 1091.2, 7593.099999999999}, SaturationTableData{2.7299999999999898, 0.0, 5e-06, 0.37650000000000006, 11455.0, 3450.0, 11460.0, 4550.0, 32.55000000000007, 38.000000000000455}, 3});
-    SaturationTable.insert(std::array<double, 10>{448.15, 892600.0, 0.001121, 0.21659, 740020.0, 2579400.0, 741020.0, 2772700.0, 2090.6, 6624.2}, SaturationTableEntry{SaturationTableData{448.15, 892600.0, 0.001121, 0.21659, 740020.0, 2579400.0, 741020.0, 2772700.0, 2090.6, 6624.2}, SaturationTableData{0.0, 50210.0, 2.9999999999999645e-06, 0.011374999999999996, 10910.0, 1700.0, 10970.0, 2250.0, 24.300000000000182, 20.049999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{573.15, 8587900.0, 0.001404, 0.021659, 1332700.0, 2563600.0, 1344800.0, 2749600.0, 3254.7999999999997, 5705.9}, SaturationTableEntry{SaturationTableData{573.15, 8587900.0, 0.001404, 0.021659, 1332700.0, 2563600.0, 1344800.0, 2749600.0, 3254.7999999999997, 5705.9}, SaturationTableData{0.0, 294450.0, 1.0000000000000026e-05, 0.0008635000000000014, 13350.0, 3450.0, 13850.0, 4550.0, 23.59999999999991, 19.550000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{280.37222222222226, 1017.3903861799237, 0.0010000959284298366, 127.09084214091517, 30354.30424017053, 2384848.133137689, 30354.30424017053, 2514173.7512030904, 109.694175323099, 8968.545532809556}, SaturationTableEntry{SaturationTableData{280.37222222222226, 1017.3903861799237, 0.0010000959284298366, 127.09084214091517, 30354.30424017053, 2384848.133137689, 30354.30424017053, 2514173.7512030904, 109.694175323099, 8968.545532809556}, SaturationTableData{0.0, 89.04579044126939, 5e-20, 10.38489124184165, 5835.9348152174625, 1860.800259933807, 5835.9348152174625, 2558.6003574086353, 20.703728892088712, 34.54110482502165}, 4});
-    SaturationTable.insert(std::array<double, 10>{435.4333333333334, 655001.9428509945, 0.0011049749021977595, 0.29048978615291604, 684681.4556426512, 2569765.158968613, 685402.5157433755, 2760031.9855468464, 1965.3260625349578, 6729.444580031183}, SaturationTableEntry{SaturationTableData{435.4333333333334, 655001.9428509945, 0.0011049749021977595, 0.29048978615291604, 684681.4556426512, 2569765.158968613, 685402.5157433755, 2760031.9855468464, 1965.3260625349578, 6729.444580031183}, SaturationTableData{1.0277777777777715, 0.0, 1.2485592115228173e-06, 0.006882682653519934, 4454.290622216533, 814.1001137210988, 4465.920623841113, 1046.700146212941, 10.1739254211883, 8.582941198944809}, 5});
-    SaturationTable.insert(std::array<double, 10>{468.18999999999994, 1400000.0, 0.001149, 0.14078, 828350.0, 2591800.0, 829960.0, 2788900.0, 2283.5, 6467.5}, SaturationTableEntry{SaturationTableData{468.18999999999994, 1400000.0, 0.001149, 0.14078, 828350.0, 2591800.0, 829960.0, 2788900.0, 2283.5, 6467.5}, SaturationTableData{1.625, 0.0, 2.5000000000000066e-06, 0.004534999999999997, 7235.0, 800.0, 7295.0, 1050.0, 15.399999999999864, 12.25}, 3});
-    SaturationTable.insert(std::array<double, 10>{428.7166666666667, 551580.5834534691, 0.0010968592673228606, 0.34168695662141224, 655629.7115844343, 2563950.1581563195, 656234.4716689127, 2752588.7845071116, 1898.086045142249, 6787.641108160614}, SaturationTableEntry{SaturationTableData{428.7166666666667, 551580.5834534691, 0.0010968592673228606, 0.34168695662141224, 655629.7115844343, 2563950.1581563195, 656234.4716689127, 2752588.7845071116, 1898.086045142249, 6787.641108160614}, SaturationTableData{1.1722222222222172, 0.0, 1.2485592115229257e-06, 0.00950153559968922, 5059.050706695125, 1046.7001462124754, 5082.310709944286, 1279.3001787043177, 11.764909643431679, 10.257661432885016}, 5});
-    SaturationTable.insert(std::array<double, 10>{378.15, 120900.0, 0.001047, 1.4186, 440150.0, 2511900.0, 440280.0, 2683400.0, 1363.3999999999999, 7295.200000000001}, SaturationTableEntry{SaturationTableData{378.15, 120900.0, 0.001047, 1.4186, 440150.0, 2511900.0, 440280.0, 2683400.0, 1363.3999999999999, 7295.200000000001}, SaturationTableData{0.0, 9740.0, 1.99999999999994e-06, 0.10460000000000003, 10545.0, 2900.0, 10555.0, 3850.0, 27.700000000000045, 28.500000000000455}, 2});
-    SaturationTable.insert(std::array<double, 10>{283.15, 1228.1, 0.001, 106.32, 42020.0, 2388700.0, 42022.0, 2519200.0, 151.10000000000002, 8899.900000000001}, SaturationTableEntry{SaturationTableData{283.15, 1228.1, 0.001, 106.32, 42020.0, 2388700.0, 42022.0, 2519200.0, 151.10000000000002, 8899.900000000001}, SaturationTableData{0.0, 177.79999999999995, 0.0005, 14.217499999999994, 10480.0, 3400.0, 10480.0, 4550.0, 36.69999999999999, 59.80000000000018}, 2});
-    SaturationTable.insert(std::array<double, 10>{366.48333333333335, 79551.70964857658, 0.0010381769843812846, 2.0983910388459486, 391000.6546185951, 2498124.3489611605, 391070.43462834257, 2664898.57225773, 1231.296183998862, 7435.757838695566}, SaturationTableEntry{SaturationTableData{366.48333333333335, 79551.70964857658, 0.0010381769843812846, 2.0983910388459486, 391000.6546185951, 2498124.3489611605, 391070.43462834257, 2664898.57225773, 1231.296183998862, 7435.757838695566}, SaturationTableData{0.0, 7543.898692320163, 1.8728388172842801e-06, 0.1815092953751405, 11688.151632709341, 3256.400454884162, 11688.151632709312, 4419.400617342675, 31.67314642439851, 34.122424766536824}, 4});
-    SaturationTable.insert(std::array<double, 10>{502.3833333333333, 2757902.9172673454, 0.0012073567575426366, 0.07252256180130719, 983200.337342535, 2602794.3635824383, 986526.5178071668, 2802830.391525325, 2602.850187590236, 6218.236228620864}, SaturationTableEntry{SaturationTableData{502.3833333333333, 2757902.9172673454, 0.0012073567575426366, 0.07252256180130719, 983200.337342535, 2602794.3635824383, 986526.5178071668, 2802830.391525325, 2602.850187590236, 6218.236228620864}, SaturationTableData{3.2472222222222342, 0.0, 6.554935860495197e-06, 0.004035967651247752, 15084.112107088615, 232.60003249184228, 15316.712139580282, 232.60003249160945, 29.872822172912493, 23.02740321668125}, 5});
-    SaturationTable.insert(std::array<double, 10>{638.9, 20000000.0, 0.002038, 0.005862, 1785800.0, 2294800.0, 1826600.0, 2412100.0, 4014.6, 4931.0}, SaturationTableEntry{SaturationTableData{638.9, 20000000.0, 0.002038, 0.005862, 1785800.0, 2294800.0, 1826600.0, 2412100.0, 4014.6, 4931.0}, SaturationTableData{2.0400000000000205, 0.0, 5.599999999999995e-05, 0.0004074999999999999, 22750.0, 22200.0, 24900.0, 26950.0, 37.5, 47.29999999999973}, 3});
-    SaturationTable.insert(std::array<double, 10>{435.13, 650000.0, 0.001104, 0.2926, 683370.0, 2569400.0, 684080.0, 2759600.0, 1962.3, 6732.2}, SaturationTableEntry{SaturationTableData{435.13, 650000.0, 0.001104, 0.2926, 683370.0, 2569400.0, 684080.0, 2759600.0, 1962.3, 6732.2}, SaturationTableData{1.4849999999999852, 0.0, 1.4999999999999823e-06, 0.009910000000000002, 6430.0, 1200.0, 6460.0, 1600.0, 14.75, 12.550000000000182}, 3});
-    SaturationTable.insert(std::array<double, 10>{555.3722222222223, 6634411.257778326, 0.001339704033964063, 0.029062088487012597, 1239479.053141921, 2584418.961015592, 1248364.3743831052, 2777244.3879512344, 3088.6027914446613, 5841.4241759842635}, SaturationTableEntry{SaturationTableData{555.3722222222223, 6634411.257778326, 0.001339704033964063, 0.029062088487012597, 1239479.053141921, 2584418.961015592, 1248364.3743831052, 2777244.3879512344, 3088.6027914446613, 5841.4241759842635}, SaturationTableData{0.0, 267171.8451102739, 8.739914480660155e-06, 0.001276027514176395, 14095.561968998634, 2326.0003249172587, 14502.612025859184, 3140.1004386385903, 25.623219579288843, 20.305982836528074}, 4});
-    SaturationTable.insert(std::array<double, 10>{609.8199999999999, 14000000.0, 0.00161, 0.011487, 1548400.0, 2477100.0, 1571000.0, 2637900.0, 3623.2000000000003, 5372.8}, SaturationTableEntry{SaturationTableData{609.8199999999999, 14000000.0, 0.00161, 0.011487, 1548400.0, 2477100.0, 1571000.0, 2637900.0, 3623.2000000000003, 5372.8}, SaturationTableData{2.7450000000000045, 0.0, 2.20000000000001e-05, 0.0005730000000000006, 18550.0, 9750.0, 19650.0, 12400.0, 30.799999999999955, 30.40000000000009}, 3});
-    SaturationTable.insert(std::array<double, 10>{344.2611111111111, 32732.170773587488, 0.00102319427384301, 4.818502137069721, 297681.52158291376, 2470212.3450621534, 297728.0415894121, 2627915.167091545, 968.658183311152, 7737.62616086333}, SaturationTableEntry{SaturationTableData{344.2611111111111, 32732.170773587488, 0.00102319427384301, 4.818502137069721, 297681.52158291376, 2470212.3450621534, 297728.0415894121, 2627915.167091545, 968.658183311152, 7737.62616086333}, SaturationTableData{0.0, 3530.1157341022026, 1.560699014403603e-06, 0.4745461423195634, 11630.00162458641, 3489.0004873760045, 11641.63162621099, 4768.300666080322, 33.55720668758158, 40.19328561457087}, 4});
-    SaturationTable.insert(std::array<double, 10>{613.15, 14601000.0, 0.001638, 0.010783, 1570700.0, 2464500.0, 1594600.0, 2622000.0, 3660.2000000000003, 5335.8}, SaturationTableEntry{SaturationTableData{613.15, 14601000.0, 0.001638, 0.010783, 1570700.0, 2464500.0, 1594600.0, 2622000.0, 3660.2000000000003, 5335.8}, SaturationTableData{0.0, 447000.0, 2.050000000000001e-05, 0.0005054999999999999, 16600.0, 9250.0, 17600.0, 11700.0, 27.600000000000136, 27.449999999999818}, 2});
-    SaturationTable.insert(std::array<double, 10>{345.47222222222223, 34473.78646584182, 0.0010244428330545329, 4.590015801361032, 302775.46229448257, 2471840.5452895956, 302798.7222977318, 2630008.5673839706, 983.3957213698279, 7719.622918348471}, SaturationTableEntry{SaturationTableData{345.47222222222223, 34473.78646584182, 0.0010244428330545329, 4.590015801361032, 302775.46229448257, 2471840.5452895956, 302798.7222977318, 2630008.5673839706, 983.3957213698279, 7719.622918348471}, SaturationTableData{2.172222222222217, 0.0, 1.2485592115229257e-06, 0.36030297446521864, 9106.291272051167, 2791.2003899004776, 9117.921273675747, 3721.6005198678467, 26.18843765824363, 31.191664357141235}, 5});
-    SaturationTable.insert(std::array<double, 10>{448.3277777777778, 896318.4481118872, 0.0011212061719475571, 0.2157323033629829, 740784.583479656, 2579534.3603332657, 741808.0236226196, 2772824.9873338914, 2092.311724273492, 6622.681165117481}, SaturationTableEntry{SaturationTableData{448.3277777777778, 896318.4481118872, 0.0011212061719475571, 0.2157323033629829, 740784.583479656, 2579534.3603332657, 741808.0236226196, 2772824.9873338914, 2092.311724273492, 6622.681165117481}, SaturationTableData{1.5861111111111086, 0.0, 1.8728388172843885e-06, 0.0073508923578410185, 6943.110969878035, 1046.7001462127082, 6978.000974751834, 1511.90021119616, 15.428360155176279, 12.769741783796235}, 5});
-    SaturationTable.insert(std::array<double, 10>{497.09999999999997, 2500000.0, 0.001197, 0.079952, 958870.0, 2602100.0, 961870.0, 2801900.0, 2554.2, 6255.8}, SaturationTableEntry{SaturationTableData{497.09999999999997, 2500000.0, 0.001197, 0.079952, 958870.0, 2602100.0, 961870.0, 2801900.0, 2554.2, 6255.8}, SaturationTableData{2.7700000000000102, 0.0, 5.000000000000013e-06, 0.0043825000000000044, 12665.0, 550.0, 12830.0, 650.0, 25.649999999999864, 19.799999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{622.0388888888889, 16305411.522613864, 0.0017273816691419212, 0.009017094625618328, 1633968.7082478923, 2424157.5386287915, 1662136.5721826404, 2571160.7591635636, 3764.854821909812, 5226.383170069636}, SaturationTableEntry{SaturationTableData{622.0388888888889, 16305411.522613864, 0.0017273816691419212, 0.009017094625618328, 1633968.7082478923, 2424157.5386287915, 1662136.5721826404, 2571160.7591635636, 3764.854821909812, 5226.383170069636}, SaturationTableData{0.0, 541583.1853783755, 2.9341141470787995e-05, 0.0005212734708108088, 20143.16281378374, 13258.201852028258, 21527.133007109398, 16630.902323158458, 33.285064649566266, 35.169124912748885}, 4});
-    SaturationTable.insert(std::array<double, 10>{557.9555555555555, 6894757.293168363, 0.001347819668838962, 0.02784536753538354, 1252737.2549939498, 2582092.9606906744, 1262017.9962903697, 2773987.98749635, 3112.5094227841614, 5822.164893293949}, SaturationTableEntry{SaturationTableData{557.9555555555555, 6894757.293168363, 0.001347819668838962, 0.02784536753538354, 1252737.2549939498, 2582092.9606906744, 1262017.9962903697, 2773987.98749635, 3112.5094227841614, 5822.164893293949}, SaturationTableData{3.5083333333333258, 0.0, 1.0924893100825329e-05, 0.0017177053352526173, 17898.572500238428, 3023.8004223925527, 18421.9225733449, 4186.8005848512985, 32.40583652674786, 25.95816362607684}, 5});
-    SaturationTable.insert(std::array<double, 10>{364.90999999999997, 75000.0, 0.001037, 2.2172, 384360.0, 2496100.0, 384440.0, 2662400.0, 1213.2, 7455.8}, SaturationTableEntry{SaturationTableData{364.90999999999997, 75000.0, 0.001037, 2.2172, 384360.0, 2496100.0, 384440.0, 2662400.0, 1213.2, 7455.8}, SaturationTableData{3.9250000000000114, 0.0, 3.000000000000073e-06, 0.26155000000000006, 16520.0, 4750.0, 16535.0, 6300.0, 44.799999999999955, 48.44999999999982}, 3});
-    SaturationTable.insert(std::array<double, 10>{349.01, 40000.0, 0.001026, 3.9933, 317580.0, 2476300.0, 317620.0, 2636100.0, 1026.1, 7669.1}, SaturationTableEntry{SaturationTableData{349.01, 40000.0, 0.001026, 3.9933, 317580.0, 2476300.0, 317620.0, 2636100.0, 1026.1, 7669.1}, SaturationTableData{2.7299999999999898, 0.0, 2.0000000000000486e-06, 0.37650000000000006, 11455.0, 3450.0, 11460.0, 4550.0, 32.55000000000007, 38.000000000000455}, 3});
-    SaturationTable.insert(std::array<double, 10>{343.15, 31202.0, 0.001023, 5.0396, 293040.0, 2468900.0, 293070.0, 2626100.0, 955.0999999999999, 7754.0}, SaturationTableEntry{SaturationTableData{343.15, 31202.0, 0.001023, 5.0396, 293040.0, 2468900.0, 293070.0, 2626100.0, 955.0999999999999, 7754.0}, SaturationTableData{0.0, 3079.5, 1.4999999999999823e-06, 0.45524999999999993, 10475.0, 3200.0, 10475.0, 4250.0, 30.35000000000008, 36.40000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{318.15, 9595.3, 0.00101, 15.251, 188430.0, 2436100.0, 188440.0, 2582400.0, 638.5999999999999, 8163.299999999999}, SaturationTableEntry{SaturationTableData{318.15, 9595.3, 0.00101, 15.251, 188430.0, 2436100.0, 188440.0, 2582400.0, 638.5999999999999, 8163.299999999999}, SaturationTableData{0.0, 1105.0999999999995, 5e-06, 1.6124999999999998, 10450.0, 3300.0, 10450.0, 4450.0, 32.60000000000002, 44.249999999999545}, 2});
-    SaturationTable.insert(std::array<double, 10>{397.12, 225000.0, 0.001064, 0.79329, 520470.0, 2533200.0, 520710.00000000006, 2711700.0, 1570.6, 7087.7}, SaturationTableEntry{SaturationTableData{397.12, 225000.0, 0.001064, 0.79329, 520470.0, 2533200.0, 520710.00000000006, 2711700.0, 1570.6, 7087.7}, SaturationTableData{1.7199999999999704, 0.0, 1.4999999999999823e-06, 0.037280000000000035, 7305.0, 1800.0, 7319.999999999971, 2400.0, 18.300000000000068, 17.59999999999991}, 3});
-    SaturationTable.insert(std::array<double, 10>{278.15, 872.5, 0.001, 147.03, 21019.0, 2381800.0, 21020.0, 2510100.0, 76.30000000000001, 9024.900000000001}, SaturationTableEntry{SaturationTableData{278.15, 872.5, 0.001, 147.03, 21019.0, 2381800.0, 21020.0, 2510100.0, 76.30000000000001, 9024.900000000001}, SaturationTableData{0.0, 130.39999999999998, 0.0005, 20.355000000000004, 10500.5, 3450.0, 10501.0, 4550.0, 37.400000000000006, 62.5}, 2});
-    SaturationTable.insert(std::array<double, 10>{393.35999999999996, 200000.0, 0.001061, 0.88578, 504500.0, 2529100.0, 504710.0, 2706300.0, 1530.2, 7127.0}, SaturationTableEntry{SaturationTableData{393.35999999999996, 200000.0, 0.001061, 0.88578, 504500.0, 2529100.0, 504710.0, 2706300.0, 1530.2, 7127.0}, SaturationTableData{1.8800000000000239, 0.0, 1.4999999999999823e-06, 0.04624499999999998, 7985.0, 2050.0, 8000.000000000029, 2700.0, 20.199999999999932, 19.65000000000009}, 3});
-    SaturationTable.insert(std::array<double, 10>{493.15, 2319600.0, 0.00119, 0.086094, 940790.0, 2601300.0, 943550.0, 2801000.0, 2517.6, 6284.0}, SaturationTableEntry{SaturationTableData{493.15, 2319600.0, 0.00119, 0.086094, 940790.0, 2601300.0, 943550.0, 2801000.0, 2517.6, 6284.0}, SaturationTableData{0.0, 106850.0, 5e-06, 0.0038445000000000007, 11385.0, 500.0, 11525.0, 600.0, 23.149999999999864, 17.84999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{408.15, 313220.0, 0.001075, 0.58179, 567410.0, 2544700.0, 567750.0, 2726900.0, 1687.2, 6977.299999999999}, SaturationTableEntry{SaturationTableData{408.15, 313220.0, 0.001075, 0.58179, 567410.0, 2544700.0, 567750.0, 2726900.0, 1687.2, 6977.299999999999}, SaturationTableData{0.0, 21470.0, 2.5000000000000066e-06, 0.03664500000000004, 10655.0, 2450.0, 10685.0, 3300.0, 26.0, 23.949999999999363}, 2});
-    SaturationTable.insert(std::array<double, 10>{588.7055555555556, 10635163.1247122, 0.0014745484288085353, 0.01669136381924378, 1419278.878258027, 2536038.1542573124, 1434956.1204479695, 2713511.979048501, 3404.8318396184654, 5576.39969896319}, SaturationTableEntry{SaturationTableData{588.7055555555556, 10635163.1247122, 0.0014745484288085353, 0.01669136381924378, 1419278.878258027, 2536038.1542573124, 1434956.1204479695, 2713511.979048501, 3404.8318396184654, 5576.39969896319}, SaturationTableData{0.0, 385072.1948234532, 1.3422011523871072e-05, 0.0007578754413943949, 15781.912204563618, 5466.100763555616, 16479.71230203891, 7210.601007243618, 27.151401792759543, 23.8647633336509}, 4});
-    SaturationTable.insert(std::array<double, 10>{403.73, 275000.0, 0.00107, 0.65732, 548570.0, 2540100.0, 548860.0, 2720900.0, 1640.8, 7020.7}, SaturationTableEntry{SaturationTableData{403.73, 275000.0, 0.00107, 0.65732, 548570.0, 2540100.0, 548860.0, 2720900.0, 1640.8, 7020.7}, SaturationTableData{1.4699999999999704, 0.0, 5e-06, 0.025749999999999995, 6270.0, 1550.0, 6285.0, 2000.0, 15.450000000000045, 14.5}, 3});
-    SaturationTable.insert(std::array<double, 10>{460.0444444444445, 1172108.7398386218, 0.0011368131620915932, 0.1669885517451292, 792282.2306733245, 2587210.1614054926, 793608.0508585274, 2782826.7887310362, 2205.6902841112596, 6529.734192133787}, SaturationTableEntry{SaturationTableData{460.0444444444445, 1172108.7398386218, 0.0011368131620915932, 0.1669885517451292, 792282.2306733245, 2587210.1614054926, 793608.0508585274, 2782826.7887310362, 2205.6902841112596, 6529.734192133787}, SaturationTableData{1.294444444444423, 0.0, 1.8728388172842801e-06, 0.004454234987107911, 5710.3307976719225, 814.1001137210988, 5756.850804170244, 1046.7001462127082, 12.392929731159484, 10.048321403643058}, 5});
-    SaturationTable.insert(std::array<double, 10>{353.15, 47416.0, 0.001029, 3.4053, 334970.0, 2481600.0, 335020.0, 2643000.0, 1075.6, 7611.1}, SaturationTableEntry{SaturationTableData{353.15, 47416.0, 0.001029, 3.4053, 334970.0, 2481600.0, 335020.0, 2643000.0, 1075.6, 7611.1}, SaturationTableData{0.0, 4409.5, 1.4999999999999823e-06, 0.2896000000000001, 10490.0, 3100.0, 10495.0, 4200.0, 29.500000000000114, 33.80000000000018}, 2});
-    SaturationTable.insert(std::array<double, 10>{451.5, 965266.021043571, 0.001124951849582126, 0.20103051864730087, 754670.8054194121, 2581627.760625691, 755764.0255721232, 2775848.7877562842, 2123.1684445838446, 6597.141681549889}, SaturationTableEntry{SaturationTableData{451.5, 965266.021043571, 0.001124951849582126, 0.20103051864730087, 754670.8054194121, 2581627.760625691, 755764.0255721232, 2775848.7877562842, 2123.1684445838446, 6597.141681549889}, SaturationTableData{1.4972222222222342, 0.0, 1.8728388172843885e-06, 0.0064051087551124375, 6582.580919515924, 1046.7001462127082, 6617.470924389665, 1279.3001787045505, 14.528198029433497, 11.932381666825677}, 5});
-    SaturationTable.insert(std::array<double, 10>{349.81666666666666, 41367.85428328087, 0.0010269399514775787, 3.8694098524305947, 320988.0448385849, 2477422.9460693966, 321034.5648450833, 2637451.7684237063, 1035.7725966863152, 7657.239589634189}, SaturationTableEntry{SaturationTableData{349.81666666666666, 41367.85428328087, 0.0010269399514775787, 3.8694098524305947, 320988.0448385849, 2477422.9460693966, 321034.5648450833, 2637451.7684237063, 1035.7725966863152, 7657.239589634189}, SaturationTableData{0.0, 4317.84175484669, 1.8728388172842801e-06, 0.36863710720213394, 11653.26162783557, 3489.0004873760045, 11653.261627835542, 4652.000649834517, 33.05479061739959, 38.30922535138734}, 4});
-    SaturationTable.insert(std::array<double, 10>{416.76, 400000.0, 0.001084, 0.46242, 604220.0, 2553100.0, 604660.0, 2738100.0, 1776.5, 6895.5}, SaturationTableEntry{SaturationTableData{416.76, 400000.0, 0.001084, 0.46242, 604220.0, 2553100.0, 604660.0, 2738100.0, 1776.5, 6895.5}, SaturationTableData{1.1550000000000011, 0.0, 1.4999999999999823e-06, 0.014454999999999996, 4950.0, 1100.0, 4965.0, 1500.0, 11.950000000000045, 10.799999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{471.43999999999994, 1500000.0, 0.001154, 0.13171, 842820.0, 2593400.0, 844550.0, 2791000.0, 2314.2999999999997, 6443.0}, SaturationTableEntry{SaturationTableData{471.43999999999994, 1500000.0, 0.001154, 0.13171, 842820.0, 2593400.0, 844550.0, 2791000.0, 2314.2999999999997, 6443.0}, SaturationTableData{1.625, 0.0, 2.5000000000000066e-06, 0.004534999999999997, 7235.0, 800.0, 7295.0, 1050.0, 15.399999999999864, 12.25}, 3});
-    SaturationTable.insert(std::array<double, 10>{388.15, 169180.0, 0.001056, 1.036, 482420.0, 2523300.0, 482590.0, 2698600.0, 1473.7, 7182.9}, SaturationTableEntry{SaturationTableData{388.15, 169180.0, 0.001056, 1.036, 482420.0, 2523300.0, 482590.0, 2698600.0, 1473.7, 7182.9}, SaturationTableData{0.0, 12900.0, 1.99999999999994e-06, 0.07233500000000004, 10575.0, 2800.0, 10585.0, 3700.0, 27.100000000000023, 26.84999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{464.75, 1300000.0, 0.001144, 0.15119, 813100.0, 2589900.0, 814590.0, 2786500.0, 2250.7999999999997, 6493.599999999999}, SaturationTableEntry{SaturationTableData{464.75, 1300000.0, 0.001144, 0.15119, 813100.0, 2589900.0, 814590.0, 2786500.0, 2250.7999999999997, 6493.599999999999}, SaturationTableData{1.7199999999999704, 0.0, 2.5000000000000066e-06, 0.005205000000000001, 7625.0, 950.0, 7685.0, 1200.0, 16.350000000000136, 13.049999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{608.6222222222223, 13789514.586336726, 0.0016000286295665862, 0.011745820782401608, 1540579.7952024634, 2481377.1466217563, 1562653.5382859285, 2643266.7692359993, 3610.026936282018, 5385.481592293979}, SaturationTableEntry{SaturationTableData{608.6222222222223, 13789514.586336726, 0.0016000286295665862, 0.011745820782401608, 1540579.7952024634, 2481377.1466217563, 1562653.5382859285, 2643266.7692359993, 3610.026936282018, 5385.481592293979}, SaturationTableData{4.105555555555554, 0.0, 2.9029001667907318e-05, 0.0009414136454882604, 25934.903622827725, 12909.301803291077, 27400.28382752568, 16514.60230691242, 43.54272608245151, 41.868005848511075}, 5});
-    SaturationTable.insert(std::array<double, 10>{642.98, 21000000.0, 0.002207, 0.004994, 1841600.0, 2233500.0, 1888000.0, 2338400.0, 4107.1, 4807.599999999999}, SaturationTableEntry{SaturationTableData{642.98, 21000000.0, 0.002207, 0.004994, 1841600.0, 2233500.0, 1888000.0, 2338400.0, 4107.1, 4807.599999999999}, SaturationTableData{1.9399999999999409, 0.0, 8.450000000000016e-05, 0.0004339999999999999, 27900.0, 30650.0, 30700.0, 36850.0, 46.25000000000023, 61.70000000000027}, 3});
-    SaturationTable.insert(std::array<double, 10>{417.97777777777776, 413685.4375901018, 0.0010849979548133932, 0.4480205018707593, 609435.345131577, 2554180.956791667, 609877.2851933113, 2739563.1826875745, 1788.9361538951807, 6883.93752161219}, SaturationTableEntry{SaturationTableData{417.97777777777776, 413685.4375901018, 0.0010849979548133932, 0.4480205018707593, 609435.345131577, 2554180.956791667, 609877.2851933113, 2739563.1826875745, 1788.9361538951807, 6883.93752161219}, SaturationTableData{1.4611111111111086, 0.0, 1.5606990144037113e-06, 0.01624999813797043, 6280.200877276715, 1395.6001949501224, 6303.460880525876, 1860.8002599340398, 14.967812090842699, 13.397761871523926}, 5});
-    SaturationTable.insert(std::array<double, 10>{348.15, 38597.0, 0.001026, 4.1291, 313990.0, 2475300.0, 314030.0, 2634600.0, 1015.8000000000001, 7681.2}, SaturationTableEntry{SaturationTableData{348.15, 38597.0, 0.001026, 4.1291, 313990.0, 2475300.0, 314030.0, 2634600.0, 1015.8000000000001, 7681.2}, SaturationTableData{0.0, 3697.5, 1.4999999999999823e-06, 0.3619000000000001, 10475.0, 3150.0, 10480.0, 4200.0, 29.89999999999992, 35.04999999999973}, 2});
-    SaturationTable.insert(std::array<double, 10>{325.3833333333333, 13789.514586336727, 0.001013205800150827, 10.844361031682078, 218690.55054872282, 2445789.341650522, 218690.55054872282, 2595351.162542703, 732.6482343430952, 8036.145042563214}, SaturationTableEntry{SaturationTableData{325.3833333333333, 13789.514586336727, 0.001013205800150827, 10.844361031682078, 218690.55054872282, 2445789.341650522, 218690.55054872282, 2595351.162542703, 732.6482343430952, 8036.145042563214}, SaturationTableData{4.275000000000006, 0.0, 2.1849786201649573e-06, 1.7170810556468572, 17875.312496989325, 5582.400779801421, 17886.94249861392, 7443.201039735461, 54.24000157674607, 70.33824982549868}, 5});
-    SaturationTable.insert(std::array<double, 10>{513.15, 3347000.0, 0.001229, 0.059707, 1033400.0000000001, 2603100.0, 1037500.0, 2803000.0, 2701.8, 6142.400000000001}, SaturationTableEntry{SaturationTableData{513.15, 3347000.0, 0.001229, 0.059707, 1033400.0000000001, 2603100.0, 1037500.0, 2803000.0, 2701.8, 6142.400000000001}, SaturationTableData{0.0, 142200.0, 5.000000000000013e-06, 0.0025255, 11700.000000000058, 50.0, 11900.0, 500.0, 22.899999999999864, 17.549999999999727}, 2});
-    SaturationTable.insert(std::array<double, 10>{388.72222222222223, 172368.93232920908, 0.0010562810929483667, 1.01801275311519, 484854.7677290074, 2523942.952567742, 485017.58775175165, 2699555.977098997, 1479.9084027273207, 7176.594882493282}, SaturationTableEntry{SaturationTableData{388.72222222222223, 172368.93232920908, 0.0010562810929483667, 1.01801275311519, 484854.7677290074, 2523942.952567742, 485017.58775175165, 2699555.977098997, 1479.9084027273207, 7176.594882493282}, SaturationTableData{2.8527777777777885, 0.0, 2.497118423045743e-06, 0.07984536157688887, 12083.571687945281, 3140.1004386383574, 12106.831691194442, 4070.500568605261, 30.856720310352557, 30.56364426941309}, 5});
-    SaturationTable.insert(std::array<double, 10>{338.10999999999996, 25000.0, 0.00102, 6.2034, 271930.0, 2462400.0, 271960.0, 2617500.0, 893.2, 7830.2}, SaturationTableEntry{SaturationTableData{338.10999999999996, 25000.0, 0.00102, 6.2034, 271930.0, 2462400.0, 271960.0, 2617500.0, 893.2, 7830.2}, SaturationTableData{2.065000000000026, 0.0, 5e-06, 0.48735000000000017, 8655.0, 2650.0, 8655.0, 3550.0, 25.44999999999999, 31.34999999999991}, 3});
-    SaturationTable.insert(std::array<double, 10>{503.15, 2797100.0, 0.001209, 0.071505, 986760.0, 2602900.0, 990140.0, 2802900.0, 2610.0, 6212.799999999999}, SaturationTableEntry{SaturationTableData{503.15, 2797100.0, 0.001209, 0.071505, 986760.0, 2602900.0, 990140.0, 2802900.0, 2610.0, 6212.799999999999}, SaturationTableData{0.0, 123700.0, 5.000000000000013e-06, 0.003102500000000001, 11530.0, 150.0, 11690.0, 150.0, 23.0, 17.649999999999636}, 2});
-    SaturationTable.insert(std::array<double, 10>{342.24, 30000.0, 0.001022, 5.2287, 289240.0, 2467700.0, 289270.0, 2624600.0, 944.1, 7767.5}, SaturationTableEntry{SaturationTableData{342.24, 30000.0, 0.001022, 5.2287, 289240.0, 2467700.0, 289270.0, 2624600.0, 944.1, 7767.5}, SaturationTableData{2.065000000000026, 0.0, 9.999999999999159e-07, 0.48735000000000017, 8655.0, 2650.0, 8655.0, 3550.0, 25.44999999999999, 31.34999999999991}, 3});
-    SaturationTable.insert(std::array<double, 10>{406.66999999999996, 300000.0, 0.001073, 0.60582, 561110.0, 2543200.0, 561430.0, 2724900.0, 1671.7, 6991.7}, SaturationTableEntry{SaturationTableData{406.66999999999996, 300000.0, 0.001073, 0.60582, 561110.0, 2543200.0, 561430.0, 2724900.0, 1671.7, 6991.7}, SaturationTableData{1.375, 0.0, 1.4999999999999823e-06, 0.021915000000000018, 5865.0, 1350.0, 5880.0, 1850.0, 14.399999999999977, 13.349999999999909}, 3});
-    SaturationTable.insert(std::array<double, 10>{388.7055555555556, 172265.51096981156, 0.0010562810929483667, 1.0185746047603752, 484761.7277160107, 2523942.952567742, 484947.8077420041, 2699323.3770665056, 1479.699062698078, 7176.594882493282}, SaturationTableEntry{SaturationTableData{388.7055555555556, 172265.51096981156, 0.0010562810929483667, 1.0185746047603752, 484761.7277160107, 2523942.952567742, 484947.8077420041, 2699323.3770665056, 1479.699062698078, 7176.594882493282}, SaturationTableData{0.0, 14444.516529187706, 2.497118423045743e-06, 0.07803495072018068, 11746.301640832273, 3023.8004223927855, 11769.561644081434, 4070.500568605261, 30.082162202155246, 29.726284152442986}, 4});
-    SaturationTable.insert(std::array<double, 10>{426.2555555555556, 517106.7969876273, 0.0010937378692940534, 0.3631247182832603, 645023.1501028114, 2561856.7578638946, 645581.3901807916, 2749564.984084719, 1873.2164496682335, 6809.41247120184}, SaturationTableEntry{SaturationTableData{426.2555555555556, 517106.7969876273, 0.0010937378692940534, 0.3631247182832603, 645023.1501028114, 2561856.7578638946, 645581.3901807916, 2749564.984084719, 1873.2164496682335, 6809.41247120184}, SaturationTableData{1.2305555555555543, 0.0, 1.2485592115229257e-06, 0.010718880830924038, 5303.280740811431, 1046.7001462124754, 5326.540744060534, 1511.90021119616, 12.434797737007784, 10.885681520613161}, 5});
-    SaturationTable.insert(std::array<double, 10>{477.59444444444443, 1704797.6883088094, 0.0011636571851393353, 0.11635947571787592, 870366.0615807977, 2596281.56267267, 872343.1618569775, 2794456.790355623, 2372.3668153941826, 6397.012613594006}, SaturationTableEntry{SaturationTableData{477.59444444444443, 1704797.6883088094, 0.0011636571851393353, 0.11635947571787592, 870366.0615807977, 2596281.56267267, 872343.1618569775, 2794456.790355623, 2372.3668153941826, 6397.012613594006}, SaturationTableData{0.0, 92837.90695251187, 4.3699572403301315e-06, 0.00603366238968437, 12432.47173668287, 1046.7001462127082, 12548.771752928791, 1395.6001949501224, 26.041899637773895, 20.305982836528074}, 4});
-    SaturationTable.insert(std::array<double, 10>{444.9555555555556, 827370.8751802036, 0.001116836214707227, 0.2327876221923856, 726084.2614261787, 2576975.7599758566, 726991.4015528965, 2769801.186911499, 2059.3616036707135, 6649.895368919013}, SaturationTableEntry{SaturationTableData{444.9555555555556, 827370.8751802036, 0.001116836214707227, 0.2327876221923856, 726084.2614261787, 2576975.7599758566, 726991.4015528965, 2769801.186911499, 2059.3616036707135, 6649.895368919013}, SaturationTableData{1.686111111111103, 0.0, 2.1849786201650657e-06, 0.00852765941470135, 7350.161026738642, 1279.3001787045505, 7408.311034861545, 1511.90021119616, 16.47506030138925, 13.607101900765883}, 5});
-    SaturationTable.insert(std::array<double, 10>{340.32222222222225, 27579.029172673454, 0.0010213214350257257, 5.65778363905541, 281190.1792792502, 2465327.7443798273, 281213.43928249937, 2621169.7661492852, 920.4681085795157, 7796.241369051246}, SaturationTableEntry{SaturationTableData{340.32222222222225, 27579.029172673454, 0.0010213214350257257, 5.65778363905541, 281190.1792792502, 2465327.7443798273, 281213.43928249937, 2621169.7661492852, 920.4681085795157, 7796.241369051246}, SaturationTableData{2.5749999999999886, 0.0, 1.560699014403603e-06, 0.5338839188471889, 10792.64150761618, 3256.400454884162, 10792.641507616208, 4419.400617342675, 31.463806395156098, 38.30922535138734}, 5});
-    SaturationTable.insert(std::array<double, 10>{457.21, 1100000.0, 0.001133, 0.17745, 779780.0, 2585500.0, 781030.0, 2780700.0, 2178.5, 6552.0}, SaturationTableEntry{SaturationTableData{457.21, 1100000.0, 0.001133, 0.17745, 779780.0, 2585500.0, 781030.0, 2780700.0, 2178.5, 6552.0}, SaturationTableData{1.950000000000017, 0.0, 2.5000000000000066e-06, 0.007095000000000004, 8590.0, 1150.0, 8650.0, 1550.0, 18.700000000000045, 15.150000000000091}, 3});
-    SaturationTable.insert(std::array<double, 10>{625.44, 17000000.0, 0.00177, 0.008374, 1660200.0, 2405400.0, 1690300.0, 2547700.0, 3808.2, 5179.1}, SaturationTableEntry{SaturationTableData{625.44, 17000000.0, 0.00177, 0.008374, 1660200.0, 2405400.0, 1690300.0, 2547700.0, 3808.2, 5179.1}, SaturationTableData{2.349999999999966, 0.0, 3.000000000000008e-05, 0.0004349999999999996, 18800.0, 13300.0, 20200.0, 16650.0, 31.049999999999727, 33.75}, 3});
-    SaturationTable.insert(std::array<double, 10>{491.55999999999995, 2250000.0, 0.001187, 0.088717, 933540.0, 2600900.0, 936210.0, 2800500.0, 2502.9, 6295.4}, SaturationTableEntry{SaturationTableData{491.55999999999995, 2250000.0, 0.001187, 0.088717, 933540.0, 2600900.0, 936210.0, 2800500.0, 2502.9, 6295.4}, SaturationTableData{2.7700000000000102, 0.0, 4.999999999999905e-06, 0.0043825000000000044, 12665.0, 600.0, 12830.0, 700.0, 25.649999999999864, 19.799999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{368.15, 84609.0, 0.00104, 1.9808, 398000.0, 2500100.0, 398090.0, 2667600.0, 1250.3999999999999, 7415.099999999999}, SaturationTableEntry{SaturationTableData{368.15, 84609.0, 0.00104, 1.9808, 398000.0, 2500100.0, 398090.0, 2667600.0, 1250.3999999999999, 7415.099999999999}, SaturationTableData{0.0, 7213.0, 5e-06, 0.15439999999999998, 10515.0, 2950.0, 10525.0, 4000.0, 28.399999999999977, 30.449999999999818}, 2});
-    SaturationTable.insert(std::array<double, 10>{528.15, 4322900.0, 0.001263, 0.045941, 1104700.0, 2600500.0, 1110100.0, 2799100.0, 2839.0, 6036.900000000001}, SaturationTableEntry{SaturationTableData{528.15, 4322900.0, 0.001263, 0.045941, 1104700.0, 2600500.0, 1110100.0, 2799100.0, 2839.0, 6036.900000000001}, SaturationTableData{0.0, 173350.0, 5.499999999999971e-06, 0.0018830000000000027, 12000.0, 650.0, 12200.0, 950.0, 22.84999999999991, 17.599999999999454}, 2});
-    SaturationTable.insert(std::array<double, 10>{389.19, 175000.0, 0.001057, 1.0037, 486820.0, 2524500.0, 487010.0, 2700200.0, 1485.0, 7171.599999999999}, SaturationTableEntry{SaturationTableData{389.19, 175000.0, 0.001057, 1.0037, 486820.0, 2524500.0, 487010.0, 2700200.0, 1485.0, 7171.599999999999}, SaturationTableData{2.0849999999999795, 0.0, 2.0000000000000486e-06, 0.05896000000000001, 8840.0, 2300.0, 8850.0, 3050.0, 22.600000000000023, 22.299999999999727}, 3});
-    SaturationTable.insert(std::array<double, 10>{549.8166666666667, 6100067.567557778, 0.0013222242050027427, 0.03187009815372758, 1211287.9292039238, 2589070.9616654264, 1219359.1503313868, 2783524.5888285115, 3037.3563522860836, 5882.03614165732}, SaturationTableEntry{SaturationTableData{549.8166666666667, 6100067.567557778, 0.0013222242050027427, 0.03187009815372758, 1211287.9292039238, 2589070.9616654264, 1219359.1503313868, 2783524.5888285115, 3037.3563522860836, 5882.03614165732}, SaturationTableData{0.0, 250383.11110140942, 8.1156348748988e-06, 0.001404004833357491, 13909.481943005347, 1977.1002761796117, 14293.271996616735, 2674.900373654673, 25.51854956466741, 20.09664280728566}, 4});
-    SaturationTable.insert(std::array<double, 10>{467.48333333333335, 1378951.4586336727, 0.0011480501949952993, 0.14284765939033406, 825218.3952741532, 2591396.9619903434, 826800.075495097, 2788409.189510837, 2276.740290036183, 6472.793704179811}, SaturationTableEntry{SaturationTableData{467.48333333333335, 1378951.4586336727, 0.0011480501949952993, 0.14284765939033406, 825218.3952741532, 2591396.9619903434, 826800.075495097, 2788409.189510837, 2276.740290036183, 6472.793704179811}, SaturationTableData{1.188888888888897, 0.0, 1.8728388172843885e-06, 0.0036145789173587795, 5280.020737562212, 581.5000812292565, 5314.910742435954, 814.1001137210988, 11.304361579097758, 9.001621257429633}, 5});
-    SaturationTable.insert(std::array<double, 10>{623.15, 16529000.0, 0.001741, 0.008806, 1642400.0, 2418300.0, 1671200.0, 2563900.0, 3778.7999999999997, 5211.400000000001}, SaturationTableEntry{SaturationTableData{623.15, 16529000.0, 0.001741, 0.008806, 1642400.0, 2418300.0, 1671200.0, 2563900.0, 3778.7999999999997, 5211.400000000001}, SaturationTableData{0.0, 494000.0, 2.799999999999992e-05, 0.00046699999999999953, 18450.0, 12450.0, 19750.0, 15600.0, 30.449999999999818, 32.54999999999973}, 2});
-    SaturationTable.insert(std::array<double, 10>{578.15, 9209400.0, 0.001425, 0.019932, 1360000.0, 2555800.0, 1373100.0, 2739400.0, 3302.4, 5665.7}, SaturationTableEntry{SaturationTableData{578.15, 9209400.0, 0.001425, 0.019932, 1360000.0, 2555800.0, 1373100.0, 2739400.0, 3302.4, 5665.7}, SaturationTableData{0.0, 310750.0, 1.0499999999999984e-05, 0.0007994999999999999, 13650.0, 3900.0, 14150.0, 5100.0, 23.800000000000182, 20.09999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{306.02, 5000.0, 0.001005, 28.185, 137750.0, 2419800.0, 137750.0, 2560700.0, 476.2, 8393.800000000001}, SaturationTableEntry{SaturationTableData{306.02, 5000.0, 0.001005, 28.185, 137750.0, 2419800.0, 137750.0, 2560700.0, 476.2, 8393.800000000001}, SaturationTableData{1.9550000000000125, 0.0, 5.000000000000664e-07, 3.302999999999999, 8180.0, 2650.0, 8180.0, 3500.0, 26.900000000000006, 39.79999999999927}, 3});
-    SaturationTable.insert(std::array<double, 10>{461.11, 1200000.0, 0.001138, 0.16326, 796960.0, 2587800.0, 798330.0, 2783800.0, 2215.9, 6521.7}, SaturationTableEntry{SaturationTableData{461.11, 1200000.0, 0.001138, 0.16326, 796960.0, 2587800.0, 798330.0, 2783800.0, 2215.9, 6521.7}, SaturationTableData{1.8199999999999932, 0.0, 2.5000000000000066e-06, 0.006034999999999999, 8070.0, 1050.0, 8130.0, 1350.0, 17.449999999999818, 14.050000000000182}, 3});
-    SaturationTable.insert(std::array<double, 10>{543.3000000000001, 5515805.834534691, 0.0013028715372241377, 0.03553399515994151, 1178677.4046485834, 2593490.3622827693, 1185864.7456525778, 2789572.189673296, 2977.526971928561, 5929.346988266137}, SaturationTableEntry{SaturationTableData{543.3000000000001, 5515805.834534691, 0.0013028715372241377, 0.03553399515994151, 1178677.4046485834, 2593490.3622827693, 1185864.7456525778, 2789572.189673296, 2977.526971928561, 5929.346988266137}, SaturationTableData{3.8194444444444002, 0.0, 1.1237032903706006e-05, 0.0021266084770263684, 19131.352672444773, 2209.700308671454, 19654.70274555101, 3023.8004223925527, 35.08538890105228, 27.632883860017046}, 5});
-    SaturationTable.insert(std::array<double, 10>{543.15, 5503000.0, 0.001303, 0.035622, 1177900.0, 2593700.0, 1185100.0, 2789700.0, 2976.2, 5930.5}, SaturationTableEntry{SaturationTableData{543.15, 5503000.0, 0.001303, 0.035622, 1177900.0, 2593700.0, 1185100.0, 2789700.0, 2976.2, 5930.5}, SaturationTableData{0.0, 208850.0, 6.999999999999953e-06, 0.0014275000000000017, 12300.0, 1400.0, 12650.0, 1900.0, 22.899999999999864, 17.84999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{478.1333333333334, 1723689.3232920908, 0.0011642814647450969, 0.11511715930241065, 872785.1019187117, 2596514.1627051616, 874785.4621981404, 2794921.9904206055, 2377.4328441018524, 6393.244493067639}, SaturationTableEntry{SaturationTableData{478.1333333333334, 1723689.3232920908, 0.0011642814647450969, 0.11511715930241065, 872785.1019187117, 2596514.1627051616, 874785.4621981404, 2794921.9904206055, 2377.4328441018524, 6393.244493067639}, SaturationTableData{4.549999999999983, 0.0, 7.803495072018015e-06, 0.009379801076565726, 20538.582869019592, 1628.2002274421975, 20759.552899886796, 1977.1002761798445, 42.57976194793582, 33.28506464956581}, 5});
-    SaturationTable.insert(std::array<double, 10>{483.15000000000003, 1907710.3954467545, 0.0011723970996199958, 0.10429215093850717, 895370.5650736585, 2598374.9629650954, 897603.525385579, 2797247.990745523, 2424.4506146697304, 6356.40064792095}, SaturationTableEntry{SaturationTableData{483.15000000000003, 1907710.3954467545, 0.0011723970996199958, 0.10429215093850717, 895370.5650736585, 2598374.9629650954, 897603.525385579, 2797247.990745523, 2424.4506146697304, 6356.40064792095}, SaturationTableData{0.0, 101456.35356897255, 4.36995724033024e-06, 0.005306376648972294, 12502.251746430411, 814.1001137210988, 12630.181764300738, 1163.000162458513, 25.91629562022831, 20.305982836528074}, 4});
-    SaturationTable.insert(std::array<double, 10>{553.15, 6416600.0, 0.001333, 0.030153, 1228200.0, 2586400.0, 1236700.0, 2779900.0, 3068.1, 5857.9}, SaturationTableEntry{SaturationTableData{553.15, 6416600.0, 0.001333, 0.030153, 1228200.0, 2586400.0, 1236700.0, 2779900.0, 3068.1, 5857.9}, SaturationTableData{0.0, 235100.0, 7.999999999999978e-06, 0.0011985, 12650.0, 1950.0, 13000.0, 2650.0, 23.0, 18.25}, 2});
-    SaturationTable.insert(std::array<double, 10>{433.15, 618230.0, 0.001102, 0.3068, 674790.0, 2567800.0, 675470.0, 2757500.0, 1942.6000000000001, 6749.2}, SaturationTableEntry{SaturationTableData{433.15, 618230.0, 0.001102, 0.3068, 674790.0, 2567800.0, 675470.0, 2757500.0, 1942.6000000000001, 6749.2}, SaturationTableData{0.0, 37370.0, 2.9999999999999645e-06, 0.01718, 10800.0, 2050.0, 10840.0, 2650.0, 24.84999999999991, 21.25}, 2});
-    SaturationTable.insert(std::array<double, 10>{647.0999999999999, 22064000.0, 0.003106, 0.003106, 2015700.0, 2015700.0, 2084300.0000000002, 2084300.0000000002, 4407.0, 4407.0}, SaturationTableEntry{SaturationTableData{647.0999999999999, 22064000.0, 0.003106, 0.003106, 2015700.0, 2015700.0, 2084300.0000000002, 2084300.0000000002, 4407.0, 4407.0}, SaturationTableData{0.0, 510000.0, 0.0004445, 0.0009235000000000001, 85600.0, 107200.0, 96550.00000000012, 124999.99999999988, 147.54999999999973, 196.95000000000027}, 2});
-    SaturationTable.insert(std::array<double, 10>{393.15, 198670.0, 0.00106, 0.89133, 503600.0, 2528900.0, 503810.0, 2706000.0, 1527.9, 7129.2}, SaturationTableEntry{SaturationTableData{393.15, 198670.0, 0.00106, 0.89133, 503600.0, 2528900.0, 503810.0, 2706000.0, 1527.9, 7129.2}, SaturationTableData{0.0, 14745.0, 5e-06, 0.060604999999999964, 10590.0, 2700.0, 10610.0, 3550.0, 26.84999999999991, 26.050000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{597.8299999999999, 12000000.0, 0.001526, 0.014264, 1473000.0, 2514300.0, 1491300.0, 2685400.0, 3496.4, 5493.9}, SaturationTableEntry{SaturationTableData{597.8299999999999, 12000000.0, 0.001526, 0.014264, 1473000.0, 2514300.0, 1491300.0, 2685400.0, 3496.4, 5493.9}, SaturationTableData{3.0850000000000364, 0.0, 1.9000000000000028e-05, 0.0007415, 19000.0, 8050.0, 20050.0, 10450.0, 32.09999999999991, 30.149999999999636}, 3});
-    SaturationTable.insert(std::array<double, 10>{362.68333333333334, 68947.57293168364, 0.001035679865958239, 2.398794385138356, 374997.7723831642, 2493472.348311326, 375067.5523929117, 2658850.9714129446, 1187.4603818754708, 7483.906045421353}, SaturationTableEntry{SaturationTableData{362.68333333333334, 68947.57293168364, 0.001035679865958239, 2.398794385138356, 374997.7723831642, 2493472.348311326, 375067.5523929117, 2658850.9714129446, 1187.4603818754708, 7483.906045421353}, SaturationTableData{2.875, 0.0, 2.1849786201650657e-06, 0.2784911321301813, 12083.571687945281, 3605.3005036215764, 12083.571687945252, 4768.300666080322, 33.599074693430225, 37.890545292902516}, 5});
-    SaturationTable.insert(std::array<double, 10>{403.15, 270280.0, 0.00107, 0.66808, 546100.0, 2539500.0, 546380.0, 2720100.0, 1634.6000000000001, 7026.5}, SaturationTableEntry{SaturationTableData{403.15, 270280.0, 0.00107, 0.66808, 546100.0, 2539500.0, 546380.0, 2720100.0, 1634.6000000000001, 7026.5}, SaturationTableData{0.0, 19025.0, 5e-06, 0.04314499999999999, 10635.0, 2600.0, 10655.0, 3400.0, 26.299999999999955, 24.600000000000364}, 2});
-    SaturationTable.insert(std::array<double, 10>{643.15, 21044000.0, 0.002217, 0.004953, 1844500.0, 2230100.0, 1891200.0, 2334300.0, 4111.900000000001, 4800.900000000001}, SaturationTableEntry{SaturationTableData{643.15, 21044000.0, 0.002217, 0.004953, 1844500.0, 2230100.0, 1891200.0, 2334300.0, 4111.900000000001, 4800.900000000001}, SaturationTableData{0.0, 510000.0, 0.00010099999999999996, 0.0005279999999999998, 33650.0, 36750.0, 37000.0, 44200.0, 55.75000000000023, 74.19999999999982}, 2});
-    SaturationTable.insert(std::array<double, 10>{360.9277777777778, 64463.912263936254, 0.001034431306746716, 2.5545521467758374, 367624.3513531764, 2491146.347986409, 367694.13136292394, 2655827.1709905523, 1167.0287950213974, 7506.933448638034}, SaturationTableEntry{SaturationTableData{360.9277777777778, 64463.912263936254, 0.001034431306746716, 2.5545521467758374, 367624.3513531764, 2491146.347986409, 367694.13136292394, 2655827.1709905523, 1167.0287950213974, 7506.933448638034}, SaturationTableData{0.0, 6308.702923249053, 1.8728388172842801e-06, 0.22808055396494442, 11664.891629460151, 3372.7004711301997, 11676.52163108479, 4535.70063358848, 32.13369448873232, 35.58780497123416}, 4});
-    SaturationTable.insert(std::array<double, 10>{443.55999999999995, 800000.0, 0.001115, 0.24035, 719970.0, 2576000.0, 720870.0, 2768300.0, 2045.7, 6661.6}, SaturationTableEntry{SaturationTableData{443.55999999999995, 800000.0, 0.001115, 0.24035, 719970.0, 2576000.0, 720870.0, 2768300.0, 2045.7, 6661.6}, SaturationTableData{1.2650000000000148, 0.0, 1.4999999999999823e-06, 0.006725000000000009, 5515.0, 950.0, 5540.0, 1250.0, 12.399999999999977, 10.349999999999909}, 3});
-    SaturationTable.insert(std::array<double, 10>{273.15999999999997, 611.7, 0.001, 206.0, 0.0, 2374900.0, 1.0, 2500900.0, 0.0, 9155.6}, SaturationTableEntry{SaturationTableData{273.15999999999997, 611.7, 0.001, 206.0, 0.0, 2374900.0, 1.0, 2500900.0, 0.0, 9155.6}, SaturationTableData{0.0, 130.39999999999998, 0.0005, 29.485, 10509.5, 3450.0, 10509.5, 4600.0, 38.150000000000006, 65.34999999999945}, 2});
-    SaturationTable.insert(std::array<double, 10>{604.0, 13000000.0, 0.001566, 0.012781, 1511000.0, 2496600.0, 1531400.0, 2662700.0, 3560.6, 5433.6}, SaturationTableEntry{SaturationTableData{604.0, 13000000.0, 0.001566, 0.012781, 1511000.0, 2496600.0, 1531400.0, 2662700.0, 3560.6, 5433.6}, SaturationTableData{2.909999999999968, 0.0, 1.9999999999999944e-05, 0.000647, 18700.0, 8850.0, 19800.0, 11350.0, 31.300000000000182, 30.149999999999636}, 3});
-    SaturationTable.insert(std::array<double, 10>{277.59444444444443, 839.2988052973849, 0.0010000959284298366, 152.54896446386695, 18682.434609735607, 2381126.5326178214, 18682.434609735607, 2509056.550488272, 67.82616947458793, 9038.883782635054}, SaturationTableEntry{SaturationTableData{277.59444444444443, 839.2988052973849, 0.0010000959284298366, 152.54896446386695, 18682.434609735607, 2381126.5326178214, 18682.434609735607, 2509056.550488272, 67.82616947458793, 9038.883782635054}, SaturationTableData{0.0, 74.98048556320595, 5e-20, 12.72906116147589, 5835.9348152174625, 1860.800259933807, 5835.9348152174625, 2558.600357409101, 20.934002924255537, 35.169124912748885}, 4});
-    SaturationTable.insert(std::array<double, 10>{423.65555555555557, 482633.0105217855, 0.0010912407508710076, 0.38752156527641757, 633835.0885399593, 2559530.757538977, 634346.8086114412, 2746541.1836623265, 1846.8814739895201, 6832.43987441852}, SaturationTableEntry{SaturationTableData{423.65555555555557, 482633.0105217855, 0.0010912407508710076, 0.38752156527641757, 633835.0885399593, 2559530.757538977, 634346.8086114412, 2746541.1836623265, 1846.8814739895201, 6832.43987441852}, SaturationTableData{1.3000000000000114, 0.0, 1.2485592115229257e-06, 0.012198423496578625, 5594.03078142606, 1163.0001624587458, 5617.2907846752205, 1511.90021119616, 13.167487839356681, 11.513701608339943}, 5});
-    SaturationTable.insert(std::array<double, 10>{288.15, 1705.7, 0.001001, 77.885, 62980.0, 2395500.0, 62982.0, 2528300.0, 224.5, 8780.300000000001}, SaturationTableEntry{SaturationTableData{288.15, 1705.7, 0.001001, 77.885, 62980.0, 2395500.0, 62982.0, 2528300.0, 224.5, 8780.300000000001}, SaturationTableData{0.0, 238.80000000000007, 5e-07, 10.061500000000002, 10466.5, 3400.0, 10466.5, 4550.0, 36.0, 57.100000000000364}, 2});
-    SaturationTable.insert(std::array<double, 10>{638.15, 19822000.0, 0.002015, 0.006009, 1777200.0, 2303600.0, 1817200.0, 2422700.0, 4000.4, 4949.3}, SaturationTableEntry{SaturationTableData{638.15, 19822000.0, 0.002015, 0.006009, 1777200.0, 2303600.0, 1817200.0, 2422700.0, 4000.4, 4949.3}, SaturationTableData{0.0, 578000.0, 5.999999999999994e-05, 0.0004705, 25500.0, 24150.0, 27850.0, 29450.0, 41.950000000000045, 52.19999999999982}, 2});
-    SaturationTable.insert(std::array<double, 10>{449.8166666666667, 928241.1743792568, 0.0011230790107648414, 0.20866545822576332, 747320.6443926735, 2580464.7604632326, 748344.0845356372, 2774220.587528842, 2106.8399223029255, 6610.539443421412}, SaturationTableEntry{SaturationTableData{449.8166666666667, 928241.1743792568, 0.0011230790107648414, 0.20866545822576332, 747320.6443926735, 2580464.7604632326, 748344.0845356372, 2774220.587528842, 2106.8399223029255, 6610.539443421412}, SaturationTableData{0.0, 57260.95931976329, 3.7456776345686687e-06, 0.012001775420763791, 12141.721696068184, 1860.800259933807, 12199.871704191144, 2442.3003411630634, 26.921127760592526, 22.190043099710692}, 4});
-    SaturationTable.insert(std::array<double, 10>{633.15, 18666000.0, 0.001895, 0.00695, 1726200.0, 2351900.0, 1761500.0, 2481600.0, 3916.5, 5053.7}, SaturationTableEntry{SaturationTableData{633.15, 18666000.0, 0.001895, 0.00695, 1726200.0, 2351900.0, 1761500.0, 2481600.0, 3916.5, 5053.7}, SaturationTableData{0.0, 548000.0, 4.350000000000003e-05, 0.00046100000000000047, 22000.0, 18350.0, 23750.0, 22650.0, 36.15000000000009, 42.34999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{568.15, 7999000.0, 0.001384, 0.023528, 1306000.0, 2570500.0, 1317100.0, 2758700.0, 3207.6, 5745.0}, SaturationTableEntry{SaturationTableData{568.15, 7999000.0, 0.001384, 0.023528, 1306000.0, 2570500.0, 1317100.0, 2758700.0, 3207.6, 5745.0}, SaturationTableData{0.0, 278600.0, 9.000000000000002e-06, 0.0009344999999999996, 13150.0, 3000.0, 13650.0, 4000.0, 23.399999999999864, 19.200000000000273}, 2});
-    SaturationTable.insert(std::array<double, 10>{570.5166666666667, 8273708.751802037, 0.0013933920800595476, 0.022624517192400564, 1318586.324192358, 2567439.1586436955, 1330123.2858039476, 2754449.5847670455, 3229.823575171689, 5726.287159900858}, SaturationTableEntry{SaturationTableData{570.5166666666667, 8273708.751802037, 0.0013933920800595476, 0.022624517192400564, 1318586.324192358, 2567439.1586436955, 1330123.2858039476, 2754449.5847670455, 3229.823575171689, 5726.287159900858}, SaturationTableData{5.52222222222224, 0.0, 2.2786205610292798e-05, 0.0018978100015147967, 30121.70420767879, 7326.901023489423, 31296.334371762, 9769.201364652254, 52.6490173545028, 44.380086199421385}, 5});
-    SaturationTable.insert(std::array<double, 10>{644.2611111111112, 21325484.30776975, 0.0022911061531445073, 0.004670860010307139, 1864870.7605024308, 2205746.1081190584, 1913740.027328943, 2305298.922025518, 4145.895543137111, 4753.693384039946}, SaturationTableEntry{SaturationTableData{644.2611111111112, 21325484.30776975, 0.0022911061531445073, 0.004670860010307139, 1864870.7605024308, 2205746.1081190584, 1913740.027328943, 2305298.922025518, 4145.895543137111, 4753.693384039946}, SaturationTableData{0.0, 369214.253049165, 0.00012953801819550023, 0.0006146032718721437, 40635.22567630501, 45705.90638462454, 44798.766257906915, 54777.307651801966, 67.53309343364845, 91.06291272051203}, 4});
-    SaturationTable.insert(std::array<double, 10>{472.0388888888889, 1519121.8744037857, 0.001154917270658675, 0.13011235543280059, 845501.1181074319, 2593722.962315261, 847245.6183511199, 2791432.98993323, 2319.9480720718466, 6438.461939384032}, SaturationTableEntry{SaturationTableData{472.0388888888889, 1519121.8744037857, 0.001154917270658675, 0.13011235543280059, 845501.1181074319, 2593722.962315261, 847245.6183511199, 2791432.98993323, 2319.9480720718466, 6438.461939384032}, SaturationTableData{0.0, 84771.04091950506, 4.369957240330023e-06, 0.006876439857462335, 12362.691726935329, 1279.3001787045505, 12467.36174155667, 1511.9002111963928, 26.209371661168007, 20.724662895012898}, 4});
-    SaturationTable.insert(std::array<double, 10>{420.9, 448159.2240559436, 0.0010881193528422006, 0.41552050559481846, 621995.7468861304, 2556972.157181568, 622484.206954363, 2743284.7832074426, 1818.8717780768661, 6857.141997869142}, SaturationTableEntry{SaturationTableData{420.9, 448159.2240559436, 0.0010881193528422006, 0.41552050559481846, 621995.7468861304, 2556972.157181568, 622484.206954363, 2743284.7832074426, 1818.8717780768661, 6857.141997869142}, SaturationTableData{1.3777777777777942, 0.0, 1.5606990144034945e-06, 0.013999470159200444, 5919.670826914429, 1279.3001787045505, 5931.300828539068, 1628.2002274419647, 14.004847956327012, 12.351061725310956}, 5});
-    SaturationTable.insert(std::array<double, 10>{310.9277777777778, 6553.604702302393, 0.0010069630040932124, 21.839173448352664, 158237.8021041227, 2426483.5389537085, 158237.8021041227, 2569532.5589361214, 542.651223802552, 8297.820079116407}, SaturationTableEntry{SaturationTableData{310.9277777777778, 6553.604702302393, 0.0010069630040932124, 21.839173448352664, 158237.8021041227, 2426483.5389537085, 158237.8021041227, 2569532.5589361214, 542.651223802552, 8297.820079116407}, SaturationTableData{0.0, 462.25900272047284, 3.121398028806772e-07, 1.6827456773299794, 5803.3708106686245, 1860.8002599340398, 5803.3708106686245, 2442.3003411632963, 18.756866620132996, 26.795523743046942}, 4});
-    SaturationTable.insert(std::array<double, 10>{444.2611111111111, 813719.2557397302, 0.001115587655495704, 0.23650832864272384, 723037.2010005371, 2576510.5599108734, 723944.3411272549, 2769103.3868140243, 2052.5371187174064, 6655.756889737803}, SaturationTableEntry{SaturationTableData{444.2611111111111, 813719.2557397302, 0.001115587655495704, 0.23650832864272384, 723037.2010005371, 2576510.5599108734, 723944.3411272549, 2769103.3868140243, 2052.5371187174064, 6655.756889737803}, SaturationTableData{0.0, 51538.31076643348, 3.433537831687883e-06, 0.013921435208480257, 12083.57168794534, 1977.1002761796117, 12141.721696068242, 2558.600357408868, 27.151401792759543, 22.608723158195517}, 4});
-    SaturationTable.insert(std::array<double, 10>{583.15, 9865000.0, 0.001447, 0.018333, 1387700.0, 2547100.0, 1402000.0, 2727900.0, 3350.6, 5624.3}, SaturationTableEntry{SaturationTableData{583.15, 9865000.0, 0.001447, 0.018333, 1387700.0, 2547100.0, 1402000.0, 2727900.0, 3350.6, 5624.3}, SaturationTableData{0.0, 327800.0, 1.0999999999999942e-05, 0.0007419999999999996, 13850.0, 4350.0, 14450.0, 5750.0, 24.09999999999991, 20.699999999999818}, 2});
-    SaturationTable.insert(std::array<double, 10>{438.15, 700930.0, 0.001108, 0.27244, 696460.0, 2571900.0, 697240.0, 2762800.0, 1992.3, 6706.7}, SaturationTableEntry{SaturationTableData{438.15, 700930.0, 0.001108, 0.27244, 696460.0, 2571900.0, 697240.0, 2762800.0, 1992.3, 6706.7}, SaturationTableData{0.0, 41350.0, 2.9999999999999645e-06, 0.014920000000000003, 10835.0, 1900.0, 10885.0, 2550.0, 24.700000000000045, 20.84999999999991}, 2});
-    SaturationTable.insert(std::array<double, 10>{508.8777777777778, 3102640.7819257635, 0.001220466629263627, 0.06445062649881168, 1013368.5615567123, 2603259.563647422, 1017159.9420863274, 2803295.591590308, 2662.595831936061, 6172.181422187501}, SaturationTableEntry{SaturationTableData{508.8777777777778, 3102640.7819257635, 0.001220466629263627, 0.06445062649881168, 1013368.5615567123, 2603259.563647422, 1017159.9420863274, 2803295.591590308, 2662.595831936061, 6172.181422187501}, SaturationTableData{2.9805555555555827, 0.0, 6.242796057614412e-06, 0.003252808885820014, 13967.631951128249, 116.30001624603756, 14200.231983619975, 232.60003249160945, 27.318873816153655, 20.93400292425531}, 5});
-    SaturationTable.insert(std::array<double, 10>{507.0, 3000000.0, 0.001217, 0.066667, 1004600.0, 2603200.0, 1008300.0, 2803200.0, 2645.4, 6185.6}, SaturationTableEntry{SaturationTableData{507.0, 3000000.0, 0.001217, 0.066667, 1004600.0, 2603200.0, 1008300.0, 2803200.0, 2645.4, 6185.6}, SaturationTableData{4.355000000000018, 0.0, 9.000000000000002e-06, 0.004803000000000002, 20400.00000000006, 100.0, 20700.0, 250.0, 39.94999999999982, 30.600000000000364}, 3});
-    SaturationTable.insert(std::array<double, 10>{274.81666666666666, 689.337834170973, 0.0010000959284298366, 183.89404346914915, 6987.304976051515, 2377172.332065462, 6987.304976051515, 2503939.349773454, 25.49761556174324, 9111.31543275298}, SaturationTableEntry{SaturationTableData{274.81666666666666, 689.337834170973, 0.0010000959284298366, 183.89404346914915, 6987.304976051515, 2377172.332065462, 6987.304976051515, 2503939.349773454, 25.49761556174324, 9111.31543275298}, SaturationTableData{0.0, 38.85195734700375, 5e-20, 11.05599181803521, 3493.6524880257575, 1163.0001624587458, 3493.6524880257575, 1511.90021119616, 12.74880778087162, 21.980703070467825}, 4});
-    SaturationTable.insert(std::array<double, 10>{494.2611111111111, 2369314.3962243763, 0.0011923740470043617, 0.08430896075808329, 945868.0321276126, 2601398.763387488, 948682.4925207626, 2801202.1912978827, 2527.864589115553, 6276.014076691809}, SaturationTableEntry{SaturationTableData{494.2611111111111, 2369314.3962243763, 0.0011923740470043617, 0.08430896075808329, 945868.0321276126, 2601398.763387488, 948682.4925207626, 2801202.1912978827, 2527.864589115553, 6276.014076691809}, SaturationTableData{0.0, 120244.56719285622, 4.994236846091486e-06, 0.004142095184227201, 12665.071769174596, 581.5000812292565, 12816.261790294258, 581.5000812292565, 25.665087585137144, 19.88730277804234}, 4});
-    SaturationTable.insert(std::array<double, 10>{495.2277777777778, 2413165.0526089272, 0.0011936226062158849, 0.08279820411214059, 950287.4327449555, 2601631.36341998, 953171.673147853, 2801434.7913303743, 2536.7824743612855, 6268.896515697562}, SaturationTableEntry{SaturationTableData{495.2277777777778, 2413165.0526089272, 0.0011936226062158849, 0.08279820411214059, 950287.4327449555, 2601631.36341998, 953171.673147853, 2801434.7913303743, 2536.7824743612855, 6268.896515697562}, SaturationTableData{3.5777777777777544, 0.0, 6.8670756633758745e-06, 0.005137821155416701, 16456.45229878975, 581.5000812292565, 16677.422329656896, 697.800097475294, 33.033856614475326, 25.330143538349148}, 5});
-    SaturationTable.insert(std::array<double, 10>{438.7055555555556, 710642.6342068632, 0.0011087205798323283, 0.26891468297780047, 698870.0576246465, 2572323.759326022, 699660.8977351184, 2763520.9860342224, 1997.773767067554, 6701.811696171167}, SaturationTableEntry{SaturationTableData{438.7055555555556, 710642.6342068632, 0.0011087205798323283, 0.26891468297780047, 698870.0576246465, 2572323.759326022, 699660.8977351184, 2763520.9860342224, 1997.773767067554, 6701.811696171167}, SaturationTableData{0.0, 46205.21600016777, 3.433537831687883e-06, 0.016203177167538316, 12037.051681446901, 2093.4002924256492, 12095.20168956992, 2791.2003899009433, 27.38167582492622, 23.027403216681705}, 4});
-    SaturationTable.insert(std::array<double, 10>{298.15, 3169.7999999999997, 0.001003, 43.34, 104830.0, 2409100.0, 104830.0, 2546500.0, 367.20000000000005, 8556.699999999999}, SaturationTableEntry{SaturationTableData{298.15, 3169.7999999999997, 0.001003, 43.34, 104830.0, 2409100.0, 104830.0, 2546500.0, 367.20000000000005, 8556.699999999999}, SaturationTableData{0.0, 415.29999999999995, 5e-07, 5.230500000000003, 10450.0, 3400.0, 10455.0, 4550.0, 34.79999999999998, 52.349999999999454}, 2});
-    SaturationTable.insert(std::array<double, 10>{308.15, 5629.1, 0.001006, 25.205, 146630.0, 2422700.0, 146640.0, 2564600.0, 505.09999999999997, 8351.699999999999}, SaturationTableEntry{SaturationTableData{308.15, 5629.1, 0.001006, 25.205, 146630.0, 2422700.0, 146640.0, 2564600.0, 505.09999999999997, 8351.699999999999}, SaturationTableData{0.0, 691.0999999999999, 1.0000000000000243e-06, 2.844999999999999, 10450.0, 3350.0, 10445.0, 4450.0, 33.650000000000006, 48.05000000000018}, 2});
-    SaturationTable.insert(std::array<double, 10>{446.09, 850000.0, 0.001118, 0.2269, 731000.0, 2577900.0, 731950.0, 2770800.0, 2070.5, 6640.900000000001}, SaturationTableEntry{SaturationTableData{446.09, 850000.0, 0.001118, 0.2269, 731000.0, 2577900.0, 731950.0, 2770800.0, 2070.5, 6640.900000000001}, SaturationTableData{1.2050000000000125, 0.0, 1.4999999999999823e-06, 0.0060049999999999965, 5275.0, 850.0, 5305.0, 1100.0, 11.799999999999955, 9.800000000000182}, 3});
-    SaturationTable.insert(std::array<double, 10>{443.15, 792180.0, 0.001114, 0.2426, 718200.0, 2575700.0, 719080.0, 2767900.0, 2041.7, 6665.0}, SaturationTableEntry{SaturationTableData{443.15, 792180.0, 0.001114, 0.2426, 718200.0, 2575700.0, 719080.0, 2767900.0, 2041.7, 6665.0}, SaturationTableData{0.0, 45625.0, 2.9999999999999645e-06, 0.013005000000000003, 10870.0, 1850.0, 10920.0, 2400.0, 24.449999999999932, 20.40000000000009}, 2});
-    SaturationTable.insert(std::array<double, 10>{394.4277777777778, 206842.7187950509, 0.0010612753297944582, 0.8583220299614122, 509021.91110489797, 2530223.153445019, 509231.25113414053, 2707696.9782362077, 1541.6218433480258, 7115.467593954456}, SaturationTableEntry{SaturationTableData{394.4277777777778, 206842.7187950509, 0.0010612753297944582, 0.8583220299614122, 509021.91110489797, 2530223.153445019, 509231.25113414053, 2707696.9782362077, 1541.6218433480258, 7115.467593954456}, SaturationTableData{2.486111111111086, 0.0, 2.497118423045743e-06, 0.05768343557235761, 10560.041475124424, 2674.9003736549057, 10583.301478373643, 3605.300503621809, 26.628051719653058, 25.748823596834427}, 5});
-    SaturationTable.insert(std::array<double, 10>{527.5944444444444, 4283299.020807914, 0.0012622933628496438, 0.046381477589652394, 1101989.1739360606, 2600700.9632900124, 1107385.4946898688, 2799341.391037949, 2833.87784386232, 6040.715883823177}, SaturationTableEntry{SaturationTableData{527.5944444444444, 4283299.020807914, 0.0012622933628496438, 0.046381477589652394, 1101989.1739360606, 2600700.9632900124, 1107385.4946898688, 2799341.391037949, 2833.87784386232, 6040.715883823177}, SaturationTableData{0.0, 190571.0915831735, 6.554935860495197e-06, 0.002103197991810312, 13293.091856902232, 697.8000974755269, 13560.581894267816, 930.4001299669035, 25.372011544197676, 19.46862271955706}, 4});
-    SaturationTable.insert(std::array<double, 10>{572.0388888888889, 8454351.392883047, 0.001399634876117162, 0.022061416988003738, 1326750.5853328176, 2565113.1583187785, 1338589.9269866466, 2751658.3843771443, 3244.1843011777282, 5714.564118263275}, SaturationTableEntry{SaturationTableData{572.0388888888889, 8454351.392883047, 0.001399634876117162, 0.022061416988003738, 1326750.5853328176, 2565113.1583187785, 1338589.9269866466, 2751658.3843771443, 3244.1843011777282, 5714.564118263275}, SaturationTableData{0.0, 322329.9034556211, 1.0924893100825329e-05, 0.0009720033461705704, 14793.362066474045, 3721.600519867614, 15328.34214120498, 4884.60068232636, 26.12563564947095, 21.562023011983}, 4});
-    SaturationTable.insert(std::array<double, 10>{593.15, 11284000.0, 0.001499, 0.01547, 1445100.0, 2526000.0, 1462000.0, 2700600.0, 3449.1, 5537.200000000001}, SaturationTableEntry{SaturationTableData{593.15, 11284000.0, 0.001499, 0.01547, 1445100.0, 2526000.0, 1462000.0, 2700600.0, 3449.1, 5537.200000000001}, SaturationTableData{0.0, 364000.0, 1.3499999999999949e-05, 0.0006435, 14500.0, 5600.0, 15200.0, 7200.0, 24.84999999999991, 22.199999999999363}, 2});
-    SaturationTable.insert(std::array<double, 10>{598.15, 12051000.0, 0.001528, 0.014183, 1475000.0, 2513400.0, 1493400.0, 2684300.0, 3499.8, 5490.8}, SaturationTableEntry{SaturationTableData{598.15, 12051000.0, 0.001528, 0.014183, 1475000.0, 2513400.0, 1493400.0, 2684300.0, 3499.8, 5490.8}, SaturationTableData{0.0, 383500.0, 1.4500000000000081e-05, 0.0006020000000000001, 14950.0, 6300.0, 15700.0, 8150.0, 25.350000000000136, 23.200000000000273}, 2});
-    SaturationTable.insert(std::array<double, 10>{424.98, 500000.0, 0.001093, 0.37483, 639540.0, 2560700.0, 640090.0, 2748100.0, 1860.4, 6820.700000000001}, SaturationTableEntry{SaturationTableData{424.98, 500000.0, 0.001093, 0.37483, 639540.0, 2560700.0, 640090.0, 2748100.0, 1860.4, 6820.700000000001}, SaturationTableData{1.8149999999999977, 0.0, 2.0000000000000486e-06, 0.016109999999999985, 7810.0, 1600.0, 7840.0, 2150.0, 18.299999999999955, 16.050000000000637}, 3});
-    SaturationTable.insert(std::array<double, 10>{355.37222222222226, 51846.50641743815, 0.0010306856291121473, 3.1321356380263268, 344294.5680942561, 2484400.9470441486, 344341.08810075436, 2646755.7697233753, 1101.8821779211144, 7580.621138931414}, SaturationTableEntry{SaturationTableData{355.37222222222226, 51846.50641743815, 0.0010306856291121473, 3.1321356380263268, 344294.5680942561, 2484400.9470441486, 344341.08810075436, 2646755.7697233753, 1101.8821779211144, 7580.621138931414}, SaturationTableData{0.0, 5239.32606707864, 1.8728388172842801e-06, 0.2887917456252447, 11653.2616278356, 3372.7004711301997, 11653.261627835542, 4535.70063358848, 32.57330855014152, 36.84384514669}, 4});
-    SaturationTable.insert(std::array<double, 10>{323.15, 12352.0, 0.001012, 12.026, 209330.0, 2442700.0, 209340.0, 2591300.0, 703.8, 8074.8}, SaturationTableEntry{SaturationTableData{323.15, 12352.0, 0.001012, 12.026, 209330.0, 2442700.0, 209340.0, 2591300.0, 703.8, 8074.8}, SaturationTableData{0.0, 1378.3500000000004, 1.0000000000000243e-06, 1.2310499999999998, 10450.0, 3300.0, 10450.0, 4400.0, 32.10000000000002, 42.5}, 2});
-    SaturationTable.insert(std::array<double, 10>{288.7055555555556, 1767.677874822505, 0.0010013444876413593, 75.294363250888, 65314.08912367727, 2396245.534729784, 65314.08912367727, 2529292.7533150525, 232.53490448263045, 8767.160424678217}, SaturationTableEntry{SaturationTableData{288.7055555555556, 1767.677874822505, 0.0010013444876413593, 75.294363250888, 65314.08912367727, 2396245.534729784, 65314.08912367727, 2529292.7533150525, 232.53490448263045, 8767.160424678217}, SaturationTableData{0.0, 145.65174781818166, 5e-20, 5.783950547379796, 5815.000812293205, 1860.800259933807, 5815.000812293205, 2442.3003411632963, 20.033840798512557, 31.819684444867562}, 4});
-    SaturationTable.insert(std::array<double, 10>{550.9388888888889, 6205281.563851527, 0.0013259698826373113, 0.03128077820588877, 1216940.109993473, 2588140.5615354595, 1225174.1511436799, 2782361.5886660526, 3047.6977497306657, 5874.0812205461025}, SaturationTableEntry{SaturationTableData{550.9388888888889, 6205281.563851527, 0.0013259698826373113, 0.03128077820588877, 1216940.109993473, 2588140.5615354595, 1225174.1511436799, 2782361.5886660526, 3047.6977497306657, 5874.0812205461025}, SaturationTableData{3.5083333333333258, 0.0, 1.0924893100825329e-05, 0.0017177053352526173, 17898.572500238428, 2674.9003736549057, 18421.9225733449, 3605.300503621809, 32.40583652674786, 25.95816362607684}, 5});
-    SaturationTable.insert(std::array<double, 10>{603.15, 12858000.0, 0.00156, 0.012979, 1505700.0, 2499200.0, 1525800.0, 2666000.0, 3551.6, 5442.2}, SaturationTableEntry{SaturationTableData{603.15, 12858000.0, 0.00156, 0.012979, 1505700.0, 2499200.0, 1525800.0, 2666000.0, 3551.6, 5442.2}, SaturationTableData{0.0, 403500.0, 1.5999999999999955e-05, 0.0005655, 15350.0, 7100.0, 16200.0, 9150.0, 25.899999999999864, 24.300000000000182}, 2});
-    SaturationTable.insert(std::array<double, 10>{605.3722222222223, 13230349.769860774, 0.0015756817249418897, 0.0124681122862676, 1519692.3122847062, 2492309.3481488675, 1540556.5351992142, 2657222.771185503, 3575.0671513985117, 5419.394677031272}, SaturationTableEntry{SaturationTableData{605.3722222222223, 13230349.769860774, 0.0015756817249418897, 0.0124681122862676, 1519692.3122847062, 2492309.3481488675, 1540556.5351992142, 2657222.771185503, 3575.0671513985117, 5419.394677031272}, SaturationTableData{0.0, 457467.146401722, 1.872838817284345e-05, 0.000609609035026052, 17305.44241738459, 8257.301153456327, 18259.102550600655, 10583.301478373585, 29.119198067639672, 27.6328838600175}, 4});
-    return SaturationTable;
+inline constexpr logngine::core::RSTFlatNode<10, 16> _baked_saturationtable_nodes[] = {
+    {.min = {{{273.15999999999997, 613.15, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {611.6339194769655, 14601000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.001, 0.001638, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.011248894216215496, 0.0031057910386631943, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0, 1570700.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2374846.3317405446, 2015700.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0, 1594600.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2500900.0, 2084300.0000000002, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0, 3660.2000000000003, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {5360.360788784872, 4407.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .max = {{{610.9277777777778, 647.0999999999999, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {14198373.693821613, 22064000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.0016187570177394297, 0.003106, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {206.00602710521957, 0.010783, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1555768.5773241732, 2015735.1415765658, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2603259.563647422, 2464500.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1578749.4605343558, 2084300.0000000002, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2803295.591590308, 2622000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3635.315211814519, 4407.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {9155.6, 5335.8, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .children = {1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, .size = 2, .is_leaf = false},
+    {.min = {{{273.15999999999997, 294.22999999999996, 313.44, 338.7055555555556, 362.68333333333334, 383.15, 403.15, 417.97777777777776, 433.15, 448.3277777777778, 463.15, 485.53, 508.8777777777778, 534.8888888888889, 560.9277777777778, 588.7055555555556}, {611.6339194769655, 2500.0, 7500.0, 25671.939305383083, 68947.57293168364, 143376.47791143614, 270280.0, 413685.4375901018, 618232.2022065277, 896318.4481118872, 1255200.0, 2000000.0, 3102640.7819257635, 4826330.1052178545, 7203642.419902306, 10635163.1247122}, {0.001, 0.0010019687672471207, 0.001008, 0.0010200728758142028, 0.001035679865958239, 0.0010512868561022752, 0.00107, 0.0010849979548133932, 0.001101853504168952, 0.001121, 0.001141, 0.001177, 0.001220466629263627, 0.0012803974714167257, 0.0013584324221369067, 0.0014745484288085353}, {57.762, 19.515, 6.1935, 2.5545521467758374, 1.2543650118564735, 0.71873, 0.46242, 0.3068, 0.21659, 0.15808008177091337, 0.10429, 0.0653, 0.042175, 0.027378, 0.016849, 0.011248894216215496}, {0.0, 88422.0, 168740.0, 274421.51833374094, 374997.7723831642, 461269.12443434616, 546100.0, 609435.345131577, 674795.9542617527, 740784.583479656, 806000.0, 906120.0, 1013368.5615567123, 1137321.118871554, 1268088.8571384037, 1419278.878258027}, {2374846.3317405446, 2403800.0, 2429800.0, 2463234.3440874014, 2493472.348311326, 2517662.751690466, 2539500.0, 2554180.956791667, 2567904.358708679, 2579534.3603332657, 2589000.0, 2599100.0, 2598700.0, 2581000.0, 2537200.0, 2473003.545452054}, {0.0, 88424.0, 168750.0, 274444.7783369901, 375067.5523929117, 461408.68445384124, 546380.0, 609877.2851933113, 675470.4943559786, 741808.0236226196, 807430.0, 908470.0, 1017159.9420863274, 1143508.279735834, 1277881.3185063056, 1434956.1204479695}, {2500900.0, 2539400.0, 2574000.0, 2618378.5657593845, 2658850.9714129446, 2691100.0, 2720100.0, 2739563.1826875745, 2757473.385189438, 2772824.9873338914, 2785300.0, 2798300.0, 2796550.1906480477, 2772600.0, 2715000.0, 2632799.767773872}, {0.0, 311.8, 576.3000000000001, 900.497069789776, 1187.4603818754708, 1418.7811141884945, 1634.6000000000001, 1788.9361538951807, 1942.5079993475194, 2092.311724273492, 2235.5, 2446.7, 2662.595831936061, 2900.573577178998, 3140.10043863833, 3404.8318396184654}, {8666.1, 8255.599999999999, 7829.6, 7506.933448638034, 7251.119932903632, 7052.5, 6895.5, 6749.2, 6624.2, 6509.6375493265, 6356.3, 6177.5, 6001.359958325576, 5814.8, 5581.599999999999, 5360.360788784872}}}, .max = {{{293.15, 313.15, 338.15, 360.9277777777778, 381.99444444444447, 400.55999999999995, 416.76, 433.15, 448.15, 462.6333333333333, 483.15000000000003, 508.15, 533.15, 558.98, 588.15, 610.9277777777778}, {2339.2, 7385.1, 25043.0, 64463.912263936254, 137895.14586336727, 250000.0, 400000.0, 618230.0, 892600.0, 1241056.3127703054, 1907710.3954467545, 3062600.0, 4692300.0, 7000000.0, 10556000.0, 14198373.693821613}, {0.001002, 0.001008, 0.00102, 0.001034431306746716, 0.0010506625764965137, 0.001067, 0.001084, 0.001102, 0.001121, 0.001140558839726162, 0.001173, 0.001219, 0.0012760275141763956, 0.001352, 0.001472, 0.0016187570177394297}, {206.00602710521957, 54.242, 19.233, 6.051079790685121, 2.398794385138356, 1.2094793082022255, 0.66808, 0.4480205018707593, 0.306795969455405, 0.2157323033629829, 0.15636, 0.099587, 0.06445062649881168, 0.04094587506228748, 0.026510033458659807, 0.01669136381924378}, {83913.0, 167530.0, 272090.0, 367624.3513531764, 456384.5237520199, 535080.0, 604220.0, 674790.0, 740020.0, 803702.8922686684, 895380.0, 1010000.0, 1128854.4776888553, 1258000.0, 1416100.0, 1555768.5773241732}, {2402300.0, 2429400.0, 2462400.0, 2491146.347986409, 2516267.1514955154, 2536800.0, 2553100.0, 2567800.0, 2579400.0, 2588838.361632935, 2598374.9629650954, 2603200.0, 2603259.563647422, 2597909.762900112, 2579069.160268282, 2536038.1542573124}, {83915.0, 167530.0, 272120.0, 367694.13136292394, 456524.08377151494, 535350.0, 604660.0, 675470.0, 741020.0, 805121.7524668679, 897610.0, 1013700.0, 1134832.2985238926, 1267500.0, 1431600.0, 1578749.4605343558}, {2537400.0, 2573500.0, 2617500.0, 2655827.1709905523, 2689321.5756693613, 2716500.0, 2738100.0, 2757500.0, 2772700.0, 2784920.1890234617, 2797300.0, 2803200.0, 2803295.591590308, 2795619.7905180813, 2770033.786943991, 2713511.979048501}, {296.5, 572.4, 893.7, 1167.0287950213974, 1406.0113724046987, 1607.2, 1776.5, 1942.6000000000001, 2090.6, 2230.4761435735786, 2424.5, 2656.0, 2884.7, 3122.0, 3399.4, 3635.315211814519}, {9155.6, 8642.099999999999, 8250.1, 7820.943492501868, 7483.906045421353, 7238.2, 7026.5, 6883.93752161219, 6749.1225427799845, 6622.681165117481, 6505.9, 6339.0, 6172.181422187501, 5989.218236629508, 5799.974850194238, 5576.39969896319}}}, .children = {3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}, .size = 16, .is_leaf = false},
+    {.min = {{{613.15, 630.14, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {14601000.0, 18000000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.001638, 0.00184, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.007872, 0.0031057910386631943, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1570700.0, 1699100.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2388600.0, 2015700.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1594600.0, 1732200.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2526900.0, 2084300.0000000002, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3660.2000000000003, 3872.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {5138.4, 4407.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .max = {{{628.15, 647.0999999999999, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {17570000.0, 22064000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.001808, 0.003106, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.010783, 0.007504, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1682200.0, 2015735.1415765658, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2464500.0, 2375000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1714000.0, 2084300.0000000002, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2622000.0, 2510000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3844.2, 4407.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {5335.8, 5106.4, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .children = {19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, .size = 2, .is_leaf = false},
+    {.min = {{{293.15, 291.48333333333335, 290.65, 288.7055555555556, 288.15, 286.16999999999996, 285.9277777777778, 283.15, 283.15000000000003, 280.37222222222226, 280.12, 278.15, 277.59444444444443, 274.81666666666666, 273.15999999999997, 273.16}, {2339.2, 2108.2788851050223, 2000.0, 1767.677874822505, 1705.7, 1500.0, 1476.3743791861416, 1228.1, 1228.094169059149, 1017.3903861799237, 1000.0, 872.5, 839.2988052973849, 689.337834170973, 611.7, 611.6339194769655}, {0.001002, 0.0010013444876413593, 0.001001, 0.0010013444876413593, 0.001001, 0.001001, 0.001000720208035598, 0.001, 0.0010000959284298366, 0.0010000959284298366, 0.001, 0.001, 0.0010000959284298366, 0.0010000959284298366, 0.001, 0.0010000959284298366}, {57.762, 63.726462156128406, 66.99, 75.294363250888, 77.885, 87.964, 89.29695480811725, 106.32, 106.32105965723187, 127.09084214091517, 129.19, 147.03, 152.54896446386695, 183.89404346914915, 206.0, 206.00602710521957}, {83913.0, 76944.09074826368, 73431.0, 65314.08912367727, 62980.0, 54686.0, 53660.827495841695, 42020.0, 42030.825871255285, 30354.30424017053, 29302.0, 21019.0, 18682.434609735607, 6987.304976051515, 0.0, 0.0}, {2402300.0, 2399967.1352496515, 2398900.0, 2396245.534729784, 2395500.0, 2392800.0, 2392523.934209916, 2388700.0, 2388569.733657557, 2384848.133137689, 2384500.0, 2381800.0, 2381126.5326178214, 2377172.332065462, 2374900.0, 2374846.3317405446}, {83915.0, 76944.09074826368, 73433.0, 65314.08912367727, 62982.0, 54688.0, 53660.827495841695, 42022.0, 42030.825871255285, 30354.30424017053, 29303.0, 21020.0, 18682.434609735607, 6987.304976051515, 1.0, 0.0}, {2537400.0, 2534409.95402987, 2532900.0, 2529292.7533150525, 2528300.0, 2524700.0, 2524408.152632726, 2519200.0, 2519290.9519179077, 2514173.7512030904, 2513700.0, 2510100.0, 2509056.550488272, 2503939.349773454, 2500900.0, 2500915.5493510617}, {296.5, 272.60258607965557, 260.6, 232.53490448263045, 224.5, 195.6, 192.00667482127173, 151.10000000000002, 151.10163310727643, 109.694175323099, 105.89999999999999, 76.30000000000001, 67.82616947458793, 25.49761556174324, 0.0, 0.0}, {8666.1, 8703.521055788482, 8722.699999999999, 8767.160424678217, 8780.300000000001, 8827.0, 8832.474513801893, 8899.900000000001, 8899.463323159513, 8968.545532809556, 8974.9, 9024.900000000001, 9038.883782635054, 9111.31543275298, 9155.6, 9155.276838893915}}}, .max = {{{293.15, 291.48333333333335, 290.65, 288.7055555555556, 288.15, 286.16999999999996, 285.9277777777778, 283.15, 283.15000000000003, 280.37222222222226, 280.12, 278.15, 277.59444444444443, 274.81666666666666, 273.15999999999997, 273.16}, {2339.2, 2108.2788851050223, 2000.0, 1767.677874822505, 1705.7, 1500.0, 1476.3743791861416, 1228.1, 1228.094169059149, 1017.3903861799237, 1000.0, 872.5, 839.2988052973849, 689.337834170973, 611.7, 611.6339194769655}, {0.001002, 0.0010013444876413593, 0.001001, 0.0010013444876413593, 0.001001, 0.001001, 0.001000720208035598, 0.001, 0.0010000959284298366, 0.0010000959284298366, 0.001, 0.001, 0.0010000959284298366, 0.0010000959284298366, 0.001, 0.0010000959284298366}, {57.762, 63.726462156128406, 66.99, 75.294363250888, 77.885, 87.964, 89.29695480811725, 106.32, 106.32105965723187, 127.09084214091517, 129.19, 147.03, 152.54896446386695, 183.89404346914915, 206.0, 206.00602710521957}, {83913.0, 76944.09074826368, 73431.0, 65314.08912367727, 62980.0, 54686.0, 53660.827495841695, 42020.0, 42030.825871255285, 30354.30424017053, 29302.0, 21019.0, 18682.434609735607, 6987.304976051515, 0.0, 0.0}, {2402300.0, 2399967.1352496515, 2398900.0, 2396245.534729784, 2395500.0, 2392800.0, 2392523.934209916, 2388700.0, 2388569.733657557, 2384848.133137689, 2384500.0, 2381800.0, 2381126.5326178214, 2377172.332065462, 2374900.0, 2374846.3317405446}, {83915.0, 76944.09074826368, 73433.0, 65314.08912367727, 62982.0, 54688.0, 53660.827495841695, 42022.0, 42030.825871255285, 30354.30424017053, 29303.0, 21020.0, 18682.434609735607, 6987.304976051515, 1.0, 0.0}, {2537400.0, 2534409.95402987, 2532900.0, 2529292.7533150525, 2528300.0, 2524700.0, 2524408.152632726, 2519200.0, 2519290.9519179077, 2514173.7512030904, 2513700.0, 2510100.0, 2509056.550488272, 2503939.349773454, 2500900.0, 2500915.5493510617}, {296.5, 272.60258607965557, 260.6, 232.53490448263045, 224.5, 195.6, 192.00667482127173, 151.10000000000002, 151.10163310727643, 109.694175323099, 105.89999999999999, 76.30000000000001, 67.82616947458793, 25.49761556174324, 0.0, 0.0}, {8666.1, 8703.521055788482, 8722.699999999999, 8767.160424678217, 8780.300000000001, 8827.0, 8832.474513801893, 8899.900000000001, 8899.463323159513, 8968.545532809556, 8974.9, 9024.900000000001, 9038.883782635054, 9111.31543275298, 9155.6, 9155.276838893915}}}, .children = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, .size = 16, .is_leaf = true},
+    {.min = {{{294.22999999999996, 294.2611111111111, 297.0388888888889, 297.22999999999996, 298.15, 299.81666666666666, 302.10999999999996, 302.59444444444443, 303.15, 305.37222222222226, 306.02, 308.15, 308.15000000000003, 310.9277777777778, 311.8666666666667, 313.15}, {2500.0, 2505.141114899793, 2965.8487972293033, 3000.0, 3169.7999999999997, 3498.7445884182857, 4000.0, 4113.343253531314, 4246.900000000001, 4819.711138216413, 5000.0, 5629.1, 5629.086696861447, 6553.604702302393, 6894.7572931683635, 7385.1}, {0.001002, 0.0010019687672471207, 0.0010025930468528824, 0.001003, 0.001003, 0.0010032173264586438, 0.001004, 0.0010044658856701667, 0.001004, 0.001005090165275928, 0.001005, 0.001006, 0.001006338724487451, 0.0010069630040932124, 0.001007587283698974, 0.001008}, {54.242, 54.13627885242107, 46.15111841512642, 45.654, 43.34, 39.48006654795961, 34.791, 33.88589700073129, 32.879, 29.178828773289986, 28.185, 25.205, 25.204664803012623, 21.839173448352664, 20.819100572538463, 19.515}, {88422.0, 88574.0923728501, 100180.83399418733, 100980.0, 104830.0, 111787.57561552458, 121390.0, 123417.57724011099, 125730.0, 135024.3188614482, 137750.0, 146630.0, 146631.06048278545, 158237.8021041227, 162168.74265323288, 167530.0}, {2403800.0, 2403921.3358020107, 2407642.9363218783, 2407900.0, 2409100.0, 2411364.5368417464, 2414500.0, 2415086.1373616136, 2415900.0, 2419040.3379139733, 2419800.0, 2422700.0, 2422761.9384338404, 2426483.5389537085, 2427646.539116167, 2429400.0}, {88424.0, 88574.0923728501, 100180.83399418733, 100980.0, 104830.0, 111810.83561877374, 121390.0, 123417.57724011099, 125740.0, 135024.3188614482, 137750.0, 146640.0, 146631.06048278545, 158237.8021041227, 162168.74265323288, 167530.0}, {2539400.0, 2539527.1547446884, 2544411.755427015, 2544800.0, 2546500.0, 2549528.9561418323, 2553700.0, 2554646.1568566505, 2555600.0, 2559530.757538977, 2560700.0, 2564600.0, 2564647.958253795, 2569532.5589361214, 2571160.7591635636, 2573500.0}, {311.8, 312.29345562404404, 351.60751311579594, 354.3, 367.20000000000005, 390.54475855491125, 422.4, 429.0633239355414, 436.8, 467.28881327523203, 476.2, 505.09999999999997, 505.13749056228596, 542.651223802552, 555.2534935629537, 572.4}, {8642.099999999999, 8641.137727074198, 8580.429118593858, 8576.5, 8556.699999999999, 8520.976550288973, 8473.4, 8463.198702218026, 8452.0, 8406.676894322536, 8393.800000000001, 8351.699999999999, 8351.411126602501, 8297.820079116407, 8279.816836601549, 8255.599999999999}}}, .max = {{{294.22999999999996, 294.2611111111111, 297.0388888888889, 297.22999999999996, 298.15, 299.81666666666666, 302.10999999999996, 302.59444444444443, 303.15, 305.37222222222226, 306.02, 308.15, 308.15000000000003, 310.9277777777778, 311.8666666666667, 313.15}, {2500.0, 2505.141114899793, 2965.8487972293033, 3000.0, 3169.7999999999997, 3498.7445884182857, 4000.0, 4113.343253531314, 4246.900000000001, 4819.711138216413, 5000.0, 5629.1, 5629.086696861447, 6553.604702302393, 6894.7572931683635, 7385.1}, {0.001002, 0.0010019687672471207, 0.0010025930468528824, 0.001003, 0.001003, 0.0010032173264586438, 0.001004, 0.0010044658856701667, 0.001004, 0.001005090165275928, 0.001005, 0.001006, 0.001006338724487451, 0.0010069630040932124, 0.001007587283698974, 0.001008}, {54.242, 54.13627885242107, 46.15111841512642, 45.654, 43.34, 39.48006654795961, 34.791, 33.88589700073129, 32.879, 29.178828773289986, 28.185, 25.205, 25.204664803012623, 21.839173448352664, 20.819100572538463, 19.515}, {88422.0, 88574.0923728501, 100180.83399418733, 100980.0, 104830.0, 111787.57561552458, 121390.0, 123417.57724011099, 125730.0, 135024.3188614482, 137750.0, 146630.0, 146631.06048278545, 158237.8021041227, 162168.74265323288, 167530.0}, {2403800.0, 2403921.3358020107, 2407642.9363218783, 2407900.0, 2409100.0, 2411364.5368417464, 2414500.0, 2415086.1373616136, 2415900.0, 2419040.3379139733, 2419800.0, 2422700.0, 2422761.9384338404, 2426483.5389537085, 2427646.539116167, 2429400.0}, {88424.0, 88574.0923728501, 100180.83399418733, 100980.0, 104830.0, 111810.83561877374, 121390.0, 123417.57724011099, 125740.0, 135024.3188614482, 137750.0, 146640.0, 146631.06048278545, 158237.8021041227, 162168.74265323288, 167530.0}, {2539400.0, 2539527.1547446884, 2544411.755427015, 2544800.0, 2546500.0, 2549528.9561418323, 2553700.0, 2554646.1568566505, 2555600.0, 2559530.757538977, 2560700.0, 2564600.0, 2564647.958253795, 2569532.5589361214, 2571160.7591635636, 2573500.0}, {311.8, 312.29345562404404, 351.60751311579594, 354.3, 367.20000000000005, 390.54475855491125, 422.4, 429.0633239355414, 436.8, 467.28881327523203, 476.2, 505.09999999999997, 505.13749056228596, 542.651223802552, 555.2534935629537, 572.4}, {8642.099999999999, 8641.137727074198, 8580.429118593858, 8576.5, 8556.699999999999, 8520.976550288973, 8473.4, 8463.198702218026, 8452.0, 8406.676894322536, 8393.800000000001, 8351.699999999999, 8351.411126602501, 8297.820079116407, 8279.816836601549, 8255.599999999999}}}, .children = {16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31}, .size = 16, .is_leaf = true},
+    {.min = {{{313.44, 316.48333333333335, 318.15, 318.96, 322.0388888888889, 323.15, 325.3833333333333, 327.12, 327.59444444444443, 328.15, 333.15, 333.15000000000003, 333.21, 333.93333333333334, 338.10999999999996, 338.15}, {7500.0, 8802.53663618805, 9595.3, 10000.0, 11687.303087649694, 12352.0, 13789.514586336727, 15000.0, 15347.729734592776, 15763.0, 19947.0, 19947.222324865394, 20000.0, 20684.27187950509, 25000.0, 25043.0}, {0.001008, 0.0010094601225162582, 0.00101, 0.00101, 0.0010113329613335425, 0.001012, 0.001013205800150827, 0.001014, 0.00101445435936235, 0.001015, 0.001017, 0.0010169514777853955, 0.001017, 0.001017575757391157, 0.00102, 0.00102}, {19.233, 16.540912434255272, 15.251, 14.67, 12.669130319322786, 12.026, 10.844361031682078, 10.02, 9.806808326906555, 9.5639, 7.667, 7.666777838356318, 7.6481, 7.410198920388364, 6.2034, 6.1935}, {168740.0, 181451.28534679717, 188430.0, 191790.0, 204688.0285927208, 209330.0, 218690.55054872282, 225930.0, 227924.77183864443, 230240.0, 251160.0, 251161.51508456812, 251400.0, 254441.17554270147, 271930.0, 272090.0}, {2429800.0, 2433926.739993444, 2436100.0, 2437200.0, 2441369.941033179, 2442700.0, 2445789.341650522, 2448000.0, 2448580.5420404226, 2449300.0, 2455900.0, 2456023.7430801583, 2456000.0, 2456954.1432101247, 2462400.0, 2462400.0}, {168750.0, 181474.54535004633, 188440.0, 191810.0, 204688.0285927208, 209340.0, 218690.55054872282, 225940.0, 227924.77183864443, 230260.0, 251180.0, 251184.77508781725, 251420.0, 254464.43554595066, 271960.0, 272120.0}, {2574000.0, 2579534.3603332657, 2582400.0, 2583900.0, 2589303.5616979185, 2591300.0, 2595351.162542703, 2598300.0, 2599072.763062571, 2600100.0, 2608800.0, 2608841.964427223, 2608900.0, 2610237.564622174, 2617500.0, 2617500.0}, {576.3000000000001, 616.631990136871, 638.5999999999999, 649.2, 689.3985843015832, 703.8, 732.6482343430952, 754.9, 760.9091382908401, 768.0, 831.3000000000001, 831.2892561221872, 832.0, 841.1282374965873, 893.2, 893.7}, {8250.1, 8193.568744553615, 8163.299999999999, 8148.799999999999, 8093.92289063416, 8074.8, 8036.145042563214, 8007.099999999999, 7998.88251735804, 7989.8, 7908.2, 7908.02894466677, 7907.3, 7895.468542912216, 7830.2, 7829.6}}}, .max = {{{313.44, 316.48333333333335, 318.15, 318.96, 322.0388888888889, 323.15, 325.3833333333333, 327.12, 327.59444444444443, 328.15, 333.15, 333.15000000000003, 333.21, 333.93333333333334, 338.10999999999996, 338.15}, {7500.0, 8802.53663618805, 9595.3, 10000.0, 11687.303087649694, 12352.0, 13789.514586336727, 15000.0, 15347.729734592776, 15763.0, 19947.0, 19947.222324865394, 20000.0, 20684.27187950509, 25000.0, 25043.0}, {0.001008, 0.0010094601225162582, 0.00101, 0.00101, 0.0010113329613335425, 0.001012, 0.001013205800150827, 0.001014, 0.00101445435936235, 0.001015, 0.001017, 0.0010169514777853955, 0.001017, 0.001017575757391157, 0.00102, 0.00102}, {19.233, 16.540912434255272, 15.251, 14.67, 12.669130319322786, 12.026, 10.844361031682078, 10.02, 9.806808326906555, 9.5639, 7.667, 7.666777838356318, 7.6481, 7.410198920388364, 6.2034, 6.1935}, {168740.0, 181451.28534679717, 188430.0, 191790.0, 204688.0285927208, 209330.0, 218690.55054872282, 225930.0, 227924.77183864443, 230240.0, 251160.0, 251161.51508456812, 251400.0, 254441.17554270147, 271930.0, 272090.0}, {2429800.0, 2433926.739993444, 2436100.0, 2437200.0, 2441369.941033179, 2442700.0, 2445789.341650522, 2448000.0, 2448580.5420404226, 2449300.0, 2455900.0, 2456023.7430801583, 2456000.0, 2456954.1432101247, 2462400.0, 2462400.0}, {168750.0, 181474.54535004633, 188440.0, 191810.0, 204688.0285927208, 209340.0, 218690.55054872282, 225940.0, 227924.77183864443, 230260.0, 251180.0, 251184.77508781725, 251420.0, 254464.43554595066, 271960.0, 272120.0}, {2574000.0, 2579534.3603332657, 2582400.0, 2583900.0, 2589303.5616979185, 2591300.0, 2595351.162542703, 2598300.0, 2599072.763062571, 2600100.0, 2608800.0, 2608841.964427223, 2608900.0, 2610237.564622174, 2617500.0, 2617500.0}, {576.3000000000001, 616.631990136871, 638.5999999999999, 649.2, 689.3985843015832, 703.8, 732.6482343430952, 754.9, 760.9091382908401, 768.0, 831.3000000000001, 831.2892561221872, 832.0, 841.1282374965873, 893.2, 893.7}, {8250.1, 8193.568744553615, 8163.299999999999, 8148.799999999999, 8093.92289063416, 8074.8, 8036.145042563214, 8007.099999999999, 7998.88251735804, 7989.8, 7908.2, 7908.02894466677, 7907.3, 7895.468542912216, 7830.2, 7829.6}}}, .children = {32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47}, .size = 16, .is_leaf = true},
+    {.min = {{{360.9277777777778, 358.15, 356.93333333333334, 355.37222222222226, 354.46999999999997, 353.15, 349.81666666666666, 349.81666666666666, 349.01, 348.15, 345.47222222222223, 344.2611111111111, 343.15, 342.24, 340.32222222222225, 338.7055555555556}, {64463.912263936254, 57868.0, 55158.05834534691, 51846.50641743815, 50000.0, 47416.0, 41367.85428328087, 41368.54375901018, 40000.0, 38597.0, 34473.78646584182, 32732.170773587488, 31202.0, 30000.0, 27579.029172673454, 25671.939305383083}, {0.001034431306746716, 0.001032, 0.0010313099087179089, 0.0010306856291121473, 0.00103, 0.001029, 0.0010269399514775787, 0.0010269399514775787, 0.001026, 0.001026, 0.0010244428330545329, 0.00102319427384301, 0.001023, 0.001022, 0.0010213214350257257, 0.0010200728758142028}, {2.5545521467758374, 2.8261, 2.9557766493987185, 3.1321356380263268, 3.2403, 3.4053, 3.8694098524305947, 3.8694098524305947, 3.9933, 4.1291, 4.590015801361032, 4.818502137069721, 5.0396, 5.2287, 5.65778363905541, 6.051079790685121}, {367624.3513531764, 355960.0, 350830.62900727364, 344294.5680942561, 340490.0, 334970.0, 320988.0448385849, 320988.0448385849, 317580.0, 313990.0, 302775.46229448257, 297681.52158291376, 293040.0, 289240.0, 281190.1792792502, 274421.51833374094}, {2491146.347986409, 2487800.0, 2486261.747304083, 2484400.9470441486, 2483200.0, 2481600.0, 2477422.9460693966, 2477422.9460693966, 2476300.0, 2475300.0, 2471840.5452895956, 2470212.3450621534, 2468900.0, 2467700.0, 2465327.7443798273, 2463234.3440874014}, {367694.13136292394, 356020.0, 350900.4090170212, 344341.08810075436, 340540.0, 335020.0, 321034.5648450833, 321034.5648450833, 317620.0, 314030.0, 302798.7222977318, 297728.0415894121, 293070.0, 289270.0, 281213.43928249937, 274444.7783369901}, {2655827.1709905523, 2651400.0, 2649314.370080784, 2646755.7697233753, 2645200.0, 2643000.0, 2637451.7684237063, 2637451.7684237063, 2636100.0, 2634600.0, 2630008.5673839706, 2627915.167091545, 2626100.0, 2624600.0, 2621169.7661492852, 2618378.5657593845}, {1167.0287950213974, 1134.6000000000001, 1120.2622324886104, 1101.8821779211144, 1091.2, 1075.6, 1035.7725966863152, 1035.7725966863152, 1026.1, 1015.8000000000001, 983.3957213698279, 968.658183311152, 955.0999999999999, 944.1, 920.4681085795157, 900.497069789776}, {7506.933448638034, 7543.5, 7559.687136007158, 7580.621138931414, 7593.099999999999, 7611.1, 7657.239589634189, 7657.239589634189, 7669.1, 7681.2, 7719.622918348471, 7737.62616086333, 7754.0, 7767.5, 7796.241369051246, 7820.943492501868}}}, .max = {{{360.9277777777778, 358.15, 356.93333333333334, 355.37222222222226, 354.46999999999997, 353.15, 349.81666666666666, 349.81666666666666, 349.01, 348.15, 345.47222222222223, 344.2611111111111, 343.15, 342.24, 340.32222222222225, 338.7055555555556}, {64463.912263936254, 57868.0, 55158.05834534691, 51846.50641743815, 50000.0, 47416.0, 41367.85428328087, 41368.54375901018, 40000.0, 38597.0, 34473.78646584182, 32732.170773587488, 31202.0, 30000.0, 27579.029172673454, 25671.939305383083}, {0.001034431306746716, 0.001032, 0.0010313099087179089, 0.0010306856291121473, 0.00103, 0.001029, 0.0010269399514775787, 0.0010269399514775787, 0.001026, 0.001026, 0.0010244428330545329, 0.00102319427384301, 0.001023, 0.001022, 0.0010213214350257257, 0.0010200728758142028}, {2.5545521467758374, 2.8261, 2.9557766493987185, 3.1321356380263268, 3.2403, 3.4053, 3.8694098524305947, 3.8694098524305947, 3.9933, 4.1291, 4.590015801361032, 4.818502137069721, 5.0396, 5.2287, 5.65778363905541, 6.051079790685121}, {367624.3513531764, 355960.0, 350830.62900727364, 344294.5680942561, 340490.0, 334970.0, 320988.0448385849, 320988.0448385849, 317580.0, 313990.0, 302775.46229448257, 297681.52158291376, 293040.0, 289240.0, 281190.1792792502, 274421.51833374094}, {2491146.347986409, 2487800.0, 2486261.747304083, 2484400.9470441486, 2483200.0, 2481600.0, 2477422.9460693966, 2477422.9460693966, 2476300.0, 2475300.0, 2471840.5452895956, 2470212.3450621534, 2468900.0, 2467700.0, 2465327.7443798273, 2463234.3440874014}, {367694.13136292394, 356020.0, 350900.4090170212, 344341.08810075436, 340540.0, 335020.0, 321034.5648450833, 321034.5648450833, 317620.0, 314030.0, 302798.7222977318, 297728.0415894121, 293070.0, 289270.0, 281213.43928249937, 274444.7783369901}, {2655827.1709905523, 2651400.0, 2649314.370080784, 2646755.7697233753, 2645200.0, 2643000.0, 2637451.7684237063, 2637451.7684237063, 2636100.0, 2634600.0, 2630008.5673839706, 2627915.167091545, 2626100.0, 2624600.0, 2621169.7661492852, 2618378.5657593845}, {1167.0287950213974, 1134.6000000000001, 1120.2622324886104, 1101.8821779211144, 1091.2, 1075.6, 1035.7725966863152, 1035.7725966863152, 1026.1, 1015.8000000000001, 983.3957213698279, 968.658183311152, 955.0999999999999, 944.1, 920.4681085795157, 900.497069789776}, {7506.933448638034, 7543.5, 7559.687136007158, 7580.621138931414, 7593.099999999999, 7611.1, 7657.239589634189, 7657.239589634189, 7669.1, 7681.2, 7719.622918348471, 7737.62616086333, 7754.0, 7767.5, 7796.241369051246, 7820.943492501868}}}, .children = {48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63}, .size = 16, .is_leaf = true},
+    {.min = {{{381.99444444444447, 379.12, 378.15, 377.59444444444443, 373.70000000000005, 373.15000000000003, 373.15, 373.12222222222226, 373.12, 372.76, 372.0388888888889, 368.15, 366.48333333333335, 364.90999999999997, 363.15, 362.68333333333334}, {137895.14586336727, 125000.0, 120900.0, 118596.72019978902, 103421.35939752545, 101414.98502521345, 101420.0, 101325.35318040226, 101325.0, 100000.0, 97464.28909622798, 84609.0, 79551.70964857658, 75000.0, 70183.0, 68947.57293168364}, {0.0010506625764965137, 0.001048, 0.001047, 0.001046916898861945, 0.0010437955008331377, 0.0010431712212273763, 0.001043, 0.0010431712212273763, 0.001043, 0.001043, 0.0010425469416216148, 0.00104, 0.0010381769843812846, 0.001037, 0.001036, 0.001035679865958239}, {1.2543650118564735, 1.375, 1.4186, 1.4443332958896815, 1.6416680792708747, 1.6719456401503048, 1.672, 1.673381483243556, 1.6734, 1.6941, 1.7353724480956676, 1.9808, 2.0983910388459486, 2.2172, 2.3593, 2.398794385138356}, {456384.5237520199, 444230.0, 440150.0, 437799.7811559308, 421378.21886201476, 419052.2185370975, 419060.0, 418959.1785241008, 418950.0, 417400.0, 414376.95788401377, 398000.0, 391000.6546185951, 384360.0, 376970.0, 374997.7723831642}, {2516267.1514955154, 2513000.0, 2511900.0, 2511149.950780697, 2506730.5501633547, 2506032.75006588, 2506000.0, 2506032.75006588, 2506000.0, 2505600.0, 2504637.149870929, 2500100.0, 2498124.3489611605, 2496100.0, 2494000.0, 2493472.348311326}, {456524.08377151494, 444360.0, 440280.0, 437939.34117542586, 421494.5188782607, 419168.51855334337, 419170.0, 419052.2185370975, 419060.0, 417510.0, 414493.25790025963, 398090.0, 391070.43462834257, 384440.0, 377040.0, 375067.5523929117}, {2689321.5756693613, 2684900.0, 2683400.0, 2682576.174727101, 2676528.5738823162, 2675598.1737523493, 2675600.0, 2675598.1737523493, 2675600.0, 2675000.0, 2673737.3734924155, 2667600.0, 2664898.57225773, 2662400.0, 2659600.0, 2658850.9714129446}, {1406.0113724046987, 1374.1000000000001, 1363.3999999999999, 1357.1095415736377, 1313.399343467792, 1307.2028786022124, 1307.1999999999998, 1306.909802561273, 1306.8999999999999, 1302.8, 1294.642476847659, 1250.3999999999999, 1231.296183998862, 1213.2, 1192.9, 1187.4603818754708}, {7251.119932903632, 7284.099999999999, 7295.200000000001, 7301.361539921845, 7347.416346355207, 7354.1152272909685, 7354.2, 7354.533907349453, 7354.5, 7358.900000000001, 7367.512989162492, 7415.099999999999, 7435.757838695566, 7455.8, 7478.2, 7483.906045421353}}}, .max = {{{381.99444444444447, 379.12, 378.15, 377.59444444444443, 373.70000000000005, 373.15000000000003, 373.15, 373.12222222222226, 373.12, 372.76, 372.0388888888889, 368.15, 366.48333333333335, 364.90999999999997, 363.15, 362.68333333333334}, {137895.14586336727, 125000.0, 120900.0, 118596.72019978902, 103421.35939752545, 101414.98502521345, 101420.0, 101325.35318040226, 101325.0, 100000.0, 97464.28909622798, 84609.0, 79551.70964857658, 75000.0, 70183.0, 68947.57293168364}, {0.0010506625764965137, 0.001048, 0.001047, 0.001046916898861945, 0.0010437955008331377, 0.0010431712212273763, 0.001043, 0.0010431712212273763, 0.001043, 0.001043, 0.0010425469416216148, 0.00104, 0.0010381769843812846, 0.001037, 0.001036, 0.001035679865958239}, {1.2543650118564735, 1.375, 1.4186, 1.4443332958896815, 1.6416680792708747, 1.6719456401503048, 1.672, 1.673381483243556, 1.6734, 1.6941, 1.7353724480956676, 1.9808, 2.0983910388459486, 2.2172, 2.3593, 2.398794385138356}, {456384.5237520199, 444230.0, 440150.0, 437799.7811559308, 421378.21886201476, 419052.2185370975, 419060.0, 418959.1785241008, 418950.0, 417400.0, 414376.95788401377, 398000.0, 391000.6546185951, 384360.0, 376970.0, 374997.7723831642}, {2516267.1514955154, 2513000.0, 2511900.0, 2511149.950780697, 2506730.5501633547, 2506032.75006588, 2506000.0, 2506032.75006588, 2506000.0, 2505600.0, 2504637.149870929, 2500100.0, 2498124.3489611605, 2496100.0, 2494000.0, 2493472.348311326}, {456524.08377151494, 444360.0, 440280.0, 437939.34117542586, 421494.5188782607, 419168.51855334337, 419170.0, 419052.2185370975, 419060.0, 417510.0, 414493.25790025963, 398090.0, 391070.43462834257, 384440.0, 377040.0, 375067.5523929117}, {2689321.5756693613, 2684900.0, 2683400.0, 2682576.174727101, 2676528.5738823162, 2675598.1737523493, 2675600.0, 2675598.1737523493, 2675600.0, 2675000.0, 2673737.3734924155, 2667600.0, 2664898.57225773, 2662400.0, 2659600.0, 2658850.9714129446}, {1406.0113724046987, 1374.1000000000001, 1363.3999999999999, 1357.1095415736377, 1313.399343467792, 1307.2028786022124, 1307.1999999999998, 1306.909802561273, 1306.8999999999999, 1302.8, 1294.642476847659, 1250.3999999999999, 1231.296183998862, 1213.2, 1192.9, 1187.4603818754708}, {7251.119932903632, 7284.099999999999, 7295.200000000001, 7301.361539921845, 7347.416346355207, 7354.1152272909685, 7354.2, 7354.533907349453, 7354.5, 7358.900000000001, 7367.512989162492, 7415.099999999999, 7435.757838695566, 7455.8, 7478.2, 7483.906045421353}}}, .children = {64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79}, .size = 16, .is_leaf = true},
+    {.min = {{{400.55999999999995, 399.8166666666667, 399.4, 398.15, 397.12, 394.4277777777778, 394.2611111111111, 393.35999999999996, 393.15, 389.19, 388.72222222222223, 388.7055555555556, 388.15, 384.5, 383.15, 383.15000000000003}, {250000.0, 244398.461770939, 241316.50526089274, 232230.0, 225000.0, 206842.7187950509, 205767.13665731665, 200000.0, 198670.0, 175000.0, 172368.93232920908, 172265.51096981156, 169180.0, 150000.0, 143380.0, 143376.47791143614}, {0.001067, 0.00106626956664055, 0.00106626956664055, 0.001065, 0.001064, 0.0010612753297944582, 0.0010612753297944582, 0.001061, 0.00106, 0.001057, 0.0010562810929483667, 0.0010562810929483667, 0.001056, 0.001053, 0.001052, 0.0010512868561022752}, {0.71873, 0.7341528163754605, 0.7429551588166969, 0.77012, 0.79329, 0.8583220299614122, 0.8625047033200138, 0.88578, 0.89133, 1.0037, 1.01801275311519, 1.0185746047603752, 1.036, 1.1594, 1.2094, 1.2094793082022255}, {535080.0, 531909.754302084, 530141.9940551468, 524830.0, 520470.0, 509021.91110489797, 508324.1110074228, 504500.0, 503600.0, 486820.0, 484854.7677290074, 484761.7277160107, 482420.0, 466970.0, 461270.0, 461269.12443434616}, {2536800.0, 2536038.1542573124, 2535572.9541923287, 2534300.0, 2533200.0, 2530223.153445019, 2529990.553412528, 2529100.0, 2528900.0, 2524500.0, 2523942.952567742, 2523942.952567742, 2523300.0, 2519200.0, 2517700.0, 2517662.751690466}, {535350.0, 532165.6143378249, 530397.8540908878, 525070.0, 520710.00000000006, 509231.25113414053, 508533.45103666536, 504710.0, 503810.0, 487010.0, 485017.58775175165, 484947.8077420041, 482590.0, 467130.0, 461420.0, 461408.68445384124}, {2716500.0, 2715372.779308435, 2714907.5792434514, 2713100.0, 2711700.0, 2707696.9782362077, 2707464.378203716, 2706300.0, 2706000.0, 2700200.0, 2699555.977098997, 2699323.3770665056, 2698600.0, 2693100.0, 2691100.0, 2691182.375929295}, {1607.2, 1599.2740874014257, 1594.877946787332, 1581.6, 1570.6, 1541.6218433480258, 1539.8633871023885, 1530.2, 1527.9, 1485.0, 1479.9084027273207, 1479.699062698078, 1473.7, 1433.7, 1418.8, 1418.7811141884945}, {7052.5, 7059.783146175935, 7063.969946760787, 7077.099999999999, 7087.7, 7115.467593954456, 7117.142314188396, 7127.0, 7129.2, 7171.599999999999, 7176.594882493282, 7176.594882493282, 7182.9, 7223.099999999999, 7238.2, 7238.140851090592}}}, .max = {{{400.55999999999995, 399.8166666666667, 399.4, 398.15, 397.12, 394.4277777777778, 394.2611111111111, 393.35999999999996, 393.15, 389.19, 388.72222222222223, 388.7055555555556, 388.15, 384.5, 383.15, 383.15000000000003}, {250000.0, 244398.461770939, 241316.50526089274, 232230.0, 225000.0, 206842.7187950509, 205767.13665731665, 200000.0, 198670.0, 175000.0, 172368.93232920908, 172265.51096981156, 169180.0, 150000.0, 143380.0, 143376.47791143614}, {0.001067, 0.00106626956664055, 0.00106626956664055, 0.001065, 0.001064, 0.0010612753297944582, 0.0010612753297944582, 0.001061, 0.00106, 0.001057, 0.0010562810929483667, 0.0010562810929483667, 0.001056, 0.001053, 0.001052, 0.0010512868561022752}, {0.71873, 0.7341528163754605, 0.7429551588166969, 0.77012, 0.79329, 0.8583220299614122, 0.8625047033200138, 0.88578, 0.89133, 1.0037, 1.01801275311519, 1.0185746047603752, 1.036, 1.1594, 1.2094, 1.2094793082022255}, {535080.0, 531909.754302084, 530141.9940551468, 524830.0, 520470.0, 509021.91110489797, 508324.1110074228, 504500.0, 503600.0, 486820.0, 484854.7677290074, 484761.7277160107, 482420.0, 466970.0, 461270.0, 461269.12443434616}, {2536800.0, 2536038.1542573124, 2535572.9541923287, 2534300.0, 2533200.0, 2530223.153445019, 2529990.553412528, 2529100.0, 2528900.0, 2524500.0, 2523942.952567742, 2523942.952567742, 2523300.0, 2519200.0, 2517700.0, 2517662.751690466}, {535350.0, 532165.6143378249, 530397.8540908878, 525070.0, 520710.00000000006, 509231.25113414053, 508533.45103666536, 504710.0, 503810.0, 487010.0, 485017.58775175165, 484947.8077420041, 482590.0, 467130.0, 461420.0, 461408.68445384124}, {2716500.0, 2715372.779308435, 2714907.5792434514, 2713100.0, 2711700.0, 2707696.9782362077, 2707464.378203716, 2706300.0, 2706000.0, 2700200.0, 2699555.977098997, 2699323.3770665056, 2698600.0, 2693100.0, 2691100.0, 2691182.375929295}, {1607.2, 1599.2740874014257, 1594.877946787332, 1581.6, 1570.6, 1541.6218433480258, 1539.8633871023885, 1530.2, 1527.9, 1485.0, 1479.9084027273207, 1479.699062698078, 1473.7, 1433.7, 1418.8, 1418.7811141884945}, {7052.5, 7059.783146175935, 7063.969946760787, 7077.099999999999, 7087.7, 7115.467593954456, 7117.142314188396, 7127.0, 7129.2, 7171.599999999999, 7176.594882493282, 7176.594882493282, 7182.9, 7223.099999999999, 7238.2, 7238.140851090592}}}, .children = {80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95}, .size = 16, .is_leaf = true},
+    {.min = {{{416.76, 416.48333333333335, 414.84444444444443, 414.45, 413.15, 412.01, 411.47777777777776, 410.9277777777778, 409.41999999999996, 408.15, 407.82222222222225, 406.66999999999996, 405.37222222222226, 403.8277777777778, 403.73, 403.15}, {400000.0, 396951.8616395822, 379211.65112426, 375000.0, 361530.0, 350000.0, 344737.86465841817, 339373.7434843332, 325000.0, 313220.0, 310264.07819257636, 300000.0, 288731.75116601156, 275790.29172673455, 275000.0, 270280.0}, {0.001084, 0.0010831251159961089, 0.0010812522771788244, 0.001081, 0.00108, 0.001079, 0.0010781308791500174, 0.0010775065995442558, 0.001076, 0.001075, 0.0010743852015154486, 0.001073, 0.001071888083092403, 0.0010706395238808798, 0.00107, 0.00107}, {0.46242, 0.465756285470442, 0.4862014425591294, 0.49133, 0.5085, 0.52422, 0.5317301542073116, 0.5396210484241364, 0.56199, 0.58179, 0.5869976277053724, 0.60582, 0.6279628554354385, 0.6555560140100944, 0.65732, 0.66808}, {604220.0, 603038.8442380545, 596037.5832600535, 594320.0, 588770.0, 583890.0, 581616.3812455664, 579267.1209173999, 572840.0, 567410.0, 566008.9190653714, 561110.0, 555565.1776064928, 548982.5966869768, 548570.0, 546100.0}, {2553100.0, 2552785.3565967167, 2551389.7564017666, 2550900.0, 2549600.0, 2548500.0, 2547900.755914391, 2547435.5558494073, 2545900.0, 2544700.0, 2544411.755427015, 2543200.0, 2541853.1550696054, 2540224.9548421632, 2540100.0, 2539500.0}, {604660.0, 603480.7842997888, 596433.0033152895, 594730.0, 589160.0, 584260.0, 581988.5412975531, 579639.2809693866, 573190.0, 567750.0, 566357.819114109, 561430.0, 555867.557648732, 549261.7167259669, 548860.0, 546380.0}, {2738100.0, 2737702.3824276407, 2735608.982135215, 2735100.0, 2733500.0, 2732000.0, 2731189.5815178724, 2730491.7814203976, 2728600.0, 2726900.0, 2726537.580868038, 2724900.0, 2723048.580380662, 2720955.1800882365, 2720900.0, 2720100.0}, {1776.5, 1773.5705957487771, 1756.6977893918274, 1752.6, 1739.2, 1727.4, 1721.8217405200176, 1716.12769172462, 1700.5, 1687.2, 1683.7637232037212, 1671.7, 1658.0148996068865, 1641.7701133376643, 1640.8, 1634.6000000000001}, {6895.5, 6897.753963542198, 6913.2451257061475, 6917.099999999999, 6929.400000000001, 6940.2, 6945.064810151016, 6950.507650911321, 6965.0, 6977.299999999999, 6980.233935063765, 6991.7, 7004.517378455901, 7019.589860561366, 7020.7, 7026.5}}}, .max = {{{416.76, 416.48333333333335, 414.84444444444443, 414.45, 413.15, 412.01, 411.47777777777776, 410.9277777777778, 409.41999999999996, 408.15, 407.82222222222225, 406.66999999999996, 405.37222222222226, 403.8277777777778, 403.73, 403.15}, {400000.0, 396951.8616395822, 379211.65112426, 375000.0, 361530.0, 350000.0, 344737.86465841817, 339373.7434843332, 325000.0, 313220.0, 310264.07819257636, 300000.0, 288731.75116601156, 275790.29172673455, 275000.0, 270280.0}, {0.001084, 0.0010831251159961089, 0.0010812522771788244, 0.001081, 0.00108, 0.001079, 0.0010781308791500174, 0.0010775065995442558, 0.001076, 0.001075, 0.0010743852015154486, 0.001073, 0.001071888083092403, 0.0010706395238808798, 0.00107, 0.00107}, {0.46242, 0.465756285470442, 0.4862014425591294, 0.49133, 0.5085, 0.52422, 0.5317301542073116, 0.5396210484241364, 0.56199, 0.58179, 0.5869976277053724, 0.60582, 0.6279628554354385, 0.6555560140100944, 0.65732, 0.66808}, {604220.0, 603038.8442380545, 596037.5832600535, 594320.0, 588770.0, 583890.0, 581616.3812455664, 579267.1209173999, 572840.0, 567410.0, 566008.9190653714, 561110.0, 555565.1776064928, 548982.5966869768, 548570.0, 546100.0}, {2553100.0, 2552785.3565967167, 2551389.7564017666, 2550900.0, 2549600.0, 2548500.0, 2547900.755914391, 2547435.5558494073, 2545900.0, 2544700.0, 2544411.755427015, 2543200.0, 2541853.1550696054, 2540224.9548421632, 2540100.0, 2539500.0}, {604660.0, 603480.7842997888, 596433.0033152895, 594730.0, 589160.0, 584260.0, 581988.5412975531, 579639.2809693866, 573190.0, 567750.0, 566357.819114109, 561430.0, 555867.557648732, 549261.7167259669, 548860.0, 546380.0}, {2738100.0, 2737702.3824276407, 2735608.982135215, 2735100.0, 2733500.0, 2732000.0, 2731189.5815178724, 2730491.7814203976, 2728600.0, 2726900.0, 2726537.580868038, 2724900.0, 2723048.580380662, 2720955.1800882365, 2720900.0, 2720100.0}, {1776.5, 1773.5705957487771, 1756.6977893918274, 1752.6, 1739.2, 1727.4, 1721.8217405200176, 1716.12769172462, 1700.5, 1687.2, 1683.7637232037212, 1671.7, 1658.0148996068865, 1641.7701133376643, 1640.8, 1634.6000000000001}, {6895.5, 6897.753963542198, 6913.2451257061475, 6917.099999999999, 6929.400000000001, 6940.2, 6945.064810151016, 6950.507650911321, 6965.0, 6977.299999999999, 6980.233935063765, 6991.7, 7004.517378455901, 7019.589860561366, 7020.7, 7026.5}}}, .children = {96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111}, .size = 16, .is_leaf = true},
+    {.min = {{{433.15, 431.98, 431.06111111111113, 428.7166666666667, 428.61, 428.15, 427.59444444444443, 426.2555555555556, 424.98, 423.65555555555557, 423.15, 422.0388888888889, 421.04999999999995, 420.9, 418.15, 417.97777777777776}, {618230.0, 600000.0, 586054.3699193109, 551580.5834534691, 550000.0, 543490.0, 535660.5888635434, 517106.7969876273, 500000.0, 482633.0105217855, 476160.0, 462141.7918464891, 450000.0, 448159.2240559436, 415680.0, 413685.4375901018}, {0.001102, 0.001101, 0.0010993563857459065, 0.0010968592673228606, 0.001097, 0.001096, 0.0010956107081113377, 0.0010937378692940534, 0.001093, 0.0010912407508710076, 0.001091, 0.0010893679120537233, 0.001088, 0.0010881193528422006, 0.001085, 0.0010849979548133932}, {0.3068, 0.3156, 0.3226838854220338, 0.34168695662141224, 0.34261, 0.34648, 0.3512571629777352, 0.3631247182832603, 0.37483, 0.38752156527641757, 0.39248, 0.4036779214735239, 0.41392, 0.41552050559481846, 0.446, 0.4480205018707593}, {674790.0, 669720.0, 665747.8129978245, 655629.7115844343, 655160.0, 653190.0, 650791.6309086063, 645023.1501028114, 639540.0, 633835.0885399593, 631660.0, 626880.3475684567, 622650.0, 621995.7468861304, 610190.0, 609435.345131577}, {2567800.0, 2566800.0, 2566043.5584487454, 2563950.1581563195, 2563900.0, 2563500.0, 2563019.758026353, 2561856.7578638946, 2560700.0, 2559530.757538977, 2559100.0, 2558135.1573440265, 2557100.0, 2556972.157181568, 2554400.0, 2554180.956791667}, {675470.0, 670380.0, 666399.0930888013, 656234.4716689127, 655770.0, 653790.0, 651396.3909930849, 645581.3901807916, 640090.0, 634346.8086114412, 632180.0, 627392.0676399384, 623140.0, 622484.206954363, 610640.0, 609877.2851933113}, {2757500.0, 2756200.0, 2755147.3848645203, 2752588.7845071116, 2752400.0, 2751800.0, 2751193.184312161, 2749564.984084719, 2748100.0, 2746541.1836623265, 2745900.0, 2744680.3834023927, 2743400.0, 2743284.7832074426, 2739800.0, 2739563.1826875745}, {1942.6000000000001, 1930.8000000000002, 1921.6158644291124, 1898.086045142249, 1897.0, 1892.4, 1886.781683563151, 1873.2164496682335, 1860.4, 1846.8814739895201, 1841.8000000000002, 1830.4692156969038, 1820.5, 1818.8717780768661, 1790.8, 1788.9361538951807}, {6749.2, 6759.299999999999, 6767.125785294844, 6787.641108160614, 6788.599999999999, 6792.7, 6797.270749505771, 6809.41247120184, 6820.700000000001, 6832.43987441852, 6837.1, 6847.0936764655, 6856.099999999999, 6857.141997869142, 6882.7, 6883.93752161219}}}, .max = {{{433.15, 431.98, 431.06111111111113, 428.7166666666667, 428.61, 428.15, 427.59444444444443, 426.2555555555556, 424.98, 423.65555555555557, 423.15, 422.0388888888889, 421.04999999999995, 420.9, 418.15, 417.97777777777776}, {618230.0, 600000.0, 586054.3699193109, 551580.5834534691, 550000.0, 543490.0, 535660.5888635434, 517106.7969876273, 500000.0, 482633.0105217855, 476160.0, 462141.7918464891, 450000.0, 448159.2240559436, 415680.0, 413685.4375901018}, {0.001102, 0.001101, 0.0010993563857459065, 0.0010968592673228606, 0.001097, 0.001096, 0.0010956107081113377, 0.0010937378692940534, 0.001093, 0.0010912407508710076, 0.001091, 0.0010893679120537233, 0.001088, 0.0010881193528422006, 0.001085, 0.0010849979548133932}, {0.3068, 0.3156, 0.3226838854220338, 0.34168695662141224, 0.34261, 0.34648, 0.3512571629777352, 0.3631247182832603, 0.37483, 0.38752156527641757, 0.39248, 0.4036779214735239, 0.41392, 0.41552050559481846, 0.446, 0.4480205018707593}, {674790.0, 669720.0, 665747.8129978245, 655629.7115844343, 655160.0, 653190.0, 650791.6309086063, 645023.1501028114, 639540.0, 633835.0885399593, 631660.0, 626880.3475684567, 622650.0, 621995.7468861304, 610190.0, 609435.345131577}, {2567800.0, 2566800.0, 2566043.5584487454, 2563950.1581563195, 2563900.0, 2563500.0, 2563019.758026353, 2561856.7578638946, 2560700.0, 2559530.757538977, 2559100.0, 2558135.1573440265, 2557100.0, 2556972.157181568, 2554400.0, 2554180.956791667}, {675470.0, 670380.0, 666399.0930888013, 656234.4716689127, 655770.0, 653790.0, 651396.3909930849, 645581.3901807916, 640090.0, 634346.8086114412, 632180.0, 627392.0676399384, 623140.0, 622484.206954363, 610640.0, 609877.2851933113}, {2757500.0, 2756200.0, 2755147.3848645203, 2752588.7845071116, 2752400.0, 2751800.0, 2751193.184312161, 2749564.984084719, 2748100.0, 2746541.1836623265, 2745900.0, 2744680.3834023927, 2743400.0, 2743284.7832074426, 2739800.0, 2739563.1826875745}, {1942.6000000000001, 1930.8000000000002, 1921.6158644291124, 1898.086045142249, 1897.0, 1892.4, 1886.781683563151, 1873.2164496682335, 1860.4, 1846.8814739895201, 1841.8000000000002, 1830.4692156969038, 1820.5, 1818.8717780768661, 1790.8, 1788.9361538951807}, {6749.2, 6759.299999999999, 6767.125785294844, 6787.641108160614, 6788.599999999999, 6792.7, 6797.270749505771, 6809.41247120184, 6820.700000000001, 6832.43987441852, 6837.1, 6847.0936764655, 6856.099999999999, 6857.141997869142, 6882.7, 6883.93752161219}}}, .children = {112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127}, .size = 16, .is_leaf = true},
+    {.min = {{{448.15, 446.09, 444.9555555555556, 444.2611111111111, 443.55999999999995, 443.15, 441.35555555555555, 440.9, 438.7055555555556, 438.15, 438.09999999999997, 437.48888888888894, 435.4333333333334, 435.13, 433.2944444444445, 433.15}, {892600.0, 850000.0, 827370.8751802036, 813719.2557397302, 800000.0, 792180.0, 758423.30224852, 750000.0, 710642.6342068632, 700930.0, 700000.0, 689475.7293168363, 655001.9428509945, 650000.0, 620528.1563851527, 618232.2022065277}, {0.001121, 0.001118, 0.001116836214707227, 0.001115587655495704, 0.001115, 0.001114, 0.0011118419778611353, 0.001111, 0.0011087205798323283, 0.001108, 0.001108, 0.0011074720206208052, 0.0011049749021977595, 0.001104, 0.001101853504168952, 0.001101853504168952}, {0.21659, 0.2269, 0.2327876221923856, 0.23650832864272384, 0.24035, 0.2426, 0.25227138868820037, 0.25552, 0.26891468297780047, 0.27244, 0.27278, 0.2767244208458762, 0.29048978615291604, 0.2926, 0.30572220853349535, 0.306795969455405}, {740020.0, 731000.0, 726084.2614261787, 723037.2010005371, 719970.0, 718200.0, 710383.7592329871, 708400.0, 698870.0576246465, 696460.0, 696230.0, 693590.0368870843, 684681.4556426512, 683370.0, 675423.9743494804, 674795.9542617527}, {2579400.0, 2577900.0, 2576975.7599758566, 2576510.5599108734, 2576000.0, 2575700.0, 2574417.1596184475, 2574000.0, 2572323.759326022, 2571900.0, 2571800.0, 2571393.359196055, 2569765.158968613, 2569400.0, 2567904.358708679, 2567904.358708679}, {741020.0, 731950.0, 726991.4015528965, 723944.3411272549, 720870.0, 719080.0, 711244.3793532064, 709240.0, 699660.8977351184, 697240.0, 697000.0, 694334.3569910577, 685402.5157433755, 684080.0, 676098.5144437064, 675470.4943559786}, {2772700.0, 2770800.0, 2769801.186911499, 2769103.3868140243, 2768300.0, 2767900.0, 2766079.5863916315, 2765700.0, 2763520.9860342224, 2762800.0, 2762800.0, 2762125.3858392723, 2760031.9855468464, 2759600.0, 2757705.9852219294, 2757473.385189438}, {2090.6, 2070.5, 2059.3616036707135, 2052.5371187174064, 2045.7, 2041.7, 2023.9412707228735, 2019.4999999999998, 1997.773767067554, 1992.3, 1991.8, 1985.6739133773344, 1965.3260625349578, 1962.3, 1943.9733795522172, 1942.5079993475194}, {6624.2, 6640.900000000001, 6649.895368919013, 6655.756889737803, 6661.6, 6665.0, 6679.6216530714555, 6683.7, 6701.811696171167, 6706.7, 6707.099999999999, 6712.278697633294, 6729.444580031183, 6732.2, 6747.866502604528, 6749.1225427799845}}}, .max = {{{448.15, 446.09, 444.9555555555556, 444.2611111111111, 443.55999999999995, 443.15, 441.35555555555555, 440.9, 438.7055555555556, 438.15, 438.09999999999997, 437.48888888888894, 435.4333333333334, 435.13, 433.2944444444445, 433.15}, {892600.0, 850000.0, 827370.8751802036, 813719.2557397302, 800000.0, 792180.0, 758423.30224852, 750000.0, 710642.6342068632, 700930.0, 700000.0, 689475.7293168363, 655001.9428509945, 650000.0, 620528.1563851527, 618232.2022065277}, {0.001121, 0.001118, 0.001116836214707227, 0.001115587655495704, 0.001115, 0.001114, 0.0011118419778611353, 0.001111, 0.0011087205798323283, 0.001108, 0.001108, 0.0011074720206208052, 0.0011049749021977595, 0.001104, 0.001101853504168952, 0.001101853504168952}, {0.21659, 0.2269, 0.2327876221923856, 0.23650832864272384, 0.24035, 0.2426, 0.25227138868820037, 0.25552, 0.26891468297780047, 0.27244, 0.27278, 0.2767244208458762, 0.29048978615291604, 0.2926, 0.30572220853349535, 0.306795969455405}, {740020.0, 731000.0, 726084.2614261787, 723037.2010005371, 719970.0, 718200.0, 710383.7592329871, 708400.0, 698870.0576246465, 696460.0, 696230.0, 693590.0368870843, 684681.4556426512, 683370.0, 675423.9743494804, 674795.9542617527}, {2579400.0, 2577900.0, 2576975.7599758566, 2576510.5599108734, 2576000.0, 2575700.0, 2574417.1596184475, 2574000.0, 2572323.759326022, 2571900.0, 2571800.0, 2571393.359196055, 2569765.158968613, 2569400.0, 2567904.358708679, 2567904.358708679}, {741020.0, 731950.0, 726991.4015528965, 723944.3411272549, 720870.0, 719080.0, 711244.3793532064, 709240.0, 699660.8977351184, 697240.0, 697000.0, 694334.3569910577, 685402.5157433755, 684080.0, 676098.5144437064, 675470.4943559786}, {2772700.0, 2770800.0, 2769801.186911499, 2769103.3868140243, 2768300.0, 2767900.0, 2766079.5863916315, 2765700.0, 2763520.9860342224, 2762800.0, 2762800.0, 2762125.3858392723, 2760031.9855468464, 2759600.0, 2757705.9852219294, 2757473.385189438}, {2090.6, 2070.5, 2059.3616036707135, 2052.5371187174064, 2045.7, 2041.7, 2023.9412707228735, 2019.4999999999998, 1997.773767067554, 1992.3, 1991.8, 1985.6739133773344, 1965.3260625349578, 1962.3, 1943.9733795522172, 1942.5079993475194}, {6624.2, 6640.900000000001, 6649.895368919013, 6655.756889737803, 6661.6, 6665.0, 6679.6216530714555, 6683.7, 6701.811696171167, 6706.7, 6707.099999999999, 6712.278697633294, 6729.444580031183, 6732.2, 6747.866502604528, 6749.1225427799845}}}, .children = {128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143}, .size = 16, .is_leaf = true},
+    {.min = {{{462.6333333333333, 461.11, 460.9277777777778, 460.0444444444445, 458.15, 457.33888888888896, 457.21, 455.37222222222226, 454.49444444444447, 453.15, 453.03, 451.5, 450.80999999999995, 449.8166666666667, 448.5, 448.3277777777778}, {1241056.3127703054, 1200000.0, 1195275.1243436676, 1172108.7398386218, 1123500.0, 1103161.1669069382, 1100000.0, 1055104.7085735546, 1034213.5939752546, 1002800.0, 1000000.0, 965266.021043571, 950000.0, 928241.1743792568, 900000.0, 896318.4481118872}, {0.001140558839726162, 0.001138, 0.001138061721303116, 0.0011368131620915932, 0.001134, 0.0011330674844570246, 0.001133, 0.0011305703660339787, 0.0011293218068224558, 0.001127, 0.001127, 0.001124951849582126, 0.001124, 0.0011230790107648414, 0.001121, 0.0011212061719475571}, {0.15808008177091337, 0.16326, 0.1638858821044948, 0.1669885517451292, 0.1739, 0.1769645398451971, 0.17745, 0.18466190738423574, 0.188220301137076, 0.19384, 0.19436, 0.20103051864730087, 0.20411, 0.20866545822576332, 0.21489, 0.2157323033629829}, {803702.8922686684, 796960.0, 796166.6512159364, 792282.2306733245, 783910.0, 780349.8490064989, 779780.0, 771673.8677945575, 767835.9672584439, 761920.0, 761390.0, 754670.8054194121, 751670.0, 747320.6443926735, 741550.0, 740784.583479656}, {2588838.361632935, 2587800.0, 2587675.3614704763, 2587210.1614054926, 2586000.0, 2585581.9611780504, 2585500.0, 2584186.3609831003, 2583721.1609181166, 2582800.0, 2582800.0, 2581627.760625691, 2581300.0, 2580464.7604632326, 2579600.0, 2579534.3603332657}, {805121.7524668679, 798330.0, 797538.9914076376, 793608.0508585274, 785190.0, 781582.629178705, 781030.0, 772883.3879635143, 768998.9674209026, 763050.0, 762510.0, 755764.0255721232, 752740.0, 748344.0845356372, 742560.0, 741808.0236226196}, {2784920.1890234617, 2783800.0, 2783524.5888285115, 2782826.7887310362, 2781400.0, 2780733.3884386104, 2780700.0, 2779105.188211168, 2778407.3881136933, 2777200.0, 2777100.0, 2775848.7877562842, 2775200.0, 2774220.587528842, 2773000.0, 2772824.9873338914}, {2230.4761435735786, 2215.9, 2214.147621292659, 2205.6902841112596, 2187.5, 2179.6902524793345, 2178.5, 2160.6821778241106, 2152.2248406427116, 2139.2000000000003, 2138.1, 2123.1684445838446, 2116.6, 2106.8399223029255, 2094.1, 2092.311724273492}, {6509.6375493265, 6521.7, 6523.035311198024, 6529.734192133787, 6544.7, 6551.086875116526, 6552.0, 6566.159357221991, 6573.276918216237, 6584.1, 6585.0, 6597.141681549889, 6602.7, 6610.539443421412, 6621.3, 6622.681165117481}}}, .max = {{{462.6333333333333, 461.11, 460.9277777777778, 460.0444444444445, 458.15, 457.33888888888896, 457.21, 455.37222222222226, 454.49444444444447, 453.15, 453.03, 451.5, 450.80999999999995, 449.8166666666667, 448.5, 448.3277777777778}, {1241056.3127703054, 1200000.0, 1195275.1243436676, 1172108.7398386218, 1123500.0, 1103161.1669069382, 1100000.0, 1055104.7085735546, 1034213.5939752546, 1002800.0, 1000000.0, 965266.021043571, 950000.0, 928241.1743792568, 900000.0, 896318.4481118872}, {0.001140558839726162, 0.001138, 0.001138061721303116, 0.0011368131620915932, 0.001134, 0.0011330674844570246, 0.001133, 0.0011305703660339787, 0.0011293218068224558, 0.001127, 0.001127, 0.001124951849582126, 0.001124, 0.0011230790107648414, 0.001121, 0.0011212061719475571}, {0.15808008177091337, 0.16326, 0.1638858821044948, 0.1669885517451292, 0.1739, 0.1769645398451971, 0.17745, 0.18466190738423574, 0.188220301137076, 0.19384, 0.19436, 0.20103051864730087, 0.20411, 0.20866545822576332, 0.21489, 0.2157323033629829}, {803702.8922686684, 796960.0, 796166.6512159364, 792282.2306733245, 783910.0, 780349.8490064989, 779780.0, 771673.8677945575, 767835.9672584439, 761920.0, 761390.0, 754670.8054194121, 751670.0, 747320.6443926735, 741550.0, 740784.583479656}, {2588838.361632935, 2587800.0, 2587675.3614704763, 2587210.1614054926, 2586000.0, 2585581.9611780504, 2585500.0, 2584186.3609831003, 2583721.1609181166, 2582800.0, 2582800.0, 2581627.760625691, 2581300.0, 2580464.7604632326, 2579600.0, 2579534.3603332657}, {805121.7524668679, 798330.0, 797538.9914076376, 793608.0508585274, 785190.0, 781582.629178705, 781030.0, 772883.3879635143, 768998.9674209026, 763050.0, 762510.0, 755764.0255721232, 752740.0, 748344.0845356372, 742560.0, 741808.0236226196}, {2784920.1890234617, 2783800.0, 2783524.5888285115, 2782826.7887310362, 2781400.0, 2780733.3884386104, 2780700.0, 2779105.188211168, 2778407.3881136933, 2777200.0, 2777100.0, 2775848.7877562842, 2775200.0, 2774220.587528842, 2773000.0, 2772824.9873338914}, {2230.4761435735786, 2215.9, 2214.147621292659, 2205.6902841112596, 2187.5, 2179.6902524793345, 2178.5, 2160.6821778241106, 2152.2248406427116, 2139.2000000000003, 2138.1, 2123.1684445838446, 2116.6, 2106.8399223029255, 2094.1, 2092.311724273492}, {6509.6375493265, 6521.7, 6523.035311198024, 6529.734192133787, 6544.7, 6551.086875116526, 6552.0, 6566.159357221991, 6573.276918216237, 6584.1, 6585.0, 6597.141681549889, 6602.7, 6610.539443421412, 6621.3, 6622.681165117481}}}, .children = {144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159}, .size = 16, .is_leaf = true},
+    {.min = {{{463.15, 464.75, 465.10555555555555, 466.48333333333335, 467.48333333333335, 468.15, 468.18999999999994, 471.43999999999994, 472.0388888888889, 473.15, 477.59444444444443, 478.1333333333334, 478.15, 478.87, 483.15000000000003, 483.15}, {1255200.0, 1300000.0, 1310003.885701989, 1349579.7925647756, 1378951.4586336727, 1398800.0, 1400000.0, 1500000.0, 1519121.8744037857, 1554900.0, 1704797.6883088094, 1723689.3232920908, 1724300.0, 1750000.0, 1907710.3954467545, 1907700.0}, {0.001141, 0.001144, 0.0011443045173607305, 0.001146177356178015, 0.0011480501949952993, 0.001149, 0.001149, 0.001154, 0.001154917270658675, 0.001157, 0.0011636571851393353, 0.0011642814647450969, 0.001164, 0.001166, 0.0011723970996199958, 0.001173}, {0.15636, 0.15119, 0.15007681722505162, 0.14583795870193142, 0.14284765939033406, 0.14089, 0.14078, 0.13171, 0.13011235543280059, 0.12721, 0.11635947571787592, 0.11511715930241065, 0.11508, 0.11344, 0.10429215093850717, 0.10429}, {806000.0, 813100.0, 814658.3537990288, 820775.7346535613, 825218.3952741532, 828180.0, 828350.0, 842820.0, 845501.1181074319, 850460.0, 870366.0615807977, 872785.1019187117, 872860.0, 876120.0, 895370.5650736585, 895380.0}, {2589000.0, 2589900.0, 2590233.961827885, 2590931.7619253607, 2591396.9619903434, 2591700.0, 2591800.0, 2593400.0, 2593722.962315261, 2594200.0, 2596281.56267267, 2596514.1627051616, 2596400.0, 2596700.0, 2598374.9629650954, 2598300.0}, {807430.0, 814590.0, 816170.2540102251, 822310.8948680066, 826800.075495097, 829780.0, 829960.0, 844550.0, 847245.6183511199, 852260.0, 872343.1618569775, 874785.4621981404, 874870.0, 878160.0, 897603.525385579, 897610.0}, {2785300.0, 2786500.0, 2786780.989283395, 2787711.3894133624, 2788409.189510837, 2788800.0, 2788900.0, 2791000.0, 2791432.98993323, 2792000.0, 2794456.790355623, 2794921.9904206055, 2794800.0, 2795200.0, 2797247.990745523, 2797300.0}, {2235.5, 2250.7999999999997, 2254.1315668779876, 2267.236252708571, 2276.740290036183, 2283.1, 2283.5, 2314.2999999999997, 2319.9480720718466, 2330.5, 2372.3668153941826, 2377.4328441018524, 2377.6000000000004, 2384.3999999999996, 2424.4506146697304, 2424.5}, {6505.9, 6493.599999999999, 6490.796946694671, 6480.329945232543, 6472.793704179811, 6467.8, 6467.5, 6443.0, 6438.461939384032, 6430.2, 6397.012613594006, 6393.244493067639, 6393.0, 6387.7, 6356.40064792095, 6356.3}}}, .max = {{{463.15, 464.75, 465.10555555555555, 466.48333333333335, 467.48333333333335, 468.15, 468.18999999999994, 471.43999999999994, 472.0388888888889, 473.15, 477.59444444444443, 478.1333333333334, 478.15, 478.87, 483.15000000000003, 483.15}, {1255200.0, 1300000.0, 1310003.885701989, 1349579.7925647756, 1378951.4586336727, 1398800.0, 1400000.0, 1500000.0, 1519121.8744037857, 1554900.0, 1704797.6883088094, 1723689.3232920908, 1724300.0, 1750000.0, 1907710.3954467545, 1907700.0}, {0.001141, 0.001144, 0.0011443045173607305, 0.001146177356178015, 0.0011480501949952993, 0.001149, 0.001149, 0.001154, 0.001154917270658675, 0.001157, 0.0011636571851393353, 0.0011642814647450969, 0.001164, 0.001166, 0.0011723970996199958, 0.001173}, {0.15636, 0.15119, 0.15007681722505162, 0.14583795870193142, 0.14284765939033406, 0.14089, 0.14078, 0.13171, 0.13011235543280059, 0.12721, 0.11635947571787592, 0.11511715930241065, 0.11508, 0.11344, 0.10429215093850717, 0.10429}, {806000.0, 813100.0, 814658.3537990288, 820775.7346535613, 825218.3952741532, 828180.0, 828350.0, 842820.0, 845501.1181074319, 850460.0, 870366.0615807977, 872785.1019187117, 872860.0, 876120.0, 895370.5650736585, 895380.0}, {2589000.0, 2589900.0, 2590233.961827885, 2590931.7619253607, 2591396.9619903434, 2591700.0, 2591800.0, 2593400.0, 2593722.962315261, 2594200.0, 2596281.56267267, 2596514.1627051616, 2596400.0, 2596700.0, 2598374.9629650954, 2598300.0}, {807430.0, 814590.0, 816170.2540102251, 822310.8948680066, 826800.075495097, 829780.0, 829960.0, 844550.0, 847245.6183511199, 852260.0, 872343.1618569775, 874785.4621981404, 874870.0, 878160.0, 897603.525385579, 897610.0}, {2785300.0, 2786500.0, 2786780.989283395, 2787711.3894133624, 2788409.189510837, 2788800.0, 2788900.0, 2791000.0, 2791432.98993323, 2792000.0, 2794456.790355623, 2794921.9904206055, 2794800.0, 2795200.0, 2797247.990745523, 2797300.0}, {2235.5, 2250.7999999999997, 2254.1315668779876, 2267.236252708571, 2276.740290036183, 2283.1, 2283.5, 2314.2999999999997, 2319.9480720718466, 2330.5, 2372.3668153941826, 2377.4328441018524, 2377.6000000000004, 2384.3999999999996, 2424.4506146697304, 2424.5}, {6505.9, 6493.599999999999, 6490.796946694671, 6480.329945232543, 6472.793704179811, 6467.8, 6467.5, 6443.0, 6438.461939384032, 6430.2, 6397.012613594006, 6393.244493067639, 6393.0, 6387.7, 6356.40064792095, 6356.3}}}, .children = {160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175}, .size = 16, .is_leaf = true},
+    {.min = {{{485.53, 487.23333333333335, 488.15, 488.7055555555556, 491.55999999999995, 493.15, 494.2611111111111, 495.2277777777778, 497.09999999999997, 498.15, 499.8166666666667, 502.3833333333333, 503.15, 505.37222222222226, 507.0, 508.15}, {2000000.0, 2068427.1879505091, 2105900.0, 2128825.261838664, 2250000.0, 2319600.0, 2369314.3962243763, 2413165.0526089272, 2500000.0, 2549700.0, 2630280.959770799, 2757902.9172673454, 2797100.0, 2912828.113644839, 3000000.0, 3062600.0}, {0.001177, 0.001179888454889133, 0.001181, 0.0011823855733121788, 0.001187, 0.00119, 0.0011923740470043617, 0.0011936226062158849, 0.001197, 0.001199, 0.001202362520696545, 0.0012073567575426366, 0.001209, 0.001213599553600251, 0.001217, 0.001219}, {0.099587, 0.0963575571492792, 0.09468, 0.09367939764056259, 0.088717, 0.086094, 0.08430896075808329, 0.08279820411214059, 0.079952, 0.078405, 0.07602477038962889, 0.07252256180130719, 0.071505, 0.06866451383770146, 0.066667, 0.0653}, {906120.0, 913862.2676567509, 918020.0, 920537.8885892634, 933540.0, 940790.0, 945868.0321276126, 950287.4327449555, 958870.0, 963700.0, 971360.9956887062, 983200.337342535, 986760.0, 997063.299279042, 1004600.0, 1010000.0}, {2599100.0, 2599770.563160046, 2599900.0, 2600003.1631925376, 2600900.0, 2601300.0, 2601398.763387488, 2601631.36341998, 2602100.0, 2602300.0, 2602561.7635499467, 2602794.3635824383, 2602900.0, 2603026.96361493, 2603200.0, 2603200.0}, {908470.0, 916304.567997914, 920500.0, 923049.9689401741, 936210.0, 943550.0, 948682.4925207626, 953171.673147853, 961870.0, 966760.0, 974524.3561305937, 986526.5178071668, 990140.0, 1000598.8197729164, 1008300.0, 1013700.0}, {2798300.0, 2798876.190972965, 2799300.0, 2799573.99107044, 2800500.0, 2801000.0, 2801202.1912978827, 2801434.7913303743, 2801900.0, 2802200.0, 2802365.191460341, 2802830.391525325, 2802900.0, 2803062.991557816, 2803200.0, 2803200.0}, {2446.7, 2462.592367997724, 2471.2000000000003, 2476.283205910187, 2502.9, 2517.6, 2527.864589115553, 2536.7824743612855, 2554.2, 2563.8999999999996, 2579.194764285827, 2602.850187590236, 2610.0, 2630.3993354385566, 2645.4, 2656.0}, {6339.0, 6326.674363768508, 6320.0, 6315.788682247894, 6295.4, 6284.0, 6276.014076691809, 6268.896515697562, 6255.8, 6248.3, 6236.239471135724, 6218.236228620864, 6212.799999999999, 6196.883545638123, 6185.6, 6177.5}}}, .max = {{{485.53, 487.23333333333335, 488.15, 488.7055555555556, 491.55999999999995, 493.15, 494.2611111111111, 495.2277777777778, 497.09999999999997, 498.15, 499.8166666666667, 502.3833333333333, 503.15, 505.37222222222226, 507.0, 508.15}, {2000000.0, 2068427.1879505091, 2105900.0, 2128825.261838664, 2250000.0, 2319600.0, 2369314.3962243763, 2413165.0526089272, 2500000.0, 2549700.0, 2630280.959770799, 2757902.9172673454, 2797100.0, 2912828.113644839, 3000000.0, 3062600.0}, {0.001177, 0.001179888454889133, 0.001181, 0.0011823855733121788, 0.001187, 0.00119, 0.0011923740470043617, 0.0011936226062158849, 0.001197, 0.001199, 0.001202362520696545, 0.0012073567575426366, 0.001209, 0.001213599553600251, 0.001217, 0.001219}, {0.099587, 0.0963575571492792, 0.09468, 0.09367939764056259, 0.088717, 0.086094, 0.08430896075808329, 0.08279820411214059, 0.079952, 0.078405, 0.07602477038962889, 0.07252256180130719, 0.071505, 0.06866451383770146, 0.066667, 0.0653}, {906120.0, 913862.2676567509, 918020.0, 920537.8885892634, 933540.0, 940790.0, 945868.0321276126, 950287.4327449555, 958870.0, 963700.0, 971360.9956887062, 983200.337342535, 986760.0, 997063.299279042, 1004600.0, 1010000.0}, {2599100.0, 2599770.563160046, 2599900.0, 2600003.1631925376, 2600900.0, 2601300.0, 2601398.763387488, 2601631.36341998, 2602100.0, 2602300.0, 2602561.7635499467, 2602794.3635824383, 2602900.0, 2603026.96361493, 2603200.0, 2603200.0}, {908470.0, 916304.567997914, 920500.0, 923049.9689401741, 936210.0, 943550.0, 948682.4925207626, 953171.673147853, 961870.0, 966760.0, 974524.3561305937, 986526.5178071668, 990140.0, 1000598.8197729164, 1008300.0, 1013700.0}, {2798300.0, 2798876.190972965, 2799300.0, 2799573.99107044, 2800500.0, 2801000.0, 2801202.1912978827, 2801434.7913303743, 2801900.0, 2802200.0, 2802365.191460341, 2802830.391525325, 2802900.0, 2803062.991557816, 2803200.0, 2803200.0}, {2446.7, 2462.592367997724, 2471.2000000000003, 2476.283205910187, 2502.9, 2517.6, 2527.864589115553, 2536.7824743612855, 2554.2, 2563.8999999999996, 2579.194764285827, 2602.850187590236, 2610.0, 2630.3993354385566, 2645.4, 2656.0}, {6339.0, 6326.674363768508, 6320.0, 6315.788682247894, 6295.4, 6284.0, 6276.014076691809, 6268.896515697562, 6255.8, 6248.3, 6236.239471135724, 6218.236228620864, 6212.799999999999, 6196.883545638123, 6185.6, 6177.5}}}, .children = {176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191}, .size = 16, .is_leaf = true},
+    {.min = {{{533.15, 533.15, 528.15, 527.5944444444444, 525.5055555555556, 523.5, 523.15, 522.0388888888889, 520.3555555555556, 518.15, 516.4833333333333, 515.71, 514.838888888889, 513.15, 510.9277777777778, 508.8777777777778}, {4692300.0, 4692296.023438661, 4322900.0, 4283299.020807914, 4136854.3759010183, 4000000.0, 3976200.0, 3902156.8376415675, 3792116.5112426, 3651200.0, 3547490.522480986, 3500000.0, 3447378.6465841816, 3347000.0, 3218127.9665863337, 3102640.7819257635}, {0.001276, 0.0012760275141763956, 0.001263, 0.0012622933628496438, 0.0012572991260035523, 0.001252, 0.001252, 0.0012491834911286534, 0.0012454378134940847, 0.00124, 0.0012366978990134246, 0.001235, 0.0012329522213788558, 0.001229, 0.001224836586503957, 0.001220466629263627}, {0.042175, 0.04217508160603177, 0.045941, 0.046381477589652394, 0.048082015235746574, 0.049779, 0.050085, 0.051062326073651715, 0.05258182263407508, 0.054656, 0.056283800696240456, 0.057061, 0.057945008727171655, 0.059707, 0.06212206356932149, 0.06445062649881168}, {1128800.0, 1128854.4776888553, 1104700.0, 1101989.1739360606, 1091964.1125356671, 1082400.0, 1080700.0, 1075402.9902222562, 1067401.5491045406, 1056900.0, 1049049.4065409433, 1045400.0000000001, 1041303.8254589688, 1033400.0000000001, 1022951.6828953715, 1013368.5615567123}, {2598700.0, 2598840.163030079, 2600500.0, 2600700.9632900124, 2601166.163354996, 2601700.0, 2601800.0, 2602096.5634849635, 2602329.1635174546, 2602700.0, 2602794.3635824383, 2603000.0, 2603026.96361493, 2603100.0, 2603259.563647422, 2603259.563647422}, {1134800.0, 1134832.2985238926, 1110100.0, 1107385.4946898688, 1097174.3532634818, 1087400.0, 1085700.0, 1080264.3309013331, 1072123.3297641228, 1061500.0, 1053445.5471550368, 1049700.0, 1045560.4060535673, 1037500.0, 1026882.6234444816, 1017159.9420863274}, {2796600.0, 2796550.1906480477, 2799100.0, 2799341.391037949, 2800271.791167916, 2800800.0, 2801000.0, 2801202.1912978827, 2801667.391362866, 2802200.0, 2802597.7914928333, 2802700.0, 2802830.391525325, 2803000.0, 2803062.991557816, 2803295.591590308}, {2884.7, 2884.663734956564, 2839.0, 2833.87784386232, 2814.827901201247, 2796.6000000000004, 2793.2999999999997, 2783.1338207739245, 2767.7682626275214, 2747.6, 2732.306061673832, 2725.2999999999997, 2717.2335795683684, 2701.8, 2681.3945665620427, 2662.595831936061}, {6001.7, 6001.359958325576, 6036.900000000001, 6040.715883823177, 6055.369685870155, 6069.6, 6072.099999999999, 6079.653129262291, 6091.79485095836, 6107.2, 6119.009054759892, 6124.4, 6130.3134163389905, 6142.400000000001, 6157.946300199008, 6172.181422187501}}}, .max = {{{533.15, 533.15, 528.15, 527.5944444444444, 525.5055555555556, 523.5, 523.15, 522.0388888888889, 520.3555555555556, 518.15, 516.4833333333333, 515.71, 514.838888888889, 513.15, 510.9277777777778, 508.8777777777778}, {4692300.0, 4692296.023438661, 4322900.0, 4283299.020807914, 4136854.3759010183, 4000000.0, 3976200.0, 3902156.8376415675, 3792116.5112426, 3651200.0, 3547490.522480986, 3500000.0, 3447378.6465841816, 3347000.0, 3218127.9665863337, 3102640.7819257635}, {0.001276, 0.0012760275141763956, 0.001263, 0.0012622933628496438, 0.0012572991260035523, 0.001252, 0.001252, 0.0012491834911286534, 0.0012454378134940847, 0.00124, 0.0012366978990134246, 0.001235, 0.0012329522213788558, 0.001229, 0.001224836586503957, 0.001220466629263627}, {0.042175, 0.04217508160603177, 0.045941, 0.046381477589652394, 0.048082015235746574, 0.049779, 0.050085, 0.051062326073651715, 0.05258182263407508, 0.054656, 0.056283800696240456, 0.057061, 0.057945008727171655, 0.059707, 0.06212206356932149, 0.06445062649881168}, {1128800.0, 1128854.4776888553, 1104700.0, 1101989.1739360606, 1091964.1125356671, 1082400.0, 1080700.0, 1075402.9902222562, 1067401.5491045406, 1056900.0, 1049049.4065409433, 1045400.0000000001, 1041303.8254589688, 1033400.0000000001, 1022951.6828953715, 1013368.5615567123}, {2598700.0, 2598840.163030079, 2600500.0, 2600700.9632900124, 2601166.163354996, 2601700.0, 2601800.0, 2602096.5634849635, 2602329.1635174546, 2602700.0, 2602794.3635824383, 2603000.0, 2603026.96361493, 2603100.0, 2603259.563647422, 2603259.563647422}, {1134800.0, 1134832.2985238926, 1110100.0, 1107385.4946898688, 1097174.3532634818, 1087400.0, 1085700.0, 1080264.3309013331, 1072123.3297641228, 1061500.0, 1053445.5471550368, 1049700.0, 1045560.4060535673, 1037500.0, 1026882.6234444816, 1017159.9420863274}, {2796600.0, 2796550.1906480477, 2799100.0, 2799341.391037949, 2800271.791167916, 2800800.0, 2801000.0, 2801202.1912978827, 2801667.391362866, 2802200.0, 2802597.7914928333, 2802700.0, 2802830.391525325, 2803000.0, 2803062.991557816, 2803295.591590308}, {2884.7, 2884.663734956564, 2839.0, 2833.87784386232, 2814.827901201247, 2796.6000000000004, 2793.2999999999997, 2783.1338207739245, 2767.7682626275214, 2747.6, 2732.306061673832, 2725.2999999999997, 2717.2335795683684, 2701.8, 2681.3945665620427, 2662.595831936061}, {6001.7, 6001.359958325576, 6036.900000000001, 6040.715883823177, 6055.369685870155, 6069.6, 6072.099999999999, 6079.653129262291, 6091.79485095836, 6107.2, 6119.009054759892, 6124.4, 6130.3134163389905, 6142.400000000001, 6157.946300199008, 6172.181422187501}}}, .children = {192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207}, .size = 16, .is_leaf = true},
+    {.min = {{{558.98, 558.15, 557.9555555555555, 555.3722222222223, 553.15, 550.9388888888889, 549.8166666666667, 548.74, 548.15, 544.2611111111112, 543.3000000000001, 543.15, 538.7055555555556, 538.15, 537.0899999999999, 534.8888888888889}, {7000000.0, 6914600.0, 6894757.293168363, 6634411.257778326, 6416600.0, 6205281.563851527, 6100067.567557778, 6000000.0, 5946400.0, 5599301.345354959, 5515805.834534691, 5503000.0, 5130457.849419511, 5085300.0, 5000000.0, 4826330.1052178545}, {0.001352, 0.001349, 0.001347819668838962, 0.001339704033964063, 0.001333, 0.0013259698826373113, 0.0013222242050027427, 0.001319, 0.001317, 0.0013059929352529451, 0.0013028715372241377, 0.001303, 0.001290385945108909, 0.001289, 0.001286, 0.0012803974714167257}, {0.027378, 0.027756, 0.02784536753538354, 0.029062088487012597, 0.030153, 0.03128077820588877, 0.03187009815372758, 0.032449, 0.032767, 0.03496527643909283, 0.03553399515994151, 0.035622, 0.03838632867866556, 0.038748, 0.039448, 0.04094587506228748}, {1258000.0, 1253700.0, 1252737.2549939498, 1239479.053141921, 1228200.0, 1216940.109993473, 1211287.9292039238, 1205800.0, 1202900.0, 1183468.965317913, 1178677.4046485834, 1177900.0, 1155998.90148064, 1153300.0, 1148100.0, 1137321.118871554}, {2581000.0, 2581800.0, 2582092.9606906744, 2584418.961015592, 2586400.0, 2588140.5615354595, 2589070.9616654264, 2589900.0, 2590300.0, 2593025.1622177856, 2593490.3622827693, 2593700.0, 2596281.56267267, 2596500.0, 2597000.0, 2597909.762900112}, {1267500.0, 1263100.0, 1262017.9962903697, 1248364.3743831052, 1236700.0, 1225174.1511436799, 1219359.1503313868, 1213800.0, 1210700.0, 1190772.6063381534, 1185864.7456525778, 1185100.0, 1162628.0024066542, 1159800.0, 1154500.0, 1143508.279735834}, {2772600.0, 2773700.0, 2773987.98749635, 2777244.3879512344, 2779900.0, 2782361.5886660526, 2783524.5888285115, 2784600.0, 2785200.0, 2788874.389575821, 2789572.189673296, 2789700.0, 2793061.190160672, 2793500.0, 2794200.0, 2795619.7905180813}, {3122.0, 3114.3999999999996, 3112.5094227841614, 3088.6027914446613, 3068.1, 3047.6977497306657, 3037.3563522860836, 3027.5, 3022.1, 2986.319253156749, 2977.526971928561, 2976.2, 2935.4496260508076, 2930.4, 2920.7000000000003, 2900.573577178998}, {5814.8, 5821.0, 5822.164893293949, 5841.4241759842635, 5857.9, 5874.0812205461025, 5882.03614165732, 5890.2, 5894.4, 5922.229427271891, 5929.346988266137, 5930.5, 5962.004032827976, 5966.2, 5973.7, 5989.218236629508}}}, .max = {{{558.98, 558.15, 557.9555555555555, 555.3722222222223, 553.15, 550.9388888888889, 549.8166666666667, 548.74, 548.15, 544.2611111111112, 543.3000000000001, 543.15, 538.7055555555556, 538.15, 537.0899999999999, 534.8888888888889}, {7000000.0, 6914600.0, 6894757.293168363, 6634411.257778326, 6416600.0, 6205281.563851527, 6100067.567557778, 6000000.0, 5946400.0, 5599301.345354959, 5515805.834534691, 5503000.0, 5130457.849419511, 5085300.0, 5000000.0, 4826330.1052178545}, {0.001352, 0.001349, 0.001347819668838962, 0.001339704033964063, 0.001333, 0.0013259698826373113, 0.0013222242050027427, 0.001319, 0.001317, 0.0013059929352529451, 0.0013028715372241377, 0.001303, 0.001290385945108909, 0.001289, 0.001286, 0.0012803974714167257}, {0.027378, 0.027756, 0.02784536753538354, 0.029062088487012597, 0.030153, 0.03128077820588877, 0.03187009815372758, 0.032449, 0.032767, 0.03496527643909283, 0.03553399515994151, 0.035622, 0.03838632867866556, 0.038748, 0.039448, 0.04094587506228748}, {1258000.0, 1253700.0, 1252737.2549939498, 1239479.053141921, 1228200.0, 1216940.109993473, 1211287.9292039238, 1205800.0, 1202900.0, 1183468.965317913, 1178677.4046485834, 1177900.0, 1155998.90148064, 1153300.0, 1148100.0, 1137321.118871554}, {2581000.0, 2581800.0, 2582092.9606906744, 2584418.961015592, 2586400.0, 2588140.5615354595, 2589070.9616654264, 2589900.0, 2590300.0, 2593025.1622177856, 2593490.3622827693, 2593700.0, 2596281.56267267, 2596500.0, 2597000.0, 2597909.762900112}, {1267500.0, 1263100.0, 1262017.9962903697, 1248364.3743831052, 1236700.0, 1225174.1511436799, 1219359.1503313868, 1213800.0, 1210700.0, 1190772.6063381534, 1185864.7456525778, 1185100.0, 1162628.0024066542, 1159800.0, 1154500.0, 1143508.279735834}, {2772600.0, 2773700.0, 2773987.98749635, 2777244.3879512344, 2779900.0, 2782361.5886660526, 2783524.5888285115, 2784600.0, 2785200.0, 2788874.389575821, 2789572.189673296, 2789700.0, 2793061.190160672, 2793500.0, 2794200.0, 2795619.7905180813}, {3122.0, 3114.3999999999996, 3112.5094227841614, 3088.6027914446613, 3068.1, 3047.6977497306657, 3037.3563522860836, 3027.5, 3022.1, 2986.319253156749, 2977.526971928561, 2976.2, 2935.4496260508076, 2930.4, 2920.7000000000003, 2900.573577178998}, {5814.8, 5821.0, 5822.164893293949, 5841.4241759842635, 5857.9, 5874.0812205461025, 5882.03614165732, 5890.2, 5894.4, 5922.229427271891, 5929.346988266137, 5930.5, 5962.004032827976, 5966.2, 5973.7, 5989.218236629508}}}, .children = {208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223}, .size = 16, .is_leaf = true},
+    {.min = {{{588.15, 584.15, 583.15, 583.15, 581.5611111111111, 578.15, 577.5944444444444, 576.5, 573.15, 572.0388888888889, 570.5166666666667, 568.16, 568.15, 566.4833333333333, 563.15, 560.9277777777778}, {10556000.0, 10000000.0, 9865000.0, 9865018.735065294, 9652660.210435709, 9209400.0, 9139000.792094667, 9000000.0, 8587900.0, 8454351.392883047, 8273708.751802037, 8000000.0, 7999000.0, 7809691.585971805, 7441800.0, 7203642.419902306}, {0.001472, 0.001452, 0.001447, 0.0014477044057607932, 0.001440213050491656, 0.001425, 0.0014227332215303356, 0.001418, 0.001404, 0.001399634876117162, 0.0013933920800595476, 0.001384, 0.001384, 0.0013777850899155113, 0.001366, 0.0013584324221369067}, {0.016849, 0.018028, 0.018333, 0.018333219182396384, 0.01882889718937097, 0.019932, 0.020117410295662597, 0.020489, 0.021659, 0.022061416988003738, 0.022624517192400564, 0.023525, 0.023528, 0.02418459192719842, 0.025554, 0.026510033458659807}, {1416100.0, 1393300.0, 1387700.0, 1387715.0538488997, 1378829.7326077155, 1360000.0, 1356918.8095469947, 1350900.0, 1332700.0, 1326750.5853328176, 1318586.324192358, 1306000.0, 1306000.0, 1297163.8611998695, 1279700.0, 1268088.8571384037}, {2537200.0, 2545200.0, 2547100.0, 2546970.3557844236, 2549994.156206816, 2555800.0, 2556739.5571490764, 2558500.0, 2563600.0, 2565113.1583187785, 2567439.1586436955, 2570500.0, 2570500.0, 2572556.3593585137, 2576500.0, 2579069.160268282}, {1431600.0, 1407800.0, 1402000.0, 1401996.6958438917, 1392715.9545474716, 1373100.0, 1369897.8913600333, 1363700.0, 1344800.0, 1338589.9269866466, 1330123.2858039476, 1317100.0, 1317100.0, 1307933.2427042366, 1289800.0, 1277881.3185063056}, {2715000.0, 2725500.0, 2727900.0, 2727933.181062988, 2731654.781582856, 2739400.0, 2740493.5828175414, 2742900.0, 2749600.0, 2751658.3843771443, 2754449.5847670455, 2758700.0, 2758700.0, 2761427.585741797, 2766700.0, 2770033.786943991}, {3399.4, 3360.3, 3350.6, 3350.5290360329464, 3335.1216098806945, 3302.4, 3297.021724558549, 3286.6, 3254.7999999999997, 3244.1843011777282, 3229.823575171689, 3207.7, 3207.6, 3191.9330298787863, 3160.8, 3140.10043863833}, {5581.599999999999, 5615.9, 5624.3, 5624.129225630491, 5637.526987502015, 5665.7, 5670.184032063854, 5679.1, 5705.9, 5714.564118263275, 5726.287159900858, 5745.0, 5745.0, 5757.688164287241, 5783.400000000001, 5799.974850194238}}}, .max = {{{588.15, 584.15, 583.15, 583.15, 581.5611111111111, 578.15, 577.5944444444444, 576.5, 573.15, 572.0388888888889, 570.5166666666667, 568.16, 568.15, 566.4833333333333, 563.15, 560.9277777777778}, {10556000.0, 10000000.0, 9865000.0, 9865018.735065294, 9652660.210435709, 9209400.0, 9139000.792094667, 9000000.0, 8587900.0, 8454351.392883047, 8273708.751802037, 8000000.0, 7999000.0, 7809691.585971805, 7441800.0, 7203642.419902306}, {0.001472, 0.001452, 0.001447, 0.0014477044057607932, 0.001440213050491656, 0.001425, 0.0014227332215303356, 0.001418, 0.001404, 0.001399634876117162, 0.0013933920800595476, 0.001384, 0.001384, 0.0013777850899155113, 0.001366, 0.0013584324221369067}, {0.016849, 0.018028, 0.018333, 0.018333219182396384, 0.01882889718937097, 0.019932, 0.020117410295662597, 0.020489, 0.021659, 0.022061416988003738, 0.022624517192400564, 0.023525, 0.023528, 0.02418459192719842, 0.025554, 0.026510033458659807}, {1416100.0, 1393300.0, 1387700.0, 1387715.0538488997, 1378829.7326077155, 1360000.0, 1356918.8095469947, 1350900.0, 1332700.0, 1326750.5853328176, 1318586.324192358, 1306000.0, 1306000.0, 1297163.8611998695, 1279700.0, 1268088.8571384037}, {2537200.0, 2545200.0, 2547100.0, 2546970.3557844236, 2549994.156206816, 2555800.0, 2556739.5571490764, 2558500.0, 2563600.0, 2565113.1583187785, 2567439.1586436955, 2570500.0, 2570500.0, 2572556.3593585137, 2576500.0, 2579069.160268282}, {1431600.0, 1407800.0, 1402000.0, 1401996.6958438917, 1392715.9545474716, 1373100.0, 1369897.8913600333, 1363700.0, 1344800.0, 1338589.9269866466, 1330123.2858039476, 1317100.0, 1317100.0, 1307933.2427042366, 1289800.0, 1277881.3185063056}, {2715000.0, 2725500.0, 2727900.0, 2727933.181062988, 2731654.781582856, 2739400.0, 2740493.5828175414, 2742900.0, 2749600.0, 2751658.3843771443, 2754449.5847670455, 2758700.0, 2758700.0, 2761427.585741797, 2766700.0, 2770033.786943991}, {3399.4, 3360.3, 3350.6, 3350.5290360329464, 3335.1216098806945, 3302.4, 3297.021724558549, 3286.6, 3254.7999999999997, 3244.1843011777282, 3229.823575171689, 3207.7, 3207.6, 3191.9330298787863, 3160.8, 3140.10043863833}, {5581.599999999999, 5615.9, 5624.3, 5624.129225630491, 5637.526987502015, 5665.7, 5670.184032063854, 5679.1, 5705.9, 5714.564118263275, 5726.287159900858, 5745.0, 5745.0, 5757.688164287241, 5783.400000000001, 5799.974850194238}}}, .children = {224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239}, .size = 16, .is_leaf = true},
+    {.min = {{{610.9277777777778, 609.8199999999999, 608.6222222222223, 608.15, 605.3722222222223, 604.0, 603.15, 600.4111111111112, 599.8166666666667, 598.15, 597.8299999999999, 594.2611111111112, 593.15, 591.4444444444445, 591.23, 588.7055555555556}, {14198373.693821613, 14000000.0, 13789514.586336726, 13707000.0, 13230349.769860774, 13000000.0, 12858000.0, 12410563.127703054, 12315415.47705733, 12051000.0, 12000000.0, 11451502.388223335, 11284000.0, 11031611.669069381, 11000000.0, 10635163.1247122}, {0.0016187570177394297, 0.00161, 0.0016000286295665862, 0.001597, 0.0015756817249418897, 0.001566, 0.00156, 0.0015419706262307716, 0.0015382249485962028, 0.001528, 0.001526, 0.0015051381294908463, 0.001499, 0.0014895311393468102, 0.001488, 0.0014745484288085353}, {0.011248894216215496, 0.011487, 0.011745820782401608, 0.011848, 0.0124681122862676, 0.012781, 0.012979, 0.013628648073378128, 0.01377223238270326, 0.014183, 0.014264, 0.015175612936454991, 0.01547, 0.015929118420609057, 0.015988, 0.01669136381924378}, {1555768.5773241732, 1548400.0, 1540579.7952024634, 1537500.0, 1519692.3122847062, 1511000.0, 1505700.0, 1488709.987956808, 1485081.427449937, 1475000.0, 1473000.0, 1451680.0627841249, 1445100.0, 1435118.9404707137, 1433900.0, 1419278.878258027}, {2473003.545452054, 2477100.0, 2481377.1466217563, 2483000.0, 2492309.3481488675, 2496600.0, 2499200.0, 2507195.7502283384, 2508823.95045578, 2513400.0, 2514300.0, 2523245.1524702674, 2526000.0, 2529990.553412528, 2530400.0, 2536038.1542573124}, {1578749.4605343558, 1571000.0, 1562653.5382859285, 1559400.0, 1540556.5351992142, 1531400.0, 1525800.0, 1507852.9706308772, 1504038.330098013, 1493400.0, 1491300.0, 1468915.7251917617, 1462000.0, 1451563.7627678788, 1450200.0, 1434956.1204479695}, {2632799.767773872, 2637900.0, 2643266.7692359993, 2645400.0, 2657222.771185503, 2662700.0, 2666000.0, 2676295.973849824, 2678389.37414225, 2684300.0, 2685400.0, 2696997.376741588, 2700600.0, 2705603.5779437823, 2706300.0, 2713511.979048501}, {3635.315211814519, 3623.2000000000003, 3610.026936282018, 3605.0, 3575.0671513985117, 3560.6, 3551.6, 3522.941484117115, 3516.8287552632323, 3499.8, 3496.4, 3460.181343350197, 3449.1, 3432.004175414149, 3429.9, 3404.8318396184654}, {5360.360788784872, 5372.8, 5385.481592293979, 5390.7, 5419.394677031272, 5433.6, 5442.2, 5469.217603991001, 5474.660444751307, 5490.8, 5493.9, 5526.995452061946, 5537.200000000001, 5552.534935629537, 5554.400000000001, 5576.39969896319}}}, .max = {{{610.9277777777778, 609.8199999999999, 608.6222222222223, 608.15, 605.3722222222223, 604.0, 603.15, 600.4111111111112, 599.8166666666667, 598.15, 597.8299999999999, 594.2611111111112, 593.15, 591.4444444444445, 591.23, 588.7055555555556}, {14198373.693821613, 14000000.0, 13789514.586336726, 13707000.0, 13230349.769860774, 13000000.0, 12858000.0, 12410563.127703054, 12315415.47705733, 12051000.0, 12000000.0, 11451502.388223335, 11284000.0, 11031611.669069381, 11000000.0, 10635163.1247122}, {0.0016187570177394297, 0.00161, 0.0016000286295665862, 0.001597, 0.0015756817249418897, 0.001566, 0.00156, 0.0015419706262307716, 0.0015382249485962028, 0.001528, 0.001526, 0.0015051381294908463, 0.001499, 0.0014895311393468102, 0.001488, 0.0014745484288085353}, {0.011248894216215496, 0.011487, 0.011745820782401608, 0.011848, 0.0124681122862676, 0.012781, 0.012979, 0.013628648073378128, 0.01377223238270326, 0.014183, 0.014264, 0.015175612936454991, 0.01547, 0.015929118420609057, 0.015988, 0.01669136381924378}, {1555768.5773241732, 1548400.0, 1540579.7952024634, 1537500.0, 1519692.3122847062, 1511000.0, 1505700.0, 1488709.987956808, 1485081.427449937, 1475000.0, 1473000.0, 1451680.0627841249, 1445100.0, 1435118.9404707137, 1433900.0, 1419278.878258027}, {2473003.545452054, 2477100.0, 2481377.1466217563, 2483000.0, 2492309.3481488675, 2496600.0, 2499200.0, 2507195.7502283384, 2508823.95045578, 2513400.0, 2514300.0, 2523245.1524702674, 2526000.0, 2529990.553412528, 2530400.0, 2536038.1542573124}, {1578749.4605343558, 1571000.0, 1562653.5382859285, 1559400.0, 1540556.5351992142, 1531400.0, 1525800.0, 1507852.9706308772, 1504038.330098013, 1493400.0, 1491300.0, 1468915.7251917617, 1462000.0, 1451563.7627678788, 1450200.0, 1434956.1204479695}, {2632799.767773872, 2637900.0, 2643266.7692359993, 2645400.0, 2657222.771185503, 2662700.0, 2666000.0, 2676295.973849824, 2678389.37414225, 2684300.0, 2685400.0, 2696997.376741588, 2700600.0, 2705603.5779437823, 2706300.0, 2713511.979048501}, {3635.315211814519, 3623.2000000000003, 3610.026936282018, 3605.0, 3575.0671513985117, 3560.6, 3551.6, 3522.941484117115, 3516.8287552632323, 3499.8, 3496.4, 3460.181343350197, 3449.1, 3432.004175414149, 3429.9, 3404.8318396184654}, {5360.360788784872, 5372.8, 5385.481592293979, 5390.7, 5419.394677031272, 5433.6, 5442.2, 5469.217603991001, 5474.660444751307, 5490.8, 5493.9, 5526.995452061946, 5537.200000000001, 5552.534935629537, 5554.400000000001, 5576.39969896319}}}, .children = {240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255}, .size = 16, .is_leaf = true},
+    {.min = {{{628.15, 627.5944444444444, 626.5777777777778, 625.44, 623.15, 622.0388888888889, 620.51, 618.15, 616.4833333333333, 615.31, 613.15, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {17570000.0, 17452009.66046776, 17236893.232920907, 17000000.0, 16529000.0, 16305411.522613864, 16000000.0, 15541000.0, 15222245.151857113, 15000000.0, 14601000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.001808, 0.0018004223830160105, 0.0017854396724777356, 0.00177, 0.001741, 0.0017273816691419212, 0.00171, 0.001685, 0.0016686993862003452, 0.001657, 0.001638, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.007872, 0.00797454768399671, 0.008163080124936667, 0.008374, 0.008806, 0.009017094625618328, 0.009312, 0.009772, 0.010103341139643243, 0.010341, 0.010783, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1682200.0, 1677581.2143400912, 1669300.6531833855, 1660200.0, 1642400.0, 1633968.7082478923, 1622600.0, 1605500.0, 1593682.3826203248, 1585500.0, 1570700.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2388600.0, 2392291.334177424, 2398571.5350547014, 2405400.0, 2418300.0, 2424157.5386287915, 2432000.0, 2443200.0, 2450673.942332848, 2455700.0, 2464500.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1714000.0, 1709005.4787297237, 1700073.6374820413, 1690300.0, 1671200.0, 1662136.5721826404, 1649900.0, 1631700.0, 1619082.3061684216, 1610300.0, 1594600.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2526900.0, 2531386.153607478, 2539294.554712197, 2547700.0, 2563900.0, 2571160.7591635636, 2581000.0, 2595100.0, 2604422.5638098805, 2610800.0, 2622000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3844.2, 3836.6165839341597, 3823.009482033394, 3808.2, 3778.7999999999997, 3764.854821909812, 3746.1000000000004, 3717.9, 3698.2846926106795, 3684.8, 3660.2000000000003, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {5138.4, 5146.833958957465, 5162.325121121415, 5179.1, 5211.400000000001, 5226.383170069636, 5246.6, 5276.5, 5296.721419895134, 5310.8, 5335.8, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .max = {{{628.15, 627.5944444444444, 626.5777777777778, 625.44, 623.15, 622.0388888888889, 620.51, 618.15, 616.4833333333333, 615.31, 613.15, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {17570000.0, 17452009.66046776, 17236893.232920907, 17000000.0, 16529000.0, 16305411.522613864, 16000000.0, 15541000.0, 15222245.151857113, 15000000.0, 14601000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.001808, 0.0018004223830160105, 0.0017854396724777356, 0.00177, 0.001741, 0.0017273816691419212, 0.00171, 0.001685, 0.0016686993862003452, 0.001657, 0.001638, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {0.007872, 0.00797454768399671, 0.008163080124936667, 0.008374, 0.008806, 0.009017094625618328, 0.009312, 0.009772, 0.010103341139643243, 0.010341, 0.010783, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1682200.0, 1677581.2143400912, 1669300.6531833855, 1660200.0, 1642400.0, 1633968.7082478923, 1622600.0, 1605500.0, 1593682.3826203248, 1585500.0, 1570700.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2388600.0, 2392291.334177424, 2398571.5350547014, 2405400.0, 2418300.0, 2424157.5386287915, 2432000.0, 2443200.0, 2450673.942332848, 2455700.0, 2464500.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {1714000.0, 1709005.4787297237, 1700073.6374820413, 1690300.0, 1671200.0, 1662136.5721826404, 1649900.0, 1631700.0, 1619082.3061684216, 1610300.0, 1594600.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {2526900.0, 2531386.153607478, 2539294.554712197, 2547700.0, 2563900.0, 2571160.7591635636, 2581000.0, 2595100.0, 2604422.5638098805, 2610800.0, 2622000.0, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {3844.2, 3836.6165839341597, 3823.009482033394, 3808.2, 3778.7999999999997, 3764.854821909812, 3746.1000000000004, 3717.9, 3698.2846926106795, 3684.8, 3660.2000000000003, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}, {5138.4, 5146.833958957465, 5162.325121121415, 5179.1, 5211.400000000001, 5226.383170069636, 5246.6, 5276.5, 5296.721419895134, 5310.8, 5335.8, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf, logngine::core::inf}}}, .children = {256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 0, 0, 0, 0, 0}, .size = 11, .is_leaf = true},
+    {.min = {{{647.0944444444444, 647.0944444444444, 647.0999999999999, 647.0999999999999, 646.8599999999999, 644.2611111111112, 643.15, 642.98, 641.7111111111111, 638.9, 638.7055555555556, 638.15, 634.62, 633.15, 633.15, 630.14}, {22063912.81386808, 22063912.81386808, 22064000.0, 22064000.0, 22000000.0, 21325484.30776975, 21044000.0, 21000000.0, 20684271.87950509, 20000000.0, 19954117.08215856, 19822000.0, 19000000.0, 18666000.0, 18666176.419794712, 18000000.0}, {0.0031057910386631943, 0.0031057910386631943, 0.003106, 0.003106, 0.002703, 0.0022911061531445073, 0.002217, 0.002207, 0.002143151886579044, 0.002038, 0.002032030116753507, 0.002015, 0.001926, 0.001895, 0.0018946886034859887, 0.00184}, {0.0031057910386631943, 0.0031057910386631943, 0.003106, 0.003106, 0.003644, 0.004670860010307139, 0.004953, 0.004994, 0.005281405464741833, 0.005862, 0.005900066554051426, 0.006009, 0.006677, 0.00695, 0.00695072913054794, 0.007504}, {2015735.1415765658, 2015735.1415765658, 2015700.0, 2015700.0, 1951700.0, 1864870.7605024308, 1844500.0, 1841600.0, 1822165.3945369495, 1785800.0, 1783600.3091498208, 1777200.0, 1740300.0, 1726200.0, 1726148.1011243642, 1699100.0}, {2015711.8815733166, 2015711.8815733166, 2015700.0, 2015700.0, 2092400.0, 2205746.1081190584, 2230100.0, 2233500.0, 2255755.11510478, 2294800.0, 2297157.9208883075, 2303600.0, 2339200.0, 2351900.0, 2351818.9285238637, 2375000.0}, {2084259.1111486289, 2084259.1111486289, 2084300.0000000002, 2084300.0000000002, 2011100.0, 1913740.027328943, 1891200.0, 1888000.0, 1866498.960729873, 1826600.0, 1824142.494813129, 1817200.0, 1776800.0, 1761500.0, 1761526.5660663561, 1732200.0}, {2084328.8911583764, 2084328.8911583764, 2084300.0000000002, 2084300.0000000002, 2172600.0, 2305298.922025518, 2334300.0, 2338400.0, 2365077.130375892, 2412100.0, 2414853.537329122, 2422700.0, 2466000.0, 2481600.0, 2481609.7466542483, 2510000.0}, {4406.900691596729, 4406.900691596729, 4407.0, 4407.0, 4294.2, 4145.895543137111, 4111.900000000001, 4107.1, 4074.6361971829456, 4014.6, 4010.8293562698145, 4000.4, 3939.6, 3916.5, 3916.3751350755733, 3872.0}, {4407.026295614275, 4407.026295614275, 4407.0, 4407.0, 4543.9, 4753.693384039946, 4800.900000000001, 4807.599999999999, 4851.245837666977, 4931.0, 4935.81920948097, 4949.3, 5025.599999999999, 5053.7, 5053.468305915286, 5106.4}}}, .max = {{{647.0944444444444, 647.0944444444444, 647.0999999999999, 647.0999999999999, 646.8599999999999, 644.2611111111112, 643.15, 642.98, 641.7111111111111, 638.9, 638.7055555555556, 638.15, 634.62, 633.15, 633.15, 630.14}, {22063912.81386808, 22063912.81386808, 22064000.0, 22064000.0, 22000000.0, 21325484.30776975, 21044000.0, 21000000.0, 20684271.87950509, 20000000.0, 19954117.08215856, 19822000.0, 19000000.0, 18666000.0, 18666176.419794712, 18000000.0}, {0.0031057910386631943, 0.0031057910386631943, 0.003106, 0.003106, 0.002703, 0.0022911061531445073, 0.002217, 0.002207, 0.002143151886579044, 0.002038, 0.002032030116753507, 0.002015, 0.001926, 0.001895, 0.0018946886034859887, 0.00184}, {0.0031057910386631943, 0.0031057910386631943, 0.003106, 0.003106, 0.003644, 0.004670860010307139, 0.004953, 0.004994, 0.005281405464741833, 0.005862, 0.005900066554051426, 0.006009, 0.006677, 0.00695, 0.00695072913054794, 0.007504}, {2015735.1415765658, 2015735.1415765658, 2015700.0, 2015700.0, 1951700.0, 1864870.7605024308, 1844500.0, 1841600.0, 1822165.3945369495, 1785800.0, 1783600.3091498208, 1777200.0, 1740300.0, 1726200.0, 1726148.1011243642, 1699100.0}, {2015711.8815733166, 2015711.8815733166, 2015700.0, 2015700.0, 2092400.0, 2205746.1081190584, 2230100.0, 2233500.0, 2255755.11510478, 2294800.0, 2297157.9208883075, 2303600.0, 2339200.0, 2351900.0, 2351818.9285238637, 2375000.0}, {2084259.1111486289, 2084259.1111486289, 2084300.0000000002, 2084300.0000000002, 2011100.0, 1913740.027328943, 1891200.0, 1888000.0, 1866498.960729873, 1826600.0, 1824142.494813129, 1817200.0, 1776800.0, 1761500.0, 1761526.5660663561, 1732200.0}, {2084328.8911583764, 2084328.8911583764, 2084300.0000000002, 2084300.0000000002, 2172600.0, 2305298.922025518, 2334300.0, 2338400.0, 2365077.130375892, 2412100.0, 2414853.537329122, 2422700.0, 2466000.0, 2481600.0, 2481609.7466542483, 2510000.0}, {4406.900691596729, 4406.900691596729, 4407.0, 4407.0, 4294.2, 4145.895543137111, 4111.900000000001, 4107.1, 4074.6361971829456, 4014.6, 4010.8293562698145, 4000.4, 3939.6, 3916.5, 3916.3751350755733, 3872.0}, {4407.026295614275, 4407.026295614275, 4407.0, 4407.0, 4543.9, 4753.693384039946, 4800.900000000001, 4807.599999999999, 4851.245837666977, 4931.0, 4935.81920948097, 4949.3, 5025.599999999999, 5053.7, 5053.468305915286, 5106.4}}}, .children = {267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282}, .size = 16, .is_leaf = true},
 };
-const logngine::core::RSTTree<SaturationTableEntry, 10, 16, 16> SaturationTable = _make_baked_saturationtable_dataset();
+inline constexpr SaturationTableEntry _baked_saturationtable_values[] = {
+    SaturationTableEntry{SaturationTableData{293.15, 2339.2, 0.001002, 57.762, 83913.0, 2402300.0, 83915.0, 2537400.0, 296.5, 8666.1}, SaturationTableData{0.0, 316.7499999999999, 5e-07, 7.2109999999999985, 10458.5, 3400.0, 10457.5, 4550.0, 35.35000000000002, 54.70000000000073}, 2},
+    SaturationTableEntry{SaturationTableData{291.48333333333335, 2108.2788851050223, 0.0010013444876413593, 63.726462156128406, 76944.09074826368, 2399967.1352496515, 76944.09074826368, 2534409.95402987, 272.60258607965557, 8703.521055788482}, SaturationTableData{0.0, 170.30050514125867, 5e-20, 4.795091651853667, 5815.000812293205, 1860.800259933807, 5815.000812293205, 2558.600357408868, 19.84543477219424, 31.191664357142145}, 4},
+    SaturationTableEntry{SaturationTableData{290.65, 2000.0, 0.001001, 66.99, 73431.0, 2398900.0, 73433.0, 2532900.0, 260.6, 8722.699999999999}, SaturationTableData{1.789999999999992, 0.0, 5e-07, 6.373999999999999, 7495.5, 2450.0, 7495.5, 3250.0, 25.599999999999994, 40.30000000000018}, 3},
+    SaturationTableEntry{SaturationTableData{288.7055555555556, 1767.677874822505, 0.0010013444876413593, 75.294363250888, 65314.08912367727, 2396245.534729784, 65314.08912367727, 2529292.7533150525, 232.53490448263045, 8767.160424678217}, SaturationTableData{0.0, 145.65174781818166, 5e-20, 5.783950547379796, 5815.000812293205, 1860.800259933807, 5815.000812293205, 2442.3003411632963, 20.033840798512557, 31.819684444867562}, 4},
+    SaturationTableEntry{SaturationTableData{288.15, 1705.7, 0.001001, 77.885, 62980.0, 2395500.0, 62982.0, 2528300.0, 224.5, 8780.300000000001}, SaturationTableData{0.0, 238.80000000000007, 5e-07, 10.061500000000002, 10466.5, 3400.0, 10466.5, 4550.0, 36.0, 57.100000000000364}, 2},
+    SaturationTableEntry{SaturationTableData{286.16999999999996, 1500.0, 0.001001, 87.964, 54686.0, 2392800.0, 54688.0, 2524700.0, 195.6, 8827.0}, SaturationTableData{2.240000000000009, 0.0, 5e-07, 10.487000000000002, 9372.5, 3050.0, 9372.5, 4100.0, 32.500000000000014, 52.150000000000546}, 3},
+    SaturationTableEntry{SaturationTableData{285.9277777777778, 1476.3743791861416, 0.001000720208035598, 89.29695480811725, 53660.827495841695, 2392523.934209916, 53660.827495841695, 2524408.152632726, 192.00667482127173, 8832.474513801893}, SaturationTableData{0.0, 124.14010506349632, 3.121398028806772e-07, 7.001295778614626, 5815.000812293205, 1860.8002599340398, 5815.000812293205, 2442.3003411632963, 20.26411483067936, 32.65704456183812}, 4},
+    SaturationTableEntry{SaturationTableData{283.15, 1228.1, 0.001, 106.32, 42020.0, 2388700.0, 42022.0, 2519200.0, 151.10000000000002, 8899.900000000001}, SaturationTableData{0.0, 177.79999999999995, 0.0005, 14.217499999999994, 10480.0, 3400.0, 10480.0, 4550.0, 36.69999999999999, 59.80000000000018}, 2},
+    SaturationTableEntry{SaturationTableData{283.15000000000003, 1228.094169059149, 0.0010000959284298366, 106.32105965723187, 42030.825871255285, 2388569.733657557, 42030.825871255285, 2519290.9519179077, 151.10163310727643, 8899.463323159513}, SaturationTableData{0.0, 105.35189143961264, 5e-20, 8.51205242455731, 5815.000812293205, 1860.8002599340398, 5815.000812293205, 2558.6003574086353, 20.45252085699765, 33.49440467880959}, 4},
+    SaturationTableEntry{SaturationTableData{280.37222222222226, 1017.3903861799237, 0.0010000959284298366, 127.09084214091517, 30354.30424017053, 2384848.133137689, 30354.30424017053, 2514173.7512030904, 109.694175323099, 8968.545532809556}, SaturationTableData{0.0, 89.04579044126939, 5e-20, 10.38489124184165, 5835.9348152174625, 1860.800259933807, 5835.9348152174625, 2558.6003574086353, 20.703728892088712, 34.54110482502165}, 4},
+    SaturationTableEntry{SaturationTableData{280.12, 1000.0, 0.001, 129.19, 29302.0, 2384500.0, 29303.0, 2513700.0, 105.89999999999999, 8974.9}, SaturationTableData{3.0249999999999773, 0.0, 0.0005, 20.613, 12692.0, 4150.0, 12692.5, 5500.0, 44.85, 73.94999999999982}, 3},
+    SaturationTableEntry{SaturationTableData{278.15, 872.5, 0.001, 147.03, 21019.0, 2381800.0, 21020.0, 2510100.0, 76.30000000000001, 9024.900000000001}, SaturationTableData{0.0, 130.39999999999998, 0.0005, 20.355000000000004, 10500.5, 3450.0, 10501.0, 4550.0, 37.400000000000006, 62.5}, 2},
+    SaturationTableEntry{SaturationTableData{277.59444444444443, 839.2988052973849, 0.0010000959284298366, 152.54896446386695, 18682.434609735607, 2381126.5326178214, 18682.434609735607, 2509056.550488272, 67.82616947458793, 9038.883782635054}, SaturationTableData{0.0, 74.98048556320595, 5e-20, 12.72906116147589, 5835.9348152174625, 1860.800259933807, 5835.9348152174625, 2558.600357409101, 20.934002924255537, 35.169124912748885}, 4},
+    SaturationTableEntry{SaturationTableData{274.81666666666666, 689.337834170973, 0.0010000959284298366, 183.89404346914915, 6987.304976051515, 2377172.332065462, 6987.304976051515, 2503939.349773454, 25.49761556174324, 9111.31543275298}, SaturationTableData{0.0, 38.85195734700375, 5e-20, 11.05599181803521, 3493.6524880257575, 1163.0001624587458, 3493.6524880257575, 1511.90021119616, 12.74880778087162, 21.980703070467825}, 4},
+    SaturationTableEntry{SaturationTableData{273.15999999999997, 611.7, 0.001, 206.0, 0.0, 2374900.0, 1.0, 2500900.0, 0.0, 9155.6}, SaturationTableData{0.0, 130.39999999999998, 0.0005, 29.485, 10509.5, 3450.0, 10509.5, 4600.0, 38.150000000000006, 65.34999999999945}, 2},
+    SaturationTableEntry{SaturationTableData{273.16, 611.6339194769655, 0.0010000959284298366, 206.00602710521957, 0.0, 2374846.3317405446, 0.0, 2500915.5493510617, 0.0, 9155.276838893915}, SaturationTableData{0.0, 38.85195734700375, 5e-20, 11.05599181803521, 3493.6524880257575, 1163.0001624587458, 3493.6524880257575, 1511.90021119616, 12.74880778087162, 21.980703070467825}, 4},
+    SaturationTableEntry{SaturationTableData{294.22999999999996, 2500.0, 0.001002, 54.242, 88422.0, 2403800.0, 88424.0, 2539400.0, 311.8, 8642.099999999999}, SaturationTableData{1.5, 0.0, 5e-07, 4.293999999999997, 6279.0, 2050.0, 6278.0, 2700.0, 21.25, 32.79999999999927}, 3},
+    SaturationTableEntry{SaturationTableData{294.2611111111111, 2505.141114899793, 0.0010019687672471207, 54.13627885242107, 88574.0923728501, 2403921.3358020107, 88574.0923728501, 2539527.1547446884, 312.29345562404404, 8641.137727074198}, SaturationTableData{0.0, 198.43111489738544, 3.121398028806772e-07, 3.9925802186473263, 5803.370810668617, 1860.800259933807, 5803.370810668617, 2442.3003411632963, 19.657028745875948, 30.354304240169768}, 4},
+    SaturationTableEntry{SaturationTableData{297.0388888888889, 2965.8487972293033, 0.0010025930468528824, 46.15111841512642, 100180.83399418733, 2407642.9363218783, 100180.83399418733, 2544411.755427015, 351.60751311579594, 8580.429118593858}, SaturationTableData{0.0, 230.35384116475507, 3.121398028806772e-07, 3.335525933583405, 5803.370810668617, 1860.800259933807, 5803.370810668617, 2442.3003411632963, 19.468622719557658, 29.72628415244253}, 4},
+    SaturationTableEntry{SaturationTableData{297.22999999999996, 3000.0, 0.001003, 45.654, 100980.0, 2407900.0, 100980.0, 2544800.0, 354.3, 8576.5}, SaturationTableData{1.5, 0.0, 5e-07, 4.293999999999997, 6279.0, 2050.0, 6278.0, 2700.0, 21.25, 32.79999999999927}, 3},
+    SaturationTableEntry{SaturationTableData{298.15, 3169.7999999999997, 0.001003, 43.34, 104830.0, 2409100.0, 104830.0, 2546500.0, 367.20000000000005, 8556.699999999999}, SaturationTableData{0.0, 415.29999999999995, 5e-07, 5.230500000000003, 10450.0, 3400.0, 10455.0, 4550.0, 34.79999999999998, 52.349999999999454}, 2},
+    SaturationTableEntry{SaturationTableData{299.81666666666666, 3498.7445884182857, 0.0010032173264586438, 39.48006654795961, 111787.57561552458, 2411364.5368417464, 111810.83561877374, 2549528.9561418323, 390.54475855491125, 8520.976550288973}, SaturationTableData{0.0, 266.44789559449123, 3.121398028806772e-07, 2.7970847736141593, 5803.3708106686245, 1860.8002599335741, 5803.3708106686245, 2558.6003574086353, 19.259282690315075, 28.888924035473792}, 4},
+    SaturationTableEntry{SaturationTableData{302.10999999999996, 4000.0, 0.001004, 34.791, 121390.0, 2414500.0, 121390.0, 2553700.0, 422.4, 8473.4}, SaturationTableData{1.9550000000000125, 0.0, 5e-07, 3.302999999999999, 8180.0, 2650.0, 8180.0, 3500.0, 26.900000000000006, 39.79999999999927}, 3},
+    SaturationTableEntry{SaturationTableData{302.59444444444443, 4113.343253531314, 0.0010044658856701667, 33.88589700073129, 123417.57724011099, 2415086.1373616136, 123417.57724011099, 2554646.1568566505, 429.0633239355414, 8463.198702218026}, SaturationTableData{0.0, 307.2993325565142, 3.121398028806772e-07, 2.3535341137206522, 5803.37081066861, 1860.8002599335741, 5803.37081066861, 2442.3003411632963, 19.112744669845313, 28.260903947744737}, 4},
+    SaturationTableEntry{SaturationTableData{303.15, 4246.900000000001, 0.001004, 32.879, 125730.0, 2415900.0, 125740.0, 2555600.0, 436.8, 8452.0}, SaturationTableData{0.0, 538.5500000000004, 5e-07, 3.8369999999999997, 10450.0, 3400.0, 10450.0, 4500.0, 34.14999999999998, 50.150000000000546}, 2},
+    SaturationTableEntry{SaturationTableData{305.37222222222226, 4819.711138216413, 0.001005090165275928, 29.178828773289986, 135024.3188614482, 2419040.3379139733, 135024.3188614482, 2559530.757538977, 467.28881327523203, 8406.676894322536}, SaturationTableData{0.0, 353.18394234254947, 3.121398028806772e-07, 1.9870819851386816, 5803.37081066861, 1860.8002599335741, 5803.37081066861, 2442.3003411632963, 18.924338643526966, 27.6328838600175}, 4},
+    SaturationTableEntry{SaturationTableData{306.02, 5000.0, 0.001005, 28.185, 137750.0, 2419800.0, 137750.0, 2560700.0, 476.2, 8393.800000000001}, SaturationTableData{1.9550000000000125, 0.0, 5.000000000000664e-07, 3.302999999999999, 8180.0, 2650.0, 8180.0, 3500.0, 26.900000000000006, 39.79999999999927}, 3},
+    SaturationTableEntry{SaturationTableData{308.15, 5629.1, 0.001006, 25.205, 146630.0, 2422700.0, 146640.0, 2564600.0, 505.09999999999997, 8351.699999999999}, SaturationTableData{0.0, 691.0999999999999, 1.0000000000000243e-06, 2.844999999999999, 10450.0, 3350.0, 10445.0, 4450.0, 33.650000000000006, 48.05000000000018}, 2},
+    SaturationTableEntry{SaturationTableData{308.15000000000003, 5629.086696861447, 0.001006338724487451, 25.204664803012623, 146631.06048278545, 2422761.9384338404, 146631.06048278545, 2564647.958253795, 505.13749056228596, 8351.411126602501}, SaturationTableData{0.0, 404.68777932251714, 3.121398028806772e-07, 1.6827456773299794, 5803.3708106686245, 1860.8002599335741, 5803.3708106686245, 2442.3003411632963, 18.756866620132996, 26.795523743046942}, 4},
+    SaturationTableEntry{SaturationTableData{310.9277777777778, 6553.604702302393, 0.0010069630040932124, 21.839173448352664, 158237.8021041227, 2426483.5389537085, 158237.8021041227, 2569532.5589361214, 542.651223802552, 8297.820079116407}, SaturationTableData{0.0, 462.25900272047284, 3.121398028806772e-07, 1.6827456773299794, 5803.3708106686245, 1860.8002599340398, 5803.3708106686245, 2442.3003411632963, 18.756866620132996, 26.795523743046942}, 4},
+    SaturationTableEntry{SaturationTableData{311.8666666666667, 6894.7572931683635, 0.001007587283698974, 20.819100572538463, 162168.74265323288, 2427646.539116167, 162168.74265323288, 2571160.7591635636, 555.2534935629537, 8279.816836601549}, SaturationTableData{6.758333333333326, 0.0, 2.8092582259265286e-06, 4.9873697704281925, 28260.90394774497, 9071.401267177425, 28260.90394774497, 12095.201689569745, 88.69737039007072, 121.83589701916753}, 5},
+    SaturationTableEntry{SaturationTableData{313.15, 7385.1, 0.001008, 19.515, 167530.0, 2429400.0, 167530.0, 2573500.0, 572.4, 8255.599999999999}, SaturationTableData{0.0, 878.0, 1.0000000000000243e-06, 2.1320000000000006, 10450.0, 3350.0, 10445.0, 4450.0, 33.099999999999966, 46.149999999999636}, 2},
+    SaturationTableEntry{SaturationTableData{313.44, 7500.0, 0.001008, 19.233, 168740.0, 2429800.0, 168750.0, 2574000.0, 576.3000000000001, 8250.1}, SaturationTableData{2.759999999999991, 0.0, 1.0000000000000243e-06, 2.2815000000000003, 11525.0, 3700.0, 11530.0, 4950.0, 36.44999999999999, 50.650000000000546}, 3},
+    SaturationTableEntry{SaturationTableData{316.48333333333335, 8802.53663618805, 0.0010094601225162582, 16.540912434255272, 181451.28534679717, 2433926.739993444, 181474.54535004633, 2579534.3603332657, 616.631990136871, 8193.568744553615}, SaturationTableData{0.0, 1124.4659669428283, 9.364194086421401e-07, 1.9358910574662431, 11606.741621337234, 3721.600519867381, 11606.741621337234, 4884.60068232636, 36.38329708235614, 49.82292695972774}, 4},
+    SaturationTableEntry{SaturationTableData{318.15, 9595.3, 0.00101, 15.251, 188430.0, 2436100.0, 188440.0, 2582400.0, 638.5999999999999, 8163.299999999999}, SaturationTableData{0.0, 1105.0999999999995, 5e-06, 1.6124999999999998, 10450.0, 3300.0, 10450.0, 4450.0, 32.60000000000002, 44.249999999999545}, 2},
+    SaturationTableEntry{SaturationTableData{318.96, 10000.0, 0.00101, 14.67, 191790.0, 2437200.0, 191810.0, 2583900.0, 649.2, 8148.799999999999}, SaturationTableData{2.759999999999991, 0.0, 5e-06, 2.2815000000000003, 11525.0, 3700.0, 11530.0, 4950.0, 36.44999999999999, 50.650000000000546}, 3},
+    SaturationTableEntry{SaturationTableData{322.0388888888889, 11687.303087649694, 0.0010113329613335425, 12.669130319322786, 204688.0285927208, 2441369.941033179, 204688.0285927208, 2589303.5616979185, 689.3985843015832, 8093.92289063416}, SaturationTableData{0.0, 1442.3832257308222, 9.364194086421401e-07, 1.4311609962081153, 11618.371622961815, 3605.300503621809, 11606.741621337234, 4884.60068232636, 35.755276994628446, 47.52018663805984}, 4},
+    SaturationTableEntry{SaturationTableData{323.15, 12352.0, 0.001012, 12.026, 209330.0, 2442700.0, 209340.0, 2591300.0, 703.8, 8074.8}, SaturationTableData{0.0, 1378.3500000000004, 1.0000000000000243e-06, 1.2310499999999998, 10450.0, 3300.0, 10450.0, 4400.0, 32.10000000000002, 42.5}, 2},
+    SaturationTableEntry{SaturationTableData{325.3833333333333, 13789.514586336727, 0.001013205800150827, 10.844361031682078, 218690.55054872282, 2445789.341650522, 218690.55054872282, 2595351.162542703, 732.6482343430952, 8036.145042563214}, SaturationTableData{4.275000000000006, 0.0, 2.1849786201649573e-06, 1.7170810556468572, 17875.312496989325, 5582.400779801421, 17886.94249861392, 7443.201039735461, 54.24000157674607, 70.33824982549868}, 5},
+    SaturationTableEntry{SaturationTableData{327.12, 15000.0, 0.001014, 10.02, 225930.0, 2448000.0, 225940.0, 2598300.0, 754.9, 8007.099999999999}, SaturationTableData{3.0449999999999875, 0.0, 1.4999999999999823e-06, 1.1859499999999996, 12735.0, 4000.0, 12740.0, 5300.0, 38.55000000000001, 49.899999999999636}, 3},
+    SaturationTableEntry{SaturationTableData{327.59444444444443, 15347.729734592776, 0.00101445435936235, 9.806808326906555, 227924.77183864443, 2448580.5420404226, 227924.77183864443, 2599072.763062571, 760.9091382908401, 7998.88251735804}, SaturationTableData{0.0, 1830.2133234715411, 1.2485592115228173e-06, 1.0700152442751185, 11618.371622961815, 3605.300503621809, 11618.371622961815, 4884.600682325894, 35.190058915673546, 45.42678634563481}, 4},
+    SaturationTableEntry{SaturationTableData{328.15, 15763.0, 0.001015, 9.5639, 230240.0, 2449300.0, 230260.0, 2600100.0, 768.0, 7989.8}, SaturationTableData{0.0, 1705.5, 9.999999999999159e-07, 0.9484500000000002, 10455.0, 3300.0, 10460.0, 4350.0, 31.650000000000034, 40.80000000000018}, 2},
+    SaturationTableEntry{SaturationTableData{333.15, 19947.0, 0.001017, 7.667, 251160.0, 2455900.0, 251180.0, 2608800.0, 831.3000000000001, 7908.2}, SaturationTableData{0.0, 2092.0, 9.999999999999159e-07, 0.7367499999999998, 10460.0, 3250.0, 10460.0, 4350.0, 31.19999999999999, 39.29999999999973}, 2},
+    SaturationTableEntry{SaturationTableData{333.15000000000003, 19947.222324865394, 0.0010169514777853955, 7.666777838356318, 251161.51508456812, 2456023.7430801583, 251184.77508781725, 2608841.964427223, 831.2892561221872, 7908.02894466677}, SaturationTableData{0.0, 2299.7462951363086, 1.2485592115228173e-06, 0.8078490238355989, 11618.371622961844, 3605.3005036215764, 11630.00162458641, 4768.300666080788, 34.60390683379438, 43.54272608245128}, 4},
+    SaturationTableEntry{SaturationTableData{333.21, 20000.0, 0.001017, 7.6481, 251400.0, 2456000.0, 251420.0, 2608900.0, 832.0, 7907.3}, SaturationTableData{2.4499999999999886, 0.0, 1.4999999999999823e-06, 0.72235, 10265.0, 3200.0, 10270.0, 4300.0, 30.600000000000023, 38.55000000000018}, 3},
+    SaturationTableEntry{SaturationTableData{333.93333333333334, 20684.27187950509, 0.001017575757391157, 7.410198920388364, 254441.17554270147, 2456954.1432101247, 254464.43554595066, 2610237.564622174, 841.1282374965873, 7895.468542912216}, SaturationTableData{3.194444444444457, 0.0, 1.8728388172843885e-06, 0.8762076406664772, 13374.501868274368, 4186.8005848512985, 13374.501868274354, 5466.100763555616, 39.66993554146421, 49.613586930485326}, 5},
+    SaturationTableEntry{SaturationTableData{338.10999999999996, 25000.0, 0.00102, 6.2034, 271930.0, 2462400.0, 271960.0, 2617500.0, 893.2, 7830.2}, SaturationTableData{2.065000000000026, 0.0, 5e-06, 0.48735000000000017, 8655.0, 2650.0, 8655.0, 3550.0, 25.44999999999999, 31.34999999999991}, 3},
+    SaturationTableEntry{SaturationTableData{338.15, 25043.0, 0.00102, 6.1935, 272090.0, 2462400.0, 272120.0, 2617500.0, 893.7, 7829.6}, SaturationTableData{0.0, 2548.0, 5e-06, 0.5769500000000001, 10465.0, 3250.0, 10470.0, 4300.0, 30.699999999999932, 37.80000000000018}, 2},
+    SaturationTableEntry{SaturationTableData{360.9277777777778, 64463.912263936254, 0.001034431306746716, 2.5545521467758374, 367624.3513531764, 2491146.347986409, 367694.13136292394, 2655827.1709905523, 1167.0287950213974, 7506.933448638034}, SaturationTableData{0.0, 6308.702923249053, 1.8728388172842801e-06, 0.22808055396494442, 11664.891629460151, 3372.7004711301997, 11676.52163108479, 4535.70063358848, 32.13369448873232, 35.58780497123416}, 4},
+    SaturationTableEntry{SaturationTableData{358.15, 57868.0, 0.001032, 2.8261, 355960.0, 2487800.0, 356020.0, 2651400.0, 1134.6000000000001, 7543.5}, SaturationTableData{0.0, 5226.0, 1.4999999999999823e-06, 0.23339999999999983, 10495.0, 3100.0, 10500.0, 4100.0, 29.149999999999977, 32.65000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{356.93333333333334, 55158.05834534691, 0.0010313099087179089, 2.9557766493987185, 350830.62900727364, 2486261.747304083, 350900.4090170212, 2649314.370080784, 1120.2622324886104, 7559.687136007158}, SaturationTableData{2.875, 0.0, 2.1849786201650657e-06, 0.2784911321301813, 12083.571687945281, 3605.3005036215764, 12083.571687945252, 4768.300666080322, 33.599074693430225, 37.890545292902516}, 5},
+    SaturationTableEntry{SaturationTableData{355.37222222222226, 51846.50641743815, 0.0010306856291121473, 3.1321356380263268, 344294.5680942561, 2484400.9470441486, 344341.08810075436, 2646755.7697233753, 1101.8821779211144, 7580.621138931414}, SaturationTableData{0.0, 5239.32606707864, 1.8728388172842801e-06, 0.2887917456252447, 11653.2616278356, 3372.7004711301997, 11653.261627835542, 4535.70063358848, 32.57330855014152, 36.84384514669}, 4},
+    SaturationTableEntry{SaturationTableData{354.46999999999997, 50000.0, 0.00103, 3.2403, 340490.0, 2483200.0, 340540.0, 2645200.0, 1091.2, 7593.099999999999}, SaturationTableData{2.7299999999999898, 0.0, 5e-06, 0.37650000000000006, 11455.0, 3450.0, 11460.0, 4550.0, 32.55000000000007, 38.000000000000455}, 3},
+    SaturationTableEntry{SaturationTableData{353.15, 47416.0, 0.001029, 3.4053, 334970.0, 2481600.0, 335020.0, 2643000.0, 1075.6, 7611.1}, SaturationTableData{0.0, 4409.5, 1.4999999999999823e-06, 0.2896000000000001, 10490.0, 3100.0, 10495.0, 4200.0, 29.500000000000114, 33.80000000000018}, 2},
+    SaturationTableEntry{SaturationTableData{349.81666666666666, 41367.85428328087, 0.0010269399514775787, 3.8694098524305947, 320988.0448385849, 2477422.9460693966, 321034.5648450833, 2637451.7684237063, 1035.7725966863152, 7657.239589634189}, SaturationTableData{0.0, 4317.84175484669, 1.8728388172842801e-06, 0.36863710720213394, 11653.26162783557, 3489.0004873760045, 11653.261627835542, 4652.000649834517, 33.05479061739959, 38.30922535138734}, 4},
+    SaturationTableEntry{SaturationTableData{349.81666666666666, 41368.54375901018, 0.0010269399514775787, 3.8694098524305947, 320988.0448385849, 2477422.9460693966, 321034.5648450833, 2637451.7684237063, 1035.7725966863152, 7657.239589634189}, SaturationTableData{2.172222222222217, 0.0, 1.2485592115229257e-06, 0.36030297446521864, 9106.291272051167, 2791.2003899004776, 9117.921273675747, 3721.6005198678467, 26.18843765824363, 31.191664357141235}, 5},
+    SaturationTableEntry{SaturationTableData{349.01, 40000.0, 0.001026, 3.9933, 317580.0, 2476300.0, 317620.0, 2636100.0, 1026.1, 7669.1}, SaturationTableData{2.7299999999999898, 0.0, 2.0000000000000486e-06, 0.37650000000000006, 11455.0, 3450.0, 11460.0, 4550.0, 32.55000000000007, 38.000000000000455}, 3},
+    SaturationTableEntry{SaturationTableData{348.15, 38597.0, 0.001026, 4.1291, 313990.0, 2475300.0, 314030.0, 2634600.0, 1015.8000000000001, 7681.2}, SaturationTableData{0.0, 3697.5, 1.4999999999999823e-06, 0.3619000000000001, 10475.0, 3150.0, 10480.0, 4200.0, 29.89999999999992, 35.04999999999973}, 2},
+    SaturationTableEntry{SaturationTableData{345.47222222222223, 34473.78646584182, 0.0010244428330545329, 4.590015801361032, 302775.46229448257, 2471840.5452895956, 302798.7222977318, 2630008.5673839706, 983.3957213698279, 7719.622918348471}, SaturationTableData{2.172222222222217, 0.0, 1.2485592115229257e-06, 0.36030297446521864, 9106.291272051167, 2791.2003899004776, 9117.921273675747, 3721.6005198678467, 26.18843765824363, 31.191664357141235}, 5},
+    SaturationTableEntry{SaturationTableData{344.2611111111111, 32732.170773587488, 0.00102319427384301, 4.818502137069721, 297681.52158291376, 2470212.3450621534, 297728.0415894121, 2627915.167091545, 968.658183311152, 7737.62616086333}, SaturationTableData{0.0, 3530.1157341022026, 1.560699014403603e-06, 0.4745461423195634, 11630.00162458641, 3489.0004873760045, 11641.63162621099, 4768.300666080322, 33.55720668758158, 40.19328561457087}, 4},
+    SaturationTableEntry{SaturationTableData{343.15, 31202.0, 0.001023, 5.0396, 293040.0, 2468900.0, 293070.0, 2626100.0, 955.0999999999999, 7754.0}, SaturationTableData{0.0, 3079.5, 1.4999999999999823e-06, 0.45524999999999993, 10475.0, 3200.0, 10475.0, 4250.0, 30.35000000000008, 36.40000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{342.24, 30000.0, 0.001022, 5.2287, 289240.0, 2467700.0, 289270.0, 2624600.0, 944.1, 7767.5}, SaturationTableData{2.065000000000026, 0.0, 9.999999999999159e-07, 0.48735000000000017, 8655.0, 2650.0, 8655.0, 3550.0, 25.44999999999999, 31.34999999999991}, 3},
+    SaturationTableEntry{SaturationTableData{340.32222222222225, 27579.029172673454, 0.0010213214350257257, 5.65778363905541, 281190.1792792502, 2465327.7443798273, 281213.43928249937, 2621169.7661492852, 920.4681085795157, 7796.241369051246}, SaturationTableData{2.5749999999999886, 0.0, 1.560699014403603e-06, 0.5338839188471889, 10792.64150761618, 3256.400454884162, 10792.641507616208, 4419.400617342675, 31.463806395156098, 38.30922535138734}, 5},
+    SaturationTableEntry{SaturationTableData{338.7055555555556, 25671.939305383083, 0.0010200728758142028, 6.051079790685121, 274421.51833374094, 2463234.3440874014, 274444.7783369901, 2618378.5657593845, 900.497069789776, 7820.943492501868}, SaturationTableData{0.0, 2862.3584902588445, 1.560699014403603e-06, 0.6162888268076996, 11630.00162458641, 3489.0004873760045, 11630.001624586424, 4768.300666080322, 34.08055676068801, 41.65866581926866}, 4},
+    SaturationTableEntry{SaturationTableData{381.99444444444447, 137895.14586336727, 0.0010506625764965137, 1.2543650118564735, 456384.5237520199, 2516267.1514955154, 456524.08377151494, 2689321.5756693613, 1406.0113724046987, 7251.119932903632}, SaturationTableData{3.36388888888888, 0.0, 2.8092582259265286e-06, 0.11817612937064181, 14235.121988493745, 3837.9005361134186, 14246.751990118355, 5117.200714817969, 36.94851516131098, 37.262525205174825}, 5},
+    SaturationTableEntry{SaturationTableData{379.12, 125000.0, 0.001048, 1.375, 444230.0, 2513000.0, 444360.0, 2684900.0, 1374.1000000000001, 7284.099999999999}, SaturationTableData{2.6899999999999977, 0.0, 2.499999999999898e-06, 0.1078, 11370.0, 3100.0, 11385.0, 4100.0, 29.799999999999955, 30.5}, 3},
+    SaturationTableEntry{SaturationTableData{378.15, 120900.0, 0.001047, 1.4186, 440150.0, 2511900.0, 440280.0, 2683400.0, 1363.3999999999999, 7295.200000000001}, SaturationTableData{0.0, 9740.0, 1.99999999999994e-06, 0.10460000000000003, 10545.0, 2900.0, 10555.0, 3850.0, 27.700000000000045, 28.500000000000455}, 2},
+    SaturationTableEntry{SaturationTableData{377.59444444444443, 118596.72019978902, 0.001046916898861945, 1.4443332958896815, 437799.7811559308, 2511149.950780697, 437939.34117542586, 2682576.174727101, 1357.1095415736377, 7301.361539921845}, SaturationTableData{0.0, 8590.867587287787, 1.8728388172842801e-06, 0.11380617213031163, 9373.781309416634, 2558.6003574086353, 9385.411311041244, 3489.0004873757716, 24.953331485712624, 26.376843684561663}, 4},
+    SaturationTableEntry{SaturationTableData{373.70000000000005, 103421.35939752545, 0.0010437955008331377, 1.6416680792708747, 421378.21886201476, 2506730.5501633547, 421494.5188782607, 2676528.5738823162, 1313.399343467792, 7347.416346355207}, SaturationTableData{0.2888888888888914, 0.0, 3.121398028806772e-07, 0.015856701986340704, 1209.5201689569803, 348.9000487374142, 1221.15017058159, 465.20006498345174, 3.244770453259548, 3.55878049712328}, 5},
+    SaturationTableEntry{SaturationTableData{373.15000000000003, 101414.98502521345, 0.0010431712212273763, 1.6719456401503048, 419052.2185370975, 2506032.75006588, 419168.51855334337, 2675598.1737523493, 1307.2028786022124, 7354.1152272909685}, SaturationTableData{0.0, 1975.3479644927356, 3.1213980288078563e-07, 0.03171340397268141, 2337.6303265418683, 697.8000974755269, 2337.6303265418683, 930.4001299669035, 6.280200877276684, 6.698880935761736}, 4},
+    SaturationTableEntry{SaturationTableData{373.15, 101420.0, 0.001043, 1.672, 419060.0, 2506000.0, 419170.0, 2675600.0, 1307.1999999999998, 7354.2}, SaturationTableData{0.0, 8405.5, 1.5000000000000907e-06, 0.12669999999999992, 10530.0, 2950.0, 10540.0, 3900.0, 28.100000000000023, 29.499999999999545}, 2},
+    SaturationTableEntry{SaturationTableData{373.12222222222226, 101325.35318040226, 0.0010431712212273763, 1.673381483243556, 418959.1785241008, 2506032.75006588, 419052.2185370975, 2675598.1737523493, 1306.909802561273, 7354.533907349453}, SaturationTableData{0.2888888888888914, 0.0, 3.121398028806772e-07, 0.015856701986340704, 1209.5201689569803, 348.9000487374142, 1221.15017058159, 465.20006498345174, 3.244770453259548, 3.55878049712328}, 5},
+    SaturationTableEntry{SaturationTableData{373.12, 101325.0, 0.001043, 1.6734, 418950.0, 2506000.0, 419060.0, 2675600.0, 1306.8999999999999, 7354.5}, SaturationTableData{0.18000000000000682, 0.0, 5e-07, 0.01034999999999997, 775.0, 500.0, 775.0, 300.0, 2.0499999999999545, 2.200000000000273}, 3},
+    SaturationTableEntry{SaturationTableData{372.76, 100000.0, 0.001043, 1.6941, 417400.0, 2505600.0, 417510.0, 2675000.0, 1302.8, 7358.900000000001}, SaturationTableData{0.18000000000000682, 0.0, 5e-07, 0.01034999999999997, 775.0, 200.0, 775.0, 500.0, 2.0499999999999545, 2.200000000000273}, 3},
+    SaturationTableEntry{SaturationTableData{372.0388888888889, 97464.28909622798, 0.0010425469416216148, 1.7353724480956676, 414376.95788401377, 2504637.149870929, 414493.25790025963, 2673737.3734924155, 1294.642476847659, 7367.512989162492}, SaturationTableData{0.0, 1975.3479644927356, 3.1213980288078563e-07, 0.03171340397268141, 2337.6303265418683, 697.8000974755269, 2337.6303265418683, 930.4001299669035, 6.280200877276684, 6.698880935761736}, 4},
+    SaturationTableEntry{SaturationTableData{368.15, 84609.0, 0.00104, 1.9808, 398000.0, 2500100.0, 398090.0, 2667600.0, 1250.3999999999999, 7415.099999999999}, SaturationTableData{0.0, 7213.0, 5e-06, 0.15439999999999998, 10515.0, 2950.0, 10525.0, 4000.0, 28.399999999999977, 30.449999999999818}, 2},
+    SaturationTableEntry{SaturationTableData{366.48333333333335, 79551.70964857658, 0.0010381769843812846, 2.0983910388459486, 391000.6546185951, 2498124.3489611605, 391070.43462834257, 2664898.57225773, 1231.296183998862, 7435.757838695566}, SaturationTableData{0.0, 7543.898692320163, 1.8728388172842801e-06, 0.1815092953751405, 11688.151632709341, 3256.400454884162, 11688.151632709312, 4419.400617342675, 31.67314642439851, 34.122424766536824}, 4},
+    SaturationTableEntry{SaturationTableData{364.90999999999997, 75000.0, 0.001037, 2.2172, 384360.0, 2496100.0, 384440.0, 2662400.0, 1213.2, 7455.8}, SaturationTableData{3.9250000000000114, 0.0, 3.000000000000073e-06, 0.26155000000000006, 16520.0, 4750.0, 16535.0, 6300.0, 44.799999999999955, 48.44999999999982}, 3},
+    SaturationTableEntry{SaturationTableData{363.15, 70183.0, 0.001036, 2.3593, 376970.0, 2494000.0, 377040.0, 2659600.0, 1192.9, 7478.2}, SaturationTableData{0.0, 6157.5, 1.99999999999994e-06, 0.18925000000000014, 10505.0, 3050.0, 10510.0, 4000.0, 28.749999999999886, 31.550000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{362.68333333333334, 68947.57293168364, 0.001035679865958239, 2.398794385138356, 374997.7723831642, 2493472.348311326, 375067.5523929117, 2658850.9714129446, 1187.4603818754708, 7483.906045421353}, SaturationTableData{2.875, 0.0, 2.1849786201650657e-06, 0.2784911321301813, 12083.571687945281, 3605.3005036215764, 12083.571687945252, 4768.300666080322, 33.599074693430225, 37.890545292902516}, 5},
+    SaturationTableEntry{SaturationTableData{400.55999999999995, 250000.0, 0.001067, 0.71873, 535080.0, 2536800.0, 535350.0, 2716500.0, 1607.2, 7052.5}, SaturationTableData{1.5850000000000364, 0.0, 1.4999999999999823e-06, 0.030704999999999982, 6745.0, 1650.0, 6755.0, 2200.0, 16.799999999999955, 15.900000000000091}, 3},
+    SaturationTableEntry{SaturationTableData{399.8166666666667, 244398.461770939, 0.00106626956664055, 0.7341528163754605, 531909.754302084, 2536038.1542573124, 532165.6143378249, 2715372.779308435, 1599.2740874014257, 7059.783146175935}, SaturationTableData{0.0, 19315.662556811178, 2.4971184230458514e-06, 0.05309498047001099, 11792.821647330595, 2907.500406146515, 11816.081650579756, 3837.9005361134186, 29.370406102730385, 27.632883860017046}, 4},
+    SaturationTableEntry{SaturationTableData{399.4, 241316.50526089274, 0.00106626956664055, 0.7429551588166969, 530141.9940551468, 2535572.9541923287, 530397.8540908878, 2714907.5792434514, 1594.877946787332, 7063.969946760787}, SaturationTableData{2.213888888888903, 0.0, 2.1849786201649573e-06, 0.043699572403301246, 9420.301315915014, 2326.0003249172587, 9431.931317539536, 3023.8004223925527, 23.44608327516619, 22.190043099710692}, 5},
+    SaturationTableEntry{SaturationTableData{398.15, 232230.0, 0.001065, 0.77012, 524830.0, 2534300.0, 525070.0, 2713100.0, 1581.6, 7077.099999999999}, SaturationTableData{0.0, 16780.0, 2.5000000000000066e-06, 0.05102000000000001, 10615.0, 2600.0, 10630.0, 3500.0, 26.500000000000114, 25.299999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{397.12, 225000.0, 0.001064, 0.79329, 520470.0, 2533200.0, 520710.00000000006, 2711700.0, 1570.6, 7087.7}, SaturationTableData{1.7199999999999704, 0.0, 1.4999999999999823e-06, 0.037280000000000035, 7305.0, 1800.0, 7319.999999999971, 2400.0, 18.300000000000068, 17.59999999999991}, 3},
+    SaturationTableEntry{SaturationTableData{394.4277777777778, 206842.7187950509, 0.0010612753297944582, 0.8583220299614122, 509021.91110489797, 2530223.153445019, 509231.25113414053, 2707696.9782362077, 1541.6218433480258, 7115.467593954456}, SaturationTableData{2.486111111111086, 0.0, 2.497118423045743e-06, 0.05768343557235761, 10560.041475124424, 2674.9003736549057, 10583.301478373643, 3605.300503621809, 26.628051719653058, 25.748823596834427}, 5},
+    SaturationTableEntry{SaturationTableData{394.2611111111111, 205767.13665731665, 0.0010612753297944582, 0.8625047033200138, 508324.1110074228, 2529990.553412528, 508533.45103666536, 2707464.378203716, 1539.8633871023885, 7117.142314188396}, SaturationTableData{0.0, 16750.812843752545, 2.497118423045743e-06, 0.06417594347227668, 11781.191645706043, 3023.80042239232, 11792.821647330624, 3954.200552359456, 29.70535014951861, 28.67958400623047}, 4},
+    SaturationTableEntry{SaturationTableData{393.35999999999996, 200000.0, 0.001061, 0.88578, 504500.0, 2529100.0, 504710.0, 2706300.0, 1530.2, 7127.0}, SaturationTableData{1.8800000000000239, 0.0, 1.4999999999999823e-06, 0.04624499999999998, 7985.0, 2050.0, 8000.000000000029, 2700.0, 20.199999999999932, 19.65000000000009}, 3},
+    SaturationTableEntry{SaturationTableData{393.15, 198670.0, 0.00106, 0.89133, 503600.0, 2528900.0, 503810.0, 2706000.0, 1527.9, 7129.2}, SaturationTableData{0.0, 14745.0, 5e-06, 0.060604999999999964, 10590.0, 2700.0, 10610.0, 3550.0, 26.84999999999991, 26.050000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{389.19, 175000.0, 0.001057, 1.0037, 486820.0, 2524500.0, 487010.0, 2700200.0, 1485.0, 7171.599999999999}, SaturationTableData{2.0849999999999795, 0.0, 2.0000000000000486e-06, 0.05896000000000001, 8840.0, 2300.0, 8850.0, 3050.0, 22.600000000000023, 22.299999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{388.72222222222223, 172368.93232920908, 0.0010562810929483667, 1.01801275311519, 484854.7677290074, 2523942.952567742, 485017.58775175165, 2699555.977098997, 1479.9084027273207, 7176.594882493282}, SaturationTableData{2.8527777777777885, 0.0, 2.497118423045743e-06, 0.07984536157688887, 12083.571687945281, 3140.1004386383574, 12106.831691194442, 4070.500568605261, 30.856720310352557, 30.56364426941309}, 5},
+    SaturationTableEntry{SaturationTableData{388.7055555555556, 172265.51096981156, 0.0010562810929483667, 1.0185746047603752, 484761.7277160107, 2523942.952567742, 484947.8077420041, 2699323.3770665056, 1479.699062698078, 7176.594882493282}, SaturationTableData{0.0, 14444.516529187706, 2.497118423045743e-06, 0.07803495072018068, 11746.301640832273, 3023.8004223927855, 11769.561644081434, 4070.500568605261, 30.082162202155246, 29.726284152442986}, 4},
+    SaturationTableEntry{SaturationTableData{388.15, 169180.0, 0.001056, 1.036, 482420.0, 2523300.0, 482590.0, 2698600.0, 1473.7, 7182.9}, SaturationTableData{0.0, 12900.0, 1.99999999999994e-06, 0.07233500000000004, 10575.0, 2800.0, 10585.0, 3700.0, 27.100000000000023, 26.84999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{384.5, 150000.0, 0.001053, 1.1594, 466970.0, 2519200.0, 467130.0, 2693100.0, 1433.7, 7223.099999999999}, SaturationTableData{2.344999999999999, 0.0, 2.0000000000000486e-06, 0.07784999999999997, 9925.0, 2650.0, 9940.0, 3550.0, 25.649999999999977, 25.75}, 3},
+    SaturationTableEntry{SaturationTableData{383.15, 143380.0, 0.001052, 1.2094, 461270.0, 2517700.0, 461420.0, 2691100.0, 1418.8, 7238.2}, SaturationTableData{0.0, 11240.0, 2.0000000000000486e-06, 0.0867, 10560.0, 2800.0, 10570.0, 3750.0, 27.450000000000045, 27.65000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{383.15000000000003, 143376.47791143614, 0.0010512868561022752, 1.2094793082022255, 461269.12443434616, 2517662.751690466, 461408.68445384124, 2691182.375929295, 1418.7811141884945, 7238.140851090592}, SaturationTableData{0.0, 12389.878855823561, 2.184978620165174e-06, 0.09545235172092514, 11734.671639207692, 3140.1004386381246, 11734.671639207692, 4070.500568605261, 30.45897425479177, 30.772984298655047}, 4},
+    SaturationTableEntry{SaturationTableData{416.76, 400000.0, 0.001084, 0.46242, 604220.0, 2553100.0, 604660.0, 2738100.0, 1776.5, 6895.5}, SaturationTableData{1.1550000000000011, 0.0, 1.4999999999999823e-06, 0.014454999999999996, 4950.0, 1100.0, 4965.0, 1500.0, 11.950000000000045, 10.799999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{416.48333333333335, 396951.8616395822, 0.0010831251159961089, 0.465756285470442, 603038.8442380545, 2552785.3565967167, 603480.7842997888, 2737702.3824276407, 1773.5705957487771, 6897.753963542198}, SaturationTableData{0.0, 28789.059077624494, 2.8092582259265286e-06, 0.031039181998459064, 11885.861660327297, 2674.900373654673, 11920.751665201096, 3489.0004873760045, 28.44930997406334, 25.330143538349148}, 4},
+    SaturationTableEntry{SaturationTableData{414.84444444444443, 379211.65112426, 0.0010812522771788244, 0.4862014425591294, 596037.5832600535, 2551389.7564017666, 596433.0033152895, 2735608.982135215, 1756.6977893918274, 6913.2451257061475}, SaturationTableData{1.5666666666666629, 0.0, 1.5606990144034945e-06, 0.01909047034418504, 6698.880935761728, 1395.6001949501224, 6722.140939010889, 1977.1002761798445, 16.119182251676648, 14.653802046978853}, 5},
+    SaturationTableEntry{SaturationTableData{414.45, 375000.0, 0.001081, 0.49133, 594320.0, 2550900.0, 594730.0, 2735100.0, 1752.6, 6917.099999999999}, SaturationTableData{1.1550000000000011, 0.0, 9.999999999999159e-07, 0.014454999999999996, 4950.0, 1100.0, 4965.0, 1500.0, 11.950000000000045, 10.799999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{413.15, 361530.0, 0.00108, 0.5085, 588770.0, 2549600.0, 589160.0, 2733500.0, 1739.2, 6929.400000000001}, SaturationTableData{0.0, 24155.0, 5e-06, 0.031249999999999972, 10680.0, 2400.0, 10705.0, 3150.0, 25.799999999999955, 23.350000000000364}, 2},
+    SaturationTableEntry{SaturationTableData{412.01, 350000.0, 0.001079, 0.52422, 583890.0, 2548500.0, 584260.0, 2732000.0, 1727.4, 6940.2}, SaturationTableData{1.2199999999999989, 0.0, 9.999999999999159e-07, 0.016445000000000015, 5215.0, 1200.0, 5235.0, 1550.0, 12.599999999999909, 11.550000000000182}, 3},
+    SaturationTableEntry{SaturationTableData{411.47777777777776, 344737.86465841817, 0.0010781308791500174, 0.5317301542073116, 581616.3812455664, 2547900.755914391, 581988.5412975531, 2731189.5815178724, 1721.8217405200176, 6945.064810151016}, SaturationTableData{1.6833333333333371, 0.0, 1.5606990144034945e-06, 0.022764355824091115, 7210.60100724356, 1744.5002436877694, 7222.231008868199, 2209.700308671221, 17.438024435904936, 15.909842222434236}, 5},
+    SaturationTableEntry{SaturationTableData{410.9277777777778, 339373.7434843332, 0.0010775065995442558, 0.5396210484241364, 579267.1209173999, 2547435.5558494073, 579639.2809693866, 2730491.7814203976, 1716.12769172462, 6950.507650911321}, SaturationTableData{0.0, 25320.99615916083, 2.80925822592642e-06, 0.03693238147684719, 11850.971655453555, 2674.900373654673, 11885.861660327297, 3605.3005036215764, 28.721452012078544, 26.376843684561663}, 4},
+    SaturationTableEntry{SaturationTableData{409.41999999999996, 325000.0, 0.001076, 0.56199, 572840.0, 2545900.0, 573190.0, 2728600.0, 1700.5, 6965.0}, SaturationTableData{1.295000000000016, 0.0, 1.4999999999999823e-06, 0.018884999999999985, 5525.0, 1300.0, 5535.0, 1700.0, 13.450000000000045, 12.400000000000091}, 3},
+    SaturationTableEntry{SaturationTableData{408.15, 313220.0, 0.001075, 0.58179, 567410.0, 2544700.0, 567750.0, 2726900.0, 1687.2, 6977.299999999999}, SaturationTableData{0.0, 21470.0, 2.5000000000000066e-06, 0.03664500000000004, 10655.0, 2450.0, 10685.0, 3300.0, 26.0, 23.949999999999363}, 2},
+    SaturationTableEntry{SaturationTableData{407.82222222222225, 310264.07819257636, 0.0010743852015154486, 0.5869976277053724, 566008.9190653714, 2544411.755427015, 566357.819114109, 2726537.580868038, 1683.7637232037212, 6980.233935063765}, SaturationTableData{1.8277777777777544, 0.0, 1.8728388172843885e-06, 0.027633736749030413, 7803.7310900975135, 1744.5002436880022, 7815.361091722036, 2326.0003249172587, 19.0290086581482, 17.584562456374442}, 5},
+    SaturationTableEntry{SaturationTableData{406.66999999999996, 300000.0, 0.001073, 0.60582, 561110.0, 2543200.0, 561430.0, 2724900.0, 1671.7, 6991.7}, SaturationTableData{1.375, 0.0, 1.4999999999999823e-06, 0.021915000000000018, 5865.0, 1350.0, 5880.0, 1850.0, 14.399999999999977, 13.349999999999909}, 3},
+    SaturationTableEntry{SaturationTableData{405.37222222222226, 288731.75116601156, 0.001071888083092403, 0.6279628554354385, 555565.1776064928, 2541853.1550696054, 555867.557648732, 2723048.580380662, 1658.0148996068865, 7004.517378455901}, SaturationTableData{0.0, 22166.644697536278, 2.80925822592642e-06, 0.04417090350565106, 11827.711652204394, 2791.2003899009433, 11850.971655453555, 3721.6005198678467, 29.056396058866767, 27.00486377228981}, 4},
+    SaturationTableEntry{SaturationTableData{403.8277777777778, 275790.29172673455, 0.0010706395238808798, 0.6555560140100944, 548982.5966869768, 2540224.9548421632, 549261.7167259669, 2720955.1800882365, 1641.7701133376643, 7019.589860561366}, SaturationTableData{1.9972222222222342, 0.0, 1.8728388172843885e-06, 0.034279193152361, 8513.161189197272, 2093.400292425882, 8548.051194071071, 2791.2003899007104, 20.996804933028443, 19.677962748800383}, 5},
+    SaturationTableEntry{SaturationTableData{403.73, 275000.0, 0.00107, 0.65732, 548570.0, 2540100.0, 548860.0, 2720900.0, 1640.8, 7020.7}, SaturationTableData{1.4699999999999704, 0.0, 5e-06, 0.025749999999999995, 6270.0, 1550.0, 6285.0, 2000.0, 15.450000000000045, 14.5}, 3},
+    SaturationTableEntry{SaturationTableData{403.15, 270280.0, 0.00107, 0.66808, 546100.0, 2539500.0, 546380.0, 2720100.0, 1634.6000000000001, 7026.5}, SaturationTableData{0.0, 19025.0, 5e-06, 0.04314499999999999, 10635.0, 2600.0, 10655.0, 3400.0, 26.299999999999955, 24.600000000000364}, 2},
+    SaturationTableEntry{SaturationTableData{433.15, 618230.0, 0.001102, 0.3068, 674790.0, 2567800.0, 675470.0, 2757500.0, 1942.6000000000001, 6749.2}, SaturationTableData{0.0, 37370.0, 2.9999999999999645e-06, 0.01718, 10800.0, 2050.0, 10840.0, 2650.0, 24.84999999999991, 21.25}, 2},
+    SaturationTableEntry{SaturationTableData{431.98, 600000.0, 0.001101, 0.3156, 669720.0, 2566800.0, 670380.0, 2756200.0, 1930.8000000000002, 6759.299999999999}, SaturationTableData{1.5749999999999886, 0.0, 1.4999999999999823e-06, 0.011499999999999982, 6825.0, 1300.0, 6850.0, 1700.0, 15.749999999999886, 13.549999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{431.06111111111113, 586054.3699193109, 0.0010993563857459065, 0.3226838854220338, 665747.8129978245, 2566043.5584487454, 666399.0930888013, 2755147.3848645203, 1921.6158644291124, 6767.125785294844}, SaturationTableData{1.1166666666666742, 0.0, 1.2485592115228173e-06, 0.008480838444269223, 4838.080675827921, 930.4001299669035, 4849.71067745256, 1279.3001787043177, 11.178757561552402, 9.62964134515778}, 5},
+    SaturationTableEntry{SaturationTableData{428.7166666666667, 551580.5834534691, 0.0010968592673228606, 0.34168695662141224, 655629.7115844343, 2563950.1581563195, 656234.4716689127, 2752588.7845071116, 1898.086045142249, 6787.641108160614}, SaturationTableData{1.1722222222222172, 0.0, 1.2485592115229257e-06, 0.00950153559968922, 5059.050706695125, 1046.7001462124754, 5082.310709944286, 1279.3001787043177, 11.764909643431679, 10.257661432885016}, 5},
+    SaturationTableEntry{SaturationTableData{428.61, 550000.0, 0.001097, 0.34261, 655160.0, 2563900.0, 655770.0, 2752400.0, 1897.0, 6788.599999999999}, SaturationTableData{1.6850000000000023, 0.0, 1.99999999999994e-06, 0.013505000000000017, 7280.0, 1450.0, 7305.0, 1900.0, 16.90000000000009, 14.650000000000091}, 3},
+    SaturationTableEntry{SaturationTableData{428.15, 543490.0, 0.001096, 0.34648, 653190.0, 2563500.0, 653790.0, 2751800.0, 1892.4, 6792.7}, SaturationTableData{0.0, 33665.0, 2.5000000000000066e-06, 0.019839999999999997, 10765.0, 2150.0, 10805.0, 2850.0, 25.100000000000023, 21.75}, 2},
+    SaturationTableEntry{SaturationTableData{427.59444444444443, 535660.5888635434, 0.0010956107081113377, 0.3512571629777352, 650791.6309086063, 2563019.758026353, 651396.3909930849, 2751193.184312161, 1886.781683563151, 6797.270749505771}, SaturationTableData{0.0, 36759.39850852711, 3.121398028807206e-06, 0.022230596761165095, 11955.641670074838, 2442.3003411630634, 12002.161676573218, 3140.1004386383574, 27.863157892184176, 24.07410336289331}, 4},
+    SaturationTableEntry{SaturationTableData{426.2555555555556, 517106.7969876273, 0.0010937378692940534, 0.3631247182832603, 645023.1501028114, 2561856.7578638946, 645581.3901807916, 2749564.984084719, 1873.2164496682335, 6809.41247120184}, SaturationTableData{1.2305555555555543, 0.0, 1.2485592115229257e-06, 0.010718880830924038, 5303.280740811431, 1046.7001462124754, 5326.540744060534, 1511.90021119616, 12.434797737007784, 10.885681520613161}, 5},
+    SaturationTableEntry{SaturationTableData{424.98, 500000.0, 0.001093, 0.37483, 639540.0, 2560700.0, 640090.0, 2748100.0, 1860.4, 6820.700000000001}, SaturationTableData{1.8149999999999977, 0.0, 2.0000000000000486e-06, 0.016109999999999985, 7810.0, 1600.0, 7840.0, 2150.0, 18.299999999999955, 16.050000000000637}, 3},
+    SaturationTableEntry{SaturationTableData{423.65555555555557, 482633.0105217855, 0.0010912407508710076, 0.38752156527641757, 633835.0885399593, 2559530.757538977, 634346.8086114412, 2746541.1836623265, 1846.8814739895201, 6832.43987441852}, SaturationTableData{1.3000000000000114, 0.0, 1.2485592115229257e-06, 0.012198423496578625, 5594.03078142606, 1163.0001624587458, 5617.2907846752205, 1511.90021119616, 13.167487839356681, 11.513701608339943}, 5},
+    SaturationTableEntry{SaturationTableData{423.15, 476160.0, 0.001091, 0.39248, 631660.0, 2559100.0, 632180.0, 2745900.0, 1841.8000000000002, 6837.1}, SaturationTableData{0.0, 30240.0, 2.5000000000000066e-06, 0.022999999999999993, 10735.0, 2200.0, 10770.0, 2950.0, 25.299999999999955, 22.200000000000273}, 2},
+    SaturationTableEntry{SaturationTableData{422.0388888888889, 462141.7918464891, 0.0010893679120537233, 0.4036779214735239, 626880.3475684567, 2558135.1573440265, 627392.0676399384, 2744680.3834023927, 1830.4692156969038, 6847.0936764655}, SaturationTableData{0.0, 32594.96510345346, 3.121398028807206e-06, 0.02621037924789435, 11920.751665201096, 2442.3003411632963, 11955.641670074838, 3256.400454884162, 28.156233933123644, 24.911463479864324}, 4},
+    SaturationTableEntry{SaturationTableData{421.04999999999995, 450000.0, 0.001088, 0.41392, 622650.0, 2557100.0, 623140.0, 2743400.0, 1820.5, 6856.099999999999}, SaturationTableData{1.9650000000000318, 0.0, 2.0000000000000486e-06, 0.019545000000000007, 8445.0, 1800.0, 8475.0, 2350.0, 19.950000000000045, 17.699999999999363}, 3},
+    SaturationTableEntry{SaturationTableData{420.9, 448159.2240559436, 0.0010881193528422006, 0.41552050559481846, 621995.7468861304, 2556972.157181568, 622484.206954363, 2743284.7832074426, 1818.8717780768661, 6857.141997869142}, SaturationTableData{1.3777777777777942, 0.0, 1.5606990144034945e-06, 0.013999470159200444, 5919.670826914429, 1279.3001787045505, 5931.300828539068, 1628.2002274419647, 14.004847956327012, 12.351061725310956}, 5},
+    SaturationTableEntry{SaturationTableData{418.15, 415680.0, 0.001085, 0.446, 610190.0, 2554400.0, 610640.0, 2739800.0, 1790.8, 6882.7}, SaturationTableData{0.0, 27075.0, 2.5000000000000066e-06, 0.026760000000000006, 10710.0, 2350.0, 10740.0, 3050.0, 25.500000000000114, 22.799999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{417.97777777777776, 413685.4375901018, 0.0010849979548133932, 0.4480205018707593, 609435.345131577, 2554180.956791667, 609877.2851933113, 2739563.1826875745, 1788.9361538951807, 6883.93752161219}, SaturationTableData{1.4611111111111086, 0.0, 1.5606990144037113e-06, 0.01624999813797043, 6280.200877276715, 1395.6001949501224, 6303.460880525876, 1860.8002599340398, 14.967812090842699, 13.397761871523926}, 5},
+    SaturationTableEntry{SaturationTableData{448.15, 892600.0, 0.001121, 0.21659, 740020.0, 2579400.0, 741020.0, 2772700.0, 2090.6, 6624.2}, SaturationTableData{0.0, 50210.0, 2.9999999999999645e-06, 0.011374999999999996, 10910.0, 1700.0, 10970.0, 2250.0, 24.300000000000182, 20.049999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{446.09, 850000.0, 0.001118, 0.2269, 731000.0, 2577900.0, 731950.0, 2770800.0, 2070.5, 6640.900000000001}, SaturationTableData{1.2050000000000125, 0.0, 1.4999999999999823e-06, 0.0060049999999999965, 5275.0, 850.0, 5305.0, 1100.0, 11.799999999999955, 9.800000000000182}, 3},
+    SaturationTableEntry{SaturationTableData{444.9555555555556, 827370.8751802036, 0.001116836214707227, 0.2327876221923856, 726084.2614261787, 2576975.7599758566, 726991.4015528965, 2769801.186911499, 2059.3616036707135, 6649.895368919013}, SaturationTableData{1.686111111111103, 0.0, 2.1849786201650657e-06, 0.00852765941470135, 7350.161026738642, 1279.3001787045505, 7408.311034861545, 1511.90021119616, 16.47506030138925, 13.607101900765883}, 5},
+    SaturationTableEntry{SaturationTableData{444.2611111111111, 813719.2557397302, 0.001115587655495704, 0.23650832864272384, 723037.2010005371, 2576510.5599108734, 723944.3411272549, 2769103.3868140243, 2052.5371187174064, 6655.756889737803}, SaturationTableData{0.0, 51538.31076643348, 3.433537831687883e-06, 0.013921435208480257, 12083.57168794534, 1977.1002761796117, 12141.721696068242, 2558.600357408868, 27.151401792759543, 22.608723158195517}, 4},
+    SaturationTableEntry{SaturationTableData{443.55999999999995, 800000.0, 0.001115, 0.24035, 719970.0, 2576000.0, 720870.0, 2768300.0, 2045.7, 6661.6}, SaturationTableData{1.2650000000000148, 0.0, 1.4999999999999823e-06, 0.006725000000000009, 5515.0, 950.0, 5540.0, 1250.0, 12.399999999999977, 10.349999999999909}, 3},
+    SaturationTableEntry{SaturationTableData{443.15, 792180.0, 0.001114, 0.2426, 718200.0, 2575700.0, 719080.0, 2767900.0, 2041.7, 6665.0}, SaturationTableData{0.0, 45625.0, 2.9999999999999645e-06, 0.013005000000000003, 10870.0, 1850.0, 10920.0, 2400.0, 24.449999999999932, 20.40000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{441.35555555555555, 758423.30224852, 0.0011118419778611353, 0.25227138868820037, 710383.7592329871, 2574417.1596184475, 711244.3793532064, 2766079.5863916315, 2023.9412707228735, 6679.6216530714555}, SaturationTableData{1.8000000000000114, 0.0, 2.1849786201650657e-06, 0.009741883247907382, 7850.251096595835, 1279.3001787045505, 7873.511099845055, 1860.800259933807, 17.710166473920026, 14.863142076221266}, 5},
+    SaturationTableEntry{SaturationTableData{440.9, 750000.0, 0.001111, 0.25552, 708400.0, 2574000.0, 709240.0, 2765700.0, 2019.4999999999998, 6683.7}, SaturationTableData{1.329999999999984, 0.0, 1.4999999999999823e-06, 0.007585000000000008, 5785.0, 1000.0, 5815.0, 1300.0, 13.100000000000136, 11.049999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{438.7055555555556, 710642.6342068632, 0.0011087205798323283, 0.26891468297780047, 698870.0576246465, 2572323.759326022, 699660.8977351184, 2763520.9860342224, 1997.773767067554, 6701.811696171167}, SaturationTableData{0.0, 46205.21600016777, 3.433537831687883e-06, 0.016203177167538316, 12037.051681446901, 2093.4002924256492, 12095.20168956992, 2791.2003899009433, 27.38167582492622, 23.027403216681705}, 4},
+    SaturationTableEntry{SaturationTableData{438.15, 700930.0, 0.001108, 0.27244, 696460.0, 2571900.0, 697240.0, 2762800.0, 1992.3, 6706.7}, SaturationTableData{0.0, 41350.0, 2.9999999999999645e-06, 0.014920000000000003, 10835.0, 1900.0, 10885.0, 2550.0, 24.700000000000045, 20.84999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{438.09999999999997, 700000.0, 0.001108, 0.27278, 696230.0, 2571800.0, 697000.0, 2762800.0, 1991.8, 6707.099999999999}, SaturationTableData{1.4000000000000057, 0.0, 1.4999999999999823e-06, 0.008629999999999999, 6085.0, 1100.0, 6120.0, 1450.0, 13.849999999999909, 11.699999999999818}, 3},
+    SaturationTableEntry{SaturationTableData{437.48888888888894, 689475.7293168363, 0.0011074720206208052, 0.2767244208458762, 693590.0368870843, 2571393.359196055, 694334.3569910577, 2762125.3858392723, 1985.6739133773344, 6712.278697633294}, SaturationTableData{1.0277777777777715, 0.0, 1.2485592115228173e-06, 0.006882682653519934, 4454.290622216533, 814.1001137210988, 4465.920623841113, 1046.700146212941, 10.1739254211883, 8.582941198944809}, 5},
+    SaturationTableEntry{SaturationTableData{435.4333333333334, 655001.9428509945, 0.0011049749021977595, 0.29048978615291604, 684681.4556426512, 2569765.158968613, 685402.5157433755, 2760031.9855468464, 1965.3260625349578, 6729.444580031183}, SaturationTableData{1.0277777777777715, 0.0, 1.2485592115228173e-06, 0.006882682653519934, 4454.290622216533, 814.1001137210988, 4465.920623841113, 1046.700146212941, 10.1739254211883, 8.582941198944809}, 5},
+    SaturationTableEntry{SaturationTableData{435.13, 650000.0, 0.001104, 0.2926, 683370.0, 2569400.0, 684080.0, 2759600.0, 1962.3, 6732.2}, SaturationTableData{1.4849999999999852, 0.0, 1.4999999999999823e-06, 0.009910000000000002, 6430.0, 1200.0, 6460.0, 1600.0, 14.75, 12.550000000000182}, 3},
+    SaturationTableEntry{SaturationTableData{433.2944444444445, 620528.1563851527, 0.001101853504168952, 0.30572220853349535, 675423.9743494804, 2567904.358708679, 676098.5144437064, 2757705.9852219294, 1943.9733795522172, 6747.866502604528}, SaturationTableData{1.069444444444457, 0.0, 1.2485592115228173e-06, 0.007616211190289657, 4628.740646585415, 930.4001299669035, 4652.000649834576, 1163.000162458513, 10.676341491370295, 9.2109612866725}, 5},
+    SaturationTableEntry{SaturationTableData{433.15, 618232.2022065277, 0.001101853504168952, 0.306795969455405, 674795.9542617527, 2567904.358708679, 675470.4943559786, 2757473.385189438, 1942.5079993475194, 6749.1225427799845}, SaturationTableData{0.0, 41285.80667149217, 3.121398028807206e-06, 0.018940643238802263, 12002.16167657316, 2209.700308671454, 12037.051681446843, 3023.80042239232, 27.632883860017273, 23.65542330440894}, 4},
+    SaturationTableEntry{SaturationTableData{462.6333333333333, 1241056.3127703054, 0.001140558839726162, 0.15808008177091337, 803702.8922686684, 2588838.361632935, 805121.7524668679, 2784920.1890234617, 2230.4761435735786, 6509.6375493265}, SaturationTableData{1.2361111111111143, 0.0, 1.8728388172842801e-06, 0.004001632272930877, 5477.730765180197, 697.8000974750612, 5524.250771678577, 930.4001299666706, 11.82771165220447, 9.420301315914912}, 5},
+    SaturationTableEntry{SaturationTableData{461.11, 1200000.0, 0.001138, 0.16326, 796960.0, 2587800.0, 798330.0, 2783800.0, 2215.9, 6521.7}, SaturationTableData{1.8199999999999932, 0.0, 2.5000000000000066e-06, 0.006034999999999999, 8070.0, 1050.0, 8130.0, 1350.0, 17.449999999999818, 14.050000000000182}, 3},
+    SaturationTableEntry{SaturationTableData{460.9277777777778, 1195275.1243436676, 0.001138061721303116, 0.1638858821044948, 796166.6512159364, 2587675.3614704763, 797538.9914076376, 2783524.5888285115, 2214.147621292659, 6523.035311198024}, SaturationTableData{0.0, 70085.2078850565, 3.7456776345686687e-06, 0.009023961701281696, 12246.391710689466, 1628.2002274421975, 12327.801722061646, 2093.4002924254164, 26.544315707956002, 21.35268298274059}, 4},
+    SaturationTableEntry{SaturationTableData{460.0444444444445, 1172108.7398386218, 0.0011368131620915932, 0.1669885517451292, 792282.2306733245, 2587210.1614054926, 793608.0508585274, 2782826.7887310362, 2205.6902841112596, 6529.734192133787}, SaturationTableData{1.294444444444423, 0.0, 1.8728388172842801e-06, 0.004454234987107911, 5710.3307976719225, 814.1001137210988, 5756.850804170244, 1046.7001462127082, 12.392929731159484, 10.048321403643058}, 5},
+    SaturationTableEntry{SaturationTableData{458.15, 1123500.0, 0.001134, 0.1739, 783910.0, 2586000.0, 785190.0, 2781400.0, 2187.5, 6544.7}, SaturationTableData{0.0, 60350.0, 3.500000000000031e-06, 0.00877, 10995.0, 1500.0, 11070.0, 1950.0, 24.0, 19.40000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{457.33888888888896, 1103161.1669069382, 0.0011330674844570246, 0.1769645398451971, 780349.8490064989, 2585581.9611780504, 781582.629178705, 2780733.3884386104, 2179.6902524793345, 6551.086875116526}, SaturationTableData{1.35277777777776, 0.0, 1.8728388172842801e-06, 0.004987994050033959, 5966.190833412809, 814.1001137210988, 6012.710839911189, 1046.700146212941, 13.00001581596257, 10.67634149136984}, 5},
+    SaturationTableEntry{SaturationTableData{457.21, 1100000.0, 0.001133, 0.17745, 779780.0, 2585500.0, 781030.0, 2780700.0, 2178.5, 6552.0}, SaturationTableData{1.950000000000017, 0.0, 2.5000000000000066e-06, 0.007095000000000004, 8590.0, 1150.0, 8650.0, 1550.0, 18.700000000000045, 15.150000000000091}, 3},
+    SaturationTableEntry{SaturationTableData{455.37222222222226, 1055104.7085735546, 0.0011305703660339787, 0.18466190738423574, 771673.8677945575, 2584186.3609831003, 772883.3879635143, 2779105.188211168, 2160.6821778241106, 6566.159357221991}, SaturationTableData{0.0, 63431.76709714893, 3.7456776345686687e-06, 0.010388012639870464, 12176.611700941983, 1744.5002436880022, 12269.651713938569, 2209.700308671687, 26.732721734274264, 21.562023011983456}, 4},
+    SaturationTableEntry{SaturationTableData{454.49444444444447, 1034213.5939752546, 0.0011293218068224558, 0.188220301137076, 767835.9672584439, 2583721.1609181166, 768998.9674209026, 2778407.3881136933, 2152.2248406427116, 6573.276918216237}, SaturationTableData{1.4222222222222456, 0.0, 1.8728388172843885e-06, 0.005627880645939443, 6256.940874027496, 930.4001299669035, 6291.830878901237, 1163.000162458513, 13.732705918311467, 11.095021549855574}, 5},
+    SaturationTableEntry{SaturationTableData{453.15, 1002800.0, 0.001127, 0.19384, 761920.0, 2582800.0, 763050.0, 2777200.0, 2139.2000000000003, 6584.1}, SaturationTableData{0.0, 55100.0, 2.9999999999999645e-06, 0.009970000000000007, 10950.0, 1600.0, 11015.0, 2100.0, 24.149999999999864, 19.700000000000273}, 2},
+    SaturationTableEntry{SaturationTableData{453.03, 1000000.0, 0.001127, 0.19436, 761390.0, 2582800.0, 762510.0, 2777100.0, 2138.1, 6585.0}, SaturationTableData{1.1100000000000136, 0.0, 1.4999999999999823e-06, 0.004875000000000004, 4860.0, 750.0, 4885.0, 950.0, 10.75, 8.849999999999909}, 3},
+    SaturationTableEntry{SaturationTableData{451.5, 965266.021043571, 0.001124951849582126, 0.20103051864730087, 754670.8054194121, 2581627.760625691, 755764.0255721232, 2775848.7877562842, 2123.1684445838446, 6597.141681549889}, SaturationTableData{1.4972222222222342, 0.0, 1.8728388172843885e-06, 0.0064051087551124375, 6582.580919515924, 1046.7001462127082, 6617.470924389665, 1279.3001787045505, 14.528198029433497, 11.932381666825677}, 5},
+    SaturationTableEntry{SaturationTableData{450.80999999999995, 950000.0, 0.001124, 0.20411, 751670.0, 2581300.0, 752740.0, 2775200.0, 2116.6, 6602.7}, SaturationTableData{1.1100000000000136, 0.0, 1.4999999999999823e-06, 0.004875000000000004, 4860.0, 750.0, 4885.0, 950.0, 10.75, 8.849999999999909}, 3},
+    SaturationTableEntry{SaturationTableData{449.8166666666667, 928241.1743792568, 0.0011230790107648414, 0.20866545822576332, 747320.6443926735, 2580464.7604632326, 748344.0845356372, 2774220.587528842, 2106.8399223029255, 6610.539443421412}, SaturationTableData{0.0, 57260.95931976329, 3.7456776345686687e-06, 0.012001775420763791, 12141.721696068184, 1860.800259933807, 12199.871704191144, 2442.3003411630634, 26.921127760592526, 22.190043099710692}, 4},
+    SaturationTableEntry{SaturationTableData{448.5, 900000.0, 0.001121, 0.21489, 741550.0, 2579600.0, 742560.0, 2773000.0, 2094.1, 6621.3}, SaturationTableData{1.1549999999999727, 0.0, 1.4999999999999823e-06, 0.005389999999999992, 5060.0, 850.0, 5090.0, 1100.0, 11.25, 9.300000000000182}, 3},
+    SaturationTableEntry{SaturationTableData{448.3277777777778, 896318.4481118872, 0.0011212061719475571, 0.2157323033629829, 740784.583479656, 2579534.3603332657, 741808.0236226196, 2772824.9873338914, 2092.311724273492, 6622.681165117481}, SaturationTableData{1.5861111111111086, 0.0, 1.8728388172843885e-06, 0.0073508923578410185, 6943.110969878035, 1046.7001462127082, 6978.000974751834, 1511.90021119616, 15.428360155176279, 12.769741783796235}, 5},
+    SaturationTableEntry{SaturationTableData{463.15, 1255200.0, 0.001141, 0.15636, 806000.0, 2589000.0, 807430.0, 2785300.0, 2235.5, 6505.9}, SaturationTableData{0.0, 65850.0, 3.500000000000031e-06, 0.007735000000000006, 11045.0, 1350.0, 11120.0, 1750.0, 23.799999999999955, 19.049999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{464.75, 1300000.0, 0.001144, 0.15119, 813100.0, 2589900.0, 814590.0, 2786500.0, 2250.7999999999997, 6493.599999999999}, SaturationTableData{1.7199999999999704, 0.0, 2.5000000000000066e-06, 0.005205000000000001, 7625.0, 950.0, 7685.0, 1200.0, 16.350000000000136, 13.049999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{465.10555555555555, 1310003.885701989, 0.0011443045173607305, 0.15007681722505162, 814658.3537990288, 2590233.961827885, 816170.2540102251, 2786780.989283395, 2254.1315668779876, 6490.796946694671}, SaturationTableData{1.188888888888897, 0.0, 1.8728388172842801e-06, 0.0036145789173587795, 5280.020737562212, 581.5000812292565, 5314.910742435954, 814.1001137210988, 11.304361579097758, 9.001621257429633}, 5},
+    SaturationTableEntry{SaturationTableData{466.48333333333335, 1349579.7925647756, 0.001146177356178015, 0.14583795870193142, 820775.7346535613, 2590931.7619253607, 822310.8948680066, 2787711.3894133624, 2267.236252708571, 6480.329945232543}, SaturationTableData{0.0, 77152.33411055396, 4.057817437449454e-06, 0.007862801634565417, 12304.541718812427, 1395.6001949501224, 12385.95173018449, 1860.800259933807, 26.35590968163774, 20.93400292425531}, 4},
+    SaturationTableEntry{SaturationTableData{467.48333333333335, 1378951.4586336727, 0.0011480501949952993, 0.14284765939033406, 825218.3952741532, 2591396.9619903434, 826800.075495097, 2788409.189510837, 2276.740290036183, 6472.793704179811}, SaturationTableData{1.188888888888897, 0.0, 1.8728388172843885e-06, 0.0036145789173587795, 5280.020737562212, 581.5000812292565, 5314.910742435954, 814.1001137210988, 11.304361579097758, 9.001621257429633}, 5},
+    SaturationTableEntry{SaturationTableData{468.15, 1398800.0, 0.001149, 0.14089, 828180.0, 2591700.0, 829780.0, 2788800.0, 2283.1, 6467.8}, SaturationTableData{0.0, 71800.0, 3.999999999999989e-06, 0.006839999999999999, 11090.0, 1250.0, 11175.0, 1600.0, 23.700000000000045, 18.800000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{468.18999999999994, 1400000.0, 0.001149, 0.14078, 828350.0, 2591800.0, 829960.0, 2788900.0, 2283.5, 6467.5}, SaturationTableData{1.625, 0.0, 2.5000000000000066e-06, 0.004534999999999997, 7235.0, 800.0, 7295.0, 1050.0, 15.399999999999864, 12.25}, 3},
+    SaturationTableEntry{SaturationTableData{471.43999999999994, 1500000.0, 0.001154, 0.13171, 842820.0, 2593400.0, 844550.0, 2791000.0, 2314.2999999999997, 6443.0}, SaturationTableData{1.625, 0.0, 2.5000000000000066e-06, 0.004534999999999997, 7235.0, 800.0, 7295.0, 1050.0, 15.399999999999864, 12.25}, 3},
+    SaturationTableEntry{SaturationTableData{472.0388888888889, 1519121.8744037857, 0.001154917270658675, 0.13011235543280059, 845501.1181074319, 2593722.962315261, 847245.6183511199, 2791432.98993323, 2319.9480720718466, 6438.461939384032}, SaturationTableData{0.0, 84771.04091950506, 4.369957240330023e-06, 0.006876439857462335, 12362.691726935329, 1279.3001787045505, 12467.36174155667, 1511.9002111963928, 26.209371661168007, 20.724662895012898}, 4},
+    SaturationTableEntry{SaturationTableData{473.15, 1554900.0, 0.001157, 0.12721, 850460.0, 2594200.0, 852260.0, 2792000.0, 2330.5, 6430.2}, SaturationTableData{0.0, 78050.0, 3.500000000000031e-06, 0.006064999999999994, 11140.0, 1100.0, 11240.0, 1400.0, 23.550000000000182, 18.59999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{477.59444444444443, 1704797.6883088094, 0.0011636571851393353, 0.11635947571787592, 870366.0615807977, 2596281.56267267, 872343.1618569775, 2794456.790355623, 2372.3668153941826, 6397.012613594006}, SaturationTableData{0.0, 92837.90695251187, 4.3699572403301315e-06, 0.00603366238968437, 12432.47173668287, 1046.7001462127082, 12548.771752928791, 1395.6001949501224, 26.041899637773895, 20.305982836528074}, 4},
+    SaturationTableEntry{SaturationTableData{478.1333333333334, 1723689.3232920908, 0.0011642814647450969, 0.11511715930241065, 872785.1019187117, 2596514.1627051616, 874785.4621981404, 2794921.9904206055, 2377.4328441018524, 6393.244493067639}, SaturationTableData{4.549999999999983, 0.0, 7.803495072018015e-06, 0.009379801076565726, 20538.582869019592, 1628.2002274421975, 20759.552899886796, 1977.1002761798445, 42.57976194793582, 33.28506464956581}, 5},
+    SaturationTableEntry{SaturationTableData{478.15, 1724300.0, 0.001164, 0.11508, 872860.0, 2596400.0, 874870.0, 2794800.0, 2377.6000000000004, 6393.0}, SaturationTableData{0.0, 84700.0, 3.500000000000031e-06, 0.005395000000000004, 11200.0, 950.0, 11305.0, 1250.0, 23.449999999999818, 18.34999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{478.87, 1750000.0, 0.001166, 0.11344, 876120.0, 2596700.0, 878160.0, 2795200.0, 2384.3999999999996, 6387.7}, SaturationTableData{3.329999999999984, 0.0, 5.5000000000000795e-06, 0.006926500000000002, 15000.0, 1200.0, 15155.0, 1550.0, 31.15000000000009, 24.34999999999991}, 3},
+    SaturationTableEntry{SaturationTableData{483.15000000000003, 1907710.3954467545, 0.0011723970996199958, 0.10429215093850717, 895370.5650736585, 2598374.9629650954, 897603.525385579, 2797247.990745523, 2424.4506146697304, 6356.40064792095}, SaturationTableData{0.0, 101456.35356897255, 4.36995724033024e-06, 0.005306376648972294, 12502.251746430411, 814.1001137210988, 12630.181764300738, 1163.000162458513, 25.91629562022831, 20.305982836528074}, 4},
+    SaturationTableEntry{SaturationTableData{483.15, 1907700.0, 0.001173, 0.10429, 895380.0, 2598300.0, 897610.0, 2797300.0, 2424.5, 6356.3}, SaturationTableData{0.0, 91700.0, 3.999999999999989e-06, 0.004804999999999997, 11260.0, 800.0, 11370.0, 1000.0, 23.350000000000136, 18.15000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{485.53, 2000000.0, 0.001177, 0.099587, 906120.0, 2599100.0, 908470.0, 2798300.0, 2446.7, 6339.0}, SaturationTableData{3.0149999999999864, 0.0, 4.999999999999905e-06, 0.005434999999999995, 13710.0, 900.0, 13870.0, 1100.0, 28.100000000000136, 21.800000000000182}, 3},
+    SaturationTableEntry{SaturationTableData{487.23333333333335, 2068427.1879505091, 0.001179888454889133, 0.0963575571492792, 913862.2676567509, 2599770.563160046, 916304.567997914, 2798876.190972965, 2462.592367997724, 6326.674363768508}, SaturationTableData{3.9972222222222342, 0.0, 6.867075663375983e-06, 0.006779676518569304, 18212.582544102333, 930.4001299669035, 18433.55257496948, 1279.3001787045505, 37.09505318178071, 28.888924035472883}, 5},
+    SaturationTableEntry{SaturationTableData{488.15, 2105900.0, 0.001181, 0.09468, 918020.0, 2599900.0, 920500.0, 2799300.0, 2471.2000000000003, 6320.0}, SaturationTableData{0.0, 99100.0, 3.999999999999989e-06, 0.004292999999999998, 11320.0, 700.0, 11445.0, 850.0, 23.199999999999818, 18.0}, 2},
+    SaturationTableEntry{SaturationTableData{488.7055555555556, 2128825.261838664, 0.0011823855733121788, 0.09367939764056259, 920537.8885892634, 2600003.1631925376, 923049.9689401741, 2799573.99107044, 2476.283205910187, 6315.788682247894}, SaturationTableData{0.0, 110557.43319595465, 4.994236846091486e-06, 0.004685218441239647, 12583.661757802474, 697.800097475294, 12723.221777297556, 814.1001137213316, 25.790691602682955, 19.88730277804234}, 4},
+    SaturationTableEntry{SaturationTableData{491.55999999999995, 2250000.0, 0.001187, 0.088717, 933540.0, 2600900.0, 936210.0, 2800500.0, 2502.9, 6295.4}, SaturationTableData{2.7700000000000102, 0.0, 4.999999999999905e-06, 0.0043825000000000044, 12665.0, 600.0, 12830.0, 700.0, 25.649999999999864, 19.799999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{493.15, 2319600.0, 0.00119, 0.086094, 940790.0, 2601300.0, 943550.0, 2801000.0, 2517.6, 6284.0}, SaturationTableData{0.0, 106850.0, 5e-06, 0.0038445000000000007, 11385.0, 500.0, 11525.0, 600.0, 23.149999999999864, 17.84999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{494.2611111111111, 2369314.3962243763, 0.0011923740470043617, 0.08430896075808329, 945868.0321276126, 2601398.763387488, 948682.4925207626, 2801202.1912978827, 2527.864589115553, 6276.014076691809}, SaturationTableData{0.0, 120244.56719285622, 4.994236846091486e-06, 0.004142095184227201, 12665.071769174596, 581.5000812292565, 12816.261790294258, 581.5000812292565, 25.665087585137144, 19.88730277804234}, 4},
+    SaturationTableEntry{SaturationTableData{495.2277777777778, 2413165.0526089272, 0.0011936226062158849, 0.08279820411214059, 950287.4327449555, 2601631.36341998, 953171.673147853, 2801434.7913303743, 2536.7824743612855, 6268.896515697562}, SaturationTableData{3.5777777777777544, 0.0, 6.8670756633758745e-06, 0.005137821155416701, 16456.45229878975, 581.5000812292565, 16677.422329656896, 697.800097475294, 33.033856614475326, 25.330143538349148}, 5},
+    SaturationTableEntry{SaturationTableData{497.09999999999997, 2500000.0, 0.001197, 0.079952, 958870.0, 2602100.0, 961870.0, 2801900.0, 2554.2, 6255.8}, SaturationTableData{2.7700000000000102, 0.0, 5.000000000000013e-06, 0.0043825000000000044, 12665.0, 550.0, 12830.0, 650.0, 25.649999999999864, 19.799999999999727}, 3},
+    SaturationTableEntry{SaturationTableData{498.15, 2549700.0, 0.001199, 0.078405, 963700.0, 2602300.0, 966760.0, 2802200.0, 2563.8999999999996, 6248.3}, SaturationTableData{0.0, 115050.0, 4.499999999999947e-06, 0.0034500000000000017, 11455.0, 300.0, 11605.0, 350.0, 23.050000000000182, 17.750000000000455}, 2},
+    SaturationTableEntry{SaturationTableData{499.8166666666667, 2630280.959770799, 0.001202362520696545, 0.07602477038962889, 971360.9956887062, 2602561.7635499467, 974524.3561305937, 2802365.191460341, 2579.194764285827, 6236.239471135724}, SaturationTableData{0.0, 130483.28177321143, 4.994236846091594e-06, 0.003680128275963715, 12746.481780546776, 232.60003249160945, 12920.93180491554, 348.9000487374142, 25.602285576364693, 19.677962748800383}, 4},
+    SaturationTableEntry{SaturationTableData{502.3833333333333, 2757902.9172673454, 0.0012073567575426366, 0.07252256180130719, 983200.337342535, 2602794.3635824383, 986526.5178071668, 2802830.391525325, 2602.850187590236, 6218.236228620864}, SaturationTableData{3.2472222222222342, 0.0, 6.554935860495197e-06, 0.004035967651247752, 15084.112107088615, 232.60003249184228, 15316.712139580282, 232.60003249160945, 29.872822172912493, 23.02740321668125}, 5},
+    SaturationTableEntry{SaturationTableData{503.15, 2797100.0, 0.001209, 0.071505, 986760.0, 2602900.0, 990140.0, 2802900.0, 2610.0, 6212.799999999999}, SaturationTableData{0.0, 123700.0, 5.000000000000013e-06, 0.003102500000000001, 11530.0, 150.0, 11690.0, 150.0, 23.0, 17.649999999999636}, 2},
+    SaturationTableEntry{SaturationTableData{505.37222222222226, 2912828.113644839, 0.001213599553600251, 0.06866451383770146, 997063.299279042, 2603026.96361493, 1000598.8197729164, 2803062.991557816, 2630.3993354385566, 6196.883545638123}, SaturationTableData{0.0, 141273.57693701982, 5.618516451852949e-06, 0.0032712251341899846, 12851.151795167942, 116.30001624603756, 13037.231821161346, 5e-10, 25.497615561743032, 19.468622719557516}, 4},
+    SaturationTableEntry{SaturationTableData{507.0, 3000000.0, 0.001217, 0.066667, 1004600.0, 2603200.0, 1008300.0, 2803200.0, 2645.4, 6185.6}, SaturationTableData{4.355000000000018, 0.0, 9.000000000000002e-06, 0.004803000000000002, 20400.00000000006, 100.0, 20700.0, 250.0, 39.94999999999982, 30.600000000000364}, 3},
+    SaturationTableEntry{SaturationTableData{508.15, 3062600.0, 0.001219, 0.0653, 1010000.0, 2603200.0, 1013700.0, 2803200.0, 2656.0, 6177.5}, SaturationTableData{0.0, 132750.0, 5.000000000000013e-06, 0.002796499999999997, 11620.0, 50.0, 11780.0, 100.0, 22.90000000000009, 17.549999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{533.15, 4692300.0, 0.001276, 0.042175, 1128800.0, 2598700.0, 1134800.0, 2796600.0, 2884.7, 6001.7}, SaturationTableData{0.0, 184700.0, 6.499999999999995e-06, 0.0017134999999999997, 12050.0, 900.0, 12350.0, 1250.0, 22.84999999999991, 17.600000000000364}, 2},
+    SaturationTableEntry{SaturationTableData{533.15, 4692296.023438661, 0.0012760275141763956, 0.04217508160603177, 1128854.4776888553, 2598840.163030079, 1134832.2985238926, 2796550.1906480477, 2884.663734956564, 6001.359958325576}, SaturationTableData{0.0, 204498.50131537346, 6.8670756633758745e-06, 0.0018943764636831055, 13432.651876397314, 930.4001299666706, 13723.401917011943, 1395.600194950588, 25.392945547121826, 19.677962748800383}, 4},
+    SaturationTableEntry{SaturationTableData{528.15, 4322900.0, 0.001263, 0.045941, 1104700.0, 2600500.0, 1110100.0, 2799100.0, 2839.0, 6036.900000000001}, SaturationTableData{0.0, 173350.0, 5.499999999999971e-06, 0.0018830000000000027, 12000.0, 650.0, 12200.0, 950.0, 22.84999999999991, 17.599999999999454}, 2},
+    SaturationTableEntry{SaturationTableData{527.5944444444444, 4283299.020807914, 0.0012622933628496438, 0.046381477589652394, 1101989.1739360606, 2600700.9632900124, 1107385.4946898688, 2799341.391037949, 2833.87784386232, 6040.715883823177}, SaturationTableData{0.0, 190571.0915831735, 6.554935860495197e-06, 0.002103197991810312, 13293.091856902232, 697.8000974755269, 13560.581894267816, 930.4001299669035, 25.372011544197676, 19.46862271955706}, 4},
+    SaturationTableEntry{SaturationTableData{525.5055555555556, 4136854.3759010183, 0.0012572991260035523, 0.048082015235746574, 1091964.1125356671, 2601166.163354996, 1097174.3532634818, 2800271.791167916, 2814.827901201247, 6055.369685870155}, SaturationTableData{2.5749999999999886, 0.0, 5.930656254733843e-06, 0.002249903699164252, 12281.281715563266, 581.5000812292565, 12525.511749679456, 697.8000974750612, 23.529819286862903, 18.212582544102588}, 5},
+    SaturationTableEntry{SaturationTableData{523.5, 4000000.0, 0.001252, 0.049779, 1082400.0, 2601700.0, 1087400.0, 2800800.0, 2796.6000000000004, 6069.6}, SaturationTableData{3.894999999999982, 0.0, 8.500000000000044e-06, 0.003641000000000002, 18499.99999999994, 650.0, 18850.0, 950.0, 35.65000000000032, 27.399999999999636}, 3},
+    SaturationTableEntry{SaturationTableData{523.15, 3976200.0, 0.001252, 0.050085, 1080700.0, 2601800.0, 1085700.0, 2801000.0, 2793.2999999999997, 6072.099999999999}, SaturationTableData{0.0, 162500.0, 5.499999999999971e-06, 0.0020719999999999975, 11900.0, 450.0, 12100.0, 600.0, 22.84999999999991, 17.550000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{522.0388888888889, 3902156.8376415675, 0.0012491834911286534, 0.051062326073651715, 1075402.9902222562, 2602096.5634849635, 1080264.3309013331, 2801202.1912978827, 2783.1338207739245, 6079.653129262291}, SaturationTableData{0.0, 177333.1575802907, 6.242796057614412e-06, 0.0023404242419996606, 13176.791840656428, 348.9000487374142, 13409.391873148154, 697.800097475294, 25.372011544197676, 19.46862271955706}, 4},
+    SaturationTableEntry{SaturationTableData{520.3555555555556, 3792116.5112426, 0.0012454378134940847, 0.05258182263407508, 1067401.5491045406, 2602329.1635174546, 1072123.3297641228, 2801667.391362866, 2767.7682626275214, 6091.79485095836}, SaturationTableData{2.5749999999999886, 0.0, 5.930656254733843e-06, 0.002249903699164252, 12281.281715563266, 348.900048737647, 12525.511749679456, 581.5000812294893, 23.529819286862903, 18.212582544102588}, 5},
+    SaturationTableEntry{SaturationTableData{518.15, 3651200.0, 0.00124, 0.054656, 1056900.0, 2602700.0, 1061500.0, 2802200.0, 2747.6, 6107.2}, SaturationTableData{0.0, 152100.0, 5.499999999999971e-06, 0.002285500000000003, 11749.999999999942, 200.0, 12000.0, 400.0, 22.84999999999991, 17.550000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{516.4833333333333, 3547490.522480986, 0.0012366978990134246, 0.056283800696240456, 1049049.4065409433, 2602794.3635824383, 1053445.5471550368, 2802597.7914928333, 2732.306061673832, 6119.009054759892}, SaturationTableData{0.0, 164681.2779473262, 5.930656254733843e-06, 0.0026107373112943706, 13048.861822785926, 232.60003249184228, 13281.461855277594, 232.60003249137662, 25.413879550046204, 19.46862271955797}, 4},
+    SaturationTableEntry{SaturationTableData{515.71, 3500000.0, 0.001235, 0.057061, 1045400.0000000001, 2603000.0, 1049700.0, 2802700.0, 2725.2999999999997, 6124.4}, SaturationTableData{3.894999999999982, 0.0, 8.500000000000044e-06, 0.003641000000000002, 18499.99999999994, 500.0, 18850.0, 250.0, 35.65000000000032, 27.399999999999636}, 3},
+    SaturationTableEntry{SaturationTableData{514.838888888889, 3447378.6465841816, 0.0012329522213788558, 0.057945008727171655, 1041303.8254589688, 2603026.96361493, 1045560.4060535673, 2802830.391525325, 2717.2335795683684, 6130.3134163389905}, SaturationTableData{2.7583333333333258, 0.0, 6.242796057614412e-06, 0.002681593046548289, 13048.861822785926, 116.30001624603756, 13281.461855277768, 232.60003249160945, 25.26734152957647, 19.259282690315104}, 5},
+    SaturationTableEntry{SaturationTableData{513.15, 3347000.0, 0.001229, 0.059707, 1033400.0000000001, 2603100.0, 1037500.0, 2803000.0, 2701.8, 6142.400000000001}, SaturationTableData{0.0, 142200.0, 5.000000000000013e-06, 0.0025255, 11700.000000000058, 50.0, 11900.0, 500.0, 22.899999999999864, 17.549999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{510.9277777777778, 3218127.9665863337, 0.001224836586503957, 0.06212206356932149, 1022951.6828953715, 2603259.563647422, 1026882.6234444816, 2803062.991557816, 2681.3945665620427, 6157.946300199008}, SaturationTableData{0.0, 152649.92647074745, 5.618516451852949e-06, 0.0029191314365405174, 12944.191808164702, 116.30001624603756, 13141.901835782628, 5e-10, 25.45574755589473, 19.468622719557516}, 4},
+    SaturationTableEntry{SaturationTableData{508.8777777777778, 3102640.7819257635, 0.001220466629263627, 0.06445062649881168, 1013368.5615567123, 2603259.563647422, 1017159.9420863274, 2803295.591590308, 2662.595831936061, 6172.181422187501}, SaturationTableData{2.9805555555555827, 0.0, 6.242796057614412e-06, 0.003252808885820014, 13967.631951128249, 116.30001624603756, 14200.231983619975, 232.60003249160945, 27.318873816153655, 20.93400292425531}, 5},
+    SaturationTableEntry{SaturationTableData{558.98, 7000000.0, 0.001352, 0.027378, 1258000.0, 2581000.0, 1267500.0, 2772600.0, 3122.0, 5814.8}, SaturationTableData{4.589999999999975, 0.0, 1.6000000000000064e-05, 0.0019264999999999994, 24000.0, 4450.0, 24800.0, 6000.0, 42.84999999999991, 34.90000000000009}, 3},
+    SaturationTableEntry{SaturationTableData{558.15, 6914600.0, 0.001349, 0.027756, 1253700.0, 2581800.0, 1263100.0, 2773700.0, 3114.3999999999996, 5821.0}, SaturationTableData{0.0, 249000.0, 7.999999999999978e-06, 0.0011009999999999995, 12750.0, 2300.0, 13200.0, 3100.0, 23.149999999999864, 18.449999999999818}, 2},
+    SaturationTableEntry{SaturationTableData{557.9555555555555, 6894757.293168363, 0.001347819668838962, 0.02784536753538354, 1252737.2549939498, 2582092.9606906744, 1262017.9962903697, 2773987.98749635, 3112.5094227841614, 5822.164893293949}, SaturationTableData{3.5083333333333258, 0.0, 1.0924893100825329e-05, 0.0017177053352526173, 17898.572500238428, 3023.8004223925527, 18421.9225733449, 4186.8005848512985, 32.40583652674786, 25.95816362607684}, 5},
+    SaturationTableEntry{SaturationTableData{555.3722222222223, 6634411.257778326, 0.001339704033964063, 0.029062088487012597, 1239479.053141921, 2584418.961015592, 1248364.3743831052, 2777244.3879512344, 3088.6027914446613, 5841.4241759842635}, SaturationTableData{0.0, 267171.8451102739, 8.739914480660155e-06, 0.001276027514176395, 14095.561968998634, 2326.0003249172587, 14502.612025859184, 3140.1004386385903, 25.623219579288843, 20.305982836528074}, 4},
+    SaturationTableEntry{SaturationTableData{553.15, 6416600.0, 0.001333, 0.030153, 1228200.0, 2586400.0, 1236700.0, 2779900.0, 3068.1, 5857.9}, SaturationTableData{0.0, 235100.0, 7.999999999999978e-06, 0.0011985, 12650.0, 1950.0, 13000.0, 2650.0, 23.0, 18.25}, 2},
+    SaturationTableEntry{SaturationTableData{550.9388888888889, 6205281.563851527, 0.0013259698826373113, 0.03128077820588877, 1216940.109993473, 2588140.5615354595, 1225174.1511436799, 2782361.5886660526, 3047.6977497306657, 5874.0812205461025}, SaturationTableData{3.5083333333333258, 0.0, 1.0924893100825329e-05, 0.0017177053352526173, 17898.572500238428, 2674.9003736549057, 18421.9225733449, 3605.300503621809, 32.40583652674786, 25.95816362607684}, 5},
+    SaturationTableEntry{SaturationTableData{549.8166666666667, 6100067.567557778, 0.0013222242050027427, 0.03187009815372758, 1211287.9292039238, 2589070.9616654264, 1219359.1503313868, 2783524.5888285115, 3037.3563522860836, 5882.03614165732}, SaturationTableData{0.0, 250383.11110140942, 8.1156348748988e-06, 0.001404004833357491, 13909.481943005347, 1977.1002761796117, 14293.271996616735, 2674.900373654673, 25.51854956466741, 20.09664280728566}, 4},
+    SaturationTableEntry{SaturationTableData{548.74, 6000000.0, 0.001319, 0.032449, 1205800.0, 2589900.0, 1213800.0, 2784600.0, 3027.5, 5890.2}, SaturationTableData{5.1200000000000045, 0.0, 1.6499999999999913e-05, 0.0025354999999999996, 26100.0, 3550.0, 26850.0, 4800.0, 47.25, 37.69999999999982}, 3},
+    SaturationTableEntry{SaturationTableData{548.15, 5946400.0, 0.001317, 0.032767, 1202900.0, 2590300.0, 1210700.0, 2785200.0, 3022.1, 5894.4}, SaturationTableData{0.0, 221700.0, 7.000000000000062e-06, 0.0013069999999999991, 12500.0, 1700.0, 12800.0, 2250.0, 22.950000000000045, 18.050000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{544.2611111111112, 5599301.345354959, 0.0013059929352529451, 0.03496527643909283, 1183468.965317913, 2593025.1622177856, 1190772.6063381534, 2788874.389575821, 2986.319253156749, 5922.229427271891}, SaturationTableData{0.0, 234421.74796772422, 7.803495072018123e-06, 0.0015475891426826247, 13735.031918636523, 1628.2002274421975, 14072.30196574959, 2093.4002924256492, 25.43481355297058, 19.88730277804234}, 4},
+    SaturationTableEntry{SaturationTableData{543.3000000000001, 5515805.834534691, 0.0013028715372241377, 0.03553399515994151, 1178677.4046485834, 2593490.3622827693, 1185864.7456525778, 2789572.189673296, 2977.526971928561, 5929.346988266137}, SaturationTableData{3.8194444444444002, 0.0, 1.1237032903706006e-05, 0.0021266084770263684, 19131.352672444773, 2209.700308671454, 19654.70274555101, 3023.8004223925527, 35.08538890105228, 27.632883860017046}, 5},
+    SaturationTableEntry{SaturationTableData{543.15, 5503000.0, 0.001303, 0.035622, 1177900.0, 2593700.0, 1185100.0, 2789700.0, 2976.2, 5930.5}, SaturationTableData{0.0, 208850.0, 6.999999999999953e-06, 0.0014275000000000017, 12300.0, 1400.0, 12650.0, 1900.0, 22.899999999999864, 17.84999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{538.7055555555556, 5130457.849419511, 0.001290385945108909, 0.03838632867866556, 1155998.90148064, 2596281.56267267, 1162628.0024066542, 2793061.190160672, 2935.4496260508076, 5962.004032827976}, SaturationTableData{0.0, 219080.91299042478, 7.17921546625666e-06, 0.0017105261197863653, 13572.211895892397, 1279.3001787045505, 13897.851941380766, 1744.5002436877694, 25.392945547121826, 19.677962748800383}, 4},
+    SaturationTableEntry{SaturationTableData{538.15, 5085300.0, 0.001289, 0.038748, 1153300.0, 2596500.0, 1159800.0, 2793500.0, 2930.4, 5966.2}, SaturationTableData{0.0, 196500.0, 6.499999999999995e-06, 0.0015629999999999984, 12250.0, 1100.0, 12500.0, 1550.0, 22.850000000000136, 17.75}, 2},
+    SaturationTableEntry{SaturationTableData{537.0899999999999, 5000000.0, 0.001286, 0.039448, 1148100.0, 2597000.0, 1154500.0, 2794200.0, 2920.7000000000003, 5973.7}, SaturationTableData{5.8250000000000455, 0.0, 1.650000000000002e-05, 0.003499499999999999, 28850.0, 2350.0, 29650.0, 3300.0, 53.399999999999864, 41.75}, 3},
+    SaturationTableEntry{SaturationTableData{534.8888888888889, 4826330.1052178545, 0.0012803974714167257, 0.04094587506228748, 1137321.118871554, 2597909.762900112, 1143508.279735834, 2795619.7905180813, 2900.573577178998, 5989.218236629508}, SaturationTableData{4.205555555555577, 0.0, 1.1237032903706006e-05, 0.002705939951172985, 20678.142888514674, 1628.2002274419647, 21178.232958371867, 2326.0003249172587, 38.47669737478145, 29.935624181685853}, 5},
+    SaturationTableEntry{SaturationTableData{588.15, 10556000.0, 0.001472, 0.016849, 1416100.0, 2537200.0, 1431600.0, 2715000.0, 3399.4, 5581.599999999999}, SaturationTableData{0.0, 345500.0, 1.2500000000000033e-05, 0.0006895, 14200.0, 4950.0, 14800.0, 6450.0, 24.40000000000009, 21.350000000000364}, 2},
+    SaturationTableEntry{SaturationTableData{584.15, 10000000.0, 0.001452, 0.018028, 1393300.0, 2545200.0, 1407800.0, 2725500.0, 3360.3, 5615.9}, SaturationTableData{3.5400000000000205, 0.0, 1.699999999999998e-05, 0.00102, 20300.0, 6650.0, 21200.0, 8700.0, 34.799999999999955, 30.749999999999545}, 3},
+    SaturationTableEntry{SaturationTableData{583.15, 9865000.0, 0.001447, 0.018333, 1387700.0, 2547100.0, 1402000.0, 2727900.0, 3350.6, 5624.3}, SaturationTableData{0.0, 327800.0, 1.0999999999999942e-05, 0.0007419999999999996, 13850.0, 4350.0, 14450.0, 5750.0, 24.09999999999991, 20.699999999999818}, 2},
+    SaturationTableEntry{SaturationTableData{583.15, 9865018.735065294, 0.0014477044057607932, 0.018333219182396384, 1387715.0538488997, 2546970.3557844236, 1401996.6958438917, 2727933.181062988, 3350.5290360329464, 5624.129225630491}, SaturationTableData{0.0, 363008.97148531396, 1.2485592115228823e-05, 0.0008209276815763014, 15398.122150952462, 4884.60068232636, 16049.402241929201, 6280.200877276715, 26.753655737198642, 23.02740321668125}, 4},
+    SaturationTableEntry{SaturationTableData{581.5611111111111, 9652660.210435709, 0.001440213050491656, 0.01882889718937097, 1378829.7326077155, 2549994.156206816, 1392715.9545474716, 2731654.781582856, 3335.1216098806945, 5637.526987502015}, SaturationTableData{4.941666666666663, 0.0, 2.341048521605426e-05, 0.001449889384380957, 28144.603931499063, 8722.501218439778, 29423.904110203614, 11397.401592094684, 48.44128276672723, 42.496025936238766}, 5},
+    SaturationTableEntry{SaturationTableData{578.15, 9209400.0, 0.001425, 0.019932, 1360000.0, 2555800.0, 1373100.0, 2739400.0, 3302.4, 5665.7}, SaturationTableData{0.0, 310750.0, 1.0499999999999984e-05, 0.0007994999999999999, 13650.0, 3900.0, 14150.0, 5100.0, 23.800000000000182, 20.09999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{577.5944444444444, 9139000.792094667, 0.0014227332215303356, 0.020117410295662597, 1356918.8095469947, 2556739.5571490764, 1369897.8913600333, 2740493.5828175414, 3297.021724558549, 5670.184032063854}, SaturationTableData{0.0, 342324.6996058095, 1.1549172706586792e-05, 0.0008920955566331067, 15084.112107088557, 4186.800584851066, 15653.982186693349, 5582.400779801421, 26.41871169041042, 22.190043099710692}, 4},
+    SaturationTableEntry{SaturationTableData{576.5, 9000000.0, 0.001418, 0.020489, 1350900.0, 2558500.0, 1363700.0, 2742900.0, 3286.6, 5679.1}, SaturationTableData{3.8249999999999886, 0.0, 1.699999999999998e-05, 0.0012305000000000007, 21200.0, 6000.0, 22050.0, 7900.0, 36.850000000000136, 31.600000000000364}, 3},
+    SaturationTableEntry{SaturationTableData{573.15, 8587900.0, 0.001404, 0.021659, 1332700.0, 2563600.0, 1344800.0, 2749600.0, 3254.7999999999997, 5705.9}, SaturationTableData{0.0, 294450.0, 1.0000000000000026e-05, 0.0008635000000000014, 13350.0, 3450.0, 13850.0, 4550.0, 23.59999999999991, 19.550000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{572.0388888888889, 8454351.392883047, 0.001399634876117162, 0.022061416988003738, 1326750.5853328176, 2565113.1583187785, 1338589.9269866466, 2751658.3843771443, 3244.1843011777282, 5714.564118263275}, SaturationTableData{0.0, 322329.9034556211, 1.0924893100825329e-05, 0.0009720033461705704, 14793.362066474045, 3721.600519867614, 15328.34214120498, 4884.60068232636, 26.12563564947095, 21.562023011983}, 4},
+    SaturationTableEntry{SaturationTableData{570.5166666666667, 8273708.751802037, 0.0013933920800595476, 0.022624517192400564, 1318586.324192358, 2567439.1586436955, 1330123.2858039476, 2754449.5847670455, 3229.823575171689, 5726.287159900858}, SaturationTableData{5.52222222222224, 0.0, 2.2786205610292798e-05, 0.0018978100015147967, 30121.70420767879, 7326.901023489423, 31296.334371762, 9769.201364652254, 52.6490173545028, 44.380086199421385}, 5},
+    SaturationTableEntry{SaturationTableData{568.16, 8000000.0, 0.001384, 0.023525, 1306000.0, 2570500.0, 1317100.0, 2758700.0, 3207.7, 5745.0}, SaturationTableData{4.170000000000016, 0.0, 1.6000000000000064e-05, 0.0015180000000000003, 22450.0, 5250.0, 23300.0, 6950.0, 39.450000000000045, 32.94999999999982}, 3},
+    SaturationTableEntry{SaturationTableData{568.15, 7999000.0, 0.001384, 0.023528, 1306000.0, 2570500.0, 1317100.0, 2758700.0, 3207.6, 5745.0}, SaturationTableData{0.0, 278600.0, 9.000000000000002e-06, 0.0009344999999999996, 13150.0, 3000.0, 13650.0, 4000.0, 23.399999999999864, 19.200000000000273}, 2},
+    SaturationTableEntry{SaturationTableData{566.4833333333333, 7809691.585971805, 0.0013777850899155113, 0.02418459192719842, 1297163.8611998695, 2572556.3593585137, 1307933.2427042366, 2761427.585741797, 3191.9330298787863, 5757.688164287241}, SaturationTableData{0.0, 303024.5830347496, 9.676333889302295e-06, 0.0010615874695973412, 14537.502030732925, 3256.400454884162, 15025.962098965538, 4303.100601097103, 25.916295620228084, 21.143342953498177}, 4},
+    SaturationTableEntry{SaturationTableData{563.15, 7441800.0, 0.001366, 0.025554, 1279700.0, 2576500.0, 1289800.0, 2766700.0, 3160.8, 5783.400000000001}, SaturationTableData{0.0, 263600.0, 8.500000000000044e-06, 0.001013, 13000.0, 2650.0, 13350.0, 3500.0, 23.200000000000273, 18.799999999999727}, 2},
+    SaturationTableEntry{SaturationTableData{560.9277777777778, 7203642.419902306, 0.0013584324221369067, 0.026510033458659807, 1268088.8571384037, 2579069.160268282, 1277881.3185063056, 2770033.786943991, 3140.10043863833, 5799.974850194238}, SaturationTableData{0.0, 284615.58106199, 9.364194086421834e-06, 0.0011627207657306932, 14304.901998241316, 2674.9003736549057, 14758.472061600187, 3605.3005036215764, 25.748823596834427, 20.724662895012898}, 4},
+    SaturationTableEntry{SaturationTableData{610.9277777777778, 14198373.693821613, 0.0016187570177394297, 0.011248894216215496, 1555768.5773241732, 2473003.545452054, 1578749.4605343558, 2632799.767773872, 3635.315211814519, 5360.360788784872}, SaturationTableData{0.0, 484011.96198041923, 2.153764639876998e-05, 0.0005727765382861263, 18038.13251973351, 9652.901348406682, 19096.4626675708, 12211.50170581555, 30.12403020800366, 29.51694412320012}, 4},
+    SaturationTableEntry{SaturationTableData{609.8199999999999, 14000000.0, 0.00161, 0.011487, 1548400.0, 2477100.0, 1571000.0, 2637900.0, 3623.2000000000003, 5372.8}, SaturationTableData{2.7450000000000045, 0.0, 2.20000000000001e-05, 0.0005730000000000006, 18550.0, 9750.0, 19650.0, 12400.0, 30.799999999999955, 30.40000000000009}, 3},
+    SaturationTableEntry{SaturationTableData{608.6222222222223, 13789514.586336726, 0.0016000286295665862, 0.011745820782401608, 1540579.7952024634, 2481377.1466217563, 1562653.5382859285, 2643266.7692359993, 3610.026936282018, 5385.481592293979}, SaturationTableData{4.105555555555554, 0.0, 2.9029001667907318e-05, 0.0009414136454882604, 25934.903622827725, 12909.301803291077, 27400.28382752568, 16514.60230691242, 43.54272608245151, 41.868005848511075}, 5},
+    SaturationTableEntry{SaturationTableData{608.15, 13707000.0, 0.001597, 0.011848, 1537500.0, 2483000.0, 1559400.0, 2645400.0, 3605.0, 5390.7}, SaturationTableData{0.0, 424500.0, 1.8499999999999962e-05, 0.0005325, 15900.0, 8100.0, 16800.0, 10300.0, 26.700000000000045, 25.75}, 2},
+    SaturationTableEntry{SaturationTableData{605.3722222222223, 13230349.769860774, 0.0015756817249418897, 0.0124681122862676, 1519692.3122847062, 2492309.3481488675, 1540556.5351992142, 2657222.771185503, 3575.0671513985117, 5419.394677031272}, SaturationTableData{0.0, 457467.146401722, 1.872838817284345e-05, 0.000609609035026052, 17305.44241738459, 8257.301153456327, 18259.102550600655, 10583.301478373585, 29.119198067639672, 27.6328838600175}, 4},
+    SaturationTableEntry{SaturationTableData{604.0, 13000000.0, 0.001566, 0.012781, 1511000.0, 2496600.0, 1531400.0, 2662700.0, 3560.6, 5433.6}, SaturationTableData{2.909999999999968, 0.0, 1.9999999999999944e-05, 0.000647, 18700.0, 8850.0, 19800.0, 11350.0, 31.300000000000182, 30.149999999999636}, 3},
+    SaturationTableEntry{SaturationTableData{603.15, 12858000.0, 0.00156, 0.012979, 1505700.0, 2499200.0, 1525800.0, 2666000.0, 3551.6, 5442.2}, SaturationTableData{0.0, 403500.0, 1.5999999999999955e-05, 0.0005655, 15350.0, 7100.0, 16200.0, 9150.0, 25.899999999999864, 24.300000000000182}, 2},
+    SaturationTableEntry{SaturationTableData{600.4111111111112, 12410563.127703054, 0.0015419706262307716, 0.013628648073378128, 1488709.987956808, 2507195.7502283384, 1507852.9706308772, 2676295.973849824, 3522.941484117115, 5469.217603991001}, SaturationTableData{4.105555555555554, 0.0, 2.621974344198068e-05, 0.0009414136454882604, 25934.903622827725, 11397.401592094684, 27400.28382752568, 14653.802046979079, 43.54272608245151, 41.65866581926821}, 5},
+    SaturationTableEntry{SaturationTableData{599.8166666666667, 12315415.47705733, 0.0015382249485962028, 0.01377223238270326, 1485081.427449937, 2508823.95045578, 1504038.330098013, 2678389.37414225, 3516.8287552632323, 5474.660444751307}, SaturationTableData{0.0, 431956.5444169976, 1.6543409552678278e-05, 0.0006520600482178302, 16700.682332906057, 7210.601007243618, 17561.302453125594, 9304.001299669035, 28.323705956517642, 26.16750365531925}, 4},
+    SaturationTableEntry{SaturationTableData{598.15, 12051000.0, 0.001528, 0.014183, 1475000.0, 2513400.0, 1493400.0, 2684300.0, 3499.8, 5490.8}, SaturationTableData{0.0, 383500.0, 1.4500000000000081e-05, 0.0006020000000000001, 14950.0, 6300.0, 15700.0, 8150.0, 25.350000000000136, 23.200000000000273}, 2},
+    SaturationTableEntry{SaturationTableData{597.8299999999999, 12000000.0, 0.001526, 0.014264, 1473000.0, 2514300.0, 1491300.0, 2685400.0, 3496.4, 5493.9}, SaturationTableData{3.0850000000000364, 0.0, 1.9000000000000028e-05, 0.0007415, 19000.0, 8050.0, 20050.0, 10450.0, 32.09999999999991, 30.149999999999636}, 3},
+    SaturationTableEntry{SaturationTableData{594.2611111111112, 11451502.388223335, 0.0015051381294908463, 0.015175612936454991, 1451680.0627841249, 2523245.1524702674, 1468915.7251917617, 2696997.376741588, 3460.181343350197, 5526.995452061946}, SaturationTableData{0.0, 408169.63175556716, 1.529485034115546e-05, 0.0007016902768758656, 16200.59226304898, 6396.50089352252, 16979.802371896105, 8257.301153456327, 27.6747518658658, 24.70212345062191}, 4},
+    SaturationTableEntry{SaturationTableData{593.15, 11284000.0, 0.001499, 0.01547, 1445100.0, 2526000.0, 1462000.0, 2700600.0, 3449.1, 5537.200000000001}, SaturationTableData{0.0, 364000.0, 1.3499999999999949e-05, 0.0006435, 14500.0, 5600.0, 15200.0, 7200.0, 24.84999999999991, 22.199999999999363}, 2},
+    SaturationTableEntry{SaturationTableData{591.4444444444445, 11031611.669069381, 0.0014895311393468102, 0.015929118420609057, 1435118.9404707137, 2529990.553412528, 1451563.7627678788, 2705603.5779437823, 3432.004175414149, 5552.534935629537}, SaturationTableData{4.4833333333333485, 0.0, 2.4659044427577078e-05, 0.0011502351736154643, 26795.523743047146, 10001.801397144096, 28144.60393149918, 13025.601819536882, 45.46865435148311, 41.65866581926821}, 5},
+    SaturationTableEntry{SaturationTableData{591.23, 11000000.0, 0.001488, 0.015988, 1433900.0, 2530400.0, 1450200.0, 2706300.0, 3429.9, 5554.400000000001}, SaturationTableData{3.2999999999999545, 0.0, 1.8000000000000004e-05, 0.000861999999999999, 19550.0, 7400.0, 20550.0, 9600.0, 33.25, 30.250000000000455}, 3},
+    SaturationTableEntry{SaturationTableData{588.7055555555556, 10635163.1247122, 0.0014745484288085353, 0.01669136381924378, 1419278.878258027, 2536038.1542573124, 1434956.1204479695, 2713511.979048501, 3404.8318396184654, 5576.39969896319}, SaturationTableData{0.0, 385072.1948234532, 1.3422011523871072e-05, 0.0007578754413943949, 15781.912204563618, 5466.100763555616, 16479.71230203891, 7210.601007243618, 27.151401792759543, 23.8647633336509}, 4},
+    SaturationTableEntry{SaturationTableData{628.15, 17570000.0, 0.001808, 0.007872, 1682200.0, 2388600.0, 1714000.0, 2526900.0, 3844.2, 5138.4}, SaturationTableData{0.0, 520500.0, 3.35e-05, 0.00046100000000000047, 19900.0, 14850.0, 21400.0, 18500.0, 32.700000000000045, 36.500000000000455}, 2},
+    SaturationTableEntry{SaturationTableData{627.5944444444444, 17452009.66046776, 0.0018004223830160105, 0.00797454768399671, 1677581.2143400912, 2392291.334177424, 1709005.4787297237, 2531386.153607478, 3836.6165839341597, 5146.833958957465}, SaturationTableData{0.0, 573299.0689269472, 3.6520356937044655e-05, 0.0005119092767243852, 21806.253046099446, 15933.10222568363, 23434.453273541643, 19887.302778042853, 35.88088101217386, 39.77460555608559}, 4},
+    SaturationTableEntry{SaturationTableData{626.5777777777778, 17236893.232920907, 0.0017854396724777356, 0.008163080124936667, 1669300.6531833855, 2398571.5350547014, 1700073.6374820413, 2539294.554712197, 3823.009482033394, 5162.325121121415}, SaturationTableData{7.566666666666663, 0.0, 9.270552145557468e-05, 0.0014408373300974168, 64360.42899046105, 41402.80578352744, 68710.04959805636, 51986.107261901256, 106.49127287568786, 111.57823558628206}, 5},
+    SaturationTableEntry{SaturationTableData{625.44, 17000000.0, 0.00177, 0.008374, 1660200.0, 2405400.0, 1690300.0, 2547700.0, 3808.2, 5179.1}, SaturationTableData{2.349999999999966, 0.0, 3.000000000000008e-05, 0.0004349999999999996, 18800.0, 13300.0, 20200.0, 16650.0, 31.049999999999727, 33.75}, 3},
+    SaturationTableEntry{SaturationTableData{623.15, 16529000.0, 0.001741, 0.008806, 1642400.0, 2418300.0, 1671200.0, 2563900.0, 3778.7999999999997, 5211.400000000001}, SaturationTableData{0.0, 494000.0, 2.799999999999992e-05, 0.00046699999999999953, 18450.0, 12450.0, 19750.0, 15600.0, 30.449999999999818, 32.54999999999973}, 2},
+    SaturationTableEntry{SaturationTableData{622.0388888888889, 16305411.522613864, 0.0017273816691419212, 0.009017094625618328, 1633968.7082478923, 2424157.5386287915, 1662136.5721826404, 2571160.7591635636, 3764.854821909812, 5226.383170069636}, SaturationTableData{0.0, 541583.1853783755, 2.9341141470787995e-05, 0.0005212734708108088, 20143.16281378374, 13258.201852028258, 21527.133007109398, 16630.902323158458, 33.285064649566266, 35.169124912748885}, 4},
+    SaturationTableEntry{SaturationTableData{620.51, 16000000.0, 0.00171, 0.009312, 1622600.0, 2432000.0, 1649900.0, 2581000.0, 3746.1000000000004, 5246.6}, SaturationTableData{2.465000000000032, 0.0, 2.649999999999994e-05, 0.00046900000000000067, 18550.0, 11850.0, 19800.0, 14900.0, 30.65000000000009, 32.09999999999991}, 3},
+    SaturationTableEntry{SaturationTableData{618.15, 15541000.0, 0.001685, 0.009772, 1605500.0, 2443200.0, 1631700.0, 2595100.0, 3717.9, 5276.5}, SaturationTableData{0.0, 470000.0, 2.3500000000000083e-05, 0.0004829999999999999, 17400.0, 10650.0, 18550.0, 13450.0, 28.84999999999991, 29.65000000000009}, 2},
+    SaturationTableEntry{SaturationTableData{616.4833333333333, 15222245.151857113, 0.0016686993862003452, 0.010103341139643243, 1593682.3826203248, 2450673.942332848, 1619082.3061684216, 2604422.5638098805, 3698.2846926106795, 5296.721419895134}, SaturationTableData{0.0, 511935.72901775036, 2.4971184230457755e-05, 0.0005431232570124577, 18956.902648075833, 11164.801559603075, 20166.4228170329, 14188.601981995627, 31.48474039808025, 31.819684444868926}, 4},
+    SaturationTableEntry{SaturationTableData{615.31, 15000000.0, 0.001657, 0.010341, 1585500.0, 2455700.0, 1610300.0, 2610800.0, 3684.8, 5310.8}, SaturationTableData{2.6000000000000227, 0.0, 2.3499999999999975e-05, 0.0005144999999999993, 18550.0, 10700.0, 19650.0, 13550.0, 30.65000000000009, 31.0}, 3},
+    SaturationTableEntry{SaturationTableData{613.15, 14601000.0, 0.001638, 0.010783, 1570700.0, 2464500.0, 1594600.0, 2622000.0, 3660.2000000000003, 5335.8}, SaturationTableData{0.0, 447000.0, 2.050000000000001e-05, 0.0005054999999999999, 16600.0, 9250.0, 17600.0, 11700.0, 27.600000000000136, 27.449999999999818}, 2},
+    SaturationTableEntry{SaturationTableData{647.0944444444444, 22063912.81386808, 0.0031057910386631943, 0.0031057910386631943, 2015735.1415765658, 2015711.8815733166, 2084259.1111486289, 2084328.8911583764, 4406.900691596729, 4407.026295614275}, SaturationTableData{0.0, 369214.253049165, 0.0004073424427593435, 0.0007825344858219722, 75432.19053706748, 95017.11327287089, 85259.54190984298, 110485.01543357084, 130.50257422980894, 173.33354421283548}, 4},
+    SaturationTableEntry{SaturationTableData{647.0944444444444, 22063912.81386808, 0.0031057910386631943, 0.0031057910386631943, 2015735.1415765658, 2015711.8815733166, 2084259.1111486289, 2084328.8911583764, 4406.900691596729, 4407.026295614275}, SaturationTableData{2.691666666666663, 0.0, 0.00048131957604207517, 0.0010878072130393194, 96784.87351980817, 120021.61676573171, 108880.07520937792, 140374.11960875778, 166.13224720689186, 222.10977102635115}, 5},
+    SaturationTableEntry{SaturationTableData{647.0999999999999, 22064000.0, 0.003106, 0.003106, 2015700.0, 2015700.0, 2084300.0000000002, 2084300.0000000002, 4407.0, 4407.0}, SaturationTableData{0.12000000000000455, 0.0, 0.00020149999999999986, 0.00026900000000000014, 32000.0, 38350.0, 36600.00000000012, 44149.99999999988, 56.40000000000009, 68.44999999999982}, 3},
+    SaturationTableEntry{SaturationTableData{647.0999999999999, 22064000.0, 0.003106, 0.003106, 2015700.0, 2015700.0, 2084300.0000000002, 2084300.0000000002, 4407.0, 4407.0}, SaturationTableData{0.0, 510000.0, 0.0004445, 0.0009235000000000001, 85600.0, 107200.0, 96550.00000000012, 124999.99999999988, 147.54999999999973, 196.95000000000027}, 2},
+    SaturationTableEntry{SaturationTableData{646.8599999999999, 22000000.0, 0.002703, 0.003644, 1951700.0, 2092400.0, 2011100.0, 2172600.0, 4294.2, 4543.9}, SaturationTableData{0.12000000000000455, 0.0, 0.00020149999999999986, 0.00026900000000000014, 32000.0, 38350.0, 36600.00000000012, 44149.99999999988, 56.40000000000009, 68.44999999999982}, 3},
+    SaturationTableEntry{SaturationTableData{644.2611111111112, 21325484.30776975, 0.0022911061531445073, 0.004670860010307139, 1864870.7605024308, 2205746.1081190584, 1913740.027328943, 2305298.922025518, 4145.895543137111, 4753.693384039946}, SaturationTableData{0.0, 369214.253049165, 0.00012953801819550023, 0.0006146032718721437, 40635.22567630501, 45705.90638462454, 44798.766257906915, 54777.307651801966, 67.53309343364845, 91.06291272051203}, 4},
+    SaturationTableEntry{SaturationTableData{643.15, 21044000.0, 0.002217, 0.004953, 1844500.0, 2230100.0, 1891200.0, 2334300.0, 4111.900000000001, 4800.900000000001}, SaturationTableData{0.0, 510000.0, 0.00010099999999999996, 0.0005279999999999998, 33650.0, 36750.0, 37000.0, 44200.0, 55.75000000000023, 74.19999999999982}, 2},
+    SaturationTableEntry{SaturationTableData{642.98, 21000000.0, 0.002207, 0.004994, 1841600.0, 2233500.0, 1888000.0, 2338400.0, 4107.1, 4807.599999999999}, SaturationTableData{1.9399999999999409, 0.0, 8.450000000000016e-05, 0.0004339999999999999, 27900.0, 30650.0, 30700.0, 36850.0, 46.25000000000023, 61.70000000000027}, 3},
+    SaturationTableEntry{SaturationTableData{641.7111111111111, 20684271.87950509, 0.002143151886579044, 0.005281405464741833, 1822165.3945369495, 2255755.11510478, 1866498.960729873, 2365077.130375892, 4074.6361971829456, 4851.245837666977}, SaturationTableData{2.691666666666663, 0.0, 0.00017885610705065417, 0.0010878072130393194, 76432.37067678198, 71408.20997496066, 83212.66162391589, 87108.71216815244, 125.81335757477586, 155.53964172721862}, 5},
+    SaturationTableEntry{SaturationTableData{638.9, 20000000.0, 0.002038, 0.005862, 1785800.0, 2294800.0, 1826600.0, 2412100.0, 4014.6, 4931.0}, SaturationTableData{2.0400000000000205, 0.0, 5.599999999999995e-05, 0.0004074999999999999, 22750.0, 22200.0, 24900.0, 26950.0, 37.5, 47.29999999999973}, 3},
+    SaturationTableEntry{SaturationTableData{638.7055555555556, 19954117.08215856, 0.002032030116753507, 0.005900066554051426, 1783600.3091498208, 2297157.9208883075, 1824142.494813129, 2414853.537329122, 4010.8293562698145, 4935.81920948097}, SaturationTableData{0.0, 643970.3311819248, 6.867075663375907e-05, 0.0005253312882482568, 28726.10401272832, 27330.50381777808, 31307.964373386465, 33378.104662563186, 47.2271105971206, 58.824548217157826}, 4},
+    SaturationTableEntry{SaturationTableData{638.15, 19822000.0, 0.002015, 0.006009, 1777200.0, 2303600.0, 1817200.0, 2422700.0, 4000.4, 4949.3}, SaturationTableData{0.0, 578000.0, 5.999999999999994e-05, 0.0004705, 25500.0, 24150.0, 27850.0, 29450.0, 41.950000000000045, 52.19999999999982}, 2},
+    SaturationTableEntry{SaturationTableData{634.62, 19000000.0, 0.001926, 0.006677, 1740300.0, 2339200.0, 1776800.0, 2466000.0, 3939.6, 5025.599999999999}, SaturationTableData{2.1399999999999864, 0.0, 4.299999999999996e-05, 0.0004074999999999999, 20600.0, 17900.0, 22300.0, 22000.0, 33.799999999999955, 40.40000000000009}, 3},
+    SaturationTableEntry{SaturationTableData{633.15, 18666000.0, 0.001895, 0.00695, 1726200.0, 2351900.0, 1761500.0, 2481600.0, 3916.5, 5053.7}, SaturationTableData{0.0, 548000.0, 4.350000000000003e-05, 0.00046100000000000047, 22000.0, 18350.0, 23750.0, 22650.0, 36.15000000000009, 42.34999999999991}, 2},
+    SaturationTableEntry{SaturationTableData{633.15, 18666176.419794712, 0.0018946886034859887, 0.00695072913054794, 1726148.1011243642, 2351818.9285238637, 1761526.5660663561, 2481609.7466542483, 3916.3751350755733, 5053.468305915286}, SaturationTableData{0.0, 607083.3796634767, 4.713311023498909e-05, 0.0005119092767243852, 24283.443392136483, 20236.202826780267, 26260.54366831621, 24888.203476614784, 39.879275570706795, 46.68282652108974}, 4},
+    SaturationTableEntry{SaturationTableData{630.14, 18000000.0, 0.00184, 0.007504, 1699100.0, 2375000.0, 1732200.0, 2510000.0, 3872.0, 5106.4}, SaturationTableData{2.240000000000009, 0.0, 3.499999999999998e-05, 0.00041350000000000024, 19450.0, 15200.0, 20950.0, 18850.0, 31.90000000000009, 36.350000000000364}, 3},
+};
+inline constinit const logngine::core::RSTFrozenTree<SaturationTableEntry, 10, 16, 16> SaturationTable = {_baked_saturationtable_nodes, _baked_saturationtable_values};
 #pragma endregion  // Definitions
 
 #pragma region Baked-In Source File
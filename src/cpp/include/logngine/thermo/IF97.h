@@ -0,0 +1,90 @@
+#pragma once
+
+#include <logngine/thermo/ThermoState.h>
+#include <logngine/thermo/PhaseClassifier.h>
+#include <logngine/thermo/SaturationCurve.h>
+#include <logngine/thermo/StateEngine.h>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  IAPWS-IF97
+    // ==========================================================
+#pragma region IF97
+
+    // The IAPWS Industrial Formulation 1997 for water and steam (revised release, 2007), in this library's SI units
+    // (Pa, K, J/kg) rather than the release's MPa and kJ/kg. Covers 273.15 K <= T <= 1073.15 K for P <= 100 MPa, and
+    // 1073.15 K < T <= 2273.15 K for P <= 50 MPa.
+    namespace if97
+    {
+        enum class Region : std::uint8_t
+        {
+            OutOfRange,
+            One,    // liquid, T <= 623.15 K (Gibbs free energy in (P, T))
+            Two,    // vapor up to 1073.15 K (Gibbs free energy in (P, T))
+            Three,  // around the critical point, between regions 1 and 2 (Helmholtz free energy in (density, T))
+            Four,   // the saturation line
+            Five,   // high-temperature vapor (Gibbs free energy in (P, T))
+        };
+
+        inline constexpr double CRITICAL_TEMPERATURE = 647.096;   // K
+        inline constexpr double CRITICAL_PRESSURE = 22.064e6;     // Pa
+        inline constexpr double CRITICAL_DENSITY = 322.0;         // kg/m^3
+
+        // Region of (P, T). Never `Four`: on the saturation line pressure and temperature do not fix a state, and
+        // points exactly on it are put in the liquid region.
+        [[nodiscard]] Region region(double pressure, double temperature);
+
+        // Region 4, NaN outside 273.15 K..CRITICAL_TEMPERATURE (611.213 Pa..CRITICAL_PRESSURE).
+        [[nodiscard]] double saturation_pressure(double temperature);
+        [[nodiscard]] double saturation_temperature(double pressure);
+
+        // Saturated liquid and vapor from the basic equations; empty off the saturation line's range.
+        [[nodiscard]] std::optional<SaturationState> saturation_at_temperature(double temperature);
+        [[nodiscard]] std::optional<SaturationState> saturation_at_pressure(double pressure);
+
+        // State at (P, T) from the basic equation of its region; empty outside every region. Region 3 is in density,
+        // which is solved for by safeguarded Newton on the pressure.
+        [[nodiscard]] std::optional<ThermoState> state(double pressure, double temperature);
+        // `state` with its analytic partial derivatives.
+        [[nodiscard]] std::optional<ThermoGradient> differentiate(double pressure, double temperature);
+
+        // `state` for every (pressures[i], temperatures[i]). Points are grouped by region and the polynomial sums of
+        // regions 1, 2 and 5 are evaluated several points at a time (AVX2/AVX-512 when the CPU has them). Points
+        // outside every region get `Region::OutOfRange` and a default state.
+        void states(std::span<const double> pressures, std::span<const double> temperatures, std::span<ThermoState> out, std::span<Region> regions);
+
+        // Backward equations T(P, h) and T(P, s) of regions 1 and 2 (subregions 2a/2b/2c are picked here), which
+        // agree with the basic equations to within a few mK. `property` is `SpecificEnthalpy` or `SpecificEntropy`;
+        // anything else, or another region, gives NaN.
+        [[nodiscard]] double backward_temperature(Region region, Property property, double pressure, double value);
+    } // namespace if97
+
+    // `StateEngine`'s interface over IAPWS-IF97 instead of tables. (P, T) is evaluated directly. Pressure or
+    // temperature with another property checks the saturation line first, then solves along the isobar/isotherm by
+    // safeguarded Newton on the analytic derivatives, starting from the backward equations where they apply. Pairs
+    // with neither the pressure nor the temperature fall back to the table engine.
+    class IF97Engine
+    {
+    public:
+        // The fallback is referenced, not copied, and must outlive this one.
+        explicit IF97Engine(const StateEngine& fallback);
+
+        [[nodiscard]] PhaseState get_state(Property a, double a_value, Property b, double b_value, const PhaseState* hint = nullptr) const;
+
+        // (P, T) batches are evaluated with `if97::states`; every other pair as `get_state`, split over the shared
+        // thread pool.
+        void get_state_batch(Property a, std::span<const double> a_values, Property b, std::span<const double> b_values, std::span<PhaseState> out) const;
+
+    private:
+        [[nodiscard]] static PhaseState from_pressure_temperature(double pressure, double temperature);
+        [[nodiscard]] static PhaseState solve_line(Property fixed, double fixed_value, Property other, double value, const PhaseState* hint);
+
+        const StateEngine& fallback;
+    };
+
+#pragma endregion
+} // namespace logngine::thermo
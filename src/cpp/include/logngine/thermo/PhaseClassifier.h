@@ -0,0 +1,44 @@
+#pragma once
+
+#include <logngine/thermo/RectilinearTable.h>
+#include <logngine/thermo/SaturationCurve.h>
+#include <cstdint>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  Phase Classifier
+    // ==========================================================
+#pragma region PhaseClassifier
+
+    enum class Phase : std::uint8_t
+    {
+        OutOfRange,  // not covered by any table, or not a unique state
+        Compressed,
+        Saturated,
+        Superheated,
+    };
+
+    // Decides which table a (pressure, temperature) point belongs to before anything is interpolated: below Tsat(P)
+    // is compressed and above it superheated; past the end of the saturation curve (supercritical or below the triple
+    // point), the side of the critical temperature picks the table to try first. A point is only placed in a table
+    // whose coverage contains it. Costs O(log n).
+    class PhaseClassifier
+    {
+    public:
+        // The engines are referenced, not copied, and must outlive this one.
+        PhaseClassifier(const RectilinearTable& compressed, const SaturationCurve& saturation, const RectilinearTable& superheated);
+
+        // Never `Saturated`: pressure and temperature alone do not fix a state inside the dome, so points on Tsat(P)
+        // are `OutOfRange`.
+        [[nodiscard]] Phase classify(double pressure, double temperature) const;
+
+    private:
+        const RectilinearTable& compressed;
+        const SaturationCurve& saturation;
+        const RectilinearTable& superheated;
+        double critical_temperature;
+    };
+
+#pragma endregion
+} // namespace logngine::thermo
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <logngine/thermo/ThermoState.h>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  Rectilinear Table
+    // ==========================================================
+#pragma region RectilinearTable
+
+    // Counts of the block and row searches a thread's `RectilinearTable` lookups answered from its warm-start cache
+    // (the previous cell or a neighbour of it) and by binary search.
+    struct LookupStats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+    };
+
+    // Single-phase property table stored as constant-pressure blocks, each over its own ascending temperature column
+    // (the layout of the superheated/compressed `.svuv` tables). Lookups find the bracketing blocks and rows by binary
+    // search, so they cost O(log n); but each thread first tries the cell it last used in the table and the ones next
+    // to it, so runs of nearby lookups (time steps, sweeps, solver iterations) cost O(1).
+    //
+    // Built from plain rows, the table is bilinear. Built from knots that carry slopes (the `*Spline` `DatasetBaker`
+    // bakes next to single-phase tables), it is a cubic Hermite in temperature along each block and in pressure
+    // between blocks, monotone wherever the data is, at the cost of the same two row searches. Its value and
+    // derivative in pressure are continuous everywhere, but its derivative in temperature only along the blocks:
+    // between them, the knots' pressure slopes are interpolated linearly in temperature, so it jumps at the rows'
+    // temperatures.
+    class RectilinearTable
+    {
+    public:
+        RectilinearTable() = default;
+        // Rows may come in any order; non-finite rows are dropped, and of several rows at the same (pressure,
+        // temperature) only the first is kept.
+        explicit RectilinearTable(std::vector<ThermoState> rows);
+        // Rows with their uncertainties, kept and ordered the same way.
+        explicit RectilinearTable(std::vector<UncertainState> rows);
+        // From single-phase `*TableEntry` values, e.g. a baked table's `entries()`, with their uncertainties.
+        template <typename Entry>
+        explicit RectilinearTable(std::span<const Entry> entries) : RectilinearTable(to_uncertain_states(entries)) {}
+        // Cubic table through `knots` with the slopes they carry, kept and ordered like the rows above. Each knot
+        // takes the uncertainty of the row of `uncertainties` at its (pressure, temperature), or NaN if there is none;
+        // without any, the table has no uncertainties.
+        explicit RectilinearTable(std::vector<ThermoGradient> knots, std::vector<UncertainState> uncertainties = {});
+
+        // Along the two bracketing pressure blocks at `temperature`, then between them in pressure (linearly both
+        // times, or by cubic Hermite). Empty outside the table, including where either block does not reach
+        // `temperature` (e.g. below the saturation temperature at the higher pressure of a superheated table).
+        //
+        // With `Uncertainty`, also the 1-sigma uncertainty of each property, propagated from the (independent)
+        // uncertainties of the corner rows through their interpolation weights: sqrt(sum of (w_i * sigma_i)^2). The
+        // slopes of a cubic table are taken as exact, so only the Hermite weights of the corner values count. NaN if
+        // the table has no uncertainties.
+        template <bool Uncertainty = false>
+        [[nodiscard]] std::optional<std::conditional_t<Uncertainty, UncertainState, ThermoState>> interpolate(double pressure, double temperature) const;
+        // `interpolate` with its partial derivatives. A bilinear table is only piecewise smooth; on a grid line, the
+        // derivative across it comes from the cell above (or below, at the edge of the table).
+        [[nodiscard]] std::optional<ThermoGradient> differentiate(double pressure, double temperature) const;
+        // Indices into `states()` of the rows around (pressure, temperature), and the weight the interpolated value
+        // gives each of their values (for a cubic table, with its slopes held fixed); unused slots have weight 0.
+        // Empty outside the table.
+        [[nodiscard]] std::optional<std::pair<std::array<size_t, 4>, std::array<double, 4>>> corners(double pressure, double temperature) const;
+        // Whether `interpolate` would succeed, without interpolating.
+        [[nodiscard]] bool covers(double pressure, double temperature) const;
+
+        // Temperatures covered at `pressure`, if any.
+        [[nodiscard]] std::optional<std::pair<double, double>> temperature_range(double pressure) const;
+        // Temperatures of the rows of the blocks around `pressure`, ascending: the interpolant along the isobar is one
+        // line (or cubic) between each two.
+        [[nodiscard]] std::vector<double> breakpoints(double pressure) const;
+
+        [[nodiscard]] std::span<const double> pressures() const { return this->block_pressures; }
+        [[nodiscard]] std::span<const ThermoState> states() const { return this->rows; }  // sorted by pressure, then temperature
+        [[nodiscard]] std::span<const ThermoState> uncertainties() const { return this->sigmas; }  // of each of `states()`, if any
+        [[nodiscard]] size_t size() const { return this->rows.size(); }
+        [[nodiscard]] bool empty() const { return this->rows.empty(); }
+        [[nodiscard]] bool cubic() const { return !this->temperature_slopes.empty(); }
+        [[nodiscard]] bool uncertain() const { return !this->sigmas.empty(); }
+
+        // Warm-start cache counters of the calling thread, over all tables.
+        [[nodiscard]] static LookupStats lookup_stats();
+        static void reset_lookup_stats();
+
+    private:
+        // Index of the first block at or above `pressure`, or of the first row of `block` at or above `temperature`,
+        // as `std::lower_bound` gives it; from the warm-start cache where it can be.
+        [[nodiscard]] size_t find_block(double pressure) const;
+        [[nodiscard]] size_t find_row(size_t block, double temperature) const;
+        [[nodiscard]] std::optional<ThermoState> interpolate_value(double pressure, double temperature) const;
+        [[nodiscard]] std::optional<ThermoState> interpolate_block(size_t block, double temperature) const;
+        [[nodiscard]] bool block_covers(size_t block, double temperature) const;
+        // Value and temperature derivative within a block that covers `temperature`.
+        [[nodiscard]] std::pair<ThermoState, ThermoState> differentiate_block(size_t block, double temperature) const;
+        // Cubic tables only, at a covered point; without `derivatives`, only the value is set.
+        [[nodiscard]] ThermoGradient hermite(double pressure, double temperature, bool derivatives) const;
+        // The value, its temperature derivative, the pressure slope, and that slope's temperature derivative, along a
+        // block that covers `temperature`.
+        [[nodiscard]] std::array<ThermoState, 4> hermite_block(size_t block, double temperature, bool derivatives) const;
+        // Splits sorted, unique rows into blocks.
+        void index(std::vector<ThermoState> sorted_rows);
+
+        std::vector<double> block_pressures;  // ascending and unique
+        std::vector<size_t> block_offsets;    // block `b` holds rows [block_offsets[b], block_offsets[b + 1])
+        std::vector<double> temperatures;     // of each row; ascending within a block
+        std::vector<ThermoState> rows;
+        std::vector<ThermoState> temperature_slopes;  // of each row; empty unless cubic
+        std::vector<ThermoState> pressure_slopes;
+        std::vector<ThermoState> sigmas;  // 1-sigma uncertainty of each row; empty if none was given
+    };
+
+#pragma endregion
+} // namespace logngine::thermo
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  Root Finding
+    // ==========================================================
+#pragma region RootFinding
+
+    // Root of `f` in [lo, hi], where f(lo) and f(hi) differ in sign. `f` returns (residual, slope), or a NaN
+    // residual where it cannot be evaluated. Newton steps from `guess` (the midpoint if it is outside), replaced
+    // by bisection whenever one would leave the bracket, which shrinks every iteration. Converged once a step (or
+    // the bracket) is within `tolerance` of the root, relative to it; empty if that has not happened after
+    // `max_iterations`.
+    template <typename F>
+    std::optional<double> newton_bisect(F&& f, double lo, double hi, const double guess, const double tolerance = 1e-10, const size_t max_iterations = 100)
+    {
+        const double f_lo = f(lo).first;
+        const double f_hi = f(hi).first;
+        if (std::isnan(f_lo) || std::isnan(f_hi)) return std::nullopt;
+        if (f_lo == 0.0) return lo;
+        if (f_hi == 0.0) return hi;
+        if ((f_lo > 0.0) == (f_hi > 0.0)) return std::nullopt;
+        if (f_lo > 0.0) std::swap(lo, hi);  // f(lo) < 0 < f(hi) from here on
+
+        double x = (guess > std::min(lo, hi) && guess < std::max(lo, hi)) ? guess : 0.5 * (lo + hi);
+        for (size_t iteration = 0; iteration < max_iterations; ++iteration)
+        {
+            const auto [residual, slope] = f(x);
+            if (std::isnan(residual)) return std::nullopt;
+            if (residual == 0.0) return x;
+            (residual < 0.0 ? lo : hi) = x;
+
+            double next = x - residual / slope;
+            if (!(next > std::min(lo, hi) && next < std::max(lo, hi))) next = 0.5 * (lo + hi);
+            if (std::abs(next - x) <= tolerance * std::abs(x) || std::abs(hi - lo) <= tolerance * std::abs(x)) return next;
+            x = next;
+        }
+        if (std::abs(hi - lo) <= tolerance * std::abs(x)) return x;
+        return std::nullopt;
+    }
+
+#pragma endregion
+} // namespace logngine::thermo
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <logngine/thermo/ThermoState.h>
+#include <array>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  Saturation Curve
+    // ==========================================================
+#pragma region SaturationCurve
+
+    // Saturated liquid and vapor at one point of the saturation curve; both share pressure and temperature.
+    template <typename Scalar>
+    struct BasicSaturationState
+    {
+        BasicThermoState<Scalar> liquid;
+        BasicThermoState<Scalar> vapor;
+
+        // Two-phase mixture of vapor mass fraction `quality`.
+        [[nodiscard]] constexpr BasicThermoState<Scalar> mixture(const Scalar& quality) const { return lerp(this->liquid, this->vapor, quality); }
+    };
+
+    using SaturationState = BasicSaturationState<double>;
+
+    // Saturated `*TableData` (temperature, pressure, liquid_/vapor_ fields) to `SaturationState`.
+    template <typename Data>
+    constexpr SaturationState to_saturation_state(const Data& data)
+    {
+        return {
+            {data.pressure, data.temperature, data.liquid_specific_volume, data.liquid_specific_internal_energy, data.liquid_specific_enthalpy, data.liquid_specific_entropy},
+            {data.pressure, data.temperature, data.vapor_specific_volume, data.vapor_specific_internal_energy, data.vapor_specific_enthalpy, data.vapor_specific_entropy},
+        };
+    }
+
+    // Liquid and vapor properties along the saturation curve, as functions of either temperature or pressure. Rows are
+    // kept sorted by each and lookups binary-search the bracketing rows, then evaluate a monotone (PCHIP) cubic Hermite
+    // spline through them, so they cost O(log n) and never overshoot the tabulated values.
+    class SaturationCurve
+    {
+    public:
+        SaturationCurve() = default;
+        // Rows may come in any order and from several sources; non-finite rows are dropped, and rows within 0.1% of
+        // each other in temperature (or pressure) are averaged into one.
+        explicit SaturationCurve(std::span<const SaturationState> rows);
+        // From saturated `*TableEntry` values, e.g. a baked table's `entries()`.
+        template <typename Entry>
+        explicit SaturationCurve(std::span<const Entry> entries) : SaturationCurve(std::span<const SaturationState>(to_saturation_states(entries))) {}
+
+        // Empty outside the tabulated range.
+        [[nodiscard]] std::optional<SaturationState> at_temperature(double temperature) const;
+        [[nodiscard]] std::optional<SaturationState> at_pressure(double pressure) const;
+        // Only Tsat(P) / Psat(T), for when the other properties are not needed.
+        [[nodiscard]] std::optional<double> saturation_temperature(double pressure) const;
+        [[nodiscard]] std::optional<double> saturation_pressure(double temperature) const;
+
+        [[nodiscard]] std::pair<double, double> temperature_range() const;
+        [[nodiscard]] std::pair<double, double> pressure_range() const;
+        [[nodiscard]] size_t size() const { return this->by_temperature.x.size(); }
+        [[nodiscard]] bool empty() const { return this->by_temperature.x.empty(); }
+
+    private:
+        // pressure, temperature, then volume/internal energy/enthalpy/entropy of the liquid and then of the vapor
+        using Row = std::array<double, 10>;
+
+        // Rows sorted by one column, with the spline slopes of every column with respect to it.
+        struct Axis
+        {
+            std::vector<double> x;
+            std::vector<Row> values;
+            std::vector<Row> slopes;
+        };
+
+        template <typename Entry>
+        static std::vector<SaturationState> to_saturation_states(std::span<const Entry> entries)
+        {
+            std::vector<SaturationState> states;
+            states.reserve(entries.size());
+            for (const auto& entry : entries) states.push_back(to_saturation_state(entry.data));
+            return states;
+        }
+
+        // `x` lies at fraction `t` of [axis.x[i], axis.x[i + 1]] (of width `h`), or exactly on axis.x[i] if `t` is 0.
+        struct Knot
+        {
+            size_t i = 0;
+            double t = 0.0;
+            double h = 0.0;
+        };
+
+        static Axis make_axis(std::vector<Row> rows, size_t column);
+        static std::optional<Knot> locate(const Axis& axis, double x);
+        static double evaluate(const Axis& axis, const Knot& knot, size_t column);
+        static SaturationState evaluate(const Axis& axis, const Knot& knot);
+
+        Axis by_temperature;
+        Axis by_pressure;
+    };
+
+#pragma endregion
+} // namespace logngine::thermo
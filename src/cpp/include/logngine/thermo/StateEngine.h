@@ -0,0 +1,73 @@
+#pragma once
+
+#include <logngine/thermo/ThermoState.h>
+#include <logngine/thermo/PhaseClassifier.h>
+#include <logngine/thermo/RectilinearTable.h>
+#include <logngine/thermo/SaturationCurve.h>
+#include <array>
+#include <limits>
+#include <span>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  State Engine
+    // ==========================================================
+#pragma region StateEngine
+
+    struct PhaseState
+    {
+        ThermoState state{};
+        Phase phase = Phase::OutOfRange;
+        double quality = std::numeric_limits<double>::quiet_NaN();  // only inside the saturation dome
+    };
+
+    // Full state of a pure substance from any two of its `Property`s, over its compressed, saturated and superheated
+    // tables. (pressure, temperature) is a direct lookup; every other pair is inverted:
+    //  - pressure or temperature with another property: the dome is checked first (the quality is linear in the
+    //    property), then each table is solved along the isobar/isotherm by Newton's method on the interpolant's
+    //    analytic derivative, safeguarded by bisection. Where that cannot bracket a root (non-monotone data, gaps in
+    //    the table), the interpolant's linear pieces along the line are walked instead.
+    //  - two other properties: the dome is scanned for a temperature at which both give the same quality, then each
+    //    table is solved for (pressure, temperature) by damped 2D Newton, seeded from the hint or the nearest row.
+    // A solution only counts if the classifier puts it in the table it was solved in. States that are not unique
+    // (e.g. the density maximum of liquid water) may not be found; anything not found is `OutOfRange`.
+    class StateEngine
+    {
+    public:
+        // The engines are referenced, not copied, and must outlive this one.
+        StateEngine(const RectilinearTable& compressed, const SaturationCurve& saturation, const RectilinearTable& superheated);
+
+        // `hint` is a nearby known state (e.g. the previous one along a path) that the solvers start from; it only
+        // affects how fast the state is found.
+        [[nodiscard]] PhaseState get_state(Property a, double a_value, Property b, double b_value, const PhaseState* hint = nullptr) const;
+
+        // `get_state` for every (a_values[i], b_values[i]), split over the shared thread pool. Each state is hinted
+        // with the one before it, so ordered inputs (sweeps, paths) solve fastest.
+        void get_state_batch(Property a, std::span<const double> a_values, Property b, std::span<const double> b_values, std::span<PhaseState> out) const;
+
+    private:
+        [[nodiscard]] PhaseState from_pressure_temperature(double pressure, double temperature) const;
+        [[nodiscard]] PhaseState from_saturation(const std::optional<SaturationState>& saturation, Property other, double value) const;
+
+        // `fixed` is the pressure or the temperature; solves the table of `phase` for the other one.
+        [[nodiscard]] PhaseState solve_line(Phase phase, Property fixed, double fixed_value, Property other, double value, const PhaseState* hint) const;
+        // Neither `a` nor `b` is the pressure or the temperature.
+        [[nodiscard]] PhaseState solve_plane(Phase phase, Property a, double a_value, Property b, double b_value, const PhaseState* hint) const;
+        [[nodiscard]] PhaseState solve_dome(Property a, double a_value, Property b, double b_value) const;
+        // The table state at a solution, if it belongs to `phase`.
+        [[nodiscard]] PhaseState settle(Phase phase, double pressure, double temperature) const;
+
+        [[nodiscard]] const RectilinearTable& table(const Phase phase) const { return phase == Phase::Superheated ? this->superheated : this->compressed; }
+
+        const RectilinearTable& compressed;
+        const SaturationCurve& saturation;
+        const RectilinearTable& superheated;
+        PhaseClassifier classifier;
+        // Range of each property over each table, which sets the scale of residuals near zero.
+        std::array<double, 6> compressed_spans;
+        std::array<double, 6> superheated_spans;
+    };
+
+#pragma endregion
+} // namespace logngine::thermo
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  Thermodynamic State
+    // ==========================================================
+#pragma region ThermoState
+
+    // Intensive state of a pure substance in SI units (Pa, K, m^3/kg, J/kg, J/kg, J/(kg*K)), as baked by DatasetBaker.
+    // `Scalar` is `double` everywhere but where a state is carried through the kernels below in another arithmetic
+    // type, e.g. `uncertainty::Measurement` for first-order uncertainty propagation.
+    template <typename Scalar>
+    struct BasicThermoState
+    {
+        Scalar pressure = Scalar(0.0);
+        Scalar temperature = Scalar(0.0);
+        Scalar specific_volume = Scalar(0.0);
+        Scalar specific_internal_energy = Scalar(0.0);
+        Scalar specific_enthalpy = Scalar(0.0);
+        Scalar specific_entropy = Scalar(0.0);
+    };
+
+    using ThermoState = BasicThermoState<double>;
+
+    enum class Property : std::uint8_t
+    {
+        Pressure,
+        Temperature,
+        SpecificVolume,
+        SpecificInternalEnergy,
+        SpecificEnthalpy,
+        SpecificEntropy,
+    };
+
+    template <typename Scalar>
+    constexpr Scalar get(const BasicThermoState<Scalar>& state, const Property property)
+    {
+        switch (property)
+        {
+            case Property::Pressure: return state.pressure;
+            case Property::Temperature: return state.temperature;
+            case Property::SpecificVolume: return state.specific_volume;
+            case Property::SpecificInternalEnergy: return state.specific_internal_energy;
+            case Property::SpecificEnthalpy: return state.specific_enthalpy;
+            case Property::SpecificEntropy: return state.specific_entropy;
+        }
+        return Scalar(0.0);
+    }
+
+    // `a` at t = 0, `b` at t = 1, linear in every property.
+    template <typename Scalar, typename Weight>
+    constexpr BasicThermoState<Scalar> lerp(const BasicThermoState<Scalar>& a, const BasicThermoState<Scalar>& b, const Weight& t)
+    {
+        return {
+            a.pressure + t * (b.pressure - a.pressure),
+            a.temperature + t * (b.temperature - a.temperature),
+            a.specific_volume + t * (b.specific_volume - a.specific_volume),
+            a.specific_internal_energy + t * (b.specific_internal_energy - a.specific_internal_energy),
+            a.specific_enthalpy + t * (b.specific_enthalpy - a.specific_enthalpy),
+            a.specific_entropy + t * (b.specific_entropy - a.specific_entropy),
+        };
+    }
+
+    // (b - a) / dx in every property.
+    template <typename Scalar, typename Step>
+    constexpr BasicThermoState<Scalar> secant(const BasicThermoState<Scalar>& a, const BasicThermoState<Scalar>& b, const Step& dx)
+    {
+        return {
+            (b.pressure - a.pressure) / dx,
+            (b.temperature - a.temperature) / dx,
+            (b.specific_volume - a.specific_volume) / dx,
+            (b.specific_internal_energy - a.specific_internal_energy) / dx,
+            (b.specific_enthalpy - a.specific_enthalpy) / dx,
+            (b.specific_entropy - a.specific_entropy) / dx,
+        };
+    }
+
+    // Vapor mass fraction of a two-phase mixture whose property is `value`, where the saturated liquid and vapor have
+    // `liquid` and `vapor`; the inverse of `lerp` between them.
+    template <typename Scalar>
+    constexpr Scalar quality(const Scalar& value, const Scalar& liquid, const Scalar& vapor)
+    {
+        return (value - liquid) / (vapor - liquid);
+    }
+
+    // A state-valued function at one point, with its partial derivatives there.
+    struct ThermoGradient
+    {
+        ThermoState value;
+        ThermoState d_dpressure;
+        ThermoState d_dtemperature;
+    };
+
+    // A state with the 1-sigma uncertainty of every property (zero where a property is exact, e.g. the pressure and
+    // temperature a table is looked up at).
+    struct UncertainState
+    {
+        ThermoState value;
+        ThermoState sigma;
+    };
+
+    // Single-phase `*TableData` (anything with the `ThermoState` fields) to `ThermoState`.
+    template <typename Data>
+    constexpr ThermoState to_state(const Data& data)
+    {
+        return {data.pressure, data.temperature, data.specific_volume, data.specific_internal_energy, data.specific_enthalpy, data.specific_entropy};
+    }
+
+    template <typename Entry>
+    std::vector<ThermoState> to_states(std::span<const Entry> entries)
+    {
+        std::vector<ThermoState> states;
+        states.reserve(entries.size());
+        for (const auto& entry : entries) states.push_back(to_state(entry.data));
+        return states;
+    }
+
+    // Baked `*TableEntry`s with the `uncertainty` record each carries.
+    template <typename Entry>
+    std::vector<UncertainState> to_uncertain_states(std::span<const Entry> entries)
+    {
+        std::vector<UncertainState> states;
+        states.reserve(entries.size());
+        for (const auto& entry : entries) states.push_back({to_state(entry.data), to_state(entry.uncertainty)});
+        return states;
+    }
+
+    // Baked `*TableKnot`s (a value with its temperature and pressure slopes) to `ThermoGradient`s.
+    template <typename Knot, size_t Extent>
+    std::vector<ThermoGradient> to_gradients(std::span<const Knot, Extent> knots)
+    {
+        std::vector<ThermoGradient> gradients;
+        gradients.reserve(knots.size());
+        for (const auto& knot : knots) gradients.push_back({to_state(knot.value), to_state(knot.d_dpressure), to_state(knot.d_dtemperature)});
+        return gradients;
+    }
+
+#pragma endregion
+} // namespace logngine::thermo
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <logngine/thermo/ThermoState.h>
+#include <logngine/thermo/RectilinearTable.h>
+#include <array>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace logngine::thermo
+{
+    // ==========================================================
+    //  Uniform Grid
+    // ==========================================================
+#pragma region UniformGrid
+
+    // What resampling onto a `UniformGrid` cost and lost, measured when it is built.
+    struct UniformGridReport
+    {
+        size_t bytes = 0;          // node storage
+        size_t nodes = 0;
+        size_t missing_nodes = 0;  // outside the source; the cells around them are empty
+        // Largest |grid - source| over the centre and edge midpoints of every full cell, where bilinear
+        // interpolation of a smooth source errs most. Pressure and temperature are exact and reported as 0.
+        ThermoState max_error;
+        ThermoState max_relative_error;
+    };
+
+    // A (P, T) box of a single-phase source resampled once onto evenly spaced nodes, for lookups that must take the
+    // same short time every call (control loops): the cell is found by two multiplies, with no search and no
+    // per-thread cache, and is interpolated bilinearly. Accuracy is bought with memory, 32 bytes per node; the
+    // report says how much of each was spent.
+    class UniformGrid
+    {
+    public:
+        // Called once per node and error sample, from the shared thread pool, so it must be thread-safe.
+        using Source = std::function<std::optional<ThermoState>(double pressure, double temperature)>;
+
+        UniformGrid() = default;
+        // `shape` is the number of nodes along pressure and temperature, at least 2 each, spanning both ranges
+        // end to end. Throws `std::invalid_argument` on an empty range or shape.
+        UniformGrid(const Source& source, std::pair<double, double> pressure_range, std::pair<double, double> temperature_range,
+                    std::pair<size_t, size_t> shape);
+        // Of a baked table, e.g. `water::superheated_table()`.
+        UniformGrid(const RectilinearTable& source, std::pair<double, double> pressure_range, std::pair<double, double> temperature_range,
+                    std::pair<size_t, size_t> shape);
+
+        // Empty outside the box, and in cells with a node the source did not cover.
+        [[nodiscard]] std::optional<ThermoState> interpolate(double pressure, double temperature) const;
+
+        [[nodiscard]] const UniformGridReport& report() const { return this->build_report; }
+        [[nodiscard]] std::pair<double, double> pressure_range() const { return {this->pressure_min, this->pressure_max}; }
+        [[nodiscard]] std::pair<double, double> temperature_range() const { return {this->temperature_min, this->temperature_max}; }
+        [[nodiscard]] std::pair<size_t, size_t> shape() const { return {this->pressure_count, this->temperature_count}; }
+        [[nodiscard]] bool empty() const { return this->nodes.empty(); }
+
+    private:
+        // Specific volume, internal energy, enthalpy and entropy; NaN where the source had no state.
+        using Node = std::array<double, 4>;
+
+        [[nodiscard]] double pressure_at(size_t i) const;
+        [[nodiscard]] double temperature_at(size_t j) const;
+
+        double pressure_min = 0.0, pressure_max = 0.0;
+        double temperature_min = 0.0, temperature_max = 0.0;
+        double inverse_pressure_step = 0.0, inverse_temperature_step = 0.0;
+        size_t pressure_count = 0, temperature_count = 0;
+        std::vector<Node> nodes;  // pressure-major
+        UniformGridReport build_report;
+    };
+
+#pragma endregion
+} // namespace logngine::thermo
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <logngine/thermo/IF97.h>
+#include <logngine/thermo/RectilinearTable.h>
+#include <logngine/thermo/SaturationCurve.h>
+#include <logngine/thermo/StateEngine.h>
+#include <cstdint>
+#include <span>
+
+namespace logngine::thermo::water
+{
+    // Lookup engines over the baked water tables; each is built on first use and shared afterwards. The single-phase
+    // tables are the baked cubic splines.
+    const RectilinearTable& superheated_table();
+    const RectilinearTable& compressed_table();
+    const SaturationCurve& saturation_curve();
+    const StateEngine& state_engine();
+    // IAPWS-IF97, falling back to `state_engine()` for pairs it does not solve.
+    const IF97Engine& if97_engine();
+
+    // Where `get_state` takes water properties from. The default is chosen when building: `LOGNGINE_WATER_IF97`
+    // selects IAPWS-IF97 instead of the tables. Both are compiled, so either can still be asked for explicitly.
+    enum class Backend : std::uint8_t
+    {
+        Tables,
+        IF97,
+    };
+
+#ifdef LOGNGINE_WATER_IF97
+    inline constexpr Backend BACKEND = Backend::IF97;
+#else
+    inline constexpr Backend BACKEND = Backend::Tables;
+#endif
+
+    template <Backend B = BACKEND>
+    PhaseState get_state(Property a, double a_value, Property b, double b_value, const PhaseState* hint = nullptr);
+
+    template <Backend B = BACKEND>
+    void get_state_batch(Property a, std::span<const double> a_values, Property b, std::span<const double> b_values, std::span<PhaseState> out);
+} // namespace logngine::thermo::water
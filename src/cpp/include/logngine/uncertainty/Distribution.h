@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Distribution
+    // ==========================================================
+#pragma region Distribution
+
+    // Inverse of the standard normal CDF (Wichura's AS 241, accurate to about 1e-16). NaN outside (0, 1).
+    [[nodiscard]] double standard_normal_quantile(double p);
+
+    // A univariate input distribution, sampled by inverse CDF so that any uniform source (pseudo-random or
+    // stratified) can drive it.
+    class Distribution
+    {
+    public:
+        enum class Kind : std::uint8_t
+        {
+            Normal,      // mean, standard deviation
+            Uniform,     // low, high
+            LogNormal,   // mean and standard deviation of the logarithm
+            Triangular,  // low, mode, high
+        };
+
+        // Each throws `std::invalid_argument` on parameters that do not make a distribution.
+        [[nodiscard]] static Distribution normal(double mean, double standard_deviation);
+        [[nodiscard]] static Distribution uniform(double low, double high);
+        [[nodiscard]] static Distribution log_normal(double log_mean, double log_standard_deviation);
+        [[nodiscard]] static Distribution triangular(double low, double mode, double high);
+
+        // Value below which a fraction `p` in (0, 1) of the distribution lies.
+        [[nodiscard]] double quantile(double p) const;
+        [[nodiscard]] double mean() const;
+        [[nodiscard]] double variance() const;
+
+        [[nodiscard]] Kind kind() const { return this->type; }
+        [[nodiscard]] const std::array<double, 3>& parameters() const { return this->values; }  // in the order above
+
+    private:
+        Distribution(Kind type, std::array<double, 3> values) : type(type), values(values) {}
+
+        Kind type;
+        std::array<double, 3> values;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <logngine/thermo/RectilinearTable.h>
+#include <logngine/thermo/ThermoState.h>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Measurement
+    // ==========================================================
+#pragma region Measurement
+
+    // Id of a named uncertainty source (64-bit FNV-1a of the name), for `Measurement::input`.
+    constexpr std::uint64_t source_id(const std::string_view name)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325;
+        for (const char c : name) hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+        return hash;
+    }
+
+    // One term of a `Measurement`'s gradient: its sensitivity to a source, times that source's standard uncertainty.
+    struct Sensitivity
+    {
+        std::uint64_t source;
+        double derivative;
+    };
+
+    // A value with its gradient against independent uncertainty sources, carried through arithmetic by forward-mode
+    // automatic differentiation: GUM first-order propagation (JCGM 100, section 5) in the one evaluation that gives
+    // the value. Each source is a standard normal variable, so the gradient is in units of the value, its norm is the
+    // standard uncertainty, and two measurements that share sources are correlated through them.
+    //
+    // The gradient is sparse, sorted by source, and stored inline with room for `N` sources, so measurements never
+    // allocate; an operation whose operands together depend on more than `N` sources throws `std::length_error`.
+    template <size_t N>
+    class Measurement
+    {
+    public:
+        // An exact value.
+        constexpr Measurement(const double value = 0.0) : number(value) {}  // NOLINT(google-explicit-constructor)
+
+        // `value` with standard uncertainty `standard_uncertainty` from `source` alone.
+        [[nodiscard]] static constexpr Measurement input(const double value, const double standard_uncertainty, const std::uint64_t source)
+        {
+            Measurement m(value);
+            if (standard_uncertainty != 0.0) m.terms[m.count++] = {source, standard_uncertainty};
+            return m;
+        }
+
+        [[nodiscard]] constexpr double value() const { return this->number; }
+        [[nodiscard]] constexpr std::span<const Sensitivity> gradient() const { return {this->terms.data(), this->count}; }
+
+        // Combined standard uncertainty: the root sum of squares of the gradient.
+        [[nodiscard]] double uncertainty() const
+        {
+            double sum = 0.0;
+            for (const auto& [source, derivative] : this->gradient()) sum += derivative * derivative;
+            return std::sqrt(sum);
+        }
+
+        // Of the uncertainty, the part due to `source` (signed); 0 for a source the value does not depend on.
+        [[nodiscard]] constexpr double derivative(const std::uint64_t source) const
+        {
+            for (const auto& term : this->gradient())
+                if (term.source == source) return term.derivative;
+            return 0.0;
+        }
+
+        // f(a) from f's value and derivative at a.value(), by the chain rule.
+        [[nodiscard]] static constexpr Measurement chain(const double value, const Measurement& a, const double da)
+        {
+            Measurement m(value);
+            for (const auto& [source, derivative] : a.gradient()) m.terms[m.count++] = {source, da * derivative};
+            return m;
+        }
+
+        // f(a, b) from f's value and partial derivatives at (a.value(), b.value()), by the chain rule.
+        [[nodiscard]] static constexpr Measurement chain(const double value, const Measurement& a, const double da, const Measurement& b, const double db)
+        {
+            Measurement m(value);
+            size_t i = 0, j = 0;
+            while (i < a.count || j < b.count)
+            {
+                if (m.count == N) throw std::length_error("Measurement depends on more uncertainty sources than it has room for...");
+                if (j == b.count || (i < a.count && a.terms[i].source < b.terms[j].source))
+                {
+                    m.terms[m.count++] = {a.terms[i].source, da * a.terms[i].derivative};
+                    ++i;
+                }
+                else if (i == a.count || b.terms[j].source < a.terms[i].source)
+                {
+                    m.terms[m.count++] = {b.terms[j].source, db * b.terms[j].derivative};
+                    ++j;
+                }
+                else
+                {
+                    m.terms[m.count++] = {a.terms[i].source, da * a.terms[i].derivative + db * b.terms[j].derivative};
+                    ++i;
+                    ++j;
+                }
+            }
+            return m;
+        }
+
+        constexpr Measurement operator-() const { return chain(-this->number, *this, -1.0); }
+        constexpr Measurement operator+() const { return *this; }
+
+        friend constexpr Measurement operator+(const Measurement& a, const Measurement& b) { return chain(a.number + b.number, a, 1.0, b, 1.0); }
+        friend constexpr Measurement operator-(const Measurement& a, const Measurement& b) { return chain(a.number - b.number, a, 1.0, b, -1.0); }
+        friend constexpr Measurement operator*(const Measurement& a, const Measurement& b) { return chain(a.number * b.number, a, b.number, b, a.number); }
+        friend constexpr Measurement operator/(const Measurement& a, const Measurement& b)
+        {
+            const double q = a.number / b.number;
+            return chain(q, a, 1.0 / b.number, b, -q / b.number);
+        }
+
+        // With an exact operand, only the other one's gradient is scaled (no merge)
+        friend constexpr Measurement operator+(const Measurement& a, const double b) { return chain(a.number + b, a, 1.0); }
+        friend constexpr Measurement operator+(const double a, const Measurement& b) { return chain(a + b.number, b, 1.0); }
+        friend constexpr Measurement operator-(const Measurement& a, const double b) { return chain(a.number - b, a, 1.0); }
+        friend constexpr Measurement operator-(const double a, const Measurement& b) { return chain(a - b.number, b, -1.0); }
+        friend constexpr Measurement operator*(const Measurement& a, const double b) { return chain(a.number * b, a, b); }
+        friend constexpr Measurement operator*(const double a, const Measurement& b) { return chain(a * b.number, b, a); }
+        friend constexpr Measurement operator/(const Measurement& a, const double b) { return chain(a.number / b, a, 1.0 / b); }
+        friend constexpr Measurement operator/(const double a, const Measurement& b)
+        {
+            const double q = a / b.number;
+            return chain(q, b, -q / b.number);
+        }
+
+        constexpr Measurement& operator+=(const Measurement& other) { return *this = *this + other; }
+        constexpr Measurement& operator-=(const Measurement& other) { return *this = *this - other; }
+        constexpr Measurement& operator*=(const Measurement& other) { return *this = *this * other; }
+        constexpr Measurement& operator/=(const Measurement& other) { return *this = *this / other; }
+
+        // Comparisons are of values, so branches in generic code follow the value as they would for `double`
+        friend constexpr bool operator==(const Measurement& a, const Measurement& b) { return a.number == b.number; }
+        friend constexpr auto operator<=>(const Measurement& a, const Measurement& b) { return a.number <=> b.number; }
+        friend constexpr bool operator==(const Measurement& a, const double b) { return a.number == b; }
+        friend constexpr auto operator<=>(const Measurement& a, const double b) { return a.number <=> b; }
+
+        friend Measurement sqrt(const Measurement& a)
+        {
+            const double r = std::sqrt(a.number);
+            return chain(r, a, 0.5 / r);
+        }
+        friend Measurement exp(const Measurement& a)
+        {
+            const double e = std::exp(a.number);
+            return chain(e, a, e);
+        }
+        friend Measurement log(const Measurement& a) { return chain(std::log(a.number), a, 1.0 / a.number); }
+        friend Measurement pow(const Measurement& a, const double p) { return chain(std::pow(a.number, p), a, p * std::pow(a.number, p - 1.0)); }
+        friend Measurement abs(const Measurement& a) { return a.number < 0.0 ? -a : a; }
+
+    private:
+        double number;
+        std::array<Sensitivity, N> terms{};
+        size_t count = 0;
+    };
+
+    // Covariance of two measurements through the sources they share.
+    template <size_t N, size_t M>
+    constexpr double covariance(const Measurement<N>& a, const Measurement<M>& b)
+    {
+        double sum = 0.0;
+        const auto x = a.gradient();
+        const auto y = b.gradient();
+        for (size_t i = 0, j = 0; i < x.size() && j < y.size();)
+        {
+            if (x[i].source < y[j].source) ++i;
+            else if (y[j].source < x[i].source) ++j;
+            else sum += x[i++].derivative * y[j++].derivative;
+        }
+        return sum;
+    }
+
+#pragma endregion
+
+    // ==========================================================
+    //  Table Lookups
+    // ==========================================================
+#pragma region TableLookups
+
+    // Id of the uncertainty source of property `k` (0 to 3: volume, energy, enthalpy, entropy) of row `row` of a
+    // table whose rows are sources from `table_source` on.
+    constexpr std::uint64_t row_source(const std::uint64_t table_source, const size_t row, const size_t k)
+    {
+        return table_source + 4 * row + k;
+    }
+
+    // `table.interpolate` at a measured pressure and temperature, as measurements: each property carries the
+    // uncertainty of the lookup point through the table's slopes, and those of the (independent) corner rows through
+    // their interpolation weights, each row property its own source `row_source(table_source, row, k)`. With exact
+    // `pressure` and `temperature`, every property's uncertainty is `table.interpolate<true>`'s sigma; the pressure
+    // and temperature of the state are the measurements given. Lookups in the same table with the same
+    // `table_source` share the sources of the rows they share, so `covariance` between them is right.
+    //
+    // Each property depends on up to 4 row sources besides those of the lookup point, so `N` needs room for them.
+    // Empty outside the table. Throws `std::invalid_argument` if the table carries no uncertainties.
+    template <size_t N>
+    std::optional<thermo::BasicThermoState<Measurement<N>>> measure(const thermo::RectilinearTable& table, const Measurement<N>& pressure,
+                                                                    const Measurement<N>& temperature, const std::uint64_t table_source)
+    {
+        if (!table.uncertain()) throw std::invalid_argument("Table has no uncertainties to measure with...");
+
+        const auto gradient = table.differentiate(pressure.value(), temperature.value());
+        if (!gradient) return {};
+        const auto [rows, weights] = *table.corners(pressure.value(), temperature.value());
+        const auto sigmas = table.uncertainties();
+
+        constexpr std::array properties = {
+            thermo::Property::SpecificVolume, thermo::Property::SpecificInternalEnergy,
+            thermo::Property::SpecificEnthalpy, thermo::Property::SpecificEntropy,
+        };
+        std::array<Measurement<N>, 4> measured;
+        for (size_t k = 0; k < 4; ++k)
+        {
+            const thermo::Property property = properties[k];
+            Measurement<N> m = Measurement<N>::chain(get(gradient->value, property), pressure, get(gradient->d_dpressure, property),
+                                                     temperature, get(gradient->d_dtemperature, property));
+            for (size_t i = 0; i < 4; ++i)
+                if (weights[i] != 0.0)
+                    m += Measurement<N>::input(0.0, weights[i] * get(sigmas[rows[i]], property), row_source(table_source, rows[i], k));
+            measured[k] = m;
+        }
+        return thermo::BasicThermoState<Measurement<N>>{pressure, temperature, measured[0], measured[1], measured[2], measured[3]};
+    }
+
+#pragma endregion
+} // namespace logngine::uncertainty
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <logngine/uncertainty/Distribution.h>
+#include <logngine/uncertainty/Sampler.h>
+#include <logngine/uncertainty/Statistics.h>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Monte Carlo
+    // ==========================================================
+#pragma region MonteCarlo
+
+    // Streaming summary of every output of a Monte Carlo run.
+    struct MonteCarloResult
+    {
+        std::uint64_t samples = 0;
+        std::vector<Moments> moments;     // per output, over its finite values
+        std::vector<TDigest> quantiles;   // per output, over its finite values
+
+        [[nodiscard]] double quantile(size_t output, double q) const { return this->quantiles.at(output).quantile(q); }
+    };
+
+    // Propagates independent input distributions through a model by Monte Carlo. Sample `i`'s inputs are point `i` of a
+    // `Sampler` (by default plain `Philox(seed)` draws from stream `i`) through the inputs' quantile functions, so a
+    // run gives the same result for the same sampler whatever the thread count. Samples are evaluated in blocks spread
+    // over the shared thread pool, which hands blocks out as threads free up, and are summarised as they come
+    // (mean/variance and a t-digest per output) rather than stored.
+    class MonteCarlo
+    {
+    public:
+        // `model(first_sample, inputs, outputs)` evaluates samples [first_sample, first_sample + count): `inputs` holds
+        // their input values (count x dimension, row-major) and `outputs` receives count x output values. It is called
+        // from several threads at once; pooled batch calls it makes (e.g. `water::get_state_batch`) run serially on
+        // its thread. Non-finite outputs (e.g. a lookup off a table) are left out of the summary.
+        using Model = std::function<void(std::uint64_t first_sample, std::span<const double> inputs, std::span<double> outputs)>;
+
+        explicit MonteCarlo(std::vector<Distribution> inputs, std::uint64_t seed = 0);
+        // With points from `sampler`, e.g. a Sobol sequence to converge in fewer samples. Throws
+        // `std::invalid_argument` unless it has one dimension per input.
+        MonteCarlo(std::vector<Distribution> inputs, Sampler sampler);
+
+        // Throws `std::invalid_argument` if there are no outputs, the block is empty, or the sampler's design has
+        // fewer points than `samples`.
+        [[nodiscard]] MonteCarloResult run(const Model& model, size_t outputs, std::uint64_t samples, size_t block = 4096) const;
+
+        // Inputs of samples [first_sample, first_sample + count) into `out` (count x dimension, row-major).
+        void sample(std::uint64_t first_sample, size_t count, std::span<double> out) const;
+
+        [[nodiscard]] size_t dimension() const { return this->inputs.size(); }
+        [[nodiscard]] std::uint64_t seed() const { return this->points.seed(); }
+        [[nodiscard]] const Sampler& sampler() const { return this->points; }
+
+    private:
+        std::vector<Distribution> inputs;
+        Sampler points;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
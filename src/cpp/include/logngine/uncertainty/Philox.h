@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Philox
+    // ==========================================================
+#pragma region Philox
+
+    // Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC 2011): a counter-based
+    // generator, i.e. a keyed bijection from a 128-bit counter to 128 random bits. Any draw can be computed directly
+    // from its coordinates, with no state to carry between draws or to split across threads.
+    using PhiloxCounter = std::array<std::uint32_t, 4>;
+    using PhiloxKey = std::array<std::uint32_t, 2>;
+
+    constexpr PhiloxCounter philox4x32(PhiloxCounter counter, PhiloxKey key)
+    {
+        constexpr std::uint64_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+        constexpr std::uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+        for (int round = 0; round < 10; ++round)
+        {
+            const std::uint64_t p0 = M0 * counter[0];
+            const std::uint64_t p1 = M1 * counter[2];
+            counter = {
+                static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                static_cast<std::uint32_t>(p0),
+            };
+            key = {key[0] + W0, key[1] + W1};
+        }
+        return counter;
+    }
+
+    // Uniform draws in the open interval (0, 1), with 53 random bits each, addressed by a stream (e.g. the index of
+    // a Monte Carlo sample) and an index within it. The same seed, stream and index always give the same draw, on any
+    // thread and in any order.
+    class Philox
+    {
+    public:
+        explicit constexpr Philox(const std::uint64_t seed = 0)
+            : key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)} {}
+
+        // Draws `2 * pair` and `2 * pair + 1` of `stream`.
+        [[nodiscard]] constexpr std::array<double, 2> pair(const std::uint64_t stream, const std::uint64_t pair) const
+        {
+            const PhiloxCounter bits = philox4x32({static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32),
+                                                   static_cast<std::uint32_t>(pair), static_cast<std::uint32_t>(pair >> 32)}, this->key);
+            return {to_unit(bits[0], bits[1]), to_unit(bits[2], bits[3])};
+        }
+
+        [[nodiscard]] constexpr double uniform(const std::uint64_t stream, const std::uint64_t index) const
+        {
+            return this->pair(stream, index / 2)[index % 2];
+        }
+
+    private:
+        // The top 53 bits of (high, low), centred in their interval so neither 0 nor 1 can come out.
+        static constexpr double to_unit(const std::uint32_t high, const std::uint32_t low)
+        {
+            const std::uint64_t bits = (static_cast<std::uint64_t>(high) << 32 | low) >> 11;
+            return (static_cast<double>(bits) + 0.5) * 0x1.0p-53;
+        }
+
+        PhiloxKey key;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
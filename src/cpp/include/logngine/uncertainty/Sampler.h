@@ -0,0 +1,83 @@
+#pragma once
+
+#include <logngine/uncertainty/Distribution.h>
+#include <logngine/uncertainty/Philox.h>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Sampler
+    // ==========================================================
+#pragma region Sampler
+
+    // Points of the open unit hypercube (0, 1)^dimension, addressed by index like `Philox` draws: any range of points
+    // can be made on any thread, in any order, with the same result. Besides plain pseudo-random points, three
+    // designs spread points more evenly than chance, so estimates of a mean converge faster than the 1/sqrt(n) of
+    // plain Monte Carlo for smooth models:
+    //  - Latin hypercube (McKay et al., 1979): each input's range is cut into `samples` equal strata, each hit once.
+    //  - Sobol (Joe & Kuo, 2008 direction numbers), Owen-scrambled by hashing (Burley, 2020); best at powers of two.
+    //  - Halton, with every digit of every dimension scrambled by its own random permutation.
+    // Scrambling keeps the evenness but makes every point uniform on its own, so means are unbiased and independent
+    // seeds give independent replicates for error bars.
+    class Sampler
+    {
+    public:
+        enum class Kind : std::uint8_t
+        {
+            Random,
+            LatinHypercube,
+            Sobol,
+            Halton,
+        };
+
+        // Each throws `std::invalid_argument` without dimensions.
+
+        // Plain `Philox(seed)` draws.
+        [[nodiscard]] static Sampler random(size_t dimension, std::uint64_t seed = 0);
+        // A design of exactly `samples` points (at most 2^32).
+        [[nodiscard]] static Sampler latin_hypercube(size_t dimension, std::uint64_t samples, std::uint64_t seed = 0);
+        // Up to 2^32 points. Unscrambled, the seed is unused.
+        [[nodiscard]] static Sampler sobol(size_t dimension, std::uint64_t seed = 0, bool scramble = true);
+        // At most 1000 dimensions; Halton points correlate badly beyond a few dozen anyway.
+        [[nodiscard]] static Sampler halton(size_t dimension, std::uint64_t seed = 0, bool scramble = true);
+
+        // Points [first, first + count) into `out` (count x dimension, row-major). Throws `std::invalid_argument` on
+        // a buffer of another size, or on points past the end of the design.
+        void points(std::uint64_t first, size_t count, std::span<double> out) const;
+        // `points`, each coordinate mapped through the quantile function of its input: samples of `inputs`.
+        void sample(std::span<const Distribution> inputs, std::uint64_t first, size_t count, std::span<double> out) const;
+
+        [[nodiscard]] Kind kind() const { return this->type; }
+        [[nodiscard]] size_t dimension() const { return this->dimensions; }
+        [[nodiscard]] std::uint64_t seed() const { return this->key; }
+        // Points the design has: `latin_hypercube`'s `samples`, 2^32 for Sobol, and otherwise 2^64 - 1.
+        [[nodiscard]] std::uint64_t size() const { return this->count; }
+
+    private:
+        Sampler(Kind type, size_t dimensions, std::uint64_t count, std::uint64_t seed, bool scramble);
+
+        Kind type;
+        size_t dimensions;
+        std::uint64_t count;
+        std::uint64_t key;
+        Philox generator;
+        // Per dimension: Latin hypercube stratum-permutation keys, or Sobol scrambling seeds
+        std::vector<std::uint32_t> keys;
+        // Sobol: 32 direction numbers per dimension
+        std::vector<std::uint32_t> directions;
+        // Halton: per dimension, its base, the offset of its digit permutations in `permutations`, and their count
+        struct Radix
+        {
+            std::uint32_t base;
+            size_t offset;
+            size_t digits;
+        };
+        std::vector<Radix> radices;
+        std::vector<std::uint16_t> permutations;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <logngine/uncertainty/Distribution.h>
+#include <logngine/uncertainty/MonteCarlo.h>
+#include <logngine/uncertainty/Sampler.h>
+#include <logngine/uncertainty/Statistics.h>
+#include <cstdint>
+#include <vector>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Sensitivity Analysis
+    // ==========================================================
+#pragma region SensitivityAnalysis
+
+    // A Sobol index with its bootstrap confidence interval.
+    struct SobolIndex
+    {
+        double estimate = 0.0;
+        double low = 0.0;
+        double high = 0.0;
+    };
+
+    // Sobol indices of every output with respect to every input.
+    struct SensitivityResult
+    {
+        std::uint64_t samples = 0;      // base samples N
+        std::uint64_t evaluations = 0;  // of the model: N * (inputs + 2)
+        size_t inputs = 0;
+        size_t outputs = 0;
+        double confidence = 0.0;           // of the intervals
+        std::vector<Moments> moments;      // per output, over its A and B evaluations
+        std::vector<SobolIndex> first_order_indices;  // outputs x inputs, row-major
+        std::vector<SobolIndex> total_indices;        // outputs x inputs, row-major
+
+        // Fraction of the variance of `output` due to `input` alone.
+        [[nodiscard]] const SobolIndex& first_order(const size_t output, const size_t input) const { return this->first_order_indices.at(output * this->inputs + input); }
+        // Fraction of the variance of `output` due to `input`, alone or with others.
+        [[nodiscard]] const SobolIndex& total(const size_t output, const size_t input) const { return this->total_indices.at(output * this->inputs + input); }
+    };
+
+    // Variance-based global sensitivity analysis of a model of independent inputs: first-order and total Sobol
+    // indices, by the Saltelli (2010) and Jansen (1999) estimators on two independent sample matrices A and B and the
+    // `inputs` matrices A_B^(i) (A with column i from B), so N * (inputs + 2) model evaluations for N base samples.
+    // The rows of A and B are the two halves of the points of a sampler of 2 x inputs dimensions (by default a
+    // scrambled Sobol sequence), mapped through the inputs' quantile functions.
+    //
+    // Evaluations run in blocks of base samples over the shared thread pool, each block's A, B and A_B rows in one
+    // model call; as in `MonteCarlo`, pooled batch calls the model makes run inline on its thread. Confidence
+    // intervals are bootstrap percentiles over resamples of the base samples; the run is reproducible for the same
+    // sampler, whatever the thread count.
+    class SensitivityAnalysis
+    {
+    public:
+        explicit SensitivityAnalysis(std::vector<Distribution> inputs, std::uint64_t seed = 0);
+        // Throws `std::invalid_argument` unless the sampler has two dimensions per input.
+        SensitivityAnalysis(std::vector<Distribution> inputs, Sampler sampler);
+
+        // `model` is a `MonteCarlo::Model`, and should depend on the inputs alone: the rows it gets are evaluations
+        // (inputs + 2) * sample + k, k being 0 for A, 1 for B and 2 + i for A_B^(i). Base samples with a non-finite
+        // output are left out of that output's indices. For Sobol points, `samples` is best a power of two.
+        //
+        // Throws `std::invalid_argument` if there are no outputs or samples, the block is empty, the confidence is
+        // not in (0, 1), or the sampler's design has fewer points than `samples`.
+        [[nodiscard]] SensitivityResult run(const MonteCarlo::Model& model, size_t outputs, std::uint64_t samples, size_t resamples = 200,
+                                            double confidence = 0.95, size_t block = 1024) const;
+
+        [[nodiscard]] size_t dimension() const { return this->inputs.size(); }
+        [[nodiscard]] const Sampler& sampler() const { return this->points; }
+
+    private:
+        std::vector<Distribution> inputs;
+        Sampler points;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Streaming Statistics
+    // ==========================================================
+#pragma region Statistics
+
+    // Every accumulator here summarises a stream in memory that does not grow with it, and merges with another over
+    // a disjoint part of the stream into the one over all of it, so parts can be summed on several threads or
+    // processes. `save` flattens one into doubles (counts are exact up to 2^53) that `load` restores, for shipping
+    // partial summaries between processes; `load` throws `std::invalid_argument` on anything `save` did not write.
+
+    // Count, mean and variance in one pass (Welford), merged as by Chan et al.
+    class Moments
+    {
+    public:
+        void add(double x);
+        void merge(const Moments& other);
+
+        [[nodiscard]] std::vector<double> save() const;
+        [[nodiscard]] static Moments load(std::span<const double> state);
+
+        [[nodiscard]] std::uint64_t count() const { return this->n; }
+        [[nodiscard]] double mean() const;
+        [[nodiscard]] double variance() const;  // unbiased (n - 1); NaN below 2 values
+        [[nodiscard]] double standard_deviation() const;
+        [[nodiscard]] double standard_error() const;  // of the mean
+        [[nodiscard]] double min() const { return this->lowest; }
+        [[nodiscard]] double max() const { return this->highest; }
+
+    private:
+        std::uint64_t n = 0;
+        double average = 0.0;
+        double m2 = 0.0;  // sum of squared deviations from the mean
+        double lowest = std::numeric_limits<double>::infinity();
+        double highest = -std::numeric_limits<double>::infinity();
+    };
+
+    // Quantiles of a stream in bounded memory: a merging t-digest (Dunning & Ertl, 2019) with the log-odds scale
+    // function, which keeps clusters small near the tails, so extreme quantiles stay accurate. Digests merge, like
+    // `Moments`.
+    class TDigest
+    {
+    public:
+        // Clusters are kept to about `compression`; more is more accurate and slower.
+        explicit TDigest(double compression = 200.0);
+
+        void add(double x, double weight = 1.0);
+        void merge(const TDigest& other);
+
+        [[nodiscard]] std::vector<double> save() const;
+        [[nodiscard]] static TDigest load(std::span<const double> state);
+
+        // Estimate of the value below which a fraction `q` of the stream lies; exact at 0 (min) and 1 (max). NaN if
+        // the digest is empty.
+        [[nodiscard]] double quantile(double q) const;
+        [[nodiscard]] double count() const { return this->total + this->buffered; }
+
+    private:
+        struct Centroid
+        {
+            double mean;
+            double weight;
+        };
+
+        // Folds the buffer into the clusters.
+        void compress();
+        // Clusters of `clusters` merged as far as the scale function allows.
+        [[nodiscard]] std::vector<Centroid> merged(std::vector<Centroid> clusters, double weight) const;
+
+        double compression;
+        std::vector<Centroid> centroids;  // sorted by mean
+        std::vector<Centroid> buffer;     // added since the last `compress`
+        double total = 0.0;
+        double buffered = 0.0;
+        double lowest = std::numeric_limits<double>::infinity();
+        double highest = -std::numeric_limits<double>::infinity();
+    };
+
+    // Means and covariance matrix of a stream of vectors, in one pass: the multivariate form of `Moments`.
+    class Covariance
+    {
+    public:
+        explicit Covariance(size_t dimension);
+
+        // Throws `std::invalid_argument` unless `x` has `dimension()` values. Vectors with a non-finite value are
+        // skipped.
+        void add(std::span<const double> x);
+        // Throws `std::invalid_argument` on another dimension.
+        void merge(const Covariance& other);
+
+        [[nodiscard]] std::vector<double> save() const;
+        [[nodiscard]] static Covariance load(std::span<const double> state);
+
+        [[nodiscard]] size_t dimension() const { return this->means.size(); }
+        [[nodiscard]] std::uint64_t count() const { return this->n; }
+        [[nodiscard]] double mean(size_t i) const;
+        [[nodiscard]] double covariance(size_t i, size_t j) const;  // unbiased (n - 1); NaN below 2 vectors
+        [[nodiscard]] double correlation(size_t i, size_t j) const;
+        // Row-major, dimension() x dimension().
+        [[nodiscard]] std::vector<double> matrix() const;
+
+    private:
+        std::uint64_t n = 0;
+        std::vector<double> means;
+        std::vector<double> comoments;  // sums of products of deviations; upper triangle of a row-major square
+    };
+
+    // Counts of a stream in equal-width bins over [low, high), with the values below and above counted apart.
+    class Histogram
+    {
+    public:
+        // Throws `std::invalid_argument` unless low < high (both finite) and there is at least one bin.
+        Histogram(double low, double high, size_t bins);
+
+        void add(double x);  // NaN is skipped
+        // Throws `std::invalid_argument` unless both have the same bins.
+        void merge(const Histogram& other);
+
+        [[nodiscard]] std::vector<double> save() const;
+        [[nodiscard]] static Histogram load(std::span<const double> state);
+
+        // Estimate of the value below which a fraction `q` of the stream lies, linear within its bin; NaN where that
+        // falls below or above the bins, or if the histogram is empty.
+        [[nodiscard]] double quantile(double q) const;
+
+        [[nodiscard]] std::uint64_t count() const;  // including under- and overflow
+        [[nodiscard]] std::span<const std::uint64_t> counts() const { return this->bins; }
+        [[nodiscard]] std::uint64_t underflow() const { return this->below; }
+        [[nodiscard]] std::uint64_t overflow() const { return this->above; }
+        [[nodiscard]] double low() const { return this->lower; }
+        [[nodiscard]] double high() const { return this->upper; }
+
+    private:
+        double lower;
+        double upper;
+        std::vector<std::uint64_t> bins;
+        std::uint64_t below = 0;
+        std::uint64_t above = 0;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
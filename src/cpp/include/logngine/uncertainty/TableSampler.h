@@ -0,0 +1,39 @@
+#pragma once
+
+#include <logngine/thermo/RectilinearTable.h>
+#include <logngine/thermo/ThermoState.h>
+#include <logngine/uncertainty/Philox.h>
+#include <cstdint>
+#include <optional>
+
+namespace logngine::uncertainty
+{
+    // ==========================================================
+    //  Table Sampler
+    // ==========================================================
+#pragma region TableSampler
+
+    // Random realisations of a baked table within the uncertainties its rows carry: in sample `i`, every row's
+    // volume, energy, enthalpy and entropy are each shifted by their own 1-sigma times an independent standard normal
+    // draw, and lookups interpolate the shifted rows. The draws are `Philox` draws addressed by (sample, row), so
+    // every lookup of one sample sees the same table, whichever thread makes it, and no table is ever copied. For a
+    // cubic table, the baked slopes are held fixed (as in `corners`), so a sample is not the table that would be
+    // baked from the shifted rows.
+    class TableSampler
+    {
+    public:
+        // The table is referenced, not copied, and must outlive the sampler; it must carry uncertainties, or this
+        // throws `std::invalid_argument`. Samplers of different tables should have different seeds, or their draws
+        // coincide row for row.
+        TableSampler(const thermo::RectilinearTable& table, std::uint64_t seed);
+
+        // `table.interpolate(pressure, temperature)` in sample `sample`'s realisation of the table.
+        [[nodiscard]] std::optional<thermo::ThermoState> interpolate(std::uint64_t sample, double pressure, double temperature) const;
+
+    private:
+        const thermo::RectilinearTable& table;
+        Philox generator;
+    };
+
+#pragma endregion
+} // namespace logngine::uncertainty
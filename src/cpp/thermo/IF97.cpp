@@ -0,0 +1,907 @@
+#include <logngine/thermo/IF97.h>
+#include <logngine/thermo/RootFinding.h>
+#include <logngine/core/SIMD.h>
+#include <logngine/core/ThreadPool.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace logngine::thermo
+{
+    namespace
+    {
+        using if97::Region;
+
+        constexpr double R = 461.526;  // specific gas constant, J/(kg*K)
+        constexpr double MPa = 1e6;
+        constexpr double kJ = 1e3;
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        constexpr double MIN_TEMPERATURE = 273.15;
+        constexpr double REGION1_MAX_TEMPERATURE = 623.15;
+        constexpr double REGION2_MAX_TEMPERATURE = 1073.15;
+        constexpr double REGION5_MAX_TEMPERATURE = 2273.15;
+        constexpr double B23_MAX_TEMPERATURE = 863.15;
+        constexpr double MAX_PRESSURE = 100.0 * MPa;
+        constexpr double REGION5_MAX_PRESSURE = 50.0 * MPa;
+        constexpr double MIN_SATURATION_PRESSURE = 611.213;
+        constexpr double MIN_PRESSURE = 1.0;  // isotherms are searched from here; region 2 itself goes down to 0
+
+        // Region 3 densities are bracketed by stepping from one end of this range; from the dense end for liquid and
+        // supercritical states, from the dilute end for vapor, so that inside the dome the stable root comes first.
+        constexpr double REGION3_MIN_DENSITY = 20.0;
+        constexpr double REGION3_MAX_DENSITY = 800.0;
+        constexpr double REGION3_DENSITY_STEP = 20.0;
+
+        // Points on the saturation line belong to the liquid; vapor-side searches stop this far (relatively) short.
+        constexpr double SATURATION_OFFSET = 1e-9;
+
+        // ==== Polynomial Sums ====
+
+        constexpr size_t LANES = 8;        // points per batched evaluation
+        constexpr size_t MAX_POWERS = 64;  // exponent span of any one polynomial's base
+        template <size_t W>
+        using Lanes = std::array<double, W>;
+        template <size_t W>
+        using PowerTable = std::array<Lanes<W>, MAX_POWERS>;
+
+        // sum_i n_i x^I_i y^J_i with integer exponents. The coefficients of its first and second derivatives are
+        // folded in ahead of time, so one pass over the terms gives all six sums; every term is two loads from the
+        // power tables and six fused multiply-adds per point, with the points in the innermost (vector) dimension.
+        template <size_t N>
+        struct Polynomial
+        {
+            std::array<size_t, N> I{};  // rows of the power tables, i.e. exponent - min exponent
+            std::array<size_t, N> J{};
+            std::array<std::array<double, N>, 6> c{};  // n, nI, nI(I - 1), nJ, nJ(J - 1), nIJ
+            int I_min = 0;  // <= 0
+            size_t I_rows = 0;
+            int J_min = 0;
+            size_t J_rows = 0;
+        };
+
+        template <size_t N>
+        constexpr Polynomial<N> polynomial(const std::array<int, N>& I, const std::array<int, N>& J, const std::array<double, N>& n)
+        {
+            Polynomial<N> p;
+            // The power tables always hold x^0, which the others are built out from
+            p.I_min = std::min(*std::min_element(I.begin(), I.end()), 0);
+            p.J_min = std::min(*std::min_element(J.begin(), J.end()), 0);
+            p.I_rows = static_cast<size_t>(std::max(*std::max_element(I.begin(), I.end()), 0) - p.I_min + 1);
+            p.J_rows = static_cast<size_t>(std::max(*std::max_element(J.begin(), J.end()), 0) - p.J_min + 1);
+            if (p.I_rows > MAX_POWERS || p.J_rows > MAX_POWERS) throw std::invalid_argument("Polynomial exponents span too many powers...");
+            for (size_t k = 0; k < N; ++k)
+            {
+                p.I[k] = static_cast<size_t>(I[k] - p.I_min);
+                p.J[k] = static_cast<size_t>(J[k] - p.J_min);
+                p.c[0][k] = n[k];
+                p.c[1][k] = n[k] * I[k];
+                p.c[2][k] = n[k] * I[k] * (I[k] - 1);
+                p.c[3][k] = n[k] * J[k];
+                p.c[4][k] = n[k] * J[k] * (J[k] - 1);
+                p.c[5][k] = n[k] * I[k] * J[k];
+            }
+            return p;
+        }
+
+        // Row r holds x^(min + r) for every point. Each power is the product of two lower ones (x^e = x^(e/2) *
+        // x^(e - e/2)), so the rows depend on each other only log2(rows) deep and the table fills at full throughput.
+        template <size_t W>
+        void power_table(const Lanes<W>& x, const int min, const size_t rows, PowerTable<W>& table)
+        {
+            const auto zero = static_cast<size_t>(-min);
+            const int max = static_cast<int>(rows) + min - 1;
+            table[zero].fill(1.0);
+            if (max >= 1) table[zero + 1] = x;
+            if (min <= -1)
+                for (size_t j = 0; j < W; ++j) table[zero - 1][j] = 1.0 / x[j];
+            for (int e = 2; e <= max; ++e)
+                for (size_t j = 0; j < W; ++j) table[zero + e][j] = table[zero + e / 2][j] * table[zero + e - e / 2][j];
+            for (int e = -2; e >= min; --e)
+                for (size_t j = 0; j < W; ++j) table[zero + e][j] = table[zero + e / 2][j] * table[zero + e - e / 2][j];
+        }
+
+        // The first `K` sums (1: the value only, 3: with its x derivatives, 6: with every derivative) at each of `W`
+        // points.
+        template <size_t K, size_t W, size_t N>
+        void sum_terms_scalar(const Polynomial<N>& p, const Lanes<W>& x, const Lanes<W>& y, std::array<Lanes<W>, 6>& sums)
+        {
+            PowerTable<W> xp, yp;
+            power_table(x, p.I_min, p.I_rows, xp);
+            power_table(y, p.J_min, p.J_rows, yp);
+
+            for (size_t m = 0; m < K; ++m) sums[m].fill(0.0);
+            for (size_t k = 0; k < N; ++k)
+                for (size_t j = 0; j < W; ++j)
+                {
+                    const double t = xp[p.I[k]][j] * yp[p.J[k]][j];
+                    for (size_t m = 0; m < K; ++m) sums[m][j] += p.c[m][k] * t;
+                }
+        }
+
+#if LOGNGINE_X86
+        LOGNGINE_TARGET("avx2,fma")
+        void power_table_avx2(const Lanes<LANES>& x, const int min, const size_t rows, PowerTable<LANES>& table)
+        {
+            constexpr size_t WIDTH = 4;
+            const auto zero = static_cast<size_t>(-min);
+            const int max = static_cast<int>(rows) + min - 1;
+            for (size_t j = 0; j < LANES; j += WIDTH)
+            {
+                const __m256d xv = _mm256_loadu_pd(&x[j]);
+                _mm256_storeu_pd(&table[zero][j], _mm256_set1_pd(1.0));
+                if (max >= 1) _mm256_storeu_pd(&table[zero + 1][j], xv);
+                if (min <= -1) _mm256_storeu_pd(&table[zero - 1][j], _mm256_div_pd(_mm256_set1_pd(1.0), xv));
+                for (int e = 2; e <= max; ++e)
+                    _mm256_storeu_pd(&table[zero + e][j], _mm256_mul_pd(_mm256_loadu_pd(&table[zero + e / 2][j]), _mm256_loadu_pd(&table[zero + e - e / 2][j])));
+                for (int e = -2; e >= min; --e)
+                    _mm256_storeu_pd(&table[zero + e][j], _mm256_mul_pd(_mm256_loadu_pd(&table[zero + e / 2][j]), _mm256_loadu_pd(&table[zero + e - e / 2][j])));
+            }
+        }
+
+        LOGNGINE_TARGET("avx512f")
+        void power_table_avx512(const Lanes<LANES>& x, const int min, const size_t rows, PowerTable<LANES>& table)
+        {
+            const auto zero = static_cast<size_t>(-min);
+            const int max = static_cast<int>(rows) + min - 1;
+            const __m512d xv = _mm512_loadu_pd(x.data());
+            _mm512_storeu_pd(table[zero].data(), _mm512_set1_pd(1.0));
+            if (max >= 1) _mm512_storeu_pd(table[zero + 1].data(), xv);
+            if (min <= -1) _mm512_storeu_pd(table[zero - 1].data(), _mm512_div_pd(_mm512_set1_pd(1.0), xv));
+            for (int e = 2; e <= max; ++e)
+                _mm512_storeu_pd(table[zero + e].data(), _mm512_mul_pd(_mm512_loadu_pd(table[zero + e / 2].data()), _mm512_loadu_pd(table[zero + e - e / 2].data())));
+            for (int e = -2; e >= min; --e)
+                _mm512_storeu_pd(table[zero + e].data(), _mm512_mul_pd(_mm512_loadu_pd(table[zero + e / 2].data()), _mm512_loadu_pd(table[zero + e - e / 2].data())));
+        }
+
+        template <size_t N>
+        LOGNGINE_TARGET("avx2,fma")
+        void sum_terms_avx2(const Polynomial<N>& p, const Lanes<LANES>& x, const Lanes<LANES>& y, std::array<Lanes<LANES>, 6>& sums)
+        {
+            constexpr size_t WIDTH = 4;
+            PowerTable<LANES> xp, yp;
+            power_table_avx2(x, p.I_min, p.I_rows, xp);
+            power_table_avx2(y, p.J_min, p.J_rows, yp);
+
+            for (size_t j = 0; j < LANES; j += WIDTH)
+            {
+                __m256d acc[6];
+                for (auto& a : acc) a = _mm256_setzero_pd();
+                for (size_t k = 0; k < N; ++k)
+                {
+                    const __m256d t = _mm256_mul_pd(_mm256_loadu_pd(&xp[p.I[k]][j]), _mm256_loadu_pd(&yp[p.J[k]][j]));
+                    for (size_t m = 0; m < 6; ++m) acc[m] = _mm256_fmadd_pd(_mm256_set1_pd(p.c[m][k]), t, acc[m]);
+                }
+                for (size_t m = 0; m < 6; ++m) _mm256_storeu_pd(&sums[m][j], acc[m]);
+            }
+        }
+
+        template <size_t N>
+        LOGNGINE_TARGET("avx512f")
+        void sum_terms_avx512(const Polynomial<N>& p, const Lanes<LANES>& x, const Lanes<LANES>& y, std::array<Lanes<LANES>, 6>& sums)
+        {
+            static_assert(LANES == 8);
+            PowerTable<LANES> xp, yp;
+            power_table_avx512(x, p.I_min, p.I_rows, xp);
+            power_table_avx512(y, p.J_min, p.J_rows, yp);
+
+            __m512d acc[6];
+            for (auto& a : acc) a = _mm512_set1_pd(0.0);
+            for (size_t k = 0; k < N; ++k)
+            {
+                const __m512d t = _mm512_mul_pd(_mm512_loadu_pd(xp[p.I[k]].data()), _mm512_loadu_pd(yp[p.J[k]].data()));
+                for (size_t m = 0; m < 6; ++m) acc[m] = _mm512_fmadd_pd(_mm512_set1_pd(p.c[m][k]), t, acc[m]);
+            }
+            for (size_t m = 0; m < 6; ++m) _mm512_storeu_pd(sums[m].data(), acc[m]);
+        }
+#endif
+
+        template <size_t W, size_t N>
+        void sum_terms(const Polynomial<N>& p, const Lanes<W>& x, const Lanes<W>& y, std::array<Lanes<W>, 6>& sums)
+        {
+            if constexpr (W == LANES)
+            {
+#if LOGNGINE_X86
+                switch (core::simd_level())
+                {
+                case core::SIMDLevel::AVX512:
+                    return sum_terms_avx512(p, x, y, sums);
+                case core::SIMDLevel::AVX2:
+                    return sum_terms_avx2(p, x, y, sums);
+                default:
+                    break;
+                }
+#endif
+            }
+            sum_terms_scalar<6>(p, x, y, sums);
+        }
+
+        // Dimensionless free energy and its derivatives in its reduced variables (pi or delta, tau).
+        struct Derivatives
+        {
+            double value = 0.0;
+            double x = 0.0;
+            double y = 0.0;
+            double xx = 0.0;
+            double yy = 0.0;
+            double xy = 0.0;
+        };
+
+        // Point `j` of the sums of a polynomial in x = sign * pi + const and y = tau + const.
+        template <size_t W>
+        Derivatives reduce(const std::array<Lanes<W>, 6>& sums, const size_t j, const double x, const double y, const double sign = 1.0)
+        {
+            return {
+                sums[0][j],
+                sign * sums[1][j] / x,
+                sums[3][j] / y,
+                sums[2][j] / (x * x),
+                sums[4][j] / (y * y),
+                sign * sums[5][j] / (x * y),
+            };
+        }
+
+        // ==== Coefficients ====
+
+        constexpr auto REGION1 = polynomial<34>(
+            {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 8, 8, 21, 23, 29, 30, 31, 32},
+            {-2, -1, 0, 1, 2, 3, 4, 5, -9, -7, -1, 0, 1, 3, -3, 0, 1, 3, 17, -4, 0, 6, -5, -2, 10, -8, -11, -6, -29, -31, -38, -39, -40, -41},
+            {
+                0.14632971213167, -0.84548187169114, -0.37563603672040e1, 0.33855169168385e1, -0.95791963387872,
+                0.15772038513228, -0.16616417199501e-1, 0.81214629983568e-3, 0.28319080123804e-3, -0.60706301565874e-3,
+                -0.18990068218419e-1, -0.32529748770505e-1, -0.21841717175414e-1, -0.52838357969930e-4, -0.47184321073267e-3,
+                -0.30001780793026e-3, 0.47661393906987e-4, -0.44141845330846e-5, -0.72694996297594e-15, -0.31679644845054e-4,
+                -0.28270797985312e-5, -0.85205128120103e-9, -0.22425281908000e-5, -0.65171222895601e-6, -0.14341729937924e-12,
+                -0.40516996860117e-6, -0.12734301741641e-8, -0.17424871230634e-9, -0.68762131295531e-18, 0.14478307828521e-19,
+                0.26335781662795e-22, -0.11947622640071e-22, 0.18228094581404e-23, -0.93537087292458e-25,
+            });
+
+        constexpr auto REGION2_IDEAL = polynomial<9>(
+            {0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {0, 1, -5, -4, -3, -2, -1, 2, 3},
+            {
+                -0.96927686500217e1, 0.10086655968018e2, -0.56087911283020e-2, 0.71452738081455e-1, -0.40710498223928,
+                0.14240819171444e1, -0.43839511319450e1, -0.28408632460772, 0.21268463753307e-1,
+            });
+
+        constexpr auto REGION2_RESIDUAL = polynomial<43>(
+            {1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 5, 6, 6, 6, 7, 7, 7, 8, 8, 9, 10, 10, 10, 16, 16, 18, 20, 20, 20, 21, 22, 23, 24, 24, 24},
+            {0, 1, 2, 3, 6, 1, 2, 4, 7, 36, 0, 1, 3, 6, 35, 1, 2, 3, 7, 3, 16, 35, 0, 11, 25, 8, 36, 13, 4, 10, 14, 29, 50, 57, 20, 35, 48, 21, 53, 39, 26, 40, 58},
+            {
+                -0.17731742473213e-2, -0.17834862292358e-1, -0.45996013696365e-1, -0.57581259083432e-1, -0.50325278727930e-1,
+                -0.33032641670203e-4, -0.18948987516315e-3, -0.39392777243355e-2, -0.43797295650573e-1, -0.26674547914087e-4,
+                0.20481737692309e-7, 0.43870667284435e-6, -0.32277677238570e-4, -0.15033924542148e-2, -0.40668253562649e-1,
+                -0.78847309559367e-9, 0.12790717852285e-7, 0.48225372718507e-6, 0.22922076337661e-5, -0.16714766451061e-10,
+                -0.21171472321355e-2, -0.23895741934104e2, -0.59059564324270e-17, -0.12621808899101e-5, -0.38946842435739e-1,
+                0.11256211360459e-10, -0.82311340897998e1, 0.19809712802088e-7, 0.10406965210174e-18, -0.10234747095929e-12,
+                -0.10018179379511e-8, -0.80882908646985e-10, 0.10693031879409, -0.33662250574171, 0.89185845355421e-24,
+                0.30629316876232e-12, -0.42002467698208e-5, -0.59056029685639e-25, 0.37826947613457e-5, -0.12768608934681e-14,
+                0.73087610595061e-28, 0.55414715350778e-16, -0.94369707241210e-6,
+            });
+
+        // The ln(delta) term, n_1, is added separately.
+        constexpr double REGION3_LOG = 0.10658070028513e1;
+        constexpr auto REGION3 = polynomial<39>(
+            {0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 8, 9, 9, 10, 10, 11},
+            {0, 1, 2, 7, 10, 12, 23, 2, 6, 15, 17, 0, 2, 6, 7, 22, 26, 0, 2, 4, 16, 26, 0, 2, 4, 26, 1, 3, 26, 0, 2, 26, 2, 26, 2, 26, 0, 1, 26},
+            {
+                -0.15732845290239e2, 0.20944396974307e2, -0.76867707878716e1, 0.26185947787954e1, -0.28080781148620e1,
+                0.12053369696517e1, -0.84566812812502e-2, -0.12654315477714e1, -0.11524407806681e1, 0.88521043984318,
+                -0.64207765181607, 0.38493460186671, -0.85214708824206, 0.48972281541877e1, -0.30502617256965e1,
+                0.39420536879154e-1, 0.12558408424308, -0.27999329698710, 0.13899799569460e1, -0.20189915023570e1,
+                -0.82147637173963e-2, -0.47596035734923, 0.43984074473500e-1, -0.44476435428739, 0.90572070719733,
+                0.70522450087967, 0.10770512626332, -0.32913623258954, -0.50871062041158, -0.22175400873096e-1,
+                0.94260751665092e-1, 0.16436278447961, -0.13503372241348e-1, -0.14834345352472e-1, 0.57922953628084e-3,
+                0.32308904703711e-2, 0.80964802996215e-4, -0.16557679795037e-3, -0.44923899061815e-4,
+            });
+
+        constexpr std::array<double, 10> REGION4 = {
+            0.11670521452767e4, -0.72421316703206e6, -0.17073846940092e2, 0.12020824702470e5, -0.32325550322333e7,
+            0.14915108613530e2, -0.48232657361591e4, 0.40511340542057e6, -0.23855557567849, 0.65017534844798e3,
+        };
+
+        constexpr std::array<double, 5> B23 = {
+            0.34805185628969e3, -0.11671859879975e1, 0.10192970039326e-2, 0.57254459862746e3, 0.13918839778870e2,
+        };
+
+        constexpr auto REGION5_IDEAL = polynomial<6>(
+            {0, 0, 0, 0, 0, 0},
+            {0, 1, -3, -2, -1, 2},
+            {-0.13179983674201e2, 0.68540841634434e1, -0.24805148933466e-1, 0.36901534980333, -0.31161318213925e1, -0.32961626538917});
+
+        constexpr auto REGION5_RESIDUAL = polynomial<6>(
+            {1, 1, 1, 2, 2, 3},
+            {1, 2, 3, 3, 9, 7},
+            {0.15736404855259e-2, 0.90153761673944e-3, -0.50270077677648e-2, 0.22440037409485e-5, -0.41163275453471e-5, 0.37919454822955e-7});
+
+        // Backward T(P, h) and T(P, s). Region 2a's T(P, s) has quarter-integer pressure exponents, so it is a
+        // polynomial in pi^(1/4) with four times the exponents.
+        constexpr auto REGION1_PH = polynomial<20>(
+            {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 3, 3, 4, 5, 6},
+            {0, 1, 2, 6, 22, 32, 0, 1, 2, 3, 4, 10, 32, 10, 32, 10, 32, 32, 32, 32},
+            {
+                -0.23872489924521e3, 0.40421188637945e3, 0.11349746881718e3, -0.58457616048039e1, -0.15285482413140e-3,
+                -0.10866707695377e-5, -0.13391744872602e2, 0.43211039183559e2, -0.54010067170506e2, 0.30535892203916e2,
+                -0.65964749423638e1, 0.93965400878363e-2, 0.11573647505340e-6, -0.25858641282073e-4, -0.40644363084799e-8,
+                0.66456186191635e-7, 0.80670734103027e-10, -0.93477771213947e-12, 0.58265442020601e-14, -0.15020185953503e-16,
+            });
+
+        constexpr auto REGION1_PS = polynomial<20>(
+            {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 4},
+            {0, 1, 2, 3, 11, 31, 0, 1, 2, 3, 12, 31, 0, 1, 2, 9, 31, 10, 32, 32},
+            {
+                0.17478268058307e3, 0.34806930892873e2, 0.65292584978455e1, 0.33039981775489, -0.19281382923196e-6,
+                -0.24909197244573e-22, -0.26107636489332, 0.22592965981586, -0.64256463395226e-1, 0.78876289270526e-2,
+                0.35672110607366e-9, 0.17332496994895e-23, 0.56608900654837e-3, -0.32635483139717e-3, 0.44778286690632e-4,
+                -0.51322156908507e-9, -0.42522657042207e-25, 0.26400441360689e-12, 0.78124600459723e-28, -0.30732199903668e-30,
+            });
+
+        constexpr std::array<double, 5> B2BC = {
+            0.90584278514723e3, -0.67955786399241, 0.12809002730136e-3, 0.26526571908428e4, 0.45257578905948e1,
+        };
+
+        constexpr auto REGION2A_PH = polynomial<34>(
+            {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7},
+            {0, 1, 2, 3, 7, 20, 0, 1, 2, 3, 7, 9, 11, 18, 44, 0, 2, 7, 36, 38, 40, 42, 44, 24, 44, 12, 32, 44, 32, 36, 42, 34, 44, 28},
+            {
+                0.10898952318288e4, 0.84951654495535e3, -0.10781748091826e3, 0.33153654801263e2, -0.74232016790248e1,
+                0.11765048724356e2, 0.18445749355790e1, -0.41792700549624e1, 0.62478196935812e1, -0.17344563108114e2,
+                -0.20058176862096e3, 0.27196065473796e3, -0.45511318285818e3, 0.30919688604755e4, 0.25226640357872e6,
+                -0.61707422868339e-2, -0.31078046629583, 0.11670873077107e2, 0.12812798404046e9, -0.98554909623276e9,
+                0.28224546973002e10, -0.35948971410703e10, 0.17227349913197e10, -0.13551334240775e5, 0.12848734664650e8,
+                0.13865724283226e1, 0.23598832556514e6, -0.13105236545054e8, 0.73999835474766e4, -0.55196697030060e6,
+                0.37154085996233e7, 0.19127729239660e5, -0.41535164835634e6, -0.62459855192507e2,
+            });
+
+        constexpr auto REGION2B_PH = polynomial<38>(
+            {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 6, 7, 7, 9, 9},
+            {0, 1, 2, 12, 18, 24, 28, 40, 0, 2, 6, 12, 18, 24, 28, 40, 2, 8, 18, 40, 1, 2, 12, 24, 2, 12, 18, 24, 28, 40, 18, 24, 40, 28, 2, 28, 1, 40},
+            {
+                0.14895041079516e4, 0.74307798314034e3, -0.97708318797837e2, 0.24742464705674e1, -0.63281320016026,
+                0.11385952129658e1, -0.47811863648625, 0.85208123431544e-2, 0.93747147377932, 0.33593118604916e1,
+                0.33809355601454e1, 0.16844539671904, 0.73875745236695, -0.47128737436186, 0.15020273139707,
+                -0.21764114219750e-2, -0.21810755324761e-1, -0.10829784403677, -0.46333324635812e-1, 0.71280351959551e-4,
+                0.11032831789999e-3, 0.18955248387902e-3, 0.30891541160537e-2, 0.13555504554949e-2, 0.28640237477456e-6,
+                -0.10779857357512e-4, -0.76462712454814e-4, 0.14052392818316e-4, -0.31083814331434e-4, -0.10302738212103e-5,
+                0.28217281635040e-6, 0.12704902271945e-5, 0.73803353468292e-7, -0.11030139238909e-7, -0.81456365207833e-13,
+                -0.25180545682962e-10, -0.17565233969407e-17, 0.86934156344163e-14,
+            });
+
+        constexpr auto REGION2C_PH = polynomial<23>(
+            {-7, -7, -6, -6, -5, -5, -2, -2, -1, -1, 0, 0, 1, 1, 2, 6, 6, 6, 6, 6, 6, 6, 6},
+            {0, 4, 0, 2, 0, 2, 0, 1, 0, 2, 0, 1, 4, 8, 4, 0, 1, 4, 10, 12, 16, 20, 22},
+            {
+                -0.32368398555242e13, 0.73263350902181e13, 0.35825089945447e12, -0.58340131851590e12, -0.10783068217470e11,
+                0.20825544563171e11, 0.61074783564516e6, 0.85977722535580e6, -0.25745723604170e5, 0.31081088422714e5,
+                0.12082315865936e4, 0.48219755109255e3, 0.37966001272486e1, -0.10842984880077e2, -0.45364172676660e-1,
+                0.14559115658698e-12, 0.11261597407230e-11, -0.17804982240686e-10, 0.12324579690832e-6, -0.11606921130984e-5,
+                0.27846367088554e-4, -0.59270038474176e-3, 0.12918582991878e-2,
+            });
+
+        constexpr auto REGION2A_PS = polynomial<46>(
+            {-6, -6, -6, -6, -6, -6, -5, -5, -5, -4, -4, -4, -4, -4, -4, -3, -3, -2, -2, -2, -2, -1, -1, -1, -1,
+             1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 5, 5, 6, 6},
+            {-24, -23, -19, -13, -11, -10, -19, -15, -6, -26, -21, -17, -16, -9, -8, -15, -14, -26, -13, -9, -7, -27, -25, -11, -6,
+             1, 4, 8, 11, 0, 1, 5, 6, 10, 14, 16, 0, 4, 9, 17, 7, 18, 3, 15, 5, 18},
+            {
+                -0.39235983861984e6, 0.51526573827270e6, 0.40482443161048e5, -0.32193790923902e3, 0.96961424218694e2,
+                -0.22867846371773e2, -0.44942914124357e6, -0.50118336020166e4, 0.35684463560015, 0.44235335848190e5,
+                -0.13673388811708e5, 0.42163260207864e6, 0.22516925837475e5, 0.47442144865646e3, -0.14931130797647e3,
+                -0.19781126320452e6, -0.23554399470760e5, -0.19070616302076e5, 0.55375669883164e5, 0.38293691437363e4,
+                -0.60391860580567e3, 0.19363102620331e4, 0.42660643698610e4, -0.59780638872718e4, -0.70401463926862e3,
+                0.33836784107553e3, 0.20862786635187e2, 0.33834172656196e-1, -0.43124428414893e-4, 0.16653791356412e3,
+                -0.13986292055898e3, -0.78849547999872, 0.72132411753872e-1, -0.59754839398283e-2, -0.12141358953904e-4,
+                0.23227096733871e-6, -0.10538463566194e2, 0.20718925496502e1, -0.72193155260427e-1, 0.20749887081120e-6,
+                -0.18340657911379e-1, 0.29036272348696e-6, 0.21037527893619, 0.25681239729999e-3, -0.12799002933781e-1,
+                -0.82198102652018e-5,
+            });
+
+        constexpr auto REGION2B_PS = polynomial<44>(
+            {-6, -6, -5, -5, -4, -4, -4, -3, -3, -3, -3, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+             1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5, 5},
+            {0, 11, 0, 11, 0, 1, 11, 0, 1, 11, 12, 0, 1, 6, 10, 0, 1, 5, 8, 9, 0, 1, 2, 4, 5, 6, 9,
+             0, 1, 2, 3, 7, 8, 0, 1, 5, 0, 1, 3, 0, 1, 0, 1, 2},
+            {
+                0.31687665083497e6, 0.20864175881858e2, -0.39859399803599e6, -0.21816058518877e2, 0.22369785194242e6,
+                -0.27841703445817e4, 0.99207436071480e1, -0.75197512299157e5, 0.29708605951158e4, -0.34406878548526e1,
+                0.38815564249115, 0.17511295085750e5, -0.14237112854449e4, 0.10943803364167e1, 0.89971619308495,
+                -0.33759740098958e4, 0.47162885818355e3, -0.19188241993679e1, 0.41078580492196, -0.33465378172097,
+                0.13870034777505e4, -0.40663326195838e3, 0.41727347159610e2, 0.21932549434532e1, -0.10320050009077e1,
+                0.35882943516703, 0.52511453726066e-2, 0.12838916450705e2, -0.28642437219381e1, 0.56912683664855,
+                -0.99962954584931e-1, -0.32632037778459e-2, 0.23320922576723e-3, -0.15334809857450, 0.29072288239902e-1,
+                0.37534702741167e-3, 0.17296691702411e-2, -0.38556050844504e-3, -0.35017712292608e-4, -0.14566393631492e-4,
+                0.56420857267269e-5, 0.41286150074605e-7, -0.20684671118824e-7, 0.16409393674725e-8,
+            });
+
+        constexpr auto REGION2C_PS = polynomial<30>(
+            {-2, -2, -1, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7, 7, 7, 7},
+            {0, 1, 0, 0, 1, 2, 3, 0, 1, 3, 4, 0, 1, 2, 0, 1, 5, 0, 1, 4, 0, 1, 2, 0, 1, 0, 1, 3, 4, 5},
+            {
+                0.90968501005365e3, 0.24045667088420e4, -0.59162326387130e3, 0.54145404128074e3, -0.27098308411192e3,
+                0.97976525097926e3, -0.46966772959435e3, 0.14399274604723e2, -0.19104204230429e2, 0.53299167111971e1,
+                -0.21252975375934e2, -0.31147334413760, 0.60334840894623, -0.42764839702509e-1, 0.58185597255259e-2,
+                -0.14597008284753e-1, 0.56631175631027e-2, -0.76155864584577e-4, 0.22440342919332e-3, -0.12561095013413e-4,
+                0.63323132660934e-6, -0.20541989675375e-5, 0.36405370390082e-7, -0.29759897789215e-8, 0.10136618529763e-7,
+                0.59925719692351e-11, -0.20677870105164e-10, -0.20874278181886e-10, 0.10162166825089e-9, -0.16429828281347e-9,
+            });
+
+        // ==== Basic Equations ====
+
+        // State and its (P, T) derivatives from the dimensionless Gibbs free energy gamma(pi, tau).
+        ThermoGradient gibbs(const Derivatives& g, const double pressure, const double temperature, const double reducing_pressure, const double reducing_temperature)
+        {
+            const double tau = reducing_temperature / temperature;
+            const double v = R * temperature * g.x / reducing_pressure;
+            const double h = R * reducing_temperature * g.y;
+            const double dv_dp = R * temperature * g.xx / (reducing_pressure * reducing_pressure);
+            const double dv_dt = R * (g.x - tau * g.xy) / reducing_pressure;
+            const double dh_dp = R * reducing_temperature * g.xy / reducing_pressure;
+            const double dh_dt = -R * tau * tau * g.yy;  // cp
+            return {
+                {pressure, temperature, v, h - pressure * v, h, R * (tau * g.y - g.value)},
+                {1.0, 0.0, dv_dp, dh_dp - v - pressure * dv_dp, dh_dp, -dv_dt},
+                {0.0, 1.0, dv_dt, dh_dt - pressure * dv_dt, dh_dt, dh_dt / temperature},
+            };
+        }
+
+        template <size_t W>
+        void region1(const Lanes<W>& pressure, const Lanes<W>& temperature, std::array<ThermoGradient, W>& out)
+        {
+            constexpr double P_STAR = 16.53 * MPa;
+            constexpr double T_STAR = 1386.0;
+            Lanes<W> x, y;
+            for (size_t j = 0; j < W; ++j)
+            {
+                x[j] = 7.1 - pressure[j] / P_STAR;
+                y[j] = T_STAR / temperature[j] - 1.222;
+            }
+            std::array<Lanes<W>, 6> sums;
+            sum_terms(REGION1, x, y, sums);
+            for (size_t j = 0; j < W; ++j) out[j] = gibbs(reduce(sums, j, x[j], y[j], -1.0), pressure[j], temperature[j], P_STAR, T_STAR);
+        }
+
+        // Regions 2 and 5: gamma = ln(pi) + ideal(tau) + residual(pi, tau - shift).
+        template <size_t W, size_t N0, size_t N>
+        void ideal_gas_gibbs(const Polynomial<N0>& ideal, const Polynomial<N>& residual, const double reducing_temperature, const double shift,
+                             const Lanes<W>& pressure, const Lanes<W>& temperature, std::array<ThermoGradient, W>& out)
+        {
+            constexpr double P_STAR = MPa;
+            Lanes<W> pi, tau, shifted, ones;
+            for (size_t j = 0; j < W; ++j)
+            {
+                pi[j] = pressure[j] / P_STAR;
+                tau[j] = reducing_temperature / temperature[j];
+                shifted[j] = tau[j] - shift;
+                ones[j] = 1.0;
+            }
+            std::array<Lanes<W>, 6> ideal_sums, residual_sums;
+            sum_terms(ideal, ones, tau, ideal_sums);
+            sum_terms(residual, pi, shifted, residual_sums);
+            for (size_t j = 0; j < W; ++j)
+            {
+                const Derivatives i = reduce(ideal_sums, j, 1.0, tau[j]);
+                const Derivatives r = reduce(residual_sums, j, pi[j], shifted[j]);
+                const Derivatives g{
+                    std::log(pi[j]) + i.value + r.value, 1.0 / pi[j] + r.x, i.y + r.y, -1.0 / (pi[j] * pi[j]) + r.xx, i.yy + r.yy, r.xy,
+                };
+                out[j] = gibbs(g, pressure[j], temperature[j], P_STAR, reducing_temperature);
+            }
+        }
+
+        template <size_t W>
+        void region2(const Lanes<W>& pressure, const Lanes<W>& temperature, std::array<ThermoGradient, W>& out)
+        {
+            ideal_gas_gibbs(REGION2_IDEAL, REGION2_RESIDUAL, 540.0, 0.5, pressure, temperature, out);
+        }
+
+        template <size_t W>
+        void region5(const Lanes<W>& pressure, const Lanes<W>& temperature, std::array<ThermoGradient, W>& out)
+        {
+            ideal_gas_gibbs(REGION5_IDEAL, REGION5_RESIDUAL, 1000.0, 0.0, pressure, temperature, out);
+        }
+
+        template <void (*Region)(const Lanes<1>&, const Lanes<1>&, std::array<ThermoGradient, 1>&)>
+        ThermoGradient at(const double pressure, const double temperature)
+        {
+            std::array<ThermoGradient, 1> out;
+            Region({pressure}, {temperature}, out);
+            return out[0];
+        }
+
+        // Region 3 is in (density, T), from the dimensionless Helmholtz free energy phi(delta, tau); its
+        // derivatives are carried over to (P, T) at constant T and P respectively.
+        ThermoGradient region3(const double density, const double temperature)
+        {
+            const double delta = density / if97::CRITICAL_DENSITY;
+            const double tau = if97::CRITICAL_TEMPERATURE / temperature;
+            std::array<Lanes<1>, 6> sums;
+            sum_terms(REGION3, Lanes<1>{delta}, Lanes<1>{tau}, sums);
+            Derivatives f = reduce(sums, 0, delta, tau);
+            f.value += REGION3_LOG * std::log(delta);
+            f.x += REGION3_LOG / delta;
+            f.xx -= REGION3_LOG / (delta * delta);
+
+            const double RT = R * temperature;
+            const double p = density * RT * delta * f.x;
+            const double dp_drho = RT * (2.0 * delta * f.x + delta * delta * f.xx);
+            const double dp_dt = density * R * delta * (f.x - tau * f.xy);
+            const double cv = -R * tau * tau * f.yy;
+
+            // (value, d/d(density), d/dT at constant density) of v, u, h, s
+            const std::array<std::array<double, 3>, 4> properties = {{
+                {1.0 / density, -1.0 / (density * density), 0.0},
+                {RT * tau * f.y, RT * delta * tau * f.xy / density, cv},
+                {RT * (tau * f.y + delta * f.x), RT * delta * (tau * f.xy + f.x + delta * f.xx) / density, cv + R * delta * (f.x - tau * f.xy)},
+                {R * (tau * f.y - f.value), R * delta * (tau * f.xy - f.x) / density, cv / temperature},
+            }};
+
+            ThermoGradient g{{p, temperature}, {1.0, 0.0}, {0.0, 1.0}};
+            double* value = &g.value.specific_volume;
+            double* d_dp = &g.d_dpressure.specific_volume;
+            double* d_dt = &g.d_dtemperature.specific_volume;
+            for (size_t k = 0; k < properties.size(); ++k)
+            {
+                const auto& [x, dx_drho, dx_dt] = properties[k];
+                value[k] = x;
+                d_dp[k] = dx_drho / dp_drho;
+                d_dt[k] = dx_dt - dx_drho * dp_dt / dp_drho;
+            }
+            return g;
+        }
+
+        // Region 3 pressure and its derivative in density, which is all the density search needs.
+        std::pair<double, double> region3_pressure(const double density, const double temperature)
+        {
+            const double delta = density / if97::CRITICAL_DENSITY;
+            std::array<Lanes<1>, 6> sums;
+            sum_terms_scalar<3>(REGION3, Lanes<1>{delta}, Lanes<1>{if97::CRITICAL_TEMPERATURE / temperature}, sums);
+            const double f_x = (sums[1][0] + REGION3_LOG) / delta;
+            const double f_xx = (sums[2][0] - REGION3_LOG) / (delta * delta);
+            const double RT = R * temperature;
+            return {density * RT * delta * f_x, RT * (2.0 * delta * f_x + delta * delta * f_xx)};
+        }
+
+        // Density of region 3 at (P, T): the liquid/supercritical root stepping down from the dense end, the vapor
+        // root stepping up from the dilute end, then safeguarded Newton inside the first step that brackets it.
+        std::optional<double> region3_density(const double pressure, const double temperature, const bool vapor)
+        {
+            const auto residual = [&](const double density)
+            {
+                const auto [p, dp_ddensity] = region3_pressure(density, temperature);
+                return std::pair{p - pressure, dp_ddensity};
+            };
+
+            const double step = vapor ? REGION3_DENSITY_STEP : -REGION3_DENSITY_STEP;
+            double previous = vapor ? REGION3_MIN_DENSITY : REGION3_MAX_DENSITY;
+            const double start = residual(previous).first;
+            for (double density = previous + step; density >= REGION3_MIN_DENSITY && density <= REGION3_MAX_DENSITY; density += step)
+            {
+                if ((residual(density).first > 0.0) != (start > 0.0)) return newton_bisect(residual, previous, density, NaN);
+                previous = density;
+            }
+            return std::nullopt;
+        }
+
+        double b23_pressure(const double temperature)
+        {
+            return (B23[0] + B23[1] * temperature + B23[2] * temperature * temperature) * MPa;
+        }
+
+        // Region 3 points below Psat(T) (only possible below 623.15 K < T < Tc) are vapor-like.
+        bool region3_vapor(const double pressure, const double temperature)
+        {
+            return temperature < if97::CRITICAL_TEMPERATURE && pressure < if97::saturation_pressure(temperature);
+        }
+
+        std::optional<ThermoGradient> region3_at(const double pressure, const double temperature)
+        {
+            const auto density = region3_density(pressure, temperature, region3_vapor(pressure, temperature));
+            if (!density) return std::nullopt;
+            return region3(*density, temperature);
+        }
+
+        template <size_t N>
+        double backward_sum(const Polynomial<N>& p, const double x, const double y)
+        {
+            std::array<Lanes<1>, 6> sums;
+            sum_terms_scalar<1>(p, Lanes<1>{x}, Lanes<1>{y}, sums);
+            return sums[0][0];
+        }
+
+        Phase phase_of(const Region region, const double pressure, const double temperature)
+        {
+            switch (region)
+            {
+                case Region::One: return Phase::Compressed;
+                case Region::Three: return region3_vapor(pressure, temperature) || temperature >= if97::CRITICAL_TEMPERATURE ? Phase::Superheated : Phase::Compressed;
+                case Region::Two:
+                case Region::Five: return Phase::Superheated;
+                default: return Phase::OutOfRange;
+            }
+        }
+
+        constexpr bool found(const PhaseState& state) { return state.phase != Phase::OutOfRange; }
+    } // namespace
+
+    namespace if97
+    {
+        Region region(const double pressure, const double temperature)
+        {
+            if (!(pressure > 0.0) || !(temperature >= MIN_TEMPERATURE)) return Region::OutOfRange;
+            if (temperature <= REGION1_MAX_TEMPERATURE)
+            {
+                if (pressure > MAX_PRESSURE) return Region::OutOfRange;
+                return pressure >= saturation_pressure(temperature) ? Region::One : Region::Two;
+            }
+            if (temperature <= REGION2_MAX_TEMPERATURE)
+            {
+                if (pressure > MAX_PRESSURE) return Region::OutOfRange;
+                return temperature <= B23_MAX_TEMPERATURE && pressure > b23_pressure(temperature) ? Region::Three : Region::Two;
+            }
+            if (temperature <= REGION5_MAX_TEMPERATURE && pressure <= REGION5_MAX_PRESSURE) return Region::Five;
+            return Region::OutOfRange;
+        }
+
+        double saturation_pressure(const double temperature)
+        {
+            if (!(temperature >= MIN_TEMPERATURE && temperature <= CRITICAL_TEMPERATURE)) return NaN;
+            const auto& n = REGION4;
+            const double theta = temperature + n[8] / (temperature - n[9]);
+            const double a = theta * theta + n[0] * theta + n[1];
+            const double b = n[2] * theta * theta + n[3] * theta + n[4];
+            const double c = n[5] * theta * theta + n[6] * theta + n[7];
+            const double root = 2.0 * c / (-b + std::sqrt(b * b - 4.0 * a * c));
+            return root * root * root * root * MPa;
+        }
+
+        double saturation_temperature(const double pressure)
+        {
+            if (!(pressure >= MIN_SATURATION_PRESSURE && pressure <= CRITICAL_PRESSURE)) return NaN;
+            const auto& n = REGION4;
+            const double beta = std::sqrt(std::sqrt(pressure / MPa));
+            const double e = beta * beta + n[2] * beta + n[5];
+            const double f = n[0] * beta * beta + n[3] * beta + n[6];
+            const double g = n[1] * beta * beta + n[4] * beta + n[7];
+            const double d = 2.0 * g / (-f - std::sqrt(f * f - 4.0 * e * g));
+            return std::min(0.5 * (n[9] + d - std::sqrt((n[9] + d) * (n[9] + d) - 4.0 * (n[8] + n[9] * d))), CRITICAL_TEMPERATURE);
+        }
+
+        std::optional<SaturationState> saturation_at_temperature(const double temperature)
+        {
+            const double pressure = saturation_pressure(temperature);
+            if (std::isnan(pressure)) return std::nullopt;
+            if (temperature <= REGION1_MAX_TEMPERATURE)
+                return SaturationState{at<region1<1>>(pressure, temperature).value, at<region2<1>>(pressure, temperature).value};
+
+            const auto liquid = region3_density(pressure, temperature, false);
+            const auto vapor = region3_density(pressure, temperature, true);
+            if (!liquid || !vapor) return std::nullopt;
+            SaturationState state{region3(*liquid, temperature).value, region3(*vapor, temperature).value};
+            state.liquid.pressure = state.vapor.pressure = pressure;
+            return state;
+        }
+
+        std::optional<SaturationState> saturation_at_pressure(const double pressure)
+        {
+            const double temperature = saturation_temperature(pressure);
+            if (std::isnan(temperature)) return std::nullopt;
+            auto state = saturation_at_temperature(temperature);
+            if (state) state->liquid.pressure = state->vapor.pressure = pressure;
+            return state;
+        }
+
+        std::optional<ThermoGradient> differentiate(const double pressure, const double temperature)
+        {
+            switch (region(pressure, temperature))
+            {
+                case Region::One: return at<region1<1>>(pressure, temperature);
+                case Region::Two: return at<region2<1>>(pressure, temperature);
+                case Region::Three: return region3_at(pressure, temperature);
+                case Region::Five: return at<region5<1>>(pressure, temperature);
+                default: return std::nullopt;
+            }
+        }
+
+        std::optional<ThermoState> state(const double pressure, const double temperature)
+        {
+            const auto gradient = differentiate(pressure, temperature);
+            if (!gradient) return std::nullopt;
+            return gradient->value;
+        }
+
+        void states(const std::span<const double> pressures, const std::span<const double> temperatures, const std::span<ThermoState> out, const std::span<Region> regions)
+        {
+            if (pressures.size() != temperatures.size() || out.size() != pressures.size() || regions.size() != pressures.size())
+                throw std::invalid_argument("Batched inputs and outputs must all have the same length...");
+
+            // Indices of the points in regions 1, 2 and 5, which are evaluated LANES at a time
+            std::array<std::vector<size_t>, 3> members;
+            for (size_t i = 0; i < pressures.size(); ++i)
+            {
+                regions[i] = region(pressures[i], temperatures[i]);
+                switch (regions[i])
+                {
+                    case Region::One: members[0].push_back(i); break;
+                    case Region::Two: members[1].push_back(i); break;
+                    case Region::Five: members[2].push_back(i); break;
+                    case Region::Three:
+                    {
+                        const auto gradient = region3_at(pressures[i], temperatures[i]);
+                        out[i] = gradient ? gradient->value : ThermoState{};
+                        if (!gradient) regions[i] = Region::OutOfRange;
+                        break;
+                    }
+                    default: out[i] = {};
+                }
+            }
+
+            constexpr std::array evaluators = {&region1<LANES>, &region2<LANES>, &region5<LANES>};
+            for (size_t r = 0; r < members.size(); ++r)
+            {
+                const auto& indices = members[r];
+                for (size_t begin = 0; begin < indices.size(); begin += LANES)
+                {
+                    // The last block is padded with copies of its first point
+                    const size_t count = std::min(LANES, indices.size() - begin);
+                    Lanes<LANES> pressure, temperature;
+                    for (size_t j = 0; j < LANES; ++j)
+                    {
+                        const size_t i = indices[begin + (j < count ? j : 0)];
+                        pressure[j] = pressures[i];
+                        temperature[j] = temperatures[i];
+                    }
+                    std::array<ThermoGradient, LANES> gradients;
+                    evaluators[r](pressure, temperature, gradients);
+                    for (size_t j = 0; j < count; ++j) out[indices[begin + j]] = gradients[j].value;
+                }
+            }
+        }
+
+        double backward_temperature(const Region region, const Property property, const double pressure, const double value)
+        {
+            const double pi = pressure / MPa;
+            if (region == Region::One)
+            {
+                if (property == Property::SpecificEnthalpy) return backward_sum(REGION1_PH, pi, value / (2500.0 * kJ) + 1.0);
+                if (property == Property::SpecificEntropy) return backward_sum(REGION1_PS, pi, value / kJ + 2.0);
+                return NaN;
+            }
+            if (region != Region::Two) return NaN;
+
+            if (property == Property::SpecificEnthalpy)
+            {
+                const double eta = value / (2000.0 * kJ);
+                if (pressure <= 4.0 * MPa) return backward_sum(REGION2A_PH, pi, eta - 2.1);
+                const auto& n = B2BC;
+                const double h_bc = (n[3] + std::sqrt((pi - n[4]) / n[2])) * kJ;
+                if (value >= h_bc) return backward_sum(REGION2B_PH, pi - 2.0, value / (2000.0 * kJ) - 2.6);
+                return backward_sum(REGION2C_PH, pi + 25.0, value / (2000.0 * kJ) - 1.8);
+            }
+            if (property == Property::SpecificEntropy)
+            {
+                if (pressure <= 4.0 * MPa) return backward_sum(REGION2A_PS, std::pow(pi, 0.25), value / (2.0 * kJ) - 2.0);
+                if (value >= 5.85 * kJ) return backward_sum(REGION2B_PS, pi, 10.0 - value / (0.7853 * kJ));
+                return backward_sum(REGION2C_PS, pi, 2.0 - value / (2.9251 * kJ));
+            }
+            return NaN;
+        }
+    } // namespace if97
+
+    IF97Engine::IF97Engine(const StateEngine& fallback) : fallback(fallback) {}
+
+    PhaseState IF97Engine::get_state(Property a, double a_value, Property b, double b_value, const PhaseState* hint) const
+    {
+        if (a == b || std::isnan(a_value) || std::isnan(b_value)) return {};
+        if (hint && !found(*hint)) hint = nullptr;
+
+        // Put the pressure (else the temperature) first, as in `StateEngine`
+        if (b == Property::Pressure || (b == Property::Temperature && a != Property::Pressure))
+        {
+            std::swap(a, b);
+            std::swap(a_value, b_value);
+        }
+
+        if (a == Property::Pressure && b == Property::Temperature) return from_pressure_temperature(a_value, b_value);
+        if (a == Property::Pressure || a == Property::Temperature) return solve_line(a, a_value, b, b_value, hint);
+        return this->fallback.get_state(a, a_value, b, b_value, hint);
+    }
+
+    void IF97Engine::get_state_batch(const Property a, const std::span<const double> a_values, const Property b, const std::span<const double> b_values, const std::span<PhaseState> out) const
+    {
+        if (a_values.size() != b_values.size() || out.size() != a_values.size())
+            throw std::invalid_argument("Batched inputs and output must all have the same length...");
+
+        constexpr size_t GRAIN = 256;
+        const bool pressure_temperature = (a == Property::Pressure && b == Property::Temperature) || (a == Property::Temperature && b == Property::Pressure);
+        core::ThreadPool::shared().parallel_for(out.size(), GRAIN, [&](const size_t begin, const size_t end, size_t)
+        {
+            if (!pressure_temperature)
+            {
+                for (size_t i = begin; i < end; ++i) out[i] = this->get_state(a, a_values[i], b, b_values[i], i > begin ? &out[i - 1] : nullptr);
+                return;
+            }
+
+            const auto pressures = (a == Property::Pressure ? a_values : b_values).subspan(begin, end - begin);
+            const auto temperatures = (a == Property::Pressure ? b_values : a_values).subspan(begin, end - begin);
+            std::vector<ThermoState> states(end - begin);
+            std::vector<Region> regions(end - begin);
+            if97::states(pressures, temperatures, states, regions);
+            for (size_t i = 0; i < states.size(); ++i)
+                out[begin + i] = {states[i], phase_of(regions[i], pressures[i], temperatures[i])};
+        });
+    }
+
+    PhaseState IF97Engine::from_pressure_temperature(const double pressure, const double temperature)
+    {
+        const Region region = if97::region(pressure, temperature);
+        const auto state = if97::state(pressure, temperature);
+        if (!state) return {};
+        return {*state, phase_of(region, pressure, temperature)};
+    }
+
+    PhaseState IF97Engine::solve_line(const Property fixed, const double fixed_value, const Property other, const double value, const PhaseState* hint)
+    {
+        const bool isobar = fixed == Property::Pressure;
+        const auto dome = isobar ? if97::saturation_at_pressure(fixed_value) : if97::saturation_at_temperature(fixed_value);
+        if (dome)
+        {
+            const double liquid = get(dome->liquid, other);
+            const double vapor = get(dome->vapor, other);
+            const double quality = (value - liquid) / (vapor - liquid);
+            if (vapor != liquid && quality >= 0.0 && quality <= 1.0) return {dome->mixture(quality), Phase::Saturated, quality};
+        }
+
+        // The line on either side of the saturation line (liquid first), or all of it past the critical point
+        double min, max, saturated;
+        if (isobar)
+        {
+            min = MIN_TEMPERATURE;
+            max = fixed_value <= REGION5_MAX_PRESSURE ? REGION5_MAX_TEMPERATURE : REGION2_MAX_TEMPERATURE;
+            saturated = dome ? dome->liquid.temperature : NaN;
+        }
+        else
+        {
+            min = MIN_PRESSURE;
+            max = fixed_value <= REGION2_MAX_TEMPERATURE ? MAX_PRESSURE : REGION5_MAX_PRESSURE;
+            saturated = dome ? dome->liquid.pressure : NaN;
+        }
+        struct Segment
+        {
+            double lo;
+            double hi;
+            Region backward;  // region whose backward equation seeds the search
+        };
+        std::vector<Segment> segments;
+        if (std::isnan(saturated)) segments.push_back({min, max, Region::OutOfRange});
+        else if (isobar)
+        {
+            segments.push_back({min, saturated, Region::One});
+            segments.push_back({saturated * (1.0 + SATURATION_OFFSET), max, Region::Two});
+        }
+        else
+        {
+            segments.push_back({saturated, max, Region::OutOfRange});
+            segments.push_back({min, saturated * (1.0 - SATURATION_OFFSET), Region::OutOfRange});
+        }
+
+        const auto residual = [&](const double x) -> std::pair<double, double>
+        {
+            const auto gradient = isobar ? if97::differentiate(fixed_value, x) : if97::differentiate(x, fixed_value);
+            if (!gradient) return {NaN, NaN};
+            return {get(gradient->value, other) - value, get(isobar ? gradient->d_dtemperature : gradient->d_dpressure, other)};
+        };
+
+        for (const auto& [lo, hi, backward] : segments)
+        {
+            double guess = hint ? (isobar ? hint->state.temperature : hint->state.pressure) : NaN;
+            if (isobar && backward != Region::OutOfRange)
+                if (const double t = if97::backward_temperature(backward, other, fixed_value, value); !std::isnan(t)) guess = t;
+            if (const auto root = newton_bisect(residual, lo, hi, guess))
+                if (auto state = isobar ? from_pressure_temperature(fixed_value, *root) : from_pressure_temperature(*root, fixed_value); found(state)) return state;
+        }
+        return {};
+    }
+} // namespace logngine::thermo
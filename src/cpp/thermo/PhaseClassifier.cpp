@@ -0,0 +1,26 @@
+#include <logngine/thermo/PhaseClassifier.h>
+
+namespace logngine::thermo
+{
+    PhaseClassifier::PhaseClassifier(const RectilinearTable& compressed, const SaturationCurve& saturation, const RectilinearTable& superheated)
+        : compressed(compressed), saturation(saturation), superheated(superheated),
+          critical_temperature(saturation.temperature_range().second) {}
+
+    Phase PhaseClassifier::classify(const double pressure, const double temperature) const
+    {
+        if (const auto boiling = this->saturation.saturation_temperature(pressure))
+        {
+            if (temperature > *boiling) return this->superheated.covers(pressure, temperature) ? Phase::Superheated : Phase::OutOfRange;
+            if (temperature < *boiling) return this->compressed.covers(pressure, temperature) ? Phase::Compressed : Phase::OutOfRange;
+            return Phase::OutOfRange;
+        }
+
+        // No dome at this pressure; the tables may overlap here, so prefer the one on the matching side of Tc
+        const bool hot = temperature >= this->critical_temperature;
+        const RectilinearTable& first = hot ? this->superheated : this->compressed;
+        const RectilinearTable& second = hot ? this->compressed : this->superheated;
+        if (first.covers(pressure, temperature)) return hot ? Phase::Superheated : Phase::Compressed;
+        if (second.covers(pressure, temperature)) return hot ? Phase::Compressed : Phase::Superheated;
+        return Phase::OutOfRange;
+    }
+} // namespace logngine::thermo
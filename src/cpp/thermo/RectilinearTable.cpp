@@ -0,0 +1,483 @@
+#include <logngine/thermo/RectilinearTable.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace logngine::thermo
+{
+    namespace
+    {
+        // The last cell a thread used in each of the few tables it used most recently. Rows are cached per block
+        // parity, since the two blocks around a pressure are always one of each.
+        struct Cursor
+        {
+            const RectilinearTable* table = nullptr;
+            size_t block = 0;
+            size_t rows[2] = {};
+        };
+
+        constexpr size_t CURSORS = 4;
+        constexpr size_t WALK = 1;  // neighbouring cells tried before falling back to binary search
+
+        struct LookupCache
+        {
+            Cursor cursors[CURSORS];
+            size_t next = 0;
+            LookupStats stats;
+        };
+
+        thread_local LookupCache cache;
+
+        Cursor& cursor_of(const RectilinearTable* table)
+        {
+            for (Cursor& cursor : cache.cursors)
+                if (cursor.table == table) return cursor;
+            Cursor& cursor = cache.cursors[cache.next++ % CURSORS];
+            cursor = {table};
+            return cursor;
+        }
+
+        // `std::lower_bound(values, x)` as an index, trying `hint` and then up to WALK steps from it towards `x` first.
+        // Cached indices may belong to a destroyed table at the same address, so they are only trusted once checked.
+        size_t lower_bound_from(const std::span<const double> values, const double x, size_t& hint)
+        {
+            size_t i = std::min(hint, values.size());
+            for (size_t step = 0; step <= WALK; ++step)
+            {
+                const bool above = i == values.size() || values[i] >= x;
+                const bool below = i == 0 || values[i - 1] < x;
+                if (above && below)
+                {
+                    ++cache.stats.hits;
+                    return hint = i;
+                }
+                if (above) --i;
+                else ++i;
+            }
+            ++cache.stats.misses;
+            return hint = static_cast<size_t>(std::lower_bound(values.begin(), values.end(), x) - values.begin());
+        }
+
+        // Drops rows at a non-finite (pressure, temperature), sorts the rest by pressure then temperature, and keeps
+        // only the first of several rows at the same point.
+        template <typename Row, typename State>
+        void sort_unique(std::vector<Row>& rows, State state)
+        {
+            std::erase_if(rows, [&](const Row& row) { return !std::isfinite(state(row).pressure) || !std::isfinite(state(row).temperature); });
+            std::stable_sort(rows.begin(), rows.end(), [&](const Row& a, const Row& b)
+            {
+                return state(a).pressure < state(b).pressure || (state(a).pressure == state(b).pressure && state(a).temperature < state(b).temperature);
+            });
+            rows.erase(std::unique(rows.begin(), rows.end(), [&](const Row& a, const Row& b)
+            {
+                return state(a).pressure == state(b).pressure && state(a).temperature == state(b).temperature;
+            }), rows.end());
+        }
+
+        // Cubic Hermite basis (h00, h10, h01, h11) on the unit interval, and its derivative.
+        std::array<double, 4> hermite_basis(const double t)
+        {
+            const double t2 = t * t;
+            const double t3 = t2 * t;
+            return {2.0 * t3 - 3.0 * t2 + 1.0, t3 - 2.0 * t2 + t, -2.0 * t3 + 3.0 * t2, t3 - t2};
+        }
+
+        std::array<double, 4> hermite_basis_derivative(const double t)
+        {
+            const double t2 = t * t;
+            return {6.0 * t2 - 6.0 * t, 3.0 * t2 - 4.0 * t + 1.0, -6.0 * t2 + 6.0 * t, 3.0 * t2 - 2.0 * t};
+        }
+
+        // w[0] * a + w[1] * b + w[2] * c + w[3] * d in every property but the pressure and temperature, which the
+        // callers set themselves.
+        ThermoState combine(const std::array<double, 4>& w, const ThermoState& a, const ThermoState& b, const ThermoState& c, const ThermoState& d)
+        {
+            return {
+                0.0,
+                0.0,
+                w[0] * a.specific_volume + w[1] * b.specific_volume + w[2] * c.specific_volume + w[3] * d.specific_volume,
+                w[0] * a.specific_internal_energy + w[1] * b.specific_internal_energy + w[2] * c.specific_internal_energy + w[3] * d.specific_internal_energy,
+                w[0] * a.specific_enthalpy + w[1] * b.specific_enthalpy + w[2] * c.specific_enthalpy + w[3] * d.specific_enthalpy,
+                w[0] * a.specific_entropy + w[1] * b.specific_entropy + w[2] * c.specific_entropy + w[3] * d.specific_entropy,
+            };
+        }
+
+        // The sigma of the row of `uncertain` at each of `rows`' (pressure, temperature), NaN where there is none.
+        std::vector<ThermoState> match_sigmas(const std::vector<ThermoState>& rows, std::vector<UncertainState> uncertain)
+        {
+            constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+            sort_unique(uncertain, [](const UncertainState& row) -> const ThermoState& { return row.value; });
+
+            std::vector<ThermoState> sigmas;
+            sigmas.reserve(rows.size());
+            for (const ThermoState& row : rows)
+            {
+                const auto it = std::lower_bound(uncertain.begin(), uncertain.end(), row, [](const UncertainState& a, const ThermoState& b)
+                {
+                    return a.value.pressure < b.pressure || (a.value.pressure == b.pressure && a.value.temperature < b.temperature);
+                });
+                const bool found = it != uncertain.end() && it->value.pressure == row.pressure && it->value.temperature == row.temperature;
+                sigmas.push_back(found ? it->sigma : ThermoState{0.0, 0.0, NaN, NaN, NaN, NaN});
+            }
+            return sigmas;
+        }
+    } // namespace
+
+    RectilinearTable::RectilinearTable(std::vector<ThermoState> rows)
+    {
+        sort_unique(rows, [](const ThermoState& row) -> const ThermoState& { return row; });
+        this->index(std::move(rows));
+    }
+
+    RectilinearTable::RectilinearTable(std::vector<UncertainState> rows)
+    {
+        sort_unique(rows, [](const UncertainState& row) -> const ThermoState& { return row.value; });
+
+        std::vector<ThermoState> values;
+        values.reserve(rows.size());
+        this->sigmas.reserve(rows.size());
+        for (const auto& [value, sigma] : rows)
+        {
+            values.push_back(value);
+            this->sigmas.push_back(sigma);
+        }
+        this->index(std::move(values));
+    }
+
+    RectilinearTable::RectilinearTable(std::vector<ThermoGradient> knots, std::vector<UncertainState> uncertainties)
+    {
+        sort_unique(knots, [](const ThermoGradient& knot) -> const ThermoState& { return knot.value; });
+
+        std::vector<ThermoState> values;
+        values.reserve(knots.size());
+        this->temperature_slopes.reserve(knots.size());
+        this->pressure_slopes.reserve(knots.size());
+        for (const auto& [value, d_dpressure, d_dtemperature] : knots)
+        {
+            values.push_back(value);
+            this->temperature_slopes.push_back(d_dtemperature);
+            this->pressure_slopes.push_back(d_dpressure);
+        }
+        this->index(std::move(values));
+        if (!uncertainties.empty()) this->sigmas = match_sigmas(this->rows, std::move(uncertainties));
+    }
+
+    void RectilinearTable::index(std::vector<ThermoState> sorted_rows)
+    {
+        this->temperatures.reserve(sorted_rows.size());
+        for (size_t i = 0; i < sorted_rows.size(); ++i)
+        {
+            if (i == 0 || sorted_rows[i].pressure != sorted_rows[i - 1].pressure)
+            {
+                this->block_pressures.push_back(sorted_rows[i].pressure);
+                this->block_offsets.push_back(i);
+            }
+            this->temperatures.push_back(sorted_rows[i].temperature);
+        }
+        this->block_offsets.push_back(sorted_rows.size());
+        this->rows = std::move(sorted_rows);
+    }
+
+    template <bool Uncertainty>
+    std::optional<std::conditional_t<Uncertainty, UncertainState, ThermoState>> RectilinearTable::interpolate(const double pressure, const double temperature) const
+    {
+        if constexpr (Uncertainty)
+        {
+            constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+            const auto value = this->interpolate_value(pressure, temperature);
+            if (!value) return std::nullopt;
+            if (!this->uncertain()) return UncertainState{*value, {0.0, 0.0, NaN, NaN, NaN, NaN}};
+
+            ThermoState variance;
+            const auto [rows, weights] = *this->corners(pressure, temperature);
+            for (size_t k = 0; k < rows.size(); ++k)
+            {
+                const double w2 = weights[k] * weights[k];
+                if (w2 == 0.0) continue;  // unused slot, or a corner the point does not depend on
+                const ThermoState& sigma = this->sigmas[rows[k]];
+                variance.specific_volume += w2 * sigma.specific_volume * sigma.specific_volume;
+                variance.specific_internal_energy += w2 * sigma.specific_internal_energy * sigma.specific_internal_energy;
+                variance.specific_enthalpy += w2 * sigma.specific_enthalpy * sigma.specific_enthalpy;
+                variance.specific_entropy += w2 * sigma.specific_entropy * sigma.specific_entropy;
+            }
+            return UncertainState{*value, {
+                0.0,
+                0.0,
+                std::sqrt(variance.specific_volume),
+                std::sqrt(variance.specific_internal_energy),
+                std::sqrt(variance.specific_enthalpy),
+                std::sqrt(variance.specific_entropy),
+            }};
+        }
+        else return this->interpolate_value(pressure, temperature);
+    }
+
+    template std::optional<ThermoState> RectilinearTable::interpolate<false>(double, double) const;
+    template std::optional<UncertainState> RectilinearTable::interpolate<true>(double, double) const;
+
+    std::optional<ThermoState> RectilinearTable::interpolate_value(const double pressure, const double temperature) const
+    {
+        if (this->cubic())
+        {
+            if (!this->covers(pressure, temperature)) return std::nullopt;
+            return this->hermite(pressure, temperature, false).value;
+        }
+        if (this->empty() || !(pressure >= this->block_pressures.front() && pressure <= this->block_pressures.back()))
+            return std::nullopt;
+
+        const size_t block = this->find_block(pressure);
+        if (this->block_pressures[block] == pressure) return this->interpolate_block(block, temperature);
+
+        const auto low = this->interpolate_block(block - 1, temperature);
+        if (!low) return std::nullopt;
+        const auto high = this->interpolate_block(block, temperature);
+        if (!high) return std::nullopt;
+
+        const double p0 = this->block_pressures[block - 1];
+        const double p1 = this->block_pressures[block];
+        ThermoState state = lerp(*low, *high, (pressure - p0) / (p1 - p0));
+        state.pressure = pressure;
+        return state;
+    }
+
+    std::optional<ThermoGradient> RectilinearTable::differentiate(const double pressure, const double temperature) const
+    {
+        if (!this->covers(pressure, temperature)) return std::nullopt;
+        if (this->cubic()) return this->hermite(pressure, temperature, true);
+
+        size_t high = this->find_block(pressure);
+        size_t low = high - (this->block_pressures[high] == pressure ? 0 : 1);
+        if (low == high)  // on a block; borrow a neighbour for the pressure derivative
+        {
+            if (high + 1 < this->block_pressures.size() && this->block_covers(high + 1, temperature)) ++high;
+            else if (low > 0 && this->block_covers(low - 1, temperature)) --low;
+        }
+
+        const auto [low_value, low_slope] = this->differentiate_block(low, temperature);
+        if (low == high) return ThermoGradient{low_value, {}, low_slope};
+        const auto [high_value, high_slope] = this->differentiate_block(high, temperature);
+
+        const double p0 = this->block_pressures[low];
+        const double p1 = this->block_pressures[high];
+        const double u = (pressure - p0) / (p1 - p0);
+        ThermoGradient gradient{lerp(low_value, high_value, u), secant(low_value, high_value, p1 - p0), lerp(low_slope, high_slope, u)};
+        gradient.value.pressure = pressure;
+        return gradient;
+    }
+
+    bool RectilinearTable::covers(const double pressure, const double temperature) const
+    {
+        if (this->empty() || !(pressure >= this->block_pressures.front() && pressure <= this->block_pressures.back()))
+            return false;
+
+        const size_t block = this->find_block(pressure);
+        if (this->block_pressures[block] == pressure) return this->block_covers(block, temperature);
+        return this->block_covers(block - 1, temperature) && this->block_covers(block, temperature);
+    }
+
+    bool RectilinearTable::block_covers(const size_t block, const double temperature) const
+    {
+        return temperature >= this->temperatures[this->block_offsets[block]] && temperature <= this->temperatures[this->block_offsets[block + 1] - 1];
+    }
+
+    std::optional<std::pair<double, double>> RectilinearTable::temperature_range(const double pressure) const
+    {
+        if (this->empty() || !(pressure >= this->block_pressures.front() && pressure <= this->block_pressures.back()))
+            return std::nullopt;
+
+        const size_t high = this->find_block(pressure);
+        const size_t low = high - (this->block_pressures[high] == pressure ? 0 : 1);
+
+        const double min = std::max(this->temperatures[this->block_offsets[low]], this->temperatures[this->block_offsets[high]]);
+        const double max = std::min(this->temperatures[this->block_offsets[low + 1] - 1], this->temperatures[this->block_offsets[high + 1] - 1]);
+        if (min > max) return std::nullopt;
+        return std::pair{min, max};
+    }
+
+    std::vector<double> RectilinearTable::breakpoints(const double pressure) const
+    {
+        if (this->empty() || !(pressure >= this->block_pressures.front() && pressure <= this->block_pressures.back()))
+            return {};
+
+        const size_t high = this->find_block(pressure);
+        const size_t low = high - (this->block_pressures[high] == pressure ? 0 : 1);
+
+        const auto block = [&](const size_t b)
+        {
+            return std::span(this->temperatures).subspan(this->block_offsets[b], this->block_offsets[b + 1] - this->block_offsets[b]);
+        };
+        std::vector<double> temperatures;
+        temperatures.reserve(this->block_offsets[high + 1] - this->block_offsets[low]);
+        std::ranges::set_union(block(low), block(high), std::back_inserter(temperatures));
+        temperatures.erase(std::unique(temperatures.begin(), temperatures.end()), temperatures.end());
+        return temperatures;
+    }
+
+    std::optional<std::pair<std::array<size_t, 4>, std::array<double, 4>>> RectilinearTable::corners(const double pressure, const double temperature) const
+    {
+        if (!this->covers(pressure, temperature)) return std::nullopt;
+
+        const size_t high = this->find_block(pressure);
+        const size_t low = high - (this->block_pressures[high] == pressure ? 0 : 1);
+        // Weights of the two ends of an interval at fraction `t` along it
+        const auto ends = [&](const double t)
+        {
+            if (!this->cubic()) return std::pair{1.0 - t, t};
+            const auto [b00, b10, b01, b11] = hermite_basis(t);
+            return std::pair{b00, b01};
+        };
+
+        std::array<size_t, 4> rows{};
+        std::array<double, 4> weights{};
+        const auto along = [&](const size_t block, const double weight, const size_t slot)
+        {
+            const size_t first = this->block_offsets[block];
+            const size_t last = this->block_offsets[block + 1];
+            if (last - first < 2)
+            {
+                rows[slot] = first;
+                weights[slot] = weight;
+                return;
+            }
+            const size_t row = std::clamp(this->find_row(block, temperature), first + 1, last - 1);
+            const double t0 = this->temperatures[row - 1];
+            const auto [w0, w1] = ends((temperature - t0) / (this->temperatures[row] - t0));
+            rows[slot] = row - 1;
+            rows[slot + 1] = row;
+            weights[slot] = weight * w0;
+            weights[slot + 1] = weight * w1;
+        };
+
+        if (low == high) along(low, 1.0, 0);
+        else
+        {
+            const double p0 = this->block_pressures[low];
+            const auto [w_low, w_high] = ends((pressure - p0) / (this->block_pressures[high] - p0));
+            along(low, w_low, 0);
+            along(high, w_high, 2);
+        }
+        return std::pair{rows, weights};
+    }
+
+    std::pair<ThermoState, ThermoState> RectilinearTable::differentiate_block(const size_t block, const double temperature) const
+    {
+        const size_t first = this->block_offsets[block];
+        const size_t last = this->block_offsets[block + 1];
+        if (last - first < 2) return {this->rows[first], {}};
+
+        size_t row = this->find_row(block, temperature);
+        if (row < last && this->temperatures[row] == temperature) ++row;  // the interval to the right of a row
+        row = std::clamp(row, first + 1, last - 1);
+
+        const double t0 = this->temperatures[row - 1];
+        const double t1 = this->temperatures[row];
+        ThermoState value = lerp(this->rows[row - 1], this->rows[row], (temperature - t0) / (t1 - t0));
+        value.temperature = temperature;
+        return {value, secant(this->rows[row - 1], this->rows[row], t1 - t0)};
+    }
+
+    ThermoGradient RectilinearTable::hermite(const double pressure, const double temperature, const bool derivatives) const
+    {
+        const size_t high = this->find_block(pressure);
+        const size_t low = high - (this->block_pressures[high] == pressure ? 0 : 1);
+
+        ThermoGradient gradient;
+        const auto below = this->hermite_block(low, temperature, derivatives);
+        if (low == high) gradient = {below[0], below[2], below[1]};
+        else
+        {
+            const auto above = this->hermite_block(high, temperature, derivatives);
+            const double p0 = this->block_pressures[low];
+            const double h = this->block_pressures[high] - p0;
+            const double u = (pressure - p0) / h;
+
+            const auto [b00, b10, b01, b11] = hermite_basis(u);
+            gradient.value = combine({b00, b10 * h, b01, b11 * h}, below[0], below[2], above[0], above[2]);
+            if (derivatives)
+            {
+                const auto [d00, d10, d01, d11] = hermite_basis_derivative(u);
+                gradient.d_dpressure = combine({d00 / h, d10, d01 / h, d11}, below[0], below[2], above[0], above[2]);
+                gradient.d_dtemperature = combine({b00, b10 * h, b01, b11 * h}, below[1], below[3], above[1], above[3]);
+            }
+        }
+        gradient.value.pressure = pressure;
+        gradient.value.temperature = temperature;
+        if (derivatives)
+        {
+            gradient.d_dpressure.pressure = 1.0;
+            gradient.d_dpressure.temperature = 0.0;
+            gradient.d_dtemperature.pressure = 0.0;
+            gradient.d_dtemperature.temperature = 1.0;
+        }
+        return gradient;
+    }
+
+    std::array<ThermoState, 4> RectilinearTable::hermite_block(const size_t block, const double temperature, const bool derivatives) const
+    {
+        const size_t first = this->block_offsets[block];
+        const size_t last = this->block_offsets[block + 1];
+        if (last - first < 2) return {this->rows[first], {}, this->pressure_slopes[first], {}};
+
+        const size_t row = std::clamp(this->find_row(block, temperature), first + 1, last - 1);
+        const double t0 = this->temperatures[row - 1];
+        const double h = this->temperatures[row] - t0;
+        const double t = (temperature - t0) / h;
+
+        const ThermoState& y0 = this->rows[row - 1];
+        const ThermoState& y1 = this->rows[row];
+        const ThermoState& m0 = this->temperature_slopes[row - 1];
+        const ThermoState& m1 = this->temperature_slopes[row];
+        const ThermoState& s0 = this->pressure_slopes[row - 1];
+        const ThermoState& s1 = this->pressure_slopes[row];
+
+        const auto [b00, b10, b01, b11] = hermite_basis(t);
+        const ThermoState value = combine({b00, b10 * h, b01, b11 * h}, y0, m0, y1, m1);
+        const ThermoState slope = lerp(s0, s1, t);  // of the pressure slopes, only the knots' are fitted
+        if (!derivatives) return {value, {}, slope, {}};
+
+        const auto [d00, d10, d01, d11] = hermite_basis_derivative(t);
+        return {value, combine({d00 / h, d10, d01 / h, d11}, y0, m0, y1, m1), slope, secant(s0, s1, h)};
+    }
+
+    std::optional<ThermoState> RectilinearTable::interpolate_block(const size_t block, const double temperature) const
+    {
+        if (!this->block_covers(block, temperature)) return std::nullopt;
+
+        const size_t row = this->find_row(block, temperature);
+        if (this->temperatures[row] == temperature) return this->rows[row];
+
+        const double t0 = this->temperatures[row - 1];
+        const double t1 = this->temperatures[row];
+        ThermoState state = lerp(this->rows[row - 1], this->rows[row], (temperature - t0) / (t1 - t0));
+        state.temperature = temperature;
+        return state;
+    }
+
+    size_t RectilinearTable::find_block(const double pressure) const
+    {
+        return lower_bound_from(this->block_pressures, pressure, cursor_of(this).block);
+    }
+
+    size_t RectilinearTable::find_row(const size_t block, const double temperature) const
+    {
+        const size_t first = this->block_offsets[block];
+        const auto column = std::span(this->temperatures).subspan(first, this->block_offsets[block + 1] - first);
+
+        size_t& cached = cursor_of(this).rows[block % 2];
+        size_t hint = cached >= first ? cached - first : 0;
+        const size_t row = first + lower_bound_from(column, temperature, hint);
+        cached = row;
+        return row;
+    }
+
+    LookupStats RectilinearTable::lookup_stats()
+    {
+        return cache.stats;
+    }
+
+    void RectilinearTable::reset_lookup_stats()
+    {
+        cache.stats = {};
+    }
+} // namespace logngine::thermo
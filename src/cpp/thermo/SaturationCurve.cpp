@@ -0,0 +1,183 @@
+#include <logngine/thermo/SaturationCurve.h>
+#include <algorithm>
+#include <cmath>
+
+namespace logngine::thermo
+{
+    namespace
+    {
+        constexpr size_t PRESSURE = 0;
+        constexpr size_t TEMPERATURE = 1;
+
+        // Rows from different sources only agree to their printed precision (e.g. 1228.094 vs. 1228.1 Pa at 283.15 K),
+        // so the spline through two nearly coincident ones would follow rounding noise. Rows this close (relative to
+        // the axis value) are averaged into one knot instead.
+        constexpr double SAME_ABSCISSA = 1e-3;
+    }
+
+    SaturationCurve::SaturationCurve(const std::span<const SaturationState> rows)
+    {
+        std::vector<Row> packed;
+        packed.reserve(rows.size());
+        for (const auto& [liquid, vapor] : rows)
+        {
+            packed.push_back({
+                liquid.pressure, liquid.temperature,
+                liquid.specific_volume, liquid.specific_internal_energy, liquid.specific_enthalpy, liquid.specific_entropy,
+                vapor.specific_volume, vapor.specific_internal_energy, vapor.specific_enthalpy, vapor.specific_entropy,
+            });
+        }
+        std::erase_if(packed, [](const Row& row) { return !std::all_of(row.begin(), row.end(), [](const double v) { return std::isfinite(v); }); });
+
+        this->by_temperature = make_axis(packed, TEMPERATURE);
+        this->by_pressure = make_axis(std::move(packed), PRESSURE);
+    }
+
+    SaturationCurve::Axis SaturationCurve::make_axis(std::vector<Row> rows, const size_t column)
+    {
+        std::stable_sort(rows.begin(), rows.end(), [column](const Row& a, const Row& b) { return a[column] < b[column]; });
+
+        size_t kept = 0;
+        for (size_t first = 0; first < rows.size();)
+        {
+            size_t last = first + 1;
+            while (last < rows.size() && rows[last][column] - rows[first][column] <= SAME_ABSCISSA * std::abs(rows[first][column])) ++last;
+
+            Row knot{};
+            for (size_t i = first; i < last; ++i)
+                for (size_t c = 0; c < knot.size(); ++c) knot[c] += rows[i][c] / static_cast<double>(last - first);
+            rows[kept++] = knot;
+            first = last;
+        }
+        rows.resize(kept);
+
+        Axis axis;
+        axis.x.reserve(rows.size());
+        for (const auto& row : rows) axis.x.push_back(row[column]);
+        axis.slopes.resize(rows.size(), Row{});
+
+        // PCHIP slopes (Fritsch & Butland's weighted harmonic mean of the neighbouring secants; zero at local extrema),
+        // which keep every monotone stretch of the data monotone, with one-sided secants at the ends
+        const size_t n = rows.size();
+        for (size_t c = 0; c < std::tuple_size_v<Row> && n >= 2; ++c)
+        {
+            const auto secant = [&](const size_t k) { return (rows[k + 1][c] - rows[k][c]) / (axis.x[k + 1] - axis.x[k]); };
+
+            axis.slopes.front()[c] = secant(0);
+            axis.slopes.back()[c] = secant(n - 2);
+            for (size_t k = 1; k + 1 < n; ++k)
+            {
+                const double d0 = secant(k - 1);
+                const double d1 = secant(k);
+                if (d0 * d1 <= 0.0) continue;
+
+                const double h0 = axis.x[k] - axis.x[k - 1];
+                const double h1 = axis.x[k + 1] - axis.x[k];
+                const double w0 = 2.0 * h1 + h0;
+                const double w1 = h1 + 2.0 * h0;
+                axis.slopes[k][c] = (w0 + w1) / (w0 / d0 + w1 / d1);
+            }
+        }
+
+        axis.values = std::move(rows);
+        return axis;
+    }
+
+    std::optional<SaturationCurve::Knot> SaturationCurve::locate(const Axis& axis, const double x)
+    {
+        if (axis.x.empty() || !(x >= axis.x.front() && x <= axis.x.back())) return std::nullopt;
+
+        const auto upper = std::lower_bound(axis.x.begin(), axis.x.end(), x);
+        const auto k = static_cast<size_t>(upper - axis.x.begin());
+        if (*upper == x) return Knot{k};
+
+        const double h = axis.x[k] - axis.x[k - 1];
+        return Knot{k - 1, (x - axis.x[k - 1]) / h, h};
+    }
+
+    namespace
+    {
+        // Cubic Hermite basis on an interval of width `h`, weighting the start value, start slope, end value and end
+        // slope in that order.
+        std::array<double, 4> hermite_basis(const double t, const double h)
+        {
+            const double t2 = t * t;
+            const double t3 = t2 * t;
+            return {2.0 * t3 - 3.0 * t2 + 1.0, (t3 - 2.0 * t2 + t) * h, -2.0 * t3 + 3.0 * t2, (t3 - t2) * h};
+        }
+    }
+
+    double SaturationCurve::evaluate(const Axis& axis, const Knot& knot, const size_t column)
+    {
+        if (knot.t == 0.0) return axis.values[knot.i][column];
+
+        const auto [h00, h10, h01, h11] = hermite_basis(knot.t, knot.h);
+        return h00 * axis.values[knot.i][column] + h10 * axis.slopes[knot.i][column]
+            + h01 * axis.values[knot.i + 1][column] + h11 * axis.slopes[knot.i + 1][column];
+    }
+
+    SaturationState SaturationCurve::evaluate(const Axis& axis, const Knot& knot)
+    {
+        Row row = axis.values[knot.i];
+        if (knot.t != 0.0)
+        {
+            const auto [h00, h10, h01, h11] = hermite_basis(knot.t, knot.h);
+            const Row& y0 = axis.values[knot.i];
+            const Row& y1 = axis.values[knot.i + 1];
+            const Row& m0 = axis.slopes[knot.i];
+            const Row& m1 = axis.slopes[knot.i + 1];
+            for (size_t c = 0; c < row.size(); ++c) row[c] = h00 * y0[c] + h10 * m0[c] + h01 * y1[c] + h11 * m1[c];
+        }
+
+        return {
+            {row[0], row[1], row[2], row[3], row[4], row[5]},
+            {row[0], row[1], row[6], row[7], row[8], row[9]},
+        };
+    }
+
+    std::optional<SaturationState> SaturationCurve::at_temperature(const double temperature) const
+    {
+        const auto knot = locate(this->by_temperature, temperature);
+        if (!knot) return std::nullopt;
+
+        auto state = evaluate(this->by_temperature, *knot);
+        state.liquid.temperature = state.vapor.temperature = temperature;
+        return state;
+    }
+
+    std::optional<SaturationState> SaturationCurve::at_pressure(const double pressure) const
+    {
+        const auto knot = locate(this->by_pressure, pressure);
+        if (!knot) return std::nullopt;
+
+        auto state = evaluate(this->by_pressure, *knot);
+        state.liquid.pressure = state.vapor.pressure = pressure;
+        return state;
+    }
+
+    std::optional<double> SaturationCurve::saturation_temperature(const double pressure) const
+    {
+        const auto knot = locate(this->by_pressure, pressure);
+        if (!knot) return std::nullopt;
+        return evaluate(this->by_pressure, *knot, TEMPERATURE);
+    }
+
+    std::optional<double> SaturationCurve::saturation_pressure(const double temperature) const
+    {
+        const auto knot = locate(this->by_temperature, temperature);
+        if (!knot) return std::nullopt;
+        return evaluate(this->by_temperature, *knot, PRESSURE);
+    }
+
+    std::pair<double, double> SaturationCurve::temperature_range() const
+    {
+        if (this->empty()) return {0.0, 0.0};
+        return {this->by_temperature.x.front(), this->by_temperature.x.back()};
+    }
+
+    std::pair<double, double> SaturationCurve::pressure_range() const
+    {
+        if (this->empty()) return {0.0, 0.0};
+        return {this->by_pressure.x.front(), this->by_pressure.x.back()};
+    }
+} // namespace logngine::thermo
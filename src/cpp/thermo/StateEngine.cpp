@@ -0,0 +1,328 @@
+#include <logngine/thermo/StateEngine.h>
+#include <logngine/thermo/RootFinding.h>
+#include <logngine/core/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <stdexcept>
+
+namespace logngine::thermo
+{
+    namespace
+    {
+        constexpr size_t MAX_ITERATIONS = 100;
+        constexpr double TOLERANCE = 1e-10;  // relative, in the solved variable or the normalized residual
+        constexpr size_t DOME_SAMPLES = 32;
+        constexpr size_t SEEDS = 8;
+
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        std::array<double, 6> property_spans(const RectilinearTable& table)
+        {
+            std::array<double, 6> spans{};
+            for (size_t p = 0; p < spans.size(); ++p)
+            {
+                double min = std::numeric_limits<double>::infinity();
+                double max = -min;
+                for (const ThermoState& state : table.states())
+                {
+                    min = std::min(min, get(state, static_cast<Property>(p)));
+                    max = std::max(max, get(state, static_cast<Property>(p)));
+                }
+                spans[p] = max > min ? max - min : 1.0;
+            }
+            return spans;
+        }
+
+        constexpr bool found(const PhaseState& state) { return state.phase != Phase::OutOfRange; }
+    } // namespace
+
+    StateEngine::StateEngine(const RectilinearTable& compressed, const SaturationCurve& saturation, const RectilinearTable& superheated)
+        : compressed(compressed), saturation(saturation), superheated(superheated), classifier(compressed, saturation, superheated),
+          compressed_spans(property_spans(compressed)), superheated_spans(property_spans(superheated)) {}
+
+    PhaseState StateEngine::get_state(Property a, double a_value, Property b, double b_value, const PhaseState* hint) const
+    {
+        if (a == b || std::isnan(a_value) || std::isnan(b_value)) return {};
+        if (hint && !found(*hint)) hint = nullptr;
+
+        // Put the pressure (else the temperature) first; the rest only depends on the unordered pair
+        if (b == Property::Pressure || (b == Property::Temperature && a != Property::Pressure))
+        {
+            std::swap(a, b);
+            std::swap(a_value, b_value);
+        }
+
+        if (a == Property::Pressure && b == Property::Temperature) return this->from_pressure_temperature(a_value, b_value);
+
+        // The hinted table first; the other one only if that fails
+        const Phase first = (hint && hint->phase == Phase::Compressed) ? Phase::Compressed : Phase::Superheated;
+        const Phase second = first == Phase::Compressed ? Phase::Superheated : Phase::Compressed;
+
+        if (a == Property::Pressure || a == Property::Temperature)
+        {
+            const auto dome = a == Property::Pressure ? this->saturation.at_pressure(a_value) : this->saturation.at_temperature(a_value);
+            if (const auto state = this->from_saturation(dome, b, b_value); found(state)) return state;
+            if (const auto state = this->solve_line(first, a, a_value, b, b_value, hint); found(state)) return state;
+            return this->solve_line(second, a, a_value, b, b_value, hint);
+        }
+
+        // The dome scan is the costliest step, so a single-phase hint is tried before it
+        const bool single_phase_hint = hint && hint->phase != Phase::Saturated;
+        if (single_phase_hint)
+            if (const auto state = this->solve_plane(first, a, a_value, b, b_value, hint); found(state)) return state;
+        if (const auto state = this->solve_dome(a, a_value, b, b_value); found(state)) return state;
+        if (!single_phase_hint)
+            if (const auto state = this->solve_plane(first, a, a_value, b, b_value, hint); found(state)) return state;
+        return this->solve_plane(second, a, a_value, b, b_value, hint);
+    }
+
+    void StateEngine::get_state_batch(const Property a, const std::span<const double> a_values, const Property b, const std::span<const double> b_values, const std::span<PhaseState> out) const
+    {
+        if (a_values.size() != b_values.size() || out.size() != a_values.size())
+            throw std::invalid_argument("Batched inputs and output must all have the same length...");
+
+        constexpr size_t GRAIN = 256;
+        core::ThreadPool::shared().parallel_for(out.size(), GRAIN, [&](const size_t begin, const size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i) out[i] = this->get_state(a, a_values[i], b, b_values[i], i > begin ? &out[i - 1] : nullptr);
+        });
+    }
+
+    PhaseState StateEngine::from_pressure_temperature(const double pressure, const double temperature) const
+    {
+        // Only the table the point belongs to is interpolated, so there are no failed attempts
+        switch (this->classifier.classify(pressure, temperature))
+        {
+            case Phase::Superheated: return {*this->superheated.interpolate(pressure, temperature), Phase::Superheated};
+            case Phase::Compressed: return {*this->compressed.interpolate(pressure, temperature), Phase::Compressed};
+            default: return {};
+        }
+    }
+
+    PhaseState StateEngine::from_saturation(const std::optional<SaturationState>& saturation, const Property other, const double value) const
+    {
+        if (!saturation) return {};
+
+        const double liquid = get(saturation->liquid, other);
+        const double vapor = get(saturation->vapor, other);
+        if (vapor == liquid) return {};  // critical point; every quality gives the same state
+
+        const double x = quality(value, liquid, vapor);
+        if (!(x >= 0.0 && x <= 1.0)) return {};
+        return {saturation->mixture(x), Phase::Saturated, x};
+    }
+
+    PhaseState StateEngine::solve_line(const Phase phase, const Property fixed, const double fixed_value, const Property other, const double value, const PhaseState* hint) const
+    {
+        const RectilinearTable& table = this->table(phase);
+        if (table.empty()) return {};
+        const bool isobar = fixed == Property::Pressure;
+
+        // Only search the table's own side of the dome
+        double min, max;
+        std::vector<double> knots;  // where the interpolant along the line may bend
+        if (isobar)
+        {
+            const auto range = table.temperature_range(fixed_value);
+            if (!range) return {};
+            std::tie(min, max) = *range;
+            if (const auto boiling = this->saturation.saturation_temperature(fixed_value))
+            {
+                if (phase == Phase::Superheated) min = std::max(min, *boiling);
+                else max = std::min(max, *boiling);
+            }
+            knots = table.breakpoints(fixed_value);
+        }
+        else
+        {
+            min = table.pressures().front();
+            max = table.pressures().back();
+            if (const auto boiling = this->saturation.saturation_pressure(fixed_value))
+            {
+                if (phase == Phase::Compressed) min = std::max(min, *boiling);
+                else max = std::min(max, *boiling);
+            }
+            knots.assign(table.pressures().begin(), table.pressures().end());
+        }
+        if (!(min < max)) return {};
+
+        const auto residual = [&](const double x) -> std::pair<double, double>
+        {
+            const auto gradient = isobar ? table.differentiate(fixed_value, x) : table.differentiate(x, fixed_value);
+            if (!gradient) return {NaN, NaN};
+            return {get(gradient->value, other) - value, get(isobar ? gradient->d_dtemperature : gradient->d_dpressure, other)};
+        };
+        const auto settle = [&](const double x) { return isobar ? this->settle(phase, fixed_value, x) : this->settle(phase, x, fixed_value); };
+
+        // Safeguarded Newton over the whole line, which is all a monotone property needs
+        const double guess = hint ? (isobar ? hint->state.temperature : hint->state.pressure) : NaN;
+        if (const auto root = newton_bisect(residual, min, max, guess, TOLERANCE, MAX_ITERATIONS))
+            if (const auto state = settle(*root); found(state)) return state;
+
+        // Otherwise the line holds several roots or crosses gaps in the table; walk the knots, and solve each piece
+        // whose ends straddle the value (exactly at the first step if the table is linear)
+        std::erase_if(knots, [&](const double x) { return !(x > min && x < max); });
+        knots.insert(knots.begin(), min);
+        knots.push_back(max);
+
+        double previous_knot = NaN;
+        double previous = NaN;
+        for (const double knot : knots)
+        {
+            const double current = residual(knot).first;
+            std::optional<double> root;
+            if (current == 0.0) root = knot;
+            else if (!std::isnan(previous) && !std::isnan(current) && (previous < 0.0) != (current < 0.0))
+                root = newton_bisect(residual, previous_knot, knot, previous_knot + (knot - previous_knot) * previous / (previous - current), TOLERANCE, MAX_ITERATIONS);
+            if (root)
+                if (const auto state = settle(*root); found(state)) return state;
+
+            previous_knot = knot;
+            previous = current;
+        }
+        return {};
+    }
+
+    PhaseState StateEngine::solve_plane(const Phase phase, const Property a, const double a_value, const Property b, const double b_value, const PhaseState* hint) const
+    {
+        const RectilinearTable& table = this->table(phase);
+        const auto& spans = phase == Phase::Superheated ? this->superheated_spans : this->compressed_spans;
+        // Relative residuals, except near zero; the specific volume alone spans five decades
+        const double a_scale = std::max(std::abs(a_value), 1e-3 * spans[static_cast<size_t>(a)]);
+        const double b_scale = std::max(std::abs(b_value), 1e-3 * spans[static_cast<size_t>(b)]);
+        const auto merit = [&](const ThermoState& state)
+        {
+            const double ra = (get(state, a) - a_value) / a_scale;
+            const double rb = (get(state, b) - b_value) / b_scale;
+            return ra * ra + rb * rb;
+        };
+
+        // Damped Newton on the interpolant: full steps where they reduce the residual, halved until they do (and
+        // stay inside the table) otherwise
+        const auto newton = [&](double pressure, double temperature) -> std::optional<std::pair<double, double>>
+        {
+            auto gradient = table.differentiate(pressure, temperature);
+            if (!gradient) return std::nullopt;
+            double current = merit(gradient->value);
+
+            for (size_t iteration = 0; iteration < MAX_ITERATIONS; ++iteration)
+            {
+                if (current <= TOLERANCE * TOLERANCE) return std::pair{pressure, temperature};
+
+                const double ra = get(gradient->value, a) - a_value;
+                const double rb = get(gradient->value, b) - b_value;
+                const double a_p = get(gradient->d_dpressure, a), a_t = get(gradient->d_dtemperature, a);
+                const double b_p = get(gradient->d_dpressure, b), b_t = get(gradient->d_dtemperature, b);
+                const double determinant = a_p * b_t - a_t * b_p;
+                if (!(std::abs(determinant) > 0.0) || !std::isfinite(determinant)) return std::nullopt;
+                const double dp = -(b_t * ra - a_t * rb) / determinant;
+                const double dt = -(a_p * rb - b_p * ra) / determinant;
+
+                bool moved = false;
+                for (double step = 1.0; step > 1e-6; step *= 0.5)
+                {
+                    auto next = table.differentiate(pressure + step * dp, temperature + step * dt);
+                    if (!next) continue;
+                    if (const double candidate = merit(next->value); candidate < current)
+                    {
+                        pressure += step * dp;
+                        temperature += step * dt;
+                        gradient = next;
+                        current = candidate;
+                        moved = true;
+                        break;
+                    }
+                }
+                if (!moved) return std::nullopt;
+            }
+            return std::nullopt;
+        };
+
+        if (hint && hint->phase == phase)
+            if (const auto root = newton(hint->state.pressure, hint->state.temperature))
+                if (const auto state = this->settle(phase, root->first, root->second); found(state)) return state;
+
+        // Cold start from the closest rows, since the table need not be smooth enough for the nearest one to
+        // converge; O(n), but only taken without a usable hint
+        std::array<std::pair<double, const ThermoState*>, SEEDS> seeds;
+        seeds.fill({std::numeric_limits<double>::infinity(), nullptr});
+        for (const ThermoState& row : table.states())
+        {
+            if (const double distance = merit(row); distance < seeds.back().first)
+            {
+                seeds.back() = {distance, &row};
+                std::ranges::sort(seeds, {}, &std::pair<double, const ThermoState*>::first);
+            }
+        }
+        for (const auto& [distance, row] : seeds)
+        {
+            if (!row) break;
+            if (const auto root = newton(row->pressure, row->temperature))
+                if (const auto state = this->settle(phase, root->first, root->second); found(state)) return state;
+        }
+        return {};
+    }
+
+    PhaseState StateEngine::solve_dome(const Property a, const double a_value, const Property b, const double b_value) const
+    {
+        if (this->saturation.empty()) return {};
+
+        // Both properties give a quality at each saturation temperature; the state is where they agree
+        const auto qualities = [&](const double temperature) -> std::pair<double, double>
+        {
+            const auto dome = this->saturation.at_temperature(temperature);
+            if (!dome) return {NaN, NaN};
+            return {
+                (a_value - get(dome->liquid, a)) / (get(dome->vapor, a) - get(dome->liquid, a)),
+                (b_value - get(dome->liquid, b)) / (get(dome->vapor, b) - get(dome->liquid, b)),
+            };
+        };
+        const auto gap = [&](const double temperature)
+        {
+            const auto [qa, qb] = qualities(temperature);
+            return std::isfinite(qa - qb) ? qa - qb : NaN;
+        };
+        // The curve has no analytic derivative, so the slope is a forward difference
+        const auto residual = [&](const double temperature) -> std::pair<double, double>
+        {
+            const double here = gap(temperature);
+            const double step = 1e-7 * temperature;
+            double ahead = gap(temperature + step);
+            if (std::isnan(ahead)) return {here, NaN};
+            return {here, (ahead - here) / step};
+        };
+
+        // Scan for sign changes, since the gap need not be monotone, then refine each in turn
+        const auto [min, max] = this->saturation.temperature_range();
+        double previous_temperature = NaN;
+        double previous_gap = NaN;
+        for (size_t i = 0; i <= DOME_SAMPLES; ++i)
+        {
+            const double temperature = min + (max - min) * static_cast<double>(i) / DOME_SAMPLES;
+            const double current = gap(temperature);
+            if (!std::isnan(current) && !std::isnan(previous_gap) && (current > 0.0) != (previous_gap > 0.0))
+            {
+                if (const auto root = newton_bisect(residual, previous_temperature, temperature, NaN, TOLERANCE, MAX_ITERATIONS))
+                {
+                    const auto [qa, qb] = qualities(*root);
+                    const bool agree = std::abs(qa - qb) <= 1e-6;  // not a pole of either quality
+                    if (agree && qa >= -TOLERANCE && qa <= 1.0 + TOLERANCE)
+                    {
+                        const double quality = std::clamp(qa, 0.0, 1.0);
+                        return {this->saturation.at_temperature(*root)->mixture(quality), Phase::Saturated, quality};
+                    }
+                }
+            }
+            previous_temperature = temperature;
+            previous_gap = current;
+        }
+        return {};
+    }
+
+    PhaseState StateEngine::settle(const Phase phase, const double pressure, const double temperature) const
+    {
+        if (this->classifier.classify(pressure, temperature) != phase) return {};
+        return {*this->table(phase).interpolate(pressure, temperature), phase};
+    }
+} // namespace logngine::thermo
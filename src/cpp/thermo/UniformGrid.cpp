@@ -0,0 +1,149 @@
+#include <logngine/thermo/UniformGrid.h>
+#include <logngine/core/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace logngine::thermo
+{
+    namespace
+    {
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        // Largest absolute and relative errors of one worker's share of the samples, per dependent property.
+        struct ErrorBounds
+        {
+            std::array<double, 4> absolute{};
+            std::array<double, 4> relative{};
+
+            void add(const std::array<double, 4>& grid, const ThermoState& source)
+            {
+                const double exact[4] = {source.specific_volume, source.specific_internal_energy, source.specific_enthalpy, source.specific_entropy};
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    const double error = std::abs(grid[k] - exact[k]);
+                    this->absolute[k] = std::max(this->absolute[k], error);
+                    if (exact[k] != 0.0) this->relative[k] = std::max(this->relative[k], error / std::abs(exact[k]));
+                }
+            }
+        };
+
+        ThermoState dependent(const std::array<double, 4>& values)
+        {
+            return {0.0, 0.0, values[0], values[1], values[2], values[3]};
+        }
+    }
+
+    UniformGrid::UniformGrid(const Source& source, const std::pair<double, double> pressure_range, const std::pair<double, double> temperature_range,
+                             const std::pair<size_t, size_t> shape)
+        : pressure_min(pressure_range.first), pressure_max(pressure_range.second),
+          temperature_min(temperature_range.first), temperature_max(temperature_range.second),
+          pressure_count(shape.first), temperature_count(shape.second)
+    {
+        if (!(this->pressure_min < this->pressure_max) || !(this->temperature_min < this->temperature_max))
+            throw std::invalid_argument("Uniform grid ranges must be finite and increasing...");
+        if (this->pressure_count < 2 || this->temperature_count < 2)
+            throw std::invalid_argument("Uniform grid needs at least 2 nodes along each axis...");
+
+        this->inverse_pressure_step = static_cast<double>(this->pressure_count - 1) / (this->pressure_max - this->pressure_min);
+        this->inverse_temperature_step = static_cast<double>(this->temperature_count - 1) / (this->temperature_max - this->temperature_min);
+
+        this->nodes.assign(this->pressure_count * this->temperature_count, {NaN, NaN, NaN, NaN});
+        core::ThreadPool& pool = core::ThreadPool::shared();
+        constexpr size_t GRAIN = 1;  // a row of nodes each
+
+        pool.parallel_for(this->pressure_count, GRAIN, [&](const size_t begin, const size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+                for (size_t j = 0; j < this->temperature_count; ++j)
+                    if (const auto state = source(this->pressure_at(i), this->temperature_at(j)))
+                        this->nodes[i * this->temperature_count + j] = {state->specific_volume, state->specific_internal_energy, state->specific_enthalpy, state->specific_entropy};
+        });
+
+        // Bilinear error peaks inside a cell or on its edges, not at the nodes: sample the centre of every full cell
+        // and the midpoints of its lower edges, and of its upper edges on the last row and column of cells (elsewhere
+        // those are the next cells' lower ones).
+        std::vector<ErrorBounds> bounds(pool.concurrency());
+        pool.parallel_for(this->pressure_count - 1, GRAIN, [&](const size_t begin, const size_t end, const size_t worker)
+        {
+            const auto sample = [&](const double P, const double T)
+            {
+                const auto grid = this->interpolate(P, T);
+                const auto exact = grid ? source(P, T) : std::nullopt;
+                if (exact) bounds[worker].add({grid->specific_volume, grid->specific_internal_energy, grid->specific_enthalpy, grid->specific_entropy}, *exact);
+            };
+
+            for (size_t i = begin; i < end; ++i)
+                for (size_t j = 0; j + 1 < this->temperature_count; ++j)
+                {
+                    const double P = this->pressure_at(i), T = this->temperature_at(j);
+                    const double P_next = this->pressure_at(i + 1), T_next = this->temperature_at(j + 1);
+                    const double P_mid = 0.5 * (P + P_next), T_mid = 0.5 * (T + T_next);
+                    sample(P_mid, T_mid);
+                    sample(P_mid, T);
+                    sample(P, T_mid);
+                    if (i + 2 == this->pressure_count) sample(P_next, T_mid);
+                    if (j + 2 == this->temperature_count) sample(P_mid, T_next);
+                }
+        });
+
+        ErrorBounds total;
+        for (const ErrorBounds& worker : bounds)
+            for (size_t k = 0; k < 4; ++k)
+            {
+                total.absolute[k] = std::max(total.absolute[k], worker.absolute[k]);
+                total.relative[k] = std::max(total.relative[k], worker.relative[k]);
+            }
+
+        this->build_report.bytes = this->nodes.size() * sizeof(Node);
+        this->build_report.nodes = this->nodes.size();
+        this->build_report.missing_nodes = static_cast<size_t>(std::count_if(this->nodes.begin(), this->nodes.end(), [](const Node& node) { return std::isnan(node[0]); }));
+        this->build_report.max_error = dependent(total.absolute);
+        this->build_report.max_relative_error = dependent(total.relative);
+    }
+
+    UniformGrid::UniformGrid(const RectilinearTable& source, const std::pair<double, double> pressure_range, const std::pair<double, double> temperature_range,
+                             const std::pair<size_t, size_t> shape)
+        : UniformGrid([&source](const double P, const double T) { return source.interpolate(P, T); }, pressure_range, temperature_range, shape)
+    {
+    }
+
+    std::optional<ThermoState> UniformGrid::interpolate(const double pressure, const double temperature) const
+    {
+        const double x = (pressure - this->pressure_min) * this->inverse_pressure_step;
+        const double y = (temperature - this->temperature_min) * this->inverse_temperature_step;
+        // Written so that NaN (and an empty grid) falls outside too
+        if (!(x >= 0.0 && x <= static_cast<double>(this->pressure_count - 1) && y >= 0.0 && y <= static_cast<double>(this->temperature_count - 1)))
+            return std::nullopt;
+
+        const size_t i = std::min(static_cast<size_t>(x), this->pressure_count - 2);
+        const size_t j = std::min(static_cast<size_t>(y), this->temperature_count - 2);
+        const double fx = x - static_cast<double>(i), fy = y - static_cast<double>(j);
+
+        const Node* low = &this->nodes[i * this->temperature_count + j];
+        const Node* high = low + this->temperature_count;
+        if (std::isnan(low[0][0]) || std::isnan(low[1][0]) || std::isnan(high[0][0]) || std::isnan(high[1][0])) return std::nullopt;
+
+        double values[4];
+        for (size_t k = 0; k < 4; ++k)
+        {
+            const double at_low = low[0][k] + fy * (low[1][k] - low[0][k]);
+            const double at_high = high[0][k] + fy * (high[1][k] - high[0][k]);
+            values[k] = at_low + fx * (at_high - at_low);
+        }
+        return ThermoState{pressure, temperature, values[0], values[1], values[2], values[3]};
+    }
+
+    double UniformGrid::pressure_at(const size_t i) const
+    {
+        if (i + 1 == this->pressure_count) return this->pressure_max;
+        return this->pressure_min + static_cast<double>(i) / this->inverse_pressure_step;
+    }
+
+    double UniformGrid::temperature_at(const size_t j) const
+    {
+        if (j + 1 == this->temperature_count) return this->temperature_max;
+        return this->temperature_min + static_cast<double>(j) / this->inverse_temperature_step;
+    }
+} // namespace logngine::thermo
@@ -0,0 +1,58 @@
+#include <logngine/thermo/Water.h>
+#include <logngine/data/thermo/water/CompressedTable.h>
+#include <logngine/data/thermo/water/SaturationTable.h>
+#include <logngine/data/thermo/water/SuperheatedTable.h>
+
+namespace logngine::thermo::water
+{
+    const RectilinearTable& superheated_table()
+    {
+        static const RectilinearTable table(to_gradients(std::span(data::thermo::water::SuperheatedTableSpline)),
+                                            to_uncertain_states(data::thermo::water::SuperheatedTable.entries()));
+        return table;
+    }
+
+    const RectilinearTable& compressed_table()
+    {
+        static const RectilinearTable table(to_gradients(std::span(data::thermo::water::CompressedTableSpline)),
+                                            to_uncertain_states(data::thermo::water::CompressedTable.entries()));
+        return table;
+    }
+
+    const SaturationCurve& saturation_curve()
+    {
+        static const SaturationCurve curve(data::thermo::water::SaturationTable.entries());
+        return curve;
+    }
+
+    const StateEngine& state_engine()
+    {
+        static const StateEngine engine(compressed_table(), saturation_curve(), superheated_table());
+        return engine;
+    }
+
+    const IF97Engine& if97_engine()
+    {
+        static const IF97Engine engine(state_engine());
+        return engine;
+    }
+
+    template <Backend B>
+    PhaseState get_state(const Property a, const double a_value, const Property b, const double b_value, const PhaseState* hint)
+    {
+        if constexpr (B == Backend::IF97) return if97_engine().get_state(a, a_value, b, b_value, hint);
+        else return state_engine().get_state(a, a_value, b, b_value, hint);
+    }
+
+    template <Backend B>
+    void get_state_batch(const Property a, const std::span<const double> a_values, const Property b, const std::span<const double> b_values, const std::span<PhaseState> out)
+    {
+        if constexpr (B == Backend::IF97) if97_engine().get_state_batch(a, a_values, b, b_values, out);
+        else state_engine().get_state_batch(a, a_values, b, b_values, out);
+    }
+
+    template PhaseState get_state<Backend::Tables>(Property, double, Property, double, const PhaseState*);
+    template PhaseState get_state<Backend::IF97>(Property, double, Property, double, const PhaseState*);
+    template void get_state_batch<Backend::Tables>(Property, std::span<const double>, Property, std::span<const double>, std::span<PhaseState>);
+    template void get_state_batch<Backend::IF97>(Property, std::span<const double>, Property, std::span<const double>, std::span<PhaseState>);
+} // namespace logngine::thermo::water
@@ -0,0 +1,120 @@
+#include <logngine/uncertainty/Distribution.h>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace logngine::uncertainty
+{
+    namespace
+    {
+        template <size_t N>
+        double polynomial(const double (&c)[N], const double x)
+        {
+            double sum = c[N - 1];
+            for (size_t i = N - 1; i-- > 0;) sum = sum * x + c[i];
+            return sum;
+        }
+    }
+
+    double standard_normal_quantile(const double p)
+    {
+        if (!(p > 0.0 && p < 1.0)) return std::numeric_limits<double>::quiet_NaN();
+
+        // AS 241 (PPND16): rational approximations in the centre, and in sqrt(-log(tail)) for the near and far tails
+        static constexpr double A[] = {3.3871328727963666080e0, 1.3314166789178437745e2, 1.9715909503065514427e3, 1.3731693765509461125e4,
+                                       4.5921953931549871457e4, 6.7265770927008700853e4, 3.3430575583588128105e4, 2.5090809287301226727e3};
+        static constexpr double B[] = {1.0, 4.2313330701600911252e1, 6.8718700749205790830e2, 5.3941960214247511077e3,
+                                       2.1213794301586595867e4, 3.9307895800092710610e4, 2.8729085735721942674e4, 5.2264952788528545610e3};
+        static constexpr double C[] = {1.42343711074968357734e0, 4.63033784615654529590e0, 5.76949722146069140550e0, 3.64784832476320460504e0,
+                                       1.27045825245236838258e0, 2.41780725177450611770e-1, 2.27238449892691845833e-2, 7.74545014278341407640e-4};
+        static constexpr double D[] = {1.0, 2.05319162663775882187e0, 1.67638483018380384940e0, 6.89767334985100004550e-1,
+                                       1.48103976427480074590e-1, 1.51986665636164571966e-2, 5.47593808499534494600e-4, 1.05075007164441684324e-9};
+        static constexpr double E[] = {6.65790464350110377720e0, 5.46378491116411436990e0, 1.78482653991729133580e0, 2.96560571828504891230e-1,
+                                       2.65321895265761230930e-2, 1.24266094738807843860e-3, 2.71155556874348757815e-5, 2.01033439929228813265e-7};
+        static constexpr double F[] = {1.0, 5.99832206555887937690e-1, 1.36929880922735805310e-1, 1.48753612908506148525e-2,
+                                       7.86869131145613259100e-4, 1.84631831751005468180e-5, 1.42151175831644588870e-7, 2.04426310338993978564e-15};
+
+        const double q = p - 0.5;
+        if (std::abs(q) <= 0.425)
+        {
+            const double r = 0.180625 - q * q;
+            return q * polynomial(A, r) / polynomial(B, r);
+        }
+
+        double r = std::sqrt(-std::log(q < 0.0 ? p : 1.0 - p));
+        const double z = r <= 5.0 ? (r -= 1.6, polynomial(C, r) / polynomial(D, r)) : (r -= 5.0, polynomial(E, r) / polynomial(F, r));
+        return q < 0.0 ? -z : z;
+    }
+
+    Distribution Distribution::normal(const double mean, const double standard_deviation)
+    {
+        if (!std::isfinite(mean) || !(standard_deviation >= 0.0 && std::isfinite(standard_deviation)))
+            throw std::invalid_argument("Normal distribution needs a finite mean and a finite, non-negative standard deviation...");
+        return {Kind::Normal, {mean, standard_deviation, 0.0}};
+    }
+
+    Distribution Distribution::uniform(const double low, const double high)
+    {
+        if (!std::isfinite(low) || !std::isfinite(high) || !(low <= high))
+            throw std::invalid_argument("Uniform distribution needs finite bounds with low <= high...");
+        return {Kind::Uniform, {low, high, 0.0}};
+    }
+
+    Distribution Distribution::log_normal(const double log_mean, const double log_standard_deviation)
+    {
+        if (!std::isfinite(log_mean) || !(log_standard_deviation >= 0.0 && std::isfinite(log_standard_deviation)))
+            throw std::invalid_argument("Log-normal distribution needs a finite log-mean and a finite, non-negative log-standard deviation...");
+        return {Kind::LogNormal, {log_mean, log_standard_deviation, 0.0}};
+    }
+
+    Distribution Distribution::triangular(const double low, const double mode, const double high)
+    {
+        if (!std::isfinite(low) || !std::isfinite(high) || !(low <= mode && mode <= high && low < high))
+            throw std::invalid_argument("Triangular distribution needs finite low <= mode <= high, with low < high...");
+        return {Kind::Triangular, {low, mode, high}};
+    }
+
+    double Distribution::quantile(const double p) const
+    {
+        const auto [a, b, c] = this->values;
+        switch (this->type)
+        {
+            case Kind::Normal: return a + b * standard_normal_quantile(p);
+            case Kind::Uniform: return a + p * (b - a);
+            case Kind::LogNormal: return std::exp(a + b * standard_normal_quantile(p));
+            case Kind::Triangular:
+            {
+                const double split = (b - a) / (c - a);  // CDF at the mode
+                if (p < split) return a + std::sqrt(p * (c - a) * (b - a));
+                return c - std::sqrt((1.0 - p) * (c - a) * (c - b));
+            }
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double Distribution::mean() const
+    {
+        const auto [a, b, c] = this->values;
+        switch (this->type)
+        {
+            case Kind::Normal: return a;
+            case Kind::Uniform: return 0.5 * (a + b);
+            case Kind::LogNormal: return std::exp(a + 0.5 * b * b);
+            case Kind::Triangular: return (a + b + c) / 3.0;
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double Distribution::variance() const
+    {
+        const auto [a, b, c] = this->values;
+        switch (this->type)
+        {
+            case Kind::Normal: return b * b;
+            case Kind::Uniform: return (b - a) * (b - a) / 12.0;
+            case Kind::LogNormal: return std::expm1(b * b) * std::exp(2.0 * a + b * b);
+            case Kind::Triangular: return (a * a + b * b + c * c - a * b - a * c - b * c) / 18.0;
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+} // namespace logngine::uncertainty
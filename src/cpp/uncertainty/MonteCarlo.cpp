@@ -0,0 +1,83 @@
+#include <logngine/uncertainty/MonteCarlo.h>
+#include <logngine/core/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace logngine::uncertainty
+{
+    MonteCarlo::MonteCarlo(std::vector<Distribution> inputs, const std::uint64_t seed)
+        : MonteCarlo(inputs, Sampler::random(inputs.size(), seed))
+    {
+    }
+
+    MonteCarlo::MonteCarlo(std::vector<Distribution> inputs, Sampler sampler) : inputs(std::move(inputs)), points(std::move(sampler))
+    {
+        if (this->points.dimension() != this->inputs.size())
+            throw std::invalid_argument("Monte Carlo sampler must have one dimension per input...");
+    }
+
+    void MonteCarlo::sample(const std::uint64_t first_sample, const size_t count, const std::span<double> out) const
+    {
+        this->points.sample(this->inputs, first_sample, count, out);
+    }
+
+    MonteCarloResult MonteCarlo::run(const Model& model, const size_t outputs, const std::uint64_t samples, const size_t block) const
+    {
+        if (outputs == 0) throw std::invalid_argument("Monte Carlo model must have at least one output...");
+        if (block == 0) throw std::invalid_argument("Monte Carlo block size must be positive...");
+        if (samples > this->points.size()) throw std::invalid_argument("Monte Carlo run needs more samples than its sampler's design has...");
+
+        // One summary per block, merged in block order afterwards: which thread ran a block cannot change the result
+        struct Summary
+        {
+            std::vector<Moments> moments;
+            std::vector<TDigest> quantiles;
+        };
+        const size_t blocks = static_cast<size_t>((samples + block - 1) / block);
+        std::vector<Summary> summaries(blocks);
+
+        core::ThreadPool& pool = core::ThreadPool::shared();
+        struct Scratch
+        {
+            std::vector<double> inputs;
+            std::vector<double> outputs;
+        };
+        std::vector<Scratch> scratch(pool.concurrency());
+
+        pool.parallel_for(blocks, 1, [&](const size_t begin, const size_t end, const size_t worker)
+        {
+            auto& [inputs, results] = scratch[worker];
+            for (size_t b = begin; b < end; ++b)
+            {
+                const std::uint64_t first = static_cast<std::uint64_t>(b) * block;
+                const size_t count = static_cast<size_t>(std::min<std::uint64_t>(block, samples - first));
+                inputs.resize(count * this->dimension());
+                results.assign(count * outputs, std::numeric_limits<double>::quiet_NaN());
+                this->sample(first, count, inputs);
+                model(first, inputs, results);
+
+                Summary& summary = summaries[b];
+                summary.moments.assign(outputs, {});
+                summary.quantiles.assign(outputs, TDigest());
+                for (size_t i = 0; i < count; ++i)
+                    for (size_t k = 0; k < outputs; ++k)
+                        if (const double y = results[i * outputs + k]; std::isfinite(y))
+                        {
+                            summary.moments[k].add(y);
+                            summary.quantiles[k].add(y);
+                        }
+            }
+        });
+
+        MonteCarloResult result{samples, std::vector<Moments>(outputs), std::vector<TDigest>(outputs)};
+        for (const Summary& summary : summaries)
+            for (size_t k = 0; k < outputs; ++k)
+            {
+                result.moments[k].merge(summary.moments[k]);
+                result.quantiles[k].merge(summary.quantiles[k]);
+            }
+        return result;
+    }
+} // namespace logngine::uncertainty
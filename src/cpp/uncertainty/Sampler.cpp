@@ -0,0 +1,379 @@
+#include <logngine/uncertainty/Sampler.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+namespace logngine::uncertainty
+{
+    namespace
+    {
+        // Domains of the random bits drawn for each use, so no two uses share a draw
+        enum Domain : std::uint32_t
+        {
+            LatinHypercubeKeys = 1,
+            SobolKeys = 2,
+            HaltonPermutations = 3,
+            SobolDirections = 4,
+        };
+
+        // 32 random bits for (a, b) of `domain`, from the generator of `seed`.
+        std::uint32_t random_bits(const std::uint64_t seed, const Domain domain, const std::uint64_t a, const std::uint32_t b = 0)
+        {
+            return philox4x32({static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(a >> 32), b, domain},
+                              {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)})[0];
+        }
+
+        // ==========================================================
+        //  Latin Hypercube
+        // ==========================================================
+
+        // Image of `i` under the permutation of [0, n) keyed by `key`: a hash that is a bijection on the next power
+        // of two, cycle-walked down to [0, n) (Kensler, "Correlated Multi-Jittered Sampling", 2013). No table needed.
+        std::uint32_t permute(std::uint32_t i, const std::uint32_t n, const std::uint32_t key)
+        {
+            std::uint32_t w = n - 1;
+            w |= w >> 1;
+            w |= w >> 2;
+            w |= w >> 4;
+            w |= w >> 8;
+            w |= w >> 16;
+            do
+            {
+                i ^= key;
+                i *= 0xe170893d;
+                i ^= key >> 16;
+                i ^= (i & w) >> 4;
+                i ^= key >> 8;
+                i *= 0x0929eb3f;
+                i ^= key >> 23;
+                i ^= (i & w) >> 1;
+                i *= 1 | key >> 27;
+                i *= 0x6935fa69;
+                i ^= (i & w) >> 11;
+                i *= 0x74dcb303;
+                i ^= (i & w) >> 2;
+                i *= 0x9e501cc3;
+                i ^= (i & w) >> 2;
+                i *= 0xc860a3df;
+                i &= w;
+                i ^= i >> 5;
+            } while (i >= n);
+            // In 64 bits: `i + key` would wrap past 2^32, and the result would no longer be a permutation
+            return static_cast<std::uint32_t>((std::uint64_t{i} + key) % n);
+        }
+
+        // ==========================================================
+        //  Sobol
+        // ==========================================================
+
+        // Initial direction numbers m_1 .. m_s of dimensions 1 to 31 (Joe & Kuo, new-joe-kuo-6.21201), for the
+        // primitive polynomials in the order `primitive_polynomials` gives them.
+        constexpr std::array<std::array<std::uint32_t, 7>, 31> InitialDirections = {{
+            {1},
+            {1, 3},
+            {1, 3, 1},
+            {1, 1, 1},
+            {1, 1, 3, 3},
+            {1, 3, 5, 13},
+            {1, 1, 5, 5, 17},
+            {1, 1, 5, 5, 5},
+            {1, 1, 7, 11, 19},
+            {1, 1, 5, 1, 1},
+            {1, 1, 1, 3, 11},
+            {1, 3, 5, 5, 31},
+            {1, 3, 3, 9, 7, 49},
+            {1, 1, 1, 15, 21, 21},
+            {1, 3, 1, 13, 27, 49},
+            {1, 1, 1, 15, 7, 5},
+            {1, 3, 1, 15, 13, 25},
+            {1, 1, 5, 5, 19, 61},
+            {1, 3, 7, 11, 23, 15, 103},
+            {1, 3, 7, 13, 13, 15, 69},
+            {1, 1, 3, 13, 7, 35, 63},
+            {1, 3, 5, 9, 1, 25, 53},
+            {1, 3, 1, 13, 9, 35, 107},
+            {1, 3, 1, 5, 27, 61, 31},
+            {1, 1, 5, 11, 19, 41, 61},
+            {1, 3, 5, 3, 3, 13, 69},
+            {1, 1, 7, 13, 1, 19, 1},
+            {1, 3, 7, 5, 13, 19, 59},
+            {1, 1, 3, 9, 25, 29, 41},
+            {1, 3, 5, 13, 23, 1, 55},
+            {1, 3, 7, 3, 13, 59, 17},
+        }};
+
+        // a * b mod p, polynomials over GF(2) as bit sets; p has degree `degree` < 32.
+        std::uint64_t multiply_mod(const std::uint64_t a, const std::uint64_t b, const std::uint64_t p, const unsigned degree)
+        {
+            std::uint64_t product = 0;
+            for (unsigned k = 0; k < degree; ++k)
+                if (b >> k & 1) product ^= a << k;
+            for (unsigned k = 2 * degree; k-- > degree;)
+                if (product >> k & 1) product ^= p << (k - degree);
+            return product;
+        }
+
+        std::uint64_t power_of_x_mod(std::uint64_t exponent, const std::uint64_t p, const unsigned degree)
+        {
+            std::uint64_t result = 1, base = degree == 1 ? 1 : 2;  // x mod (x + 1) is 1
+            for (; exponent; exponent >>= 1)
+            {
+                if (exponent & 1) result = multiply_mod(result, base, p, degree);
+                base = multiply_mod(base, base, p, degree);
+            }
+            return result;
+        }
+
+        // Whether x has order 2^degree - 1 modulo `p`.
+        bool primitive(const std::uint64_t p, const unsigned degree)
+        {
+            const std::uint64_t order = (std::uint64_t{1} << degree) - 1;
+            if (power_of_x_mod(order, p, degree) != 1) return false;
+            std::uint64_t rest = order;
+            for (std::uint64_t q = 2; q * q <= rest; ++q)
+            {
+                if (rest % q) continue;
+                if (power_of_x_mod(order / q, p, degree) == 1) return false;
+                while (rest % q == 0) rest /= q;
+            }
+            return rest == 1 || rest == order || power_of_x_mod(order / rest, p, degree) != 1;
+        }
+
+        struct Polynomial
+        {
+            unsigned degree;
+            std::uint32_t inner;  // coefficients of x^(degree - 1) .. x^1, highest first
+        };
+
+        // The first `count` primitive polynomials over GF(2), by degree, then by their inner coefficients.
+        std::vector<Polynomial> primitive_polynomials(const size_t count)
+        {
+            std::vector<Polynomial> found;
+            for (unsigned degree = 1; found.size() < count; ++degree)
+                for (std::uint32_t inner = 0; inner < (1u << (degree - 1)) && found.size() < count; ++inner)
+                    if (primitive(std::uint64_t{1} << degree | std::uint64_t{inner} << 1 | 1, degree)) found.push_back({degree, inner});
+            return found;
+        }
+
+        std::uint32_t reverse_bits(std::uint32_t x)
+        {
+            x = (x & 0x55555555) << 1 | (x >> 1 & 0x55555555);
+            x = (x & 0x33333333) << 2 | (x >> 2 & 0x33333333);
+            x = (x & 0x0f0f0f0f) << 4 | (x >> 4 & 0x0f0f0f0f);
+            x = (x & 0x00ff00ff) << 8 | (x >> 8 & 0x00ff00ff);
+            return x << 16 | x >> 16;
+        }
+
+        // Owen scrambling of a 32-bit coordinate: each bit is flipped by a hash of the bits above it, keyed by
+        // `seed` (Burley, "Practical Hash-based Owen Scrambling", 2020).
+        std::uint32_t owen_scramble(std::uint32_t x, const std::uint32_t seed)
+        {
+            x = reverse_bits(x);
+            x ^= x * 0x3d20adea;
+            x += seed;
+            x *= (seed >> 16) | 1;
+            x ^= x * 0x05526c56;
+            x ^= x * 0x53a22864;
+            return reverse_bits(x);
+        }
+
+        // ==========================================================
+        //  Halton
+        // ==========================================================
+
+        constexpr size_t MaxHaltonDimension = 1000;
+
+        std::vector<std::uint32_t> primes(const size_t count)
+        {
+            std::vector<std::uint32_t> found;
+            for (std::uint32_t n = 2; found.size() < count; ++n)
+                if (std::none_of(found.begin(), found.end(), [n](const std::uint32_t p) { return n % p == 0; })) found.push_back(n);
+            return found;
+        }
+
+        // Digits of base `base` a Halton coordinate keeps: as many as keep base^digits within the 52-bit mantissa.
+        size_t halton_digits(const std::uint32_t base)
+        {
+            constexpr std::uint64_t limit = std::uint64_t{1} << 52;
+            size_t digits = 1;
+            for (std::uint64_t scale = base; scale <= limit / base; scale *= base) ++digits;
+            return digits;
+        }
+
+        // Just below 1, for uniforms that round up to it
+        constexpr double BelowOne = 1.0 - 0x1.0p-53;
+    }
+
+    Sampler::Sampler(const Kind type, const size_t dimensions, const std::uint64_t count, const std::uint64_t seed, const bool scramble)
+        : type(type), dimensions(dimensions), count(count), key(seed), generator(seed)
+    {
+        if (dimensions == 0) throw std::invalid_argument("Sampler needs at least one dimension...");
+
+        switch (type)
+        {
+            case Kind::Random: break;
+            case Kind::LatinHypercube:
+            {
+                this->keys.resize(dimensions);
+                for (size_t d = 0; d < dimensions; ++d) this->keys[d] = random_bits(seed, LatinHypercubeKeys, d);
+                break;
+            }
+            case Kind::Sobol:
+            {
+                // Dimension 0 is the van der Corput sequence; the others take the recurrence of a primitive polynomial
+                this->directions.resize(32 * dimensions);
+                for (unsigned k = 0; k < 32; ++k) this->directions[k] = 1u << (31 - k);
+                const auto polynomials = primitive_polynomials(dimensions - 1);
+                for (size_t d = 1; d < dimensions; ++d)
+                {
+                    const auto [degree, inner] = polynomials[d - 1];
+                    std::uint32_t* v = &this->directions[32 * d];
+                    for (unsigned k = 0; k < degree && k < 32; ++k)
+                    {
+                        // Beyond the tabulated dimensions, random odd m_k < 2^k (fixed, whatever the seed)
+                        const std::uint32_t m = d <= InitialDirections.size()
+                            ? InitialDirections[d - 1][k]
+                            : (random_bits(0, SobolDirections, d, k) & ((1u << k) - 1)) << 1 | 1;
+                        v[k] = m << (31 - k);
+                    }
+                    for (unsigned k = degree; k < 32; ++k)
+                    {
+                        v[k] = v[k - degree] ^ (v[k - degree] >> degree);
+                        for (unsigned t = 1; t < degree; ++t)
+                            if (inner >> (degree - 1 - t) & 1) v[k] ^= v[k - t];
+                    }
+                }
+                if (scramble)
+                {
+                    this->keys.resize(dimensions);
+                    for (size_t d = 0; d < dimensions; ++d) this->keys[d] = random_bits(seed, SobolKeys, d);
+                }
+                break;
+            }
+            case Kind::Halton:
+            {
+                if (dimensions > MaxHaltonDimension) throw std::invalid_argument("Halton sampler supports at most 1000 dimensions...");
+                const auto bases = primes(dimensions);
+                this->radices.reserve(dimensions);
+                for (size_t d = 0; d < dimensions; ++d)
+                {
+                    const std::uint32_t base = bases[d];
+                    const size_t digits = halton_digits(base);
+                    this->radices.push_back({base, this->permutations.size(), digits});
+                    if (!scramble) continue;  // every digit as it is
+
+                    // A Fisher-Yates shuffle of [0, base) for each digit
+                    for (size_t j = 0; j < digits; ++j)
+                    {
+                        const size_t offset = this->permutations.size();
+                        for (std::uint32_t b = 0; b < base; ++b) this->permutations.push_back(static_cast<std::uint16_t>(b));
+                        for (std::uint32_t b = base - 1; b > 0; --b)
+                        {
+                            const std::uint64_t r = random_bits(seed, HaltonPermutations, d << 8 | j, b);
+                            std::swap(this->permutations[offset + b], this->permutations[offset + (r * (b + 1) >> 32)]);
+                        }
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    Sampler Sampler::random(const size_t dimension, const std::uint64_t seed)
+    {
+        return {Kind::Random, dimension, std::numeric_limits<std::uint64_t>::max(), seed, false};
+    }
+
+    Sampler Sampler::latin_hypercube(const size_t dimension, const std::uint64_t samples, const std::uint64_t seed)
+    {
+        if (samples == 0 || samples > std::numeric_limits<std::uint32_t>::max())
+            throw std::invalid_argument("Latin hypercube needs between 1 and 2^32 - 1 samples...");
+        return {Kind::LatinHypercube, dimension, samples, seed, false};
+    }
+
+    Sampler Sampler::sobol(const size_t dimension, const std::uint64_t seed, const bool scramble)
+    {
+        return {Kind::Sobol, dimension, std::uint64_t{1} << 32, seed, scramble};
+    }
+
+    Sampler Sampler::halton(const size_t dimension, const std::uint64_t seed, const bool scramble)
+    {
+        return {Kind::Halton, dimension, std::numeric_limits<std::uint64_t>::max(), seed, scramble};
+    }
+
+    void Sampler::points(const std::uint64_t first, const size_t count, const std::span<double> out) const
+    {
+        const size_t dimension = this->dimensions;
+        if (out.size() != count * dimension)
+            throw std::invalid_argument("Sampler buffer must hold count x dimension values...");
+        if (count > this->count || first > this->count - count)
+            throw std::invalid_argument("Sampler has no points past the end of its design...");
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const std::uint64_t index = first + i;
+            double* row = out.data() + i * dimension;
+            switch (this->type)
+            {
+                case Kind::Random:
+                    for (size_t d = 0; d < dimension; d += 2)
+                    {
+                        const auto u = this->generator.pair(index, d / 2);
+                        row[d] = u[0];
+                        if (d + 1 < dimension) row[d + 1] = u[1];
+                    }
+                    break;
+                case Kind::LatinHypercube:
+                {
+                    // Stratum permute(index) of each dimension, jittered within it
+                    const auto n = static_cast<std::uint32_t>(this->count);
+                    for (size_t d = 0; d < dimension; ++d)
+                    {
+                        const double u = (permute(static_cast<std::uint32_t>(index), n, this->keys[d]) + this->generator.uniform(index, d)) / n;
+                        row[d] = std::min(u, BelowOne);
+                    }
+                    break;
+                }
+                case Kind::Sobol:
+                    for (size_t d = 0; d < dimension; ++d)
+                    {
+                        const std::uint32_t* v = &this->directions[32 * d];
+                        std::uint32_t x = 0;
+                        for (auto bits = static_cast<std::uint32_t>(index); bits; bits &= bits - 1) x ^= v[std::countr_zero(bits)];
+                        if (!this->keys.empty()) x = owen_scramble(x, this->keys[d]);
+                        row[d] = (x + 0.5) * 0x1.0p-32;
+                    }
+                    break;
+                case Kind::Halton:
+                    for (size_t d = 0; d < dimension; ++d)
+                    {
+                        // The digits of the index, reversed behind the radix point, each through its permutation; the
+                        // half of a last digit keeps the point off 0
+                        const auto [base, offset, digits] = this->radices[d];
+                        const bool scrambled = !this->permutations.empty();
+                        std::uint64_t rest = index, numerator = 0, scale = 1;
+                        for (size_t j = 0; j < digits; ++j)
+                        {
+                            const auto digit = static_cast<std::uint32_t>(rest % base);
+                            rest /= base;
+                            numerator = numerator * base + (scrambled ? this->permutations[offset + j * base + digit] : digit);
+                            scale *= base;
+                        }
+                        row[d] = (static_cast<double>(numerator) + 0.5) / static_cast<double>(scale);
+                    }
+                    break;
+            }
+        }
+    }
+
+    void Sampler::sample(const std::span<const Distribution> inputs, const std::uint64_t first, const size_t count, const std::span<double> out) const
+    {
+        const size_t dimension = this->dimensions;
+        if (inputs.size() != dimension) throw std::invalid_argument("Sampler needs one input distribution per dimension...");
+        this->points(first, count, out);
+        for (size_t i = 0; i < count; ++i)
+            for (size_t d = 0; d < dimension; ++d) out[i * dimension + d] = inputs[d].quantile(out[i * dimension + d]);
+    }
+} // namespace logngine::uncertainty
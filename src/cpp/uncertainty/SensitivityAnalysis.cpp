@@ -0,0 +1,199 @@
+#include <logngine/uncertainty/SensitivityAnalysis.h>
+#include <logngine/core/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+namespace logngine::uncertainty
+{
+    namespace
+    {
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        // Evaluations of one output, as the model wrote them: per base sample, f(A), f(B), then f(A_B^(i)) per input
+        struct Evaluations
+        {
+            std::span<const double> values;
+            size_t stride;   // values per base sample: (inputs + 2) * outputs
+            size_t outputs;
+            size_t output;
+
+            [[nodiscard]] double at(const std::uint64_t sample, const size_t k) const { return this->values[sample * this->stride + k * this->outputs + this->output]; }
+        };
+
+        // Saltelli's first-order and Jansen's total estimators over the base samples `row(0)` .. `row(n - 1)`,
+        // skipping those `valid` rejects. The outputs are centred on `centre` first, which changes neither
+        // estimator's expectation but takes the mean's cancellation out of the first.
+        template <typename Row>
+        void estimate(const Evaluations& f, const std::vector<char>& valid, const double centre, const std::uint64_t n, const Row& row,
+                      std::span<double> first, std::span<double> total)
+        {
+            const size_t inputs = first.size();
+            std::fill(first.begin(), first.end(), 0.0);
+            std::fill(total.begin(), total.end(), 0.0);
+            Moments spread;
+            std::uint64_t used = 0;
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                const std::uint64_t s = row(i);
+                if (!valid[s]) continue;
+                ++used;
+                const double a = f.at(s, 0) - centre;
+                const double b = f.at(s, 1) - centre;
+                spread.add(a);
+                spread.add(b);
+                for (size_t j = 0; j < inputs; ++j)
+                {
+                    const double ab = f.at(s, 2 + j) - centre;
+                    first[j] += b * (ab - a);
+                    total[j] += (a - ab) * (a - ab);
+                }
+            }
+
+            const double variance = spread.variance();
+            for (size_t j = 0; j < inputs; ++j)
+            {
+                first[j] = used > 1 && variance > 0.0 ? first[j] / static_cast<double>(used) / variance : NaN;
+                total[j] = used > 1 && variance > 0.0 ? total[j] / (2.0 * static_cast<double>(used)) / variance : NaN;
+            }
+        }
+
+        // Linearly interpolated `q` quantile of sorted values; NaN if there are none.
+        double percentile(const std::vector<double>& x, const double q)
+        {
+            if (x.empty()) return NaN;
+            const double position = q * static_cast<double>(x.size() - 1);
+            const auto below = static_cast<size_t>(position);
+            const size_t above = std::min(below + 1, x.size() - 1);
+            return x[below] + (position - static_cast<double>(below)) * (x[above] - x[below]);
+        }
+
+        // Bootstrap resamples draw from their own stream of keys, apart from the sampler's
+        constexpr std::uint64_t BootstrapKey = 0x9E3779B97F4A7C15;
+    }
+
+    SensitivityAnalysis::SensitivityAnalysis(std::vector<Distribution> inputs, const std::uint64_t seed)
+        : SensitivityAnalysis(inputs, Sampler::sobol(2 * inputs.size(), seed))
+    {
+    }
+
+    SensitivityAnalysis::SensitivityAnalysis(std::vector<Distribution> inputs, Sampler sampler) : inputs(std::move(inputs)), points(std::move(sampler))
+    {
+        if (this->points.dimension() != 2 * this->inputs.size())
+            throw std::invalid_argument("Sensitivity analysis sampler must have two dimensions per input...");
+    }
+
+    SensitivityResult SensitivityAnalysis::run(const MonteCarlo::Model& model, const size_t outputs, const std::uint64_t samples, const size_t resamples,
+                                               const double confidence, const size_t block) const
+    {
+        if (outputs == 0) throw std::invalid_argument("Sensitivity analysis model must have at least one output...");
+        if (samples == 0) throw std::invalid_argument("Sensitivity analysis needs at least one sample...");
+        if (block == 0) throw std::invalid_argument("Sensitivity analysis block size must be positive...");
+        if (!(confidence > 0.0 && confidence < 1.0)) throw std::invalid_argument("Sensitivity analysis confidence must be in (0, 1)...");
+        if (samples > this->points.size()) throw std::invalid_argument("Sensitivity analysis needs more samples than its sampler's design has...");
+
+        const size_t d = this->dimension();
+        const size_t rows = d + 2;
+        const size_t stride = rows * outputs;
+        std::vector<double> values(static_cast<size_t>(samples) * stride, NaN);
+
+        // Both halves of a point go through the same inputs
+        std::vector<Distribution> doubled(this->inputs);
+        doubled.insert(doubled.end(), this->inputs.begin(), this->inputs.end());
+
+        core::ThreadPool& pool = core::ThreadPool::shared();
+        struct Scratch
+        {
+            std::vector<double> points;
+            std::vector<double> inputs;
+        };
+        std::vector<Scratch> scratch(pool.concurrency());
+
+        const size_t blocks = static_cast<size_t>((samples + block - 1) / block);
+        pool.parallel_for(blocks, 1, [&](const size_t begin, const size_t end, const size_t worker)
+        {
+            auto& [points, inputs] = scratch[worker];
+            for (size_t b = begin; b < end; ++b)
+            {
+                const std::uint64_t first = static_cast<std::uint64_t>(b) * block;
+                const size_t count = static_cast<size_t>(std::min<std::uint64_t>(block, samples - first));
+                points.resize(count * 2 * d);
+                this->points.sample(doubled, first, count, points);
+
+                // Per base sample: A, B, then A with each column in turn from B
+                inputs.resize(count * rows * d);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const double* a_row = &points[i * 2 * d];
+                    const double* b_row = a_row + d;
+                    double* row = &inputs[i * rows * d];
+                    std::copy_n(a_row, d, row);
+                    std::copy_n(b_row, d, row + d);
+                    for (size_t j = 0; j < d; ++j)
+                    {
+                        double* ab_row = row + (2 + j) * d;
+                        std::copy_n(a_row, d, ab_row);
+                        ab_row[j] = b_row[j];
+                    }
+                }
+                model(first * rows, inputs, std::span(values).subspan(static_cast<size_t>(first) * stride, count * stride));
+            }
+        });
+
+        SensitivityResult result{samples, samples * rows, d, outputs, confidence, std::vector<Moments>(outputs),
+                                 std::vector<SobolIndex>(outputs * d), std::vector<SobolIndex>(outputs * d)};
+        const Philox bootstrap(this->points.seed() ^ BootstrapKey);
+        std::vector<char> valid(samples);
+        std::vector<double> first(d), total(d);
+        std::vector<double> resampled_first(resamples * d), resampled_total(resamples * d);
+        for (size_t k = 0; k < outputs; ++k)
+        {
+            const Evaluations f{values, stride, outputs, k};
+            Moments& moments = result.moments[k];
+            for (std::uint64_t s = 0; s < samples; ++s)
+            {
+                bool finite = true;
+                for (size_t r = 0; r < rows && finite; ++r) finite = std::isfinite(f.at(s, r));
+                valid[s] = finite;
+                if (!finite) continue;
+                moments.add(f.at(s, 0));
+                moments.add(f.at(s, 1));
+            }
+            const double centre = moments.mean();
+
+            estimate(f, valid, centre, samples, [](const std::uint64_t i) { return i; }, first, total);
+            pool.parallel_for(resamples, 1, [&](const size_t begin, const size_t end, size_t)
+            {
+                for (size_t r = begin; r < end; ++r)
+                {
+                    const auto pick = [&](const std::uint64_t i)
+                    {
+                        const auto s = static_cast<std::uint64_t>(bootstrap.uniform(r, i) * static_cast<double>(samples));
+                        return std::min(s, samples - 1);
+                    };
+                    estimate(f, valid, centre, samples, pick, std::span(resampled_first).subspan(r * d, d), std::span(resampled_total).subspan(r * d, d));
+                }
+            });
+
+            // Percentile intervals over the resamples that gave an index
+            const double tail = (1.0 - confidence) / 2.0;
+            std::vector<double> column;
+            const auto interval = [&](const std::vector<double>& resampled, const size_t j, const double estimate)
+            {
+                column.clear();
+                for (size_t r = 0; r < resamples; ++r)
+                    if (const double x = resampled[r * d + j]; std::isfinite(x)) column.push_back(x);
+                std::sort(column.begin(), column.end());
+                return SobolIndex{estimate, percentile(column, tail), percentile(column, 1.0 - tail)};
+            };
+            for (size_t j = 0; j < d; ++j)
+            {
+                result.first_order_indices[k * d + j] = interval(resampled_first, j, first[j]);
+                result.total_indices[k * d + j] = interval(resampled_total, j, total[j]);
+            }
+        }
+        return result;
+    }
+} // namespace logngine::uncertainty
@@ -0,0 +1,410 @@
+#include <logngine/uncertainty/Statistics.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace logngine::uncertainty
+{
+    namespace
+    {
+        // Whether a saved double holds a count.
+        bool is_count(const double x)
+        {
+            return x >= 0.0 && x <= 0x1.0p53 && x == std::floor(x);
+        }
+    }
+
+    // ==========================================================
+    //  Moments
+    // ==========================================================
+#pragma region Moments
+
+    void Moments::add(const double x)
+    {
+        ++this->n;
+        const double delta = x - this->average;
+        this->average += delta / static_cast<double>(this->n);
+        this->m2 += delta * (x - this->average);
+        this->lowest = std::min(this->lowest, x);
+        this->highest = std::max(this->highest, x);
+    }
+
+    void Moments::merge(const Moments& other)
+    {
+        if (other.n == 0) return;
+        if (this->n == 0)
+        {
+            *this = other;
+            return;
+        }
+        const double n_a = static_cast<double>(this->n), n_b = static_cast<double>(other.n);
+        const double n = n_a + n_b;
+        const double delta = other.average - this->average;
+        this->average += delta * n_b / n;
+        this->m2 += other.m2 + delta * delta * n_a * n_b / n;
+        this->n += other.n;
+        this->lowest = std::min(this->lowest, other.lowest);
+        this->highest = std::max(this->highest, other.highest);
+    }
+
+    std::vector<double> Moments::save() const
+    {
+        return {static_cast<double>(this->n), this->average, this->m2, this->lowest, this->highest};
+    }
+
+    Moments Moments::load(const std::span<const double> state)
+    {
+        if (state.size() != 5 || !is_count(state[0]) || !(state[2] >= 0.0))
+            throw std::invalid_argument("Not a saved Moments state...");
+        Moments moments;
+        moments.n = static_cast<std::uint64_t>(state[0]);
+        moments.average = state[1];
+        moments.m2 = state[2];
+        moments.lowest = state[3];
+        moments.highest = state[4];
+        return moments;
+    }
+
+    double Moments::mean() const
+    {
+        return this->n > 0 ? this->average : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double Moments::variance() const
+    {
+        return this->n > 1 ? this->m2 / static_cast<double>(this->n - 1) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double Moments::standard_deviation() const
+    {
+        return std::sqrt(this->variance());
+    }
+
+    double Moments::standard_error() const
+    {
+        return std::sqrt(this->variance() / static_cast<double>(this->n));
+    }
+
+#pragma endregion
+
+    // ==========================================================
+    //  t-Digest
+    // ==========================================================
+#pragma region TDigest
+
+    TDigest::TDigest(const double compression) : compression(compression)
+    {
+        if (!(compression >= 1.0 && std::isfinite(compression)))
+            throw std::invalid_argument("t-digest compression must be finite and at least 1...");
+    }
+
+    void TDigest::add(const double x, const double weight)
+    {
+        if (!std::isfinite(x) || !(weight > 0.0)) return;
+        this->buffer.push_back({x, weight});
+        this->buffered += weight;
+        this->lowest = std::min(this->lowest, x);
+        this->highest = std::max(this->highest, x);
+        if (this->buffer.size() >= 8 * static_cast<size_t>(this->compression)) this->compress();
+    }
+
+    void TDigest::merge(const TDigest& other)
+    {
+        this->buffer.insert(this->buffer.end(), other.centroids.begin(), other.centroids.end());
+        this->buffer.insert(this->buffer.end(), other.buffer.begin(), other.buffer.end());
+        this->buffered += other.total + other.buffered;
+        this->lowest = std::min(this->lowest, other.lowest);
+        this->highest = std::max(this->highest, other.highest);
+        this->compress();
+    }
+
+    void TDigest::compress()
+    {
+        if (this->buffer.empty()) return;
+        std::vector<Centroid> clusters = std::move(this->centroids);
+        clusters.insert(clusters.end(), this->buffer.begin(), this->buffer.end());
+        this->total += this->buffered;
+        this->centroids = this->merged(std::move(clusters), this->total);
+        this->buffer.clear();
+        this->buffered = 0.0;
+    }
+
+    std::vector<TDigest::Centroid> TDigest::merged(std::vector<Centroid> clusters, const double weight) const
+    {
+        std::ranges::sort(clusters, {}, &Centroid::mean);
+
+        // k(q) = delta / Z * log(q / (1 - q)), Z = 4 log(n / delta) + 24: neighbours merge while the cluster spans at
+        // most one unit of k. k is infinite at both ends, so the extreme values always stay clusters of their own.
+        const double normalizer = 4.0 * std::log(std::max(weight / this->compression, 1.0)) + 24.0;
+        const auto k = [&](const double q) { return this->compression / normalizer * std::log(q / (1.0 - q)); };
+
+        std::vector<Centroid> out;
+        out.reserve(static_cast<size_t>(this->compression) + 8);
+        Centroid current = clusters.front();
+        double before = 0.0;  // weight of the clusters already emitted
+        double k_left = k(0.0);
+        for (size_t i = 1; i < clusters.size(); ++i)
+        {
+            const Centroid& next = clusters[i];
+            if (k((before + current.weight + next.weight) / weight) - k_left <= 1.0)
+            {
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            }
+            else
+            {
+                out.push_back(current);
+                before += current.weight;
+                k_left = k(before / weight);
+                current = next;
+            }
+        }
+        out.push_back(current);
+        return out;
+    }
+
+    std::vector<double> TDigest::save() const
+    {
+        std::vector<double> state = {this->compression, this->lowest, this->highest};
+        std::vector<Centroid> clusters = this->centroids;
+        clusters.insert(clusters.end(), this->buffer.begin(), this->buffer.end());
+        for (const auto& [mean, weight] : clusters)
+        {
+            state.push_back(mean);
+            state.push_back(weight);
+        }
+        return state;
+    }
+
+    TDigest TDigest::load(const std::span<const double> state)
+    {
+        if (state.size() < 3 || state.size() % 2 == 0) throw std::invalid_argument("Not a saved TDigest state...");
+        TDigest digest(state[0]);
+        for (size_t i = 3; i < state.size(); i += 2)
+        {
+            if (!std::isfinite(state[i]) || !(state[i + 1] > 0.0)) throw std::invalid_argument("Not a saved TDigest state...");
+            digest.buffer.push_back({state[i], state[i + 1]});
+            digest.buffered += state[i + 1];
+        }
+        digest.lowest = state[1];
+        digest.highest = state[2];
+        digest.compress();
+        return digest;
+    }
+
+    double TDigest::quantile(const double q) const
+    {
+        const double weight = this->total + this->buffered;
+        if (weight == 0.0 || std::isnan(q)) return std::numeric_limits<double>::quiet_NaN();
+        if (q <= 0.0) return this->lowest;
+        if (q >= 1.0) return this->highest;
+
+        const std::vector<Centroid> unbuffered = [&]
+        {
+            if (this->buffer.empty()) return this->centroids;
+            std::vector<Centroid> clusters = this->centroids;
+            clusters.insert(clusters.end(), this->buffer.begin(), this->buffer.end());
+            return this->merged(std::move(clusters), weight);
+        }();
+        const std::vector<Centroid>& c = unbuffered;
+        if (c.size() == 1) return c.front().mean;
+
+        // Each cluster's mean sits at the middle of its weight; interpolate between those, and out to min/max
+        const double target = q * weight;
+        const double first_half = 0.5 * c.front().weight;
+        if (target < first_half) return this->lowest + (c.front().mean - this->lowest) * target / first_half;
+
+        double position = first_half;
+        for (size_t i = 0; i + 1 < c.size(); ++i)
+        {
+            const double gap = 0.5 * (c[i].weight + c[i + 1].weight);
+            if (target <= position + gap) return c[i].mean + (c[i + 1].mean - c[i].mean) * (target - position) / gap;
+            position += gap;
+        }
+        const double last_half = 0.5 * c.back().weight;
+        return c.back().mean + (this->highest - c.back().mean) * std::min(1.0, (target - position) / last_half);
+    }
+
+#pragma endregion
+
+    // ==========================================================
+    //  Covariance
+    // ==========================================================
+#pragma region Covariance
+
+    Covariance::Covariance(const size_t dimension) : means(dimension, 0.0), comoments(dimension * dimension, 0.0)
+    {
+        if (dimension == 0) throw std::invalid_argument("Covariance needs at least one dimension...");
+    }
+
+    void Covariance::add(const std::span<const double> x)
+    {
+        const size_t d = this->dimension();
+        if (x.size() != d) throw std::invalid_argument("Covariance sample has the wrong dimension...");
+        if (!std::ranges::all_of(x, [](const double v) { return std::isfinite(v); })) return;
+
+        ++this->n;
+        // C_ij += (x_i - old mean_i)(x_j - new mean_j) = (x_i - old mean_i)(x_j - old mean_j)(n - 1)/n
+        const double inverse_n = 1.0 / static_cast<double>(this->n);
+        const double shrink = 1.0 - inverse_n;
+        for (size_t i = 0; i < d; ++i)
+        {
+            const double deviation = (x[i] - this->means[i]) * shrink;
+            for (size_t j = i; j < d; ++j) this->comoments[i * d + j] += deviation * (x[j] - this->means[j]);
+        }
+        for (size_t i = 0; i < d; ++i) this->means[i] += (x[i] - this->means[i]) * inverse_n;
+    }
+
+    void Covariance::merge(const Covariance& other)
+    {
+        const size_t d = this->dimension();
+        if (other.dimension() != d) throw std::invalid_argument("Cannot merge covariances of different dimensions...");
+        if (other.n == 0) return;
+        if (this->n == 0)
+        {
+            *this = other;
+            return;
+        }
+        const double n_a = static_cast<double>(this->n), n_b = static_cast<double>(other.n);
+        const double n = n_a + n_b;
+        for (size_t i = 0; i < d; ++i)
+            for (size_t j = i; j < d; ++j)
+            {
+                const double delta_i = other.means[i] - this->means[i];
+                const double delta_j = other.means[j] - this->means[j];
+                this->comoments[i * d + j] += other.comoments[i * d + j] + delta_i * delta_j * n_a * n_b / n;
+            }
+        for (size_t i = 0; i < d; ++i) this->means[i] += (other.means[i] - this->means[i]) * n_b / n;
+        this->n += other.n;
+    }
+
+    std::vector<double> Covariance::save() const
+    {
+        std::vector<double> state = {static_cast<double>(this->dimension()), static_cast<double>(this->n)};
+        state.insert(state.end(), this->means.begin(), this->means.end());
+        state.insert(state.end(), this->comoments.begin(), this->comoments.end());
+        return state;
+    }
+
+    Covariance Covariance::load(const std::span<const double> state)
+    {
+        if (state.size() < 2 || !is_count(state[0]) || !is_count(state[1]) || state[0] == 0.0) throw std::invalid_argument("Not a saved Covariance state...");
+        const size_t d = static_cast<size_t>(state[0]);
+        if (state.size() != 2 + d + d * d) throw std::invalid_argument("Not a saved Covariance state...");
+
+        Covariance covariance(d);
+        covariance.n = static_cast<std::uint64_t>(state[1]);
+        std::copy_n(state.begin() + 2, d, covariance.means.begin());
+        std::copy_n(state.begin() + 2 + static_cast<std::ptrdiff_t>(d), d * d, covariance.comoments.begin());
+        return covariance;
+    }
+
+    double Covariance::mean(const size_t i) const
+    {
+        return this->n > 0 ? this->means.at(i) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double Covariance::covariance(const size_t i, const size_t j) const
+    {
+        const size_t d = this->dimension();
+        if (i >= d || j >= d) throw std::out_of_range("Covariance index out of range...");
+        if (this->n < 2) return std::numeric_limits<double>::quiet_NaN();
+        return this->comoments[std::min(i, j) * d + std::max(i, j)] / static_cast<double>(this->n - 1);
+    }
+
+    double Covariance::correlation(const size_t i, const size_t j) const
+    {
+        return this->covariance(i, j) / std::sqrt(this->covariance(i, i) * this->covariance(j, j));
+    }
+
+    std::vector<double> Covariance::matrix() const
+    {
+        const size_t d = this->dimension();
+        std::vector<double> out(d * d);
+        for (size_t i = 0; i < d; ++i)
+            for (size_t j = 0; j < d; ++j) out[i * d + j] = this->covariance(i, j);
+        return out;
+    }
+
+#pragma endregion
+
+    // ==========================================================
+    //  Histogram
+    // ==========================================================
+#pragma region Histogram
+
+    Histogram::Histogram(const double low, const double high, const size_t bins) : lower(low), upper(high), bins(bins, 0)
+    {
+        if (!std::isfinite(low) || !std::isfinite(high) || !(low < high) || bins == 0)
+            throw std::invalid_argument("Histogram needs finite low < high and at least one bin...");
+    }
+
+    void Histogram::add(const double x)
+    {
+        if (std::isnan(x)) return;
+        if (x < this->lower) ++this->below;
+        else if (x >= this->upper) ++this->above;
+        else
+        {
+            const double position = (x - this->lower) / (this->upper - this->lower) * static_cast<double>(this->bins.size());
+            ++this->bins[std::min(static_cast<size_t>(position), this->bins.size() - 1)];
+        }
+    }
+
+    void Histogram::merge(const Histogram& other)
+    {
+        if (other.lower != this->lower || other.upper != this->upper || other.bins.size() != this->bins.size())
+            throw std::invalid_argument("Cannot merge histograms with different bins...");
+        for (size_t i = 0; i < this->bins.size(); ++i) this->bins[i] += other.bins[i];
+        this->below += other.below;
+        this->above += other.above;
+    }
+
+    std::vector<double> Histogram::save() const
+    {
+        std::vector<double> state = {this->lower, this->upper, static_cast<double>(this->bins.size()), static_cast<double>(this->below), static_cast<double>(this->above)};
+        for (const std::uint64_t count : this->bins) state.push_back(static_cast<double>(count));
+        return state;
+    }
+
+    Histogram Histogram::load(const std::span<const double> state)
+    {
+        if (state.size() < 5 || !is_count(state[2]) || state.size() != 5 + static_cast<size_t>(state[2]) ||
+            !std::all_of(state.begin() + 3, state.end(), is_count))
+            throw std::invalid_argument("Not a saved Histogram state...");
+
+        Histogram histogram(state[0], state[1], static_cast<size_t>(state[2]));
+        histogram.below = static_cast<std::uint64_t>(state[3]);
+        histogram.above = static_cast<std::uint64_t>(state[4]);
+        for (size_t i = 0; i < histogram.bins.size(); ++i) histogram.bins[i] = static_cast<std::uint64_t>(state[5 + i]);
+        return histogram;
+    }
+
+    std::uint64_t Histogram::count() const
+    {
+        std::uint64_t total = this->below + this->above;
+        for (const std::uint64_t count : this->bins) total += count;
+        return total;
+    }
+
+    double Histogram::quantile(const double q) const
+    {
+        const std::uint64_t total = this->count();
+        if (total == 0 || !(q >= 0.0 && q <= 1.0)) return std::numeric_limits<double>::quiet_NaN();
+
+        const double target = q * static_cast<double>(total);
+        double position = static_cast<double>(this->below);
+        if (target < position || (this->below > 0 && target == 0.0)) return std::numeric_limits<double>::quiet_NaN();
+
+        const double width = (this->upper - this->lower) / static_cast<double>(this->bins.size());
+        for (size_t i = 0; i < this->bins.size(); ++i)
+        {
+            const double count = static_cast<double>(this->bins[i]);
+            if (count > 0.0 && target <= position + count) return this->lower + width * (static_cast<double>(i) + (target - position) / count);
+            position += count;
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+#pragma endregion
+} // namespace logngine::uncertainty
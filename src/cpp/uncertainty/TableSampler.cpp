@@ -0,0 +1,33 @@
+#include <logngine/uncertainty/TableSampler.h>
+#include <logngine/uncertainty/Distribution.h>
+#include <stdexcept>
+
+namespace logngine::uncertainty
+{
+    TableSampler::TableSampler(const thermo::RectilinearTable& table, const std::uint64_t seed) : table(table), generator(seed)
+    {
+        if (!table.uncertain()) throw std::invalid_argument("Table has no uncertainties to sample...");
+    }
+
+    std::optional<thermo::ThermoState> TableSampler::interpolate(const std::uint64_t sample, const double pressure, const double temperature) const
+    {
+        auto state = this->table.interpolate(pressure, temperature);
+        if (!state) return std::nullopt;
+
+        // The interpolant is linear in the row values, so shifting the rows shifts it by the weighted shifts
+        const auto [rows, weights] = *this->table.corners(pressure, temperature);
+        const auto sigmas = this->table.uncertainties();
+        for (size_t k = 0; k < rows.size(); ++k)
+        {
+            if (weights[k] == 0.0) continue;
+            const thermo::ThermoState& sigma = sigmas[rows[k]];
+            const auto u01 = this->generator.pair(sample, 2 * static_cast<std::uint64_t>(rows[k]));
+            const auto u23 = this->generator.pair(sample, 2 * static_cast<std::uint64_t>(rows[k]) + 1);
+            state->specific_volume += weights[k] * sigma.specific_volume * standard_normal_quantile(u01[0]);
+            state->specific_internal_energy += weights[k] * sigma.specific_internal_energy * standard_normal_quantile(u01[1]);
+            state->specific_enthalpy += weights[k] * sigma.specific_enthalpy * standard_normal_quantile(u23[0]);
+            state->specific_entropy += weights[k] * sigma.specific_entropy * standard_normal_quantile(u23[1]);
+        }
+        return state;
+    }
+} // namespace logngine::uncertainty
@@ -1,2 +1,20 @@
 from ._core import _thermo_core as _c
-def hello_world(): return _c.hello()
\ No newline at end of file
+def hello_world(): return _c.hello()
+
+ThermoState = _c.ThermoState
+ThermoGradient = _c.ThermoGradient
+UncertainState = _c.UncertainState
+RectilinearTable = _c.RectilinearTable
+LookupStats = _c.LookupStats
+UniformGrid = _c.UniformGrid
+UniformGridReport = _c.UniformGridReport
+SaturationState = _c.SaturationState
+SaturationCurve = _c.SaturationCurve
+Phase = _c.Phase
+PhaseState = _c.PhaseState
+WATER_BACKEND = _c.WATER_BACKEND
+get_state = _c.get_state
+get_state_batch = _c.get_state_batch
+water_superheated_table = _c.water_superheated_table
+water_compressed_table = _c.water_compressed_table
+water_saturation_curve = _c.water_saturation_curve
@@ -173,7 +173,7 @@ class NaiveThermodynamicTable(ABC):
     def _get_saturated_row_from_nonunique_property(self, Tsat: Optional[float] = None, Psat: Optional[float] = None) -> tuple[ThermoState, ThermoState]:
         assert (Tsat is not None) != (Psat is not None), "Must specify either Tsat or Psat for TableBase._get_saturated_row_from_nonunique_property(...)"
         saturated_value = Tsat if Tsat is not None else Psat
-        saturated_property = 'temperature' if Tsat is not None else Psat
+        saturated_property = 'temperature' if Tsat is not None else 'pressure'
 
         tightest_lower_bound: Optional[tuple[ThermoState, ThermoState]] = None
         tightest_upper_bound: Optional[tuple[ThermoState, ThermoState]] = None
@@ -1,2 +1,17 @@
+from .. import thermo as _thermo  # registers the table types `TableSampler` takes
 from ._core import _uncertainty_core as _c
-def hello_world(): return _c.hello()
\ No newline at end of file
+def hello_world(): return _c.hello()
+
+standard_normal_quantile = _c.standard_normal_quantile
+Distribution = _c.Distribution
+Sampler = _c.Sampler
+Moments = _c.Moments
+TDigest = _c.TDigest
+Covariance = _c.Covariance
+Histogram = _c.Histogram
+MonteCarlo = _c.MonteCarlo
+MonteCarloResult = _c.MonteCarloResult
+SensitivityAnalysis = _c.SensitivityAnalysis
+SensitivityResult = _c.SensitivityResult
+SobolIndex = _c.SobolIndex
+TableSampler = _c.TableSampler
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+// Minimal assertions for the C++ tests, which are plain executables run by ctest: a failed check is reported and
+// counted, and `main` returns `logngine::test::result()`.
+namespace logngine::test
+{
+    inline int failures = 0;
+
+    inline int result()
+    {
+        if (failures) std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    // Fails the whole test if it is still running after `limit`, so a deadlock reports instead of hanging.
+    inline void watchdog(const std::chrono::seconds limit)
+    {
+        std::thread([limit]
+        {
+            std::this_thread::sleep_for(limit);
+            std::fprintf(stderr, "Test did not finish within %lld s\n", static_cast<long long>(limit.count()));
+            std::_Exit(EXIT_FAILURE);
+        }).detach();
+    }
+}
+
+#define CHECK(condition)                                                                               \
+    do                                                                                                 \
+    {                                                                                                  \
+        if (!(condition))                                                                              \
+        {                                                                                              \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);         \
+            ++logngine::test::failures;                                                                \
+        }                                                                                              \
+    } while (false)
@@ -0,0 +1,23 @@
+"""Bakes every dataset with `--emit-binary` into the directory given, rather than into the source tree."""
+from pathlib import Path
+import sys
+
+ROOT = Path(__file__).resolve().parents[2]          # project root
+sys.path.append(str(ROOT))
+
+SKIPPED = 77  # ctest's SKIP_RETURN_CODE for this test
+
+if __name__ == '__main__':
+    out = Path(sys.argv[1]).resolve()
+    try:
+        from tools.DatasetBaker import DatasetBaker
+    except ImportError as e:
+        print(f"Cannot bake the datasets: {e}")
+        sys.exit(SKIPPED)
+
+    class BuildTreeBaker(DatasetBaker):
+        OUT_PATH = out
+        CSV_PATH = out / 'csv'
+        CITATION_FILE = out / 'Citations.h'
+
+    BuildTreeBaker(emit_binary=True)
@@ -0,0 +1,142 @@
+#include "Check.h"
+#include <logngine/data/thermo/water/SuperheatedTable.h>
+#include <logngine/thermo/Water.h>
+#include <logngine/uncertainty/Measurement.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+using namespace logngine;
+using uncertainty::Measurement;
+using uncertainty::covariance;
+using uncertainty::source_id;
+
+namespace
+{
+    constexpr std::array PROPERTIES = {
+        thermo::Property::SpecificVolume, thermo::Property::SpecificInternalEnergy,
+        thermo::Property::SpecificEnthalpy, thermo::Property::SpecificEntropy,
+    };
+
+    // (pressure, temperature) inside the superheated table, in and between its blocks.
+    constexpr std::array<std::array<double, 2>, 4> POINTS = {{
+        {1.5e5, 475.0},
+        {1.0e6, 600.0},
+        {5.0e6, 700.0},
+        {2.0e5, 423.15},  // on a row
+    }};
+
+    bool close(const double a, const double b)
+    {
+        return std::abs(a - b) <= 1e-12 * std::max(std::abs(a), std::abs(b));
+    }
+
+    // With an exact lookup point, every property's uncertainty is what `interpolate<true>` propagates.
+    void exact_inputs_match_interpolate(const thermo::RectilinearTable& table)
+    {
+        for (const auto& [p, T] : POINTS)
+        {
+            const auto expected = table.interpolate<true>(p, T);
+            const auto measured = uncertainty::measure<8>(table, p, T, source_id("table"));
+            CHECK(expected.has_value() && measured.has_value());
+            if (!expected || !measured) continue;
+
+            CHECK(measured->pressure.value() == p && measured->pressure.uncertainty() == 0.0);
+            CHECK(measured->temperature.value() == T && measured->temperature.uncertainty() == 0.0);
+            for (const thermo::Property property : PROPERTIES)
+            {
+                CHECK(close(get(*measured, property).value(), get(expected->value, property)));
+                CHECK(close(get(*measured, property).uncertainty(), get(expected->sigma, property)));
+            }
+        }
+        CHECK(!uncertainty::measure<8>(table, 1e5, 1e4, source_id("table")));
+    }
+
+    void overflow_throws()
+    {
+        using M = Measurement<2>;
+        const M a = M::input(1.0, 0.1, source_id("a"));
+        const M b = M::input(2.0, 0.2, source_id("b"));
+        const M c = M::input(3.0, 0.3, source_id("c"));
+
+        // Sources already held take no more room
+        const M ab = a * b + a - b / a;
+        CHECK(ab.gradient().size() == 2);
+
+        bool thrown = false;
+        try
+        {
+            (void)(ab + c);
+        }
+        catch (const std::length_error&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+
+        // Between four corner rows, a lookup needs room for four row sources
+        const thermo::RectilinearTable table(data::thermo::water::SuperheatedTable.entries());
+        thrown = false;
+        try
+        {
+            (void)uncertainty::measure<3>(table, 1.5e5, 475.0, source_id("table"));
+        }
+        catch (const std::length_error&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    void shared_sources_correlate()
+    {
+        using M = Measurement<16>;
+        const M x = M::input(3.0, 0.5, source_id("x"));
+        const M y = M::input(4.0, 0.25, source_id("y"));
+
+        CHECK(close(covariance(x, 2.0 * x), 0.5));
+        CHECK(covariance(x, y) == 0.0);
+        CHECK(close(covariance(x + y, x - y), 0.25 - 0.0625));
+        CHECK(close(covariance(x * y, x * y), std::pow((x * y).uncertainty(), 2)));
+        CHECK((x - x).uncertainty() == 0.0);
+
+        // Two lookups in one cell share its corner rows: the covariance of a property is the sum over them of
+        // w1 * w2 * sigma^2, and nothing with another table source
+        const thermo::RectilinearTable& table = thermo::water::superheated_table();
+        const double p = 1.5e5, T1 = 475.0, T2 = 476.0;
+        const auto first = uncertainty::measure<16>(table, p, T1, source_id("table"));
+        const auto second = uncertainty::measure<16>(table, p, T2, source_id("table"));
+        const auto other = uncertainty::measure<16>(table, p, T2, source_id("another table"));
+        const auto [rows, w1] = *table.corners(p, T1);
+        const auto [rows2, w2] = *table.corners(p, T2);
+        CHECK(rows == rows2);
+        for (const thermo::Property property : PROPERTIES)
+        {
+            double expected = 0.0;
+            for (size_t i = 0; i < 4; ++i) expected += w1[i] * w2[i] * std::pow(get(table.uncertainties()[rows[i]], property), 2);
+            CHECK(expected > 0.0);
+            CHECK(close(covariance(get(*first, property), get(*second, property)), expected));
+            CHECK(covariance(get(*first, property), get(*other, property)) == 0.0);
+        }
+
+        // A measured lookup point adds its own uncertainty through the table's slopes, and correlates the properties
+        const M pressure = M::input(p, 1e3, source_id("pressure"));
+        const M temperature = M::input(T1, 0.5, source_id("temperature"));
+        const auto measured = uncertainty::measure<16>(table, pressure, temperature, source_id("table"));
+        const auto slopes = *table.differentiate(p, T1);
+        const double dh = measured->specific_enthalpy.derivative(source_id("temperature"));
+        CHECK(close(dh, 0.5 * slopes.d_dtemperature.specific_enthalpy));
+        CHECK(close(covariance(measured->specific_enthalpy, temperature), dh * 0.5));
+        CHECK(measured->specific_enthalpy.uncertainty() > first->specific_enthalpy.uncertainty());
+    }
+}
+
+int main()
+{
+    exact_inputs_match_interpolate(thermo::water::superheated_table());
+    exact_inputs_match_interpolate(thermo::RectilinearTable(data::thermo::water::SuperheatedTable.entries()));
+    overflow_throws();
+    shared_sources_correlate();
+    return logngine::test::result();
+}
@@ -0,0 +1,360 @@
+#include "Check.h"
+#include <logngine/core/RSTTree.h>
+#include <logngine/data/thermo/water/CompressedTable.h>
+#include <logngine/data/thermo/water/SaturationTable.h>
+#include <logngine/data/thermo/water/SuperheatedTable.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace logngine::core;
+using namespace logngine::data::thermo::water;
+
+namespace
+{
+    using Key = std::array<double, 6>;
+    using Entry = SuperheatedTableEntry;
+    using Tree = RSTTree<Entry, 6, 16, 16>;
+    using Frozen = RSTFrozenTree<Entry, 6, 16, 16>;
+    using Filter = std::function<bool(const Entry&)>;
+
+    // Columns of a table row, in the order DatasetBaker keys the tree on.
+    Key columns(const SuperheatedTableData& d)
+    {
+        return {d.temperature, d.pressure, d.specific_volume, d.specific_internal_energy, d.specific_enthalpy, d.specific_entropy};
+    }
+    Key columns(const CompressedTableData& d)
+    {
+        return {d.temperature, d.pressure, d.specific_volume, d.specific_internal_energy, d.specific_enthalpy, d.specific_entropy};
+    }
+    std::array<double, 10> columns(const SaturationTableData& d)
+    {
+        return {d.temperature, d.pressure, d.liquid_specific_volume, d.vapor_specific_volume,
+                d.liquid_specific_internal_energy, d.vapor_specific_internal_energy, d.liquid_specific_enthalpy,
+                d.vapor_specific_enthalpy, d.liquid_specific_entropy, d.vapor_specific_entropy};
+    }
+
+    template <typename E>
+    bool same(const E& a, const E& b)
+    {
+        return columns(a.data) == columns(b.data) && columns(a.uncertainty) == columns(b.uncertainty) && a.citation == b.citation;
+    }
+
+    template <size_t D>
+    double distance(const std::array<double, D>& a, const std::array<double, D>& b, const std::array<double, D>& scale)
+    {
+        double sum = 0.0;
+        for (size_t d = 0; d < D; ++d) sum += scale[d] * (a[d] - b[d]) * (a[d] - b[d]);
+        return sum;
+    }
+
+    // Entries nearest `key` are compared by distance, since ties may come back in any order.
+    bool agrees(const std::vector<double>& expected, const std::vector<double>& actual)
+    {
+        if (expected.size() != actual.size()) return false;
+        for (size_t i = 0; i < expected.size(); ++i)
+            if (std::abs(expected[i] - actual[i]) > 1e-12 * (1.0 + expected[i])) return false;
+        return true;
+    }
+
+    // The test data: the baked superheated table, weighted so every column spans about 1, and query points spread
+    // over (and a little beyond) its bounding box.
+    struct Fixture
+    {
+        std::vector<std::pair<Key, Entry>> entries;
+        Key scale{};
+        std::vector<Key> queries;
+
+        Fixture()
+        {
+            Key low, high;
+            low.fill(inf);
+            high.fill(-inf);
+            for (const Entry& entry : SuperheatedTable.entries())
+            {
+                const Key key = columns(entry.data);
+                entries.emplace_back(key, entry);
+                for (size_t d = 0; d < key.size(); ++d)
+                {
+                    low[d] = std::min(low[d], key[d]);
+                    high[d] = std::max(high[d], key[d]);
+                }
+            }
+            for (size_t d = 0; d < scale.size(); ++d) scale[d] = 1.0 / ((high[d] - low[d]) * (high[d] - low[d]));
+
+            std::mt19937_64 random(20240611);
+            for (int q = 0; q < 200; ++q)
+            {
+                Key key;
+                for (size_t d = 0; d < key.size(); ++d)
+                {
+                    const double margin = 0.1 * (high[d] - low[d]);
+                    key[d] = std::uniform_real_distribution(low[d] - margin, high[d] + margin)(random);
+                }
+                queries.push_back(key);
+            }
+            // Exact hits as well, some of them repeated so consecutive queries through a scratch are close
+            for (size_t i = 0; i < entries.size(); i += 7) queries.insert(queries.end(), 2, entries[i].first);
+        }
+
+        // Distances of the `k` entries nearest `key` that `accept` takes, by exhaustive search.
+        std::vector<double> brute_force(const Key& key, const size_t k, const Filter& accept = {}) const
+        {
+            std::vector<double> all;
+            for (const auto& [entry_key, entry] : entries)
+                if (!accept || accept(entry)) all.push_back(distance(key, entry_key, scale));
+            std::sort(all.begin(), all.end());
+            all.resize(std::min(k, all.size()));
+            return all;
+        }
+
+        std::vector<double> distances(const Key& key, const std::vector<Entry>& found) const
+        {
+            std::vector<double> result;
+            for (const Entry& entry : found) result.push_back(distance(key, columns(entry.data), scale));
+            return result;
+        }
+
+        std::vector<double> distances(const Key& key, std::span<const Entry* const> found) const
+        {
+            std::vector<double> result;
+            for (const Entry* entry : found) result.push_back(distance(key, columns(entry->data), scale));
+            return result;
+        }
+    };
+
+    // `tree` holds every entry of `expected`, and nothing else.
+    template <typename E, size_t D>
+    bool holds(const RSTFrozenTree<E, D, 16, 16>& tree, std::span<const E> expected)
+    {
+        if (tree.size() != expected.size()) return false;
+        std::vector<bool> seen(expected.size());
+        for (const E& entry : tree.entries())
+        {
+            const auto match = std::find_if(expected.begin(), expected.end(), [&](const E& e) { return same(e, entry); });
+            if (match == expected.end()) return false;
+            seen[static_cast<size_t>(match - expected.begin())] = true;
+        }
+        return std::all_of(seen.begin(), seen.end(), [](const bool s) { return s; });
+    }
+
+    void bulk_load_matches_insert(const Fixture& fixture)
+    {
+        const Tree packed = Tree::bulk_load(fixture.entries);
+        Tree inserted;
+        for (const auto& [key, entry] : fixture.entries) inserted.insert(key, entry);
+
+        CHECK(packed.size() == fixture.entries.size());
+        CHECK(inserted.size() == fixture.entries.size());
+        CHECK(holds(packed.freeze(), SuperheatedTable.entries()));
+        CHECK(holds(inserted.freeze(), SuperheatedTable.entries()));
+
+        for (const Key& key : fixture.queries)
+        {
+            for (const size_t k : {size_t{1}, size_t{5}, size_t{16}})
+            {
+                const std::vector<double> expected = fixture.brute_force(key, k);
+                CHECK(agrees(expected, fixture.distances(key, packed.query(key, k, fixture.scale))));
+                CHECK(agrees(expected, fixture.distances(key, inserted.query(key, k, fixture.scale))));
+            }
+        }
+    }
+
+    void k_nearest_matches_brute_force(const Fixture& fixture)
+    {
+        const Frozen frozen = Tree::bulk_load(fixture.entries).freeze();
+        for (const Key& key : fixture.queries)
+        {
+            for (const size_t k : {size_t{1}, size_t{3}, size_t{16}, size_t{40}})
+            {
+                const std::vector<double> expected = fixture.brute_force(key, k);
+                CHECK(agrees(expected, fixture.distances(key, frozen.query(key, k, fixture.scale))));
+                CHECK(agrees(expected, fixture.distances(key, SuperheatedTable.query(key, k, fixture.scale))));
+            }
+        }
+
+        // Asking for more than there is returns everything
+        const Key& key = fixture.queries.front();
+        CHECK(frozen.query(key, fixture.entries.size() + 10, fixture.scale).size() == fixture.entries.size());
+        CHECK(frozen.query(key, 0, fixture.scale).empty());
+        CHECK(Frozen().query(key, 5, fixture.scale).empty());
+    }
+
+    void query_variants_agree(const Fixture& fixture)
+    {
+        constexpr size_t K = 8;
+        const Frozen& table = SuperheatedTable;
+        const Tree tree = Tree::bulk_load(fixture.entries);
+        const auto below_1mpa = [](const Entry& entry) { return entry.data.pressure < 1e6; };
+        const Filter low_pressure = below_1mpa;
+
+        Frozen::QueryScratch scratch;
+        std::array<std::uint32_t, K> indices{};
+        std::array<const Entry*, K> pointers{};
+        for (const Key& key : fixture.queries)
+        {
+            const std::vector<double> expected = fixture.brute_force(key, K);
+            const std::vector<double> filtered = fixture.brute_force(key, K, low_pressure);
+
+            // Indices and pointers through the same scratch, which seeds each query with the previous one's leaves
+            const size_t found = table.query(key, indices, fixture.scale, scratch);
+            std::vector<Entry> by_index;
+            for (size_t i = 0; i < found; ++i) by_index.push_back(table.value(indices[i]));
+            CHECK(agrees(expected, fixture.distances(key, by_index)));
+            const size_t pointed = table.query(key, pointers, fixture.scale, scratch);
+            CHECK(agrees(expected, fixture.distances(key, std::span(pointers.data(), pointed))));
+
+            CHECK(agrees(filtered, fixture.distances(key, table.query_with_filter(key, K, low_pressure, fixture.scale))));
+            CHECK(agrees(filtered, fixture.distances(key, table.query_if(key, K, low_pressure, fixture.scale))));
+            CHECK(agrees(filtered, fixture.distances(key, tree.query_with_filter(key, K, low_pressure, fixture.scale))));
+            CHECK(agrees(filtered, fixture.distances(key, tree.query_if(key, K, low_pressure, fixture.scale))));
+            const size_t accepted = table.query_with_filter(key, pointers, low_pressure, fixture.scale, scratch);
+            CHECK(agrees(filtered, fixture.distances(key, std::span(pointers.data(), accepted))));
+            for (size_t i = 0; i < accepted; ++i) CHECK(low_pressure(*pointers[i]));
+
+            // The same filter as a lambda, which every query_if takes without type erasure
+            CHECK(agrees(filtered, fixture.distances(key, table.query_if(key, K, below_1mpa, fixture.scale))));
+            CHECK(agrees(filtered, fixture.distances(key, tree.query_if(key, K, below_1mpa, fixture.scale))));
+            CHECK(agrees(filtered, fixture.distances(key, tree.query_if(key, K, [](const Entry& entry) {
+                return entry.data.pressure < 1e6;
+            }, fixture.scale))));
+            const size_t inlined = table.query_if(key, pointers, below_1mpa, fixture.scale, scratch);
+            CHECK(agrees(filtered, fixture.distances(key, std::span(pointers.data(), inlined))));
+            const size_t indexed = table.query_if(key, indices, below_1mpa, fixture.scale, scratch);
+            CHECK(indexed == inlined);
+            for (size_t i = 0; i < indexed; ++i) CHECK(below_1mpa(table.value(indices[i])));
+        }
+
+        // Row `q` of a batch is what `query` returns for `queries[q]`, padded with nullptr
+        const std::vector<const Entry*> batch = table.query_batch(fixture.queries, K, fixture.scale);
+        CHECK(batch.size() == fixture.queries.size() * K);
+        for (size_t q = 0; q < fixture.queries.size() && batch.size() == fixture.queries.size() * K; ++q)
+        {
+            const std::span row(batch.data() + q * K, K);
+            CHECK(std::find(row.begin(), row.end(), nullptr) == row.end());
+            CHECK(agrees(fixture.brute_force(fixture.queries[q], K), fixture.distances(fixture.queries[q], row)));
+        }
+
+        const std::span few(fixture.entries.data(), 5);
+        const std::vector<const Entry*> padded = Tree::bulk_load(few).freeze().query_batch(fixture.queries, K, fixture.scale);
+        for (size_t q = 0; q < fixture.queries.size(); ++q)
+        {
+            CHECK(std::count(padded.begin() + static_cast<std::ptrdiff_t>(q * K),
+                             padded.begin() + static_cast<std::ptrdiff_t>((q + 1) * K), nullptr) == static_cast<std::ptrdiff_t>(K - few.size()));
+            CHECK(padded[q * K + few.size() - 1] != nullptr);
+        }
+    }
+
+    // A scratch that outlives its tree seeds nothing from it into another tree built in its place.
+    void scratch_outlives_its_tree(const Fixture& fixture)
+    {
+        constexpr size_t K = 4;
+        const std::span few(fixture.entries.data(), 40);
+        Frozen::QueryScratch scratch;
+        std::array<std::uint32_t, K> indices{};
+
+        std::optional<Frozen> frozen;
+        frozen.emplace(Tree::bulk_load(fixture.entries).freeze());
+        for (const Key& key : fixture.queries) frozen->query(key, indices, fixture.scale, scratch);
+
+        frozen.emplace(Tree::bulk_load(few).freeze());
+        for (const Key& key : fixture.queries)
+        {
+            std::vector<double> expected;
+            for (const auto& [entry_key, entry] : few) expected.push_back(distance(key, entry_key, fixture.scale));
+            std::sort(expected.begin(), expected.end());
+            expected.resize(K);
+
+            const size_t found = frozen->query(key, indices, fixture.scale, scratch);
+            std::vector<Entry> entries;
+            for (size_t i = 0; i < found; ++i) entries.push_back(frozen->value(indices[i]));
+            CHECK(agrees(expected, fixture.distances(key, entries)));
+        }
+    }
+
+    // `tree` as mapped from `path`: same entries in the same order, and the same answers.
+    template <typename E, size_t D>
+    void matches_mapped(const RSTFrozenTree<E, D, 16, 16>& tree, const std::filesystem::path& path)
+    {
+        const auto mapped = RSTTree<E, D, 16, 16>::open_mmap(path);
+        CHECK(mapped.size() == tree.size());
+        if (mapped.size() != tree.size()) return;
+        for (size_t i = 0; i < tree.size(); ++i) CHECK(same(mapped.entries()[i], tree.entries()[i]));
+
+        std::array<double, D> scale;
+        scale.fill(1.0);
+        for (size_t i = 0; i < tree.size(); i += 11)
+        {
+            const std::array<double, D> key = columns(tree.entries()[i].data);
+            const auto expected = tree.query(key, 4, scale);
+            const auto actual = mapped.query(key, 4, scale);
+            CHECK(actual.size() == expected.size());
+            for (size_t j = 0; j < std::min(actual.size(), expected.size()); ++j) CHECK(same(actual[j], expected[j]));
+        }
+    }
+
+    void save_round_trip(const std::filesystem::path& directory)
+    {
+        const std::filesystem::path path = directory / "test_rst_tree.rstree";
+        SuperheatedTable.save(path);
+        matches_mapped(SuperheatedTable, path);
+
+        Tree inserted;
+        for (const Entry& entry : SuperheatedTable.entries()) inserted.insert(columns(entry.data), entry);
+        const Frozen frozen = inserted.freeze();
+        frozen.save(path);
+        matches_mapped(frozen, path);
+
+        // A file of another tree type is refused
+        bool refused = false;
+        try
+        {
+            (void)RSTTree<SaturationTableEntry, 10, 16, 16>::open_mmap(path);
+        }
+        catch (const std::runtime_error&)
+        {
+            refused = true;
+        }
+        CHECK(refused);
+        std::filesystem::remove(path);
+    }
+
+    // The .rstree files `DatasetBaker --emit-binary` wrote under `directory` hold the trees baked into the headers.
+    void baked_binaries_match(const std::filesystem::path& directory)
+    {
+        const std::filesystem::path water = directory / "thermo" / "water";
+        if (!std::filesystem::exists(water / "SuperheatedTable.rstree"))
+        {
+            std::fprintf(stderr, "No DatasetBaker output in %s; skipping the comparison with it\n", directory.string().c_str());
+            return;
+        }
+        matches_mapped(SaturationTable, water / "SaturationTable.rstree");
+        matches_mapped(CompressedTable, water / "CompressedTable.rstree");
+        matches_mapped(SuperheatedTable, water / "SuperheatedTable.rstree");
+    }
+}
+
+int main()
+{
+    logngine::test::watchdog(std::chrono::seconds(100));
+
+    const Fixture fixture;
+    CHECK(!fixture.entries.empty());
+    bulk_load_matches_insert(fixture);
+    k_nearest_matches_brute_force(fixture);
+    query_variants_agree(fixture);
+    scratch_outlives_its_tree(fixture);
+    save_round_trip(std::filesystem::temp_directory_path());
+    // Set by ctest once bake_tables has run
+    if (const char* baked = std::getenv("LOGNGINE_BAKED_DIR")) baked_binaries_match(baked);
+    return logngine::test::result();
+}
@@ -0,0 +1,221 @@
+#include "Check.h"
+#include <logngine/core/RSTTree.h>
+#include <logngine/data/thermo/water/SuperheatedTable.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace logngine::core;
+using namespace logngine::data::thermo::water;
+
+namespace
+{
+    // Any of the baked entry types will do; the entries' citation serves as their id.
+    using Key = std::array<double, 6>;
+    using Entry = SuperheatedTableEntry;
+    using Tree = RSTTree<Entry, 6, 16, 16>;
+    using Filter = std::function<bool(const Entry&)>;
+
+    constexpr size_t CAPACITY = 16;
+    constexpr size_t MIN_FILL = static_cast<size_t>(Tree::MIN_SPLIT * CAPACITY);
+
+    Key columns(const SuperheatedTableData& d)
+    {
+        return {d.temperature, d.pressure, d.specific_volume, d.specific_internal_energy, d.specific_enthalpy, d.specific_entropy};
+    }
+
+    Entry make_entry(const Key& key, const unsigned id)
+    {
+        return {{key[0], key[1], key[2], key[3], key[4], key[5]}, {}, id};
+    }
+
+    double distance(const Key& a, const Key& b)
+    {
+        double sum = 0.0;
+        for (size_t d = 0; d < a.size(); ++d) sum += (a[d] - b[d]) * (a[d] - b[d]);
+        return sum;
+    }
+
+    // A random sequence of edits applied to a tree and, by id, to a map of what it should hold.
+    struct Sequence
+    {
+        std::mt19937_64 random;
+        Tree tree;
+        std::map<unsigned, Key> live;
+        unsigned next = 0;
+        bool bulk_loaded = false;
+
+        Sequence(const unsigned seed, const size_t bulk) : random(seed)
+        {
+            if (bulk == 0) return;
+            std::vector<std::pair<Key, Entry>> entries;
+            for (size_t i = 0; i < bulk; ++i)
+            {
+                const Key key = this->key();
+                entries.emplace_back(key, make_entry(key, next));
+                live[next++] = key;
+            }
+            tree = Tree::bulk_load(entries);
+            bulk_loaded = true;
+        }
+
+        // On a coarse grid, so that some entries share a key.
+        Key key()
+        {
+            Key key;
+            for (double& x : key) x = static_cast<double>(random() % 8) / 8.0;
+            return key;
+        }
+
+        std::map<unsigned, Key>::iterator pick()
+        {
+            auto it = live.begin();
+            std::advance(it, static_cast<std::ptrdiff_t>(random() % live.size()));
+            return it;
+        }
+
+        void insert()
+        {
+            const Key key = this->key();
+            tree.insert(key, make_entry(key, next));
+            live[next++] = key;
+        }
+
+        void erase_one()
+        {
+            const auto it = pick();
+            const unsigned id = it->first;
+            CHECK(tree.erase(it->second, [id](const Entry& entry) { return entry.citation == id; }) == 1);
+            live.erase(it);
+        }
+
+        // Every entry at one key goes at once.
+        void erase_all_at()
+        {
+            const Key key = pick()->second;
+            size_t expected = 0;
+            for (auto it = live.begin(); it != live.end();)
+            {
+                if (it->second == key)
+                {
+                    it = live.erase(it);
+                    ++expected;
+                }
+                else ++it;
+            }
+            CHECK(tree.erase(key) == expected);
+            CHECK(tree.erase(key) == 0);
+        }
+
+        // To somewhere else, a hair away (which usually stays within the leaf), or nowhere.
+        void update()
+        {
+            const auto it = pick();
+            const unsigned id = it->first;
+            Key moved = it->second;
+            switch (random() % 3)
+            {
+                case 0: moved = key(); break;
+                case 1: moved[random() % moved.size()] += 1e-3; break;
+                default: break;
+            }
+            const auto has_id = [id](const Entry& entry) { return entry.citation == id; };
+            CHECK(tree.update(it->second, has_id, moved, make_entry(moved, id)));
+            it->second = moved;
+
+            const Filter nobody = [](const Entry&) { return false; };
+            CHECK(!tree.update(moved, nobody, moved, make_entry(moved, id)));
+        }
+
+        void step()
+        {
+            const auto op = random() % 20;
+            if (op < 9 || live.empty()) insert();
+            else if (op < 14) erase_one();
+            else if (op < 15) erase_all_at();
+            else update();
+        }
+
+        // The invariants every edit keeps, and k-NN answers against exhaustive search.
+        void check()
+        {
+            const RSTTreeShape shape = tree.shape();
+            CHECK(tree.size() == live.size());
+            CHECK(shape.entries == live.size());
+            CHECK(tree.empty() == live.empty());
+            CHECK(shape.tight);
+            if (!live.empty())
+            {
+                CHECK(shape.min_leaf_depth == tree.height());
+                CHECK(shape.max_leaf_depth == tree.height());
+            }
+            if (tree.height() > 0)
+            {
+                CHECK(shape.max_leaf_fill <= CAPACITY);
+                // Sort-Tile-Recursive packing leaves the last node of each run short, and nothing refills it
+                if (!bulk_loaded) CHECK(shape.min_leaf_fill >= MIN_FILL);
+            }
+            if (tree.height() > 1)
+            {
+                CHECK(shape.max_internal_fill <= CAPACITY);
+                if (!bulk_loaded) CHECK(shape.min_internal_fill >= MIN_FILL);
+            }
+
+            Key scale;
+            scale.fill(1.0);
+            const Key query = key();
+            constexpr size_t K = 5;
+            std::vector<double> expected;
+            for (const auto& [id, key] : live) expected.push_back(distance(query, key));
+            std::sort(expected.begin(), expected.end());
+            expected.resize(std::min(K, expected.size()));
+
+            const std::vector<Entry> found = tree.query(query, K, scale);
+            CHECK(found.size() == expected.size());
+            for (size_t i = 0; i < std::min(found.size(), expected.size()); ++i)
+            {
+                // What is found is live, where it was last put
+                const auto it = live.find(found[i].citation);
+                CHECK(it != live.end() && it->second == columns(found[i].data));
+                CHECK(std::abs(distance(query, columns(found[i].data)) - expected[i]) <= 1e-12);
+            }
+        }
+    };
+
+    void random_edits(const unsigned seed, const size_t bulk, const int steps)
+    {
+        Sequence sequence(seed, bulk);
+        sequence.check();
+        for (int step = 0; step < steps; ++step)
+        {
+            sequence.step();
+            sequence.check();
+        }
+        CHECK(sequence.tree.height() > 1);
+
+        // Erased down to nothing, the tree is as good as new
+        while (!sequence.live.empty())
+        {
+            sequence.erase_one();
+            sequence.check();
+        }
+        CHECK(sequence.tree.height() == 0);
+        sequence.insert();
+        sequence.check();
+    }
+}
+
+int main()
+{
+    logngine::test::watchdog(std::chrono::seconds(100));
+
+    random_edits(1, 0, 3000);
+    random_edits(2, 0, 3000);
+    random_edits(3, 600, 2000);
+    return logngine::test::result();
+}
@@ -0,0 +1,103 @@
+#include "Check.h"
+#include <logngine/core/ThreadPool.h>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using logngine::core::ThreadPool;
+
+namespace
+{
+    // Sum of [0, count) by a `parallel_for` on `pool`, in chunks of `grain`.
+    size_t parallel_sum(ThreadPool& pool, const size_t count, const size_t grain)
+    {
+        std::atomic<size_t> sum = 0;
+        pool.parallel_for(count, grain, [&](const size_t begin, const size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i) sum += i;
+        });
+        return sum;
+    }
+
+    void nested_on_caller_only(ThreadPool& pool)
+    {
+        // Only the chunks the calling thread runs nest, which used to lock `job_mutex` twice on that thread
+        const auto caller = std::this_thread::get_id();
+        for (int run = 0; run < 20; ++run)
+        {
+            std::atomic<size_t> nested = 0;
+            pool.parallel_for(64, 1, [&](size_t, size_t, size_t)
+            {
+                // Slow enough chunks that the caller gets its share
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                if (std::this_thread::get_id() == caller && parallel_sum(pool, 100, 10) == 4950) ++nested;
+            });
+            CHECK(nested > 0);
+        }
+    }
+
+    void nested_everywhere(ThreadPool& pool)
+    {
+        for (int run = 0; run < 20; ++run)
+        {
+            std::vector<size_t> sums(64);
+            std::atomic<bool> workers_in_range = true;
+            pool.parallel_for(sums.size(), 1, [&](const size_t begin, const size_t end, size_t)
+            {
+                for (size_t i = begin; i < end; ++i) sums[i] = parallel_sum(pool, 100 + i, 7);
+                pool.parallel_for(8, 1, [&](size_t, size_t, const size_t worker)
+                {
+                    if (worker >= pool.concurrency()) workers_in_range = false;
+                });
+            });
+            for (size_t i = 0; i < sums.size(); ++i) CHECK(sums[i] == (100 + i) * (99 + i) / 2);
+            CHECK(workers_in_range);
+        }
+    }
+
+    void nested_exception(ThreadPool& pool)
+    {
+        bool thrown = false;
+        try
+        {
+            pool.parallel_for(16, 1, [&](const size_t begin, size_t, size_t)
+            {
+                pool.parallel_for(4, 1, [&](size_t, size_t, size_t)
+                {
+                    if (begin == 5) throw std::runtime_error("nested");
+                });
+            });
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+
+        // The pool, and this thread's place in it, recover for the next call
+        CHECK(parallel_sum(pool, 1000, 16) == 499500);
+    }
+}
+
+int main()
+{
+    logngine::test::watchdog(std::chrono::seconds(60));
+
+    ThreadPool pool(4);
+    CHECK(pool.concurrency() == 4);
+    CHECK(parallel_sum(pool, 1000, 16) == 499500);
+    nested_on_caller_only(pool);
+    nested_everywhere(pool);
+    nested_exception(pool);
+
+    ThreadPool serial(1);
+    CHECK(parallel_sum(serial, 1000, 16) == 499500);
+    nested_everywhere(serial);
+
+    // Once adopted (as the Python extensions adopt `_core_core`'s), a pool is the one `shared()` returns
+    ThreadPool::adopt_shared(pool);
+    CHECK(&ThreadPool::shared() == &pool);
+    nested_everywhere(ThreadPool::shared());
+    return logngine::test::result();
+}
@@ -0,0 +1,186 @@
+import pytest
+
+from logngine import thermo
+
+
+def test_superheated_grid_point():
+    """Lookups on a grid point return the tabulated row (Cengel A-6, 0.01 MPa and 100 C)."""
+    state = thermo.water_superheated_table().interpolate(pressure=10_000.0, temperature=373.15)
+    assert state.specific_volume == pytest.approx(17.196)
+    assert state.specific_enthalpy == pytest.approx(2687.5e3)
+
+
+def test_superheated_interpolates_between_rows():
+    """The baked spline is monotone, and close to linear where the data is (v of a near-ideal gas)."""
+    state = thermo.water_superheated_table().interpolate(pressure=10_000.0, temperature=398.15)
+    assert state.temperature == pytest.approx(398.15)
+    assert 17.196 < state.specific_volume < 19.513
+    assert state.specific_volume == pytest.approx(0.5 * (17.196 + 19.513), rel=1e-3)
+
+
+def test_compressed_interpolates_between_blocks():
+    table = thermo.water_compressed_table()
+    p0, p1 = [p for p in table.pressures if 4e6 < p < 8e6][:2]
+    low, high = table.interpolate(p0, 293.15), table.interpolate(p1, 293.15)
+    mid = table.interpolate(0.5 * (p0 + p1), 293.15)
+    assert mid.pressure == pytest.approx(0.5 * (p0 + p1))
+    assert min(low.specific_volume, high.specific_volume) <= mid.specific_volume <= max(low.specific_volume, high.specific_volume)
+
+
+def test_spline_gradient_is_continuous_across_blocks():
+    table = thermo.water_superheated_table()
+    block = [p for p in table.pressures if p > 5e6][0]
+    below, above = table.differentiate(block * (1 - 1e-9), 700.0), table.differentiate(block * (1 + 1e-9), 700.0)
+    assert below.d_dpressure.specific_enthalpy == pytest.approx(above.d_dpressure.specific_enthalpy, rel=1e-4)
+    assert below.d_dtemperature.specific_enthalpy == pytest.approx(above.d_dtemperature.specific_enthalpy, rel=1e-4)
+    assert below.d_dtemperature.temperature == 1.0
+
+
+def test_interpolation_propagates_row_uncertainties():
+    table = thermo.water_superheated_table()
+    assert table.uncertain
+    on_row = table.interpolate_with_uncertainty(10_000.0, 373.15)
+    assert on_row.value.specific_volume == pytest.approx(17.196)
+    assert on_row.sigma.specific_volume > 0.0
+    assert on_row.sigma.temperature == 0.0
+
+    between = table.interpolate_with_uncertainty(12_000.0, 398.15)
+    assert between.value.specific_enthalpy == table.interpolate(12_000.0, 398.15).specific_enthalpy
+    assert 0.0 < between.sigma.specific_enthalpy < float("inf")
+
+
+def test_out_of_table_is_none():
+    table = thermo.water_superheated_table()
+    assert table.interpolate(pressure=1.0, temperature=400.0) is None
+    assert table.interpolate(pressure=10_000.0, temperature=1e5) is None
+
+
+def test_repeated_lookups_hit_the_warm_start_cache():
+    table = thermo.water_superheated_table()
+    table.interpolate(10_000.0, 398.15)
+    thermo.RectilinearTable.reset_lookup_stats()
+    for step in range(10):
+        assert table.interpolate(10_000.0, 398.15 + 0.1 * step) is not None
+    stats = thermo.RectilinearTable.lookup_stats()
+    assert stats.misses == 0
+    assert stats.hits > 0
+
+
+def test_uniform_grid_matches_its_table_and_reports_its_cost():
+    table = thermo.water_superheated_table()
+    grid = thermo.UniformGrid(table, pressure_range=(1e6, 2e6), temperature_range=(600.0, 800.0), shape=(11, 201))
+    assert grid.report.bytes == 11 * 201 * 32
+    assert grid.report.missing_nodes == 0
+    state = grid.interpolate(1.55e6, 700.5)
+    assert state.pressure == 1.55e6
+    assert state.specific_enthalpy == pytest.approx(table.interpolate(1.55e6, 700.5).specific_enthalpy, rel=grid.report.max_relative_error.specific_enthalpy + 1e-12)
+    assert grid.interpolate(2.5e6, 700.0) is None
+
+
+def test_saturation_grid_point():
+    """Cengel A-4 at 100 C: Psat = 101.42 kPa, v_g = 1.6720 m^3/kg."""
+    state = thermo.water_saturation_curve().at_temperature(373.15)
+    assert state.vapor.pressure == pytest.approx(101_420.0, rel=1e-4)
+    assert state.vapor.specific_volume == pytest.approx(1.6720, rel=1e-3)
+    assert state.liquid.temperature == state.vapor.temperature == 373.15
+
+
+def test_saturation_pressure_and_temperature_agree():
+    curve = thermo.water_saturation_curve()
+    for temperature in (280.0, 300.0, 400.0, 500.0, 600.0):
+        pressure = curve.at_temperature(temperature).liquid.pressure
+        assert curve.at_pressure(pressure).liquid.temperature == pytest.approx(temperature, abs=0.05)
+
+
+def test_saturation_mixture_and_bounds():
+    curve = thermo.water_saturation_curve()
+    state = curve.at_pressure(101_325.0)
+    mixture = state.mixture(0.25)
+    assert mixture.specific_enthalpy == pytest.approx(
+        0.75 * state.liquid.specific_enthalpy + 0.25 * state.vapor.specific_enthalpy)
+    assert curve.at_temperature(200.0) is None
+    assert curve.at_pressure(1e9) is None
+
+
+def test_get_state_batch_matches_single_lookups():
+    import numpy as np
+
+    pressure = np.array([1e5, 1e7, 101_325.0, 1.0])
+    temperature = np.array([473.15, 373.15, 400.0, 300.0])
+    states = thermo.get_state_batch(pressure, temperature)
+
+    assert states.shape == (4,)
+    assert list(states["phase"]) == [int(thermo.Phase.SUPERHEATED), int(thermo.Phase.COMPRESSED),
+                                     int(thermo.Phase.SUPERHEATED), int(thermo.Phase.OUT_OF_RANGE)]
+    expected = thermo.water_superheated_table().interpolate(1e5, 473.15)
+    assert states["specific_enthalpy"][0] == pytest.approx(expected.specific_enthalpy)
+    assert np.isnan(states["quality"][:3]).all()
+
+
+def test_get_state_batch_in_the_dome():
+    import numpy as np
+
+    states = thermo.get_state_batch(np.array([[101_325.0]]), np.array([[1.5e6]]), which=("pressure", "specific_enthalpy"))
+    assert states.shape == (1, 1)
+    assert states["phase"][0, 0] == int(thermo.Phase.SATURATED)
+    assert 0.0 < states["quality"][0, 0] < 1.0
+    with pytest.raises(ValueError):
+        thermo.get_state_batch(np.zeros(2), np.zeros(3))
+
+
+def test_phase_either_side_of_the_dome():
+    """Tsat(10 MPa) = 584.15 K: just below it is compressed liquid, just above it superheated vapor."""
+    assert thermo.get_state(10e6, 580.0, backend="tables").phase == thermo.Phase.COMPRESSED
+    assert thermo.get_state(10e6, 590.0, backend="tables").phase == thermo.Phase.SUPERHEATED
+
+
+def test_supercritical_phase_follows_the_critical_temperature():
+    """Above the critical pressure there is no dome; the side of Tc = 647.1 K picks the table."""
+    assert thermo.get_state(30e6, 700.0, backend="tables").phase == thermo.Phase.SUPERHEATED
+    assert thermo.get_state(30e6, 500.0, backend="tables").phase == thermo.Phase.COMPRESSED
+
+
+def test_below_saturation_outside_the_compressed_table_is_out_of_range():
+    """At 15.4 MPa, 616.5 K is below Tsat but past the end of the 15 MPa compressed block. The superheated blocks
+    around it reach that far, so it used to come back as superheated vapor."""
+    import numpy as np
+
+    assert 616.5 < thermo.water_saturation_curve().at_pressure(15.4e6).liquid.temperature
+    assert thermo.get_state(15.4e6, 616.5, backend="tables").phase == thermo.Phase.OUT_OF_RANGE
+    states = thermo.get_state_batch(np.array([15.4e6]), np.array([616.5]), backend="tables")
+    assert states["phase"][0] == int(thermo.Phase.OUT_OF_RANGE)
+
+
+def test_get_state_inverts_any_pair():
+    import numpy as np
+
+    reference = thermo.get_state(1e6, 600.0)
+    assert reference.phase == thermo.Phase.SUPERHEATED
+    for which in [("pressure", "specific_enthalpy"), ("pressure", "specific_entropy"), ("specific_enthalpy", "specific_entropy")]:
+        found = thermo.get_state(getattr(reference.state, which[0]), getattr(reference.state, which[1]), which=which)
+        assert found.phase == thermo.Phase.SUPERHEATED
+        assert found.state.pressure == pytest.approx(1e6, rel=1e-6)
+        assert found.state.temperature == pytest.approx(600.0, rel=1e-6)
+
+    mixture = thermo.water_saturation_curve().at_temperature(400.0).mixture(0.3)
+    states = thermo.get_state_batch(np.array([mixture.specific_enthalpy]), np.array([mixture.specific_entropy]),
+                                    which=("specific_enthalpy", "specific_entropy"))
+    assert states["phase"][0] == int(thermo.Phase.SATURATED)
+    assert states["quality"][0] == pytest.approx(0.3, rel=1e-6)
+
+
+def test_if97_backend_matches_verification_values():
+    """IAPWS-IF97 verification tables: region 1 (3 MPa, 300 K), region 2 (30 MPa, 700 K), region 5 (30 MPa, 2000 K)."""
+    liquid = thermo.get_state(3e6, 300.0, backend="if97")
+    assert liquid.phase == thermo.Phase.COMPRESSED
+    assert liquid.state.specific_volume == pytest.approx(0.100215168e-2, rel=1e-8)
+    assert liquid.state.specific_enthalpy == pytest.approx(0.115331273e6, rel=1e-8)
+    assert thermo.get_state(30e6, 700.0, backend="if97").state.specific_entropy == pytest.approx(0.517540298e4, rel=1e-8)
+
+    hot = thermo.get_state(30e6, 2000.0, backend="if97")
+    assert hot.phase == thermo.Phase.SUPERHEATED
+    assert hot.state.specific_enthalpy == pytest.approx(0.657122604e7, rel=1e-8)
+    assert thermo.get_state(30e6, 2000.0, backend="tables").phase == thermo.Phase.OUT_OF_RANGE
+
+    found = thermo.get_state(30e6, hot.state.specific_enthalpy, which=("pressure", "specific_enthalpy"), backend="if97")
+    assert found.state.temperature == pytest.approx(2000.0, rel=1e-8)
@@ -0,0 +1,136 @@
+import pytest
+
+from logngine import thermo, uncertainty
+
+
+def test_monte_carlo_linear_model_is_reproducible():
+    import numpy as np
+
+    inputs = [uncertainty.Distribution.normal(1.0, 2.0), uncertainty.Distribution.uniform(0.0, 1.0)]
+    model = lambda first, x: (x[:, 0] + 2.0 * x[:, 1])[:, np.newaxis]
+    result = uncertainty.MonteCarlo(inputs, seed=42).run(model, outputs=1, samples=200_000)
+
+    assert result.samples == 200_000
+    assert result.moments[0].mean == pytest.approx(2.0, abs=0.02)
+    assert result.moments[0].variance == pytest.approx(4.0 + 4.0 / 12.0, rel=0.02)
+    assert result.quantile(0, 0.5) == pytest.approx(2.0, abs=0.05)
+
+    again = uncertainty.MonteCarlo(inputs, seed=42).run(model, outputs=1, samples=200_000, block=1000)
+    assert again.moments[0].mean == pytest.approx(result.moments[0].mean, rel=1e-12)
+
+
+def os_threads():
+    """Threads of this process, where /proc lists them (None elsewhere)."""
+    import os
+
+    try:
+        return len(os.listdir("/proc/self/task"))
+    except FileNotFoundError:
+        return None
+
+
+def test_monte_carlo_model_can_call_batched_lookups():
+    """A model's own pooled batch calls run inline on the block's thread: every extension shares `_core_core`'s pool,
+    so the lookups neither deadlock it nor start a second one."""
+    import numpy as np
+
+    inputs = [uncertainty.Distribution.uniform(1e5, 2e5), uncertainty.Distribution.uniform(450.0, 500.0)]
+    model = lambda first, x: thermo.get_state_batch(x[:, 0], x[:, 1])["specific_enthalpy"][:, np.newaxis]
+    threads = os_threads()
+    result = uncertainty.MonteCarlo(inputs, seed=3).run(model, outputs=1, samples=16_384, block=2048)
+
+    assert os_threads() == threads
+    assert result.moments[0].count == 16_384
+    expected = thermo.water_superheated_table().interpolate(1.5e5, 475.0).specific_enthalpy
+    assert result.moments[0].mean == pytest.approx(expected, rel=2e-3)
+
+
+def test_table_sampler_spreads_as_the_propagated_uncertainty():
+    import numpy as np
+
+    table = thermo.water_superheated_table()
+    sampler = uncertainty.TableSampler(table, seed=1)
+    n = 20_000
+    states = sampler.interpolate_batch(np.arange(n), np.full(n, 12_000.0), np.full(n, 398.15))
+    expected = table.interpolate_with_uncertainty(12_000.0, 398.15)
+
+    enthalpy = states[:, 4]
+    assert enthalpy.mean() == pytest.approx(expected.value.specific_enthalpy, rel=1e-3)
+    assert enthalpy.std() == pytest.approx(expected.sigma.specific_enthalpy, rel=0.05)
+    assert sampler.interpolate(7, 12_000.0, 398.15).specific_enthalpy == enthalpy[7]
+
+
+def test_streaming_accumulators_merge_and_pickle():
+    import pickle
+    import numpy as np
+
+    rng = np.random.default_rng(0)
+    x = rng.normal(size=(10_000, 2)) @ np.array([[1.0, 0.5], [0.0, 1.0]])
+    halves = np.array_split(x, 2)
+
+    covariance = uncertainty.Covariance(2)
+    covariance.add_batch(halves[0])
+    other = uncertainty.Covariance(2)
+    other.add_batch(halves[1])
+    covariance.merge(pickle.loads(pickle.dumps(other)))
+    assert covariance.count == 10_000
+    assert covariance.matrix == pytest.approx(np.cov(x, rowvar=False), rel=1e-9)
+
+    histogram, digest, moments = uncertainty.Histogram(-5.0, 5.0, 100), uncertainty.TDigest(), uncertainty.Moments()
+    for accumulator in (histogram, digest, moments):
+        accumulator.add_batch(x[:, 0])
+    moments = pickle.loads(pickle.dumps(moments))
+    assert moments.mean == pytest.approx(x[:, 0].mean(), rel=1e-9)
+    assert moments.variance == pytest.approx(x[:, 0].var(ddof=1), rel=1e-9)
+    assert histogram.quantile(0.5) == pytest.approx(np.median(x[:, 0]), abs=0.1)
+    assert pickle.loads(pickle.dumps(digest)).quantile(0.9) == pytest.approx(np.quantile(x[:, 0], 0.9), abs=0.02)
+
+
+def test_quasi_random_samplers_beat_plain_monte_carlo():
+    import numpy as np
+
+    inputs = [uncertainty.Distribution.normal(1.0, 2.0), uncertainty.Distribution.triangular(0.0, 1.0, 3.0)]
+    model = lambda first, x: np.exp(0.1 * x[:, :1]) + x[:, 1:]
+    exact = np.exp(0.1 + 0.02) + 4.0 / 3.0
+
+    for sampler in (uncertainty.Sampler.latin_hypercube(2, 4096, seed=3), uncertainty.Sampler.sobol(2, seed=3),
+                    uncertainty.Sampler.halton(2, seed=3)):
+        result = uncertainty.MonteCarlo(inputs, sampler).run(model, outputs=1, samples=4096)
+        # Plain Monte Carlo is off by about one standard error
+        assert abs(result.moments[0].mean - exact) < result.moments[0].standard_error / 10
+
+    points = uncertainty.Sampler.latin_hypercube(3, 100, seed=1).points(0, 100)
+    assert all(len(set(np.floor(points[:, d] * 100))) == 100 for d in range(3))
+    # Seed 579 keys the permutation near 2^32, where adding it to a stratum index used to wrap
+    points = uncertainty.Sampler.latin_hypercube(1, 1_000_000, seed=579).points(0, 1_000_000)
+    assert len(np.unique(np.floor(points[:, 0] * 1_000_000))) == 1_000_000
+
+
+def test_sobol_indices_of_the_ishigami_function():
+    import numpy as np
+
+    inputs = [uncertainty.Distribution.uniform(-np.pi, np.pi)] * 3
+    model = lambda first, x: (np.sin(x[:, 0]) + 7.0 * np.sin(x[:, 1]) ** 2 + 0.1 * x[:, 2] ** 4 * np.sin(x[:, 0]))[:, np.newaxis]
+    result = uncertainty.SensitivityAnalysis(inputs, seed=1).run(model, outputs=1, samples=1 << 14)
+
+    assert result.evaluations == (1 << 14) * 5
+    for i, (first_order, total) in enumerate([(0.3139, 0.5576), (0.4424, 0.4424), (0.0, 0.2437)]):
+        assert result.first_order(0, i).estimate == pytest.approx(first_order, abs=0.02)
+        assert result.total(0, i).estimate == pytest.approx(total, abs=0.02)
+        assert result.first_order(0, i).low <= result.first_order(0, i).estimate <= result.first_order(0, i).high
+
+
+def test_sobol_indices_of_a_model_calling_batched_lookups():
+    """Sensitivity analysis blocks, like Monte Carlo's, run a model's pooled batch calls inline on the shared pool."""
+    import numpy as np
+
+    inputs = [uncertainty.Distribution.uniform(1e5, 2e5), uncertainty.Distribution.uniform(450.0, 500.0)]
+    model = lambda first, x: thermo.get_state_batch(x[:, 0], x[:, 1])["specific_enthalpy"][:, np.newaxis]
+    threads = os_threads()
+    result = uncertainty.SensitivityAnalysis(inputs, seed=1).run(model, outputs=1, samples=4096, resamples=50, block=512)
+
+    assert os_threads() == threads
+    assert result.evaluations == 4096 * 4
+    # Superheated steam at low pressure: enthalpy is all temperature
+    assert result.total(0, 1).estimate == pytest.approx(1.0, abs=0.02)
+    assert result.total(0, 0).estimate < 0.02
@@ -1,13 +1,11 @@
-from pathlib import Path
-from typing import Dict, Any, List, Tuple, Iterable
-import random
+from __future__ import annotations
 
-try:
-    import numpy as np
-    from rtree import index
-    from tqdm import tqdm
-except ImportError:
-    raise ImportError("Install numpy, rtree, and tqdm: `pip install logngine[dev]`")
+import struct
+from bisect import bisect_left
+from itertools import groupby
+from math import ceil, isfinite
+from pathlib import Path
+from typing import Callable, Iterable
 
 from .SVUVParser import SVUVParser
 from .SourceWriter import SourceFile, SourceObject
@@ -19,16 +17,31 @@ class DatasetBaker:
     CSV_PATH = ROOT / 'src' / 'logngine' / 'data'
     CITATION_FILE = OUT_PATH / 'Citations.h'
 
+    NODE_CAPACITY = 16  # must match the N_CHILD/N_KEYS of the emitted RSTFrozenTree
+
+    # Binary tree format read by `RSTTree::open_mmap`; keep in sync with `RSTBinaryHeader` and `RSTFlatNode`
+    BINARY_MAGIC = b"LGNRST"
+    BINARY_VERSION = 1
+    BINARY_ALIGNMENT = 64
+    BINARY_EXTENSION = ".rstree"
+
+    # Tables with every `ThermoState` column are single-phase blocks of constant pressure, and get a `*Spline` of
+    # monotone cubic Hermite knots for `RectilinearTable` baked next to the tree
+    SPLINE_COLUMNS = ("pressure", "temperature", "specific_volume", "specific_internal_energy", "specific_enthalpy", "specific_entropy")
+
     citations: list[str] = []
 
-    def __init__(self):
+    def __init__(self, emit_binary: bool = False):
         self.parser = SVUVParser()
+        self.emit_binary = emit_binary
         self.dataset = {}
 
         self.table_name = ""
         self.data_name = ""
         self.entry_name = ""
-        self.make_function_name = ""
+        self.knot_name = ""
+        self.nodes_name = ""
+        self.values_name = ""
 
         for path in self.IN_PATH.rglob("*.svuv"):
             out_path = self.OUT_PATH / path.relative_to(self.IN_PATH)
@@ -55,13 +68,12 @@ class DatasetBaker:
         self.dataset = self.parser.read(in_path)
         self._collect_citations()
 
-        order = self._optimize_ordering()
-        self._apply_order(order)
-
         self.table_name = out_path.stem
-        self.make_function_name = f'_make_baked_{self.table_name.lower()}_dataset'
+        self.nodes_name = f'_baked_{self.table_name.lower()}_nodes'
+        self.values_name = f'_baked_{self.table_name.lower()}_values'
         self.data_name = f'{self.table_name}Data'
         self.entry_name = f'{self.table_name}Entry'
+        self.knot_name = f'{self.table_name}Knot'
 
         writer = SourceFile(namespace)
         writer.add_include("array")
@@ -76,29 +88,145 @@ class DatasetBaker:
         writer.add(data_struct)
         writer.add(table_struct)
 
-        inserts = self._generate_insert_statements(headers)
-        inserts.insert(0, f"logngine::core::RSTTree<{self.entry_name}, {n_features}, 16, 16> {self.table_name}{{}};")
-        inserts.append(f"return {self.table_name};")
-
-        factory = SourceObject.Function(
-            self.make_function_name,
-            inserts,
-            f"inline logngine::core::RSTTree<{self.entry_name}, {n_features}, 16, 16>"
-        )
-        writer.add(factory)
-
+        # The tree is built here rather than at load time: the header only holds constant data in the layout
+        # RSTFrozenTree searches, and the tree itself is a constant-initialized view over it.
+        keys = list(zip(*[self.dataset[h] for h in headers]))
+        nodes, order = self._pack_tree(keys)
+        entries = self._generate_entry_initializers(headers)
+
+        writer.add(SourceObject.Array(
+            f"inline constexpr logngine::core::RSTFlatNode<{n_features}, {self.NODE_CAPACITY}>",
+            self.nodes_name,
+            [self._generate_node_initializer(node) for node in nodes]
+        ))
+        writer.add(SourceObject.Array(
+            f"inline constexpr {self.entry_name}",
+            self.values_name,
+            [entries[i] for i in order]
+        ))
+
+        tree_type = f"logngine::core::RSTFrozenTree<{self.entry_name}, {n_features}, {self.NODE_CAPACITY}, {self.NODE_CAPACITY}>"
         result = SourceObject.Variable(
-            f"const logngine::core::RSTTree<{self.entry_name}, {n_features}, 16, 16>",
+            f"inline constinit const {tree_type}",
             self.table_name,
-            f"{self.make_function_name}()"
+            [self.nodes_name, self.values_name]
         )
         writer.add(result)
+
+        if set(self.SPLINE_COLUMNS) <= set(headers):
+            writer.add(SourceObject.Struct(self.knot_name, value=f"const {self.data_name}", d_dtemperature=f"const {self.data_name}", d_dpressure=f"const {self.data_name}"))
+            writer.add(SourceObject.Array(
+                f"inline constexpr {self.knot_name}",
+                f"{self.table_name}Spline",
+                [self._generate_knot_initializer(headers, knot) for knot in self._spline_knots(headers)]
+            ))
         writer.build()
 
         with open(out_path, "w", encoding="utf-8") as f:
             self._watermark(f)
             f.write(writer.get_output())
 
+        if self.emit_binary:
+            self.compile_to_binary(out_path.with_suffix(self.BINARY_EXTENSION), headers, nodes, order)
+
+    def compile_to_binary(self, out_path: Path, headers: list[str], nodes: list[dict], order: list[int]) -> None:
+        """Writes the packed tree in the little-endian format `RSTTree::open_mmap` maps in place."""
+        dims, width = len(headers), self.NODE_CAPACITY
+        node_format = f"<{2 * dims * width}d{width}IIB"
+        value_format = f"<{2 * dims}dI"
+        node_size = self._align(struct.calcsize(node_format), self.BINARY_ALIGNMENT)
+        value_size = self._align(struct.calcsize(value_format), 8)  # alignof(double)
+
+        node_offset = self._align(64, self.BINARY_ALIGNMENT)  # sizeof(RSTBinaryHeader)
+        value_offset = self._align(node_offset + len(nodes) * node_size, self.BINARY_ALIGNMENT)
+        rows = list(self._entry_rows(headers))
+
+        with open(out_path, "wb") as f:
+            f.write(struct.pack("<8s6I4Q", self.BINARY_MAGIC, self.BINARY_VERSION, dims, width, node_size, value_size, 0,
+                                len(nodes), len(order), node_offset, value_offset))
+            f.write(bytes(node_offset - f.tell()))
+            for node in nodes:
+                bounds = [x for side in (0, 1) for row in self._padded_bounds(node, side) for x in row]
+                children = [slot[2] for slot in node["slots"]] + [0] * (width - len(node["slots"]))
+                f.write(struct.pack(node_format, *bounds, *children, len(node["slots"]), node["leaf"]).ljust(node_size, b"\0"))
+            f.write(bytes(value_offset - f.tell()))
+            for i in order:
+                data_row, uncert_row, citation = rows[i]
+                f.write(struct.pack(value_format, *data_row, *uncert_row, citation).ljust(value_size, b"\0"))
+
+    def _spline_knots(self, headers: list[str]) -> list[tuple[dict[str, float], dict[str, float], dict[str, float]]]:
+        """
+        Knots of the monotone cubic Hermite interpolant `RectilinearTable` evaluates over a table of constant-pressure
+        blocks, as (value, d/dtemperature, d/dpressure) rows sorted by pressure, then temperature. Of several rows at
+        the same (pressure, temperature) only the first is kept, as `RectilinearTable` does. The temperature slopes are
+        PCHIP's along each block; the pressure slopes are the same mean of the secants to the neighbouring blocks
+        (interpolated to the row's temperature), or the one secant there is where a neighbour does not reach it.
+        """
+        rows, seen = [], set()
+        for values in zip(*[self.dataset[h] for h in headers]):
+            row = dict(zip(headers, values))
+            key = (row["pressure"], row["temperature"])
+            if key not in seen and all(map(isfinite, key)):
+                seen.add(key)
+                rows.append(row)
+        rows.sort(key=lambda r: (r["pressure"], r["temperature"]))
+        blocks = [list(block) for _, block in groupby(rows, key=lambda r: r["pressure"])]
+        columns = [h for h in headers if h not in ("pressure", "temperature")]
+
+        temperatures = [[r["temperature"] for r in block] for block in blocks]
+        temperature_slopes = [{c: self._pchip_slopes(temperatures[b], [r[c] for r in block]) for c in columns}
+                              for b, block in enumerate(blocks)]
+
+        def evaluate(b: int, temperature: float) -> dict[str, float] | None:
+            ts = temperatures[b]
+            if not ts[0] <= temperature <= ts[-1]:
+                return None
+            i = bisect_left(ts, temperature)
+            if ts[i] == temperature:
+                return blocks[b][i]
+            h = ts[i] - ts[i - 1]
+            t = (temperature - ts[i - 1]) / h
+            h00, h10, h01, h11 = 2 * t**3 - 3 * t**2 + 1, t**3 - 2 * t**2 + t, -2 * t**3 + 3 * t**2, t**3 - t**2
+            return {c: h00 * blocks[b][i - 1][c] + h10 * h * temperature_slopes[b][c][i - 1]
+                       + h01 * blocks[b][i][c] + h11 * h * temperature_slopes[b][c][i] for c in columns}
+
+        knots = []
+        for b, block in enumerate(blocks):
+            for i, row in enumerate(block):
+                neighbours = [(blocks[n][0]["pressure"], evaluate(n, row["temperature"]))
+                              for n in (b - 1, b + 1) if 0 <= n < len(blocks)]
+                neighbours = [(p, r) for p, r in neighbours if r is not None]
+                d_dpressure = {"pressure": 1.0, "temperature": 0.0}
+                d_dtemperature = {"pressure": 0.0, "temperature": 1.0}
+                for c in columns:
+                    secants = [(row[c] - r[c]) / (row["pressure"] - p) for p, r in neighbours]
+                    widths = [abs(row["pressure"] - p) for p, _ in neighbours]
+                    d_dpressure[c] = (self._pchip_mean(*secants, *widths) if len(secants) == 2
+                                      else secants[0] if secants else 0.0)
+                    d_dtemperature[c] = temperature_slopes[b][c][i]
+                knots.append((row, d_dtemperature, d_dpressure))
+        return knots
+
+    @classmethod
+    def _pchip_slopes(cls, x: list[float], y: list[float]) -> list[float]:
+        """PCHIP slopes of y(x), with one-sided secants at the ends (as `SaturationCurve` computes them)."""
+        if len(x) < 2:
+            return [0.0] * len(x)
+        secants = [(y[k + 1] - y[k]) / (x[k + 1] - x[k]) for k in range(len(x) - 1)]
+        inner = [cls._pchip_mean(secants[k - 1], secants[k], x[k] - x[k - 1], x[k + 1] - x[k]) for k in range(1, len(x) - 1)]
+        return [secants[0], *inner, secants[-1]]
+
+    @staticmethod
+    def _pchip_mean(d0: float, d1: float, h0: float, h1: float) -> float:
+        """Fritsch & Butland's weighted harmonic mean of two neighbouring secants; zero at a local extremum."""
+        if d0 * d1 <= 0.0:
+            return 0.0
+        w0, w1 = 2.0 * h1 + h0, h1 + 2.0 * h0
+        return (w0 + w1) / (w0 / d0 + w1 / d1)
+
+    def _generate_knot_initializer(self, headers: list[str], knot: tuple[dict[str, float], ...]) -> str:
+        return self._as_initializer(self.knot_name, [self._as_initializer(self.data_name, (str(part[h]) for h in headers)) for part in knot])
+
     def _collect_citations(self):
         for citation in self.dataset["$citation"]:
             if citation not in self.__class__.citations:
@@ -138,90 +266,102 @@ class DatasetBaker:
     def _watermark(f):
         f.write('// Automatically generated by (project-root)/tools/DatasetBaker.py\n\n')
 
-    def _optimize_ordering(self) -> List[int]:
-        ordered, _ = self._find_best_insertion_order(self._dataset_to_rtree_entries(self.dataset))
-        return [int(label) for _, label in ordered]
-
-    def _apply_order(self, order: List[int]):
-        self.dataset = {k: [self.dataset[k][i] for i in order] for k in self.dataset}
+    @classmethod
+    def _pack_tree(cls, keys: list[tuple[float, ...]]) -> tuple[list[dict], list[int]]:
+        """
+        Bulk-loads `keys` the way `RSTTree::bulk_load` does and flattens the result breadth-first the way
+        `RSTTree::freeze` does. Returns the flat nodes (`is_leaf` plus `(min, max, child)` slots; leaf children index
+        into the values) and the order in which the values must be stored.
+        """
+        dims = len(keys[0])
+
+        def region(members: list[tuple[list[float], list[float]]]) -> tuple[list[float], list[float]]:
+            return ([min(m[0][d] for m in members) for d in range(dims)],
+                    [max(m[1][d] for m in members) for d in range(dims)])
+
+        def pack(items: list, coordinate: Callable[[int, int], float]) -> list[list]:
+            order = cls._sort_tile_recursive(list(range(len(items))), coordinate, 0, dims)
+            return [[items[i] for i in order[s:s + cls.NODE_CAPACITY]] for s in range(0, len(order), cls.NODE_CAPACITY)]
+
+        level = []
+        for members in pack(list(range(len(keys))), lambda i, d: keys[i][d]):
+            level.append({"leaf": True, "children": members, "region": region([(keys[i], keys[i]) for i in members])})
+        while len(level) > 1:
+            parents = []
+            for members in pack(level, lambda i, d: 0.5 * (level[i]["region"][0][d] + level[i]["region"][1][d])):
+                parents.append({"leaf": False, "children": members, "region": region([m["region"] for m in members])})
+            level = parents
+
+        nodes, order = [], []
+        pending = level[:1]
+        for node in pending:  # grows as children are queued
+            slots = []
+            for child in node["children"]:
+                if node["leaf"]:
+                    slots.append((keys[child], keys[child], len(order)))
+                    order.append(child)
+                else:
+                    slots.append((*child["region"], len(pending)))
+                    pending.append(child)
+            nodes.append({"leaf": node["leaf"], "slots": slots})
+        return nodes, order
 
-    def _generate_insert_statements(self, headers: list[str]) -> list[str]:
-        keys = self._generate_key_initializers(headers)
-        values = self._generate_entry_initializers(headers)
-        return [f"{self.table_name}.insert({k}, {v});" for k, v in zip(keys, values)]
+    @classmethod
+    def _sort_tile_recursive(cls, order: list[int], coordinate: Callable[[int, int], float], axis: int, dims: int) -> list[int]:
+        capacity = cls.NODE_CAPACITY
+        if len(order) <= capacity:
+            return order
+        order = sorted(order, key=lambda i: coordinate(i, axis))
+        if axis + 1 == dims:
+            return order
+
+        n_nodes = ceil(len(order) / capacity)
+        n_slabs = ceil(n_nodes ** (1.0 / (dims - axis)))
+        slab = capacity * ceil(n_nodes / n_slabs)
+        return [i for s in range(0, len(order), slab)
+                for i in cls._sort_tile_recursive(order[s:s + slab], coordinate, axis + 1, dims)]
+
+    def _padded_bounds(self, node: dict, side: int) -> list[list[float]]:
+        """Per-dimension min (`side` 0) or max (`side` 1) bounds of every slot, with unused slots at +inf."""
+        rows = []
+        for d in range(len(node["slots"][0][0])):
+            row = [slot[side][d] for slot in node["slots"]]
+            rows.append(row + [float("inf")] * (self.NODE_CAPACITY - len(row)))
+        return rows
+
+    def _generate_node_initializer(self, node: dict) -> str:
+        def bounds(side: int) -> str:
+            rows = [f"{{{', '.join(map(self._as_double, row))}}}" for row in self._padded_bounds(node, side)]
+            return f"{{{{{', '.join(rows)}}}}}"
+
+        children = [str(slot[2]) for slot in node["slots"]]
+        children += ["0"] * (self.NODE_CAPACITY - len(children))
+        return (f"{{.min = {bounds(0)}, .max = {bounds(1)}, .children = {{{', '.join(children)}}}, "
+                f".size = {len(node['slots'])}, .is_leaf = {'true' if node['leaf'] else 'false'}}}")
 
-    def _generate_key_initializers(self, headers: list[str]) -> list[str]:
-        return [
-            self._as_initializer(f"std::array<double, {len(headers)}>", map(str, row))
-            for row in zip(*[self.dataset[h] for h in headers])
-        ]
+    @staticmethod
+    def _as_double(value: float) -> str:
+        return "logngine::core::inf" if value == float("inf") else str(value)
+
+    def _entry_rows(self, headers: list[str]) -> Iterable[tuple[tuple[float, ...], tuple[float, ...], int]]:
+        yield from zip(
+            zip(*[self.dataset[h] for h in headers]),
+            zip(*[self.dataset[h + "$uncertainty"] for h in headers]),
+            (self.__class__.citations.index(citation) for citation in self.dataset["$citation"])
+        )
 
     def _generate_entry_initializers(self, headers: list[str]) -> list[str]:
         entries = []
-        for data_row, uncert_row, citation in zip(
-                zip(*[self.dataset[h] for h in headers]),
-                zip(*[self.dataset[h + "$uncertainty"] for h in headers]),
-                self.dataset["$citation"]
-        ):
+        for data_row, uncert_row, citation in self._entry_rows(headers):
             d = self._as_initializer(self.data_name, map(str, data_row))
             u = self._as_initializer(self.data_name, map(str, uncert_row))
-            c = str(self.__class__.citations.index(citation))
-            entries.append(self._as_initializer(self.entry_name, [d, u, c]))
+            entries.append(self._as_initializer(self.entry_name, [d, u, str(citation)]))
         return entries
 
     @staticmethod
-    def _as_initializer(name: str, fields: Iterable[str]) -> str:
-        return f"{name}{{{', '.join(fields)}}}"
-
-    @staticmethod
-    def _dataset_to_rtree_entries(data: Dict[str, List[Any]]) -> List[Tuple[Tuple[List[float], List[float]], str]]:
-        headers = [k for k in data if '$' not in k]
-        zipped = list(zip(*[data[h] for h in headers]))
-        return [((list(row), list(row)), str(i)) for i, row in enumerate(zipped)]
+    def _align(offset: int, alignment: int) -> int:
+        return -(-offset // alignment) * alignment
 
     @staticmethod
-    def _mbr_volume(bounds: List[float]) -> float:
-        d = len(bounds) // 2
-        return np.prod([bounds[d+i] - bounds[i] for i in range(d)])
-
-    @classmethod
-    def _compute_overlap(cls, tree: index.Index) -> float:
-        overlap = 0.0
-        for i in tree.intersection(tree.bounds, objects=True):
-            for j in tree.intersection(i.bbox, objects=True):
-                if i.id >= j.id:
-                    continue
-                dims = len(i.bbox) // 2
-                inter = [max(i.bbox[k], j.bbox[k]) for k in range(dims)] +                         [min(i.bbox[k + dims], j.bbox[k + dims]) for k in range(dims)]
-                if all(inter[k] < inter[k + dims] for k in range(dims)):
-                    overlap += cls._mbr_volume(inter)
-        return overlap
-
-    @classmethod
-    def _evaluate_tree(cls, entries: List[Tuple[Tuple[List[float], List[float]], str]]) -> Tuple[float, float]:
-        p = index.Property()
-        p.dimension = len(entries[0][0][0])
-        tree = index.Index(properties=p)
-
-        for i, ((lo, hi), _) in enumerate(entries):
-            bbox = tuple(lo + hi)
-            tree.insert(i, bbox)
-
-        area = sum(cls._mbr_volume(obj.bbox) for obj in tree.intersection(tree.bounds, objects=True))
-        overlap = cls._compute_overlap(tree)
-        return area, overlap
-
-    @classmethod
-    def _find_best_insertion_order(cls, entries: List[Tuple[Tuple[List[float], List[float]], str]], trials: int = 1000):
-        best, best_score, all_scores = [], float("inf"), []
-
-        for _ in tqdm(range(trials), desc="Optimizing insertion order"):
-            random.shuffle(entries)
-            area, overlap = cls._evaluate_tree(entries)
-            score = area + overlap
-            all_scores.append((score, list(entries)))
-            if score < best_score:
-                best_score = score
-                best = list(entries)
-
-        return best, all_scores
+    def _as_initializer(name: str, fields: Iterable[str]) -> str:
+        return f"{name}{{{', '.join(fields)}}}"
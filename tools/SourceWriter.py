@@ -126,6 +126,16 @@ class SourceObject:
                 return [f"{self.type} {self.name} = {self.initializer};"]
             return [f"{self.type} {self.name} = {self._format_initializer()};"]
 
+    class Array(SourceElement):
+        def __init__(self, type_: str, name: str, elements: list[str]):
+            super().__init__()
+            self.type = type_
+            self.name = name
+            self.elements = elements
+
+        def get_definitions(self) -> list[str]:
+            return [f"{self.type} {self.name}[] = {{", *(f"    {e}," for e in self.elements), "};"]
+
     class Struct(SourceElement, SourceBuilder):
         def __init__(self, name: str, **fields: str):
             SourceElement.__init__(self)
@@ -145,13 +155,13 @@ class SourceObject:
         def get_definitions(self) -> list[str]:
             self._output = []
             with self._section(f"struct {self.name} {{", "};", self.get_indent()):
-                self._append(f"    {self.name}() = default;")
+                self._append(f"    constexpr {self.name}() = default;")
                 args = ", ".join(
                     f"{v.type + '&' if 'const' in v.type else v.type} {v.name}"
                     for v in self.fields.values()
                 )
                 init_list = ", ".join(f"{v.name}({v.name})" for v in self.fields.values())
-                self._append(f"    {self.name}({args}): {init_list} {{}}")
+                self._append(f"    constexpr {self.name}({args}): {init_list} {{}}")
                 for var in self.fields.values():
                     var.inherit_indent(self)
                     self._add_indented(var.get_definitions(), var.get_indent())